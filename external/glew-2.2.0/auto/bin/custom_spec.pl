@@ -0,0 +1,135 @@
+#!/usr/bin/env perl
+##
+## Copyright (C) 2008-2019, Nigel Stewart <nigels[]users sourceforge net>
+## Copyright (C) 2002-2008, Marcelo E. Magallon <mmagallo[]debian org>
+## Copyright (C) 2002-2008, Milan Ikits <milan ikits[]ieee org>
+##
+## This program is distributed under the terms and conditions of the GNU
+## General Public License Version 2 as published by the Free Software
+## Foundation or, at your option, any later version.
+
+use strict;
+use warnings;
+
+use lib '.';
+do 'bin/make.pl';
+
+##
+## Custom Spec
+##
+## Output the descriptors of the extensions listed in an allowlist for
+## one API (GL, GLX, WGL or EGL), along with everything they depend on:
+## extensions they reuse entry points of, extensions whose extension
+## string they are advertised by, and extensions defining the types and
+## tokens they refer to.  The core descriptors are always generated and
+## not output, but the extensions they reuse are.  The allowlist holds
+## an extension name per line, blank lines and lines starting with # are
+## ignored.
+##
+## Usage: custom_spec.pl <allowlist> <API> <extension dir> <core descriptors>
+##
+
+# Extensions the GLEW sources, glewinfo and visualinfo refer to directly
+my %required = (
+	"GLX" => [ "GLX_ARB_create_context", "GLX_ARB_create_context_profile",
+	           "GLX_ARB_get_proc_address", "GLX_ATI_pixel_format_float",
+	           "GLX_NV_float_buffer" ],
+	"WGL" => [ "WGL_ARB_create_context", "WGL_ARB_create_context_profile",
+	           "WGL_ARB_extensions_string", "WGL_ARB_multisample",
+	           "WGL_ARB_pbuffer", "WGL_ARB_pixel_format",
+	           "WGL_ATI_pixel_format_float", "WGL_EXT_extensions_string",
+	           "WGL_EXT_pixel_format_packed_float", "WGL_NV_float_buffer" ],
+	"EGL" => [ "EGL_EXT_device_enumeration", "EGL_EXT_platform_base",
+	           "EGL_EXT_platform_device" ],
+);
+
+# Identifiers of types, tokens and entry points referred to by an extension
+sub references($$$$)
+{
+	my ($types, $tokens, $functions, $exacts) = @_;
+	my @s = (@$types, @$exacts, values %$tokens,
+		map { $_->{rtype} . " " . $_->{parms} } values %$functions);
+	return map { /([A-Za-z_][A-Za-z0-9_]*)/g } @s;
+}
+
+# Identifiers defined by an extension
+sub definitions($$$)
+{
+	my ($types, $tokens, $exacts) = @_;
+	my @names = keys %$tokens;
+	foreach my $type (@$types, @$exacts)
+	{
+		my $t = $type;
+		$t =~ s/;\s*$//;
+		if ($t =~ /\(\s*\w*\s*\*\s*(\w+)\s*\)\s*\(/)
+		{
+			push @names, $1;
+		}
+		elsif ($t =~ /\}([^}]*)$/)
+		{
+			push @names, ($1 =~ /(\w+)/g);
+		}
+		elsif ($t =~ /(\w+)\s*$/)
+		{
+			push @names, $1;
+		}
+	}
+	return @names;
+}
+
+#-------------------------------------------------------------------------------
+
+my ($allowlist, $api, $dir, @core) = @ARGV;
+die "Usage: custom_spec.pl <allowlist> <API> <extension dir> <core descriptors>\n" unless defined $dir;
+
+my %defined = ();    # identifier => extension defining it
+my %specs = ();      # extension => [ file, reuse, extstring, references ]
+my @pending = ();    # extensions to output
+
+# the core descriptors are generated anyway, but may reuse extensions
+foreach my $file (grep { -f } @core)
+{
+	my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) =
+		parse_ext($file);
+	$defined{$_} = "" foreach (definitions($types, $tokens, $exacts), keys %$functions);
+	push @pending, @$reuse;
+}
+
+opendir(my $dh, $dir) or die "$dir: $!\n";
+foreach my $file (sort grep { /^${api}_/ } readdir($dh))
+{
+	my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) =
+		parse_ext("$dir/$file");
+	my @refs = references($types, $tokens, $functions, $exacts);
+	$specs{$extname} = [ "$dir/$file", $reuse, $extstring, \@refs ];
+	foreach my $name (definitions($types, $tokens, $exacts))
+	{
+		$defined{$name} = $extname unless exists $defined{$name};
+	}
+}
+closedir($dh);
+
+push @pending, grep { exists $specs{$_} } @{$required{$api} || []};
+open(my $fh, "<", $allowlist) or die "$allowlist: $!\n";
+while (<$fh>)
+{
+	s/#.*//;
+	s/^\s+|\s+$//g;
+	next unless /^${api}_/;
+	next if /^${api}_VERSION_/;
+	die "$allowlist: unknown extension $_\n" unless exists $specs{$_};
+	push @pending, $_;
+}
+close($fh);
+
+my %custom = ();
+while (@pending)
+{
+	my $extname = shift @pending;
+	next if $custom{$extname}++;
+	my ($file, $reuse, $extstring, $refs) = @{$specs{$extname}};
+	push @pending, grep { exists $specs{$_} } (@$reuse, $extstring);
+	push @pending, grep { length } map { $defined{$_} } grep { exists $defined{$_} } @$refs;
+}
+
+print map { "$specs{$_}[0]\n" } sort keys %custom;
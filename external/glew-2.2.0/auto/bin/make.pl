@@ -41,6 +41,37 @@ sub make_exact($)
     return $exact;
 }
 
+# split a parameter list into (declaration, argument) pairs, renaming the
+# arguments a0, a1, ... since some specs leave parameters unnamed
+sub make_args($)
+{
+	my @decls = ();
+	my @args = ();
+	my $parms = $_[0];
+
+	return (\@decls, \@args) if ($parms =~ /^\s*void\s*$/);
+
+	my $i = 0;
+	foreach my $parm (split(/\s*,\s*/, $parms))
+	{
+		my $arg = "a$i";
+		$parm =~ s/^\s+|\s+$//g;
+		my $array = "";
+		$array = $1 if ($parm =~ s/\s*((?:\[[^\]]*\])+)$//);
+		if ($parm =~ /^(.*?[\s\*])([A-Za-z_][A-Za-z0-9_]*)$/)
+		{
+			my ($decl, $name) = ($1, $2);
+			$parm = $decl if ($decl =~ /[A-Za-z_]/ &&
+				$name !~ /^(const|void|char|short|int|long|float|double|signed|unsigned)$/);
+		}
+		$parm =~ s/\s+$//;
+		push @decls, "$parm $arg$array";
+		push @args, $arg;
+		$i++;
+	}
+	return (\@decls, \@args);
+}
+
 sub make_separator($)
 {
     my $extname = $_[0];
@@ -65,6 +96,108 @@ sub make_separator($)
 
 #---------------------------------------------------------------------------------------
 
+# 32-bit product, split so that intermediate values stay exact
+sub mul32($$)
+{
+    my ($a, $b) = @_;
+    return (($a * ($b & 0xffff)) + ((($a * ($b >> 16)) & 0xffff) << 16)) & 0xffffffff;
+}
+
+# 32-bit multiplicative hash of a string, four characters at a time.
+# Must match _glewHash in auto/src/glew_head.c
+sub hash_string($)
+{
+    my @c = unpack("C*", $_[0]);
+    my $h = 2166136261 ^ scalar @c;
+    for (my $i = 0; $i < @c; $i += 4)
+    {
+        my $w = 0;
+        for (my $k = 0; $k < 4 && $i + $k < @c; ++$k)
+        {
+            $w |= $c[$i + $k] << (8 * $k);
+        }
+        $h = mul32($h ^ $w, 0x9e3779b1);
+        $h ^= $h >> 15;
+    }
+    return $h;
+}
+
+# Remix hash h with displacement d (murmur3 finalizer).
+# Must match _glewHashMix in auto/src/glew_head.c
+sub hash_mix($$)
+{
+    my ($h, $d) = @_;
+    $h = ($h ^ mul32($d, 0x9e3779b9)) & 0xffffffff;
+    $h ^= $h >> 16;
+    $h = mul32($h, 0x85ebca6b);
+    $h ^= $h >> 13;
+    $h = mul32($h, 0xc2b2ae35);
+    $h ^= $h >> 16;
+    return $h;
+}
+
+# Reduce hash h to the range [0, n) by multiplication rather than division.
+# Must match _glewHashRange in auto/src/glew_head.c
+sub hash_range($$)
+{
+    my ($h, $n) = @_;
+    return ($h * $n) >> 32;
+}
+
+# Minimal perfect hash (hash and displace) of a list of unique names.
+#
+# Returns the names in slot order and one displacement per bucket. A
+# name hashes to bucket hash_range(hash_string(name), n). Buckets
+# holding more than one name store the displacement d > 0 for which
+# hash_range(hash_mix(hash_string(name), d), n) places every name of
+# the bucket in a distinct free slot, buckets holding a single name
+# store -(slot + 1), and empty buckets store 0.
+sub make_hash(@)
+{
+    my @names = @_;
+    my $n = scalar @names;
+    my @buckets = map { [] } (1 .. $n);
+    my @hash = (0) x $n;
+    my @slots = (undef) x $n;
+
+    my %h = map { $_ => hash_string($_) } @names;
+
+    foreach my $name (@names)
+    {
+        push @{$buckets[hash_range($h{$name}, $n)]}, $name;
+    }
+
+    my @order = sort { scalar @{$buckets[$b]} <=> scalar @{$buckets[$a]} || $a <=> $b } (0 .. $n - 1);
+
+    foreach my $bucket (grep { scalar @{$buckets[$_]} > 1 } @order)
+    {
+        my $d = 1;
+        my @s;
+        while (1)
+        {
+            my %used = ();
+            @s = map { hash_range(hash_mix($h{$_}, $d), $n) } @{$buckets[$bucket]};
+            last unless grep { defined $slots[$_] || $used{$_}++ } @s;
+            $d++;
+            die "no displacement found for bucket $bucket" if ($d > 32767);
+        }
+        $hash[$bucket] = $d;
+        @slots[@s] = @{$buckets[$bucket]};
+    }
+
+    my @free = grep { !defined $slots[$_] } (0 .. $n - 1);
+    foreach my $bucket (grep { scalar @{$buckets[$_]} == 1 } @order)
+    {
+        my $s = shift @free;
+        $hash[$bucket] = -($s + 1);
+        $slots[$s] = $buckets[$bucket][0];
+    }
+
+    return (\@slots, \@hash);
+}
+
+#---------------------------------------------------------------------------------------
+
 sub parse_ext($)
 {
     my $filename = shift;
@@ -18,19 +18,20 @@ do 'bin/make.pl';
 ##
 ## Make Extension-enabled Index
 ##
+## Output the extension string and enable flags in the same minimal
+## perfect hash slot order as make_index.pl.
+##
 
 my @extlist = ();
 
+my $prefix = shift;
+
 if (@ARGV)
 {
 	@extlist = @ARGV;
 
-	print "/* Detected in the extension string or strings */\n";
-	print "static GLboolean  _glewExtensionString[" . scalar @extlist . "];\n";
-
-	print "/* Detected via extension string or experimental mode */\n";
-	print "static GLboolean* _glewExtensionEnabled[] = {\n";;
-
+	my @names = ();
+	my %extvars = ();
 	foreach my $ext (sort { basename($a) cmp basename($b) } @extlist)
 	{
 		my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) = 
@@ -39,10 +40,26 @@ if (@ARGV)
 		my $extvar = $extname;
 		$extvar =~ s/GL(X*)_/GL$1EW_/;
 
-		print "#ifdef $extname\n";
-		print "  &__$extvar,\n";
-		print "#endif\n";
+		push @names, $extname;
+		$extvars{$extname} = $extvar;
 	}
 
-	print "  NULL\n};\n\n";
+	my ($slots, $hash) = make_hash(@names);
+
+	print "/* Detected in the extension string or strings */\n";
+	print "static GLboolean  ${prefix}ExtensionString[" . scalar @extlist . "];\n";
+
+	print "/* Detected via extension string or experimental mode */\n";
+	print "static GLboolean* ${prefix}ExtensionEnabled[] = {\n";
+	print map { "  &__$extvars{$_},\n" } @$slots;
+	print "};\n\n";
+
+	# GLEWContext holds the GL flags for glewContextInitFor
+	if ($prefix eq "_glew")
+	{
+		print "/* Offsets of the same flags in GLEWContext */\n";
+		print "static const GLuint ${prefix}ContextEnabled[] = {\n";
+		print map { "  offsetof(GLEWContext, __$extvars{$_}),\n" } @$slots;
+		print "};\n\n";
+	}
 }
@@ -18,24 +18,47 @@ do 'bin/make.pl';
 ##
 ## Make Index
 ##
-## Output sorted array of extension strings for indexing into extension
-## enable/disable flags.  This provides a way to convert an extension string
-## into an integer index.
+## Output the array of extension strings for indexing into extension
+## enable/disable flags, in the slot order of a minimal perfect hash,
+## along with the displacements of the hash.  This provides a way to
+## convert an extension string into an integer index with a single
+## hash and string compare.  The signature of the slot order identifies
+## the flags stored in a capability cache (GLEW_CACHE).
 ##
 
 my @extlist = ();
 
+my $prefix = shift;
+
 if (@ARGV)
 {
 	@extlist = @ARGV;
 
+	my @names = ();
 	foreach my $ext (sort { basename($a) cmp basename($b) } @extlist)
 	{
 		my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) = 
 			parse_ext($ext);
 
-		print "#ifdef $extname\n";
-		print "  \"$extname\",\n";
-		print "#endif\n";
+		push @names, $extname;
 	}
+
+	my ($slots, $hash) = make_hash(@names);
+
+	print "/* Extension names, in minimal perfect hash slot order */\n";
+	print "static const char * ${prefix}ExtensionLookup[] = {\n";
+	print map { "  \"$_\",\n" } @$slots;
+	print "};\n\n";
+
+	print "/* Minimal perfect hash displacements, see make_hash in auto/bin/make.pl */\n";
+	print "static const GLshort ${prefix}ExtensionHash[] = {\n";
+	for (my $i = 0; $i < scalar @$hash; $i += 16)
+	{
+		my $last = $i + 15 < $#$hash ? $i + 15 : $#$hash;
+		print "  " . join(", ", @$hash[$i .. $last]) . ",\n";
+	}
+	print "};\n\n";
+
+	print "/* Hash of the slot order, identifying the flags stored in a capability cache */\n";
+	printf "#define %s_EXTENSION_SIGNATURE 0x%08xu\n\n", uc($prefix), hash_string(join(" ", @$slots));
 }
@@ -14,18 +14,47 @@ use warnings;
 use lib '.';
 do 'bin/make.pl';
 
-#-------------------------------------------------------------------------------
+##
+## Make Init
+##
+## Output the entry point tables: the addresses of every function
+## pointer grouped by extension, and per extension ranges holding the
+## NUL separated entry point names and the index of the first function
+## pointer.  An extension that reuses others, or needs entry points
+## specified elsewhere, gets additional ranges.  _glewInit_<extension>
+## resolves the ranges of an extension with _glewResolveRanges.  For GL
+## also output the offsets of the function pointers in GLEWContext.
+##
 
-# function pointer definition
-sub make_pfn_def_init($%)
-{
-    #my $name = prefixname($_[0]);
-    return "  r = ((" . $_[0] . " = (PFN" . (uc $_[0]) . "PROC)glewGetProcAddress((const GLubyte*)\"" . $_[0] . "\")) == NULL) || r;";
-}
+# Entry points specified by one extension but also resolved along with
+# another one, avoiding duplicate definitions
+my %extra = (
+	"GL_ARB_imaging" => [ "glBlendEquation" ],
+);
 
-sub make_reuse_call($%)
+# Split the names of a range into chunks whose string literals stay
+# within the 509 characters an ANSI C compiler has to support
+sub chunk_range
 {
-	return "  r = _glewInit_" . $_[0] . "() || r;";
+	my ($comment, $names, $first) = @_;
+	my @chunks = ();
+	my @chunk = ();
+	my $length = 1;
+
+	foreach my $name (@$names)
+	{
+		if (@chunk && $length + length($name) + 1 > 509)
+		{
+			push @chunks, [ $comment, [ @chunk ], $first ];
+			$first += scalar @chunk;
+			@chunk = ();
+			$length = 1;
+		}
+		push @chunk, $name;
+		$length += length($name) + 1;
+	}
+	push @chunks, [ $comment, [ @chunk ], $first ] if (@chunk);
+	return @chunks;
 }
 
 #-------------------------------------------------------------------------------
@@ -34,28 +63,109 @@ my @extlist = ();
 my %extensions = ();
 
 our $type = shift;
+my $prefix = "_" . lc($type) . "ew";
 
 if (@ARGV)
 {
-    @extlist = @ARGV;
+	@extlist = @ARGV;
+
+	my @exts = ();
+	my %own = ();
+	my %index = ();
+	my $n = 0;
 
 	foreach my $ext (sort @extlist)
 	{
 		my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) = 
 			parse_ext($ext);
 
-		#make_separator($extname);
-		my $extvar = $extname;
-		my $extvardef = $extname;
-		$extvar =~ s/GL(X*)_/GL$1EW_/;
-		if (keys %$functions or keys @$reuse)
+		my @names = sort keys %$functions;
+		push @exts, [ $extname, \@names, $reuse ];
+		if (@names)
+		{
+			$own{$extname} = [ \@names, $n ];
+			$index{$names[$_]} = $n + $_ foreach (0 .. $#names);
+			$n += scalar @names;
+		}
+	}
+
+	print "/* Function pointers, grouped by extension */\n";
+	print "static _GLEWProc* const ${prefix}Functions[] = {\n";
+	foreach my $ext (@exts)
+	{
+		my ($extname, $names, $reuse) = @$ext;
+		next unless @$names;
+		print "  /* $extname */\n";
+		print map { "  (_GLEWProc*)&" . prefixname($_) . ",\n" } @$names;
+	}
+	print "  NULL\n" unless $n;
+	print "};\n\n";
+
+	# GLEWContext holds the GL function pointers for glewContextInitFor
+	my $context = $type eq "GL";
+	if ($context)
+	{
+		print "/* Offsets of the same function pointers in GLEWContext */\n";
+		print "static const GLuint ${prefix}ContextFunctions[] = {\n";
+		foreach my $ext (@exts)
+		{
+			my ($extname, $names, $reuse) = @$ext;
+			print map { "  offsetof(GLEWContext, " . prefixname($_) . "),\n" } @$names;
+		}
+		print "  0\n" unless $n;
+		print "};\n\n";
+	}
+
+	my @init = ();
+	my $r = 0;
+
+	print "/* Entry point names and first function pointer of each extension */\n";
+	print "static const _GLEWRange ${prefix}Ranges[] = {\n";
+	foreach my $ext (@exts)
+	{
+		my ($extname, $names, $reuse) = @$ext;
+		my @ranges = ();
+
+		push @ranges, chunk_range($extname, @{$own{$extname}}) if (@$names);
+		foreach my $reused (sort @$reuse)
+		{
+			die "$extname reuses $reused, which is not being generated\n" unless exists $own{$reused};
+			push @ranges, chunk_range($reused, @{$own{$reused}});
+		}
+		foreach my $name (@{$extra{$extname} || []})
+		{
+			push @ranges, [ $name, [ $name ], $index{$name} ] if exists $index{$name};
+		}
+		next unless @ranges;
+
+		foreach my $range (@ranges)
 		{
-			print "#ifdef $extname\n\n";
-			print "static GLboolean _glewInit_$extname ()\n{\n  GLboolean r = GL_FALSE;\n";
-			output_reuse($reuse, \&make_reuse_call);
-			output_decls($functions, \&make_pfn_def_init);
-			print "\n  return r;\n}\n\n";
-			print "#endif /* $extname */\n\n";
+			my ($comment, $rnames, $first) = @$range;
+			print "  /* $comment */\n";
+			print "  { " . join("\n    ", map { "\"$_\\0\"" } @$rnames) . ", $first, " . scalar @$rnames . " },\n";
 		}
+		push @init, [ $extname, $r, scalar @ranges ];
+		$r += scalar @ranges;
+	}
+	print "  { NULL, 0, 0 }\n" unless $r;
+	print "};\n\n";
+
+	if ($context)
+	{
+		print "static GLboolean ${prefix}InitRanges (GLEWContext* ctx, GLuint first, GLuint n)\n{\n";
+		print "  return _glewResolveRanges(${prefix}Functions, ${prefix}ContextFunctions, ctx, ${prefix}Ranges + first, n);\n}\n\n";
+	}
+	else
+	{
+		print "static GLboolean ${prefix}InitRanges (GLuint first, GLuint n)\n{\n";
+		print "  return _glewResolveRanges(${prefix}Functions, NULL, NULL, ${prefix}Ranges + first, n);\n}\n\n";
+	}
+
+	# the GL ones initialize ctx, the GLEWContext being initialized or NULL
+	foreach my $init (@init)
+	{
+		my ($extname, $first, $count) = @$init;
+		print "#define _glewInit_$extname() ${prefix}InitRanges(" . ($context ? "ctx, " : "") . "$first, $count)\n";
 	}
+	print "\n";
 }
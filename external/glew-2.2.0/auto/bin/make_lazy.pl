@@ -0,0 +1,93 @@
+#!/usr/bin/env perl
+##
+## Copyright (C) 2008-2019, Nigel Stewart <nigels[]users sourceforge net>
+## Copyright (C) 2002-2008, Marcelo E. Magallon <mmagallo[]debian org>
+## Copyright (C) 2002-2008, Milan Ikits <milan ikits[]ieee org>
+##
+## This program is distributed under the terms and conditions of the GNU
+## General Public License Version 2 as published by the Free Software
+## Foundation or, at your option, any later version.
+
+use strict;
+use warnings;
+
+use lib '.';
+do 'bin/make.pl';
+
+##
+## Make Lazy
+##
+## Output a trampoline for every entry point, a table of them in the
+## order of the function pointer table of make_init.pl, and
+## _glewLazyInit which points every function pointer at its trampoline.
+## On first call the trampoline resolves the entry point, patches the
+## function pointer and forwards the call, so glewInitLazy does not need
+## to call glewGetProcAddress for functions that are never used.
+##
+
+#-------------------------------------------------------------------------------
+
+# trampoline definition
+sub make_pfn_lazy($%)
+{
+	our $api;
+	my ($name, $fun) = @_;
+	my ($decls, $args) = make_args($fun->{parms});
+	my $rtype = $fun->{rtype};
+	my $call = "$name(" . join(", ", @$args) . ");";
+
+	my $s = "static $rtype " . (length($api) ? "$api " : "") . "_glewLazy_$name (" . (@$decls ? join(", ", @$decls) : "void") . ")\n{\n";
+	$s .= "  $name = (PFN" . (uc $name) . "PROC)glewGetProcAddress((const GLubyte*)\"$name\");\n";
+	$s .= ($rtype =~ /^\s*void\s*$/) ? "  $call\n" : "  return $call\n";
+	$s .= "}\n";
+	return $s;
+}
+
+# trampoline table entry
+sub make_pfn_lazy_entry($%)
+{
+	return "  (_GLEWProc)_glewLazy_" . $_[0] . ",";
+}
+
+#-------------------------------------------------------------------------------
+
+my @extlist = ();
+my %extensions = ();
+
+our $api = shift;
+our $type = shift;
+my $prefix = "_" . lc($type) . "ew";
+
+if (@ARGV)
+{
+	@extlist = @ARGV;
+
+	my @exts = ();
+	foreach my $ext (sort @extlist)
+	{
+		my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) =
+			parse_ext($ext);
+		push @exts, [ $extname, $functions ] if (keys %$functions);
+	}
+
+	foreach my $ext (@exts)
+	{
+		my ($extname, $functions) = @$ext;
+		output_decls($functions, \&make_pfn_lazy);
+		print "\n";
+	}
+
+	print "static const _GLEWProc ${prefix}LazyFunctions[] = {";
+	foreach my $ext (@exts)
+	{
+		my ($extname, $functions) = @$ext;
+		output_decls($functions, \&make_pfn_lazy_entry);
+	}
+	print "};\n\n";
+
+	print "static void _glewLazyInit_$type ()\n{\n";
+	print "  size_t i;\n";
+	print "  for (i = 0; i < sizeof(${prefix}LazyFunctions) / sizeof(${prefix}LazyFunctions[0]); ++i)\n";
+	print "    *${prefix}Functions[i] = ${prefix}LazyFunctions[i];\n";
+	print "}\n\n";
+}
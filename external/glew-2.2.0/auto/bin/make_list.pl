@@ -44,12 +44,14 @@ if (@ARGV)
 
 		#my $pextvar = prefix_varname($extvar);
 
-		if (length($extstring) && $extstring !~ /^GL_/ || keys %$functions)
+		# GL, GLX and EGL extension strings are tokenized once into the
+		# extension index, WGL extensions are searched for one by one
+		if (length($extstring) && $extstring =~ /^WGL_/ || keys %$functions)
 		{
 			print "#ifdef $extname\n";
 		}
 
-		if (length($extstring) && $extstring !~ /^GL_/)
+		if (length($extstring) && $extstring =~ /^WGL_/)
 		{
 			print "  " . $extvar . " = _glewSearchExtension(\"$extstring\", extStart, extEnd);\n";
 		}
@@ -66,7 +68,7 @@ if (@ARGV)
 			}
 		}
 
-		if (length($extstring) && $extstring !~ /^GL_/ || keys %$functions)
+		if (length($extstring) && $extstring =~ /^WGL_/ || keys %$functions)
 		{
 			print "#endif /* $extname */\n";
 		}
@@ -0,0 +1,96 @@
+#!/usr/bin/env perl
+##
+## Copyright (C) 2008-2019, Nigel Stewart <nigels[]users sourceforge net>
+## Copyright (C) 2002-2008, Marcelo E. Magallon <mmagallo[]debian org>
+## Copyright (C) 2002-2008, Milan Ikits <milan ikits[]ieee org>
+##
+## This program is distributed under the terms and conditions of the GNU
+## General Public License Version 2 as published by the Free Software
+## Foundation or, at your option, any later version.
+
+use strict;
+use warnings;
+
+use lib '.';
+do 'bin/make.pl';
+
+##
+## Make Profile
+##
+## Output the entry point names and a shim for every entry point, in the
+## order of the function pointer table of make_init.pl, a table of the
+## shims and _glewProfileInit, which saves every resolved function pointer
+## and points it at its shim.  The shim forwards the call to the saved
+## entry point and counts it with _glewProfileEnd of glew_profile.c.
+##
+
+#-------------------------------------------------------------------------------
+
+# shim definition
+sub make_pfn_profile($$$)
+{
+	our ($api, $prefix);
+	my ($name, $fun, $i) = @_;
+	my ($decls, $args) = make_args($fun->{parms});
+	my $rtype = $fun->{rtype};
+	my $call = "((PFN" . (uc $name) . "PROC)${prefix}ProfileTargets[$i])(" . join(", ", @$args) . ");";
+	my $void = $rtype =~ /^\s*void\s*$/;
+
+	my $s = "static $rtype " . (length($api) ? "$api " : "") . "_glewProfile_$name (" . (@$decls ? join(", ", @$decls) : "void") . ")\n{\n";
+	$s .= "  const GLuint64 t = _glewProfileTime();\n";
+	$s .= $void ? "  $call\n" : "  $rtype r = $call\n";
+	$s .= "  _glewProfileEnd($i, t);\n";
+	$s .= "  return r;\n" unless $void;
+	$s .= "}\n";
+	return $s;
+}
+
+#-------------------------------------------------------------------------------
+
+my @extlist = ();
+
+our $api = shift;
+our $type = shift;
+our $prefix = "_" . lc($type) . "ew";
+
+if (@ARGV)
+{
+	@extlist = @ARGV;
+
+	my @funcs = ();
+	foreach my $ext (sort @extlist)
+	{
+		my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) =
+			parse_ext($ext);
+		push @funcs, map { [ $_, $functions->{$_} ] } sort keys %$functions;
+	}
+
+	print "static _GLEWProc ${prefix}ProfileTargets[" . (scalar @funcs || 1) . "];\n\n";
+
+	print "static const char* const ${prefix}ProfileNames[] = {\n";
+	print map { "  \"$_->[0]\",\n" } @funcs;
+	print "  NULL\n" unless @funcs;
+	print "};\n\n";
+
+	for (my $i = 0; $i < @funcs; $i++)
+	{
+		print make_pfn_profile($funcs[$i][0], $funcs[$i][1], $i), "\n";
+	}
+
+	print "static const _GLEWProc ${prefix}ProfileFunctions[] = {\n";
+	print map { "  (_GLEWProc)_glewProfile_$_->[0],\n" } @funcs;
+	print "  NULL\n" unless @funcs;
+	print "};\n\n";
+
+	print "static void _glewProfileInit_$type ()\n{\n";
+	print "  size_t i;\n";
+	print "  _glewProfileStart();\n";
+	print "  for (i = 0; i < " . scalar @funcs . "; ++i)\n";
+	print "  {\n";
+	print "    /* an entry point not resolved again keeps its shim and saved target */\n";
+	print "    if (*${prefix}Functions[i] == NULL || *${prefix}Functions[i] == ${prefix}ProfileFunctions[i]) continue;\n";
+	print "    ${prefix}ProfileTargets[i] = *${prefix}Functions[i];\n";
+	print "    *${prefix}Functions[i] = ${prefix}ProfileFunctions[i];\n";
+	print "  }\n";
+	print "}\n\n";
+}
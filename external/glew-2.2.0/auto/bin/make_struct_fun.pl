@@ -18,7 +18,7 @@ do 'bin/make.pl';
 sub make_pfn_decl($%)
 {
     our $export;
-    return $export . " PFN" . (uc $_[0]) . "PROC " . prefixname($_[0]) . ";";
+    return (length($export) ? "$export " : "  ") . "PFN" . (uc $_[0]) . "PROC " . prefixname($_[0]) . ";";
 }
 
 my @extlist = ();
@@ -28,6 +28,6 @@ if (@ARGV)
 		my ($extname, $exturl, $extstring, $reuse, $types, $tokens, $functions, $exacts) = parse_ext($ext);
 		my $extvar = $extname;
 		$extvar =~ s/GL(X*)_/GL$1EW_/;
-		print $export . " GLboolean " . prefix_varname($extvar) . ";\n";
+		print ((length($export) ? "$export " : "  ") . "GLboolean " . prefix_varname($extvar) . ";\n");
 	}
 }
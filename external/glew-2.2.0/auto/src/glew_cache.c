@@ -0,0 +1,228 @@
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * Capability cache.  If GLEW is built with GLEW_CACHE and glewCacheFile is
+ * set, glewInit restores the extension flags from a memory mapped file
+ * written by an earlier run against the same driver, rather than querying
+ * the extension strings.  The file holds a section per API, keyed by a hash
+ * of the strings identifying the driver and checked against the version and
+ * the signature of the extension table, with the flags packed 32 to a word.
+ * For OpenGL 3.0 and up the key includes the context flags, profile mask
+ * and number of extensions, for older versions the extension string.
+ * A file failing validation is ignored, and glewInit rewrites the file if
+ * it is missing, invalid or stale.  Removing the file invalidates it.
+ */
+#if defined(GLEW_CACHE)
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define GLEW_CACHE_MAGIC 0x57454c47u  /* "GLEW" */
+#define GLEW_CACHE_FORMAT 2
+#define GLEW_CACHE_GL 0
+#define GLEW_CACHE_GLX 1
+#define GLEW_CACHE_SECTIONS 2
+
+typedef struct
+{
+  GLuint key;        /* hash of the driver identification strings and state */
+  GLuint signature;  /* <API>_EXTENSION_SIGNATURE of make_index.pl */
+  GLuint version;    /* major << 16 | minor */
+  GLuint count;      /* number of flags */
+  GLuint offset;     /* of the flags, in 32-bit words */
+} _GLEWCacheSection;
+
+typedef struct
+{
+  GLuint magic;
+  GLuint format;
+  GLuint size;       /* of the file, in bytes */
+  GLuint checksum;   /* of the file following the checksum */
+  _GLEWCacheSection section[GLEW_CACHE_SECTIONS];
+} _GLEWCacheHeader;
+
+/* State of the cache for the duration of glewInit */
+static struct
+{
+  GLboolean open;
+  GLboolean stale;
+  void* file;
+  size_t size;
+  _GLEWCacheSection section[GLEW_CACHE_SECTIONS];
+  const GLboolean* flags[GLEW_CACHE_SECTIONS];
+} _glewCache;
+
+static GLuint _glewCacheKey (GLuint key, const GLubyte* s)
+{
+  return _glewHashMix(key, _glewHash(s, _glewStrLen(s)));
+}
+
+static GLuint _glewCacheKeyInt (GLuint key, GLint i)
+{
+  return _glewHashMix(key, (GLuint)i);
+}
+
+static GLuint _glewCacheWords (GLuint count)
+{
+  return count / 32 + (count % 32 != 0);
+}
+
+static GLuint _glewCacheChecksum (const _GLEWCacheHeader* h, size_t size)
+{
+  return _glewHash((const GLubyte*)h->section, (GLuint)(size - offsetof(_GLEWCacheHeader, section)));
+}
+
+static GLboolean _glewCacheValid (const _GLEWCacheHeader* h, size_t size)
+{
+  GLuint i;
+  if (size < sizeof(_GLEWCacheHeader) || size > 0x7fffffff ||
+      h->magic != GLEW_CACHE_MAGIC || h->format != GLEW_CACHE_FORMAT || h->size != size ||
+      h->checksum != _glewCacheChecksum(h, size))
+    return GL_FALSE;
+  for (i = 0; i < GLEW_CACHE_SECTIONS; ++i)
+  {
+    const _GLEWCacheSection* s = &h->section[i];
+    if (s->offset > size / 4 || _glewCacheWords(s->count) > size / 4 - s->offset)
+      return GL_FALSE;
+  }
+  return GL_TRUE;
+}
+
+/* Map glewCacheFile, if set */
+static void _glewCacheOpen (void)
+{
+  struct stat st;
+  void* p;
+  int fd;
+  GLuint i;
+
+  _glewCache.open = glewCacheFile != NULL;
+  _glewCache.stale = GL_TRUE;
+  _glewCache.file = NULL;
+  for (i = 0; i < GLEW_CACHE_SECTIONS; ++i)
+  {
+    _glewCache.section[i].count = 0;
+    _glewCache.flags[i] = NULL;
+  }
+  if (!_glewCache.open) return;
+
+  fd = open(glewCacheFile, O_RDONLY);
+  if (fd < 0) return;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      if (_glewCacheValid((const _GLEWCacheHeader*)p, (size_t)st.st_size))
+      {
+        _glewCache.file = p;
+        _glewCache.size = (size_t)st.st_size;
+        _glewCache.stale = GL_FALSE;
+      }
+      else
+        munmap(p, (size_t)st.st_size);
+    }
+  }
+  close(fd);
+}
+
+/*
+ * Return the flags of section s if the cache was written for the same key,
+ * version and extension table, NULL otherwise.  Either way the section is
+ * written back by _glewCacheClose, with the flags passed to _glewCacheStore.
+ */
+static const GLuint* _glewCacheFind (GLuint s, GLuint key, GLuint signature, GLuint version, GLuint count)
+{
+  const _GLEWCacheSection* c;
+  _glewCache.section[s].key = key;
+  _glewCache.section[s].signature = signature;
+  _glewCache.section[s].version = version;
+  _glewCache.section[s].count = count;
+  if (_glewCache.file != NULL)
+  {
+    c = &((const _GLEWCacheHeader*)_glewCache.file)->section[s];
+    if (c->key == key && c->signature == signature && c->version == version && c->count == count)
+      return (const GLuint*)_glewCache.file + c->offset;
+  }
+  _glewCache.stale = GL_TRUE;
+  return NULL;
+}
+
+static void _glewCacheStore (GLuint s, const GLboolean* flags)
+{
+  _glewCache.flags[s] = flags;
+}
+
+static void _glewCacheRestore (const GLuint* bits, GLboolean* flags, GLboolean* const* enabled, GLuint count)
+{
+  GLuint i;
+  for (i = 0; i < count; ++i)
+    if (bits[i / 32] >> (i % 32) & 1)
+    {
+      flags[i] = GL_TRUE;
+      *enabled[i] = GL_TRUE;
+    }
+}
+
+/* Write the cache to a temporary file and rename it, replacing the old one atomically */
+static void _glewCacheWrite (void)
+{
+  GLuint words = sizeof(_GLEWCacheHeader) / 4;
+  GLuint length = _glewStrLen((const GLubyte*)glewCacheFile);
+  _GLEWCacheHeader* h;
+  GLuint* data;
+  char* tmp;
+  GLuint i, j;
+  int fd;
+  GLboolean ok = GL_FALSE;
+
+  for (i = 0; i < GLEW_CACHE_SECTIONS; ++i)
+    words += _glewCacheWords(_glewCache.section[i].count);
+  data = (GLuint*)calloc(words * 4 + length + 32, 1);
+  if (data == NULL) return;
+
+  h = (_GLEWCacheHeader*)data;
+  h->magic = GLEW_CACHE_MAGIC;
+  h->format = GLEW_CACHE_FORMAT;
+  h->size = words * 4;
+  words = sizeof(_GLEWCacheHeader) / 4;
+  for (i = 0; i < GLEW_CACHE_SECTIONS; ++i)
+  {
+    h->section[i] = _glewCache.section[i];
+    h->section[i].offset = words;
+    if (_glewCache.flags[i] != NULL)
+      for (j = 0; j < h->section[i].count; ++j)
+        data[words + j / 32] |= (GLuint)(_glewCache.flags[i][j] != GL_FALSE) << (j % 32);
+    words += _glewCacheWords(h->section[i].count);
+  }
+  h->checksum = _glewCacheChecksum(h, h->size);
+
+  tmp = (char*)(data + words);
+  sprintf(tmp, "%s.%ld", glewCacheFile, (long)getpid());
+  fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd >= 0)
+  {
+    ok = write(fd, data, h->size) == (ssize_t)h->size;
+    ok = close(fd) == 0 && ok;
+    if (!ok || rename(tmp, glewCacheFile) != 0)
+      unlink(tmp);
+  }
+  free(data);
+}
+
+static void _glewCacheClose (GLenum r)
+{
+  if (_glewCache.open && _glewCache.stale && r == GLEW_OK)
+    _glewCacheWrite();
+  if (_glewCache.file != NULL)
+    munmap(_glewCache.file, _glewCache.size);
+  _glewCache.file = NULL;
+  _glewCache.open = GL_FALSE;
+}
+
+#endif /* GLEW_CACHE */
@@ -1,3 +1,16 @@
+/* The capability cache uses POSIX file and memory mapping functions */
+#if defined(GLEW_CACHE) && defined(_WIN32)
+#  undef GLEW_CACHE
+#endif
+#if (defined(GLEW_CACHE) || defined(GLEW_PROFILE)) && defined(__STRICT_ANSI__) && !defined(_POSIX_C_SOURCE)
+#  define _POSIX_C_SOURCE 200112L
+#endif
+
+/* The profiling shims replace the lazy trampolines */
+#if defined(GLEW_PROFILE) && defined(GLEW_LAZY)
+#  undef GLEW_LAZY
+#endif
+
 #ifndef GLEW_INCLUDE
 #  include <GL/glew.h>
 #else
@@ -25,6 +38,40 @@
 
 #include <stddef.h>  /* For size_t */
 
+/*
+ * The current GLEWContext and the profiling counters are per thread.
+ * Define GLEW_THREAD_LOCAL for a compiler not listed here.
+ */
+#if defined(GLEW_THREAD_LOCAL)
+#elif defined(_MSC_VER)
+#  define GLEW_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#  define GLEW_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#  define GLEW_THREAD_LOCAL _Thread_local
+#else
+#  error "no thread local storage, define GLEW_THREAD_LOCAL"
+#endif
+
+/*
+ * SSE2 is used for scanning extension strings where available.  The scan
+ * reads whole aligned 16 byte blocks, which never cross a page boundary
+ * but can read past the terminating NUL, so it is disabled under ASan.
+ */
+#if defined(__SSE2__) && defined(__GNUC__) && !defined(__SANITIZE_ADDRESS__)
+#  if defined(__has_feature)
+#    if !__has_feature(address_sanitizer)
+#      define GLEW_USE_SSE2
+#    endif
+#  else
+#    define GLEW_USE_SSE2
+#  endif
+#endif
+
+#if defined(GLEW_USE_SSE2)
+#  include <emmintrin.h>
+#endif
+
 #if defined(GLEW_EGL)
 #elif defined(GLEW_REGAL)
 
@@ -147,12 +194,16 @@ void* NSGLGetProcAddress (const GLubyte *name)
 #endif
 
 /*
- * Redefine GLEW_GET_VAR etc without const cast
+ * Redefine GLEW_GET_VAR etc without const cast, and refer to the
+ * globals even if GLEW_MX is defined
  */
 
 #undef GLEW_GET_VAR
 # define GLEW_GET_VAR(x) (x)
 
+#undef GLEW_GET_FUN
+# define GLEW_GET_FUN(x) x
+
 #ifdef WGLEW_GET_VAR
 # undef WGLEW_GET_VAR
 # define WGLEW_GET_VAR(x) (x)
@@ -189,17 +240,7 @@ static GLuint _glewStrCLen (const GLubyte* s, GLubyte c)
   return i;
 }
 
-static GLuint _glewStrCopy(char *d, const char *s, char c)
-{
-  GLuint i=0;
-  if (s == NULL) return 0;
-  while (s[i] != '\0' && s[i] != c) { d[i] = s[i]; i++; }
-  d[i] = '\0';
-  return i;
-}
-
-#if !defined(GLEW_OSMESA)
-#if !defined(__APPLE__) || defined(GLEW_APPLE_GLX)
+#if defined(_WIN32) && !defined(GLEW_EGL) && !defined(GLEW_OSMESA)
 static GLboolean _glewStrSame (const GLubyte* a, const GLubyte* b, GLuint n)
 {
   GLuint i=0;
@@ -208,8 +249,6 @@ static GLboolean _glewStrSame (const GLubyte* a, const GLubyte* b, GLuint n)
   while (i < n && a[i] != '\0' && b[i] != '\0' && a[i] == b[i]) i++;
   return i == n ? GL_TRUE : GL_FALSE;
 }
-#endif
-#endif
 
 static GLboolean _glewStrSame1 (const GLubyte** a, GLuint* na, const GLubyte* b, GLuint nb)
 {
@@ -263,6 +302,181 @@ static GLboolean _glewStrSame3 (const GLubyte** a, GLuint* na, const GLubyte* b,
   }
   return GL_FALSE;
 }
+#endif
+
+/*
+ * Return the first space or NUL at or after s.
+ */
+#if defined(GLEW_USE_SSE2)
+static const GLubyte* _glewNextSpace (const GLubyte* s)
+{
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i zero = _mm_setzero_si128();
+  const GLubyte* p = (const GLubyte*)((size_t)s & ~(size_t)15);
+  __m128i v = _mm_load_si128((const __m128i*)p);
+  unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, zero)));
+  mask &= ~0u << (s - p);
+  while (mask == 0)
+  {
+    p += 16;
+    v = _mm_load_si128((const __m128i*)p);
+    mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, zero)));
+  }
+  return p + __builtin_ctz(mask);
+}
+#else
+static const GLubyte* _glewNextSpace (const GLubyte* s)
+{
+  while (*s != ' ' && *s != '\0') ++s;
+  return s;
+}
+#endif
+
+/*
+ * Return the start of the next space separated extension name at or after
+ * s and its length in n, or NULL at the end of the extension string.
+ */
+static const GLubyte* _glewNextExtension (const GLubyte* s, GLuint* n)
+{
+  if (s == NULL) return NULL;
+  while (*s == ' ') ++s;
+  if (*s == '\0') return NULL;
+  *n = (GLuint)(_glewNextSpace(s) - s);
+  return s;
+}
+
+/*
+ * 32-bit multiplicative hash of the n characters at s, four at a time.
+ * Must match hash_string in auto/bin/make.pl
+ */
+static GLuint _glewHash (const GLubyte* s, GLuint n)
+{
+  GLuint h = 2166136261u ^ n;
+  GLuint i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    h ^= (GLuint)s[i] | (GLuint)s[i+1] << 8 | (GLuint)s[i+2] << 16 | (GLuint)s[i+3] << 24;
+    h *= 0x9e3779b1u;
+    h ^= h >> 15;
+  }
+  if (i < n)
+  {
+    GLuint w = 0;
+    GLuint k;
+    for (k = 0; i < n; ++i, k += 8)
+      w |= (GLuint)s[i] << k;
+    h ^= w;
+    h *= 0x9e3779b1u;
+    h ^= h >> 15;
+  }
+  return h;
+}
+
+/*
+ * Remix hash h with displacement d.
+ * Must match hash_mix in auto/bin/make.pl
+ */
+static GLuint _glewHashMix (GLuint h, GLuint d)
+{
+  h ^= d * 0x9e3779b9u;
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+/*
+ * Reduce hash h to the range [0, n) by multiplication rather than division.
+ * Must match hash_range in auto/bin/make.pl
+ */
+static GLuint _glewHashRange (GLuint h, GLuint n)
+{
+  return (GLuint)(((GLuint64)h * n) >> 32);
+}
+
+/*
+ * Look up the n characters at name in a minimal perfect hash generated by
+ * make_index.pl.  Returns the slot index, or -1 if name is not listed.
+ */
+static ptrdiff_t _glewHashLookup (const char** lookup, const GLshort* hash, GLuint size, const GLubyte* name, GLuint n)
+{
+  const char* s;
+  GLuint h;
+  GLuint i;
+  GLint d;
+  if (size == 0 || name == NULL) return -1;
+  h = _glewHash(name, n);
+  d = hash[_glewHashRange(h, size)];
+  i = d < 0 ? (GLuint)(-d - 1) : _glewHashRange(_glewHashMix(h, (GLuint)d), size);
+  s = lookup[i];
+  while (n > 0 && *s == (char)*name)
+  {
+    ++s;
+    ++name;
+    --n;
+  }
+  return n == 0 && *s == '\0' ? (ptrdiff_t)i : -1;
+}
+
+/*
+ * Return GL_TRUE if every white space (or control character) separated name
+ * in the list is in the minimal perfect hash and has its enable flag set,
+ * for glewIsSupported.  The flags are the globals in enabled or, if ctx is
+ * not NULL, the members of ctx at offsets.
+ */
+static GLboolean _glewHashSupported (const char** lookup, const GLshort* hash, GLboolean** enabled, const GLuint* offsets, const void* ctx, GLuint size, const GLubyte* name)
+{
+  GLuint n;
+  ptrdiff_t i;
+  if (name == NULL) return GL_TRUE;
+  for (;;)
+  {
+    while (*name != '\0' && *name <= ' ') ++name;
+    if (*name == '\0') return GL_TRUE;
+    n = 1;
+    while (name[n] > ' ') ++n;
+    i = _glewHashLookup(lookup, hash, size, name, n);
+    if (i < 0 || !*(ctx ? (const GLboolean*)((const char*)ctx + offsets[i]) : enabled[i])) return GL_FALSE;
+    name += n;
+  }
+}
+
+/*
+ * Entry point tables generated by make_init.pl: the addresses of the
+ * function pointers, and ranges of them with their NUL separated names.
+ */
+typedef void (*_GLEWProc) (void);
+
+typedef struct
+{
+  const char* names;
+  GLushort first;
+  GLushort count;
+} _GLEWRange;
+
+/*
+ * Resolve the entry points of n ranges in a single loop, returning GL_TRUE
+ * if any of them is missing.  The function pointers are the globals in
+ * functions or, if ctx is not NULL, the members of ctx at offsets.
+ */
+static GLboolean _glewResolveRanges (_GLEWProc* const* functions, const GLuint* offsets, void* ctx, const _GLEWRange* range, GLuint n)
+{
+  GLboolean r = GL_FALSE;
+  for (; n > 0; --n, ++range)
+  {
+    const char* name = range->names;
+    GLuint i;
+    for (i = range->first; i < (GLuint)range->first + range->count; ++i)
+    {
+      _GLEWProc* f = ctx ? (_GLEWProc*)((char*)ctx + offsets[i]) : functions[i];
+      r = ((*f = (_GLEWProc)glewGetProcAddress((const GLubyte*)name)) == NULL) || r;
+      name = (const char*)_glewNextSpace((const GLubyte*)name) + 1;
+    }
+  }
+  return r;
+}
 
 /*
  * Search for name in the extensions string. Use of strstr()
@@ -270,8 +484,7 @@ static GLboolean _glewStrSame3 (const GLubyte** a, GLuint* na, const GLubyte* b,
  * other extension names. Could use strtok() but the constant
  * string returned by glGetString might be in read-only memory.
  */
-#if !defined(GLEW_OSMESA)
-#if !defined(__APPLE__) || defined(GLEW_APPLE_GLX)
+#if defined(_WIN32) && !defined(GLEW_EGL) && !defined(GLEW_OSMESA)
 static GLboolean _glewSearchExtension (const char* name, const GLubyte *start, const GLubyte *end)
 {
   const GLubyte* p;
@@ -286,4 +499,3 @@ static GLboolean _glewSearchExtension (const char* name, const GLubyte *start, c
   return GL_FALSE;
 }
 #endif
-#endif
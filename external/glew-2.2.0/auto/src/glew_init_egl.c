@@ -1,21 +1,33 @@
   /* ------------------------------------------------------------------------ */
 
-GLboolean eglewGetExtension (const char* name)
+static ptrdiff_t _eglewLookupExtension (const GLubyte* name, GLuint n)
+{
+  return _glewHashLookup(_eglewExtensionLookup, _eglewExtensionHash, sizeof(_eglewExtensionHash) / sizeof(_eglewExtensionHash[0]), name, n);
+}
+
+static void _eglewSetExtension (const GLubyte* name, GLuint n)
 {
-  const GLubyte* start;
-  const GLubyte* end;
+  ptrdiff_t i = _eglewLookupExtension(name, n);
+  if (i >= 0)
+  {
+    _eglewExtensionString[i] = GL_TRUE;
+    *_eglewExtensionEnabled[i] = GL_TRUE;
+  }
+}
 
-  start = (const GLubyte*) eglQueryString(eglGetCurrentDisplay(), EGL_EXTENSIONS);
-  if (0 == start) return GL_FALSE;
-  end = start + _glewStrLen(start);
-  return _glewSearchExtension(name, start, end);
+/* Based on the extension string of the last eglewInit */
+GLboolean eglewGetExtension (const char* name)
+{
+  ptrdiff_t i = _eglewLookupExtension((const GLubyte*)name, _glewStrLen((const GLubyte*)name));
+  return i >= 0 ? _eglewExtensionString[i] : GL_FALSE;
 }
 
 GLenum eglewInit (EGLDisplay display)
 {
   EGLint major, minor;
-  const GLubyte* extStart;
-  const GLubyte* extEnd;
+  const GLubyte* ext;
+  GLuint n = 0;
+  size_t i;
   PFNEGLINITIALIZEPROC initialize = NULL;
   PFNEGLQUERYSTRINGPROC queryString = NULL;
 
@@ -29,6 +41,12 @@ GLenum eglewInit (EGLDisplay display)
   if (initialize(display, &major, &minor) != EGL_TRUE)
     return 1;
 
+  for (i = 0; i < sizeof(_eglewExtensionString) / sizeof(_eglewExtensionString[0]); ++i)
+  {
+    _eglewExtensionString[i] = GL_FALSE;
+    *_eglewExtensionEnabled[i] = GL_FALSE;
+  }
+
   EGLEW_VERSION_1_5   = ( major > 1 )                || ( major == 1 && minor >= 5 ) ? GL_TRUE : GL_FALSE;
   EGLEW_VERSION_1_4   = EGLEW_VERSION_1_5 == GL_TRUE || ( major == 1 && minor >= 4 ) ? GL_TRUE : GL_FALSE;
   EGLEW_VERSION_1_3   = EGLEW_VERSION_1_4 == GL_TRUE || ( major == 1 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
@@ -36,10 +54,9 @@ GLenum eglewInit (EGLDisplay display)
   EGLEW_VERSION_1_1   = EGLEW_VERSION_1_2 == GL_TRUE || ( major == 1 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
   EGLEW_VERSION_1_0   = EGLEW_VERSION_1_1 == GL_TRUE || ( major == 1 && minor >= 0 ) ? GL_TRUE : GL_FALSE;
 
-  /* query EGL extension string */
-  extStart = (const GLubyte*) queryString(display, EGL_EXTENSIONS);
-  if (extStart == 0)
-    extStart = (const GLubyte *)"";
-  extEnd = extStart + _glewStrLen(extStart);
+  /* query EGL extension string, single pass */
+  ext = (const GLubyte*) queryString(display, EGL_EXTENSIONS);
+  for (; (ext = _glewNextExtension(ext, &n)) != NULL; ext += n)
+    _eglewSetExtension(ext, n);
 
   /* initialize extensions */
@@ -1,91 +1,76 @@
 /* ------------------------------------------------------------------------- */
 
-static int _glewExtensionCompare(const char *s1, const char *s2)
+static ptrdiff_t _glewLookupExtension (const GLubyte* name, GLuint n)
 {
-  /* http://www.chanduthedev.com/2012/07/strcmp-implementation-in-c.html */
-  while (*s1 || *s2)
-  {
-      if (*s1 > *s2)
-          return 1;
-      if (*s1 < *s2)
-          return -1;
-      s1++;
-      s2++;
-  }
-  return 0;
+  return _glewHashLookup(_glewExtensionLookup, _glewExtensionHash, sizeof(_glewExtensionHash) / sizeof(_glewExtensionHash[0]), name, n);
 }
 
-static ptrdiff_t _glewBsearchExtension(const char* name)
+/* Based on extension string(s), for glewGetExtension and glewIsSupported purposes */
+static void _glewSetExtension (GLEWContext* ctx, const GLubyte* name, GLuint n)
 {
-  ptrdiff_t lo = 0, hi = sizeof(_glewExtensionLookup) / sizeof(char*) - 2;
-
-  while (lo <= hi)
+  ptrdiff_t i = _glewLookupExtension(name, n);
+  if (i >= 0)
   {
-    ptrdiff_t mid = (lo + hi) / 2;
-    const int cmp = _glewExtensionCompare(name, _glewExtensionLookup[mid]);
-    if (cmp < 0) hi = mid - 1;
-    else if (cmp > 0) lo = mid + 1;
-    else return mid;
+    if (ctx == NULL)
+    {
+      _glewExtensionString[i] = GL_TRUE;
+      *_glewExtensionEnabled[i] = GL_TRUE;
+    }
+    else
+      *(GLboolean*)((char*)ctx + _glewContextEnabled[i]) = GL_TRUE;
   }
-  return -1;
-}
-
-static GLboolean *_glewGetExtensionString(const char *name)
-{
-  ptrdiff_t n = _glewBsearchExtension(name);
-  if (n >= 0) return &_glewExtensionString[n];
-  return NULL;
-}
-
-static GLboolean *_glewGetExtensionEnable(const char *name)
-{
-  ptrdiff_t n = _glewBsearchExtension(name);
-  if (n >= 0) return _glewExtensionEnabled[n];
-  return NULL;
-}
-
-static const char *_glewNextSpace(const char *i)
-{
-  const char *j = i;
-  if (j)
-    while (*j!=' ' && *j) ++j;
-  return j;
-}
-
-static const char *_glewNextNonSpace(const char *i)
-{
-  const char *j = i;
-  if (j)
-    while (*j==' ') ++j;
-  return j;
 }
 
 GLboolean GLEWAPIENTRY glewGetExtension (const char* name)
 {
-  GLboolean *enable = _glewGetExtensionString(name);
-  if (enable)
-    return *enable;
-  return GL_FALSE;
+  ptrdiff_t i = _glewLookupExtension((const GLubyte*)name, _glewStrLen((const GLubyte*)name));
+  return i >= 0 ? _glewExtensionString[i] : GL_FALSE;
 }
 
 /* ------------------------------------------------------------------------- */
 
+#if defined(GLEW_LAZY)
+/* Set by glewInitLazy for the duration of glewContextInit */
+static GLboolean _glewLazy = GL_FALSE;
+#endif
+
 typedef const GLubyte* (GLAPIENTRY * PFNGLGETSTRINGPROC) (GLenum name);
 typedef void (GLAPIENTRY * PFNGLGETINTEGERVPROC) (GLenum pname, GLint *params);
 
-static GLenum GLEWAPIENTRY glewContextInit ()
+/*
+ * In glewContextInit the flags refer to the globals or, if ctx is not NULL,
+ * to the members of the GLEWContext being initialized
+ */
+#undef GLEW_GET_VAR
+#define GLEW_GET_VAR(x) (*(ctx ? &ctx->x : &x))
+
+static GLenum GLEWAPIENTRY glewContextInit (GLEWContext* ctx)
 {
   PFNGLGETSTRINGPROC getString;
+  PFNGLGETINTEGERVPROC getIntegerv;
   const GLubyte* s;
   GLuint dot;
   GLint major, minor;
+#if defined(GLEW_CACHE)
+  const GLuint* cached = NULL;
+#endif
+
+  /* a context starts out with every function pointer and flag cleared */
+  if (ctx != NULL)
+  {
+    size_t i;
+    for (i = 0; i < sizeof(GLEWContext); ++i)
+      ((GLubyte*)ctx)[i] = 0;
+  }
 
   #ifdef _WIN32
   getString = glGetString;
+  getIntegerv = glGetIntegerv;
   #else
   getString = (PFNGLGETSTRINGPROC) glewGetProcAddress((const GLubyte*)"glGetString");
   if (!getString)
     return GLEW_ERROR_NO_GL_VERSION;
+  getIntegerv = (PFNGLGETINTEGERVPROC) glewGetProcAddress((const GLubyte*)"glGetIntegerv");
   #endif
 
   /* query opengl version */
@@ -129,81 +114,78 @@ static GLenum GLEWAPIENTRY glewContextInit ()
     GLEW_VERSION_1_1   = GLEW_VERSION_1_2   == GL_TRUE || ( major == 1 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
   }
 
+  if (ctx == NULL)
   {
     size_t i;
     for (i = 0; i < sizeof(_glewExtensionString) / sizeof(_glewExtensionString[0]); ++i)
       _glewExtensionString[i] = GL_FALSE;
   }
 
-  if (GLEW_VERSION_3_0)
+#if defined(GLEW_CACHE)
+  if (ctx == NULL && _glewCache.open)
   {
-    GLint n = 0;
-    GLint i;
-    PFNGLGETINTEGERVPROC getIntegerv;
-    PFNGLGETSTRINGIPROC getStringi;
-    const char *ext;
-    GLboolean *enable;
-
-    #ifdef _WIN32
-    getIntegerv = glGetIntegerv;
-    #else
-    getIntegerv = (PFNGLGETINTEGERVPROC) glewGetProcAddress((const GLubyte*)"glGetIntegerv");
-    #endif
-
-    if (getIntegerv)
-      getIntegerv(GL_NUM_EXTENSIONS, &n);
-
-    /* glGetStringi is OpenGL 3.0 */
-    getStringi = (PFNGLGETSTRINGIPROC) glewGetProcAddress((const GLubyte*)"glGetStringi");
-    if (getStringi)
-      for (i = 0; i<n; ++i)
+    const GLuint count = sizeof(_glewExtensionString) / sizeof(_glewExtensionString[0]);
+    GLuint key = _glewCacheKey(_glewCacheKey(_glewCacheKey(0, getString(GL_VENDOR)), getString(GL_RENDERER)), s);
+    /* the strings do not tell apart the profiles and extension sets of a driver */
+    if (GLEW_VERSION_3_0)
+    {
+      GLint flags = 0, mask = 0, n = 0;
+      if (getIntegerv)
       {
-        ext = (const char *) getStringi(GL_EXTENSIONS, i);
-
-        /* Based on extension string(s), glewGetExtension purposes */
-        enable = _glewGetExtensionString(ext);
-        if (enable)
-          *enable = GL_TRUE;
-
-        /* Based on extension string(s), experimental mode, glewIsSupported purposes */
-        enable = _glewGetExtensionEnable(ext);
-        if (enable)
-          *enable = GL_TRUE;
+        getIntegerv(GL_CONTEXT_FLAGS, &flags);
+        /* GL_CONTEXT_PROFILE_MASK is OpenGL 3.2 */
+        if (GLEW_VERSION_3_2)
+          getIntegerv(GL_CONTEXT_PROFILE_MASK, &mask);
+        getIntegerv(GL_NUM_EXTENSIONS, &n);
       }
+      key = _glewCacheKeyInt(_glewCacheKeyInt(_glewCacheKeyInt(key, flags), mask), n);
+    }
+    else
+      key = _glewCacheKey(key, getString(GL_EXTENSIONS));
+    cached = _glewCacheFind(GLEW_CACHE_GL, key, _GLEW_EXTENSION_SIGNATURE, (GLuint)major << 16 | (GLuint)minor, count);
+    if (cached != NULL)
+      _glewCacheRestore(cached, _glewExtensionString, _glewExtensionEnabled, count);
+    _glewCacheStore(GLEW_CACHE_GL, _glewExtensionString);
   }
-  else
-  {
-    const char *extensions;
-    const char *end;
-    const char *i;
-    const char *j;
-    char ext[128];
-    GLboolean *enable;
-
-    extensions = (const char *) getString(GL_EXTENSIONS);
 
-    if (extensions)
+  if (cached == NULL)
+#endif
+  {
+    if (GLEW_VERSION_3_0)
     {
-      end = extensions + _glewStrLen((const GLubyte *) extensions);
-      for (i=extensions; i<end; i = j + 1)
-      {
-        i = _glewNextNonSpace(i);
-        j = _glewNextSpace(i);
-
-        /* Copy extension into NUL terminated string */
-        if (j-i >= (ptrdiff_t) sizeof(ext))
-          continue;
-        _glewStrCopy(ext, i, ' ');
-
-        /* Based on extension string(s), glewGetExtension purposes */
-        enable = _glewGetExtensionString(ext);
-        if (enable)
-          *enable = GL_TRUE;
-
-        /* Based on extension string(s), experimental mode, glewIsSupported purposes */
-        enable = _glewGetExtensionEnable(ext);
-        if (enable)
-          *enable = GL_TRUE;
-      }
+      GLint n = 0;
+      GLint i;
+      PFNGLGETSTRINGIPROC getStringi;
+      const GLubyte *ext;
+
+      if (getIntegerv)
+        getIntegerv(GL_NUM_EXTENSIONS, &n);
+
+      /* glGetStringi is OpenGL 3.0 */
+      getStringi = (PFNGLGETSTRINGIPROC) glewGetProcAddress((const GLubyte*)"glGetStringi");
+      if (getStringi)
+        for (i = 0; i<n; ++i)
+        {
+          ext = getStringi(GL_EXTENSIONS, i);
+          _glewSetExtension(ctx, ext, _glewStrLen(ext));
+        }
+    }
+    else
+    {
+      const GLubyte *ext;
+      GLuint n = 0;
+
+      /* Single pass over the extension string, no copies */
+      for (ext = getString(GL_EXTENSIONS); (ext = _glewNextExtension(ext, &n)) != NULL; ext += n)
+        _glewSetExtension(ctx, ext, n);
     }
   }
+
+#if defined(GLEW_LAZY)
+  /* In lazy mode each entry point is resolved by its trampoline on first call,
+     and the extension flags are based on the extension string(s) alone */
+  if (ctx == NULL && _glewLazy)
+    _glewLazyInit_GL();
+  else
+#endif
+  {
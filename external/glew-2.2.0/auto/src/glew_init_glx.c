@@ -1,29 +1,48 @@
 /* ------------------------------------------------------------------------ */
 
-GLboolean glxewGetExtension (const char* name)
-{    
-  const GLubyte* start;
-  const GLubyte* end;
+static ptrdiff_t _glxewLookupExtension (const GLubyte* name, GLuint n)
+{
+  return _glewHashLookup(_glxewExtensionLookup, _glxewExtensionHash, sizeof(_glxewExtensionHash) / sizeof(_glxewExtensionHash[0]), name, n);
+}
+
+static void _glxewSetExtension (const GLubyte* name, GLuint n)
+{
+  ptrdiff_t i = _glxewLookupExtension(name, n);
+  if (i >= 0)
+  {
+    _glxewExtensionString[i] = GL_TRUE;
+    *_glxewExtensionEnabled[i] = GL_TRUE;
+  }
+}
 
-  if (glXGetCurrentDisplay == NULL) return GL_FALSE;
-  start = (const GLubyte*)glXGetClientString(glXGetCurrentDisplay(), GLX_EXTENSIONS);
-  if (0 == start) return GL_FALSE;
-  end = start + _glewStrLen(start);
-  return _glewSearchExtension(name, start, end);
+/* Based on the extension string of the last glxewInit */
+GLboolean glxewGetExtension (const char* name)
+{
+  ptrdiff_t i = _glxewLookupExtension((const GLubyte*)name, _glewStrLen((const GLubyte*)name));
+  return i >= 0 ? _glxewExtensionString[i] : GL_FALSE;
 }
 
 GLenum glxewInit ()
 {
   Display* display;
   int major, minor;
-  const GLubyte* extStart;
-  const GLubyte* extEnd;
+  const GLubyte* ext;
+  GLuint n = 0;
+  size_t i;
+#if defined(GLEW_CACHE)
+  const GLuint* cached = NULL;
+#endif
   /* initialize core GLX 1.2 */
   if (_glewInit_GLX_VERSION_1_2()) return GLEW_ERROR_GLX_VERSION_11_ONLY;
   /* check for a display */
   display = glXGetCurrentDisplay();
   if (display == NULL) return GLEW_ERROR_NO_GLX_DISPLAY;
   /* initialize flags */
+  for (i = 0; i < sizeof(_glxewExtensionString) / sizeof(_glxewExtensionString[0]); ++i)
+  {
+    _glxewExtensionString[i] = GL_FALSE;
+    *_glxewExtensionEnabled[i] = GL_FALSE;
+  }
   GLXEW_VERSION_1_0 = GL_TRUE;
   GLXEW_VERSION_1_1 = GL_TRUE;
   GLXEW_VERSION_1_2 = GL_TRUE;
@@ -47,11 +66,27 @@ GLenum glxewInit ()
       break;
     }
   }
-  /* query GLX extension string */
-  extStart = 0;
-  if (glXGetCurrentDisplay != NULL)
-    extStart = (const GLubyte*)glXGetClientString(display, GLX_EXTENSIONS);
-  if (extStart == 0)
-    extStart = (const GLubyte *)"";
-  extEnd = extStart + _glewStrLen(extStart);
+#if defined(GLEW_CACHE)
+  /* restore the extension flags from the capability cache, if valid */
+  if (_glewCache.open)
+  {
+    const GLuint count = sizeof(_glxewExtensionString) / sizeof(_glxewExtensionString[0]);
+    GLuint key = _glewCacheKey(_glewCacheKey(_glewCacheKey(0, (const GLubyte*)glXGetClientString(display, GLX_VENDOR)),
+                                             (const GLubyte*)glXGetClientString(display, GLX_VERSION)),
+                               (const GLubyte*)glXGetClientString(display, GLX_EXTENSIONS));
+    cached = _glewCacheFind(GLEW_CACHE_GLX, key, _GLXEW_EXTENSION_SIGNATURE, (GLuint)major << 16 | (GLuint)minor, count);
+    if (cached != NULL)
+      _glewCacheRestore(cached, _glxewExtensionString, _glxewExtensionEnabled, count);
+    _glewCacheStore(GLEW_CACHE_GLX, _glxewExtensionString);
+  }
+  if (cached == NULL)
+#endif
+  {
+    /* query GLX extension string, single pass */
+    ext = 0;
+    if (glXGetCurrentDisplay != NULL)
+      ext = (const GLubyte*)glXGetClientString(display, GLX_EXTENSIONS);
+    for (; (ext = _glewNextExtension(ext, &n)) != NULL; ext += n)
+      _glxewSetExtension(ext, n);
+  }
   /* initialize extensions */
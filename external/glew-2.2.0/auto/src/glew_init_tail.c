@@ -31,15 +31,23 @@ const GLubyte * GLEWAPIENTRY glewGetString (GLenum name)
 /* ------------------------------------------------------------------------ */
 
 GLboolean glewExperimental = GL_FALSE;
+const char* glewCacheFile = NULL;
 
+#if defined(GLEW_CACHE)
+static GLenum GLEWAPIENTRY _glewInit (void)
+#else
 GLenum GLEWAPIENTRY glewInit (void)
+#endif
 {
   GLenum r;
 #if defined(GLEW_EGL)
   PFNEGLGETCURRENTDISPLAYPROC getCurrentDisplay = NULL;
 #endif
-  r = glewContextInit();
+  r = glewContextInit(NULL);
   if ( r != 0 ) return r;
+#if defined(GLEW_PROFILE)
+  _glewProfileInit_GL();
+#endif
 #if defined(GLEW_EGL)
   getCurrentDisplay = (PFNEGLGETCURRENTDISPLAYPROC) glewGetProcAddress("eglGetCurrentDisplay");
   return eglewInit(getCurrentDisplay());
@@ -54,6 +62,134 @@ GLenum GLEWAPIENTRY glewInit (void)
 #endif /* _WIN32 */
 }
 
+#if defined(GLEW_CACHE)
+GLenum GLEWAPIENTRY glewInit (void)
+{
+  GLenum r;
+  _glewCacheOpen();
+  r = _glewInit();
+  _glewCacheClose(r);
+  return r;
+}
+#endif
+
+GLenum GLEWAPIENTRY glewInitLazy (void)
+{
+#if defined(GLEW_LAZY)
+  GLenum r;
+  _glewLazy = GL_TRUE;
+  r = glewInit();
+  _glewLazy = GL_FALSE;
+  return r;
+#else
+  return glewInit();
+#endif
+}
+
+/* ------------------------------------------------------------------------ */
+
+#if defined(GLEW_PROFILE)
+static int _glewProfileCompare (const void* a, const void* b)
+{
+  const GLuint64 x = ((const GLEWProfileEntry*)a)->nanoseconds;
+  const GLuint64 y = ((const GLEWProfileEntry*)b)->nanoseconds;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+#endif
+
+GLuint GLEWAPIENTRY glewProfileSnapshot (GLEWProfileEntry* entries, GLuint size)
+{
+  GLuint n = 0;
+#if defined(GLEW_PROFILE)
+  GLuint64* sums = (GLuint64*)malloc(2 * GLEW_PROFILE_COUNT * sizeof(GLuint64));
+  GLEWProfileEntry* all = (GLEWProfileEntry*)malloc(GLEW_PROFILE_COUNT * sizeof(GLEWProfileEntry));
+  GLuint i;
+  if (sums != NULL && all != NULL)
+  {
+    _glewProfileSum(sums);
+    for (i = 0; i < GLEW_PROFILE_COUNT; ++i)
+    {
+      if (sums[2*i] == _glewProfileBase[2*i]) continue;
+      all[n].name = _glewProfileNames[i];
+      all[n].calls = sums[2*i] - _glewProfileBase[2*i];
+      all[n].nanoseconds = _glewProfileNanoseconds(sums[2*i+1] - _glewProfileBase[2*i+1]);
+      ++n;
+    }
+    qsort(all, n, sizeof(GLEWProfileEntry), _glewProfileCompare);
+    for (i = 0; i < n && i < size; ++i)
+      entries[i] = all[i];
+  }
+  free(sums);
+  free(all);
+#else
+  (void)entries;
+  (void)size;
+#endif
+  return n;
+}
+
+void GLEWAPIENTRY glewProfileReset (void)
+{
+#if defined(GLEW_PROFILE)
+  _glewProfileSum(_glewProfileBase);
+#endif
+}
+
+GLboolean GLEWAPIENTRY glewProfileDump (const char* filename, GLenum format)
+{
+#if defined(GLEW_PROFILE)
+  GLEWProfileEntry* e;
+  FILE* f;
+  GLuint i, n;
+  GLboolean r;
+  if (format != GLEW_PROFILE_CSV && format != GLEW_PROFILE_JSON) return GL_FALSE;
+  if ((e = (GLEWProfileEntry*)malloc(GLEW_PROFILE_COUNT * sizeof(GLEWProfileEntry))) == NULL) return GL_FALSE;
+  n = glewProfileSnapshot(e, GLEW_PROFILE_COUNT);
+  if ((f = filename ? fopen(filename, "w") : stdout) == NULL)
+  {
+    free(e);
+    return GL_FALSE;
+  }
+  fputs(format == GLEW_PROFILE_JSON ? "[\n" : "function,calls,nanoseconds\n", f);
+  for (i = 0; i < n; ++i)
+  {
+    fprintf(f, format == GLEW_PROFILE_JSON ? "  { \"function\": \"%s\", \"calls\": " : "%s,", e[i].name);
+    _glewProfilePrint(f, e[i].calls);
+    fputs(format == GLEW_PROFILE_JSON ? ", \"nanoseconds\": " : ",", f);
+    _glewProfilePrint(f, e[i].nanoseconds);
+    fputs(format == GLEW_PROFILE_JSON ? (i + 1 < n ? " },\n" : " }\n") : "\n", f);
+  }
+  if (format == GLEW_PROFILE_JSON) fputs("]\n", f);
+  r = fflush(f) == 0 && !ferror(f);
+  if (f != stdout) r = fclose(f) == 0 && r;
+  free(e);
+  return r;
+#else
+  (void)filename;
+  (void)format;
+  return GL_FALSE;
+#endif
+}
+
+/* ------------------------------------------------------------------------ */
+
+static GLEW_THREAD_LOCAL GLEWContext* _glewCurrentContext = NULL;
+
+GLenum GLEWAPIENTRY glewContextInitFor (GLEWContext* ctx)
+{
+  return glewContextInit(ctx);
+}
+
+void GLEWAPIENTRY glewSetCurrentContext (GLEWContext* ctx)
+{
+  _glewCurrentContext = ctx;
+}
+
+GLEWContext* GLEWAPIENTRY glewGetCurrentContext (void)
+{
+  return _glewCurrentContext;
+}
+
 #if defined(_WIN32) && defined(GLEW_BUILD) && defined(__GNUC__)
 /* GCC requires a DLL entry point even without any standard library included. */
 /* Types extracted from windows.h to avoid polluting the rest of the file. */
@@ -0,0 +1,147 @@
+/* ------------------------------------------------------------------------ */
+
+/*
+ * Profiling.  If GLEW is built with GLEW_PROFILE, glewInit points every GL
+ * function pointer it resolves at a shim generated by make_profile.pl,
+ * which forwards the call and adds one call and the time it took to the
+ * counters of the calling thread.  A thread allocates its counters on its
+ * first call and pushes them on a list, which glewProfileSnapshot sums up,
+ * so neither calls nor snapshots take a lock.  Only the owning thread
+ * writes its counters, and glewProfileReset records the sums as a baseline
+ * rather than clearing them.  The counters of a thread outlive it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+/* Types extracted from windows.h to avoid polluting the rest of the file,
+   LARGE_INTEGER is a 64-bit union. */
+union _LARGE_INTEGER;
+__declspec(dllimport) int __stdcall QueryPerformanceCounter (union _LARGE_INTEGER* count);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency (union _LARGE_INTEGER* frequency);
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  endif
+#else
+#  include <time.h>
+#endif
+
+#define GLEW_PROFILE_COUNT (sizeof(_glewFunctions) / sizeof(_glewFunctions[0]))
+
+typedef struct _GLEWProfileThreadStruct
+{
+  struct _GLEWProfileThreadStruct* next;
+  GLuint64 counters[2 * GLEW_PROFILE_COUNT];  /* calls and ticks per entry point */
+} _GLEWProfileThread;
+
+static _GLEWProfileThread* _glewProfileThreads = NULL;
+static GLEW_THREAD_LOCAL _GLEWProfileThread* _glewProfileCurrent = NULL;
+static GLuint64 _glewProfileBase[2 * GLEW_PROFILE_COUNT];  /* sums at the last reset */
+
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+#  define _glewProfileLoad(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#  define _glewProfileStore(p, v) __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#else
+#  define _glewProfileLoad(p) (*(volatile GLuint64*)(p))
+#  define _glewProfileStore(p, v) (*(volatile GLuint64*)(p) = (v))
+#endif
+
+static GLuint64 _glewProfileClock (void)
+{
+#if defined(_WIN32)
+  static GLint64 frequency;
+  GLint64 counter;
+  if (frequency == 0)
+    QueryPerformanceFrequency((union _LARGE_INTEGER*)&frequency);
+  QueryPerformanceCounter((union _LARGE_INTEGER*)&counter);
+  return (GLuint64)(counter / frequency) * 1000000000u +
+         (GLuint64)(counter % frequency) * 1000000000u / (GLuint64)frequency;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (GLuint64)ts.tv_sec * 1000000000u + (GLuint64)ts.tv_nsec;
+#endif
+}
+
+/*
+ * The shims read the time stamp counter where there is one, which costs a
+ * fraction of reading the clock, and the snapshots convert the ticks to
+ * nanoseconds at the rate the counter advanced since the first glewInit.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#  define _glewProfileTime() ((GLuint64)__builtin_ia32_rdtsc())
+#else
+#  define _glewProfileTime() _glewProfileClock()
+#endif
+
+static GLuint64 _glewProfileEpoch[2];  /* ticks and nanoseconds at the first glewInit */
+
+static void _glewProfileStart (void)
+{
+  if (_glewProfileEpoch[1] != 0) return;
+  _glewProfileEpoch[0] = _glewProfileTime();
+  _glewProfileEpoch[1] = _glewProfileClock();
+}
+
+static GLuint64 _glewProfileNanoseconds (GLuint64 ticks)
+{
+  const GLuint64 t = _glewProfileTime() - _glewProfileEpoch[0];
+  const GLuint64 ns = _glewProfileClock() - _glewProfileEpoch[1];
+  return t == 0 ? ticks : (GLuint64)((double)ticks * (double)ns / (double)t);
+}
+
+static _GLEWProfileThread* _glewProfileAttach (void)
+{
+  _GLEWProfileThread* t = (_GLEWProfileThread*)calloc(1, sizeof(_GLEWProfileThread));
+  if (t == NULL) return NULL;
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+  t->next = __atomic_load_n(&_glewProfileThreads, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n(&_glewProfileThreads, &t->next, t, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#elif defined(_MSC_VER)
+  do t->next = _glewProfileThreads;
+  while (_InterlockedCompareExchangePointer((void* volatile*)&_glewProfileThreads, t, t->next) != t->next);
+#else
+  t->next = _glewProfileThreads;
+  _glewProfileThreads = t;
+#endif
+  _glewProfileCurrent = t;
+  return t;
+}
+
+/* Count a call of entry point i which started at tick start */
+static void _glewProfileEnd (size_t i, GLuint64 start)
+{
+  const GLuint64 t = _glewProfileTime() - start;
+  _GLEWProfileThread* p = _glewProfileCurrent;
+  if (p == NULL && (p = _glewProfileAttach()) == NULL) return;
+  _glewProfileStore(&p->counters[2*i], p->counters[2*i] + 1);
+  _glewProfileStore(&p->counters[2*i+1], p->counters[2*i+1] + t);
+}
+
+/* Sum the counters of every thread */
+static void _glewProfileSum (GLuint64* sums)
+{
+  const _GLEWProfileThread* p;
+  size_t i;
+  for (i = 0; i < 2 * GLEW_PROFILE_COUNT; ++i)
+    sums[i] = 0;
+#if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+  p = __atomic_load_n(&_glewProfileThreads, __ATOMIC_ACQUIRE);
+#else
+  p = *(_GLEWProfileThread* volatile*)&_glewProfileThreads;
+#endif
+  for (; p != NULL; p = p->next)
+    for (i = 0; i < 2 * GLEW_PROFILE_COUNT; ++i)
+      sums[i] += _glewProfileLoad(&p->counters[i]);
+}
+
+/* C89 printf has no 64-bit conversion */
+static void _glewProfilePrint (FILE* f, GLuint64 n)
+{
+  char s[24];
+  char* p = s + sizeof(s) - 1;
+  *p = '\0';
+  do *--p = (char)('0' + n % 10); while ((n /= 10) != 0);
+  fputs(p, f);
+}
+
@@ -8,10 +8,5 @@
 
 GLboolean glxewIsSupported (const char* name)
 {
-  const GLubyte* pos = (const GLubyte*)name;
-  GLuint len = _glewStrLen(pos);
-  GLboolean ret = GL_TRUE;
-  while (ret && len > 0)
-  {
-    if(_glewStrSame1(&pos, &len, (const GLubyte*)"GLX_", 4))
-    {
+  return _glewHashSupported(_glxewExtensionLookup, _glxewExtensionHash, _glxewExtensionEnabled, NULL, NULL, sizeof(_glxewExtensionHash) / sizeof(_glxewExtensionHash[0]), (const GLubyte*)name);
+}
@@ -1,9 +1,10 @@
 GLboolean GLEWAPIENTRY glewIsSupported (const char* name)
 {
-  const GLubyte* pos = (const GLubyte*)name;
-  GLuint len = _glewStrLen(pos);
-  GLboolean ret = GL_TRUE;
-  while (ret && len > 0)
-  {
-    if (_glewStrSame1(&pos, &len, (const GLubyte*)"GL_", 3))
-    {
+  return _glewHashSupported(_glewExtensionLookup, _glewExtensionHash, _glewExtensionEnabled, NULL, NULL, sizeof(_glewExtensionHash) / sizeof(_glewExtensionHash[0]), (const GLubyte*)name);
+}
+
+GLboolean GLEWAPIENTRY glewContextIsSupported (const GLEWContext* ctx, const char* name)
+{
+  if (ctx == NULL) return glewIsSupported(name);
+  return _glewHashSupported(_glewExtensionLookup, _glewExtensionHash, _glewExtensionEnabled, _glewContextEnabled, ctx, sizeof(_glewExtensionHash) / sizeof(_glewExtensionHash[0]), (const GLubyte*)name);
+}
@@ -1,7 +1,2 @@
-    }
-    ret = (len == 0);
-  }
-  return ret;
-}
 
 #endif /* _WIN32 */
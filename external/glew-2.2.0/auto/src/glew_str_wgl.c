@@ -1,8 +1,3 @@
-    }
-    ret = (len == 0);
-  }
-  return ret;
-}
 
 #if defined(_WIN32) && !defined(GLEW_EGL) && !defined(GLEW_OSMESA)
 
@@ -27,9 +27,38 @@ VERSION_MICRO GLEW_VERSION_MICRO_STRING
 
 /* API */
 GLEWAPI GLenum GLEWAPIENTRY glewInit (void);
+GLEWAPI GLenum GLEWAPIENTRY glewInitLazy (void);
 GLEWAPI GLboolean GLEWAPIENTRY glewIsSupported (const char *name);
 #define glewIsExtensionSupported(x) glewIsSupported(x)
 
+/* Multiple contexts: a GLEWContext per GL context, current per thread */
+typedef struct GLEWContextStruct GLEWContext;
+GLEWAPI GLenum GLEWAPIENTRY glewContextInitFor (GLEWContext *ctx);
+GLEWAPI GLboolean GLEWAPIENTRY glewContextIsSupported (const GLEWContext *ctx, const char *name);
+GLEWAPI void GLEWAPIENTRY glewSetCurrentContext (GLEWContext *ctx);
+GLEWAPI GLEWContext * GLEWAPIENTRY glewGetCurrentContext (void);
+
+/* Profiling: calls and time per entry point, see GLEW_PROFILE */
+#define GLEW_PROFILE_CSV 1
+#define GLEW_PROFILE_JSON 2
+typedef struct GLEWProfileEntryStruct
+{
+  const char *name;
+  GLuint64 calls;
+  GLuint64 nanoseconds;
+} GLEWProfileEntry;
+GLEWAPI GLuint GLEWAPIENTRY glewProfileSnapshot (GLEWProfileEntry *entries, GLuint size);
+GLEWAPI void GLEWAPIENTRY glewProfileReset (void);
+GLEWAPI GLboolean GLEWAPIENTRY glewProfileDump (const char *filename, GLenum format);
+
+#ifdef GLEW_MX
+#ifndef glewGetContext
+#define glewGetContext() glewGetCurrentContext()
+#endif
+#define GLEW_GET_VAR(x) (*(const GLboolean*)&(glewGetContext()->x))
+#define GLEW_GET_FUN(x) (glewGetContext()->x)
+#endif
+
 #ifndef GLEW_GET_VAR
 #define GLEW_GET_VAR(x) (*(const GLboolean*)&x)
 #endif
@@ -39,6 +68,7 @@ GLEWAPI GLboolean GLEWAPIENTRY glewIsSupported (const char *name);
 #endif
 
 GLEWAPI GLboolean glewExperimental;
+GLEWAPI const char* glewCacheFile; /* capability cache, see GLEW_CACHE */
 GLEWAPI GLboolean GLEWAPIENTRY glewGetExtension (const char *name);
 GLEWAPI const GLubyte * GLEWAPIENTRY glewGetErrorString (GLenum error);
 GLEWAPI const GLubyte * GLEWAPIENTRY glewGetString (GLenum name);
@@ -21,8 +21,20 @@
 #include <GL/Regal.h>
 #endif
 
+#include "glewreport.h"
+
 static FILE* f;
 
+/*
+ * With -json or -diff the report is a JSON object holding a key per line,
+ * so that reports can be compared line by line: "GL_ARB_imaging" holds
+ * [GLEW_ARB_imaging, glewIsSupported, glewGetExtension] and
+ * "GL_ARB_imaging.glBlendEquation" whether the entry point is available.
+ */
+static GLboolean json = GL_FALSE;
+static const char* jsonExt = "";
+static const char* jsonBaseline = NULL;  /* -diff */
+
 /* Command-line parameters for GL context creation */
 
 struct createParams
@@ -56,6 +68,13 @@ void glewDestroyContext ();
 static GLboolean glewPrintExt (const char* name, GLboolean def1, GLboolean def2, GLboolean def3)
 {
   unsigned int i;
+  if (json)
+  {
+    fprintf(f, ",\n  \"%s\": [%s, %s, %s]", name,
+      def1 ? "true" : "false", def2 ? "true" : "false", def3 ? "true" : "false");
+    jsonExt = name;
+    return def1 || def2 || def3 || glewExperimental;
+  }
   fprintf(f, "\n%s:", name);
   for (i=0; i<62-strlen(name); i++) fprintf(f, " ");
   fprintf(f, "%s ", def1 ? "OK" : "MISSING");
@@ -67,19 +86,21 @@ static GLboolean glewPrintExt (const char* name, GLboolean def1, GLboolean def2,
     fprintf(f, "\n");
   for (i=0; i<strlen(name)+1; i++) fprintf(f, "-");
   fprintf(f, "\n");
-  fflush(f);
   return def1 || def2 || def3 || glewExperimental; /* Enable per-function info too? */
 }
 
 static void glewInfoFunc (GLboolean fi, const char* name, GLint undefined)
 {
   unsigned int i;
-  if (fi)
+  if (fi && json)
+  {
+    fprintf(f, ",\n  \"%s.%s\": %s", jsonExt, name, undefined ? "false" : "true");
+  }
+  else if (fi)
   {
     fprintf(f, "  %s:", name);
     for (i=0; i<60-strlen(name); i++) fprintf(f, " ");
     fprintf(f, "%s\n", undefined ? "MISSING" : "OK");
-    fflush(f);
   }
 }
 
@@ -7,6 +7,8 @@
 int main (int argc, char** argv)
 {
   GLuint err;
+  int ret = 0;
+  const GLubyte *vendor, *renderer, *version;
   struct createParams params =
   {
 #if defined(GLEW_OSMESA)
@@ -43,7 +45,9 @@ int main (int argc, char** argv)
       "[-version <OpenGL version>] "
       "[-profile core|compatibility] "
       "[-flag debug|forward] "
-      "[-experimental]"
+      "[-experimental] "
+      "[-json] "
+      "[-diff <baseline.json>]"
       "\n");
     return 1;
   }
@@ -73,38 +77,76 @@ int main (int argc, char** argv)
   }
 #endif
 
+#if defined(GLEW_EGL)
+  vendor = getString(GL_VENDOR);
+  renderer = getString(GL_RENDERER);
+  version = getString(GL_VERSION);
+#else
+  vendor = glGetString(GL_VENDOR);
+  renderer = glGetString(GL_RENDERER);
+  version = glGetString(GL_VERSION);
+#endif
+
+  /* -diff writes the report to a temporary file to compare with the baseline */
+  if (jsonBaseline != NULL)
+  {
+#if defined(_MSC_VER) && (_MSC_VER >= 1400)
+    if (tmpfile_s(&f) != 0)
+      f = NULL;
+#else
+    f = tmpfile();
+#endif
+    if (f == NULL)
+    {
+      fprintf(stderr, "Error: could not create a temporary file\n");
+      glewDestroyContext();
+      return 1;
+    }
+  }
+  else
+  {
 #if defined(_WIN32)
 #if defined(_MSC_VER) && (_MSC_VER >= 1400)
-  if (fopen_s(&f, "glewinfo.txt", "w") != 0)
-    f = stdout;
+    if (fopen_s(&f, "glewinfo.txt", "w") != 0)
+      f = stdout;
 #else
-  f = fopen("glewinfo.txt", "w");
+    f = fopen("glewinfo.txt", "w");
 #endif
-  if (f == NULL) f = stdout;
+    if (f == NULL) f = stdout;
 #else
-  f = stdout;
+    f = stdout;
 #endif
-  fprintf(f, "---------------------------\n");
-  fprintf(f, "    GLEW Extension Info\n");
-  fprintf(f, "---------------------------\n\n");
-  fprintf(f, "GLEW version %s\n", glewGetString(GLEW_VERSION));
+  }
+  setvbuf(f, NULL, _IOFBF, 1 << 16);
+
+  if (json)
+  {
+    fprintf(f, "{\n  \"glew.version\": ");
+    glewReportString(f, (const char*)glewGetString(GLEW_VERSION));
+    fprintf(f, ",\n  \"gl.vendor\": ");
+    glewReportString(f, (const char*)vendor);
+    fprintf(f, ",\n  \"gl.renderer\": ");
+    glewReportString(f, (const char*)renderer);
+    fprintf(f, ",\n  \"gl.version\": ");
+    glewReportString(f, (const char*)version);
+  }
+  else
+  {
+    fprintf(f, "---------------------------\n");
+    fprintf(f, "    GLEW Extension Info\n");
+    fprintf(f, "---------------------------\n\n");
+    fprintf(f, "GLEW version %s\n", glewGetString(GLEW_VERSION));
 #if defined(GLEW_OSMESA)
 #elif defined(GLEW_EGL)
 #elif defined(_WIN32)
-  fprintf(f, "Reporting capabilities of pixelformat %d\n", params.pixelformat);
+    fprintf(f, "Reporting capabilities of pixelformat %d\n", params.pixelformat);
 #elif !defined(__APPLE__) || defined(GLEW_APPLE_GLX)
-  fprintf(f, "Reporting capabilities of display %s, visual 0x%x\n",
-    params.display == NULL ? getenv("DISPLAY") : params.display, params.visual);
-#endif
-#if defined(GLEW_EGL)
-  fprintf(f, "Running on a %s from %s\n",
-    getString(GL_RENDERER), getString(GL_VENDOR));
-  fprintf(f, "OpenGL version %s is supported\n", getString(GL_VERSION));
-#else
-  fprintf(f, "Running on a %s from %s\n",
-    glGetString(GL_RENDERER), glGetString(GL_VENDOR));
-  fprintf(f, "OpenGL version %s is supported\n", glGetString(GL_VERSION));
+    fprintf(f, "Reporting capabilities of display %s, visual 0x%x\n",
+      params.display == NULL ? getenv("DISPLAY") : params.display, params.visual);
 #endif
+    fprintf(f, "Running on a %s from %s\n", renderer, vendor);
+    fprintf(f, "OpenGL version %s is supported\n", version);
+  }
   glewInfo();
 #if defined(GLEW_OSMESA)
 #elif defined(GLEW_EGL)
@@ -114,9 +156,13 @@ int main (int argc, char** argv)
 #else
   glxewInfo();
 #endif
+  if (json)
+    fprintf(f, "\n}\n");
+  if (jsonBaseline != NULL)
+    ret = glewDiffReport(f, jsonBaseline, "glewinfo");
   if (f != stdout) fclose(f);
   glewDestroyContext();
-  return 0;
+  return ret;
 }
 
 /* ------------------------------------------------------------------------ */
@@ -176,6 +222,17 @@ GLboolean glewParseArgs (int argc, char** argv, struct createParams *params)
       params->experimental = 1;
       ++p;
     }
+    else if (!strcmp(argv[p], "-json"))
+    {
+      json = GL_TRUE;
+      ++p;
+    }
+    else if (!strcmp(argv[p], "-diff"))
+    {
+      if (++p >= argc) return GL_TRUE;
+      json = GL_TRUE;
+      jsonBaseline = argv[p++];
+    }
     else
       return GL_TRUE;
   }
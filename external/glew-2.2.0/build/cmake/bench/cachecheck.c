@@ -0,0 +1,181 @@
+/*
+** cachecheck: glewInit with glewCacheFile set, against the stub driver of
+** stubgl.c, checking that the extension flags match the driver whether the
+** capability cache is hit, stale (the same strings with other extensions)
+** or corrupt, and that a stale or corrupt file is rewritten.
+**
+** cachecheck [file]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <GL/glew.h>
+#include <GL/glxew.h>
+
+#include "stubgl.h"
+
+#define HIT 0   /* the file is used and left alone */
+#define MISS 1  /* the file is ignored and rewritten */
+#define SAME 2  /* HIT if the driver reports what it did last time, else MISS */
+
+static const char* file = "cachecheck.cache";
+static int failures = 0;
+static char* last = NULL;
+
+/* Whether name is in the space separated list */
+static int listed (const char* list, const char* name)
+{
+  size_t n = strlen(name);
+  const char* p = list;
+  while (p != NULL && (p = strstr(p, name)) != NULL)
+  {
+    if ((p == list || p[-1] == ' ') && (p[n] == ' ' || p[n] == '\0'))
+      return 1;
+    p += n;
+  }
+  return 0;
+}
+
+static int advertised (const char* name)
+{
+  GLuint i;
+  for (i = 0; stubglExtension(i); ++i)
+    if (!strcmp(stubglExtension(i), name)) return 1;
+  return 0;
+}
+
+/* Version and extensions the driver reports, as a string */
+static char* driver (const StubGLConfig* config)
+{
+  const char* glx = glXGetClientString(NULL, GLX_EXTENSIONS);
+  size_t size = strlen(glx) + 3;
+  GLuint i;
+  char* d;
+  for (i = 0; stubglExtension(i); ++i)
+    size += strlen(stubglExtension(i)) + 1;
+  d = (char*)malloc(size);
+  strcpy(d, config->core ? "4 " : "2 ");
+  for (i = 0; stubglExtension(i); ++i)
+  {
+    strcat(d, stubglExtension(i));
+    strcat(d, " ");
+  }
+  strcat(d, glx);
+  return d;
+}
+
+/* Inode of the file, 0 if missing */
+static ino_t inode (void)
+{
+  struct stat st;
+  return stat(file, &st) == 0 ? st.st_ino : 0;
+}
+
+static void check (const char* what, const StubGLConfig* config, int expect)
+{
+  const char* glx;
+  const char* name;
+  char* reported;
+  ino_t before;
+  GLuint i, wrong = 0;
+  int result;
+
+  stubglConfigure(config);
+  reported = driver(config);
+  if (expect == SAME)
+    expect = last != NULL && !strcmp(reported, last) ? HIT : MISS;
+  free(last);
+  last = reported;
+  before = inode();
+  if (glewInit() != GLEW_OK)
+  {
+    printf("cachecheck: %s: glewInit failed\n", what);
+    failures++;
+    return;
+  }
+  result = before != 0 && inode() == before ? HIT : MISS;
+  for (i = 0; (name = stubglKnownExtension(i)) != NULL; ++i)
+    wrong += glewGetExtension(name) != advertised(name);
+  glx = glXGetClientString(NULL, GLX_EXTENSIONS);
+  for (i = 0; (name = stubglKnownGLXExtension(i)) != NULL; ++i)
+    wrong += glxewGetExtension(name) != listed(glx, name);
+  printf("cachecheck: %s: %s, %u wrong flags\n", what, result == HIT ? "hit" : "miss", wrong);
+  if (wrong || result != expect || inode() == 0)
+    failures++;
+}
+
+/* Replace the file with size bytes of it, with the byte at flip inverted */
+static void damage (long size, long flip)
+{
+  FILE* f = fopen(file, "rb");
+  char* data = (char*)calloc(size > 0 ? size : 1, 1);
+  long n = 0;
+  if (f != NULL)
+  {
+    n = (long)fread(data, 1, size, f);
+    fclose(f);
+  }
+  if (flip >= 0 && flip < n) data[flip] ^= 0x10;
+  f = fopen(file, "wb");
+  if (f != NULL)
+  {
+    fwrite(data, 1, n < size ? n : size, f);
+    fclose(f);
+  }
+  free(data);
+}
+
+static long length (void)
+{
+  struct stat st;
+  return stat(file, &st) == 0 ? (long)st.st_size : 0;
+}
+
+int main (int argc, char** argv)
+{
+  const StubGLConfig core600 = { 600, STUBGL_KNOWN, 0, GL_TRUE };
+  const StubGLConfig core300 = { 300, STUBGL_KNOWN, 0, GL_TRUE };
+  const StubGLConfig legacy600 = { 600, STUBGL_KNOWN, 0, GL_FALSE };
+  const StubGLConfig legacy300 = { 300, STUBGL_KNOWN, 0, GL_FALSE };
+  const StubGLConfig mixed = { 300, STUBGL_MIXED, 0, GL_FALSE };
+  FILE* f;
+
+  if (argc > 1) file = argv[1];
+  glewCacheFile = file;
+  unlink(file);
+
+  /* the same driver strings, fewer extensions, unless GLEW_CUSTOM leaves
+     fewer than 300 known names */
+  check("OpenGL 4.6, 600 extensions", &core600, MISS);
+  check("OpenGL 4.6, 600 extensions again", &core600, SAME);
+  check("OpenGL 4.6, 300 extensions", &core300, SAME);
+  check("OpenGL 4.6, 300 extensions again", &core300, SAME);
+  check("OpenGL 2.1, 600 extensions", &legacy600, SAME);
+  check("OpenGL 2.1, 300 extensions", &legacy300, SAME);
+  check("OpenGL 2.1, 300 extensions again", &legacy300, SAME);
+  check("OpenGL 2.1, 300 known and unknown extensions", &mixed, SAME);
+
+  /* a flipped bit in the flags, a truncated file, not a cache, empty */
+  damage(length(), length() - 8);
+  check("flipped bit", &mixed, MISS);
+  check("flipped bit, rewritten", &mixed, HIT);
+  damage(length() - 4, -1);
+  check("truncated", &mixed, MISS);
+  check("truncated, rewritten", &mixed, HIT);
+  if ((f = fopen(file, "w")) != NULL)
+  {
+    fputs("not a GLEW cache\n", f);
+    fclose(f);
+  }
+  check("not a cache", &mixed, MISS);
+  damage(0, -1);
+  check("empty", &mixed, MISS);
+  check("empty, rewritten", &mixed, HIT);
+
+  unlink(file);
+  free(last);
+  return failures != 0;
+}
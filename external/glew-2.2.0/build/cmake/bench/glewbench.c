@@ -0,0 +1,180 @@
+/*
+** glewbench: latency of glewInit, glewInitLazy (when built with GLEW_LAZY,
+** else it is glewInit) and glxewInit, throughput of glewGetExtension and
+** glewIsSupported, and the cost of glewIsSupported and glxewIsSupported for
+** the first, middle and last name GLEW knows, against the stub driver of
+** stubgl.c for the legacy GL_EXTENSIONS string and the core glGetStringi
+** paths.  Runs without a GPU or display.
+**
+** -c <file> also times glewInit with the capability cache of GLEW_CACHE, with
+** which the stub is built: cold, with the file removed before each call, and
+** warm, read back from the file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <GL/glew.h>
+#include <GL/glxew.h>
+
+#include "stubgl.h"
+
+static double now (void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+static int compare (const void* a, const void* b)
+{
+  const double x = *(const double*)a, y = *(const double*)b;
+  return x < y ? -1 : x > y;
+}
+
+/* Removed before each timed call if set, for a cold cache */
+static const char* cold = NULL;
+
+/* Latency distribution of n calls of init, and driver calls per init */
+static void latency (const char* name, GLenum (GLEWAPIENTRY *init)(void), int n)
+{
+  double* t = (double*)malloc(n * sizeof(double));
+  StubGLCounters c = { 0, 0 };
+  int i;
+  if (init() != GLEW_OK)
+  {
+    printf("  %-18s failed\n", name);
+    free(t);
+    return;
+  }
+  for (i = 0; i < n; ++i)
+  {
+    StubGLCounters c0;
+    double t0;
+    if (cold != NULL) unlink(cold);
+    c0 = stubglCounters;
+    t0 = now();
+    init();
+    t[i] = (now() - t0) / 1e3;
+    c.resolves = stubglCounters.resolves - c0.resolves;
+    c.queries = stubglCounters.queries - c0.queries;
+  }
+  qsort(t, n, sizeof(double), compare);
+  printf("  %-18s %8.1f %8.1f %8.1f %8.1f %8.1f %9lu %8lu\n", name,
+         t[0], t[n/2], t[n*9/10], t[n*99/100], t[n-1], c.resolves, c.queries);
+  free(t);
+}
+
+/* Queries per second of the advertised extension names */
+static void throughput (const char* name, GLboolean (GLEWAPIENTRY *query)(const char*), int n)
+{
+  const GLuint count = stubglExtensionCount();
+  GLuint hits = 0, i;
+  double t0;
+  int j;
+  if (count == 0) return;
+  t0 = now();
+  for (j = 0; j < n; ++j)
+    for (i = 0; i < count; ++i)
+      hits += query(stubglExtension(i));
+  printf("  %-18s %8.2f M/s, %u of %u supported\n", name,
+         (double)n * count / (now() - t0) * 1e3, hits / n, count);
+}
+
+/* Nanoseconds per query of the first, middle and last name GLEW knows,
+   the order in which glewIsSupported used to compare them */
+static void positions (const char* name, GLboolean (GLEWAPIENTRY *query)(const char*),
+                       const char* (*known)(GLuint), int n)
+{
+  static const char* const label[] = { "first", "middle", "last" };
+  GLuint count = 0, hits;
+  int k, j;
+  while (known(count)) ++count;
+  if (count == 0) return;
+  for (k = 0; k < 3; ++k)
+  {
+    const char* ext = known(k == 0 ? 0 : k == 1 ? count / 2 : count - 1);
+    const double t0 = now();
+    for (hits = 0, j = 0; j < n; ++j)
+      hits += query(ext);
+    printf("  %-18s %-6s %-36s %6.1f ns, %s\n", name, label[k], ext, (now() - t0) / n,
+           hits ? "supported" : "not supported");
+  }
+}
+
+static int usage (void)
+{
+  fprintf(stderr, "Usage: glewbench [-n iterations] [-q query rounds] [-e extensions]\n"
+                  "                 [-s known|unknown|mixed] [-l resolver latency ns]\n"
+                  "                 [-p legacy|core|both] [-c cache file]\n");
+  return 1;
+}
+
+int main (int argc, char** argv)
+{
+  static const char* shapes[] = { "known", "unknown", "mixed" };
+  StubGLConfig config = { 600, STUBGL_KNOWN, 0, GL_FALSE };
+  const char* cache = NULL;
+  int iterations = 201, rounds = 1000, paths = 3, p, i;
+
+  for (i = 1; i < argc; ++i)
+  {
+    if (i + 1 == argc) return usage();
+    if (!strcmp(argv[i], "-n")) iterations = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-q")) rounds = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-e")) config.extensions = (GLuint)atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-c")) cache = argv[++i];
+    else if (!strcmp(argv[i], "-l")) config.latency = strtoul(argv[++i], NULL, 10);
+    else if (!strcmp(argv[i], "-s"))
+    {
+      ++i;
+      for (config.shape = 0; config.shape < 3 && strcmp(argv[i], shapes[config.shape]); ++config.shape);
+      if (config.shape == 3) return usage();
+    }
+    else if (!strcmp(argv[i], "-p"))
+    {
+      ++i;
+      if (!strcmp(argv[i], "legacy")) paths = 1;
+      else if (!strcmp(argv[i], "core")) paths = 2;
+      else if (!strcmp(argv[i], "both")) paths = 3;
+      else return usage();
+    }
+    else return usage();
+  }
+  if (iterations < 1 || rounds < 1) return usage();
+
+  for (p = 1; p <= 2; ++p)
+  {
+    if (!(paths & p)) continue;
+    config.core = p == 2;
+    stubglConfigure(&config);
+    printf("%s: %u %s extensions, resolver latency %lu ns\n",
+           config.core ? "OpenGL 4.6, glGetStringi" : "OpenGL 2.1, GL_EXTENSIONS string",
+           stubglExtensionCount(), shapes[config.shape], config.latency);
+    printf("  %-18s %8s %8s %8s %8s %8s %9s %8s\n", "microseconds",
+           "min", "median", "p90", "p99", "max", "resolves", "queries");
+    latency("glewInit", glewInit, iterations);
+    if (cache != NULL)
+    {
+      glewCacheFile = cold = cache;
+      latency("glewInit, cold", glewInit, iterations);
+      cold = NULL;
+      latency("glewInit, warm", glewInit, iterations);
+      unlink(cache);
+      glewCacheFile = NULL;
+    }
+#if defined(GLEW_LAZY)
+    latency("glewInitLazy", glewInitLazy, iterations);
+#endif
+    latency("glxewInit", glxewInit, iterations);
+    glewInit();
+    throughput("glewGetExtension", glewGetExtension, rounds);
+    throughput("glewIsSupported", glewIsSupported, rounds);
+    positions("glewIsSupported", glewIsSupported, stubglKnownExtension, rounds * 1000);
+    positions("glxewIsSupported", glxewIsSupported, stubglKnownGLXExtension, rounds * 1000);
+    printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,109 @@
+/*
+** mxcheck: two threads each initialize a GLEWContext with glewContextInitFor
+** and make it current, against the stub driver of stubgl.c configured with a
+** different version and different extensions per thread, and check that
+** every round sees the flags and entry points of its own driver.
+*/
+
+#define GLEW_MX
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <GL/glew.h>
+
+#include "stubgl.h"
+
+#define ROUNDS 200
+
+typedef struct
+{
+  StubGLConfig config;
+  GLboolean* expected;  /* per name GLEW knows, of a context initialized alone */
+  int failures;
+} Check;
+
+static GLuint known = 0;
+static pthread_barrier_t barrier;
+
+static void supported (const GLEWContext* ctx, GLboolean* s)
+{
+  GLuint i;
+  for (i = 0; i < known; ++i)
+    s[i] = glewContextIsSupported(ctx, stubglKnownExtension(i));
+}
+
+static void* run (void* arg)
+{
+  Check* c = (Check*)arg;
+  GLEWContext* ctx = (GLEWContext*)calloc(1, sizeof(GLEWContext));
+  GLboolean* s = (GLboolean*)malloc(known);
+  int r;
+  stubglConfigure(&c->config);
+  pthread_barrier_wait(&barrier);
+  for (r = 0; r < ROUNDS; ++r)
+  {
+    if (glewContextInitFor(ctx) != GLEW_OK)
+    {
+      c->failures++;
+      continue;
+    }
+    glewSetCurrentContext(ctx);
+    supported(ctx, s);
+    /* GLEW_VERSION_4_6 and glSpecializeShader, core in 4.6 only, go through
+       the current context */
+    if (memcmp(s, c->expected, known) || glewGetCurrentContext() != ctx ||
+        GLEW_VERSION_4_6 != c->config.core || (glSpecializeShader != NULL) != c->config.core)
+      c->failures++;
+  }
+  glewSetCurrentContext(NULL);
+  free(s);
+  free(ctx);
+  return NULL;
+}
+
+int main (void)
+{
+  Check check[2] = {
+    { { 600, STUBGL_KNOWN, 0, GL_TRUE }, NULL, 0 },
+    { { 300, STUBGL_MIXED, 0, GL_FALSE }, NULL, 0 }
+  };
+  pthread_t thread[2];
+  GLEWContext* ctx = (GLEWContext*)calloc(1, sizeof(GLEWContext));
+  int i, failures = 0;
+
+  while (stubglKnownExtension(known)) ++known;
+  for (i = 0; i < 2; ++i)
+  {
+    check[i].expected = (GLboolean*)calloc(known, 1);
+    stubglConfigure(&check[i].config);
+    memset(ctx, 0, sizeof(GLEWContext));
+    if (glewContextInitFor(ctx) != GLEW_OK)
+    {
+      fprintf(stderr, "mxcheck: glewContextInitFor failed\n");
+      return 1;
+    }
+    supported(ctx, check[i].expected);
+  }
+  if (!memcmp(check[0].expected, check[1].expected, known))
+  {
+    fprintf(stderr, "mxcheck: both drivers report the same extensions\n");
+    return 1;
+  }
+
+  pthread_barrier_init(&barrier, NULL, 2);
+  for (i = 0; i < 2; ++i)
+    pthread_create(&thread[i], NULL, run, &check[i]);
+  for (i = 0; i < 2; ++i)
+  {
+    pthread_join(thread[i], NULL);
+    printf("mxcheck: thread %d, OpenGL %s, %u extensions: %d of %d rounds failed\n", i,
+           check[i].config.core ? "4.6" : "2.1", check[i].config.extensions, check[i].failures, ROUNDS);
+    failures += check[i].failures;
+    free(check[i].expected);
+  }
+  pthread_barrier_destroy(&barrier);
+  free(ctx);
+  return failures != 0;
+}
@@ -0,0 +1,27 @@
+# Write the GL and GLX extension names declared by the GLEW headers to a C
+# header, for the stub driver of glewbench to advertise
+#
+# cmake -DGLEW_HEADER=glew.h -DGLXEW_HEADER=glxew.h -DOUTPUT=names.h -P names.cmake
+
+set (_names "/* Generated by names.cmake from the GLEW headers */\n")
+foreach (_api GL GLX)
+  if (_api STREQUAL "GL")
+    set (_header ${GLEW_HEADER})
+  else ()
+    set (_header ${GLXEW_HEADER})
+  endif ()
+  # every extension section starts with a separator comment naming it
+  file (STRINGS ${_header} _lines REGEX "^/\\* -+ ${_api}_[A-Za-z0-9_]+ -+ \\*/$")
+  set (_names "${_names}\nstatic const char* const stub${_api}Names[] = {\n")
+  foreach (_line ${_lines})
+    string (REGEX REPLACE "^/\\* -+ (${_api}_[A-Za-z0-9_]+) -+ \\*/$" "\\1" _name "${_line}")
+    if (NOT _name MATCHES "^${_api}_VERSION_")
+      set (_names "${_names}  \"${_name}\",\n")
+    endif ()
+  endforeach ()
+  set (_names "${_names}  NULL\n};\n")
+endforeach ()
+
+file (WRITE ${OUTPUT}.tmp "${_names}")
+execute_process (COMMAND ${CMAKE_COMMAND} -E copy_if_different ${OUTPUT}.tmp ${OUTPUT})
+file (REMOVE ${OUTPUT}.tmp)
@@ -0,0 +1,156 @@
+/*
+** profcheck: glewInit of a GLEW built with GLEW_PROFILE, against the stub
+** driver of stubgl.c, and two threads calling entry points core in OpenGL
+** 1.3 and 1.5 a known number of times, checking that glewProfileSnapshot
+** counts every call of both threads, sorted by time, that it counts from
+** the last glewProfileReset, and that the CSV and JSON dumps list the same
+** calls.
+**
+** profcheck [file]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <GL/glew.h>
+
+#include "stubgl.h"
+
+#define SIZE 16
+
+typedef struct
+{
+  int active;  /* calls of glActiveTexture */
+  int bind;    /* calls of glBindBuffer */
+} Calls;
+
+static const char* file = "profcheck.out";
+static int failures = 0;
+static pthread_barrier_t barrier;
+
+static void* run (void* arg)
+{
+  const Calls* c = (const Calls*)arg;
+  int i;
+  pthread_barrier_wait(&barrier);
+  for (i = 0; i < c->active; ++i)
+    glActiveTexture(GL_TEXTURE0);
+  for (i = 0; i < c->bind; ++i)
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  return NULL;
+}
+
+/* Calls of name in the n entries, 0 if missing */
+static GLuint64 calls (const GLEWProfileEntry* e, GLuint n, const char* name)
+{
+  GLuint i;
+  for (i = 0; i < n; ++i)
+    if (!strcmp(e[i].name, name)) return e[i].calls;
+  return 0;
+}
+
+/* Take a snapshot and check it holds the calls and nothing else, sorted by
+   time, returning the number of entries */
+static GLuint check (const char* what, GLEWProfileEntry* e, const Calls* expect)
+{
+  const GLuint n = glewProfileSnapshot(e, SIZE);
+  const GLuint entries = (expect->active != 0) + (expect->bind != 0);
+  GLuint i, sorted = 1;
+  for (i = 1; i < n && i < SIZE; ++i)
+    sorted &= e[i-1].nanoseconds >= e[i].nanoseconds;
+  printf("profcheck: %s: %u entries, glActiveTexture %lu calls, glBindBuffer %lu calls%s\n",
+         what, n, (unsigned long)calls(e, n, "glActiveTexture"),
+         (unsigned long)calls(e, n, "glBindBuffer"), sorted ? "" : ", not sorted");
+  if (n != entries || !sorted ||
+      calls(e, n, "glActiveTexture") != (GLuint64)expect->active ||
+      calls(e, n, "glBindBuffer") != (GLuint64)expect->bind)
+    failures++;
+  return n;
+}
+
+/* Read the dump of format back and check it lists the n entries */
+static void dump (const char* what, GLenum format, const GLEWProfileEntry* e, GLuint n)
+{
+  char line[256], name[128];
+  unsigned long c, ns;
+  GLuint lines = 0, wrong = 0;
+  int closed = 0;
+  FILE* f;
+  if (!glewProfileDump(file, format) || (f = fopen(file, "r")) == NULL)
+  {
+    printf("profcheck: %s: glewProfileDump failed\n", what);
+    failures++;
+    return;
+  }
+  if (fgets(line, sizeof(line), f) == NULL ||
+      strcmp(line, format == GLEW_PROFILE_JSON ? "[\n" : "function,calls,nanoseconds\n"))
+    wrong++;
+  while (fgets(line, sizeof(line), f) != NULL)
+  {
+    if (format == GLEW_PROFILE_JSON && !strcmp(line, "]\n"))
+    {
+      closed = 1;
+      continue;
+    }
+    if (closed ||
+        (format == GLEW_PROFILE_JSON ?
+         sscanf(line, "  { \"function\": \"%127[^\"]\", \"calls\": %lu, \"nanoseconds\": %lu }", name, &c, &ns) :
+         sscanf(line, "%127[^,],%lu,%lu", name, &c, &ns)) != 3 ||
+        calls(e, n, name) != (GLuint64)c)
+      wrong++;
+    /* a comma after every object but the last */
+    if (format == GLEW_PROFILE_JSON && (strstr(line, "},") != NULL) != (lines + 1 < n))
+      wrong++;
+    ++lines;
+  }
+  fclose(f);
+  if (format == GLEW_PROFILE_JSON && !closed)
+    wrong++;
+  printf("profcheck: %s: %u entries, %u wrong lines\n", what, lines, wrong);
+  if (lines != n || wrong)
+    failures++;
+}
+
+int main (int argc, char** argv)
+{
+  const StubGLConfig config = { 300, STUBGL_KNOWN, 0, GL_FALSE };
+  Calls thread[2] = { { 3000, 1000 }, { 2000, 0 } };
+  Calls total, after = { 500, 0 };
+  GLEWProfileEntry e[SIZE];
+  pthread_t t[2];
+  GLuint n;
+  int i;
+
+  if (argc > 1) file = argv[1];
+  stubglConfigure(&config);
+  if (glewInit() != GLEW_OK)
+  {
+    fprintf(stderr, "profcheck: glewInit failed\n");
+    return 1;
+  }
+  /* what glewInit called is not counted */
+  glewProfileReset();
+
+  pthread_barrier_init(&barrier, NULL, 2);
+  for (i = 0; i < 2; ++i)
+    pthread_create(&t[i], NULL, run, &thread[i]);
+  for (i = 0; i < 2; ++i)
+    pthread_join(t[i], NULL);
+  pthread_barrier_destroy(&barrier);
+  total.active = thread[0].active + thread[1].active;
+  total.bind = thread[0].bind + thread[1].bind;
+  n = check("two threads", e, &total);
+
+  dump("CSV", GLEW_PROFILE_CSV, e, n);
+  dump("JSON", GLEW_PROFILE_JSON, e, n);
+
+  glewProfileReset();
+  for (i = 0; i < after.active; ++i)
+    glActiveTexture(GL_TEXTURE0);
+  check("after glewProfileReset", e, &after);
+
+  unlink(file);
+  return failures != 0;
+}
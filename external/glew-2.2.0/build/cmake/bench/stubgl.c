@@ -0,0 +1,213 @@
+/*
+** Stub GL driver for glewbench, see stubgl.h
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GL/glxew.h>
+
+#include "stubgl.h"
+#include "names.h"
+
+/* Each thread configures the driver it sees, see stubglConfigure */
+__thread StubGLCounters stubglCounters;
+
+static __thread StubGLConfig config = { 0, STUBGL_KNOWN, 0, GL_FALSE };
+static __thread char** glNames = NULL;
+static __thread GLuint glCount = 0;
+static __thread char* glString = NULL;
+static __thread char** glxNames = NULL;
+static __thread GLuint glxCount = 0;
+static __thread char* glxString = NULL;
+static int display;
+
+/* ------------------------------------------------------------------------ */
+
+static void stubSpin (unsigned long ns)
+{
+  struct timespec t0, t;
+  if (ns == 0) return;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  do clock_gettime(CLOCK_MONOTONIC, &t);
+  while ((unsigned long)(t.tv_sec - t0.tv_sec) * 1000000000ul + (unsigned long)t.tv_nsec - (unsigned long)t0.tv_nsec < ns);
+}
+
+/* An unknown name replaces the underscore after the vendor with an X,
+   GL_ARB_imaging becomes GL_ARBXimaging of the same length, and names past
+   the first round get a suffix */
+static char* stubName (const char* name, GLboolean known, GLuint round)
+{
+  char* s = (char*)malloc(strlen(name) + 16);
+  strcpy(s, name);
+  if (!known)
+  {
+    char* p = strchr(strchr(s, '_') + 1, '_');
+    if (p != NULL) *p = 'X';
+  }
+  if (round)
+    sprintf(s + strlen(s), "_%u", round);
+  return s;
+}
+
+/* Pick count names of the shape, scattered over the sorted names */
+static char** stubNames (const char* const* names, GLuint want, int shape, GLuint* count)
+{
+  char** list = (char**)malloc((want ? want : 1) * sizeof(char*));
+  GLuint n = 0, stride = 7, i;
+  while (names[n]) ++n;
+  while (n % stride == 0) stride += 2;
+  for (i = 0; i < want && n > 0; ++i)
+  {
+    const char* name = names[(GLuint)(((unsigned long)i * stride) % n)];
+    GLboolean known = shape == STUBGL_KNOWN || (shape == STUBGL_MIXED && i % 2 == 0 && i < n);
+    if (known && i >= n) break;
+    list[i] = stubName(name, known, i / n);
+  }
+  *count = i;
+  return list;
+}
+
+/* Space separated, with the trailing space of most drivers */
+static char* stubJoin (char** names, GLuint count)
+{
+  size_t len = 1;
+  char* s;
+  GLuint i;
+  for (i = 0; i < count; ++i)
+    len += strlen(names[i]) + 1;
+  s = (char*)malloc(len);
+  s[0] = '\0';
+  for (len = 0, i = 0; i < count; ++i)
+  {
+    strcpy(s + len, names[i]);
+    len += strlen(names[i]);
+    s[len++] = ' ';
+    s[len] = '\0';
+  }
+  return s;
+}
+
+static void stubFree (char** names, GLuint count, char* string)
+{
+  GLuint i;
+  for (i = 0; i < count; ++i)
+    free(names[i]);
+  free(names);
+  free(string);
+}
+
+void stubglConfigure (const StubGLConfig* c)
+{
+  GLuint n = 0;
+  stubFree(glNames, glCount, glString);
+  stubFree(glxNames, glxCount, glxString);
+  config = *c;
+  glNames = stubNames(stubGLNames, config.extensions, config.shape, &glCount);
+  glString = stubJoin(glNames, glCount);
+  while (stubGLXNames[n]) ++n;
+  glxNames = stubNames(stubGLXNames, n, config.shape, &glxCount);
+  glxString = stubJoin(glxNames, glxCount);
+  memset(&stubglCounters, 0, sizeof(stubglCounters));
+}
+
+const char* stubglExtension (GLuint i)
+{
+  return i < glCount ? glNames[i] : NULL;
+}
+
+GLuint stubglExtensionCount (void)
+{
+  return glCount;
+}
+
+const char* stubglKnownExtension (GLuint i)
+{
+  GLuint n = 0;
+  while (stubGLNames[n]) ++n;
+  return i < n ? stubGLNames[i] : NULL;
+}
+
+const char* stubglKnownGLXExtension (GLuint i)
+{
+  GLuint n = 0;
+  while (stubGLXNames[n]) ++n;
+  return i < n ? stubGLXNames[i] : NULL;
+}
+
+/* ------------------------------------------------------------------------ */
+
+const GLubyte* GLAPIENTRY glGetString (GLenum name)
+{
+  stubglCounters.queries++;
+  switch (name)
+  {
+    case GL_VENDOR: return (const GLubyte*)"GLEW";
+    case GL_RENDERER: return (const GLubyte*)"Stub";
+    case GL_VERSION: return (const GLubyte*)(config.core ? "4.6.0 Stub" : "2.1 Stub");
+    case GL_EXTENSIONS: return config.core ? NULL : (const GLubyte*)glString;
+  }
+  return NULL;
+}
+
+void GLAPIENTRY glGetIntegerv (GLenum pname, GLint* params)
+{
+  stubglCounters.queries++;
+  if (!config.core) return;
+  switch (pname)
+  {
+    case GL_NUM_EXTENSIONS: *params = (GLint)glCount; break;
+    case GL_CONTEXT_FLAGS: *params = 0; break;
+    case GL_CONTEXT_PROFILE_MASK: *params = GL_CONTEXT_CORE_PROFILE_BIT; break;
+  }
+}
+
+static const GLubyte* GLAPIENTRY stubGetStringi (GLenum name, GLuint index)
+{
+  stubglCounters.queries++;
+  return name == GL_EXTENSIONS && config.core && index < glCount ? (const GLubyte*)glNames[index] : NULL;
+}
+
+static Display* stubGetCurrentDisplay (void)
+{
+  return (Display*)&display;
+}
+
+Bool glXQueryVersion (Display* dpy, int* major, int* minor)
+{
+  (void)dpy;
+  *major = 1;
+  *minor = 4;
+  return True;
+}
+
+const char* glXGetClientString (Display* dpy, int name)
+{
+  (void)dpy;
+  stubglCounters.queries++;
+  switch (name)
+  {
+    case GLX_VENDOR: return "GLEW";
+    case GLX_VERSION: return "1.4 Stub";
+    case GLX_EXTENSIONS: return glxString;
+  }
+  return NULL;
+}
+
+static void stubNoop (void)
+{
+}
+
+/* Every other entry point resolves to a function doing nothing */
+void (*glXGetProcAddressARB (const GLubyte* procName)) (void)
+{
+  const char* name = (const char*)procName;
+  stubglCounters.resolves++;
+  stubSpin(config.latency);
+  if (!strcmp(name, "glGetString")) return (void (*)(void))glGetString;
+  if (!strcmp(name, "glGetIntegerv")) return (void (*)(void))glGetIntegerv;
+  if (!strcmp(name, "glGetStringi")) return (void (*)(void))stubGetStringi;
+  if (!strcmp(name, "glXGetCurrentDisplay")) return (void (*)(void))stubGetCurrentDisplay;
+  return stubNoop;
+}
@@ -0,0 +1,48 @@
+/*
+** Stub GL driver for glewbench: glGetString, glGetStringi, glGetIntegerv,
+** glXGetProcAddressARB and the GLX queries of glxewInit, answering from a
+** configurable set of extensions without a GPU or display.
+*/
+
+#ifndef __stubgl_h__
+#define __stubgl_h__
+
+#include <GL/glew.h>
+
+/* Shape of the extension names advertised */
+#define STUBGL_KNOWN 0    /* names GLEW knows */
+#define STUBGL_UNKNOWN 1  /* names GLEW does not know, of the same lengths */
+#define STUBGL_MIXED 2    /* known and unknown names alternating */
+
+typedef struct
+{
+  GLuint extensions;       /* number of GL extensions */
+  int shape;               /* STUBGL_KNOWN, STUBGL_UNKNOWN or STUBGL_MIXED */
+  unsigned long latency;   /* nanoseconds spent in each glXGetProcAddressARB */
+  GLboolean core;          /* OpenGL 4.6 with glGetStringi, or 2.1 with GL_EXTENSIONS */
+} StubGLConfig;
+
+/* Calls since the last stubglConfigure */
+typedef struct
+{
+  unsigned long resolves;  /* glXGetProcAddressARB */
+  unsigned long queries;   /* glGetString, glGetStringi, glGetIntegerv and glXGetClientString */
+} StubGLCounters;
+
+/* Configure the driver of the calling thread, every thread sees its own
+   extensions, version and counters */
+extern void stubglConfigure (const StubGLConfig* config);
+extern __thread StubGLCounters stubglCounters;
+
+/* The i-th GL extension advertised, or NULL */
+extern const char* stubglExtension (GLuint i);
+/* Number of GL extensions advertised, fewer than configured if there are
+   not as many distinct names of the shape */
+extern GLuint stubglExtensionCount (void);
+
+/* The i-th GL or GLX extension name GLEW knows, in the order of its
+   headers, or NULL */
+extern const char* stubglKnownExtension (GLuint i);
+extern const char* stubglKnownGLXExtension (GLuint i);
+
+#endif /* __stubgl_h__ */
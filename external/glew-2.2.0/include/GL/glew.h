@@ -26357,6 +26357,4092 @@ GLEW_VAR_EXPORT GLboolean __GLEW_WIN_phong_shading;
 GLEW_VAR_EXPORT GLboolean __GLEW_WIN_scene_markerXXX;
 GLEW_VAR_EXPORT GLboolean __GLEW_WIN_specular_fog;
 GLEW_VAR_EXPORT GLboolean __GLEW_WIN_swap_hint;
+
+/* Function pointers and flags of one GL context, see glewContextInitFor */
+struct GLEWContextStruct
+{
+
+  PFNGLCOPYTEXSUBIMAGE3DPROC __glewCopyTexSubImage3D;
+  PFNGLDRAWRANGEELEMENTSPROC __glewDrawRangeElements;
+  PFNGLTEXIMAGE3DPROC __glewTexImage3D;
+  PFNGLTEXSUBIMAGE3DPROC __glewTexSubImage3D;
+
+  PFNGLACTIVETEXTUREPROC __glewActiveTexture;
+  PFNGLCLIENTACTIVETEXTUREPROC __glewClientActiveTexture;
+  PFNGLCOMPRESSEDTEXIMAGE1DPROC __glewCompressedTexImage1D;
+  PFNGLCOMPRESSEDTEXIMAGE2DPROC __glewCompressedTexImage2D;
+  PFNGLCOMPRESSEDTEXIMAGE3DPROC __glewCompressedTexImage3D;
+  PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC __glewCompressedTexSubImage1D;
+  PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC __glewCompressedTexSubImage2D;
+  PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC __glewCompressedTexSubImage3D;
+  PFNGLGETCOMPRESSEDTEXIMAGEPROC __glewGetCompressedTexImage;
+  PFNGLLOADTRANSPOSEMATRIXDPROC __glewLoadTransposeMatrixd;
+  PFNGLLOADTRANSPOSEMATRIXFPROC __glewLoadTransposeMatrixf;
+  PFNGLMULTTRANSPOSEMATRIXDPROC __glewMultTransposeMatrixd;
+  PFNGLMULTTRANSPOSEMATRIXFPROC __glewMultTransposeMatrixf;
+  PFNGLMULTITEXCOORD1DPROC __glewMultiTexCoord1d;
+  PFNGLMULTITEXCOORD1DVPROC __glewMultiTexCoord1dv;
+  PFNGLMULTITEXCOORD1FPROC __glewMultiTexCoord1f;
+  PFNGLMULTITEXCOORD1FVPROC __glewMultiTexCoord1fv;
+  PFNGLMULTITEXCOORD1IPROC __glewMultiTexCoord1i;
+  PFNGLMULTITEXCOORD1IVPROC __glewMultiTexCoord1iv;
+  PFNGLMULTITEXCOORD1SPROC __glewMultiTexCoord1s;
+  PFNGLMULTITEXCOORD1SVPROC __glewMultiTexCoord1sv;
+  PFNGLMULTITEXCOORD2DPROC __glewMultiTexCoord2d;
+  PFNGLMULTITEXCOORD2DVPROC __glewMultiTexCoord2dv;
+  PFNGLMULTITEXCOORD2FPROC __glewMultiTexCoord2f;
+  PFNGLMULTITEXCOORD2FVPROC __glewMultiTexCoord2fv;
+  PFNGLMULTITEXCOORD2IPROC __glewMultiTexCoord2i;
+  PFNGLMULTITEXCOORD2IVPROC __glewMultiTexCoord2iv;
+  PFNGLMULTITEXCOORD2SPROC __glewMultiTexCoord2s;
+  PFNGLMULTITEXCOORD2SVPROC __glewMultiTexCoord2sv;
+  PFNGLMULTITEXCOORD3DPROC __glewMultiTexCoord3d;
+  PFNGLMULTITEXCOORD3DVPROC __glewMultiTexCoord3dv;
+  PFNGLMULTITEXCOORD3FPROC __glewMultiTexCoord3f;
+  PFNGLMULTITEXCOORD3FVPROC __glewMultiTexCoord3fv;
+  PFNGLMULTITEXCOORD3IPROC __glewMultiTexCoord3i;
+  PFNGLMULTITEXCOORD3IVPROC __glewMultiTexCoord3iv;
+  PFNGLMULTITEXCOORD3SPROC __glewMultiTexCoord3s;
+  PFNGLMULTITEXCOORD3SVPROC __glewMultiTexCoord3sv;
+  PFNGLMULTITEXCOORD4DPROC __glewMultiTexCoord4d;
+  PFNGLMULTITEXCOORD4DVPROC __glewMultiTexCoord4dv;
+  PFNGLMULTITEXCOORD4FPROC __glewMultiTexCoord4f;
+  PFNGLMULTITEXCOORD4FVPROC __glewMultiTexCoord4fv;
+  PFNGLMULTITEXCOORD4IPROC __glewMultiTexCoord4i;
+  PFNGLMULTITEXCOORD4IVPROC __glewMultiTexCoord4iv;
+  PFNGLMULTITEXCOORD4SPROC __glewMultiTexCoord4s;
+  PFNGLMULTITEXCOORD4SVPROC __glewMultiTexCoord4sv;
+  PFNGLSAMPLECOVERAGEPROC __glewSampleCoverage;
+
+  PFNGLBLENDCOLORPROC __glewBlendColor;
+  PFNGLBLENDEQUATIONPROC __glewBlendEquation;
+  PFNGLBLENDFUNCSEPARATEPROC __glewBlendFuncSeparate;
+  PFNGLFOGCOORDPOINTERPROC __glewFogCoordPointer;
+  PFNGLFOGCOORDDPROC __glewFogCoordd;
+  PFNGLFOGCOORDDVPROC __glewFogCoorddv;
+  PFNGLFOGCOORDFPROC __glewFogCoordf;
+  PFNGLFOGCOORDFVPROC __glewFogCoordfv;
+  PFNGLMULTIDRAWARRAYSPROC __glewMultiDrawArrays;
+  PFNGLMULTIDRAWELEMENTSPROC __glewMultiDrawElements;
+  PFNGLPOINTPARAMETERFPROC __glewPointParameterf;
+  PFNGLPOINTPARAMETERFVPROC __glewPointParameterfv;
+  PFNGLPOINTPARAMETERIPROC __glewPointParameteri;
+  PFNGLPOINTPARAMETERIVPROC __glewPointParameteriv;
+  PFNGLSECONDARYCOLOR3BPROC __glewSecondaryColor3b;
+  PFNGLSECONDARYCOLOR3BVPROC __glewSecondaryColor3bv;
+  PFNGLSECONDARYCOLOR3DPROC __glewSecondaryColor3d;
+  PFNGLSECONDARYCOLOR3DVPROC __glewSecondaryColor3dv;
+  PFNGLSECONDARYCOLOR3FPROC __glewSecondaryColor3f;
+  PFNGLSECONDARYCOLOR3FVPROC __glewSecondaryColor3fv;
+  PFNGLSECONDARYCOLOR3IPROC __glewSecondaryColor3i;
+  PFNGLSECONDARYCOLOR3IVPROC __glewSecondaryColor3iv;
+  PFNGLSECONDARYCOLOR3SPROC __glewSecondaryColor3s;
+  PFNGLSECONDARYCOLOR3SVPROC __glewSecondaryColor3sv;
+  PFNGLSECONDARYCOLOR3UBPROC __glewSecondaryColor3ub;
+  PFNGLSECONDARYCOLOR3UBVPROC __glewSecondaryColor3ubv;
+  PFNGLSECONDARYCOLOR3UIPROC __glewSecondaryColor3ui;
+  PFNGLSECONDARYCOLOR3UIVPROC __glewSecondaryColor3uiv;
+  PFNGLSECONDARYCOLOR3USPROC __glewSecondaryColor3us;
+  PFNGLSECONDARYCOLOR3USVPROC __glewSecondaryColor3usv;
+  PFNGLSECONDARYCOLORPOINTERPROC __glewSecondaryColorPointer;
+  PFNGLWINDOWPOS2DPROC __glewWindowPos2d;
+  PFNGLWINDOWPOS2DVPROC __glewWindowPos2dv;
+  PFNGLWINDOWPOS2FPROC __glewWindowPos2f;
+  PFNGLWINDOWPOS2FVPROC __glewWindowPos2fv;
+  PFNGLWINDOWPOS2IPROC __glewWindowPos2i;
+  PFNGLWINDOWPOS2IVPROC __glewWindowPos2iv;
+  PFNGLWINDOWPOS2SPROC __glewWindowPos2s;
+  PFNGLWINDOWPOS2SVPROC __glewWindowPos2sv;
+  PFNGLWINDOWPOS3DPROC __glewWindowPos3d;
+  PFNGLWINDOWPOS3DVPROC __glewWindowPos3dv;
+  PFNGLWINDOWPOS3FPROC __glewWindowPos3f;
+  PFNGLWINDOWPOS3FVPROC __glewWindowPos3fv;
+  PFNGLWINDOWPOS3IPROC __glewWindowPos3i;
+  PFNGLWINDOWPOS3IVPROC __glewWindowPos3iv;
+  PFNGLWINDOWPOS3SPROC __glewWindowPos3s;
+  PFNGLWINDOWPOS3SVPROC __glewWindowPos3sv;
+
+  PFNGLBEGINQUERYPROC __glewBeginQuery;
+  PFNGLBINDBUFFERPROC __glewBindBuffer;
+  PFNGLBUFFERDATAPROC __glewBufferData;
+  PFNGLBUFFERSUBDATAPROC __glewBufferSubData;
+  PFNGLDELETEBUFFERSPROC __glewDeleteBuffers;
+  PFNGLDELETEQUERIESPROC __glewDeleteQueries;
+  PFNGLENDQUERYPROC __glewEndQuery;
+  PFNGLGENBUFFERSPROC __glewGenBuffers;
+  PFNGLGENQUERIESPROC __glewGenQueries;
+  PFNGLGETBUFFERPARAMETERIVPROC __glewGetBufferParameteriv;
+  PFNGLGETBUFFERPOINTERVPROC __glewGetBufferPointerv;
+  PFNGLGETBUFFERSUBDATAPROC __glewGetBufferSubData;
+  PFNGLGETQUERYOBJECTIVPROC __glewGetQueryObjectiv;
+  PFNGLGETQUERYOBJECTUIVPROC __glewGetQueryObjectuiv;
+  PFNGLGETQUERYIVPROC __glewGetQueryiv;
+  PFNGLISBUFFERPROC __glewIsBuffer;
+  PFNGLISQUERYPROC __glewIsQuery;
+  PFNGLMAPBUFFERPROC __glewMapBuffer;
+  PFNGLUNMAPBUFFERPROC __glewUnmapBuffer;
+
+  PFNGLATTACHSHADERPROC __glewAttachShader;
+  PFNGLBINDATTRIBLOCATIONPROC __glewBindAttribLocation;
+  PFNGLBLENDEQUATIONSEPARATEPROC __glewBlendEquationSeparate;
+  PFNGLCOMPILESHADERPROC __glewCompileShader;
+  PFNGLCREATEPROGRAMPROC __glewCreateProgram;
+  PFNGLCREATESHADERPROC __glewCreateShader;
+  PFNGLDELETEPROGRAMPROC __glewDeleteProgram;
+  PFNGLDELETESHADERPROC __glewDeleteShader;
+  PFNGLDETACHSHADERPROC __glewDetachShader;
+  PFNGLDISABLEVERTEXATTRIBARRAYPROC __glewDisableVertexAttribArray;
+  PFNGLDRAWBUFFERSPROC __glewDrawBuffers;
+  PFNGLENABLEVERTEXATTRIBARRAYPROC __glewEnableVertexAttribArray;
+  PFNGLGETACTIVEATTRIBPROC __glewGetActiveAttrib;
+  PFNGLGETACTIVEUNIFORMPROC __glewGetActiveUniform;
+  PFNGLGETATTACHEDSHADERSPROC __glewGetAttachedShaders;
+  PFNGLGETATTRIBLOCATIONPROC __glewGetAttribLocation;
+  PFNGLGETPROGRAMINFOLOGPROC __glewGetProgramInfoLog;
+  PFNGLGETPROGRAMIVPROC __glewGetProgramiv;
+  PFNGLGETSHADERINFOLOGPROC __glewGetShaderInfoLog;
+  PFNGLGETSHADERSOURCEPROC __glewGetShaderSource;
+  PFNGLGETSHADERIVPROC __glewGetShaderiv;
+  PFNGLGETUNIFORMLOCATIONPROC __glewGetUniformLocation;
+  PFNGLGETUNIFORMFVPROC __glewGetUniformfv;
+  PFNGLGETUNIFORMIVPROC __glewGetUniformiv;
+  PFNGLGETVERTEXATTRIBPOINTERVPROC __glewGetVertexAttribPointerv;
+  PFNGLGETVERTEXATTRIBDVPROC __glewGetVertexAttribdv;
+  PFNGLGETVERTEXATTRIBFVPROC __glewGetVertexAttribfv;
+  PFNGLGETVERTEXATTRIBIVPROC __glewGetVertexAttribiv;
+  PFNGLISPROGRAMPROC __glewIsProgram;
+  PFNGLISSHADERPROC __glewIsShader;
+  PFNGLLINKPROGRAMPROC __glewLinkProgram;
+  PFNGLSHADERSOURCEPROC __glewShaderSource;
+  PFNGLSTENCILFUNCSEPARATEPROC __glewStencilFuncSeparate;
+  PFNGLSTENCILMASKSEPARATEPROC __glewStencilMaskSeparate;
+  PFNGLSTENCILOPSEPARATEPROC __glewStencilOpSeparate;
+  PFNGLUNIFORM1FPROC __glewUniform1f;
+  PFNGLUNIFORM1FVPROC __glewUniform1fv;
+  PFNGLUNIFORM1IPROC __glewUniform1i;
+  PFNGLUNIFORM1IVPROC __glewUniform1iv;
+  PFNGLUNIFORM2FPROC __glewUniform2f;
+  PFNGLUNIFORM2FVPROC __glewUniform2fv;
+  PFNGLUNIFORM2IPROC __glewUniform2i;
+  PFNGLUNIFORM2IVPROC __glewUniform2iv;
+  PFNGLUNIFORM3FPROC __glewUniform3f;
+  PFNGLUNIFORM3FVPROC __glewUniform3fv;
+  PFNGLUNIFORM3IPROC __glewUniform3i;
+  PFNGLUNIFORM3IVPROC __glewUniform3iv;
+  PFNGLUNIFORM4FPROC __glewUniform4f;
+  PFNGLUNIFORM4FVPROC __glewUniform4fv;
+  PFNGLUNIFORM4IPROC __glewUniform4i;
+  PFNGLUNIFORM4IVPROC __glewUniform4iv;
+  PFNGLUNIFORMMATRIX2FVPROC __glewUniformMatrix2fv;
+  PFNGLUNIFORMMATRIX3FVPROC __glewUniformMatrix3fv;
+  PFNGLUNIFORMMATRIX4FVPROC __glewUniformMatrix4fv;
+  PFNGLUSEPROGRAMPROC __glewUseProgram;
+  PFNGLVALIDATEPROGRAMPROC __glewValidateProgram;
+  PFNGLVERTEXATTRIB1DPROC __glewVertexAttrib1d;
+  PFNGLVERTEXATTRIB1DVPROC __glewVertexAttrib1dv;
+  PFNGLVERTEXATTRIB1FPROC __glewVertexAttrib1f;
+  PFNGLVERTEXATTRIB1FVPROC __glewVertexAttrib1fv;
+  PFNGLVERTEXATTRIB1SPROC __glewVertexAttrib1s;
+  PFNGLVERTEXATTRIB1SVPROC __glewVertexAttrib1sv;
+  PFNGLVERTEXATTRIB2DPROC __glewVertexAttrib2d;
+  PFNGLVERTEXATTRIB2DVPROC __glewVertexAttrib2dv;
+  PFNGLVERTEXATTRIB2FPROC __glewVertexAttrib2f;
+  PFNGLVERTEXATTRIB2FVPROC __glewVertexAttrib2fv;
+  PFNGLVERTEXATTRIB2SPROC __glewVertexAttrib2s;
+  PFNGLVERTEXATTRIB2SVPROC __glewVertexAttrib2sv;
+  PFNGLVERTEXATTRIB3DPROC __glewVertexAttrib3d;
+  PFNGLVERTEXATTRIB3DVPROC __glewVertexAttrib3dv;
+  PFNGLVERTEXATTRIB3FPROC __glewVertexAttrib3f;
+  PFNGLVERTEXATTRIB3FVPROC __glewVertexAttrib3fv;
+  PFNGLVERTEXATTRIB3SPROC __glewVertexAttrib3s;
+  PFNGLVERTEXATTRIB3SVPROC __glewVertexAttrib3sv;
+  PFNGLVERTEXATTRIB4NBVPROC __glewVertexAttrib4Nbv;
+  PFNGLVERTEXATTRIB4NIVPROC __glewVertexAttrib4Niv;
+  PFNGLVERTEXATTRIB4NSVPROC __glewVertexAttrib4Nsv;
+  PFNGLVERTEXATTRIB4NUBPROC __glewVertexAttrib4Nub;
+  PFNGLVERTEXATTRIB4NUBVPROC __glewVertexAttrib4Nubv;
+  PFNGLVERTEXATTRIB4NUIVPROC __glewVertexAttrib4Nuiv;
+  PFNGLVERTEXATTRIB4NUSVPROC __glewVertexAttrib4Nusv;
+  PFNGLVERTEXATTRIB4BVPROC __glewVertexAttrib4bv;
+  PFNGLVERTEXATTRIB4DPROC __glewVertexAttrib4d;
+  PFNGLVERTEXATTRIB4DVPROC __glewVertexAttrib4dv;
+  PFNGLVERTEXATTRIB4FPROC __glewVertexAttrib4f;
+  PFNGLVERTEXATTRIB4FVPROC __glewVertexAttrib4fv;
+  PFNGLVERTEXATTRIB4IVPROC __glewVertexAttrib4iv;
+  PFNGLVERTEXATTRIB4SPROC __glewVertexAttrib4s;
+  PFNGLVERTEXATTRIB4SVPROC __glewVertexAttrib4sv;
+  PFNGLVERTEXATTRIB4UBVPROC __glewVertexAttrib4ubv;
+  PFNGLVERTEXATTRIB4UIVPROC __glewVertexAttrib4uiv;
+  PFNGLVERTEXATTRIB4USVPROC __glewVertexAttrib4usv;
+  PFNGLVERTEXATTRIBPOINTERPROC __glewVertexAttribPointer;
+
+  PFNGLUNIFORMMATRIX2X3FVPROC __glewUniformMatrix2x3fv;
+  PFNGLUNIFORMMATRIX2X4FVPROC __glewUniformMatrix2x4fv;
+  PFNGLUNIFORMMATRIX3X2FVPROC __glewUniformMatrix3x2fv;
+  PFNGLUNIFORMMATRIX3X4FVPROC __glewUniformMatrix3x4fv;
+  PFNGLUNIFORMMATRIX4X2FVPROC __glewUniformMatrix4x2fv;
+  PFNGLUNIFORMMATRIX4X3FVPROC __glewUniformMatrix4x3fv;
+
+  PFNGLBEGINCONDITIONALRENDERPROC __glewBeginConditionalRender;
+  PFNGLBEGINTRANSFORMFEEDBACKPROC __glewBeginTransformFeedback;
+  PFNGLBINDFRAGDATALOCATIONPROC __glewBindFragDataLocation;
+  PFNGLCLAMPCOLORPROC __glewClampColor;
+  PFNGLCLEARBUFFERFIPROC __glewClearBufferfi;
+  PFNGLCLEARBUFFERFVPROC __glewClearBufferfv;
+  PFNGLCLEARBUFFERIVPROC __glewClearBufferiv;
+  PFNGLCLEARBUFFERUIVPROC __glewClearBufferuiv;
+  PFNGLCOLORMASKIPROC __glewColorMaski;
+  PFNGLDISABLEIPROC __glewDisablei;
+  PFNGLENABLEIPROC __glewEnablei;
+  PFNGLENDCONDITIONALRENDERPROC __glewEndConditionalRender;
+  PFNGLENDTRANSFORMFEEDBACKPROC __glewEndTransformFeedback;
+  PFNGLGETBOOLEANI_VPROC __glewGetBooleani_v;
+  PFNGLGETFRAGDATALOCATIONPROC __glewGetFragDataLocation;
+  PFNGLGETSTRINGIPROC __glewGetStringi;
+  PFNGLGETTEXPARAMETERIIVPROC __glewGetTexParameterIiv;
+  PFNGLGETTEXPARAMETERIUIVPROC __glewGetTexParameterIuiv;
+  PFNGLGETTRANSFORMFEEDBACKVARYINGPROC __glewGetTransformFeedbackVarying;
+  PFNGLGETUNIFORMUIVPROC __glewGetUniformuiv;
+  PFNGLGETVERTEXATTRIBIIVPROC __glewGetVertexAttribIiv;
+  PFNGLGETVERTEXATTRIBIUIVPROC __glewGetVertexAttribIuiv;
+  PFNGLISENABLEDIPROC __glewIsEnabledi;
+  PFNGLTEXPARAMETERIIVPROC __glewTexParameterIiv;
+  PFNGLTEXPARAMETERIUIVPROC __glewTexParameterIuiv;
+  PFNGLTRANSFORMFEEDBACKVARYINGSPROC __glewTransformFeedbackVaryings;
+  PFNGLUNIFORM1UIPROC __glewUniform1ui;
+  PFNGLUNIFORM1UIVPROC __glewUniform1uiv;
+  PFNGLUNIFORM2UIPROC __glewUniform2ui;
+  PFNGLUNIFORM2UIVPROC __glewUniform2uiv;
+  PFNGLUNIFORM3UIPROC __glewUniform3ui;
+  PFNGLUNIFORM3UIVPROC __glewUniform3uiv;
+  PFNGLUNIFORM4UIPROC __glewUniform4ui;
+  PFNGLUNIFORM4UIVPROC __glewUniform4uiv;
+  PFNGLVERTEXATTRIBI1IPROC __glewVertexAttribI1i;
+  PFNGLVERTEXATTRIBI1IVPROC __glewVertexAttribI1iv;
+  PFNGLVERTEXATTRIBI1UIPROC __glewVertexAttribI1ui;
+  PFNGLVERTEXATTRIBI1UIVPROC __glewVertexAttribI1uiv;
+  PFNGLVERTEXATTRIBI2IPROC __glewVertexAttribI2i;
+  PFNGLVERTEXATTRIBI2IVPROC __glewVertexAttribI2iv;
+  PFNGLVERTEXATTRIBI2UIPROC __glewVertexAttribI2ui;
+  PFNGLVERTEXATTRIBI2UIVPROC __glewVertexAttribI2uiv;
+  PFNGLVERTEXATTRIBI3IPROC __glewVertexAttribI3i;
+  PFNGLVERTEXATTRIBI3IVPROC __glewVertexAttribI3iv;
+  PFNGLVERTEXATTRIBI3UIPROC __glewVertexAttribI3ui;
+  PFNGLVERTEXATTRIBI3UIVPROC __glewVertexAttribI3uiv;
+  PFNGLVERTEXATTRIBI4BVPROC __glewVertexAttribI4bv;
+  PFNGLVERTEXATTRIBI4IPROC __glewVertexAttribI4i;
+  PFNGLVERTEXATTRIBI4IVPROC __glewVertexAttribI4iv;
+  PFNGLVERTEXATTRIBI4SVPROC __glewVertexAttribI4sv;
+  PFNGLVERTEXATTRIBI4UBVPROC __glewVertexAttribI4ubv;
+  PFNGLVERTEXATTRIBI4UIPROC __glewVertexAttribI4ui;
+  PFNGLVERTEXATTRIBI4UIVPROC __glewVertexAttribI4uiv;
+  PFNGLVERTEXATTRIBI4USVPROC __glewVertexAttribI4usv;
+  PFNGLVERTEXATTRIBIPOINTERPROC __glewVertexAttribIPointer;
+
+  PFNGLDRAWARRAYSINSTANCEDPROC __glewDrawArraysInstanced;
+  PFNGLDRAWELEMENTSINSTANCEDPROC __glewDrawElementsInstanced;
+  PFNGLPRIMITIVERESTARTINDEXPROC __glewPrimitiveRestartIndex;
+  PFNGLTEXBUFFERPROC __glewTexBuffer;
+
+  PFNGLFRAMEBUFFERTEXTUREPROC __glewFramebufferTexture;
+  PFNGLGETBUFFERPARAMETERI64VPROC __glewGetBufferParameteri64v;
+  PFNGLGETINTEGER64I_VPROC __glewGetInteger64i_v;
+
+  PFNGLVERTEXATTRIBDIVISORPROC __glewVertexAttribDivisor;
+
+  PFNGLBLENDEQUATIONSEPARATEIPROC __glewBlendEquationSeparatei;
+  PFNGLBLENDEQUATIONIPROC __glewBlendEquationi;
+  PFNGLBLENDFUNCSEPARATEIPROC __glewBlendFuncSeparatei;
+  PFNGLBLENDFUNCIPROC __glewBlendFunci;
+  PFNGLMINSAMPLESHADINGPROC __glewMinSampleShading;
+
+  PFNGLGETGRAPHICSRESETSTATUSPROC __glewGetGraphicsResetStatus;
+  PFNGLGETNCOMPRESSEDTEXIMAGEPROC __glewGetnCompressedTexImage;
+  PFNGLGETNTEXIMAGEPROC __glewGetnTexImage;
+  PFNGLGETNUNIFORMDVPROC __glewGetnUniformdv;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC __glewMultiDrawArraysIndirectCount;
+  PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC __glewMultiDrawElementsIndirectCount;
+  PFNGLSPECIALIZESHADERPROC __glewSpecializeShader;
+
+  PFNGLTBUFFERMASK3DFXPROC __glewTbufferMask3DFX;
+
+  PFNGLDEBUGMESSAGECALLBACKAMDPROC __glewDebugMessageCallbackAMD;
+  PFNGLDEBUGMESSAGEENABLEAMDPROC __glewDebugMessageEnableAMD;
+  PFNGLDEBUGMESSAGEINSERTAMDPROC __glewDebugMessageInsertAMD;
+  PFNGLGETDEBUGMESSAGELOGAMDPROC __glewGetDebugMessageLogAMD;
+
+  PFNGLBLENDEQUATIONINDEXEDAMDPROC __glewBlendEquationIndexedAMD;
+  PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC __glewBlendEquationSeparateIndexedAMD;
+  PFNGLBLENDFUNCINDEXEDAMDPROC __glewBlendFuncIndexedAMD;
+  PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC __glewBlendFuncSeparateIndexedAMD;
+
+  PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC __glewNamedRenderbufferStorageMultisampleAdvancedAMD;
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC __glewRenderbufferStorageMultisampleAdvancedAMD;
+
+  PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC __glewFramebufferSamplePositionsfvAMD;
+  PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC __glewGetFramebufferParameterfvAMD;
+  PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC __glewGetNamedFramebufferParameterfvAMD;
+  PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC __glewNamedFramebufferSamplePositionsfvAMD;
+
+  PFNGLVERTEXATTRIBPARAMETERIAMDPROC __glewVertexAttribParameteriAMD;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC __glewMultiDrawArraysIndirectAMD;
+  PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC __glewMultiDrawElementsIndirectAMD;
+
+  PFNGLDELETENAMESAMDPROC __glewDeleteNamesAMD;
+  PFNGLGENNAMESAMDPROC __glewGenNamesAMD;
+  PFNGLISNAMEAMDPROC __glewIsNameAMD;
+
+  PFNGLQUERYOBJECTPARAMETERUIAMDPROC __glewQueryObjectParameteruiAMD;
+
+  PFNGLBEGINPERFMONITORAMDPROC __glewBeginPerfMonitorAMD;
+  PFNGLDELETEPERFMONITORSAMDPROC __glewDeletePerfMonitorsAMD;
+  PFNGLENDPERFMONITORAMDPROC __glewEndPerfMonitorAMD;
+  PFNGLGENPERFMONITORSAMDPROC __glewGenPerfMonitorsAMD;
+  PFNGLGETPERFMONITORCOUNTERDATAAMDPROC __glewGetPerfMonitorCounterDataAMD;
+  PFNGLGETPERFMONITORCOUNTERINFOAMDPROC __glewGetPerfMonitorCounterInfoAMD;
+  PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC __glewGetPerfMonitorCounterStringAMD;
+  PFNGLGETPERFMONITORCOUNTERSAMDPROC __glewGetPerfMonitorCountersAMD;
+  PFNGLGETPERFMONITORGROUPSTRINGAMDPROC __glewGetPerfMonitorGroupStringAMD;
+  PFNGLGETPERFMONITORGROUPSAMDPROC __glewGetPerfMonitorGroupsAMD;
+  PFNGLSELECTPERFMONITORCOUNTERSAMDPROC __glewSelectPerfMonitorCountersAMD;
+
+  PFNGLSETMULTISAMPLEFVAMDPROC __glewSetMultisamplefvAMD;
+
+  PFNGLTEXSTORAGESPARSEAMDPROC __glewTexStorageSparseAMD;
+  PFNGLTEXTURESTORAGESPARSEAMDPROC __glewTextureStorageSparseAMD;
+
+  PFNGLSTENCILOPVALUEAMDPROC __glewStencilOpValueAMD;
+
+  PFNGLTESSELLATIONFACTORAMDPROC __glewTessellationFactorAMD;
+  PFNGLTESSELLATIONMODEAMDPROC __glewTessellationModeAMD;
+
+  PFNGLBLITFRAMEBUFFERANGLEPROC __glewBlitFramebufferANGLE;
+
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC __glewRenderbufferStorageMultisampleANGLE;
+
+  PFNGLDRAWARRAYSINSTANCEDANGLEPROC __glewDrawArraysInstancedANGLE;
+  PFNGLDRAWELEMENTSINSTANCEDANGLEPROC __glewDrawElementsInstancedANGLE;
+  PFNGLVERTEXATTRIBDIVISORANGLEPROC __glewVertexAttribDivisorANGLE;
+
+  PFNGLBEGINQUERYANGLEPROC __glewBeginQueryANGLE;
+  PFNGLDELETEQUERIESANGLEPROC __glewDeleteQueriesANGLE;
+  PFNGLENDQUERYANGLEPROC __glewEndQueryANGLE;
+  PFNGLGENQUERIESANGLEPROC __glewGenQueriesANGLE;
+  PFNGLGETQUERYOBJECTI64VANGLEPROC __glewGetQueryObjecti64vANGLE;
+  PFNGLGETQUERYOBJECTIVANGLEPROC __glewGetQueryObjectivANGLE;
+  PFNGLGETQUERYOBJECTUI64VANGLEPROC __glewGetQueryObjectui64vANGLE;
+  PFNGLGETQUERYOBJECTUIVANGLEPROC __glewGetQueryObjectuivANGLE;
+  PFNGLGETQUERYIVANGLEPROC __glewGetQueryivANGLE;
+  PFNGLISQUERYANGLEPROC __glewIsQueryANGLE;
+  PFNGLQUERYCOUNTERANGLEPROC __glewQueryCounterANGLE;
+
+  PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC __glewGetTranslatedShaderSourceANGLE;
+
+  PFNGLCOPYTEXTURELEVELSAPPLEPROC __glewCopyTextureLevelsAPPLE;
+
+  PFNGLDRAWELEMENTARRAYAPPLEPROC __glewDrawElementArrayAPPLE;
+  PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC __glewDrawRangeElementArrayAPPLE;
+  PFNGLELEMENTPOINTERAPPLEPROC __glewElementPointerAPPLE;
+  PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC __glewMultiDrawElementArrayAPPLE;
+  PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC __glewMultiDrawRangeElementArrayAPPLE;
+
+  PFNGLDELETEFENCESAPPLEPROC __glewDeleteFencesAPPLE;
+  PFNGLFINISHFENCEAPPLEPROC __glewFinishFenceAPPLE;
+  PFNGLFINISHOBJECTAPPLEPROC __glewFinishObjectAPPLE;
+  PFNGLGENFENCESAPPLEPROC __glewGenFencesAPPLE;
+  PFNGLISFENCEAPPLEPROC __glewIsFenceAPPLE;
+  PFNGLSETFENCEAPPLEPROC __glewSetFenceAPPLE;
+  PFNGLTESTFENCEAPPLEPROC __glewTestFenceAPPLE;
+  PFNGLTESTOBJECTAPPLEPROC __glewTestObjectAPPLE;
+
+  PFNGLBUFFERPARAMETERIAPPLEPROC __glewBufferParameteriAPPLE;
+  PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC __glewFlushMappedBufferRangeAPPLE;
+
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEAPPLEPROC __glewRenderbufferStorageMultisampleAPPLE;
+  PFNGLRESOLVEMULTISAMPLEFRAMEBUFFERAPPLEPROC __glewResolveMultisampleFramebufferAPPLE;
+
+  PFNGLGETOBJECTPARAMETERIVAPPLEPROC __glewGetObjectParameterivAPPLE;
+  PFNGLOBJECTPURGEABLEAPPLEPROC __glewObjectPurgeableAPPLE;
+  PFNGLOBJECTUNPURGEABLEAPPLEPROC __glewObjectUnpurgeableAPPLE;
+
+  PFNGLCLIENTWAITSYNCAPPLEPROC __glewClientWaitSyncAPPLE;
+  PFNGLDELETESYNCAPPLEPROC __glewDeleteSyncAPPLE;
+  PFNGLFENCESYNCAPPLEPROC __glewFenceSyncAPPLE;
+  PFNGLGETINTEGER64VAPPLEPROC __glewGetInteger64vAPPLE;
+  PFNGLGETSYNCIVAPPLEPROC __glewGetSyncivAPPLE;
+  PFNGLISSYNCAPPLEPROC __glewIsSyncAPPLE;
+  PFNGLWAITSYNCAPPLEPROC __glewWaitSyncAPPLE;
+
+  PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC __glewGetTexParameterPointervAPPLE;
+  PFNGLTEXTURERANGEAPPLEPROC __glewTextureRangeAPPLE;
+
+  PFNGLBINDVERTEXARRAYAPPLEPROC __glewBindVertexArrayAPPLE;
+  PFNGLDELETEVERTEXARRAYSAPPLEPROC __glewDeleteVertexArraysAPPLE;
+  PFNGLGENVERTEXARRAYSAPPLEPROC __glewGenVertexArraysAPPLE;
+  PFNGLISVERTEXARRAYAPPLEPROC __glewIsVertexArrayAPPLE;
+
+  PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC __glewFlushVertexArrayRangeAPPLE;
+  PFNGLVERTEXARRAYPARAMETERIAPPLEPROC __glewVertexArrayParameteriAPPLE;
+  PFNGLVERTEXARRAYRANGEAPPLEPROC __glewVertexArrayRangeAPPLE;
+
+  PFNGLDISABLEVERTEXATTRIBAPPLEPROC __glewDisableVertexAttribAPPLE;
+  PFNGLENABLEVERTEXATTRIBAPPLEPROC __glewEnableVertexAttribAPPLE;
+  PFNGLISVERTEXATTRIBENABLEDAPPLEPROC __glewIsVertexAttribEnabledAPPLE;
+  PFNGLMAPVERTEXATTRIB1DAPPLEPROC __glewMapVertexAttrib1dAPPLE;
+  PFNGLMAPVERTEXATTRIB1FAPPLEPROC __glewMapVertexAttrib1fAPPLE;
+  PFNGLMAPVERTEXATTRIB2DAPPLEPROC __glewMapVertexAttrib2dAPPLE;
+  PFNGLMAPVERTEXATTRIB2FAPPLEPROC __glewMapVertexAttrib2fAPPLE;
+
+  PFNGLCLEARDEPTHFPROC __glewClearDepthf;
+  PFNGLDEPTHRANGEFPROC __glewDepthRangef;
+  PFNGLGETSHADERPRECISIONFORMATPROC __glewGetShaderPrecisionFormat;
+  PFNGLRELEASESHADERCOMPILERPROC __glewReleaseShaderCompiler;
+  PFNGLSHADERBINARYPROC __glewShaderBinary;
+
+  PFNGLMEMORYBARRIERBYREGIONPROC __glewMemoryBarrierByRegion;
+
+  PFNGLPRIMITIVEBOUNDINGBOXARBPROC __glewPrimitiveBoundingBoxARB;
+
+  PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC __glewDrawArraysInstancedBaseInstance;
+  PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC __glewDrawElementsInstancedBaseInstance;
+  PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC __glewDrawElementsInstancedBaseVertexBaseInstance;
+
+  PFNGLGETIMAGEHANDLEARBPROC __glewGetImageHandleARB;
+  PFNGLGETTEXTUREHANDLEARBPROC __glewGetTextureHandleARB;
+  PFNGLGETTEXTURESAMPLERHANDLEARBPROC __glewGetTextureSamplerHandleARB;
+  PFNGLGETVERTEXATTRIBLUI64VARBPROC __glewGetVertexAttribLui64vARB;
+  PFNGLISIMAGEHANDLERESIDENTARBPROC __glewIsImageHandleResidentARB;
+  PFNGLISTEXTUREHANDLERESIDENTARBPROC __glewIsTextureHandleResidentARB;
+  PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC __glewMakeImageHandleNonResidentARB;
+  PFNGLMAKEIMAGEHANDLERESIDENTARBPROC __glewMakeImageHandleResidentARB;
+  PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC __glewMakeTextureHandleNonResidentARB;
+  PFNGLMAKETEXTUREHANDLERESIDENTARBPROC __glewMakeTextureHandleResidentARB;
+  PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC __glewProgramUniformHandleui64ARB;
+  PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC __glewProgramUniformHandleui64vARB;
+  PFNGLUNIFORMHANDLEUI64ARBPROC __glewUniformHandleui64ARB;
+  PFNGLUNIFORMHANDLEUI64VARBPROC __glewUniformHandleui64vARB;
+  PFNGLVERTEXATTRIBL1UI64ARBPROC __glewVertexAttribL1ui64ARB;
+  PFNGLVERTEXATTRIBL1UI64VARBPROC __glewVertexAttribL1ui64vARB;
+
+  PFNGLBINDFRAGDATALOCATIONINDEXEDPROC __glewBindFragDataLocationIndexed;
+  PFNGLGETFRAGDATAINDEXPROC __glewGetFragDataIndex;
+
+  PFNGLBUFFERSTORAGEPROC __glewBufferStorage;
+
+  PFNGLCREATESYNCFROMCLEVENTARBPROC __glewCreateSyncFromCLeventARB;
+
+  PFNGLCLEARBUFFERDATAPROC __glewClearBufferData;
+  PFNGLCLEARBUFFERSUBDATAPROC __glewClearBufferSubData;
+  PFNGLCLEARNAMEDBUFFERDATAEXTPROC __glewClearNamedBufferDataEXT;
+  PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC __glewClearNamedBufferSubDataEXT;
+
+  PFNGLCLEARTEXIMAGEPROC __glewClearTexImage;
+  PFNGLCLEARTEXSUBIMAGEPROC __glewClearTexSubImage;
+
+  PFNGLCLIPCONTROLPROC __glewClipControl;
+
+  PFNGLCLAMPCOLORARBPROC __glewClampColorARB;
+
+  PFNGLDISPATCHCOMPUTEPROC __glewDispatchCompute;
+  PFNGLDISPATCHCOMPUTEINDIRECTPROC __glewDispatchComputeIndirect;
+
+  PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC __glewDispatchComputeGroupSizeARB;
+
+  PFNGLCOPYBUFFERSUBDATAPROC __glewCopyBufferSubData;
+
+  PFNGLCOPYIMAGESUBDATAPROC __glewCopyImageSubData;
+
+  PFNGLDEBUGMESSAGECALLBACKARBPROC __glewDebugMessageCallbackARB;
+  PFNGLDEBUGMESSAGECONTROLARBPROC __glewDebugMessageControlARB;
+  PFNGLDEBUGMESSAGEINSERTARBPROC __glewDebugMessageInsertARB;
+  PFNGLGETDEBUGMESSAGELOGARBPROC __glewGetDebugMessageLogARB;
+
+  PFNGLBINDTEXTUREUNITPROC __glewBindTextureUnit;
+  PFNGLBLITNAMEDFRAMEBUFFERPROC __glewBlitNamedFramebuffer;
+  PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC __glewCheckNamedFramebufferStatus;
+  PFNGLCLEARNAMEDBUFFERDATAPROC __glewClearNamedBufferData;
+  PFNGLCLEARNAMEDBUFFERSUBDATAPROC __glewClearNamedBufferSubData;
+  PFNGLCLEARNAMEDFRAMEBUFFERFIPROC __glewClearNamedFramebufferfi;
+  PFNGLCLEARNAMEDFRAMEBUFFERFVPROC __glewClearNamedFramebufferfv;
+  PFNGLCLEARNAMEDFRAMEBUFFERIVPROC __glewClearNamedFramebufferiv;
+  PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC __glewClearNamedFramebufferuiv;
+  PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC __glewCompressedTextureSubImage1D;
+  PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC __glewCompressedTextureSubImage2D;
+  PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC __glewCompressedTextureSubImage3D;
+  PFNGLCOPYNAMEDBUFFERSUBDATAPROC __glewCopyNamedBufferSubData;
+  PFNGLCOPYTEXTURESUBIMAGE1DPROC __glewCopyTextureSubImage1D;
+  PFNGLCOPYTEXTURESUBIMAGE2DPROC __glewCopyTextureSubImage2D;
+  PFNGLCOPYTEXTURESUBIMAGE3DPROC __glewCopyTextureSubImage3D;
+  PFNGLCREATEBUFFERSPROC __glewCreateBuffers;
+  PFNGLCREATEFRAMEBUFFERSPROC __glewCreateFramebuffers;
+  PFNGLCREATEPROGRAMPIPELINESPROC __glewCreateProgramPipelines;
+  PFNGLCREATEQUERIESPROC __glewCreateQueries;
+  PFNGLCREATERENDERBUFFERSPROC __glewCreateRenderbuffers;
+  PFNGLCREATESAMPLERSPROC __glewCreateSamplers;
+  PFNGLCREATETEXTURESPROC __glewCreateTextures;
+  PFNGLCREATETRANSFORMFEEDBACKSPROC __glewCreateTransformFeedbacks;
+  PFNGLCREATEVERTEXARRAYSPROC __glewCreateVertexArrays;
+  PFNGLDISABLEVERTEXARRAYATTRIBPROC __glewDisableVertexArrayAttrib;
+  PFNGLENABLEVERTEXARRAYATTRIBPROC __glewEnableVertexArrayAttrib;
+  PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC __glewFlushMappedNamedBufferRange;
+  PFNGLGENERATETEXTUREMIPMAPPROC __glewGenerateTextureMipmap;
+  PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC __glewGetCompressedTextureImage;
+  PFNGLGETNAMEDBUFFERPARAMETERI64VPROC __glewGetNamedBufferParameteri64v;
+  PFNGLGETNAMEDBUFFERPARAMETERIVPROC __glewGetNamedBufferParameteriv;
+  PFNGLGETNAMEDBUFFERPOINTERVPROC __glewGetNamedBufferPointerv;
+  PFNGLGETNAMEDBUFFERSUBDATAPROC __glewGetNamedBufferSubData;
+  PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC __glewGetNamedFramebufferAttachmentParameteriv;
+  PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC __glewGetNamedFramebufferParameteriv;
+  PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC __glewGetNamedRenderbufferParameteriv;
+  PFNGLGETQUERYBUFFEROBJECTI64VPROC __glewGetQueryBufferObjecti64v;
+  PFNGLGETQUERYBUFFEROBJECTIVPROC __glewGetQueryBufferObjectiv;
+  PFNGLGETQUERYBUFFEROBJECTUI64VPROC __glewGetQueryBufferObjectui64v;
+  PFNGLGETQUERYBUFFEROBJECTUIVPROC __glewGetQueryBufferObjectuiv;
+  PFNGLGETTEXTUREIMAGEPROC __glewGetTextureImage;
+  PFNGLGETTEXTURELEVELPARAMETERFVPROC __glewGetTextureLevelParameterfv;
+  PFNGLGETTEXTURELEVELPARAMETERIVPROC __glewGetTextureLevelParameteriv;
+  PFNGLGETTEXTUREPARAMETERIIVPROC __glewGetTextureParameterIiv;
+  PFNGLGETTEXTUREPARAMETERIUIVPROC __glewGetTextureParameterIuiv;
+  PFNGLGETTEXTUREPARAMETERFVPROC __glewGetTextureParameterfv;
+  PFNGLGETTEXTUREPARAMETERIVPROC __glewGetTextureParameteriv;
+  PFNGLGETTRANSFORMFEEDBACKI64_VPROC __glewGetTransformFeedbacki64_v;
+  PFNGLGETTRANSFORMFEEDBACKI_VPROC __glewGetTransformFeedbacki_v;
+  PFNGLGETTRANSFORMFEEDBACKIVPROC __glewGetTransformFeedbackiv;
+  PFNGLGETVERTEXARRAYINDEXED64IVPROC __glewGetVertexArrayIndexed64iv;
+  PFNGLGETVERTEXARRAYINDEXEDIVPROC __glewGetVertexArrayIndexediv;
+  PFNGLGETVERTEXARRAYIVPROC __glewGetVertexArrayiv;
+  PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC __glewInvalidateNamedFramebufferData;
+  PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC __glewInvalidateNamedFramebufferSubData;
+  PFNGLMAPNAMEDBUFFERPROC __glewMapNamedBuffer;
+  PFNGLMAPNAMEDBUFFERRANGEPROC __glewMapNamedBufferRange;
+  PFNGLNAMEDBUFFERDATAPROC __glewNamedBufferData;
+  PFNGLNAMEDBUFFERSTORAGEPROC __glewNamedBufferStorage;
+  PFNGLNAMEDBUFFERSUBDATAPROC __glewNamedBufferSubData;
+  PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC __glewNamedFramebufferDrawBuffer;
+  PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC __glewNamedFramebufferDrawBuffers;
+  PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC __glewNamedFramebufferParameteri;
+  PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC __glewNamedFramebufferReadBuffer;
+  PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC __glewNamedFramebufferRenderbuffer;
+  PFNGLNAMEDFRAMEBUFFERTEXTUREPROC __glewNamedFramebufferTexture;
+  PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC __glewNamedFramebufferTextureLayer;
+  PFNGLNAMEDRENDERBUFFERSTORAGEPROC __glewNamedRenderbufferStorage;
+  PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC __glewNamedRenderbufferStorageMultisample;
+  PFNGLTEXTUREBUFFERPROC __glewTextureBuffer;
+  PFNGLTEXTUREBUFFERRANGEPROC __glewTextureBufferRange;
+  PFNGLTEXTUREPARAMETERIIVPROC __glewTextureParameterIiv;
+  PFNGLTEXTUREPARAMETERIUIVPROC __glewTextureParameterIuiv;
+  PFNGLTEXTUREPARAMETERFPROC __glewTextureParameterf;
+  PFNGLTEXTUREPARAMETERFVPROC __glewTextureParameterfv;
+  PFNGLTEXTUREPARAMETERIPROC __glewTextureParameteri;
+  PFNGLTEXTUREPARAMETERIVPROC __glewTextureParameteriv;
+  PFNGLTEXTURESTORAGE1DPROC __glewTextureStorage1D;
+  PFNGLTEXTURESTORAGE2DPROC __glewTextureStorage2D;
+  PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC __glewTextureStorage2DMultisample;
+  PFNGLTEXTURESTORAGE3DPROC __glewTextureStorage3D;
+  PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC __glewTextureStorage3DMultisample;
+  PFNGLTEXTURESUBIMAGE1DPROC __glewTextureSubImage1D;
+  PFNGLTEXTURESUBIMAGE2DPROC __glewTextureSubImage2D;
+  PFNGLTEXTURESUBIMAGE3DPROC __glewTextureSubImage3D;
+  PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC __glewTransformFeedbackBufferBase;
+  PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC __glewTransformFeedbackBufferRange;
+  PFNGLUNMAPNAMEDBUFFERPROC __glewUnmapNamedBuffer;
+  PFNGLVERTEXARRAYATTRIBBINDINGPROC __glewVertexArrayAttribBinding;
+  PFNGLVERTEXARRAYATTRIBFORMATPROC __glewVertexArrayAttribFormat;
+  PFNGLVERTEXARRAYATTRIBIFORMATPROC __glewVertexArrayAttribIFormat;
+  PFNGLVERTEXARRAYATTRIBLFORMATPROC __glewVertexArrayAttribLFormat;
+  PFNGLVERTEXARRAYBINDINGDIVISORPROC __glewVertexArrayBindingDivisor;
+  PFNGLVERTEXARRAYELEMENTBUFFERPROC __glewVertexArrayElementBuffer;
+  PFNGLVERTEXARRAYVERTEXBUFFERPROC __glewVertexArrayVertexBuffer;
+  PFNGLVERTEXARRAYVERTEXBUFFERSPROC __glewVertexArrayVertexBuffers;
+
+  PFNGLDRAWBUFFERSARBPROC __glewDrawBuffersARB;
+
+  PFNGLBLENDEQUATIONSEPARATEIARBPROC __glewBlendEquationSeparateiARB;
+  PFNGLBLENDEQUATIONIARBPROC __glewBlendEquationiARB;
+  PFNGLBLENDFUNCSEPARATEIARBPROC __glewBlendFuncSeparateiARB;
+  PFNGLBLENDFUNCIARBPROC __glewBlendFunciARB;
+
+  PFNGLDRAWELEMENTSBASEVERTEXPROC __glewDrawElementsBaseVertex;
+  PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC __glewDrawElementsInstancedBaseVertex;
+  PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC __glewDrawRangeElementsBaseVertex;
+  PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC __glewMultiDrawElementsBaseVertex;
+
+  PFNGLDRAWARRAYSINDIRECTPROC __glewDrawArraysIndirect;
+  PFNGLDRAWELEMENTSINDIRECTPROC __glewDrawElementsIndirect;
+
+  PFNGLFRAMEBUFFERPARAMETERIPROC __glewFramebufferParameteri;
+  PFNGLGETFRAMEBUFFERPARAMETERIVPROC __glewGetFramebufferParameteriv;
+  PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC __glewGetNamedFramebufferParameterivEXT;
+  PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC __glewNamedFramebufferParameteriEXT;
+
+  PFNGLBINDFRAMEBUFFERPROC __glewBindFramebuffer;
+  PFNGLBINDRENDERBUFFERPROC __glewBindRenderbuffer;
+  PFNGLBLITFRAMEBUFFERPROC __glewBlitFramebuffer;
+  PFNGLCHECKFRAMEBUFFERSTATUSPROC __glewCheckFramebufferStatus;
+  PFNGLDELETEFRAMEBUFFERSPROC __glewDeleteFramebuffers;
+  PFNGLDELETERENDERBUFFERSPROC __glewDeleteRenderbuffers;
+  PFNGLFRAMEBUFFERRENDERBUFFERPROC __glewFramebufferRenderbuffer;
+  PFNGLFRAMEBUFFERTEXTURE1DPROC __glewFramebufferTexture1D;
+  PFNGLFRAMEBUFFERTEXTURE2DPROC __glewFramebufferTexture2D;
+  PFNGLFRAMEBUFFERTEXTURE3DPROC __glewFramebufferTexture3D;
+  PFNGLFRAMEBUFFERTEXTURELAYERPROC __glewFramebufferTextureLayer;
+  PFNGLGENFRAMEBUFFERSPROC __glewGenFramebuffers;
+  PFNGLGENRENDERBUFFERSPROC __glewGenRenderbuffers;
+  PFNGLGENERATEMIPMAPPROC __glewGenerateMipmap;
+  PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC __glewGetFramebufferAttachmentParameteriv;
+  PFNGLGETRENDERBUFFERPARAMETERIVPROC __glewGetRenderbufferParameteriv;
+  PFNGLISFRAMEBUFFERPROC __glewIsFramebuffer;
+  PFNGLISRENDERBUFFERPROC __glewIsRenderbuffer;
+  PFNGLRENDERBUFFERSTORAGEPROC __glewRenderbufferStorage;
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC __glewRenderbufferStorageMultisample;
+
+  PFNGLFRAMEBUFFERTEXTUREARBPROC __glewFramebufferTextureARB;
+  PFNGLFRAMEBUFFERTEXTUREFACEARBPROC __glewFramebufferTextureFaceARB;
+  PFNGLFRAMEBUFFERTEXTURELAYERARBPROC __glewFramebufferTextureLayerARB;
+  PFNGLPROGRAMPARAMETERIARBPROC __glewProgramParameteriARB;
+
+  PFNGLGETPROGRAMBINARYPROC __glewGetProgramBinary;
+  PFNGLPROGRAMBINARYPROC __glewProgramBinary;
+  PFNGLPROGRAMPARAMETERIPROC __glewProgramParameteri;
+
+  PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC __glewGetCompressedTextureSubImage;
+  PFNGLGETTEXTURESUBIMAGEPROC __glewGetTextureSubImage;
+
+  PFNGLSPECIALIZESHADERARBPROC __glewSpecializeShaderARB;
+
+  PFNGLGETUNIFORMDVPROC __glewGetUniformdv;
+  PFNGLUNIFORM1DPROC __glewUniform1d;
+  PFNGLUNIFORM1DVPROC __glewUniform1dv;
+  PFNGLUNIFORM2DPROC __glewUniform2d;
+  PFNGLUNIFORM2DVPROC __glewUniform2dv;
+  PFNGLUNIFORM3DPROC __glewUniform3d;
+  PFNGLUNIFORM3DVPROC __glewUniform3dv;
+  PFNGLUNIFORM4DPROC __glewUniform4d;
+  PFNGLUNIFORM4DVPROC __glewUniform4dv;
+  PFNGLUNIFORMMATRIX2DVPROC __glewUniformMatrix2dv;
+  PFNGLUNIFORMMATRIX2X3DVPROC __glewUniformMatrix2x3dv;
+  PFNGLUNIFORMMATRIX2X4DVPROC __glewUniformMatrix2x4dv;
+  PFNGLUNIFORMMATRIX3DVPROC __glewUniformMatrix3dv;
+  PFNGLUNIFORMMATRIX3X2DVPROC __glewUniformMatrix3x2dv;
+  PFNGLUNIFORMMATRIX3X4DVPROC __glewUniformMatrix3x4dv;
+  PFNGLUNIFORMMATRIX4DVPROC __glewUniformMatrix4dv;
+  PFNGLUNIFORMMATRIX4X2DVPROC __glewUniformMatrix4x2dv;
+  PFNGLUNIFORMMATRIX4X3DVPROC __glewUniformMatrix4x3dv;
+
+  PFNGLGETUNIFORMI64VARBPROC __glewGetUniformi64vARB;
+  PFNGLGETUNIFORMUI64VARBPROC __glewGetUniformui64vARB;
+  PFNGLGETNUNIFORMI64VARBPROC __glewGetnUniformi64vARB;
+  PFNGLGETNUNIFORMUI64VARBPROC __glewGetnUniformui64vARB;
+  PFNGLPROGRAMUNIFORM1I64ARBPROC __glewProgramUniform1i64ARB;
+  PFNGLPROGRAMUNIFORM1I64VARBPROC __glewProgramUniform1i64vARB;
+  PFNGLPROGRAMUNIFORM1UI64ARBPROC __glewProgramUniform1ui64ARB;
+  PFNGLPROGRAMUNIFORM1UI64VARBPROC __glewProgramUniform1ui64vARB;
+  PFNGLPROGRAMUNIFORM2I64ARBPROC __glewProgramUniform2i64ARB;
+  PFNGLPROGRAMUNIFORM2I64VARBPROC __glewProgramUniform2i64vARB;
+  PFNGLPROGRAMUNIFORM2UI64ARBPROC __glewProgramUniform2ui64ARB;
+  PFNGLPROGRAMUNIFORM2UI64VARBPROC __glewProgramUniform2ui64vARB;
+  PFNGLPROGRAMUNIFORM3I64ARBPROC __glewProgramUniform3i64ARB;
+  PFNGLPROGRAMUNIFORM3I64VARBPROC __glewProgramUniform3i64vARB;
+  PFNGLPROGRAMUNIFORM3UI64ARBPROC __glewProgramUniform3ui64ARB;
+  PFNGLPROGRAMUNIFORM3UI64VARBPROC __glewProgramUniform3ui64vARB;
+  PFNGLPROGRAMUNIFORM4I64ARBPROC __glewProgramUniform4i64ARB;
+  PFNGLPROGRAMUNIFORM4I64VARBPROC __glewProgramUniform4i64vARB;
+  PFNGLPROGRAMUNIFORM4UI64ARBPROC __glewProgramUniform4ui64ARB;
+  PFNGLPROGRAMUNIFORM4UI64VARBPROC __glewProgramUniform4ui64vARB;
+  PFNGLUNIFORM1I64ARBPROC __glewUniform1i64ARB;
+  PFNGLUNIFORM1I64VARBPROC __glewUniform1i64vARB;
+  PFNGLUNIFORM1UI64ARBPROC __glewUniform1ui64ARB;
+  PFNGLUNIFORM1UI64VARBPROC __glewUniform1ui64vARB;
+  PFNGLUNIFORM2I64ARBPROC __glewUniform2i64ARB;
+  PFNGLUNIFORM2I64VARBPROC __glewUniform2i64vARB;
+  PFNGLUNIFORM2UI64ARBPROC __glewUniform2ui64ARB;
+  PFNGLUNIFORM2UI64VARBPROC __glewUniform2ui64vARB;
+  PFNGLUNIFORM3I64ARBPROC __glewUniform3i64ARB;
+  PFNGLUNIFORM3I64VARBPROC __glewUniform3i64vARB;
+  PFNGLUNIFORM3UI64ARBPROC __glewUniform3ui64ARB;
+  PFNGLUNIFORM3UI64VARBPROC __glewUniform3ui64vARB;
+  PFNGLUNIFORM4I64ARBPROC __glewUniform4i64ARB;
+  PFNGLUNIFORM4I64VARBPROC __glewUniform4i64vARB;
+  PFNGLUNIFORM4UI64ARBPROC __glewUniform4ui64ARB;
+  PFNGLUNIFORM4UI64VARBPROC __glewUniform4ui64vARB;
+
+  PFNGLCOLORSUBTABLEPROC __glewColorSubTable;
+  PFNGLCOLORTABLEPROC __glewColorTable;
+  PFNGLCOLORTABLEPARAMETERFVPROC __glewColorTableParameterfv;
+  PFNGLCOLORTABLEPARAMETERIVPROC __glewColorTableParameteriv;
+  PFNGLCONVOLUTIONFILTER1DPROC __glewConvolutionFilter1D;
+  PFNGLCONVOLUTIONFILTER2DPROC __glewConvolutionFilter2D;
+  PFNGLCONVOLUTIONPARAMETERFPROC __glewConvolutionParameterf;
+  PFNGLCONVOLUTIONPARAMETERFVPROC __glewConvolutionParameterfv;
+  PFNGLCONVOLUTIONPARAMETERIPROC __glewConvolutionParameteri;
+  PFNGLCONVOLUTIONPARAMETERIVPROC __glewConvolutionParameteriv;
+  PFNGLCOPYCOLORSUBTABLEPROC __glewCopyColorSubTable;
+  PFNGLCOPYCOLORTABLEPROC __glewCopyColorTable;
+  PFNGLCOPYCONVOLUTIONFILTER1DPROC __glewCopyConvolutionFilter1D;
+  PFNGLCOPYCONVOLUTIONFILTER2DPROC __glewCopyConvolutionFilter2D;
+  PFNGLGETCOLORTABLEPROC __glewGetColorTable;
+  PFNGLGETCOLORTABLEPARAMETERFVPROC __glewGetColorTableParameterfv;
+  PFNGLGETCOLORTABLEPARAMETERIVPROC __glewGetColorTableParameteriv;
+  PFNGLGETCONVOLUTIONFILTERPROC __glewGetConvolutionFilter;
+  PFNGLGETCONVOLUTIONPARAMETERFVPROC __glewGetConvolutionParameterfv;
+  PFNGLGETCONVOLUTIONPARAMETERIVPROC __glewGetConvolutionParameteriv;
+  PFNGLGETHISTOGRAMPROC __glewGetHistogram;
+  PFNGLGETHISTOGRAMPARAMETERFVPROC __glewGetHistogramParameterfv;
+  PFNGLGETHISTOGRAMPARAMETERIVPROC __glewGetHistogramParameteriv;
+  PFNGLGETMINMAXPROC __glewGetMinmax;
+  PFNGLGETMINMAXPARAMETERFVPROC __glewGetMinmaxParameterfv;
+  PFNGLGETMINMAXPARAMETERIVPROC __glewGetMinmaxParameteriv;
+  PFNGLGETSEPARABLEFILTERPROC __glewGetSeparableFilter;
+  PFNGLHISTOGRAMPROC __glewHistogram;
+  PFNGLMINMAXPROC __glewMinmax;
+  PFNGLRESETHISTOGRAMPROC __glewResetHistogram;
+  PFNGLRESETMINMAXPROC __glewResetMinmax;
+  PFNGLSEPARABLEFILTER2DPROC __glewSeparableFilter2D;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC __glewMultiDrawArraysIndirectCountARB;
+  PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC __glewMultiDrawElementsIndirectCountARB;
+
+  PFNGLDRAWARRAYSINSTANCEDARBPROC __glewDrawArraysInstancedARB;
+  PFNGLDRAWELEMENTSINSTANCEDARBPROC __glewDrawElementsInstancedARB;
+  PFNGLVERTEXATTRIBDIVISORARBPROC __glewVertexAttribDivisorARB;
+
+  PFNGLGETINTERNALFORMATIVPROC __glewGetInternalformativ;
+
+  PFNGLGETINTERNALFORMATI64VPROC __glewGetInternalformati64v;
+
+  PFNGLINVALIDATEBUFFERDATAPROC __glewInvalidateBufferData;
+  PFNGLINVALIDATEBUFFERSUBDATAPROC __glewInvalidateBufferSubData;
+  PFNGLINVALIDATEFRAMEBUFFERPROC __glewInvalidateFramebuffer;
+  PFNGLINVALIDATESUBFRAMEBUFFERPROC __glewInvalidateSubFramebuffer;
+  PFNGLINVALIDATETEXIMAGEPROC __glewInvalidateTexImage;
+  PFNGLINVALIDATETEXSUBIMAGEPROC __glewInvalidateTexSubImage;
+
+  PFNGLFLUSHMAPPEDBUFFERRANGEPROC __glewFlushMappedBufferRange;
+  PFNGLMAPBUFFERRANGEPROC __glewMapBufferRange;
+
+  PFNGLCURRENTPALETTEMATRIXARBPROC __glewCurrentPaletteMatrixARB;
+  PFNGLMATRIXINDEXPOINTERARBPROC __glewMatrixIndexPointerARB;
+  PFNGLMATRIXINDEXUBVARBPROC __glewMatrixIndexubvARB;
+  PFNGLMATRIXINDEXUIVARBPROC __glewMatrixIndexuivARB;
+  PFNGLMATRIXINDEXUSVARBPROC __glewMatrixIndexusvARB;
+
+  PFNGLBINDBUFFERSBASEPROC __glewBindBuffersBase;
+  PFNGLBINDBUFFERSRANGEPROC __glewBindBuffersRange;
+  PFNGLBINDIMAGETEXTURESPROC __glewBindImageTextures;
+  PFNGLBINDSAMPLERSPROC __glewBindSamplers;
+  PFNGLBINDTEXTURESPROC __glewBindTextures;
+  PFNGLBINDVERTEXBUFFERSPROC __glewBindVertexBuffers;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTPROC __glewMultiDrawArraysIndirect;
+  PFNGLMULTIDRAWELEMENTSINDIRECTPROC __glewMultiDrawElementsIndirect;
+
+  PFNGLSAMPLECOVERAGEARBPROC __glewSampleCoverageARB;
+
+  PFNGLACTIVETEXTUREARBPROC __glewActiveTextureARB;
+  PFNGLCLIENTACTIVETEXTUREARBPROC __glewClientActiveTextureARB;
+  PFNGLMULTITEXCOORD1DARBPROC __glewMultiTexCoord1dARB;
+  PFNGLMULTITEXCOORD1DVARBPROC __glewMultiTexCoord1dvARB;
+  PFNGLMULTITEXCOORD1FARBPROC __glewMultiTexCoord1fARB;
+  PFNGLMULTITEXCOORD1FVARBPROC __glewMultiTexCoord1fvARB;
+  PFNGLMULTITEXCOORD1IARBPROC __glewMultiTexCoord1iARB;
+  PFNGLMULTITEXCOORD1IVARBPROC __glewMultiTexCoord1ivARB;
+  PFNGLMULTITEXCOORD1SARBPROC __glewMultiTexCoord1sARB;
+  PFNGLMULTITEXCOORD1SVARBPROC __glewMultiTexCoord1svARB;
+  PFNGLMULTITEXCOORD2DARBPROC __glewMultiTexCoord2dARB;
+  PFNGLMULTITEXCOORD2DVARBPROC __glewMultiTexCoord2dvARB;
+  PFNGLMULTITEXCOORD2FARBPROC __glewMultiTexCoord2fARB;
+  PFNGLMULTITEXCOORD2FVARBPROC __glewMultiTexCoord2fvARB;
+  PFNGLMULTITEXCOORD2IARBPROC __glewMultiTexCoord2iARB;
+  PFNGLMULTITEXCOORD2IVARBPROC __glewMultiTexCoord2ivARB;
+  PFNGLMULTITEXCOORD2SARBPROC __glewMultiTexCoord2sARB;
+  PFNGLMULTITEXCOORD2SVARBPROC __glewMultiTexCoord2svARB;
+  PFNGLMULTITEXCOORD3DARBPROC __glewMultiTexCoord3dARB;
+  PFNGLMULTITEXCOORD3DVARBPROC __glewMultiTexCoord3dvARB;
+  PFNGLMULTITEXCOORD3FARBPROC __glewMultiTexCoord3fARB;
+  PFNGLMULTITEXCOORD3FVARBPROC __glewMultiTexCoord3fvARB;
+  PFNGLMULTITEXCOORD3IARBPROC __glewMultiTexCoord3iARB;
+  PFNGLMULTITEXCOORD3IVARBPROC __glewMultiTexCoord3ivARB;
+  PFNGLMULTITEXCOORD3SARBPROC __glewMultiTexCoord3sARB;
+  PFNGLMULTITEXCOORD3SVARBPROC __glewMultiTexCoord3svARB;
+  PFNGLMULTITEXCOORD4DARBPROC __glewMultiTexCoord4dARB;
+  PFNGLMULTITEXCOORD4DVARBPROC __glewMultiTexCoord4dvARB;
+  PFNGLMULTITEXCOORD4FARBPROC __glewMultiTexCoord4fARB;
+  PFNGLMULTITEXCOORD4FVARBPROC __glewMultiTexCoord4fvARB;
+  PFNGLMULTITEXCOORD4IARBPROC __glewMultiTexCoord4iARB;
+  PFNGLMULTITEXCOORD4IVARBPROC __glewMultiTexCoord4ivARB;
+  PFNGLMULTITEXCOORD4SARBPROC __glewMultiTexCoord4sARB;
+  PFNGLMULTITEXCOORD4SVARBPROC __glewMultiTexCoord4svARB;
+
+  PFNGLBEGINQUERYARBPROC __glewBeginQueryARB;
+  PFNGLDELETEQUERIESARBPROC __glewDeleteQueriesARB;
+  PFNGLENDQUERYARBPROC __glewEndQueryARB;
+  PFNGLGENQUERIESARBPROC __glewGenQueriesARB;
+  PFNGLGETQUERYOBJECTIVARBPROC __glewGetQueryObjectivARB;
+  PFNGLGETQUERYOBJECTUIVARBPROC __glewGetQueryObjectuivARB;
+  PFNGLGETQUERYIVARBPROC __glewGetQueryivARB;
+  PFNGLISQUERYARBPROC __glewIsQueryARB;
+
+  PFNGLMAXSHADERCOMPILERTHREADSARBPROC __glewMaxShaderCompilerThreadsARB;
+
+  PFNGLPOINTPARAMETERFARBPROC __glewPointParameterfARB;
+  PFNGLPOINTPARAMETERFVARBPROC __glewPointParameterfvARB;
+
+  PFNGLPOLYGONOFFSETCLAMPPROC __glewPolygonOffsetClamp;
+
+  PFNGLGETPROGRAMINTERFACEIVPROC __glewGetProgramInterfaceiv;
+  PFNGLGETPROGRAMRESOURCEINDEXPROC __glewGetProgramResourceIndex;
+  PFNGLGETPROGRAMRESOURCELOCATIONPROC __glewGetProgramResourceLocation;
+  PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC __glewGetProgramResourceLocationIndex;
+  PFNGLGETPROGRAMRESOURCENAMEPROC __glewGetProgramResourceName;
+  PFNGLGETPROGRAMRESOURCEIVPROC __glewGetProgramResourceiv;
+
+  PFNGLPROVOKINGVERTEXPROC __glewProvokingVertex;
+
+  PFNGLGETGRAPHICSRESETSTATUSARBPROC __glewGetGraphicsResetStatusARB;
+  PFNGLGETNCOLORTABLEARBPROC __glewGetnColorTableARB;
+  PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC __glewGetnCompressedTexImageARB;
+  PFNGLGETNCONVOLUTIONFILTERARBPROC __glewGetnConvolutionFilterARB;
+  PFNGLGETNHISTOGRAMARBPROC __glewGetnHistogramARB;
+  PFNGLGETNMAPDVARBPROC __glewGetnMapdvARB;
+  PFNGLGETNMAPFVARBPROC __glewGetnMapfvARB;
+  PFNGLGETNMAPIVARBPROC __glewGetnMapivARB;
+  PFNGLGETNMINMAXARBPROC __glewGetnMinmaxARB;
+  PFNGLGETNPIXELMAPFVARBPROC __glewGetnPixelMapfvARB;
+  PFNGLGETNPIXELMAPUIVARBPROC __glewGetnPixelMapuivARB;
+  PFNGLGETNPIXELMAPUSVARBPROC __glewGetnPixelMapusvARB;
+  PFNGLGETNPOLYGONSTIPPLEARBPROC __glewGetnPolygonStippleARB;
+  PFNGLGETNSEPARABLEFILTERARBPROC __glewGetnSeparableFilterARB;
+  PFNGLGETNTEXIMAGEARBPROC __glewGetnTexImageARB;
+  PFNGLGETNUNIFORMDVARBPROC __glewGetnUniformdvARB;
+  PFNGLGETNUNIFORMFVARBPROC __glewGetnUniformfvARB;
+  PFNGLGETNUNIFORMIVARBPROC __glewGetnUniformivARB;
+  PFNGLGETNUNIFORMUIVARBPROC __glewGetnUniformuivARB;
+  PFNGLREADNPIXELSARBPROC __glewReadnPixelsARB;
+
+  PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC __glewFramebufferSampleLocationsfvARB;
+  PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC __glewNamedFramebufferSampleLocationsfvARB;
+
+  PFNGLMINSAMPLESHADINGARBPROC __glewMinSampleShadingARB;
+
+  PFNGLBINDSAMPLERPROC __glewBindSampler;
+  PFNGLDELETESAMPLERSPROC __glewDeleteSamplers;
+  PFNGLGENSAMPLERSPROC __glewGenSamplers;
+  PFNGLGETSAMPLERPARAMETERIIVPROC __glewGetSamplerParameterIiv;
+  PFNGLGETSAMPLERPARAMETERIUIVPROC __glewGetSamplerParameterIuiv;
+  PFNGLGETSAMPLERPARAMETERFVPROC __glewGetSamplerParameterfv;
+  PFNGLGETSAMPLERPARAMETERIVPROC __glewGetSamplerParameteriv;
+  PFNGLISSAMPLERPROC __glewIsSampler;
+  PFNGLSAMPLERPARAMETERIIVPROC __glewSamplerParameterIiv;
+  PFNGLSAMPLERPARAMETERIUIVPROC __glewSamplerParameterIuiv;
+  PFNGLSAMPLERPARAMETERFPROC __glewSamplerParameterf;
+  PFNGLSAMPLERPARAMETERFVPROC __glewSamplerParameterfv;
+  PFNGLSAMPLERPARAMETERIPROC __glewSamplerParameteri;
+  PFNGLSAMPLERPARAMETERIVPROC __glewSamplerParameteriv;
+
+  PFNGLACTIVESHADERPROGRAMPROC __glewActiveShaderProgram;
+  PFNGLBINDPROGRAMPIPELINEPROC __glewBindProgramPipeline;
+  PFNGLCREATESHADERPROGRAMVPROC __glewCreateShaderProgramv;
+  PFNGLDELETEPROGRAMPIPELINESPROC __glewDeleteProgramPipelines;
+  PFNGLGENPROGRAMPIPELINESPROC __glewGenProgramPipelines;
+  PFNGLGETPROGRAMPIPELINEINFOLOGPROC __glewGetProgramPipelineInfoLog;
+  PFNGLGETPROGRAMPIPELINEIVPROC __glewGetProgramPipelineiv;
+  PFNGLISPROGRAMPIPELINEPROC __glewIsProgramPipeline;
+  PFNGLPROGRAMUNIFORM1DPROC __glewProgramUniform1d;
+  PFNGLPROGRAMUNIFORM1DVPROC __glewProgramUniform1dv;
+  PFNGLPROGRAMUNIFORM1FPROC __glewProgramUniform1f;
+  PFNGLPROGRAMUNIFORM1FVPROC __glewProgramUniform1fv;
+  PFNGLPROGRAMUNIFORM1IPROC __glewProgramUniform1i;
+  PFNGLPROGRAMUNIFORM1IVPROC __glewProgramUniform1iv;
+  PFNGLPROGRAMUNIFORM1UIPROC __glewProgramUniform1ui;
+  PFNGLPROGRAMUNIFORM1UIVPROC __glewProgramUniform1uiv;
+  PFNGLPROGRAMUNIFORM2DPROC __glewProgramUniform2d;
+  PFNGLPROGRAMUNIFORM2DVPROC __glewProgramUniform2dv;
+  PFNGLPROGRAMUNIFORM2FPROC __glewProgramUniform2f;
+  PFNGLPROGRAMUNIFORM2FVPROC __glewProgramUniform2fv;
+  PFNGLPROGRAMUNIFORM2IPROC __glewProgramUniform2i;
+  PFNGLPROGRAMUNIFORM2IVPROC __glewProgramUniform2iv;
+  PFNGLPROGRAMUNIFORM2UIPROC __glewProgramUniform2ui;
+  PFNGLPROGRAMUNIFORM2UIVPROC __glewProgramUniform2uiv;
+  PFNGLPROGRAMUNIFORM3DPROC __glewProgramUniform3d;
+  PFNGLPROGRAMUNIFORM3DVPROC __glewProgramUniform3dv;
+  PFNGLPROGRAMUNIFORM3FPROC __glewProgramUniform3f;
+  PFNGLPROGRAMUNIFORM3FVPROC __glewProgramUniform3fv;
+  PFNGLPROGRAMUNIFORM3IPROC __glewProgramUniform3i;
+  PFNGLPROGRAMUNIFORM3IVPROC __glewProgramUniform3iv;
+  PFNGLPROGRAMUNIFORM3UIPROC __glewProgramUniform3ui;
+  PFNGLPROGRAMUNIFORM3UIVPROC __glewProgramUniform3uiv;
+  PFNGLPROGRAMUNIFORM4DPROC __glewProgramUniform4d;
+  PFNGLPROGRAMUNIFORM4DVPROC __glewProgramUniform4dv;
+  PFNGLPROGRAMUNIFORM4FPROC __glewProgramUniform4f;
+  PFNGLPROGRAMUNIFORM4FVPROC __glewProgramUniform4fv;
+  PFNGLPROGRAMUNIFORM4IPROC __glewProgramUniform4i;
+  PFNGLPROGRAMUNIFORM4IVPROC __glewProgramUniform4iv;
+  PFNGLPROGRAMUNIFORM4UIPROC __glewProgramUniform4ui;
+  PFNGLPROGRAMUNIFORM4UIVPROC __glewProgramUniform4uiv;
+  PFNGLPROGRAMUNIFORMMATRIX2DVPROC __glewProgramUniformMatrix2dv;
+  PFNGLPROGRAMUNIFORMMATRIX2FVPROC __glewProgramUniformMatrix2fv;
+  PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC __glewProgramUniformMatrix2x3dv;
+  PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC __glewProgramUniformMatrix2x3fv;
+  PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC __glewProgramUniformMatrix2x4dv;
+  PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC __glewProgramUniformMatrix2x4fv;
+  PFNGLPROGRAMUNIFORMMATRIX3DVPROC __glewProgramUniformMatrix3dv;
+  PFNGLPROGRAMUNIFORMMATRIX3FVPROC __glewProgramUniformMatrix3fv;
+  PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC __glewProgramUniformMatrix3x2dv;
+  PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC __glewProgramUniformMatrix3x2fv;
+  PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC __glewProgramUniformMatrix3x4dv;
+  PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC __glewProgramUniformMatrix3x4fv;
+  PFNGLPROGRAMUNIFORMMATRIX4DVPROC __glewProgramUniformMatrix4dv;
+  PFNGLPROGRAMUNIFORMMATRIX4FVPROC __glewProgramUniformMatrix4fv;
+  PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC __glewProgramUniformMatrix4x2dv;
+  PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC __glewProgramUniformMatrix4x2fv;
+  PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC __glewProgramUniformMatrix4x3dv;
+  PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC __glewProgramUniformMatrix4x3fv;
+  PFNGLUSEPROGRAMSTAGESPROC __glewUseProgramStages;
+  PFNGLVALIDATEPROGRAMPIPELINEPROC __glewValidateProgramPipeline;
+
+  PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC __glewGetActiveAtomicCounterBufferiv;
+
+  PFNGLBINDIMAGETEXTUREPROC __glewBindImageTexture;
+  PFNGLMEMORYBARRIERPROC __glewMemoryBarrier;
+
+  PFNGLATTACHOBJECTARBPROC __glewAttachObjectARB;
+  PFNGLCOMPILESHADERARBPROC __glewCompileShaderARB;
+  PFNGLCREATEPROGRAMOBJECTARBPROC __glewCreateProgramObjectARB;
+  PFNGLCREATESHADEROBJECTARBPROC __glewCreateShaderObjectARB;
+  PFNGLDELETEOBJECTARBPROC __glewDeleteObjectARB;
+  PFNGLDETACHOBJECTARBPROC __glewDetachObjectARB;
+  PFNGLGETACTIVEUNIFORMARBPROC __glewGetActiveUniformARB;
+  PFNGLGETATTACHEDOBJECTSARBPROC __glewGetAttachedObjectsARB;
+  PFNGLGETHANDLEARBPROC __glewGetHandleARB;
+  PFNGLGETINFOLOGARBPROC __glewGetInfoLogARB;
+  PFNGLGETOBJECTPARAMETERFVARBPROC __glewGetObjectParameterfvARB;
+  PFNGLGETOBJECTPARAMETERIVARBPROC __glewGetObjectParameterivARB;
+  PFNGLGETSHADERSOURCEARBPROC __glewGetShaderSourceARB;
+  PFNGLGETUNIFORMLOCATIONARBPROC __glewGetUniformLocationARB;
+  PFNGLGETUNIFORMFVARBPROC __glewGetUniformfvARB;
+  PFNGLGETUNIFORMIVARBPROC __glewGetUniformivARB;
+  PFNGLLINKPROGRAMARBPROC __glewLinkProgramARB;
+  PFNGLSHADERSOURCEARBPROC __glewShaderSourceARB;
+  PFNGLUNIFORM1FARBPROC __glewUniform1fARB;
+  PFNGLUNIFORM1FVARBPROC __glewUniform1fvARB;
+  PFNGLUNIFORM1IARBPROC __glewUniform1iARB;
+  PFNGLUNIFORM1IVARBPROC __glewUniform1ivARB;
+  PFNGLUNIFORM2FARBPROC __glewUniform2fARB;
+  PFNGLUNIFORM2FVARBPROC __glewUniform2fvARB;
+  PFNGLUNIFORM2IARBPROC __glewUniform2iARB;
+  PFNGLUNIFORM2IVARBPROC __glewUniform2ivARB;
+  PFNGLUNIFORM3FARBPROC __glewUniform3fARB;
+  PFNGLUNIFORM3FVARBPROC __glewUniform3fvARB;
+  PFNGLUNIFORM3IARBPROC __glewUniform3iARB;
+  PFNGLUNIFORM3IVARBPROC __glewUniform3ivARB;
+  PFNGLUNIFORM4FARBPROC __glewUniform4fARB;
+  PFNGLUNIFORM4FVARBPROC __glewUniform4fvARB;
+  PFNGLUNIFORM4IARBPROC __glewUniform4iARB;
+  PFNGLUNIFORM4IVARBPROC __glewUniform4ivARB;
+  PFNGLUNIFORMMATRIX2FVARBPROC __glewUniformMatrix2fvARB;
+  PFNGLUNIFORMMATRIX3FVARBPROC __glewUniformMatrix3fvARB;
+  PFNGLUNIFORMMATRIX4FVARBPROC __glewUniformMatrix4fvARB;
+  PFNGLUSEPROGRAMOBJECTARBPROC __glewUseProgramObjectARB;
+  PFNGLVALIDATEPROGRAMARBPROC __glewValidateProgramARB;
+
+  PFNGLSHADERSTORAGEBLOCKBINDINGPROC __glewShaderStorageBlockBinding;
+
+  PFNGLGETACTIVESUBROUTINENAMEPROC __glewGetActiveSubroutineName;
+  PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC __glewGetActiveSubroutineUniformName;
+  PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC __glewGetActiveSubroutineUniformiv;
+  PFNGLGETPROGRAMSTAGEIVPROC __glewGetProgramStageiv;
+  PFNGLGETSUBROUTINEINDEXPROC __glewGetSubroutineIndex;
+  PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC __glewGetSubroutineUniformLocation;
+  PFNGLGETUNIFORMSUBROUTINEUIVPROC __glewGetUniformSubroutineuiv;
+  PFNGLUNIFORMSUBROUTINESUIVPROC __glewUniformSubroutinesuiv;
+
+  PFNGLCOMPILESHADERINCLUDEARBPROC __glewCompileShaderIncludeARB;
+  PFNGLDELETENAMEDSTRINGARBPROC __glewDeleteNamedStringARB;
+  PFNGLGETNAMEDSTRINGARBPROC __glewGetNamedStringARB;
+  PFNGLGETNAMEDSTRINGIVARBPROC __glewGetNamedStringivARB;
+  PFNGLISNAMEDSTRINGARBPROC __glewIsNamedStringARB;
+  PFNGLNAMEDSTRINGARBPROC __glewNamedStringARB;
+
+  PFNGLBUFFERPAGECOMMITMENTARBPROC __glewBufferPageCommitmentARB;
+
+  PFNGLTEXPAGECOMMITMENTARBPROC __glewTexPageCommitmentARB;
+
+  PFNGLCLIENTWAITSYNCPROC __glewClientWaitSync;
+  PFNGLDELETESYNCPROC __glewDeleteSync;
+  PFNGLFENCESYNCPROC __glewFenceSync;
+  PFNGLGETINTEGER64VPROC __glewGetInteger64v;
+  PFNGLGETSYNCIVPROC __glewGetSynciv;
+  PFNGLISSYNCPROC __glewIsSync;
+  PFNGLWAITSYNCPROC __glewWaitSync;
+
+  PFNGLPATCHPARAMETERFVPROC __glewPatchParameterfv;
+  PFNGLPATCHPARAMETERIPROC __glewPatchParameteri;
+
+  PFNGLTEXTUREBARRIERPROC __glewTextureBarrier;
+
+  PFNGLTEXBUFFERARBPROC __glewTexBufferARB;
+
+  PFNGLTEXBUFFERRANGEPROC __glewTexBufferRange;
+  PFNGLTEXTUREBUFFERRANGEEXTPROC __glewTextureBufferRangeEXT;
+
+  PFNGLCOMPRESSEDTEXIMAGE1DARBPROC __glewCompressedTexImage1DARB;
+  PFNGLCOMPRESSEDTEXIMAGE2DARBPROC __glewCompressedTexImage2DARB;
+  PFNGLCOMPRESSEDTEXIMAGE3DARBPROC __glewCompressedTexImage3DARB;
+  PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC __glewCompressedTexSubImage1DARB;
+  PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC __glewCompressedTexSubImage2DARB;
+  PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC __glewCompressedTexSubImage3DARB;
+  PFNGLGETCOMPRESSEDTEXIMAGEARBPROC __glewGetCompressedTexImageARB;
+
+  PFNGLGETMULTISAMPLEFVPROC __glewGetMultisamplefv;
+  PFNGLSAMPLEMASKIPROC __glewSampleMaski;
+  PFNGLTEXIMAGE2DMULTISAMPLEPROC __glewTexImage2DMultisample;
+  PFNGLTEXIMAGE3DMULTISAMPLEPROC __glewTexImage3DMultisample;
+
+  PFNGLTEXSTORAGE1DPROC __glewTexStorage1D;
+  PFNGLTEXSTORAGE2DPROC __glewTexStorage2D;
+  PFNGLTEXSTORAGE3DPROC __glewTexStorage3D;
+
+  PFNGLTEXSTORAGE2DMULTISAMPLEPROC __glewTexStorage2DMultisample;
+  PFNGLTEXSTORAGE3DMULTISAMPLEPROC __glewTexStorage3DMultisample;
+  PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC __glewTextureStorage2DMultisampleEXT;
+  PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC __glewTextureStorage3DMultisampleEXT;
+
+  PFNGLTEXTUREVIEWPROC __glewTextureView;
+
+  PFNGLGETQUERYOBJECTI64VPROC __glewGetQueryObjecti64v;
+  PFNGLGETQUERYOBJECTUI64VPROC __glewGetQueryObjectui64v;
+  PFNGLQUERYCOUNTERPROC __glewQueryCounter;
+
+  PFNGLBINDTRANSFORMFEEDBACKPROC __glewBindTransformFeedback;
+  PFNGLDELETETRANSFORMFEEDBACKSPROC __glewDeleteTransformFeedbacks;
+  PFNGLDRAWTRANSFORMFEEDBACKPROC __glewDrawTransformFeedback;
+  PFNGLGENTRANSFORMFEEDBACKSPROC __glewGenTransformFeedbacks;
+  PFNGLISTRANSFORMFEEDBACKPROC __glewIsTransformFeedback;
+  PFNGLPAUSETRANSFORMFEEDBACKPROC __glewPauseTransformFeedback;
+  PFNGLRESUMETRANSFORMFEEDBACKPROC __glewResumeTransformFeedback;
+
+  PFNGLBEGINQUERYINDEXEDPROC __glewBeginQueryIndexed;
+  PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC __glewDrawTransformFeedbackStream;
+  PFNGLENDQUERYINDEXEDPROC __glewEndQueryIndexed;
+  PFNGLGETQUERYINDEXEDIVPROC __glewGetQueryIndexediv;
+
+  PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC __glewDrawTransformFeedbackInstanced;
+  PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC __glewDrawTransformFeedbackStreamInstanced;
+
+  PFNGLLOADTRANSPOSEMATRIXDARBPROC __glewLoadTransposeMatrixdARB;
+  PFNGLLOADTRANSPOSEMATRIXFARBPROC __glewLoadTransposeMatrixfARB;
+  PFNGLMULTTRANSPOSEMATRIXDARBPROC __glewMultTransposeMatrixdARB;
+  PFNGLMULTTRANSPOSEMATRIXFARBPROC __glewMultTransposeMatrixfARB;
+
+  PFNGLBINDBUFFERBASEPROC __glewBindBufferBase;
+  PFNGLBINDBUFFERRANGEPROC __glewBindBufferRange;
+  PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC __glewGetActiveUniformBlockName;
+  PFNGLGETACTIVEUNIFORMBLOCKIVPROC __glewGetActiveUniformBlockiv;
+  PFNGLGETACTIVEUNIFORMNAMEPROC __glewGetActiveUniformName;
+  PFNGLGETACTIVEUNIFORMSIVPROC __glewGetActiveUniformsiv;
+  PFNGLGETINTEGERI_VPROC __glewGetIntegeri_v;
+  PFNGLGETUNIFORMBLOCKINDEXPROC __glewGetUniformBlockIndex;
+  PFNGLGETUNIFORMINDICESPROC __glewGetUniformIndices;
+  PFNGLUNIFORMBLOCKBINDINGPROC __glewUniformBlockBinding;
+
+  PFNGLBINDVERTEXARRAYPROC __glewBindVertexArray;
+  PFNGLDELETEVERTEXARRAYSPROC __glewDeleteVertexArrays;
+  PFNGLGENVERTEXARRAYSPROC __glewGenVertexArrays;
+  PFNGLISVERTEXARRAYPROC __glewIsVertexArray;
+
+  PFNGLGETVERTEXATTRIBLDVPROC __glewGetVertexAttribLdv;
+  PFNGLVERTEXATTRIBL1DPROC __glewVertexAttribL1d;
+  PFNGLVERTEXATTRIBL1DVPROC __glewVertexAttribL1dv;
+  PFNGLVERTEXATTRIBL2DPROC __glewVertexAttribL2d;
+  PFNGLVERTEXATTRIBL2DVPROC __glewVertexAttribL2dv;
+  PFNGLVERTEXATTRIBL3DPROC __glewVertexAttribL3d;
+  PFNGLVERTEXATTRIBL3DVPROC __glewVertexAttribL3dv;
+  PFNGLVERTEXATTRIBL4DPROC __glewVertexAttribL4d;
+  PFNGLVERTEXATTRIBL4DVPROC __glewVertexAttribL4dv;
+  PFNGLVERTEXATTRIBLPOINTERPROC __glewVertexAttribLPointer;
+
+  PFNGLBINDVERTEXBUFFERPROC __glewBindVertexBuffer;
+  PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC __glewVertexArrayBindVertexBufferEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC __glewVertexArrayVertexAttribBindingEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC __glewVertexArrayVertexAttribFormatEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC __glewVertexArrayVertexAttribIFormatEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC __glewVertexArrayVertexAttribLFormatEXT;
+  PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC __glewVertexArrayVertexBindingDivisorEXT;
+  PFNGLVERTEXATTRIBBINDINGPROC __glewVertexAttribBinding;
+  PFNGLVERTEXATTRIBFORMATPROC __glewVertexAttribFormat;
+  PFNGLVERTEXATTRIBIFORMATPROC __glewVertexAttribIFormat;
+  PFNGLVERTEXATTRIBLFORMATPROC __glewVertexAttribLFormat;
+  PFNGLVERTEXBINDINGDIVISORPROC __glewVertexBindingDivisor;
+
+  PFNGLVERTEXBLENDARBPROC __glewVertexBlendARB;
+  PFNGLWEIGHTPOINTERARBPROC __glewWeightPointerARB;
+  PFNGLWEIGHTBVARBPROC __glewWeightbvARB;
+  PFNGLWEIGHTDVARBPROC __glewWeightdvARB;
+  PFNGLWEIGHTFVARBPROC __glewWeightfvARB;
+  PFNGLWEIGHTIVARBPROC __glewWeightivARB;
+  PFNGLWEIGHTSVARBPROC __glewWeightsvARB;
+  PFNGLWEIGHTUBVARBPROC __glewWeightubvARB;
+  PFNGLWEIGHTUIVARBPROC __glewWeightuivARB;
+  PFNGLWEIGHTUSVARBPROC __glewWeightusvARB;
+
+  PFNGLBINDBUFFERARBPROC __glewBindBufferARB;
+  PFNGLBUFFERDATAARBPROC __glewBufferDataARB;
+  PFNGLBUFFERSUBDATAARBPROC __glewBufferSubDataARB;
+  PFNGLDELETEBUFFERSARBPROC __glewDeleteBuffersARB;
+  PFNGLGENBUFFERSARBPROC __glewGenBuffersARB;
+  PFNGLGETBUFFERPARAMETERIVARBPROC __glewGetBufferParameterivARB;
+  PFNGLGETBUFFERPOINTERVARBPROC __glewGetBufferPointervARB;
+  PFNGLGETBUFFERSUBDATAARBPROC __glewGetBufferSubDataARB;
+  PFNGLISBUFFERARBPROC __glewIsBufferARB;
+  PFNGLMAPBUFFERARBPROC __glewMapBufferARB;
+  PFNGLUNMAPBUFFERARBPROC __glewUnmapBufferARB;
+
+  PFNGLBINDPROGRAMARBPROC __glewBindProgramARB;
+  PFNGLDELETEPROGRAMSARBPROC __glewDeleteProgramsARB;
+  PFNGLDISABLEVERTEXATTRIBARRAYARBPROC __glewDisableVertexAttribArrayARB;
+  PFNGLENABLEVERTEXATTRIBARRAYARBPROC __glewEnableVertexAttribArrayARB;
+  PFNGLGENPROGRAMSARBPROC __glewGenProgramsARB;
+  PFNGLGETPROGRAMENVPARAMETERDVARBPROC __glewGetProgramEnvParameterdvARB;
+  PFNGLGETPROGRAMENVPARAMETERFVARBPROC __glewGetProgramEnvParameterfvARB;
+  PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC __glewGetProgramLocalParameterdvARB;
+  PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC __glewGetProgramLocalParameterfvARB;
+  PFNGLGETPROGRAMSTRINGARBPROC __glewGetProgramStringARB;
+  PFNGLGETPROGRAMIVARBPROC __glewGetProgramivARB;
+  PFNGLGETVERTEXATTRIBPOINTERVARBPROC __glewGetVertexAttribPointervARB;
+  PFNGLGETVERTEXATTRIBDVARBPROC __glewGetVertexAttribdvARB;
+  PFNGLGETVERTEXATTRIBFVARBPROC __glewGetVertexAttribfvARB;
+  PFNGLGETVERTEXATTRIBIVARBPROC __glewGetVertexAttribivARB;
+  PFNGLISPROGRAMARBPROC __glewIsProgramARB;
+  PFNGLPROGRAMENVPARAMETER4DARBPROC __glewProgramEnvParameter4dARB;
+  PFNGLPROGRAMENVPARAMETER4DVARBPROC __glewProgramEnvParameter4dvARB;
+  PFNGLPROGRAMENVPARAMETER4FARBPROC __glewProgramEnvParameter4fARB;
+  PFNGLPROGRAMENVPARAMETER4FVARBPROC __glewProgramEnvParameter4fvARB;
+  PFNGLPROGRAMLOCALPARAMETER4DARBPROC __glewProgramLocalParameter4dARB;
+  PFNGLPROGRAMLOCALPARAMETER4DVARBPROC __glewProgramLocalParameter4dvARB;
+  PFNGLPROGRAMLOCALPARAMETER4FARBPROC __glewProgramLocalParameter4fARB;
+  PFNGLPROGRAMLOCALPARAMETER4FVARBPROC __glewProgramLocalParameter4fvARB;
+  PFNGLPROGRAMSTRINGARBPROC __glewProgramStringARB;
+  PFNGLVERTEXATTRIB1DARBPROC __glewVertexAttrib1dARB;
+  PFNGLVERTEXATTRIB1DVARBPROC __glewVertexAttrib1dvARB;
+  PFNGLVERTEXATTRIB1FARBPROC __glewVertexAttrib1fARB;
+  PFNGLVERTEXATTRIB1FVARBPROC __glewVertexAttrib1fvARB;
+  PFNGLVERTEXATTRIB1SARBPROC __glewVertexAttrib1sARB;
+  PFNGLVERTEXATTRIB1SVARBPROC __glewVertexAttrib1svARB;
+  PFNGLVERTEXATTRIB2DARBPROC __glewVertexAttrib2dARB;
+  PFNGLVERTEXATTRIB2DVARBPROC __glewVertexAttrib2dvARB;
+  PFNGLVERTEXATTRIB2FARBPROC __glewVertexAttrib2fARB;
+  PFNGLVERTEXATTRIB2FVARBPROC __glewVertexAttrib2fvARB;
+  PFNGLVERTEXATTRIB2SARBPROC __glewVertexAttrib2sARB;
+  PFNGLVERTEXATTRIB2SVARBPROC __glewVertexAttrib2svARB;
+  PFNGLVERTEXATTRIB3DARBPROC __glewVertexAttrib3dARB;
+  PFNGLVERTEXATTRIB3DVARBPROC __glewVertexAttrib3dvARB;
+  PFNGLVERTEXATTRIB3FARBPROC __glewVertexAttrib3fARB;
+  PFNGLVERTEXATTRIB3FVARBPROC __glewVertexAttrib3fvARB;
+  PFNGLVERTEXATTRIB3SARBPROC __glewVertexAttrib3sARB;
+  PFNGLVERTEXATTRIB3SVARBPROC __glewVertexAttrib3svARB;
+  PFNGLVERTEXATTRIB4NBVARBPROC __glewVertexAttrib4NbvARB;
+  PFNGLVERTEXATTRIB4NIVARBPROC __glewVertexAttrib4NivARB;
+  PFNGLVERTEXATTRIB4NSVARBPROC __glewVertexAttrib4NsvARB;
+  PFNGLVERTEXATTRIB4NUBARBPROC __glewVertexAttrib4NubARB;
+  PFNGLVERTEXATTRIB4NUBVARBPROC __glewVertexAttrib4NubvARB;
+  PFNGLVERTEXATTRIB4NUIVARBPROC __glewVertexAttrib4NuivARB;
+  PFNGLVERTEXATTRIB4NUSVARBPROC __glewVertexAttrib4NusvARB;
+  PFNGLVERTEXATTRIB4BVARBPROC __glewVertexAttrib4bvARB;
+  PFNGLVERTEXATTRIB4DARBPROC __glewVertexAttrib4dARB;
+  PFNGLVERTEXATTRIB4DVARBPROC __glewVertexAttrib4dvARB;
+  PFNGLVERTEXATTRIB4FARBPROC __glewVertexAttrib4fARB;
+  PFNGLVERTEXATTRIB4FVARBPROC __glewVertexAttrib4fvARB;
+  PFNGLVERTEXATTRIB4IVARBPROC __glewVertexAttrib4ivARB;
+  PFNGLVERTEXATTRIB4SARBPROC __glewVertexAttrib4sARB;
+  PFNGLVERTEXATTRIB4SVARBPROC __glewVertexAttrib4svARB;
+  PFNGLVERTEXATTRIB4UBVARBPROC __glewVertexAttrib4ubvARB;
+  PFNGLVERTEXATTRIB4UIVARBPROC __glewVertexAttrib4uivARB;
+  PFNGLVERTEXATTRIB4USVARBPROC __glewVertexAttrib4usvARB;
+  PFNGLVERTEXATTRIBPOINTERARBPROC __glewVertexAttribPointerARB;
+
+  PFNGLBINDATTRIBLOCATIONARBPROC __glewBindAttribLocationARB;
+  PFNGLGETACTIVEATTRIBARBPROC __glewGetActiveAttribARB;
+  PFNGLGETATTRIBLOCATIONARBPROC __glewGetAttribLocationARB;
+
+  PFNGLCOLORP3UIPROC __glewColorP3ui;
+  PFNGLCOLORP3UIVPROC __glewColorP3uiv;
+  PFNGLCOLORP4UIPROC __glewColorP4ui;
+  PFNGLCOLORP4UIVPROC __glewColorP4uiv;
+  PFNGLMULTITEXCOORDP1UIPROC __glewMultiTexCoordP1ui;
+  PFNGLMULTITEXCOORDP1UIVPROC __glewMultiTexCoordP1uiv;
+  PFNGLMULTITEXCOORDP2UIPROC __glewMultiTexCoordP2ui;
+  PFNGLMULTITEXCOORDP2UIVPROC __glewMultiTexCoordP2uiv;
+  PFNGLMULTITEXCOORDP3UIPROC __glewMultiTexCoordP3ui;
+  PFNGLMULTITEXCOORDP3UIVPROC __glewMultiTexCoordP3uiv;
+  PFNGLMULTITEXCOORDP4UIPROC __glewMultiTexCoordP4ui;
+  PFNGLMULTITEXCOORDP4UIVPROC __glewMultiTexCoordP4uiv;
+  PFNGLNORMALP3UIPROC __glewNormalP3ui;
+  PFNGLNORMALP3UIVPROC __glewNormalP3uiv;
+  PFNGLSECONDARYCOLORP3UIPROC __glewSecondaryColorP3ui;
+  PFNGLSECONDARYCOLORP3UIVPROC __glewSecondaryColorP3uiv;
+  PFNGLTEXCOORDP1UIPROC __glewTexCoordP1ui;
+  PFNGLTEXCOORDP1UIVPROC __glewTexCoordP1uiv;
+  PFNGLTEXCOORDP2UIPROC __glewTexCoordP2ui;
+  PFNGLTEXCOORDP2UIVPROC __glewTexCoordP2uiv;
+  PFNGLTEXCOORDP3UIPROC __glewTexCoordP3ui;
+  PFNGLTEXCOORDP3UIVPROC __glewTexCoordP3uiv;
+  PFNGLTEXCOORDP4UIPROC __glewTexCoordP4ui;
+  PFNGLTEXCOORDP4UIVPROC __glewTexCoordP4uiv;
+  PFNGLVERTEXATTRIBP1UIPROC __glewVertexAttribP1ui;
+  PFNGLVERTEXATTRIBP1UIVPROC __glewVertexAttribP1uiv;
+  PFNGLVERTEXATTRIBP2UIPROC __glewVertexAttribP2ui;
+  PFNGLVERTEXATTRIBP2UIVPROC __glewVertexAttribP2uiv;
+  PFNGLVERTEXATTRIBP3UIPROC __glewVertexAttribP3ui;
+  PFNGLVERTEXATTRIBP3UIVPROC __glewVertexAttribP3uiv;
+  PFNGLVERTEXATTRIBP4UIPROC __glewVertexAttribP4ui;
+  PFNGLVERTEXATTRIBP4UIVPROC __glewVertexAttribP4uiv;
+  PFNGLVERTEXP2UIPROC __glewVertexP2ui;
+  PFNGLVERTEXP2UIVPROC __glewVertexP2uiv;
+  PFNGLVERTEXP3UIPROC __glewVertexP3ui;
+  PFNGLVERTEXP3UIVPROC __glewVertexP3uiv;
+  PFNGLVERTEXP4UIPROC __glewVertexP4ui;
+  PFNGLVERTEXP4UIVPROC __glewVertexP4uiv;
+
+  PFNGLDEPTHRANGEARRAYVPROC __glewDepthRangeArrayv;
+  PFNGLDEPTHRANGEINDEXEDPROC __glewDepthRangeIndexed;
+  PFNGLGETDOUBLEI_VPROC __glewGetDoublei_v;
+  PFNGLGETFLOATI_VPROC __glewGetFloati_v;
+  PFNGLSCISSORARRAYVPROC __glewScissorArrayv;
+  PFNGLSCISSORINDEXEDPROC __glewScissorIndexed;
+  PFNGLSCISSORINDEXEDVPROC __glewScissorIndexedv;
+  PFNGLVIEWPORTARRAYVPROC __glewViewportArrayv;
+  PFNGLVIEWPORTINDEXEDFPROC __glewViewportIndexedf;
+  PFNGLVIEWPORTINDEXEDFVPROC __glewViewportIndexedfv;
+
+  PFNGLWINDOWPOS2DARBPROC __glewWindowPos2dARB;
+  PFNGLWINDOWPOS2DVARBPROC __glewWindowPos2dvARB;
+  PFNGLWINDOWPOS2FARBPROC __glewWindowPos2fARB;
+  PFNGLWINDOWPOS2FVARBPROC __glewWindowPos2fvARB;
+  PFNGLWINDOWPOS2IARBPROC __glewWindowPos2iARB;
+  PFNGLWINDOWPOS2IVARBPROC __glewWindowPos2ivARB;
+  PFNGLWINDOWPOS2SARBPROC __glewWindowPos2sARB;
+  PFNGLWINDOWPOS2SVARBPROC __glewWindowPos2svARB;
+  PFNGLWINDOWPOS3DARBPROC __glewWindowPos3dARB;
+  PFNGLWINDOWPOS3DVARBPROC __glewWindowPos3dvARB;
+  PFNGLWINDOWPOS3FARBPROC __glewWindowPos3fARB;
+  PFNGLWINDOWPOS3FVARBPROC __glewWindowPos3fvARB;
+  PFNGLWINDOWPOS3IARBPROC __glewWindowPos3iARB;
+  PFNGLWINDOWPOS3IVARBPROC __glewWindowPos3ivARB;
+  PFNGLWINDOWPOS3SARBPROC __glewWindowPos3sARB;
+  PFNGLWINDOWPOS3SVARBPROC __glewWindowPos3svARB;
+
+  PFNGLDRAWBUFFERSATIPROC __glewDrawBuffersATI;
+
+  PFNGLDRAWELEMENTARRAYATIPROC __glewDrawElementArrayATI;
+  PFNGLDRAWRANGEELEMENTARRAYATIPROC __glewDrawRangeElementArrayATI;
+  PFNGLELEMENTPOINTERATIPROC __glewElementPointerATI;
+
+  PFNGLGETTEXBUMPPARAMETERFVATIPROC __glewGetTexBumpParameterfvATI;
+  PFNGLGETTEXBUMPPARAMETERIVATIPROC __glewGetTexBumpParameterivATI;
+  PFNGLTEXBUMPPARAMETERFVATIPROC __glewTexBumpParameterfvATI;
+  PFNGLTEXBUMPPARAMETERIVATIPROC __glewTexBumpParameterivATI;
+
+  PFNGLALPHAFRAGMENTOP1ATIPROC __glewAlphaFragmentOp1ATI;
+  PFNGLALPHAFRAGMENTOP2ATIPROC __glewAlphaFragmentOp2ATI;
+  PFNGLALPHAFRAGMENTOP3ATIPROC __glewAlphaFragmentOp3ATI;
+  PFNGLBEGINFRAGMENTSHADERATIPROC __glewBeginFragmentShaderATI;
+  PFNGLBINDFRAGMENTSHADERATIPROC __glewBindFragmentShaderATI;
+  PFNGLCOLORFRAGMENTOP1ATIPROC __glewColorFragmentOp1ATI;
+  PFNGLCOLORFRAGMENTOP2ATIPROC __glewColorFragmentOp2ATI;
+  PFNGLCOLORFRAGMENTOP3ATIPROC __glewColorFragmentOp3ATI;
+  PFNGLDELETEFRAGMENTSHADERATIPROC __glewDeleteFragmentShaderATI;
+  PFNGLENDFRAGMENTSHADERATIPROC __glewEndFragmentShaderATI;
+  PFNGLGENFRAGMENTSHADERSATIPROC __glewGenFragmentShadersATI;
+  PFNGLPASSTEXCOORDATIPROC __glewPassTexCoordATI;
+  PFNGLSAMPLEMAPATIPROC __glewSampleMapATI;
+  PFNGLSETFRAGMENTSHADERCONSTANTATIPROC __glewSetFragmentShaderConstantATI;
+
+  PFNGLMAPOBJECTBUFFERATIPROC __glewMapObjectBufferATI;
+  PFNGLUNMAPOBJECTBUFFERATIPROC __glewUnmapObjectBufferATI;
+
+  PFNGLPNTRIANGLESFATIPROC __glewPNTrianglesfATI;
+  PFNGLPNTRIANGLESIATIPROC __glewPNTrianglesiATI;
+
+  PFNGLSTENCILFUNCSEPARATEATIPROC __glewStencilFuncSeparateATI;
+  PFNGLSTENCILOPSEPARATEATIPROC __glewStencilOpSeparateATI;
+
+  PFNGLARRAYOBJECTATIPROC __glewArrayObjectATI;
+  PFNGLFREEOBJECTBUFFERATIPROC __glewFreeObjectBufferATI;
+  PFNGLGETARRAYOBJECTFVATIPROC __glewGetArrayObjectfvATI;
+  PFNGLGETARRAYOBJECTIVATIPROC __glewGetArrayObjectivATI;
+  PFNGLGETOBJECTBUFFERFVATIPROC __glewGetObjectBufferfvATI;
+  PFNGLGETOBJECTBUFFERIVATIPROC __glewGetObjectBufferivATI;
+  PFNGLGETVARIANTARRAYOBJECTFVATIPROC __glewGetVariantArrayObjectfvATI;
+  PFNGLGETVARIANTARRAYOBJECTIVATIPROC __glewGetVariantArrayObjectivATI;
+  PFNGLISOBJECTBUFFERATIPROC __glewIsObjectBufferATI;
+  PFNGLNEWOBJECTBUFFERATIPROC __glewNewObjectBufferATI;
+  PFNGLUPDATEOBJECTBUFFERATIPROC __glewUpdateObjectBufferATI;
+  PFNGLVARIANTARRAYOBJECTATIPROC __glewVariantArrayObjectATI;
+
+  PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC __glewGetVertexAttribArrayObjectfvATI;
+  PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC __glewGetVertexAttribArrayObjectivATI;
+  PFNGLVERTEXATTRIBARRAYOBJECTATIPROC __glewVertexAttribArrayObjectATI;
+
+  PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC __glewClientActiveVertexStreamATI;
+  PFNGLNORMALSTREAM3BATIPROC __glewNormalStream3bATI;
+  PFNGLNORMALSTREAM3BVATIPROC __glewNormalStream3bvATI;
+  PFNGLNORMALSTREAM3DATIPROC __glewNormalStream3dATI;
+  PFNGLNORMALSTREAM3DVATIPROC __glewNormalStream3dvATI;
+  PFNGLNORMALSTREAM3FATIPROC __glewNormalStream3fATI;
+  PFNGLNORMALSTREAM3FVATIPROC __glewNormalStream3fvATI;
+  PFNGLNORMALSTREAM3IATIPROC __glewNormalStream3iATI;
+  PFNGLNORMALSTREAM3IVATIPROC __glewNormalStream3ivATI;
+  PFNGLNORMALSTREAM3SATIPROC __glewNormalStream3sATI;
+  PFNGLNORMALSTREAM3SVATIPROC __glewNormalStream3svATI;
+  PFNGLVERTEXBLENDENVFATIPROC __glewVertexBlendEnvfATI;
+  PFNGLVERTEXBLENDENVIATIPROC __glewVertexBlendEnviATI;
+  PFNGLVERTEXSTREAM1DATIPROC __glewVertexStream1dATI;
+  PFNGLVERTEXSTREAM1DVATIPROC __glewVertexStream1dvATI;
+  PFNGLVERTEXSTREAM1FATIPROC __glewVertexStream1fATI;
+  PFNGLVERTEXSTREAM1FVATIPROC __glewVertexStream1fvATI;
+  PFNGLVERTEXSTREAM1IATIPROC __glewVertexStream1iATI;
+  PFNGLVERTEXSTREAM1IVATIPROC __glewVertexStream1ivATI;
+  PFNGLVERTEXSTREAM1SATIPROC __glewVertexStream1sATI;
+  PFNGLVERTEXSTREAM1SVATIPROC __glewVertexStream1svATI;
+  PFNGLVERTEXSTREAM2DATIPROC __glewVertexStream2dATI;
+  PFNGLVERTEXSTREAM2DVATIPROC __glewVertexStream2dvATI;
+  PFNGLVERTEXSTREAM2FATIPROC __glewVertexStream2fATI;
+  PFNGLVERTEXSTREAM2FVATIPROC __glewVertexStream2fvATI;
+  PFNGLVERTEXSTREAM2IATIPROC __glewVertexStream2iATI;
+  PFNGLVERTEXSTREAM2IVATIPROC __glewVertexStream2ivATI;
+  PFNGLVERTEXSTREAM2SATIPROC __glewVertexStream2sATI;
+  PFNGLVERTEXSTREAM2SVATIPROC __glewVertexStream2svATI;
+  PFNGLVERTEXSTREAM3DATIPROC __glewVertexStream3dATI;
+  PFNGLVERTEXSTREAM3DVATIPROC __glewVertexStream3dvATI;
+  PFNGLVERTEXSTREAM3FATIPROC __glewVertexStream3fATI;
+  PFNGLVERTEXSTREAM3FVATIPROC __glewVertexStream3fvATI;
+  PFNGLVERTEXSTREAM3IATIPROC __glewVertexStream3iATI;
+  PFNGLVERTEXSTREAM3IVATIPROC __glewVertexStream3ivATI;
+  PFNGLVERTEXSTREAM3SATIPROC __glewVertexStream3sATI;
+  PFNGLVERTEXSTREAM3SVATIPROC __glewVertexStream3svATI;
+  PFNGLVERTEXSTREAM4DATIPROC __glewVertexStream4dATI;
+  PFNGLVERTEXSTREAM4DVATIPROC __glewVertexStream4dvATI;
+  PFNGLVERTEXSTREAM4FATIPROC __glewVertexStream4fATI;
+  PFNGLVERTEXSTREAM4FVATIPROC __glewVertexStream4fvATI;
+  PFNGLVERTEXSTREAM4IATIPROC __glewVertexStream4iATI;
+  PFNGLVERTEXSTREAM4IVATIPROC __glewVertexStream4ivATI;
+  PFNGLVERTEXSTREAM4SATIPROC __glewVertexStream4sATI;
+  PFNGLVERTEXSTREAM4SVATIPROC __glewVertexStream4svATI;
+
+  PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC __glewEGLImageTargetTexStorageEXT;
+  PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC __glewEGLImageTargetTextureStorageEXT;
+
+  PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEEXTPROC __glewDrawArraysInstancedBaseInstanceEXT;
+  PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC __glewDrawElementsInstancedBaseInstanceEXT;
+  PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC __glewDrawElementsInstancedBaseVertexBaseInstanceEXT;
+
+  PFNGLGETUNIFORMBUFFERSIZEEXTPROC __glewGetUniformBufferSizeEXT;
+  PFNGLGETUNIFORMOFFSETEXTPROC __glewGetUniformOffsetEXT;
+  PFNGLUNIFORMBUFFEREXTPROC __glewUniformBufferEXT;
+
+  PFNGLBLENDCOLOREXTPROC __glewBlendColorEXT;
+
+  PFNGLBLENDEQUATIONSEPARATEEXTPROC __glewBlendEquationSeparateEXT;
+
+  PFNGLBINDFRAGDATALOCATIONINDEXEDEXTPROC __glewBindFragDataLocationIndexedEXT;
+  PFNGLGETFRAGDATAINDEXEXTPROC __glewGetFragDataIndexEXT;
+  PFNGLGETPROGRAMRESOURCELOCATIONINDEXEXTPROC __glewGetProgramResourceLocationIndexEXT;
+
+  PFNGLBLENDFUNCSEPARATEEXTPROC __glewBlendFuncSeparateEXT;
+
+  PFNGLBLENDEQUATIONEXTPROC __glewBlendEquationEXT;
+
+  PFNGLBUFFERSTORAGEEXTPROC __glewBufferStorageEXT;
+  PFNGLNAMEDBUFFERSTORAGEEXTPROC __glewNamedBufferStorageEXT;
+
+  PFNGLCLEARTEXIMAGEEXTPROC __glewClearTexImageEXT;
+  PFNGLCLEARTEXSUBIMAGEEXTPROC __glewClearTexSubImageEXT;
+
+  PFNGLCLIPCONTROLEXTPROC __glewClipControlEXT;
+
+  PFNGLCOLORSUBTABLEEXTPROC __glewColorSubTableEXT;
+  PFNGLCOPYCOLORSUBTABLEEXTPROC __glewCopyColorSubTableEXT;
+
+  PFNGLLOCKARRAYSEXTPROC __glewLockArraysEXT;
+  PFNGLUNLOCKARRAYSEXTPROC __glewUnlockArraysEXT;
+
+  PFNGLCONVOLUTIONFILTER1DEXTPROC __glewConvolutionFilter1DEXT;
+  PFNGLCONVOLUTIONFILTER2DEXTPROC __glewConvolutionFilter2DEXT;
+  PFNGLCONVOLUTIONPARAMETERFEXTPROC __glewConvolutionParameterfEXT;
+  PFNGLCONVOLUTIONPARAMETERFVEXTPROC __glewConvolutionParameterfvEXT;
+  PFNGLCONVOLUTIONPARAMETERIEXTPROC __glewConvolutionParameteriEXT;
+  PFNGLCONVOLUTIONPARAMETERIVEXTPROC __glewConvolutionParameterivEXT;
+  PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC __glewCopyConvolutionFilter1DEXT;
+  PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC __glewCopyConvolutionFilter2DEXT;
+  PFNGLGETCONVOLUTIONFILTEREXTPROC __glewGetConvolutionFilterEXT;
+  PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC __glewGetConvolutionParameterfvEXT;
+  PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC __glewGetConvolutionParameterivEXT;
+  PFNGLGETSEPARABLEFILTEREXTPROC __glewGetSeparableFilterEXT;
+  PFNGLSEPARABLEFILTER2DEXTPROC __glewSeparableFilter2DEXT;
+
+  PFNGLBINORMALPOINTEREXTPROC __glewBinormalPointerEXT;
+  PFNGLTANGENTPOINTEREXTPROC __glewTangentPointerEXT;
+
+  PFNGLCOPYIMAGESUBDATAEXTPROC __glewCopyImageSubDataEXT;
+
+  PFNGLCOPYTEXIMAGE1DEXTPROC __glewCopyTexImage1DEXT;
+  PFNGLCOPYTEXIMAGE2DEXTPROC __glewCopyTexImage2DEXT;
+  PFNGLCOPYTEXSUBIMAGE1DEXTPROC __glewCopyTexSubImage1DEXT;
+  PFNGLCOPYTEXSUBIMAGE2DEXTPROC __glewCopyTexSubImage2DEXT;
+  PFNGLCOPYTEXSUBIMAGE3DEXTPROC __glewCopyTexSubImage3DEXT;
+
+  PFNGLCULLPARAMETERDVEXTPROC __glewCullParameterdvEXT;
+  PFNGLCULLPARAMETERFVEXTPROC __glewCullParameterfvEXT;
+
+  PFNGLGETOBJECTLABELEXTPROC __glewGetObjectLabelEXT;
+  PFNGLLABELOBJECTEXTPROC __glewLabelObjectEXT;
+
+  PFNGLINSERTEVENTMARKEREXTPROC __glewInsertEventMarkerEXT;
+  PFNGLPOPGROUPMARKEREXTPROC __glewPopGroupMarkerEXT;
+  PFNGLPUSHGROUPMARKEREXTPROC __glewPushGroupMarkerEXT;
+
+  PFNGLDEPTHBOUNDSEXTPROC __glewDepthBoundsEXT;
+
+  PFNGLBINDMULTITEXTUREEXTPROC __glewBindMultiTextureEXT;
+  PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC __glewCheckNamedFramebufferStatusEXT;
+  PFNGLCLIENTATTRIBDEFAULTEXTPROC __glewClientAttribDefaultEXT;
+  PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC __glewCompressedMultiTexImage1DEXT;
+  PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC __glewCompressedMultiTexImage2DEXT;
+  PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC __glewCompressedMultiTexImage3DEXT;
+  PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC __glewCompressedMultiTexSubImage1DEXT;
+  PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC __glewCompressedMultiTexSubImage2DEXT;
+  PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC __glewCompressedMultiTexSubImage3DEXT;
+  PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC __glewCompressedTextureImage1DEXT;
+  PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC __glewCompressedTextureImage2DEXT;
+  PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC __glewCompressedTextureImage3DEXT;
+  PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC __glewCompressedTextureSubImage1DEXT;
+  PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC __glewCompressedTextureSubImage2DEXT;
+  PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC __glewCompressedTextureSubImage3DEXT;
+  PFNGLCOPYMULTITEXIMAGE1DEXTPROC __glewCopyMultiTexImage1DEXT;
+  PFNGLCOPYMULTITEXIMAGE2DEXTPROC __glewCopyMultiTexImage2DEXT;
+  PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC __glewCopyMultiTexSubImage1DEXT;
+  PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC __glewCopyMultiTexSubImage2DEXT;
+  PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC __glewCopyMultiTexSubImage3DEXT;
+  PFNGLCOPYTEXTUREIMAGE1DEXTPROC __glewCopyTextureImage1DEXT;
+  PFNGLCOPYTEXTUREIMAGE2DEXTPROC __glewCopyTextureImage2DEXT;
+  PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC __glewCopyTextureSubImage1DEXT;
+  PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC __glewCopyTextureSubImage2DEXT;
+  PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC __glewCopyTextureSubImage3DEXT;
+  PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC __glewDisableClientStateIndexedEXT;
+  PFNGLDISABLECLIENTSTATEIEXTPROC __glewDisableClientStateiEXT;
+  PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC __glewDisableVertexArrayAttribEXT;
+  PFNGLDISABLEVERTEXARRAYEXTPROC __glewDisableVertexArrayEXT;
+  PFNGLENABLECLIENTSTATEINDEXEDEXTPROC __glewEnableClientStateIndexedEXT;
+  PFNGLENABLECLIENTSTATEIEXTPROC __glewEnableClientStateiEXT;
+  PFNGLENABLEVERTEXARRAYATTRIBEXTPROC __glewEnableVertexArrayAttribEXT;
+  PFNGLENABLEVERTEXARRAYEXTPROC __glewEnableVertexArrayEXT;
+  PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC __glewFlushMappedNamedBufferRangeEXT;
+  PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC __glewFramebufferDrawBufferEXT;
+  PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC __glewFramebufferDrawBuffersEXT;
+  PFNGLFRAMEBUFFERREADBUFFEREXTPROC __glewFramebufferReadBufferEXT;
+  PFNGLGENERATEMULTITEXMIPMAPEXTPROC __glewGenerateMultiTexMipmapEXT;
+  PFNGLGENERATETEXTUREMIPMAPEXTPROC __glewGenerateTextureMipmapEXT;
+  PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC __glewGetCompressedMultiTexImageEXT;
+  PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC __glewGetCompressedTextureImageEXT;
+  PFNGLGETDOUBLEINDEXEDVEXTPROC __glewGetDoubleIndexedvEXT;
+  PFNGLGETDOUBLEI_VEXTPROC __glewGetDoublei_vEXT;
+  PFNGLGETFLOATINDEXEDVEXTPROC __glewGetFloatIndexedvEXT;
+  PFNGLGETFLOATI_VEXTPROC __glewGetFloati_vEXT;
+  PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC __glewGetFramebufferParameterivEXT;
+  PFNGLGETMULTITEXENVFVEXTPROC __glewGetMultiTexEnvfvEXT;
+  PFNGLGETMULTITEXENVIVEXTPROC __glewGetMultiTexEnvivEXT;
+  PFNGLGETMULTITEXGENDVEXTPROC __glewGetMultiTexGendvEXT;
+  PFNGLGETMULTITEXGENFVEXTPROC __glewGetMultiTexGenfvEXT;
+  PFNGLGETMULTITEXGENIVEXTPROC __glewGetMultiTexGenivEXT;
+  PFNGLGETMULTITEXIMAGEEXTPROC __glewGetMultiTexImageEXT;
+  PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC __glewGetMultiTexLevelParameterfvEXT;
+  PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC __glewGetMultiTexLevelParameterivEXT;
+  PFNGLGETMULTITEXPARAMETERIIVEXTPROC __glewGetMultiTexParameterIivEXT;
+  PFNGLGETMULTITEXPARAMETERIUIVEXTPROC __glewGetMultiTexParameterIuivEXT;
+  PFNGLGETMULTITEXPARAMETERFVEXTPROC __glewGetMultiTexParameterfvEXT;
+  PFNGLGETMULTITEXPARAMETERIVEXTPROC __glewGetMultiTexParameterivEXT;
+  PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC __glewGetNamedBufferParameterivEXT;
+  PFNGLGETNAMEDBUFFERPOINTERVEXTPROC __glewGetNamedBufferPointervEXT;
+  PFNGLGETNAMEDBUFFERSUBDATAEXTPROC __glewGetNamedBufferSubDataEXT;
+  PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC __glewGetNamedFramebufferAttachmentParameterivEXT;
+  PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC __glewGetNamedProgramLocalParameterIivEXT;
+  PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC __glewGetNamedProgramLocalParameterIuivEXT;
+  PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC __glewGetNamedProgramLocalParameterdvEXT;
+  PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC __glewGetNamedProgramLocalParameterfvEXT;
+  PFNGLGETNAMEDPROGRAMSTRINGEXTPROC __glewGetNamedProgramStringEXT;
+  PFNGLGETNAMEDPROGRAMIVEXTPROC __glewGetNamedProgramivEXT;
+  PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC __glewGetNamedRenderbufferParameterivEXT;
+  PFNGLGETPOINTERINDEXEDVEXTPROC __glewGetPointerIndexedvEXT;
+  PFNGLGETPOINTERI_VEXTPROC __glewGetPointeri_vEXT;
+  PFNGLGETTEXTUREIMAGEEXTPROC __glewGetTextureImageEXT;
+  PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC __glewGetTextureLevelParameterfvEXT;
+  PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC __glewGetTextureLevelParameterivEXT;
+  PFNGLGETTEXTUREPARAMETERIIVEXTPROC __glewGetTextureParameterIivEXT;
+  PFNGLGETTEXTUREPARAMETERIUIVEXTPROC __glewGetTextureParameterIuivEXT;
+  PFNGLGETTEXTUREPARAMETERFVEXTPROC __glewGetTextureParameterfvEXT;
+  PFNGLGETTEXTUREPARAMETERIVEXTPROC __glewGetTextureParameterivEXT;
+  PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC __glewGetVertexArrayIntegeri_vEXT;
+  PFNGLGETVERTEXARRAYINTEGERVEXTPROC __glewGetVertexArrayIntegervEXT;
+  PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC __glewGetVertexArrayPointeri_vEXT;
+  PFNGLGETVERTEXARRAYPOINTERVEXTPROC __glewGetVertexArrayPointervEXT;
+  PFNGLMAPNAMEDBUFFEREXTPROC __glewMapNamedBufferEXT;
+  PFNGLMAPNAMEDBUFFERRANGEEXTPROC __glewMapNamedBufferRangeEXT;
+  PFNGLMATRIXFRUSTUMEXTPROC __glewMatrixFrustumEXT;
+  PFNGLMATRIXLOADIDENTITYEXTPROC __glewMatrixLoadIdentityEXT;
+  PFNGLMATRIXLOADTRANSPOSEDEXTPROC __glewMatrixLoadTransposedEXT;
+  PFNGLMATRIXLOADTRANSPOSEFEXTPROC __glewMatrixLoadTransposefEXT;
+  PFNGLMATRIXLOADDEXTPROC __glewMatrixLoaddEXT;
+  PFNGLMATRIXLOADFEXTPROC __glewMatrixLoadfEXT;
+  PFNGLMATRIXMULTTRANSPOSEDEXTPROC __glewMatrixMultTransposedEXT;
+  PFNGLMATRIXMULTTRANSPOSEFEXTPROC __glewMatrixMultTransposefEXT;
+  PFNGLMATRIXMULTDEXTPROC __glewMatrixMultdEXT;
+  PFNGLMATRIXMULTFEXTPROC __glewMatrixMultfEXT;
+  PFNGLMATRIXORTHOEXTPROC __glewMatrixOrthoEXT;
+  PFNGLMATRIXPOPEXTPROC __glewMatrixPopEXT;
+  PFNGLMATRIXPUSHEXTPROC __glewMatrixPushEXT;
+  PFNGLMATRIXROTATEDEXTPROC __glewMatrixRotatedEXT;
+  PFNGLMATRIXROTATEFEXTPROC __glewMatrixRotatefEXT;
+  PFNGLMATRIXSCALEDEXTPROC __glewMatrixScaledEXT;
+  PFNGLMATRIXSCALEFEXTPROC __glewMatrixScalefEXT;
+  PFNGLMATRIXTRANSLATEDEXTPROC __glewMatrixTranslatedEXT;
+  PFNGLMATRIXTRANSLATEFEXTPROC __glewMatrixTranslatefEXT;
+  PFNGLMULTITEXBUFFEREXTPROC __glewMultiTexBufferEXT;
+  PFNGLMULTITEXCOORDPOINTEREXTPROC __glewMultiTexCoordPointerEXT;
+  PFNGLMULTITEXENVFEXTPROC __glewMultiTexEnvfEXT;
+  PFNGLMULTITEXENVFVEXTPROC __glewMultiTexEnvfvEXT;
+  PFNGLMULTITEXENVIEXTPROC __glewMultiTexEnviEXT;
+  PFNGLMULTITEXENVIVEXTPROC __glewMultiTexEnvivEXT;
+  PFNGLMULTITEXGENDEXTPROC __glewMultiTexGendEXT;
+  PFNGLMULTITEXGENDVEXTPROC __glewMultiTexGendvEXT;
+  PFNGLMULTITEXGENFEXTPROC __glewMultiTexGenfEXT;
+  PFNGLMULTITEXGENFVEXTPROC __glewMultiTexGenfvEXT;
+  PFNGLMULTITEXGENIEXTPROC __glewMultiTexGeniEXT;
+  PFNGLMULTITEXGENIVEXTPROC __glewMultiTexGenivEXT;
+  PFNGLMULTITEXIMAGE1DEXTPROC __glewMultiTexImage1DEXT;
+  PFNGLMULTITEXIMAGE2DEXTPROC __glewMultiTexImage2DEXT;
+  PFNGLMULTITEXIMAGE3DEXTPROC __glewMultiTexImage3DEXT;
+  PFNGLMULTITEXPARAMETERIIVEXTPROC __glewMultiTexParameterIivEXT;
+  PFNGLMULTITEXPARAMETERIUIVEXTPROC __glewMultiTexParameterIuivEXT;
+  PFNGLMULTITEXPARAMETERFEXTPROC __glewMultiTexParameterfEXT;
+  PFNGLMULTITEXPARAMETERFVEXTPROC __glewMultiTexParameterfvEXT;
+  PFNGLMULTITEXPARAMETERIEXTPROC __glewMultiTexParameteriEXT;
+  PFNGLMULTITEXPARAMETERIVEXTPROC __glewMultiTexParameterivEXT;
+  PFNGLMULTITEXRENDERBUFFEREXTPROC __glewMultiTexRenderbufferEXT;
+  PFNGLMULTITEXSUBIMAGE1DEXTPROC __glewMultiTexSubImage1DEXT;
+  PFNGLMULTITEXSUBIMAGE2DEXTPROC __glewMultiTexSubImage2DEXT;
+  PFNGLMULTITEXSUBIMAGE3DEXTPROC __glewMultiTexSubImage3DEXT;
+  PFNGLNAMEDBUFFERDATAEXTPROC __glewNamedBufferDataEXT;
+  PFNGLNAMEDBUFFERSUBDATAEXTPROC __glewNamedBufferSubDataEXT;
+  PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC __glewNamedCopyBufferSubDataEXT;
+  PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC __glewNamedFramebufferRenderbufferEXT;
+  PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC __glewNamedFramebufferTexture1DEXT;
+  PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC __glewNamedFramebufferTexture2DEXT;
+  PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC __glewNamedFramebufferTexture3DEXT;
+  PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC __glewNamedFramebufferTextureEXT;
+  PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC __glewNamedFramebufferTextureFaceEXT;
+  PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC __glewNamedFramebufferTextureLayerEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC __glewNamedProgramLocalParameter4dEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC __glewNamedProgramLocalParameter4dvEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC __glewNamedProgramLocalParameter4fEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC __glewNamedProgramLocalParameter4fvEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC __glewNamedProgramLocalParameterI4iEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC __glewNamedProgramLocalParameterI4ivEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC __glewNamedProgramLocalParameterI4uiEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC __glewNamedProgramLocalParameterI4uivEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC __glewNamedProgramLocalParameters4fvEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC __glewNamedProgramLocalParametersI4ivEXT;
+  PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC __glewNamedProgramLocalParametersI4uivEXT;
+  PFNGLNAMEDPROGRAMSTRINGEXTPROC __glewNamedProgramStringEXT;
+  PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC __glewNamedRenderbufferStorageEXT;
+  PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC __glewNamedRenderbufferStorageMultisampleCoverageEXT;
+  PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC __glewNamedRenderbufferStorageMultisampleEXT;
+  PFNGLPROGRAMUNIFORM1FEXTPROC __glewProgramUniform1fEXT;
+  PFNGLPROGRAMUNIFORM1FVEXTPROC __glewProgramUniform1fvEXT;
+  PFNGLPROGRAMUNIFORM1IEXTPROC __glewProgramUniform1iEXT;
+  PFNGLPROGRAMUNIFORM1IVEXTPROC __glewProgramUniform1ivEXT;
+  PFNGLPROGRAMUNIFORM1UIEXTPROC __glewProgramUniform1uiEXT;
+  PFNGLPROGRAMUNIFORM1UIVEXTPROC __glewProgramUniform1uivEXT;
+  PFNGLPROGRAMUNIFORM2FEXTPROC __glewProgramUniform2fEXT;
+  PFNGLPROGRAMUNIFORM2FVEXTPROC __glewProgramUniform2fvEXT;
+  PFNGLPROGRAMUNIFORM2IEXTPROC __glewProgramUniform2iEXT;
+  PFNGLPROGRAMUNIFORM2IVEXTPROC __glewProgramUniform2ivEXT;
+  PFNGLPROGRAMUNIFORM2UIEXTPROC __glewProgramUniform2uiEXT;
+  PFNGLPROGRAMUNIFORM2UIVEXTPROC __glewProgramUniform2uivEXT;
+  PFNGLPROGRAMUNIFORM3FEXTPROC __glewProgramUniform3fEXT;
+  PFNGLPROGRAMUNIFORM3FVEXTPROC __glewProgramUniform3fvEXT;
+  PFNGLPROGRAMUNIFORM3IEXTPROC __glewProgramUniform3iEXT;
+  PFNGLPROGRAMUNIFORM3IVEXTPROC __glewProgramUniform3ivEXT;
+  PFNGLPROGRAMUNIFORM3UIEXTPROC __glewProgramUniform3uiEXT;
+  PFNGLPROGRAMUNIFORM3UIVEXTPROC __glewProgramUniform3uivEXT;
+  PFNGLPROGRAMUNIFORM4FEXTPROC __glewProgramUniform4fEXT;
+  PFNGLPROGRAMUNIFORM4FVEXTPROC __glewProgramUniform4fvEXT;
+  PFNGLPROGRAMUNIFORM4IEXTPROC __glewProgramUniform4iEXT;
+  PFNGLPROGRAMUNIFORM4IVEXTPROC __glewProgramUniform4ivEXT;
+  PFNGLPROGRAMUNIFORM4UIEXTPROC __glewProgramUniform4uiEXT;
+  PFNGLPROGRAMUNIFORM4UIVEXTPROC __glewProgramUniform4uivEXT;
+  PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC __glewProgramUniformMatrix2fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC __glewProgramUniformMatrix2x3fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC __glewProgramUniformMatrix2x4fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC __glewProgramUniformMatrix3fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC __glewProgramUniformMatrix3x2fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC __glewProgramUniformMatrix3x4fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC __glewProgramUniformMatrix4fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC __glewProgramUniformMatrix4x2fvEXT;
+  PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC __glewProgramUniformMatrix4x3fvEXT;
+  PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC __glewPushClientAttribDefaultEXT;
+  PFNGLTEXTUREBUFFEREXTPROC __glewTextureBufferEXT;
+  PFNGLTEXTUREIMAGE1DEXTPROC __glewTextureImage1DEXT;
+  PFNGLTEXTUREIMAGE2DEXTPROC __glewTextureImage2DEXT;
+  PFNGLTEXTUREIMAGE3DEXTPROC __glewTextureImage3DEXT;
+  PFNGLTEXTUREPARAMETERIIVEXTPROC __glewTextureParameterIivEXT;
+  PFNGLTEXTUREPARAMETERIUIVEXTPROC __glewTextureParameterIuivEXT;
+  PFNGLTEXTUREPARAMETERFEXTPROC __glewTextureParameterfEXT;
+  PFNGLTEXTUREPARAMETERFVEXTPROC __glewTextureParameterfvEXT;
+  PFNGLTEXTUREPARAMETERIEXTPROC __glewTextureParameteriEXT;
+  PFNGLTEXTUREPARAMETERIVEXTPROC __glewTextureParameterivEXT;
+  PFNGLTEXTURERENDERBUFFEREXTPROC __glewTextureRenderbufferEXT;
+  PFNGLTEXTURESUBIMAGE1DEXTPROC __glewTextureSubImage1DEXT;
+  PFNGLTEXTURESUBIMAGE2DEXTPROC __glewTextureSubImage2DEXT;
+  PFNGLTEXTURESUBIMAGE3DEXTPROC __glewTextureSubImage3DEXT;
+  PFNGLUNMAPNAMEDBUFFEREXTPROC __glewUnmapNamedBufferEXT;
+  PFNGLVERTEXARRAYCOLOROFFSETEXTPROC __glewVertexArrayColorOffsetEXT;
+  PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC __glewVertexArrayEdgeFlagOffsetEXT;
+  PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC __glewVertexArrayFogCoordOffsetEXT;
+  PFNGLVERTEXARRAYINDEXOFFSETEXTPROC __glewVertexArrayIndexOffsetEXT;
+  PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC __glewVertexArrayMultiTexCoordOffsetEXT;
+  PFNGLVERTEXARRAYNORMALOFFSETEXTPROC __glewVertexArrayNormalOffsetEXT;
+  PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC __glewVertexArraySecondaryColorOffsetEXT;
+  PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC __glewVertexArrayTexCoordOffsetEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC __glewVertexArrayVertexAttribDivisorEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC __glewVertexArrayVertexAttribIOffsetEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC __glewVertexArrayVertexAttribOffsetEXT;
+  PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC __glewVertexArrayVertexOffsetEXT;
+
+  PFNGLDISCARDFRAMEBUFFEREXTPROC __glewDiscardFramebufferEXT;
+
+  PFNGLBEGINQUERYEXTPROC __glewBeginQueryEXT;
+  PFNGLDELETEQUERIESEXTPROC __glewDeleteQueriesEXT;
+  PFNGLENDQUERYEXTPROC __glewEndQueryEXT;
+  PFNGLGENQUERIESEXTPROC __glewGenQueriesEXT;
+  PFNGLGETINTEGER64VEXTPROC __glewGetInteger64vEXT;
+  PFNGLGETQUERYOBJECTIVEXTPROC __glewGetQueryObjectivEXT;
+  PFNGLGETQUERYOBJECTUIVEXTPROC __glewGetQueryObjectuivEXT;
+  PFNGLGETQUERYIVEXTPROC __glewGetQueryivEXT;
+  PFNGLISQUERYEXTPROC __glewIsQueryEXT;
+  PFNGLQUERYCOUNTEREXTPROC __glewQueryCounterEXT;
+
+  PFNGLDRAWBUFFERSEXTPROC __glewDrawBuffersEXT;
+
+  PFNGLCOLORMASKINDEXEDEXTPROC __glewColorMaskIndexedEXT;
+  PFNGLDISABLEINDEXEDEXTPROC __glewDisableIndexedEXT;
+  PFNGLENABLEINDEXEDEXTPROC __glewEnableIndexedEXT;
+  PFNGLGETBOOLEANINDEXEDVEXTPROC __glewGetBooleanIndexedvEXT;
+  PFNGLGETINTEGERINDEXEDVEXTPROC __glewGetIntegerIndexedvEXT;
+  PFNGLISENABLEDINDEXEDEXTPROC __glewIsEnabledIndexedEXT;
+
+  PFNGLBLENDEQUATIONSEPARATEIEXTPROC __glewBlendEquationSeparateiEXT;
+  PFNGLBLENDEQUATIONIEXTPROC __glewBlendEquationiEXT;
+  PFNGLBLENDFUNCSEPARATEIEXTPROC __glewBlendFuncSeparateiEXT;
+  PFNGLBLENDFUNCIEXTPROC __glewBlendFunciEXT;
+  PFNGLCOLORMASKIEXTPROC __glewColorMaskiEXT;
+  PFNGLDISABLEIEXTPROC __glewDisableiEXT;
+  PFNGLENABLEIEXTPROC __glewEnableiEXT;
+  PFNGLISENABLEDIEXTPROC __glewIsEnablediEXT;
+
+  PFNGLDRAWELEMENTSBASEVERTEXEXTPROC __glewDrawElementsBaseVertexEXT;
+  PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXEXTPROC __glewDrawElementsInstancedBaseVertexEXT;
+  PFNGLDRAWRANGEELEMENTSBASEVERTEXEXTPROC __glewDrawRangeElementsBaseVertexEXT;
+  PFNGLMULTIDRAWELEMENTSBASEVERTEXEXTPROC __glewMultiDrawElementsBaseVertexEXT;
+
+  PFNGLDRAWARRAYSINSTANCEDEXTPROC __glewDrawArraysInstancedEXT;
+  PFNGLDRAWELEMENTSINSTANCEDEXTPROC __glewDrawElementsInstancedEXT;
+
+  PFNGLDRAWRANGEELEMENTSEXTPROC __glewDrawRangeElementsEXT;
+
+  PFNGLDRAWTRANSFORMFEEDBACKEXTPROC __glewDrawTransformFeedbackEXT;
+  PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDEXTPROC __glewDrawTransformFeedbackInstancedEXT;
+
+  PFNGLBUFFERSTORAGEEXTERNALEXTPROC __glewBufferStorageExternalEXT;
+  PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC __glewNamedBufferStorageExternalEXT;
+
+  PFNGLFOGCOORDPOINTEREXTPROC __glewFogCoordPointerEXT;
+  PFNGLFOGCOORDDEXTPROC __glewFogCoorddEXT;
+  PFNGLFOGCOORDDVEXTPROC __glewFogCoorddvEXT;
+  PFNGLFOGCOORDFEXTPROC __glewFogCoordfEXT;
+  PFNGLFOGCOORDFVEXTPROC __glewFogCoordfvEXT;
+
+  PFNGLFRAGMENTCOLORMATERIALEXTPROC __glewFragmentColorMaterialEXT;
+  PFNGLFRAGMENTLIGHTMODELFEXTPROC __glewFragmentLightModelfEXT;
+  PFNGLFRAGMENTLIGHTMODELFVEXTPROC __glewFragmentLightModelfvEXT;
+  PFNGLFRAGMENTLIGHTMODELIEXTPROC __glewFragmentLightModeliEXT;
+  PFNGLFRAGMENTLIGHTMODELIVEXTPROC __glewFragmentLightModelivEXT;
+  PFNGLFRAGMENTLIGHTFEXTPROC __glewFragmentLightfEXT;
+  PFNGLFRAGMENTLIGHTFVEXTPROC __glewFragmentLightfvEXT;
+  PFNGLFRAGMENTLIGHTIEXTPROC __glewFragmentLightiEXT;
+  PFNGLFRAGMENTLIGHTIVEXTPROC __glewFragmentLightivEXT;
+  PFNGLFRAGMENTMATERIALFEXTPROC __glewFragmentMaterialfEXT;
+  PFNGLFRAGMENTMATERIALFVEXTPROC __glewFragmentMaterialfvEXT;
+  PFNGLFRAGMENTMATERIALIEXTPROC __glewFragmentMaterialiEXT;
+  PFNGLFRAGMENTMATERIALIVEXTPROC __glewFragmentMaterialivEXT;
+  PFNGLGETFRAGMENTLIGHTFVEXTPROC __glewGetFragmentLightfvEXT;
+  PFNGLGETFRAGMENTLIGHTIVEXTPROC __glewGetFragmentLightivEXT;
+  PFNGLGETFRAGMENTMATERIALFVEXTPROC __glewGetFragmentMaterialfvEXT;
+  PFNGLGETFRAGMENTMATERIALIVEXTPROC __glewGetFragmentMaterialivEXT;
+  PFNGLLIGHTENVIEXTPROC __glewLightEnviEXT;
+
+  PFNGLBLITFRAMEBUFFEREXTPROC __glewBlitFramebufferEXT;
+
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC __glewRenderbufferStorageMultisampleEXT;
+
+  PFNGLBINDFRAMEBUFFEREXTPROC __glewBindFramebufferEXT;
+  PFNGLBINDRENDERBUFFEREXTPROC __glewBindRenderbufferEXT;
+  PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC __glewCheckFramebufferStatusEXT;
+  PFNGLDELETEFRAMEBUFFERSEXTPROC __glewDeleteFramebuffersEXT;
+  PFNGLDELETERENDERBUFFERSEXTPROC __glewDeleteRenderbuffersEXT;
+  PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC __glewFramebufferRenderbufferEXT;
+  PFNGLFRAMEBUFFERTEXTURE1DEXTPROC __glewFramebufferTexture1DEXT;
+  PFNGLFRAMEBUFFERTEXTURE2DEXTPROC __glewFramebufferTexture2DEXT;
+  PFNGLFRAMEBUFFERTEXTURE3DEXTPROC __glewFramebufferTexture3DEXT;
+  PFNGLGENFRAMEBUFFERSEXTPROC __glewGenFramebuffersEXT;
+  PFNGLGENRENDERBUFFERSEXTPROC __glewGenRenderbuffersEXT;
+  PFNGLGENERATEMIPMAPEXTPROC __glewGenerateMipmapEXT;
+  PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC __glewGetFramebufferAttachmentParameterivEXT;
+  PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC __glewGetRenderbufferParameterivEXT;
+  PFNGLISFRAMEBUFFEREXTPROC __glewIsFramebufferEXT;
+  PFNGLISRENDERBUFFEREXTPROC __glewIsRenderbufferEXT;
+  PFNGLRENDERBUFFERSTORAGEEXTPROC __glewRenderbufferStorageEXT;
+
+  PFNGLFRAMEBUFFERTEXTUREEXTPROC __glewFramebufferTextureEXT;
+  PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC __glewFramebufferTextureFaceEXT;
+  PFNGLPROGRAMPARAMETERIEXTPROC __glewProgramParameteriEXT;
+
+  PFNGLPROGRAMENVPARAMETERS4FVEXTPROC __glewProgramEnvParameters4fvEXT;
+  PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC __glewProgramLocalParameters4fvEXT;
+
+  PFNGLBINDFRAGDATALOCATIONEXTPROC __glewBindFragDataLocationEXT;
+  PFNGLGETFRAGDATALOCATIONEXTPROC __glewGetFragDataLocationEXT;
+  PFNGLGETUNIFORMUIVEXTPROC __glewGetUniformuivEXT;
+  PFNGLGETVERTEXATTRIBIIVEXTPROC __glewGetVertexAttribIivEXT;
+  PFNGLGETVERTEXATTRIBIUIVEXTPROC __glewGetVertexAttribIuivEXT;
+  PFNGLUNIFORM1UIEXTPROC __glewUniform1uiEXT;
+  PFNGLUNIFORM1UIVEXTPROC __glewUniform1uivEXT;
+  PFNGLUNIFORM2UIEXTPROC __glewUniform2uiEXT;
+  PFNGLUNIFORM2UIVEXTPROC __glewUniform2uivEXT;
+  PFNGLUNIFORM3UIEXTPROC __glewUniform3uiEXT;
+  PFNGLUNIFORM3UIVEXTPROC __glewUniform3uivEXT;
+  PFNGLUNIFORM4UIEXTPROC __glewUniform4uiEXT;
+  PFNGLUNIFORM4UIVEXTPROC __glewUniform4uivEXT;
+  PFNGLVERTEXATTRIBI1IEXTPROC __glewVertexAttribI1iEXT;
+  PFNGLVERTEXATTRIBI1IVEXTPROC __glewVertexAttribI1ivEXT;
+  PFNGLVERTEXATTRIBI1UIEXTPROC __glewVertexAttribI1uiEXT;
+  PFNGLVERTEXATTRIBI1UIVEXTPROC __glewVertexAttribI1uivEXT;
+  PFNGLVERTEXATTRIBI2IEXTPROC __glewVertexAttribI2iEXT;
+  PFNGLVERTEXATTRIBI2IVEXTPROC __glewVertexAttribI2ivEXT;
+  PFNGLVERTEXATTRIBI2UIEXTPROC __glewVertexAttribI2uiEXT;
+  PFNGLVERTEXATTRIBI2UIVEXTPROC __glewVertexAttribI2uivEXT;
+  PFNGLVERTEXATTRIBI3IEXTPROC __glewVertexAttribI3iEXT;
+  PFNGLVERTEXATTRIBI3IVEXTPROC __glewVertexAttribI3ivEXT;
+  PFNGLVERTEXATTRIBI3UIEXTPROC __glewVertexAttribI3uiEXT;
+  PFNGLVERTEXATTRIBI3UIVEXTPROC __glewVertexAttribI3uivEXT;
+  PFNGLVERTEXATTRIBI4BVEXTPROC __glewVertexAttribI4bvEXT;
+  PFNGLVERTEXATTRIBI4IEXTPROC __glewVertexAttribI4iEXT;
+  PFNGLVERTEXATTRIBI4IVEXTPROC __glewVertexAttribI4ivEXT;
+  PFNGLVERTEXATTRIBI4SVEXTPROC __glewVertexAttribI4svEXT;
+  PFNGLVERTEXATTRIBI4UBVEXTPROC __glewVertexAttribI4ubvEXT;
+  PFNGLVERTEXATTRIBI4UIEXTPROC __glewVertexAttribI4uiEXT;
+  PFNGLVERTEXATTRIBI4UIVEXTPROC __glewVertexAttribI4uivEXT;
+  PFNGLVERTEXATTRIBI4USVEXTPROC __glewVertexAttribI4usvEXT;
+  PFNGLVERTEXATTRIBIPOINTEREXTPROC __glewVertexAttribIPointerEXT;
+
+  PFNGLGETHISTOGRAMEXTPROC __glewGetHistogramEXT;
+  PFNGLGETHISTOGRAMPARAMETERFVEXTPROC __glewGetHistogramParameterfvEXT;
+  PFNGLGETHISTOGRAMPARAMETERIVEXTPROC __glewGetHistogramParameterivEXT;
+  PFNGLGETMINMAXEXTPROC __glewGetMinmaxEXT;
+  PFNGLGETMINMAXPARAMETERFVEXTPROC __glewGetMinmaxParameterfvEXT;
+  PFNGLGETMINMAXPARAMETERIVEXTPROC __glewGetMinmaxParameterivEXT;
+  PFNGLHISTOGRAMEXTPROC __glewHistogramEXT;
+  PFNGLMINMAXEXTPROC __glewMinmaxEXT;
+  PFNGLRESETHISTOGRAMEXTPROC __glewResetHistogramEXT;
+  PFNGLRESETMINMAXEXTPROC __glewResetMinmaxEXT;
+
+  PFNGLINDEXFUNCEXTPROC __glewIndexFuncEXT;
+
+  PFNGLINDEXMATERIALEXTPROC __glewIndexMaterialEXT;
+
+  PFNGLVERTEXATTRIBDIVISOREXTPROC __glewVertexAttribDivisorEXT;
+
+  PFNGLAPPLYTEXTUREEXTPROC __glewApplyTextureEXT;
+  PFNGLTEXTURELIGHTEXTPROC __glewTextureLightEXT;
+  PFNGLTEXTUREMATERIALEXTPROC __glewTextureMaterialEXT;
+
+  PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC __glewFlushMappedBufferRangeEXT;
+  PFNGLMAPBUFFERRANGEEXTPROC __glewMapBufferRangeEXT;
+
+  PFNGLBUFFERSTORAGEMEMEXTPROC __glewBufferStorageMemEXT;
+  PFNGLCREATEMEMORYOBJECTSEXTPROC __glewCreateMemoryObjectsEXT;
+  PFNGLDELETEMEMORYOBJECTSEXTPROC __glewDeleteMemoryObjectsEXT;
+  PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC __glewGetMemoryObjectParameterivEXT;
+  PFNGLGETUNSIGNEDBYTEI_VEXTPROC __glewGetUnsignedBytei_vEXT;
+  PFNGLGETUNSIGNEDBYTEVEXTPROC __glewGetUnsignedBytevEXT;
+  PFNGLISMEMORYOBJECTEXTPROC __glewIsMemoryObjectEXT;
+  PFNGLMEMORYOBJECTPARAMETERIVEXTPROC __glewMemoryObjectParameterivEXT;
+  PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC __glewNamedBufferStorageMemEXT;
+  PFNGLTEXSTORAGEMEM1DEXTPROC __glewTexStorageMem1DEXT;
+  PFNGLTEXSTORAGEMEM2DEXTPROC __glewTexStorageMem2DEXT;
+  PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC __glewTexStorageMem2DMultisampleEXT;
+  PFNGLTEXSTORAGEMEM3DEXTPROC __glewTexStorageMem3DEXT;
+  PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC __glewTexStorageMem3DMultisampleEXT;
+  PFNGLTEXTURESTORAGEMEM1DEXTPROC __glewTextureStorageMem1DEXT;
+  PFNGLTEXTURESTORAGEMEM2DEXTPROC __glewTextureStorageMem2DEXT;
+  PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC __glewTextureStorageMem2DMultisampleEXT;
+  PFNGLTEXTURESTORAGEMEM3DEXTPROC __glewTextureStorageMem3DEXT;
+  PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC __glewTextureStorageMem3DMultisampleEXT;
+
+  PFNGLIMPORTMEMORYFDEXTPROC __glewImportMemoryFdEXT;
+
+  PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC __glewImportMemoryWin32HandleEXT;
+  PFNGLIMPORTMEMORYWIN32NAMEEXTPROC __glewImportMemoryWin32NameEXT;
+
+  PFNGLMULTIDRAWARRAYSEXTPROC __glewMultiDrawArraysEXT;
+  PFNGLMULTIDRAWELEMENTSEXTPROC __glewMultiDrawElementsEXT;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC __glewMultiDrawArraysIndirectEXT;
+  PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC __glewMultiDrawElementsIndirectEXT;
+
+  PFNGLSAMPLEMASKEXTPROC __glewSampleMaskEXT;
+  PFNGLSAMPLEPATTERNEXTPROC __glewSamplePatternEXT;
+
+  PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC __glewFramebufferTexture2DMultisampleEXT;
+
+  PFNGLDRAWBUFFERSINDEXEDEXTPROC __glewDrawBuffersIndexedEXT;
+  PFNGLGETINTEGERI_VEXTPROC __glewGetIntegeri_vEXT;
+  PFNGLREADBUFFERINDEXEDEXTPROC __glewReadBufferIndexedEXT;
+
+  PFNGLCOLORTABLEEXTPROC __glewColorTableEXT;
+  PFNGLGETCOLORTABLEEXTPROC __glewGetColorTableEXT;
+  PFNGLGETCOLORTABLEPARAMETERFVEXTPROC __glewGetColorTableParameterfvEXT;
+  PFNGLGETCOLORTABLEPARAMETERIVEXTPROC __glewGetColorTableParameterivEXT;
+
+  PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC __glewGetPixelTransformParameterfvEXT;
+  PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC __glewGetPixelTransformParameterivEXT;
+  PFNGLPIXELTRANSFORMPARAMETERFEXTPROC __glewPixelTransformParameterfEXT;
+  PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC __glewPixelTransformParameterfvEXT;
+  PFNGLPIXELTRANSFORMPARAMETERIEXTPROC __glewPixelTransformParameteriEXT;
+  PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC __glewPixelTransformParameterivEXT;
+
+  PFNGLPOINTPARAMETERFEXTPROC __glewPointParameterfEXT;
+  PFNGLPOINTPARAMETERFVEXTPROC __glewPointParameterfvEXT;
+
+  PFNGLPOLYGONOFFSETEXTPROC __glewPolygonOffsetEXT;
+
+  PFNGLPOLYGONOFFSETCLAMPEXTPROC __glewPolygonOffsetClampEXT;
+
+  PFNGLPRIMITIVEBOUNDINGBOXEXTPROC __glewPrimitiveBoundingBoxEXT;
+
+  PFNGLPROVOKINGVERTEXEXTPROC __glewProvokingVertexEXT;
+
+  PFNGLCOVERAGEMODULATIONNVPROC __glewCoverageModulationNV;
+  PFNGLCOVERAGEMODULATIONTABLENVPROC __glewCoverageModulationTableNV;
+  PFNGLGETCOVERAGEMODULATIONTABLENVPROC __glewGetCoverageModulationTableNV;
+  PFNGLRASTERSAMPLESEXTPROC __glewRasterSamplesEXT;
+
+  PFNGLGETNUNIFORMFVEXTPROC __glewGetnUniformfvEXT;
+  PFNGLGETNUNIFORMIVEXTPROC __glewGetnUniformivEXT;
+  PFNGLREADNPIXELSEXTPROC __glewReadnPixelsEXT;
+
+  PFNGLBEGINSCENEEXTPROC __glewBeginSceneEXT;
+  PFNGLENDSCENEEXTPROC __glewEndSceneEXT;
+
+  PFNGLSECONDARYCOLOR3BEXTPROC __glewSecondaryColor3bEXT;
+  PFNGLSECONDARYCOLOR3BVEXTPROC __glewSecondaryColor3bvEXT;
+  PFNGLSECONDARYCOLOR3DEXTPROC __glewSecondaryColor3dEXT;
+  PFNGLSECONDARYCOLOR3DVEXTPROC __glewSecondaryColor3dvEXT;
+  PFNGLSECONDARYCOLOR3FEXTPROC __glewSecondaryColor3fEXT;
+  PFNGLSECONDARYCOLOR3FVEXTPROC __glewSecondaryColor3fvEXT;
+  PFNGLSECONDARYCOLOR3IEXTPROC __glewSecondaryColor3iEXT;
+  PFNGLSECONDARYCOLOR3IVEXTPROC __glewSecondaryColor3ivEXT;
+  PFNGLSECONDARYCOLOR3SEXTPROC __glewSecondaryColor3sEXT;
+  PFNGLSECONDARYCOLOR3SVEXTPROC __glewSecondaryColor3svEXT;
+  PFNGLSECONDARYCOLOR3UBEXTPROC __glewSecondaryColor3ubEXT;
+  PFNGLSECONDARYCOLOR3UBVEXTPROC __glewSecondaryColor3ubvEXT;
+  PFNGLSECONDARYCOLOR3UIEXTPROC __glewSecondaryColor3uiEXT;
+  PFNGLSECONDARYCOLOR3UIVEXTPROC __glewSecondaryColor3uivEXT;
+  PFNGLSECONDARYCOLOR3USEXTPROC __glewSecondaryColor3usEXT;
+  PFNGLSECONDARYCOLOR3USVEXTPROC __glewSecondaryColor3usvEXT;
+  PFNGLSECONDARYCOLORPOINTEREXTPROC __glewSecondaryColorPointerEXT;
+
+  PFNGLDELETESEMAPHORESEXTPROC __glewDeleteSemaphoresEXT;
+  PFNGLGENSEMAPHORESEXTPROC __glewGenSemaphoresEXT;
+  PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC __glewGetSemaphoreParameterui64vEXT;
+  PFNGLISSEMAPHOREEXTPROC __glewIsSemaphoreEXT;
+  PFNGLSEMAPHOREPARAMETERUI64VEXTPROC __glewSemaphoreParameterui64vEXT;
+  PFNGLSIGNALSEMAPHOREEXTPROC __glewSignalSemaphoreEXT;
+  PFNGLWAITSEMAPHOREEXTPROC __glewWaitSemaphoreEXT;
+
+  PFNGLIMPORTSEMAPHOREFDEXTPROC __glewImportSemaphoreFdEXT;
+
+  PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC __glewImportSemaphoreWin32HandleEXT;
+  PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC __glewImportSemaphoreWin32NameEXT;
+
+  PFNGLACTIVEPROGRAMEXTPROC __glewActiveProgramEXT;
+  PFNGLCREATESHADERPROGRAMEXTPROC __glewCreateShaderProgramEXT;
+  PFNGLUSESHADERPROGRAMEXTPROC __glewUseShaderProgramEXT;
+
+  PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC __glewFramebufferFetchBarrierEXT;
+
+  PFNGLBINDIMAGETEXTUREEXTPROC __glewBindImageTextureEXT;
+  PFNGLMEMORYBARRIEREXTPROC __glewMemoryBarrierEXT;
+
+  PFNGLCLEARPIXELLOCALSTORAGEUIEXTPROC __glewClearPixelLocalStorageuiEXT;
+  PFNGLFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC __glewFramebufferPixelLocalStorageSizeEXT;
+  PFNGLGETFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC __glewGetFramebufferPixelLocalStorageSizeEXT;
+
+  PFNGLTEXPAGECOMMITMENTEXTPROC __glewTexPageCommitmentEXT;
+  PFNGLTEXTUREPAGECOMMITMENTEXTPROC __glewTexturePageCommitmentEXT;
+
+  PFNGLACTIVESTENCILFACEEXTPROC __glewActiveStencilFaceEXT;
+
+  PFNGLTEXSUBIMAGE1DEXTPROC __glewTexSubImage1DEXT;
+  PFNGLTEXSUBIMAGE2DEXTPROC __glewTexSubImage2DEXT;
+  PFNGLTEXSUBIMAGE3DEXTPROC __glewTexSubImage3DEXT;
+
+  PFNGLPATCHPARAMETERIEXTPROC __glewPatchParameteriEXT;
+
+  PFNGLTEXIMAGE3DEXTPROC __glewTexImage3DEXT;
+
+  PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC __glewFramebufferTextureLayerEXT;
+
+  PFNGLGETSAMPLERPARAMETERIIVEXTPROC __glewGetSamplerParameterIivEXT;
+  PFNGLGETSAMPLERPARAMETERIUIVEXTPROC __glewGetSamplerParameterIuivEXT;
+  PFNGLSAMPLERPARAMETERIIVEXTPROC __glewSamplerParameterIivEXT;
+  PFNGLSAMPLERPARAMETERIUIVEXTPROC __glewSamplerParameterIuivEXT;
+
+  PFNGLTEXBUFFEREXTPROC __glewTexBufferEXT;
+
+  PFNGLCLEARCOLORIIEXTPROC __glewClearColorIiEXT;
+  PFNGLCLEARCOLORIUIEXTPROC __glewClearColorIuiEXT;
+  PFNGLGETTEXPARAMETERIIVEXTPROC __glewGetTexParameterIivEXT;
+  PFNGLGETTEXPARAMETERIUIVEXTPROC __glewGetTexParameterIuivEXT;
+  PFNGLTEXPARAMETERIIVEXTPROC __glewTexParameterIivEXT;
+  PFNGLTEXPARAMETERIUIVEXTPROC __glewTexParameterIuivEXT;
+
+  PFNGLARETEXTURESRESIDENTEXTPROC __glewAreTexturesResidentEXT;
+  PFNGLBINDTEXTUREEXTPROC __glewBindTextureEXT;
+  PFNGLDELETETEXTURESEXTPROC __glewDeleteTexturesEXT;
+  PFNGLGENTEXTURESEXTPROC __glewGenTexturesEXT;
+  PFNGLISTEXTUREEXTPROC __glewIsTextureEXT;
+  PFNGLPRIORITIZETEXTURESEXTPROC __glewPrioritizeTexturesEXT;
+
+  PFNGLTEXTURENORMALEXTPROC __glewTextureNormalEXT;
+
+  PFNGLTEXSTORAGE1DEXTPROC __glewTexStorage1DEXT;
+  PFNGLTEXSTORAGE2DEXTPROC __glewTexStorage2DEXT;
+  PFNGLTEXSTORAGE3DEXTPROC __glewTexStorage3DEXT;
+  PFNGLTEXTURESTORAGE1DEXTPROC __glewTextureStorage1DEXT;
+  PFNGLTEXTURESTORAGE2DEXTPROC __glewTextureStorage2DEXT;
+  PFNGLTEXTURESTORAGE3DEXTPROC __glewTextureStorage3DEXT;
+
+  PFNGLTEXTUREVIEWEXTPROC __glewTextureViewEXT;
+
+  PFNGLGETQUERYOBJECTI64VEXTPROC __glewGetQueryObjecti64vEXT;
+  PFNGLGETQUERYOBJECTUI64VEXTPROC __glewGetQueryObjectui64vEXT;
+
+  PFNGLBEGINTRANSFORMFEEDBACKEXTPROC __glewBeginTransformFeedbackEXT;
+  PFNGLBINDBUFFERBASEEXTPROC __glewBindBufferBaseEXT;
+  PFNGLBINDBUFFEROFFSETEXTPROC __glewBindBufferOffsetEXT;
+  PFNGLBINDBUFFERRANGEEXTPROC __glewBindBufferRangeEXT;
+  PFNGLENDTRANSFORMFEEDBACKEXTPROC __glewEndTransformFeedbackEXT;
+  PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC __glewGetTransformFeedbackVaryingEXT;
+  PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC __glewTransformFeedbackVaryingsEXT;
+
+  PFNGLARRAYELEMENTEXTPROC __glewArrayElementEXT;
+  PFNGLCOLORPOINTEREXTPROC __glewColorPointerEXT;
+  PFNGLDRAWARRAYSEXTPROC __glewDrawArraysEXT;
+  PFNGLEDGEFLAGPOINTEREXTPROC __glewEdgeFlagPointerEXT;
+  PFNGLINDEXPOINTEREXTPROC __glewIndexPointerEXT;
+  PFNGLNORMALPOINTEREXTPROC __glewNormalPointerEXT;
+  PFNGLTEXCOORDPOINTEREXTPROC __glewTexCoordPointerEXT;
+  PFNGLVERTEXPOINTEREXTPROC __glewVertexPointerEXT;
+
+  PFNGLBINDARRAYSETEXTPROC __glewBindArraySetEXT;
+  PFNGLCREATEARRAYSETEXTPROC __glewCreateArraySetExt;
+  PFNGLDELETEARRAYSETSEXTPROC __glewDeleteArraySetsEXT;
+
+  PFNGLGETVERTEXATTRIBLDVEXTPROC __glewGetVertexAttribLdvEXT;
+  PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC __glewVertexArrayVertexAttribLOffsetEXT;
+  PFNGLVERTEXATTRIBL1DEXTPROC __glewVertexAttribL1dEXT;
+  PFNGLVERTEXATTRIBL1DVEXTPROC __glewVertexAttribL1dvEXT;
+  PFNGLVERTEXATTRIBL2DEXTPROC __glewVertexAttribL2dEXT;
+  PFNGLVERTEXATTRIBL2DVEXTPROC __glewVertexAttribL2dvEXT;
+  PFNGLVERTEXATTRIBL3DEXTPROC __glewVertexAttribL3dEXT;
+  PFNGLVERTEXATTRIBL3DVEXTPROC __glewVertexAttribL3dvEXT;
+  PFNGLVERTEXATTRIBL4DEXTPROC __glewVertexAttribL4dEXT;
+  PFNGLVERTEXATTRIBL4DVEXTPROC __glewVertexAttribL4dvEXT;
+  PFNGLVERTEXATTRIBLPOINTEREXTPROC __glewVertexAttribLPointerEXT;
+
+  PFNGLBEGINVERTEXSHADEREXTPROC __glewBeginVertexShaderEXT;
+  PFNGLBINDLIGHTPARAMETEREXTPROC __glewBindLightParameterEXT;
+  PFNGLBINDMATERIALPARAMETEREXTPROC __glewBindMaterialParameterEXT;
+  PFNGLBINDPARAMETEREXTPROC __glewBindParameterEXT;
+  PFNGLBINDTEXGENPARAMETEREXTPROC __glewBindTexGenParameterEXT;
+  PFNGLBINDTEXTUREUNITPARAMETEREXTPROC __glewBindTextureUnitParameterEXT;
+  PFNGLBINDVERTEXSHADEREXTPROC __glewBindVertexShaderEXT;
+  PFNGLDELETEVERTEXSHADEREXTPROC __glewDeleteVertexShaderEXT;
+  PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC __glewDisableVariantClientStateEXT;
+  PFNGLENABLEVARIANTCLIENTSTATEEXTPROC __glewEnableVariantClientStateEXT;
+  PFNGLENDVERTEXSHADEREXTPROC __glewEndVertexShaderEXT;
+  PFNGLEXTRACTCOMPONENTEXTPROC __glewExtractComponentEXT;
+  PFNGLGENSYMBOLSEXTPROC __glewGenSymbolsEXT;
+  PFNGLGENVERTEXSHADERSEXTPROC __glewGenVertexShadersEXT;
+  PFNGLGETINVARIANTBOOLEANVEXTPROC __glewGetInvariantBooleanvEXT;
+  PFNGLGETINVARIANTFLOATVEXTPROC __glewGetInvariantFloatvEXT;
+  PFNGLGETINVARIANTINTEGERVEXTPROC __glewGetInvariantIntegervEXT;
+  PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC __glewGetLocalConstantBooleanvEXT;
+  PFNGLGETLOCALCONSTANTFLOATVEXTPROC __glewGetLocalConstantFloatvEXT;
+  PFNGLGETLOCALCONSTANTINTEGERVEXTPROC __glewGetLocalConstantIntegervEXT;
+  PFNGLGETVARIANTBOOLEANVEXTPROC __glewGetVariantBooleanvEXT;
+  PFNGLGETVARIANTFLOATVEXTPROC __glewGetVariantFloatvEXT;
+  PFNGLGETVARIANTINTEGERVEXTPROC __glewGetVariantIntegervEXT;
+  PFNGLGETVARIANTPOINTERVEXTPROC __glewGetVariantPointervEXT;
+  PFNGLINSERTCOMPONENTEXTPROC __glewInsertComponentEXT;
+  PFNGLISVARIANTENABLEDEXTPROC __glewIsVariantEnabledEXT;
+  PFNGLSETINVARIANTEXTPROC __glewSetInvariantEXT;
+  PFNGLSETLOCALCONSTANTEXTPROC __glewSetLocalConstantEXT;
+  PFNGLSHADEROP1EXTPROC __glewShaderOp1EXT;
+  PFNGLSHADEROP2EXTPROC __glewShaderOp2EXT;
+  PFNGLSHADEROP3EXTPROC __glewShaderOp3EXT;
+  PFNGLSWIZZLEEXTPROC __glewSwizzleEXT;
+  PFNGLVARIANTPOINTEREXTPROC __glewVariantPointerEXT;
+  PFNGLVARIANTBVEXTPROC __glewVariantbvEXT;
+  PFNGLVARIANTDVEXTPROC __glewVariantdvEXT;
+  PFNGLVARIANTFVEXTPROC __glewVariantfvEXT;
+  PFNGLVARIANTIVEXTPROC __glewVariantivEXT;
+  PFNGLVARIANTSVEXTPROC __glewVariantsvEXT;
+  PFNGLVARIANTUBVEXTPROC __glewVariantubvEXT;
+  PFNGLVARIANTUIVEXTPROC __glewVariantuivEXT;
+  PFNGLVARIANTUSVEXTPROC __glewVariantusvEXT;
+  PFNGLWRITEMASKEXTPROC __glewWriteMaskEXT;
+
+  PFNGLVERTEXWEIGHTPOINTEREXTPROC __glewVertexWeightPointerEXT;
+  PFNGLVERTEXWEIGHTFEXTPROC __glewVertexWeightfEXT;
+  PFNGLVERTEXWEIGHTFVEXTPROC __glewVertexWeightfvEXT;
+
+  PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC __glewAcquireKeyedMutexWin32EXT;
+  PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC __glewReleaseKeyedMutexWin32EXT;
+
+  PFNGLWINDOWRECTANGLESEXTPROC __glewWindowRectanglesEXT;
+
+  PFNGLIMPORTSYNCEXTPROC __glewImportSyncEXT;
+
+  PFNGLFRAMETERMINATORGREMEDYPROC __glewFrameTerminatorGREMEDY;
+
+  PFNGLSTRINGMARKERGREMEDYPROC __glewStringMarkerGREMEDY;
+
+  PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC __glewGetImageTransformParameterfvHP;
+  PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC __glewGetImageTransformParameterivHP;
+  PFNGLIMAGETRANSFORMPARAMETERFHPPROC __glewImageTransformParameterfHP;
+  PFNGLIMAGETRANSFORMPARAMETERFVHPPROC __glewImageTransformParameterfvHP;
+  PFNGLIMAGETRANSFORMPARAMETERIHPPROC __glewImageTransformParameteriHP;
+  PFNGLIMAGETRANSFORMPARAMETERIVHPPROC __glewImageTransformParameterivHP;
+
+  PFNGLMULTIMODEDRAWARRAYSIBMPROC __glewMultiModeDrawArraysIBM;
+  PFNGLMULTIMODEDRAWELEMENTSIBMPROC __glewMultiModeDrawElementsIBM;
+
+  PFNGLCOLORPOINTERLISTIBMPROC __glewColorPointerListIBM;
+  PFNGLEDGEFLAGPOINTERLISTIBMPROC __glewEdgeFlagPointerListIBM;
+  PFNGLFOGCOORDPOINTERLISTIBMPROC __glewFogCoordPointerListIBM;
+  PFNGLINDEXPOINTERLISTIBMPROC __glewIndexPointerListIBM;
+  PFNGLNORMALPOINTERLISTIBMPROC __glewNormalPointerListIBM;
+  PFNGLSECONDARYCOLORPOINTERLISTIBMPROC __glewSecondaryColorPointerListIBM;
+  PFNGLTEXCOORDPOINTERLISTIBMPROC __glewTexCoordPointerListIBM;
+  PFNGLVERTEXPOINTERLISTIBMPROC __glewVertexPointerListIBM;
+
+  PFNGLGETTEXTUREHANDLEIMGPROC __glewGetTextureHandleIMG;
+  PFNGLGETTEXTURESAMPLERHANDLEIMGPROC __glewGetTextureSamplerHandleIMG;
+  PFNGLPROGRAMUNIFORMHANDLEUI64IMGPROC __glewProgramUniformHandleui64IMG;
+  PFNGLPROGRAMUNIFORMHANDLEUI64VIMGPROC __glewProgramUniformHandleui64vIMG;
+  PFNGLUNIFORMHANDLEUI64IMGPROC __glewUniformHandleui64IMG;
+  PFNGLUNIFORMHANDLEUI64VIMGPROC __glewUniformHandleui64vIMG;
+
+  PFNGLFRAMEBUFFERTEXTURE2DDOWNSAMPLEIMGPROC __glewFramebufferTexture2DDownsampleIMG;
+  PFNGLFRAMEBUFFERTEXTURELAYERDOWNSAMPLEIMGPROC __glewFramebufferTextureLayerDownsampleIMG;
+
+  PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEIMGPROC __glewFramebufferTexture2DMultisampleIMG;
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLEIMGPROC __glewRenderbufferStorageMultisampleIMG;
+
+  PFNGLMAPTEXTURE2DINTELPROC __glewMapTexture2DINTEL;
+  PFNGLSYNCTEXTUREINTELPROC __glewSyncTextureINTEL;
+  PFNGLUNMAPTEXTURE2DINTELPROC __glewUnmapTexture2DINTEL;
+
+  PFNGLCOLORPOINTERVINTELPROC __glewColorPointervINTEL;
+  PFNGLNORMALPOINTERVINTELPROC __glewNormalPointervINTEL;
+  PFNGLTEXCOORDPOINTERVINTELPROC __glewTexCoordPointervINTEL;
+  PFNGLVERTEXPOINTERVINTELPROC __glewVertexPointervINTEL;
+
+  PFNGLBEGINPERFQUERYINTELPROC __glewBeginPerfQueryINTEL;
+  PFNGLCREATEPERFQUERYINTELPROC __glewCreatePerfQueryINTEL;
+  PFNGLDELETEPERFQUERYINTELPROC __glewDeletePerfQueryINTEL;
+  PFNGLENDPERFQUERYINTELPROC __glewEndPerfQueryINTEL;
+  PFNGLGETFIRSTPERFQUERYIDINTELPROC __glewGetFirstPerfQueryIdINTEL;
+  PFNGLGETNEXTPERFQUERYIDINTELPROC __glewGetNextPerfQueryIdINTEL;
+  PFNGLGETPERFCOUNTERINFOINTELPROC __glewGetPerfCounterInfoINTEL;
+  PFNGLGETPERFQUERYDATAINTELPROC __glewGetPerfQueryDataINTEL;
+  PFNGLGETPERFQUERYIDBYNAMEINTELPROC __glewGetPerfQueryIdByNameINTEL;
+  PFNGLGETPERFQUERYINFOINTELPROC __glewGetPerfQueryInfoINTEL;
+
+  PFNGLTEXSCISSORFUNCINTELPROC __glewTexScissorFuncINTEL;
+  PFNGLTEXSCISSORINTELPROC __glewTexScissorINTEL;
+
+  PFNGLBLENDBARRIERKHRPROC __glewBlendBarrierKHR;
+
+  PFNGLDEBUGMESSAGECALLBACKPROC __glewDebugMessageCallback;
+  PFNGLDEBUGMESSAGECONTROLPROC __glewDebugMessageControl;
+  PFNGLDEBUGMESSAGEINSERTPROC __glewDebugMessageInsert;
+  PFNGLGETDEBUGMESSAGELOGPROC __glewGetDebugMessageLog;
+  PFNGLGETOBJECTLABELPROC __glewGetObjectLabel;
+  PFNGLGETOBJECTPTRLABELPROC __glewGetObjectPtrLabel;
+  PFNGLOBJECTLABELPROC __glewObjectLabel;
+  PFNGLOBJECTPTRLABELPROC __glewObjectPtrLabel;
+  PFNGLPOPDEBUGGROUPPROC __glewPopDebugGroup;
+  PFNGLPUSHDEBUGGROUPPROC __glewPushDebugGroup;
+
+  PFNGLMAXSHADERCOMPILERTHREADSKHRPROC __glewMaxShaderCompilerThreadsKHR;
+
+  PFNGLGETNUNIFORMFVPROC __glewGetnUniformfv;
+  PFNGLGETNUNIFORMIVPROC __glewGetnUniformiv;
+  PFNGLGETNUNIFORMUIVPROC __glewGetnUniformuiv;
+  PFNGLREADNPIXELSPROC __glewReadnPixels;
+
+  PFNGLBUFFERREGIONENABLEDPROC __glewBufferRegionEnabled;
+  PFNGLDELETEBUFFERREGIONPROC __glewDeleteBufferRegion;
+  PFNGLDRAWBUFFERREGIONPROC __glewDrawBufferRegion;
+  PFNGLNEWBUFFERREGIONPROC __glewNewBufferRegion;
+  PFNGLREADBUFFERREGIONPROC __glewReadBufferRegion;
+
+  PFNGLFRAMEBUFFERPARAMETERIMESAPROC __glewFramebufferParameteriMESA;
+  PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC __glewGetFramebufferParameterivMESA;
+
+  PFNGLRESIZEBUFFERSMESAPROC __glewResizeBuffersMESA;
+
+  PFNGLWINDOWPOS2DMESAPROC __glewWindowPos2dMESA;
+  PFNGLWINDOWPOS2DVMESAPROC __glewWindowPos2dvMESA;
+  PFNGLWINDOWPOS2FMESAPROC __glewWindowPos2fMESA;
+  PFNGLWINDOWPOS2FVMESAPROC __glewWindowPos2fvMESA;
+  PFNGLWINDOWPOS2IMESAPROC __glewWindowPos2iMESA;
+  PFNGLWINDOWPOS2IVMESAPROC __glewWindowPos2ivMESA;
+  PFNGLWINDOWPOS2SMESAPROC __glewWindowPos2sMESA;
+  PFNGLWINDOWPOS2SVMESAPROC __glewWindowPos2svMESA;
+  PFNGLWINDOWPOS3DMESAPROC __glewWindowPos3dMESA;
+  PFNGLWINDOWPOS3DVMESAPROC __glewWindowPos3dvMESA;
+  PFNGLWINDOWPOS3FMESAPROC __glewWindowPos3fMESA;
+  PFNGLWINDOWPOS3FVMESAPROC __glewWindowPos3fvMESA;
+  PFNGLWINDOWPOS3IMESAPROC __glewWindowPos3iMESA;
+  PFNGLWINDOWPOS3IVMESAPROC __glewWindowPos3ivMESA;
+  PFNGLWINDOWPOS3SMESAPROC __glewWindowPos3sMESA;
+  PFNGLWINDOWPOS3SVMESAPROC __glewWindowPos3svMESA;
+  PFNGLWINDOWPOS4DMESAPROC __glewWindowPos4dMESA;
+  PFNGLWINDOWPOS4DVMESAPROC __glewWindowPos4dvMESA;
+  PFNGLWINDOWPOS4FMESAPROC __glewWindowPos4fMESA;
+  PFNGLWINDOWPOS4FVMESAPROC __glewWindowPos4fvMESA;
+  PFNGLWINDOWPOS4IMESAPROC __glewWindowPos4iMESA;
+  PFNGLWINDOWPOS4IVMESAPROC __glewWindowPos4ivMESA;
+  PFNGLWINDOWPOS4SMESAPROC __glewWindowPos4sMESA;
+  PFNGLWINDOWPOS4SVMESAPROC __glewWindowPos4svMESA;
+
+  PFNGLBEGINCONDITIONALRENDERNVXPROC __glewBeginConditionalRenderNVX;
+  PFNGLENDCONDITIONALRENDERNVXPROC __glewEndConditionalRenderNVX;
+
+  PFNGLASYNCCOPYBUFFERSUBDATANVXPROC __glewAsyncCopyBufferSubDataNVX;
+  PFNGLASYNCCOPYIMAGESUBDATANVXPROC __glewAsyncCopyImageSubDataNVX;
+  PFNGLMULTICASTSCISSORARRAYVNVXPROC __glewMulticastScissorArrayvNVX;
+  PFNGLMULTICASTVIEWPORTARRAYVNVXPROC __glewMulticastViewportArrayvNVX;
+  PFNGLMULTICASTVIEWPORTPOSITIONWSCALENVXPROC __glewMulticastViewportPositionWScaleNVX;
+  PFNGLUPLOADGPUMASKNVXPROC __glewUploadGpuMaskNVX;
+
+  PFNGLLGPUCOPYIMAGESUBDATANVXPROC __glewLGPUCopyImageSubDataNVX;
+  PFNGLLGPUINTERLOCKNVXPROC __glewLGPUInterlockNVX;
+  PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC __glewLGPUNamedBufferSubDataNVX;
+
+  PFNGLCLIENTWAITSEMAPHOREUI64NVXPROC __glewClientWaitSemaphoreui64NVX;
+  PFNGLSIGNALSEMAPHOREUI64NVXPROC __glewSignalSemaphoreui64NVX;
+  PFNGLWAITSEMAPHOREUI64NVXPROC __glewWaitSemaphoreui64NVX;
+
+  PFNGLSTEREOPARAMETERFNVPROC __glewStereoParameterfNV;
+  PFNGLSTEREOPARAMETERINVPROC __glewStereoParameteriNV;
+
+  PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC __glewAlphaToCoverageDitherControlNV;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC __glewMultiDrawArraysIndirectBindlessNV;
+  PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC __glewMultiDrawElementsIndirectBindlessNV;
+
+  PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC __glewMultiDrawArraysIndirectBindlessCountNV;
+  PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC __glewMultiDrawElementsIndirectBindlessCountNV;
+
+  PFNGLGETIMAGEHANDLENVPROC __glewGetImageHandleNV;
+  PFNGLGETTEXTUREHANDLENVPROC __glewGetTextureHandleNV;
+  PFNGLGETTEXTURESAMPLERHANDLENVPROC __glewGetTextureSamplerHandleNV;
+  PFNGLISIMAGEHANDLERESIDENTNVPROC __glewIsImageHandleResidentNV;
+  PFNGLISTEXTUREHANDLERESIDENTNVPROC __glewIsTextureHandleResidentNV;
+  PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC __glewMakeImageHandleNonResidentNV;
+  PFNGLMAKEIMAGEHANDLERESIDENTNVPROC __glewMakeImageHandleResidentNV;
+  PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC __glewMakeTextureHandleNonResidentNV;
+  PFNGLMAKETEXTUREHANDLERESIDENTNVPROC __glewMakeTextureHandleResidentNV;
+  PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC __glewProgramUniformHandleui64NV;
+  PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC __glewProgramUniformHandleui64vNV;
+  PFNGLUNIFORMHANDLEUI64NVPROC __glewUniformHandleui64NV;
+  PFNGLUNIFORMHANDLEUI64VNVPROC __glewUniformHandleui64vNV;
+
+  PFNGLBLENDBARRIERNVPROC __glewBlendBarrierNV;
+  PFNGLBLENDPARAMETERINVPROC __glewBlendParameteriNV;
+
+  PFNGLVIEWPORTPOSITIONWSCALENVPROC __glewViewportPositionWScaleNV;
+
+  PFNGLCALLCOMMANDLISTNVPROC __glewCallCommandListNV;
+  PFNGLCOMMANDLISTSEGMENTSNVPROC __glewCommandListSegmentsNV;
+  PFNGLCOMPILECOMMANDLISTNVPROC __glewCompileCommandListNV;
+  PFNGLCREATECOMMANDLISTSNVPROC __glewCreateCommandListsNV;
+  PFNGLCREATESTATESNVPROC __glewCreateStatesNV;
+  PFNGLDELETECOMMANDLISTSNVPROC __glewDeleteCommandListsNV;
+  PFNGLDELETESTATESNVPROC __glewDeleteStatesNV;
+  PFNGLDRAWCOMMANDSADDRESSNVPROC __glewDrawCommandsAddressNV;
+  PFNGLDRAWCOMMANDSNVPROC __glewDrawCommandsNV;
+  PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC __glewDrawCommandsStatesAddressNV;
+  PFNGLDRAWCOMMANDSSTATESNVPROC __glewDrawCommandsStatesNV;
+  PFNGLGETCOMMANDHEADERNVPROC __glewGetCommandHeaderNV;
+  PFNGLGETSTAGEINDEXNVPROC __glewGetStageIndexNV;
+  PFNGLISCOMMANDLISTNVPROC __glewIsCommandListNV;
+  PFNGLISSTATENVPROC __glewIsStateNV;
+  PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC __glewListDrawCommandsStatesClientNV;
+  PFNGLSTATECAPTURENVPROC __glewStateCaptureNV;
+
+  PFNGLBEGINCONDITIONALRENDERNVPROC __glewBeginConditionalRenderNV;
+  PFNGLENDCONDITIONALRENDERNVPROC __glewEndConditionalRenderNV;
+
+  PFNGLSUBPIXELPRECISIONBIASNVPROC __glewSubpixelPrecisionBiasNV;
+
+  PFNGLCONSERVATIVERASTERPARAMETERFNVPROC __glewConservativeRasterParameterfNV;
+
+  PFNGLCONSERVATIVERASTERPARAMETERINVPROC __glewConservativeRasterParameteriNV;
+
+  PFNGLCOPYBUFFERSUBDATANVPROC __glewCopyBufferSubDataNV;
+
+  PFNGLCOPYIMAGESUBDATANVPROC __glewCopyImageSubDataNV;
+
+  PFNGLCLEARDEPTHDNVPROC __glewClearDepthdNV;
+  PFNGLDEPTHBOUNDSDNVPROC __glewDepthBoundsdNV;
+  PFNGLDEPTHRANGEDNVPROC __glewDepthRangedNV;
+
+  PFNGLDRAWBUFFERSNVPROC __glewDrawBuffersNV;
+
+  PFNGLDRAWARRAYSINSTANCEDNVPROC __glewDrawArraysInstancedNV;
+  PFNGLDRAWELEMENTSINSTANCEDNVPROC __glewDrawElementsInstancedNV;
+
+  PFNGLDRAWTEXTURENVPROC __glewDrawTextureNV;
+
+  PFNGLDRAWVKIMAGENVPROC __glewDrawVkImageNV;
+  PFNGLGETVKPROCADDRNVPROC __glewGetVkProcAddrNV;
+  PFNGLSIGNALVKFENCENVPROC __glewSignalVkFenceNV;
+  PFNGLSIGNALVKSEMAPHORENVPROC __glewSignalVkSemaphoreNV;
+  PFNGLWAITVKSEMAPHORENVPROC __glewWaitVkSemaphoreNV;
+
+  PFNGLEVALMAPSNVPROC __glewEvalMapsNV;
+  PFNGLGETMAPATTRIBPARAMETERFVNVPROC __glewGetMapAttribParameterfvNV;
+  PFNGLGETMAPATTRIBPARAMETERIVNVPROC __glewGetMapAttribParameterivNV;
+  PFNGLGETMAPCONTROLPOINTSNVPROC __glewGetMapControlPointsNV;
+  PFNGLGETMAPPARAMETERFVNVPROC __glewGetMapParameterfvNV;
+  PFNGLGETMAPPARAMETERIVNVPROC __glewGetMapParameterivNV;
+  PFNGLMAPCONTROLPOINTSNVPROC __glewMapControlPointsNV;
+  PFNGLMAPPARAMETERFVNVPROC __glewMapParameterfvNV;
+  PFNGLMAPPARAMETERIVNVPROC __glewMapParameterivNV;
+
+  PFNGLGETMULTISAMPLEFVNVPROC __glewGetMultisamplefvNV;
+  PFNGLSAMPLEMASKINDEXEDNVPROC __glewSampleMaskIndexedNV;
+  PFNGLTEXRENDERBUFFERNVPROC __glewTexRenderbufferNV;
+
+  PFNGLDELETEFENCESNVPROC __glewDeleteFencesNV;
+  PFNGLFINISHFENCENVPROC __glewFinishFenceNV;
+  PFNGLGENFENCESNVPROC __glewGenFencesNV;
+  PFNGLGETFENCEIVNVPROC __glewGetFenceivNV;
+  PFNGLISFENCENVPROC __glewIsFenceNV;
+  PFNGLSETFENCENVPROC __glewSetFenceNV;
+  PFNGLTESTFENCENVPROC __glewTestFenceNV;
+
+  PFNGLFRAGMENTCOVERAGECOLORNVPROC __glewFragmentCoverageColorNV;
+
+  PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC __glewGetProgramNamedParameterdvNV;
+  PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC __glewGetProgramNamedParameterfvNV;
+  PFNGLPROGRAMNAMEDPARAMETER4DNVPROC __glewProgramNamedParameter4dNV;
+  PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC __glewProgramNamedParameter4dvNV;
+  PFNGLPROGRAMNAMEDPARAMETER4FNVPROC __glewProgramNamedParameter4fNV;
+  PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC __glewProgramNamedParameter4fvNV;
+
+  PFNGLBLITFRAMEBUFFERNVPROC __glewBlitFramebufferNV;
+
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLENVPROC __glewRenderbufferStorageMultisampleNV;
+
+  PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC __glewRenderbufferStorageMultisampleCoverageNV;
+
+  PFNGLPROGRAMVERTEXLIMITNVPROC __glewProgramVertexLimitNV;
+
+  PFNGLMULTICASTBARRIERNVPROC __glewMulticastBarrierNV;
+  PFNGLMULTICASTBLITFRAMEBUFFERNVPROC __glewMulticastBlitFramebufferNV;
+  PFNGLMULTICASTBUFFERSUBDATANVPROC __glewMulticastBufferSubDataNV;
+  PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC __glewMulticastCopyBufferSubDataNV;
+  PFNGLMULTICASTCOPYIMAGESUBDATANVPROC __glewMulticastCopyImageSubDataNV;
+  PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC __glewMulticastFramebufferSampleLocationsfvNV;
+  PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC __glewMulticastGetQueryObjecti64vNV;
+  PFNGLMULTICASTGETQUERYOBJECTIVNVPROC __glewMulticastGetQueryObjectivNV;
+  PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC __glewMulticastGetQueryObjectui64vNV;
+  PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC __glewMulticastGetQueryObjectuivNV;
+  PFNGLMULTICASTWAITSYNCNVPROC __glewMulticastWaitSyncNV;
+  PFNGLRENDERGPUMASKNVPROC __glewRenderGpuMaskNV;
+
+  PFNGLPROGRAMENVPARAMETERI4INVPROC __glewProgramEnvParameterI4iNV;
+  PFNGLPROGRAMENVPARAMETERI4IVNVPROC __glewProgramEnvParameterI4ivNV;
+  PFNGLPROGRAMENVPARAMETERI4UINVPROC __glewProgramEnvParameterI4uiNV;
+  PFNGLPROGRAMENVPARAMETERI4UIVNVPROC __glewProgramEnvParameterI4uivNV;
+  PFNGLPROGRAMENVPARAMETERSI4IVNVPROC __glewProgramEnvParametersI4ivNV;
+  PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC __glewProgramEnvParametersI4uivNV;
+  PFNGLPROGRAMLOCALPARAMETERI4INVPROC __glewProgramLocalParameterI4iNV;
+  PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC __glewProgramLocalParameterI4ivNV;
+  PFNGLPROGRAMLOCALPARAMETERI4UINVPROC __glewProgramLocalParameterI4uiNV;
+  PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC __glewProgramLocalParameterI4uivNV;
+  PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC __glewProgramLocalParametersI4ivNV;
+  PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC __glewProgramLocalParametersI4uivNV;
+
+  PFNGLGETUNIFORMI64VNVPROC __glewGetUniformi64vNV;
+  PFNGLGETUNIFORMUI64VNVPROC __glewGetUniformui64vNV;
+  PFNGLPROGRAMUNIFORM1I64NVPROC __glewProgramUniform1i64NV;
+  PFNGLPROGRAMUNIFORM1I64VNVPROC __glewProgramUniform1i64vNV;
+  PFNGLPROGRAMUNIFORM1UI64NVPROC __glewProgramUniform1ui64NV;
+  PFNGLPROGRAMUNIFORM1UI64VNVPROC __glewProgramUniform1ui64vNV;
+  PFNGLPROGRAMUNIFORM2I64NVPROC __glewProgramUniform2i64NV;
+  PFNGLPROGRAMUNIFORM2I64VNVPROC __glewProgramUniform2i64vNV;
+  PFNGLPROGRAMUNIFORM2UI64NVPROC __glewProgramUniform2ui64NV;
+  PFNGLPROGRAMUNIFORM2UI64VNVPROC __glewProgramUniform2ui64vNV;
+  PFNGLPROGRAMUNIFORM3I64NVPROC __glewProgramUniform3i64NV;
+  PFNGLPROGRAMUNIFORM3I64VNVPROC __glewProgramUniform3i64vNV;
+  PFNGLPROGRAMUNIFORM3UI64NVPROC __glewProgramUniform3ui64NV;
+  PFNGLPROGRAMUNIFORM3UI64VNVPROC __glewProgramUniform3ui64vNV;
+  PFNGLPROGRAMUNIFORM4I64NVPROC __glewProgramUniform4i64NV;
+  PFNGLPROGRAMUNIFORM4I64VNVPROC __glewProgramUniform4i64vNV;
+  PFNGLPROGRAMUNIFORM4UI64NVPROC __glewProgramUniform4ui64NV;
+  PFNGLPROGRAMUNIFORM4UI64VNVPROC __glewProgramUniform4ui64vNV;
+  PFNGLUNIFORM1I64NVPROC __glewUniform1i64NV;
+  PFNGLUNIFORM1I64VNVPROC __glewUniform1i64vNV;
+  PFNGLUNIFORM1UI64NVPROC __glewUniform1ui64NV;
+  PFNGLUNIFORM1UI64VNVPROC __glewUniform1ui64vNV;
+  PFNGLUNIFORM2I64NVPROC __glewUniform2i64NV;
+  PFNGLUNIFORM2I64VNVPROC __glewUniform2i64vNV;
+  PFNGLUNIFORM2UI64NVPROC __glewUniform2ui64NV;
+  PFNGLUNIFORM2UI64VNVPROC __glewUniform2ui64vNV;
+  PFNGLUNIFORM3I64NVPROC __glewUniform3i64NV;
+  PFNGLUNIFORM3I64VNVPROC __glewUniform3i64vNV;
+  PFNGLUNIFORM3UI64NVPROC __glewUniform3ui64NV;
+  PFNGLUNIFORM3UI64VNVPROC __glewUniform3ui64vNV;
+  PFNGLUNIFORM4I64NVPROC __glewUniform4i64NV;
+  PFNGLUNIFORM4I64VNVPROC __glewUniform4i64vNV;
+  PFNGLUNIFORM4UI64NVPROC __glewUniform4ui64NV;
+  PFNGLUNIFORM4UI64VNVPROC __glewUniform4ui64vNV;
+
+  PFNGLCOLOR3HNVPROC __glewColor3hNV;
+  PFNGLCOLOR3HVNVPROC __glewColor3hvNV;
+  PFNGLCOLOR4HNVPROC __glewColor4hNV;
+  PFNGLCOLOR4HVNVPROC __glewColor4hvNV;
+  PFNGLFOGCOORDHNVPROC __glewFogCoordhNV;
+  PFNGLFOGCOORDHVNVPROC __glewFogCoordhvNV;
+  PFNGLMULTITEXCOORD1HNVPROC __glewMultiTexCoord1hNV;
+  PFNGLMULTITEXCOORD1HVNVPROC __glewMultiTexCoord1hvNV;
+  PFNGLMULTITEXCOORD2HNVPROC __glewMultiTexCoord2hNV;
+  PFNGLMULTITEXCOORD2HVNVPROC __glewMultiTexCoord2hvNV;
+  PFNGLMULTITEXCOORD3HNVPROC __glewMultiTexCoord3hNV;
+  PFNGLMULTITEXCOORD3HVNVPROC __glewMultiTexCoord3hvNV;
+  PFNGLMULTITEXCOORD4HNVPROC __glewMultiTexCoord4hNV;
+  PFNGLMULTITEXCOORD4HVNVPROC __glewMultiTexCoord4hvNV;
+  PFNGLNORMAL3HNVPROC __glewNormal3hNV;
+  PFNGLNORMAL3HVNVPROC __glewNormal3hvNV;
+  PFNGLSECONDARYCOLOR3HNVPROC __glewSecondaryColor3hNV;
+  PFNGLSECONDARYCOLOR3HVNVPROC __glewSecondaryColor3hvNV;
+  PFNGLTEXCOORD1HNVPROC __glewTexCoord1hNV;
+  PFNGLTEXCOORD1HVNVPROC __glewTexCoord1hvNV;
+  PFNGLTEXCOORD2HNVPROC __glewTexCoord2hNV;
+  PFNGLTEXCOORD2HVNVPROC __glewTexCoord2hvNV;
+  PFNGLTEXCOORD3HNVPROC __glewTexCoord3hNV;
+  PFNGLTEXCOORD3HVNVPROC __glewTexCoord3hvNV;
+  PFNGLTEXCOORD4HNVPROC __glewTexCoord4hNV;
+  PFNGLTEXCOORD4HVNVPROC __glewTexCoord4hvNV;
+  PFNGLVERTEX2HNVPROC __glewVertex2hNV;
+  PFNGLVERTEX2HVNVPROC __glewVertex2hvNV;
+  PFNGLVERTEX3HNVPROC __glewVertex3hNV;
+  PFNGLVERTEX3HVNVPROC __glewVertex3hvNV;
+  PFNGLVERTEX4HNVPROC __glewVertex4hNV;
+  PFNGLVERTEX4HVNVPROC __glewVertex4hvNV;
+  PFNGLVERTEXATTRIB1HNVPROC __glewVertexAttrib1hNV;
+  PFNGLVERTEXATTRIB1HVNVPROC __glewVertexAttrib1hvNV;
+  PFNGLVERTEXATTRIB2HNVPROC __glewVertexAttrib2hNV;
+  PFNGLVERTEXATTRIB2HVNVPROC __glewVertexAttrib2hvNV;
+  PFNGLVERTEXATTRIB3HNVPROC __glewVertexAttrib3hNV;
+  PFNGLVERTEXATTRIB3HVNVPROC __glewVertexAttrib3hvNV;
+  PFNGLVERTEXATTRIB4HNVPROC __glewVertexAttrib4hNV;
+  PFNGLVERTEXATTRIB4HVNVPROC __glewVertexAttrib4hvNV;
+  PFNGLVERTEXATTRIBS1HVNVPROC __glewVertexAttribs1hvNV;
+  PFNGLVERTEXATTRIBS2HVNVPROC __glewVertexAttribs2hvNV;
+  PFNGLVERTEXATTRIBS3HVNVPROC __glewVertexAttribs3hvNV;
+  PFNGLVERTEXATTRIBS4HVNVPROC __glewVertexAttribs4hvNV;
+  PFNGLVERTEXWEIGHTHNVPROC __glewVertexWeighthNV;
+  PFNGLVERTEXWEIGHTHVNVPROC __glewVertexWeighthvNV;
+
+  PFNGLVERTEXATTRIBDIVISORNVPROC __glewVertexAttribDivisorNV;
+
+  PFNGLGETINTERNALFORMATSAMPLEIVNVPROC __glewGetInternalformatSampleivNV;
+
+  PFNGLBUFFERATTACHMEMORYNVPROC __glewBufferAttachMemoryNV;
+  PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC __glewGetMemoryObjectDetachedResourcesuivNV;
+  PFNGLNAMEDBUFFERATTACHMEMORYNVPROC __glewNamedBufferAttachMemoryNV;
+  PFNGLRESETMEMORYOBJECTPARAMETERNVPROC __glewResetMemoryObjectParameterNV;
+  PFNGLTEXATTACHMEMORYNVPROC __glewTexAttachMemoryNV;
+  PFNGLTEXTUREATTACHMEMORYNVPROC __glewTextureAttachMemoryNV;
+
+  PFNGLDRAWMESHTASKSINDIRECTNVPROC __glewDrawMeshTasksIndirectNV;
+  PFNGLDRAWMESHTASKSNVPROC __glewDrawMeshTasksNV;
+  PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC __glewMultiDrawMeshTasksIndirectCountNV;
+  PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC __glewMultiDrawMeshTasksIndirectNV;
+
+  PFNGLUNIFORMMATRIX2X3FVNVPROC __glewUniformMatrix2x3fvNV;
+  PFNGLUNIFORMMATRIX2X4FVNVPROC __glewUniformMatrix2x4fvNV;
+  PFNGLUNIFORMMATRIX3X2FVNVPROC __glewUniformMatrix3x2fvNV;
+  PFNGLUNIFORMMATRIX3X4FVNVPROC __glewUniformMatrix3x4fvNV;
+  PFNGLUNIFORMMATRIX4X2FVNVPROC __glewUniformMatrix4x2fvNV;
+  PFNGLUNIFORMMATRIX4X3FVNVPROC __glewUniformMatrix4x3fvNV;
+
+  PFNGLBEGINOCCLUSIONQUERYNVPROC __glewBeginOcclusionQueryNV;
+  PFNGLDELETEOCCLUSIONQUERIESNVPROC __glewDeleteOcclusionQueriesNV;
+  PFNGLENDOCCLUSIONQUERYNVPROC __glewEndOcclusionQueryNV;
+  PFNGLGENOCCLUSIONQUERIESNVPROC __glewGenOcclusionQueriesNV;
+  PFNGLGETOCCLUSIONQUERYIVNVPROC __glewGetOcclusionQueryivNV;
+  PFNGLGETOCCLUSIONQUERYUIVNVPROC __glewGetOcclusionQueryuivNV;
+  PFNGLISOCCLUSIONQUERYNVPROC __glewIsOcclusionQueryNV;
+
+  PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC __glewProgramBufferParametersIivNV;
+  PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC __glewProgramBufferParametersIuivNV;
+  PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC __glewProgramBufferParametersfvNV;
+
+  PFNGLCOPYPATHNVPROC __glewCopyPathNV;
+  PFNGLCOVERFILLPATHINSTANCEDNVPROC __glewCoverFillPathInstancedNV;
+  PFNGLCOVERFILLPATHNVPROC __glewCoverFillPathNV;
+  PFNGLCOVERSTROKEPATHINSTANCEDNVPROC __glewCoverStrokePathInstancedNV;
+  PFNGLCOVERSTROKEPATHNVPROC __glewCoverStrokePathNV;
+  PFNGLDELETEPATHSNVPROC __glewDeletePathsNV;
+  PFNGLGENPATHSNVPROC __glewGenPathsNV;
+  PFNGLGETPATHCOLORGENFVNVPROC __glewGetPathColorGenfvNV;
+  PFNGLGETPATHCOLORGENIVNVPROC __glewGetPathColorGenivNV;
+  PFNGLGETPATHCOMMANDSNVPROC __glewGetPathCommandsNV;
+  PFNGLGETPATHCOORDSNVPROC __glewGetPathCoordsNV;
+  PFNGLGETPATHDASHARRAYNVPROC __glewGetPathDashArrayNV;
+  PFNGLGETPATHLENGTHNVPROC __glewGetPathLengthNV;
+  PFNGLGETPATHMETRICRANGENVPROC __glewGetPathMetricRangeNV;
+  PFNGLGETPATHMETRICSNVPROC __glewGetPathMetricsNV;
+  PFNGLGETPATHPARAMETERFVNVPROC __glewGetPathParameterfvNV;
+  PFNGLGETPATHPARAMETERIVNVPROC __glewGetPathParameterivNV;
+  PFNGLGETPATHSPACINGNVPROC __glewGetPathSpacingNV;
+  PFNGLGETPATHTEXGENFVNVPROC __glewGetPathTexGenfvNV;
+  PFNGLGETPATHTEXGENIVNVPROC __glewGetPathTexGenivNV;
+  PFNGLGETPROGRAMRESOURCEFVNVPROC __glewGetProgramResourcefvNV;
+  PFNGLINTERPOLATEPATHSNVPROC __glewInterpolatePathsNV;
+  PFNGLISPATHNVPROC __glewIsPathNV;
+  PFNGLISPOINTINFILLPATHNVPROC __glewIsPointInFillPathNV;
+  PFNGLISPOINTINSTROKEPATHNVPROC __glewIsPointInStrokePathNV;
+  PFNGLMATRIXLOAD3X2FNVPROC __glewMatrixLoad3x2fNV;
+  PFNGLMATRIXLOAD3X3FNVPROC __glewMatrixLoad3x3fNV;
+  PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC __glewMatrixLoadTranspose3x3fNV;
+  PFNGLMATRIXMULT3X2FNVPROC __glewMatrixMult3x2fNV;
+  PFNGLMATRIXMULT3X3FNVPROC __glewMatrixMult3x3fNV;
+  PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC __glewMatrixMultTranspose3x3fNV;
+  PFNGLPATHCOLORGENNVPROC __glewPathColorGenNV;
+  PFNGLPATHCOMMANDSNVPROC __glewPathCommandsNV;
+  PFNGLPATHCOORDSNVPROC __glewPathCoordsNV;
+  PFNGLPATHCOVERDEPTHFUNCNVPROC __glewPathCoverDepthFuncNV;
+  PFNGLPATHDASHARRAYNVPROC __glewPathDashArrayNV;
+  PFNGLPATHFOGGENNVPROC __glewPathFogGenNV;
+  PFNGLPATHGLYPHINDEXARRAYNVPROC __glewPathGlyphIndexArrayNV;
+  PFNGLPATHGLYPHINDEXRANGENVPROC __glewPathGlyphIndexRangeNV;
+  PFNGLPATHGLYPHRANGENVPROC __glewPathGlyphRangeNV;
+  PFNGLPATHGLYPHSNVPROC __glewPathGlyphsNV;
+  PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC __glewPathMemoryGlyphIndexArrayNV;
+  PFNGLPATHPARAMETERFNVPROC __glewPathParameterfNV;
+  PFNGLPATHPARAMETERFVNVPROC __glewPathParameterfvNV;
+  PFNGLPATHPARAMETERINVPROC __glewPathParameteriNV;
+  PFNGLPATHPARAMETERIVNVPROC __glewPathParameterivNV;
+  PFNGLPATHSTENCILDEPTHOFFSETNVPROC __glewPathStencilDepthOffsetNV;
+  PFNGLPATHSTENCILFUNCNVPROC __glewPathStencilFuncNV;
+  PFNGLPATHSTRINGNVPROC __glewPathStringNV;
+  PFNGLPATHSUBCOMMANDSNVPROC __glewPathSubCommandsNV;
+  PFNGLPATHSUBCOORDSNVPROC __glewPathSubCoordsNV;
+  PFNGLPATHTEXGENNVPROC __glewPathTexGenNV;
+  PFNGLPOINTALONGPATHNVPROC __glewPointAlongPathNV;
+  PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC __glewProgramPathFragmentInputGenNV;
+  PFNGLSTENCILFILLPATHINSTANCEDNVPROC __glewStencilFillPathInstancedNV;
+  PFNGLSTENCILFILLPATHNVPROC __glewStencilFillPathNV;
+  PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC __glewStencilStrokePathInstancedNV;
+  PFNGLSTENCILSTROKEPATHNVPROC __glewStencilStrokePathNV;
+  PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC __glewStencilThenCoverFillPathInstancedNV;
+  PFNGLSTENCILTHENCOVERFILLPATHNVPROC __glewStencilThenCoverFillPathNV;
+  PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC __glewStencilThenCoverStrokePathInstancedNV;
+  PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC __glewStencilThenCoverStrokePathNV;
+  PFNGLTRANSFORMPATHNVPROC __glewTransformPathNV;
+  PFNGLWEIGHTPATHSNVPROC __glewWeightPathsNV;
+
+  PFNGLFLUSHPIXELDATARANGENVPROC __glewFlushPixelDataRangeNV;
+  PFNGLPIXELDATARANGENVPROC __glewPixelDataRangeNV;
+
+  PFNGLPOINTPARAMETERINVPROC __glewPointParameteriNV;
+  PFNGLPOINTPARAMETERIVNVPROC __glewPointParameterivNV;
+
+  PFNGLPOLYGONMODENVPROC __glewPolygonModeNV;
+
+  PFNGLGETVIDEOI64VNVPROC __glewGetVideoi64vNV;
+  PFNGLGETVIDEOIVNVPROC __glewGetVideoivNV;
+  PFNGLGETVIDEOUI64VNVPROC __glewGetVideoui64vNV;
+  PFNGLGETVIDEOUIVNVPROC __glewGetVideouivNV;
+  PFNGLPRESENTFRAMEDUALFILLNVPROC __glewPresentFrameDualFillNV;
+  PFNGLPRESENTFRAMEKEYEDNVPROC __glewPresentFrameKeyedNV;
+
+  PFNGLPRIMITIVERESTARTINDEXNVPROC __glewPrimitiveRestartIndexNV;
+  PFNGLPRIMITIVERESTARTNVPROC __glewPrimitiveRestartNV;
+
+  PFNGLREADBUFFERNVPROC __glewReadBufferNV;
+
+  PFNGLCOMBINERINPUTNVPROC __glewCombinerInputNV;
+  PFNGLCOMBINEROUTPUTNVPROC __glewCombinerOutputNV;
+  PFNGLCOMBINERPARAMETERFNVPROC __glewCombinerParameterfNV;
+  PFNGLCOMBINERPARAMETERFVNVPROC __glewCombinerParameterfvNV;
+  PFNGLCOMBINERPARAMETERINVPROC __glewCombinerParameteriNV;
+  PFNGLCOMBINERPARAMETERIVNVPROC __glewCombinerParameterivNV;
+  PFNGLFINALCOMBINERINPUTNVPROC __glewFinalCombinerInputNV;
+  PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC __glewGetCombinerInputParameterfvNV;
+  PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC __glewGetCombinerInputParameterivNV;
+  PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC __glewGetCombinerOutputParameterfvNV;
+  PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC __glewGetCombinerOutputParameterivNV;
+  PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC __glewGetFinalCombinerInputParameterfvNV;
+  PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC __glewGetFinalCombinerInputParameterivNV;
+
+  PFNGLCOMBINERSTAGEPARAMETERFVNVPROC __glewCombinerStageParameterfvNV;
+  PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC __glewGetCombinerStageParameterfvNV;
+
+  PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC __glewFramebufferSampleLocationsfvNV;
+  PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC __glewNamedFramebufferSampleLocationsfvNV;
+  PFNGLRESOLVEDEPTHVALUESNVPROC __glewResolveDepthValuesNV;
+
+  PFNGLSCISSOREXCLUSIVEARRAYVNVPROC __glewScissorExclusiveArrayvNV;
+  PFNGLSCISSOREXCLUSIVENVPROC __glewScissorExclusiveNV;
+
+  PFNGLGETBUFFERPARAMETERUI64VNVPROC __glewGetBufferParameterui64vNV;
+  PFNGLGETINTEGERUI64VNVPROC __glewGetIntegerui64vNV;
+  PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC __glewGetNamedBufferParameterui64vNV;
+  PFNGLISBUFFERRESIDENTNVPROC __glewIsBufferResidentNV;
+  PFNGLISNAMEDBUFFERRESIDENTNVPROC __glewIsNamedBufferResidentNV;
+  PFNGLMAKEBUFFERNONRESIDENTNVPROC __glewMakeBufferNonResidentNV;
+  PFNGLMAKEBUFFERRESIDENTNVPROC __glewMakeBufferResidentNV;
+  PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC __glewMakeNamedBufferNonResidentNV;
+  PFNGLMAKENAMEDBUFFERRESIDENTNVPROC __glewMakeNamedBufferResidentNV;
+  PFNGLPROGRAMUNIFORMUI64NVPROC __glewProgramUniformui64NV;
+  PFNGLPROGRAMUNIFORMUI64VNVPROC __glewProgramUniformui64vNV;
+  PFNGLUNIFORMUI64NVPROC __glewUniformui64NV;
+  PFNGLUNIFORMUI64VNVPROC __glewUniformui64vNV;
+
+  PFNGLBINDSHADINGRATEIMAGENVPROC __glewBindShadingRateImageNV;
+  PFNGLGETSHADINGRATEIMAGEPALETTENVPROC __glewGetShadingRateImagePaletteNV;
+  PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC __glewGetShadingRateSampleLocationivNV;
+  PFNGLSHADINGRATEIMAGEBARRIERNVPROC __glewShadingRateImageBarrierNV;
+  PFNGLSHADINGRATEIMAGEPALETTENVPROC __glewShadingRateImagePaletteNV;
+  PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC __glewShadingRateSampleOrderCustomNV;
+
+  PFNGLCOMPRESSEDTEXIMAGE3DNVPROC __glewCompressedTexImage3DNV;
+  PFNGLCOMPRESSEDTEXSUBIMAGE3DNVPROC __glewCompressedTexSubImage3DNV;
+  PFNGLCOPYTEXSUBIMAGE3DNVPROC __glewCopyTexSubImage3DNV;
+  PFNGLFRAMEBUFFERTEXTURELAYERNVPROC __glewFramebufferTextureLayerNV;
+  PFNGLTEXIMAGE3DNVPROC __glewTexImage3DNV;
+  PFNGLTEXSUBIMAGE3DNVPROC __glewTexSubImage3DNV;
+
+  PFNGLTEXTUREBARRIERNVPROC __glewTextureBarrierNV;
+
+  PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC __glewTexImage2DMultisampleCoverageNV;
+  PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC __glewTexImage3DMultisampleCoverageNV;
+  PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC __glewTextureImage2DMultisampleCoverageNV;
+  PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC __glewTextureImage2DMultisampleNV;
+  PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC __glewTextureImage3DMultisampleCoverageNV;
+  PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC __glewTextureImage3DMultisampleNV;
+
+  PFNGLACTIVEVARYINGNVPROC __glewActiveVaryingNV;
+  PFNGLBEGINTRANSFORMFEEDBACKNVPROC __glewBeginTransformFeedbackNV;
+  PFNGLBINDBUFFERBASENVPROC __glewBindBufferBaseNV;
+  PFNGLBINDBUFFEROFFSETNVPROC __glewBindBufferOffsetNV;
+  PFNGLBINDBUFFERRANGENVPROC __glewBindBufferRangeNV;
+  PFNGLENDTRANSFORMFEEDBACKNVPROC __glewEndTransformFeedbackNV;
+  PFNGLGETACTIVEVARYINGNVPROC __glewGetActiveVaryingNV;
+  PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC __glewGetTransformFeedbackVaryingNV;
+  PFNGLGETVARYINGLOCATIONNVPROC __glewGetVaryingLocationNV;
+  PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC __glewTransformFeedbackAttribsNV;
+  PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC __glewTransformFeedbackVaryingsNV;
+
+  PFNGLBINDTRANSFORMFEEDBACKNVPROC __glewBindTransformFeedbackNV;
+  PFNGLDELETETRANSFORMFEEDBACKSNVPROC __glewDeleteTransformFeedbacksNV;
+  PFNGLDRAWTRANSFORMFEEDBACKNVPROC __glewDrawTransformFeedbackNV;
+  PFNGLGENTRANSFORMFEEDBACKSNVPROC __glewGenTransformFeedbacksNV;
+  PFNGLISTRANSFORMFEEDBACKNVPROC __glewIsTransformFeedbackNV;
+  PFNGLPAUSETRANSFORMFEEDBACKNVPROC __glewPauseTransformFeedbackNV;
+  PFNGLRESUMETRANSFORMFEEDBACKNVPROC __glewResumeTransformFeedbackNV;
+
+  PFNGLVDPAUFININVPROC __glewVDPAUFiniNV;
+  PFNGLVDPAUGETSURFACEIVNVPROC __glewVDPAUGetSurfaceivNV;
+  PFNGLVDPAUINITNVPROC __glewVDPAUInitNV;
+  PFNGLVDPAUISSURFACENVPROC __glewVDPAUIsSurfaceNV;
+  PFNGLVDPAUMAPSURFACESNVPROC __glewVDPAUMapSurfacesNV;
+  PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC __glewVDPAURegisterOutputSurfaceNV;
+  PFNGLVDPAUREGISTERVIDEOSURFACENVPROC __glewVDPAURegisterVideoSurfaceNV;
+  PFNGLVDPAUSURFACEACCESSNVPROC __glewVDPAUSurfaceAccessNV;
+  PFNGLVDPAUUNMAPSURFACESNVPROC __glewVDPAUUnmapSurfacesNV;
+  PFNGLVDPAUUNREGISTERSURFACENVPROC __glewVDPAUUnregisterSurfaceNV;
+
+  PFNGLVDPAUREGISTERVIDEOSURFACEWITHPICTURESTRUCTURENVPROC __glewVDPAURegisterVideoSurfaceWithPictureStructureNV;
+
+  PFNGLFLUSHVERTEXARRAYRANGENVPROC __glewFlushVertexArrayRangeNV;
+  PFNGLVERTEXARRAYRANGENVPROC __glewVertexArrayRangeNV;
+
+  PFNGLGETVERTEXATTRIBLI64VNVPROC __glewGetVertexAttribLi64vNV;
+  PFNGLGETVERTEXATTRIBLUI64VNVPROC __glewGetVertexAttribLui64vNV;
+  PFNGLVERTEXATTRIBL1I64NVPROC __glewVertexAttribL1i64NV;
+  PFNGLVERTEXATTRIBL1I64VNVPROC __glewVertexAttribL1i64vNV;
+  PFNGLVERTEXATTRIBL1UI64NVPROC __glewVertexAttribL1ui64NV;
+  PFNGLVERTEXATTRIBL1UI64VNVPROC __glewVertexAttribL1ui64vNV;
+  PFNGLVERTEXATTRIBL2I64NVPROC __glewVertexAttribL2i64NV;
+  PFNGLVERTEXATTRIBL2I64VNVPROC __glewVertexAttribL2i64vNV;
+  PFNGLVERTEXATTRIBL2UI64NVPROC __glewVertexAttribL2ui64NV;
+  PFNGLVERTEXATTRIBL2UI64VNVPROC __glewVertexAttribL2ui64vNV;
+  PFNGLVERTEXATTRIBL3I64NVPROC __glewVertexAttribL3i64NV;
+  PFNGLVERTEXATTRIBL3I64VNVPROC __glewVertexAttribL3i64vNV;
+  PFNGLVERTEXATTRIBL3UI64NVPROC __glewVertexAttribL3ui64NV;
+  PFNGLVERTEXATTRIBL3UI64VNVPROC __glewVertexAttribL3ui64vNV;
+  PFNGLVERTEXATTRIBL4I64NVPROC __glewVertexAttribL4i64NV;
+  PFNGLVERTEXATTRIBL4I64VNVPROC __glewVertexAttribL4i64vNV;
+  PFNGLVERTEXATTRIBL4UI64NVPROC __glewVertexAttribL4ui64NV;
+  PFNGLVERTEXATTRIBL4UI64VNVPROC __glewVertexAttribL4ui64vNV;
+  PFNGLVERTEXATTRIBLFORMATNVPROC __glewVertexAttribLFormatNV;
+
+  PFNGLBUFFERADDRESSRANGENVPROC __glewBufferAddressRangeNV;
+  PFNGLCOLORFORMATNVPROC __glewColorFormatNV;
+  PFNGLEDGEFLAGFORMATNVPROC __glewEdgeFlagFormatNV;
+  PFNGLFOGCOORDFORMATNVPROC __glewFogCoordFormatNV;
+  PFNGLGETINTEGERUI64I_VNVPROC __glewGetIntegerui64i_vNV;
+  PFNGLINDEXFORMATNVPROC __glewIndexFormatNV;
+  PFNGLNORMALFORMATNVPROC __glewNormalFormatNV;
+  PFNGLSECONDARYCOLORFORMATNVPROC __glewSecondaryColorFormatNV;
+  PFNGLTEXCOORDFORMATNVPROC __glewTexCoordFormatNV;
+  PFNGLVERTEXATTRIBFORMATNVPROC __glewVertexAttribFormatNV;
+  PFNGLVERTEXATTRIBIFORMATNVPROC __glewVertexAttribIFormatNV;
+  PFNGLVERTEXFORMATNVPROC __glewVertexFormatNV;
+
+  PFNGLAREPROGRAMSRESIDENTNVPROC __glewAreProgramsResidentNV;
+  PFNGLBINDPROGRAMNVPROC __glewBindProgramNV;
+  PFNGLDELETEPROGRAMSNVPROC __glewDeleteProgramsNV;
+  PFNGLEXECUTEPROGRAMNVPROC __glewExecuteProgramNV;
+  PFNGLGENPROGRAMSNVPROC __glewGenProgramsNV;
+  PFNGLGETPROGRAMPARAMETERDVNVPROC __glewGetProgramParameterdvNV;
+  PFNGLGETPROGRAMPARAMETERFVNVPROC __glewGetProgramParameterfvNV;
+  PFNGLGETPROGRAMSTRINGNVPROC __glewGetProgramStringNV;
+  PFNGLGETPROGRAMIVNVPROC __glewGetProgramivNV;
+  PFNGLGETTRACKMATRIXIVNVPROC __glewGetTrackMatrixivNV;
+  PFNGLGETVERTEXATTRIBPOINTERVNVPROC __glewGetVertexAttribPointervNV;
+  PFNGLGETVERTEXATTRIBDVNVPROC __glewGetVertexAttribdvNV;
+  PFNGLGETVERTEXATTRIBFVNVPROC __glewGetVertexAttribfvNV;
+  PFNGLGETVERTEXATTRIBIVNVPROC __glewGetVertexAttribivNV;
+  PFNGLISPROGRAMNVPROC __glewIsProgramNV;
+  PFNGLLOADPROGRAMNVPROC __glewLoadProgramNV;
+  PFNGLPROGRAMPARAMETER4DNVPROC __glewProgramParameter4dNV;
+  PFNGLPROGRAMPARAMETER4DVNVPROC __glewProgramParameter4dvNV;
+  PFNGLPROGRAMPARAMETER4FNVPROC __glewProgramParameter4fNV;
+  PFNGLPROGRAMPARAMETER4FVNVPROC __glewProgramParameter4fvNV;
+  PFNGLPROGRAMPARAMETERS4DVNVPROC __glewProgramParameters4dvNV;
+  PFNGLPROGRAMPARAMETERS4FVNVPROC __glewProgramParameters4fvNV;
+  PFNGLREQUESTRESIDENTPROGRAMSNVPROC __glewRequestResidentProgramsNV;
+  PFNGLTRACKMATRIXNVPROC __glewTrackMatrixNV;
+  PFNGLVERTEXATTRIB1DNVPROC __glewVertexAttrib1dNV;
+  PFNGLVERTEXATTRIB1DVNVPROC __glewVertexAttrib1dvNV;
+  PFNGLVERTEXATTRIB1FNVPROC __glewVertexAttrib1fNV;
+  PFNGLVERTEXATTRIB1FVNVPROC __glewVertexAttrib1fvNV;
+  PFNGLVERTEXATTRIB1SNVPROC __glewVertexAttrib1sNV;
+  PFNGLVERTEXATTRIB1SVNVPROC __glewVertexAttrib1svNV;
+  PFNGLVERTEXATTRIB2DNVPROC __glewVertexAttrib2dNV;
+  PFNGLVERTEXATTRIB2DVNVPROC __glewVertexAttrib2dvNV;
+  PFNGLVERTEXATTRIB2FNVPROC __glewVertexAttrib2fNV;
+  PFNGLVERTEXATTRIB2FVNVPROC __glewVertexAttrib2fvNV;
+  PFNGLVERTEXATTRIB2SNVPROC __glewVertexAttrib2sNV;
+  PFNGLVERTEXATTRIB2SVNVPROC __glewVertexAttrib2svNV;
+  PFNGLVERTEXATTRIB3DNVPROC __glewVertexAttrib3dNV;
+  PFNGLVERTEXATTRIB3DVNVPROC __glewVertexAttrib3dvNV;
+  PFNGLVERTEXATTRIB3FNVPROC __glewVertexAttrib3fNV;
+  PFNGLVERTEXATTRIB3FVNVPROC __glewVertexAttrib3fvNV;
+  PFNGLVERTEXATTRIB3SNVPROC __glewVertexAttrib3sNV;
+  PFNGLVERTEXATTRIB3SVNVPROC __glewVertexAttrib3svNV;
+  PFNGLVERTEXATTRIB4DNVPROC __glewVertexAttrib4dNV;
+  PFNGLVERTEXATTRIB4DVNVPROC __glewVertexAttrib4dvNV;
+  PFNGLVERTEXATTRIB4FNVPROC __glewVertexAttrib4fNV;
+  PFNGLVERTEXATTRIB4FVNVPROC __glewVertexAttrib4fvNV;
+  PFNGLVERTEXATTRIB4SNVPROC __glewVertexAttrib4sNV;
+  PFNGLVERTEXATTRIB4SVNVPROC __glewVertexAttrib4svNV;
+  PFNGLVERTEXATTRIB4UBNVPROC __glewVertexAttrib4ubNV;
+  PFNGLVERTEXATTRIB4UBVNVPROC __glewVertexAttrib4ubvNV;
+  PFNGLVERTEXATTRIBPOINTERNVPROC __glewVertexAttribPointerNV;
+  PFNGLVERTEXATTRIBS1DVNVPROC __glewVertexAttribs1dvNV;
+  PFNGLVERTEXATTRIBS1FVNVPROC __glewVertexAttribs1fvNV;
+  PFNGLVERTEXATTRIBS1SVNVPROC __glewVertexAttribs1svNV;
+  PFNGLVERTEXATTRIBS2DVNVPROC __glewVertexAttribs2dvNV;
+  PFNGLVERTEXATTRIBS2FVNVPROC __glewVertexAttribs2fvNV;
+  PFNGLVERTEXATTRIBS2SVNVPROC __glewVertexAttribs2svNV;
+  PFNGLVERTEXATTRIBS3DVNVPROC __glewVertexAttribs3dvNV;
+  PFNGLVERTEXATTRIBS3FVNVPROC __glewVertexAttribs3fvNV;
+  PFNGLVERTEXATTRIBS3SVNVPROC __glewVertexAttribs3svNV;
+  PFNGLVERTEXATTRIBS4DVNVPROC __glewVertexAttribs4dvNV;
+  PFNGLVERTEXATTRIBS4FVNVPROC __glewVertexAttribs4fvNV;
+  PFNGLVERTEXATTRIBS4SVNVPROC __glewVertexAttribs4svNV;
+  PFNGLVERTEXATTRIBS4UBVNVPROC __glewVertexAttribs4ubvNV;
+
+  PFNGLBEGINVIDEOCAPTURENVPROC __glewBeginVideoCaptureNV;
+  PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC __glewBindVideoCaptureStreamBufferNV;
+  PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC __glewBindVideoCaptureStreamTextureNV;
+  PFNGLENDVIDEOCAPTURENVPROC __glewEndVideoCaptureNV;
+  PFNGLGETVIDEOCAPTURESTREAMDVNVPROC __glewGetVideoCaptureStreamdvNV;
+  PFNGLGETVIDEOCAPTURESTREAMFVNVPROC __glewGetVideoCaptureStreamfvNV;
+  PFNGLGETVIDEOCAPTURESTREAMIVNVPROC __glewGetVideoCaptureStreamivNV;
+  PFNGLGETVIDEOCAPTUREIVNVPROC __glewGetVideoCaptureivNV;
+  PFNGLVIDEOCAPTURENVPROC __glewVideoCaptureNV;
+  PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC __glewVideoCaptureStreamParameterdvNV;
+  PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC __glewVideoCaptureStreamParameterfvNV;
+  PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC __glewVideoCaptureStreamParameterivNV;
+
+  PFNGLDEPTHRANGEARRAYFVNVPROC __glewDepthRangeArrayfvNV;
+  PFNGLDEPTHRANGEINDEXEDFNVPROC __glewDepthRangeIndexedfNV;
+  PFNGLDISABLEINVPROC __glewDisableiNV;
+  PFNGLENABLEINVPROC __glewEnableiNV;
+  PFNGLGETFLOATI_VNVPROC __glewGetFloati_vNV;
+  PFNGLISENABLEDINVPROC __glewIsEnablediNV;
+  PFNGLSCISSORARRAYVNVPROC __glewScissorArrayvNV;
+  PFNGLSCISSORINDEXEDNVPROC __glewScissorIndexedNV;
+  PFNGLSCISSORINDEXEDVNVPROC __glewScissorIndexedvNV;
+  PFNGLVIEWPORTARRAYVNVPROC __glewViewportArrayvNV;
+  PFNGLVIEWPORTINDEXEDFNVPROC __glewViewportIndexedfNV;
+  PFNGLVIEWPORTINDEXEDFVNVPROC __glewViewportIndexedfvNV;
+
+  PFNGLVIEWPORTSWIZZLENVPROC __glewViewportSwizzleNV;
+
+  PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC __glewEGLImageTargetRenderbufferStorageOES;
+  PFNGLEGLIMAGETARGETTEXTURE2DOESPROC __glewEGLImageTargetTexture2DOES;
+
+  PFNGLBLENDEQUATIONSEPARATEOESPROC __glewBlendEquationSeparateOES;
+
+  PFNGLBLENDFUNCSEPARATEOESPROC __glewBlendFuncSeparateOES;
+
+  PFNGLBLENDEQUATIONOESPROC __glewBlendEquationOES;
+
+  PFNGLCOPYIMAGESUBDATAOESPROC __glewCopyImageSubDataOES;
+
+  PFNGLBLENDEQUATIONSEPARATEIOESPROC __glewBlendEquationSeparateiOES;
+  PFNGLBLENDEQUATIONIOESPROC __glewBlendEquationiOES;
+  PFNGLBLENDFUNCSEPARATEIOESPROC __glewBlendFuncSeparateiOES;
+  PFNGLBLENDFUNCIOESPROC __glewBlendFunciOES;
+  PFNGLCOLORMASKIOESPROC __glewColorMaskiOES;
+  PFNGLDISABLEIOESPROC __glewDisableiOES;
+  PFNGLENABLEIOESPROC __glewEnableiOES;
+  PFNGLISENABLEDIOESPROC __glewIsEnablediOES;
+
+  PFNGLBINDFRAMEBUFFEROESPROC __glewBindFramebufferOES;
+  PFNGLBINDRENDERBUFFEROESPROC __glewBindRenderbufferOES;
+  PFNGLCHECKFRAMEBUFFERSTATUSOESPROC __glewCheckFramebufferStatusOES;
+  PFNGLDELETEFRAMEBUFFERSOESPROC __glewDeleteFramebuffersOES;
+  PFNGLDELETERENDERBUFFERSOESPROC __glewDeleteRenderbuffersOES;
+  PFNGLFRAMEBUFFERRENDERBUFFEROESPROC __glewFramebufferRenderbufferOES;
+  PFNGLFRAMEBUFFERTEXTURE2DOESPROC __glewFramebufferTexture2DOES;
+  PFNGLGENFRAMEBUFFERSOESPROC __glewGenFramebuffersOES;
+  PFNGLGENRENDERBUFFERSOESPROC __glewGenRenderbuffersOES;
+  PFNGLGENERATEMIPMAPOESPROC __glewGenerateMipmapOES;
+  PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVOESPROC __glewGetFramebufferAttachmentParameterivOES;
+  PFNGLGETRENDERBUFFERPARAMETERIVOESPROC __glewGetRenderbufferParameterivOES;
+  PFNGLISFRAMEBUFFEROESPROC __glewIsFramebufferOES;
+  PFNGLISRENDERBUFFEROESPROC __glewIsRenderbufferOES;
+  PFNGLRENDERBUFFERSTORAGEOESPROC __glewRenderbufferStorageOES;
+
+  PFNGLGETPROGRAMBINARYOESPROC __glewGetProgramBinaryOES;
+  PFNGLPROGRAMBINARYOESPROC __glewProgramBinaryOES;
+
+  PFNGLGETBUFFERPOINTERVOESPROC __glewGetBufferPointervOES;
+  PFNGLMAPBUFFEROESPROC __glewMapBufferOES;
+  PFNGLUNMAPBUFFEROESPROC __glewUnmapBufferOES;
+
+  PFNGLCURRENTPALETTEMATRIXOESPROC __glewCurrentPaletteMatrixOES;
+  PFNGLMATRIXINDEXPOINTEROESPROC __glewMatrixIndexPointerOES;
+  PFNGLWEIGHTPOINTEROESPROC __glewWeightPointerOES;
+
+  PFNGLMINSAMPLESHADINGOESPROC __glewMinSampleShadingOES;
+
+  PFNGLCLEARDEPTHFOESPROC __glewClearDepthfOES;
+  PFNGLCLIPPLANEFOESPROC __glewClipPlanefOES;
+  PFNGLDEPTHRANGEFOESPROC __glewDepthRangefOES;
+  PFNGLFRUSTUMFOESPROC __glewFrustumfOES;
+  PFNGLGETCLIPPLANEFOESPROC __glewGetClipPlanefOES;
+  PFNGLORTHOFOESPROC __glewOrthofOES;
+
+  PFNGLCOMPRESSEDTEXIMAGE3DOESPROC __glewCompressedTexImage3DOES;
+  PFNGLCOMPRESSEDTEXSUBIMAGE3DOESPROC __glewCompressedTexSubImage3DOES;
+  PFNGLCOPYTEXSUBIMAGE3DOESPROC __glewCopyTexSubImage3DOES;
+  PFNGLFRAMEBUFFERTEXTURE3DOESPROC __glewFramebufferTexture3DOES;
+  PFNGLTEXIMAGE3DOESPROC __glewTexImage3DOES;
+  PFNGLTEXSUBIMAGE3DOESPROC __glewTexSubImage3DOES;
+
+  PFNGLGETSAMPLERPARAMETERIIVOESPROC __glewGetSamplerParameterIivOES;
+  PFNGLGETSAMPLERPARAMETERIUIVOESPROC __glewGetSamplerParameterIuivOES;
+  PFNGLGETTEXPARAMETERIIVOESPROC __glewGetTexParameterIivOES;
+  PFNGLGETTEXPARAMETERIUIVOESPROC __glewGetTexParameterIuivOES;
+  PFNGLSAMPLERPARAMETERIIVOESPROC __glewSamplerParameterIivOES;
+  PFNGLSAMPLERPARAMETERIUIVOESPROC __glewSamplerParameterIuivOES;
+  PFNGLTEXPARAMETERIIVOESPROC __glewTexParameterIivOES;
+  PFNGLTEXPARAMETERIUIVOESPROC __glewTexParameterIuivOES;
+
+  PFNGLTEXBUFFEROESPROC __glewTexBufferOES;
+  PFNGLTEXBUFFERRANGEOESPROC __glewTexBufferRangeOES;
+
+  PFNGLGETTEXGENFVOESPROC __glewGetTexGenfvOES;
+  PFNGLGETTEXGENIVOESPROC __glewGetTexGenivOES;
+  PFNGLGETTEXGENXVOESPROC __glewGetTexGenxvOES;
+  PFNGLTEXGENFOESPROC __glewTexGenfOES;
+  PFNGLTEXGENFVOESPROC __glewTexGenfvOES;
+  PFNGLTEXGENIOESPROC __glewTexGeniOES;
+  PFNGLTEXGENIVOESPROC __glewTexGenivOES;
+  PFNGLTEXGENXOESPROC __glewTexGenxOES;
+  PFNGLTEXGENXVOESPROC __glewTexGenxvOES;
+
+  PFNGLTEXSTORAGE3DMULTISAMPLEOESPROC __glewTexStorage3DMultisampleOES;
+
+  PFNGLTEXTUREVIEWOESPROC __glewTextureViewOES;
+
+  PFNGLBINDVERTEXARRAYOESPROC __glewBindVertexArrayOES;
+  PFNGLDELETEVERTEXARRAYSOESPROC __glewDeleteVertexArraysOES;
+  PFNGLGENVERTEXARRAYSOESPROC __glewGenVertexArraysOES;
+  PFNGLISVERTEXARRAYOESPROC __glewIsVertexArrayOES;
+
+  PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC __glewFramebufferTextureMultiviewOVR;
+  PFNGLNAMEDFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC __glewNamedFramebufferTextureMultiviewOVR;
+
+  PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC __glewFramebufferTextureMultisampleMultiviewOVR;
+
+  PFNGLALPHAFUNCQCOMPROC __glewAlphaFuncQCOM;
+
+  PFNGLDISABLEDRIVERCONTROLQCOMPROC __glewDisableDriverControlQCOM;
+  PFNGLENABLEDRIVERCONTROLQCOMPROC __glewEnableDriverControlQCOM;
+  PFNGLGETDRIVERCONTROLSTRINGQCOMPROC __glewGetDriverControlStringQCOM;
+  PFNGLGETDRIVERCONTROLSQCOMPROC __glewGetDriverControlsQCOM;
+
+  PFNGLEXTGETBUFFERPOINTERVQCOMPROC __glewExtGetBufferPointervQCOM;
+  PFNGLEXTGETBUFFERSQCOMPROC __glewExtGetBuffersQCOM;
+  PFNGLEXTGETFRAMEBUFFERSQCOMPROC __glewExtGetFramebuffersQCOM;
+  PFNGLEXTGETRENDERBUFFERSQCOMPROC __glewExtGetRenderbuffersQCOM;
+  PFNGLEXTGETTEXLEVELPARAMETERIVQCOMPROC __glewExtGetTexLevelParameterivQCOM;
+  PFNGLEXTGETTEXSUBIMAGEQCOMPROC __glewExtGetTexSubImageQCOM;
+  PFNGLEXTGETTEXTURESQCOMPROC __glewExtGetTexturesQCOM;
+  PFNGLEXTTEXOBJECTSTATEOVERRIDEIQCOMPROC __glewExtTexObjectStateOverrideiQCOM;
+
+  PFNGLEXTGETPROGRAMBINARYSOURCEQCOMPROC __glewExtGetProgramBinarySourceQCOM;
+  PFNGLEXTGETPROGRAMSQCOMPROC __glewExtGetProgramsQCOM;
+  PFNGLEXTGETSHADERSQCOMPROC __glewExtGetShadersQCOM;
+  PFNGLEXTISPROGRAMBINARYQCOMPROC __glewExtIsProgramBinaryQCOM;
+
+  PFNGLFRAMEBUFFERFOVEATIONCONFIGQCOMPROC __glewFramebufferFoveationConfigQCOM;
+  PFNGLFRAMEBUFFERFOVEATIONPARAMETERSQCOMPROC __glewFramebufferFoveationParametersQCOM;
+
+  PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC __glewFramebufferFetchBarrierQCOM;
+
+  PFNGLTEXTUREFOVEATIONPARAMETERSQCOMPROC __glewTextureFoveationParametersQCOM;
+
+  PFNGLENDTILINGQCOMPROC __glewEndTilingQCOM;
+  PFNGLSTARTTILINGQCOMPROC __glewStartTilingQCOM;
+
+  PFNGLALPHAFUNCXPROC __glewAlphaFuncx;
+  PFNGLCLEARCOLORXPROC __glewClearColorx;
+  PFNGLCLEARDEPTHXPROC __glewClearDepthx;
+  PFNGLCOLOR4XPROC __glewColor4x;
+  PFNGLDEPTHRANGEXPROC __glewDepthRangex;
+  PFNGLFOGXPROC __glewFogx;
+  PFNGLFOGXVPROC __glewFogxv;
+  PFNGLFRUSTUMFPROC __glewFrustumf;
+  PFNGLFRUSTUMXPROC __glewFrustumx;
+  PFNGLLIGHTMODELXPROC __glewLightModelx;
+  PFNGLLIGHTMODELXVPROC __glewLightModelxv;
+  PFNGLLIGHTXPROC __glewLightx;
+  PFNGLLIGHTXVPROC __glewLightxv;
+  PFNGLLINEWIDTHXPROC __glewLineWidthx;
+  PFNGLLOADMATRIXXPROC __glewLoadMatrixx;
+  PFNGLMATERIALXPROC __glewMaterialx;
+  PFNGLMATERIALXVPROC __glewMaterialxv;
+  PFNGLMULTMATRIXXPROC __glewMultMatrixx;
+  PFNGLMULTITEXCOORD4XPROC __glewMultiTexCoord4x;
+  PFNGLNORMAL3XPROC __glewNormal3x;
+  PFNGLORTHOFPROC __glewOrthof;
+  PFNGLORTHOXPROC __glewOrthox;
+  PFNGLPOINTSIZEXPROC __glewPointSizex;
+  PFNGLPOLYGONOFFSETXPROC __glewPolygonOffsetx;
+  PFNGLROTATEXPROC __glewRotatex;
+  PFNGLSAMPLECOVERAGEXPROC __glewSampleCoveragex;
+  PFNGLSCALEXPROC __glewScalex;
+  PFNGLTEXENVXPROC __glewTexEnvx;
+  PFNGLTEXENVXVPROC __glewTexEnvxv;
+  PFNGLTEXPARAMETERXPROC __glewTexParameterx;
+  PFNGLTRANSLATEXPROC __glewTranslatex;
+
+  PFNGLCLIPPLANEFPROC __glewClipPlanef;
+  PFNGLCLIPPLANEXPROC __glewClipPlanex;
+  PFNGLGETCLIPPLANEFPROC __glewGetClipPlanef;
+  PFNGLGETCLIPPLANEXPROC __glewGetClipPlanex;
+  PFNGLGETFIXEDVPROC __glewGetFixedv;
+  PFNGLGETLIGHTXVPROC __glewGetLightxv;
+  PFNGLGETMATERIALXVPROC __glewGetMaterialxv;
+  PFNGLGETTEXENVXVPROC __glewGetTexEnvxv;
+  PFNGLGETTEXPARAMETERXVPROC __glewGetTexParameterxv;
+  PFNGLPOINTPARAMETERXPROC __glewPointParameterx;
+  PFNGLPOINTPARAMETERXVPROC __glewPointParameterxv;
+  PFNGLPOINTSIZEPOINTEROESPROC __glewPointSizePointerOES;
+  PFNGLTEXPARAMETERXVPROC __glewTexParameterxv;
+
+  PFNGLERRORSTRINGREGALPROC __glewErrorStringREGAL;
+
+  PFNGLGETEXTENSIONREGALPROC __glewGetExtensionREGAL;
+  PFNGLISSUPPORTEDREGALPROC __glewIsSupportedREGAL;
+
+  PFNGLLOGMESSAGECALLBACKREGALPROC __glewLogMessageCallbackREGAL;
+
+  PFNGLGETPROCADDRESSREGALPROC __glewGetProcAddressREGAL;
+
+  PFNGLDETAILTEXFUNCSGISPROC __glewDetailTexFuncSGIS;
+  PFNGLGETDETAILTEXFUNCSGISPROC __glewGetDetailTexFuncSGIS;
+
+  PFNGLFOGFUNCSGISPROC __glewFogFuncSGIS;
+  PFNGLGETFOGFUNCSGISPROC __glewGetFogFuncSGIS;
+
+  PFNGLSAMPLEMASKSGISPROC __glewSampleMaskSGIS;
+  PFNGLSAMPLEPATTERNSGISPROC __glewSamplePatternSGIS;
+
+  PFNGLINTERLEAVEDTEXTURECOORDSETSSGISPROC __glewInterleavedTextureCoordSetsSGIS;
+  PFNGLSELECTTEXTURECOORDSETSGISPROC __glewSelectTextureCoordSetSGIS;
+  PFNGLSELECTTEXTURESGISPROC __glewSelectTextureSGIS;
+  PFNGLSELECTTEXTURETRANSFORMSGISPROC __glewSelectTextureTransformSGIS;
+
+  PFNGLMULTISAMPLESUBRECTPOSSGISPROC __glewMultisampleSubRectPosSGIS;
+
+  PFNGLGETSHARPENTEXFUNCSGISPROC __glewGetSharpenTexFuncSGIS;
+  PFNGLSHARPENTEXFUNCSGISPROC __glewSharpenTexFuncSGIS;
+
+  PFNGLTEXIMAGE4DSGISPROC __glewTexImage4DSGIS;
+  PFNGLTEXSUBIMAGE4DSGISPROC __glewTexSubImage4DSGIS;
+
+  PFNGLGETTEXFILTERFUNCSGISPROC __glewGetTexFilterFuncSGIS;
+  PFNGLTEXFILTERFUNCSGISPROC __glewTexFilterFuncSGIS;
+
+  PFNGLASYNCMARKERSGIXPROC __glewAsyncMarkerSGIX;
+  PFNGLDELETEASYNCMARKERSSGIXPROC __glewDeleteAsyncMarkersSGIX;
+  PFNGLFINISHASYNCSGIXPROC __glewFinishAsyncSGIX;
+  PFNGLGENASYNCMARKERSSGIXPROC __glewGenAsyncMarkersSGIX;
+  PFNGLISASYNCMARKERSGIXPROC __glewIsAsyncMarkerSGIX;
+  PFNGLPOLLASYNCSGIXPROC __glewPollAsyncSGIX;
+
+  PFNGLADDRESSSPACEPROC __glewAddressSpace;
+  PFNGLDATAPIPEPROC __glewDataPipe;
+
+  PFNGLFLUSHRASTERSGIXPROC __glewFlushRasterSGIX;
+
+  PFNGLFOGLAYERSSGIXPROC __glewFogLayersSGIX;
+  PFNGLGETFOGLAYERSSGIXPROC __glewGetFogLayersSGIX;
+
+  PFNGLTEXTUREFOGSGIXPROC __glewTextureFogSGIX;
+
+  PFNGLFRAGMENTCOLORMATERIALSGIXPROC __glewFragmentColorMaterialSGIX;
+  PFNGLFRAGMENTLIGHTMODELFSGIXPROC __glewFragmentLightModelfSGIX;
+  PFNGLFRAGMENTLIGHTMODELFVSGIXPROC __glewFragmentLightModelfvSGIX;
+  PFNGLFRAGMENTLIGHTMODELISGIXPROC __glewFragmentLightModeliSGIX;
+  PFNGLFRAGMENTLIGHTMODELIVSGIXPROC __glewFragmentLightModelivSGIX;
+  PFNGLFRAGMENTLIGHTFSGIXPROC __glewFragmentLightfSGIX;
+  PFNGLFRAGMENTLIGHTFVSGIXPROC __glewFragmentLightfvSGIX;
+  PFNGLFRAGMENTLIGHTISGIXPROC __glewFragmentLightiSGIX;
+  PFNGLFRAGMENTLIGHTIVSGIXPROC __glewFragmentLightivSGIX;
+  PFNGLFRAGMENTMATERIALFSGIXPROC __glewFragmentMaterialfSGIX;
+  PFNGLFRAGMENTMATERIALFVSGIXPROC __glewFragmentMaterialfvSGIX;
+  PFNGLFRAGMENTMATERIALISGIXPROC __glewFragmentMaterialiSGIX;
+  PFNGLFRAGMENTMATERIALIVSGIXPROC __glewFragmentMaterialivSGIX;
+  PFNGLGETFRAGMENTLIGHTFVSGIXPROC __glewGetFragmentLightfvSGIX;
+  PFNGLGETFRAGMENTLIGHTIVSGIXPROC __glewGetFragmentLightivSGIX;
+  PFNGLGETFRAGMENTMATERIALFVSGIXPROC __glewGetFragmentMaterialfvSGIX;
+  PFNGLGETFRAGMENTMATERIALIVSGIXPROC __glewGetFragmentMaterialivSGIX;
+
+  PFNGLFRAMEZOOMSGIXPROC __glewFrameZoomSGIX;
+
+  PFNGLIGLOOINTERFACESGIXPROC __glewIglooInterfaceSGIX;
+
+  PFNGLALLOCMPEGPREDICTORSSGIXPROC __glewAllocMPEGPredictorsSGIX;
+  PFNGLDELETEMPEGPREDICTORSSGIXPROC __glewDeleteMPEGPredictorsSGIX;
+  PFNGLGENMPEGPREDICTORSSGIXPROC __glewGenMPEGPredictorsSGIX;
+  PFNGLGETMPEGPARAMETERFVSGIXPROC __glewGetMPEGParameterfvSGIX;
+  PFNGLGETMPEGPARAMETERIVSGIXPROC __glewGetMPEGParameterivSGIX;
+  PFNGLGETMPEGPREDICTORSGIXPROC __glewGetMPEGPredictorSGIX;
+  PFNGLGETMPEGQUANTTABLEUBVPROC __glewGetMPEGQuantTableubv;
+  PFNGLISMPEGPREDICTORSGIXPROC __glewIsMPEGPredictorSGIX;
+  PFNGLMPEGPREDICTORSGIXPROC __glewMPEGPredictorSGIX;
+  PFNGLMPEGQUANTTABLEUBVPROC __glewMPEGQuantTableubv;
+  PFNGLSWAPMPEGPREDICTORSSGIXPROC __glewSwapMPEGPredictorsSGIX;
+
+  PFNGLGETNONLINLIGHTFVSGIXPROC __glewGetNonlinLightfvSGIX;
+  PFNGLGETNONLINMATERIALFVSGIXPROC __glewGetNonlinMaterialfvSGIX;
+  PFNGLNONLINLIGHTFVSGIXPROC __glewNonlinLightfvSGIX;
+  PFNGLNONLINMATERIALFVSGIXPROC __glewNonlinMaterialfvSGIX;
+
+  PFNGLPIXELTEXGENSGIXPROC __glewPixelTexGenSGIX;
+
+  PFNGLDEFORMSGIXPROC __glewDeformSGIX;
+  PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC __glewLoadIdentityDeformationMapSGIX;
+
+  PFNGLMESHBREADTHSGIXPROC __glewMeshBreadthSGIX;
+  PFNGLMESHSTRIDESGIXPROC __glewMeshStrideSGIX;
+
+  PFNGLREFERENCEPLANESGIXPROC __glewReferencePlaneSGIX;
+
+  PFNGLSPRITEPARAMETERFSGIXPROC __glewSpriteParameterfSGIX;
+  PFNGLSPRITEPARAMETERFVSGIXPROC __glewSpriteParameterfvSGIX;
+  PFNGLSPRITEPARAMETERISGIXPROC __glewSpriteParameteriSGIX;
+  PFNGLSPRITEPARAMETERIVSGIXPROC __glewSpriteParameterivSGIX;
+
+  PFNGLTAGSAMPLEBUFFERSGIXPROC __glewTagSampleBufferSGIX;
+
+  PFNGLGETVECTOROPERATIONSGIXPROC __glewGetVectorOperationSGIX;
+  PFNGLVECTOROPERATIONSGIXPROC __glewVectorOperationSGIX;
+
+  PFNGLAREVERTEXARRAYSRESIDENTSGIXPROC __glewAreVertexArraysResidentSGIX;
+  PFNGLBINDVERTEXARRAYSGIXPROC __glewBindVertexArraySGIX;
+  PFNGLDELETEVERTEXARRAYSSGIXPROC __glewDeleteVertexArraysSGIX;
+  PFNGLGENVERTEXARRAYSSGIXPROC __glewGenVertexArraysSGIX;
+  PFNGLISVERTEXARRAYSGIXPROC __glewIsVertexArraySGIX;
+  PFNGLPRIORITIZEVERTEXARRAYSSGIXPROC __glewPrioritizeVertexArraysSGIX;
+
+  PFNGLCOLORTABLEPARAMETERFVSGIPROC __glewColorTableParameterfvSGI;
+  PFNGLCOLORTABLEPARAMETERIVSGIPROC __glewColorTableParameterivSGI;
+  PFNGLCOLORTABLESGIPROC __glewColorTableSGI;
+  PFNGLCOPYCOLORTABLESGIPROC __glewCopyColorTableSGI;
+  PFNGLGETCOLORTABLEPARAMETERFVSGIPROC __glewGetColorTableParameterfvSGI;
+  PFNGLGETCOLORTABLEPARAMETERIVSGIPROC __glewGetColorTableParameterivSGI;
+  PFNGLGETCOLORTABLESGIPROC __glewGetColorTableSGI;
+
+  PFNGLGETPIXELTRANSFORMPARAMETERFVSGIPROC __glewGetPixelTransformParameterfvSGI;
+  PFNGLGETPIXELTRANSFORMPARAMETERIVSGIPROC __glewGetPixelTransformParameterivSGI;
+  PFNGLPIXELTRANSFORMPARAMETERFSGIPROC __glewPixelTransformParameterfSGI;
+  PFNGLPIXELTRANSFORMPARAMETERFVSGIPROC __glewPixelTransformParameterfvSGI;
+  PFNGLPIXELTRANSFORMPARAMETERISGIPROC __glewPixelTransformParameteriSGI;
+  PFNGLPIXELTRANSFORMPARAMETERIVSGIPROC __glewPixelTransformParameterivSGI;
+  PFNGLPIXELTRANSFORMSGIPROC __glewPixelTransformSGI;
+
+  PFNGLFINISHTEXTURESUNXPROC __glewFinishTextureSUNX;
+
+  PFNGLGLOBALALPHAFACTORBSUNPROC __glewGlobalAlphaFactorbSUN;
+  PFNGLGLOBALALPHAFACTORDSUNPROC __glewGlobalAlphaFactordSUN;
+  PFNGLGLOBALALPHAFACTORFSUNPROC __glewGlobalAlphaFactorfSUN;
+  PFNGLGLOBALALPHAFACTORISUNPROC __glewGlobalAlphaFactoriSUN;
+  PFNGLGLOBALALPHAFACTORSSUNPROC __glewGlobalAlphaFactorsSUN;
+  PFNGLGLOBALALPHAFACTORUBSUNPROC __glewGlobalAlphaFactorubSUN;
+  PFNGLGLOBALALPHAFACTORUISUNPROC __glewGlobalAlphaFactoruiSUN;
+  PFNGLGLOBALALPHAFACTORUSSUNPROC __glewGlobalAlphaFactorusSUN;
+
+  PFNGLREADVIDEOPIXELSSUNPROC __glewReadVideoPixelsSUN;
+
+  PFNGLREPLACEMENTCODEPOINTERSUNPROC __glewReplacementCodePointerSUN;
+  PFNGLREPLACEMENTCODEUBSUNPROC __glewReplacementCodeubSUN;
+  PFNGLREPLACEMENTCODEUBVSUNPROC __glewReplacementCodeubvSUN;
+  PFNGLREPLACEMENTCODEUISUNPROC __glewReplacementCodeuiSUN;
+  PFNGLREPLACEMENTCODEUIVSUNPROC __glewReplacementCodeuivSUN;
+  PFNGLREPLACEMENTCODEUSSUNPROC __glewReplacementCodeusSUN;
+  PFNGLREPLACEMENTCODEUSVSUNPROC __glewReplacementCodeusvSUN;
+
+  PFNGLCOLOR3FVERTEX3FSUNPROC __glewColor3fVertex3fSUN;
+  PFNGLCOLOR3FVERTEX3FVSUNPROC __glewColor3fVertex3fvSUN;
+  PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC __glewColor4fNormal3fVertex3fSUN;
+  PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewColor4fNormal3fVertex3fvSUN;
+  PFNGLCOLOR4UBVERTEX2FSUNPROC __glewColor4ubVertex2fSUN;
+  PFNGLCOLOR4UBVERTEX2FVSUNPROC __glewColor4ubVertex2fvSUN;
+  PFNGLCOLOR4UBVERTEX3FSUNPROC __glewColor4ubVertex3fSUN;
+  PFNGLCOLOR4UBVERTEX3FVSUNPROC __glewColor4ubVertex3fvSUN;
+  PFNGLNORMAL3FVERTEX3FSUNPROC __glewNormal3fVertex3fSUN;
+  PFNGLNORMAL3FVERTEX3FVSUNPROC __glewNormal3fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC __glewReplacementCodeuiColor3fVertex3fSUN;
+  PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC __glewReplacementCodeuiColor3fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiColor4fNormal3fVertex3fSUN;
+  PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiColor4fNormal3fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC __glewReplacementCodeuiColor4ubVertex3fSUN;
+  PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC __glewReplacementCodeuiColor4ubVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiNormal3fVertex3fSUN;
+  PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiNormal3fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
+  PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
+  PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC __glewReplacementCodeuiTexCoord2fVertex3fSUN;
+  PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC __glewReplacementCodeuiTexCoord2fVertex3fvSUN;
+  PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC __glewReplacementCodeuiVertex3fSUN;
+  PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC __glewReplacementCodeuiVertex3fvSUN;
+  PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC __glewTexCoord2fColor3fVertex3fSUN;
+  PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC __glewTexCoord2fColor3fVertex3fvSUN;
+  PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC __glewTexCoord2fColor4fNormal3fVertex3fSUN;
+  PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewTexCoord2fColor4fNormal3fVertex3fvSUN;
+  PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC __glewTexCoord2fColor4ubVertex3fSUN;
+  PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC __glewTexCoord2fColor4ubVertex3fvSUN;
+  PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC __glewTexCoord2fNormal3fVertex3fSUN;
+  PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC __glewTexCoord2fNormal3fVertex3fvSUN;
+  PFNGLTEXCOORD2FVERTEX3FSUNPROC __glewTexCoord2fVertex3fSUN;
+  PFNGLTEXCOORD2FVERTEX3FVSUNPROC __glewTexCoord2fVertex3fvSUN;
+  PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC __glewTexCoord4fColor4fNormal3fVertex4fSUN;
+  PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC __glewTexCoord4fColor4fNormal3fVertex4fvSUN;
+  PFNGLTEXCOORD4FVERTEX4FSUNPROC __glewTexCoord4fVertex4fSUN;
+  PFNGLTEXCOORD4FVERTEX4FVSUNPROC __glewTexCoord4fVertex4fvSUN;
+
+  PFNGLADDSWAPHINTRECTWINPROC __glewAddSwapHintRectWIN;
+  GLboolean __GLEW_VERSION_1_1;
+  GLboolean __GLEW_VERSION_1_2;
+  GLboolean __GLEW_VERSION_1_2_1;
+  GLboolean __GLEW_VERSION_1_3;
+  GLboolean __GLEW_VERSION_1_4;
+  GLboolean __GLEW_VERSION_1_5;
+  GLboolean __GLEW_VERSION_2_0;
+  GLboolean __GLEW_VERSION_2_1;
+  GLboolean __GLEW_VERSION_3_0;
+  GLboolean __GLEW_VERSION_3_1;
+  GLboolean __GLEW_VERSION_3_2;
+  GLboolean __GLEW_VERSION_3_3;
+  GLboolean __GLEW_VERSION_4_0;
+  GLboolean __GLEW_VERSION_4_1;
+  GLboolean __GLEW_VERSION_4_2;
+  GLboolean __GLEW_VERSION_4_3;
+  GLboolean __GLEW_VERSION_4_4;
+  GLboolean __GLEW_VERSION_4_5;
+  GLboolean __GLEW_VERSION_4_6;
+  GLboolean __GLEW_3DFX_multisample;
+  GLboolean __GLEW_3DFX_tbuffer;
+  GLboolean __GLEW_3DFX_texture_compression_FXT1;
+  GLboolean __GLEW_AMD_blend_minmax_factor;
+  GLboolean __GLEW_AMD_compressed_3DC_texture;
+  GLboolean __GLEW_AMD_compressed_ATC_texture;
+  GLboolean __GLEW_AMD_conservative_depth;
+  GLboolean __GLEW_AMD_debug_output;
+  GLboolean __GLEW_AMD_depth_clamp_separate;
+  GLboolean __GLEW_AMD_draw_buffers_blend;
+  GLboolean __GLEW_AMD_framebuffer_multisample_advanced;
+  GLboolean __GLEW_AMD_framebuffer_sample_positions;
+  GLboolean __GLEW_AMD_gcn_shader;
+  GLboolean __GLEW_AMD_gpu_shader_half_float;
+  GLboolean __GLEW_AMD_gpu_shader_half_float_fetch;
+  GLboolean __GLEW_AMD_gpu_shader_int16;
+  GLboolean __GLEW_AMD_gpu_shader_int64;
+  GLboolean __GLEW_AMD_interleaved_elements;
+  GLboolean __GLEW_AMD_multi_draw_indirect;
+  GLboolean __GLEW_AMD_name_gen_delete;
+  GLboolean __GLEW_AMD_occlusion_query_event;
+  GLboolean __GLEW_AMD_performance_monitor;
+  GLboolean __GLEW_AMD_pinned_memory;
+  GLboolean __GLEW_AMD_program_binary_Z400;
+  GLboolean __GLEW_AMD_query_buffer_object;
+  GLboolean __GLEW_AMD_sample_positions;
+  GLboolean __GLEW_AMD_seamless_cubemap_per_texture;
+  GLboolean __GLEW_AMD_shader_atomic_counter_ops;
+  GLboolean __GLEW_AMD_shader_ballot;
+  GLboolean __GLEW_AMD_shader_explicit_vertex_parameter;
+  GLboolean __GLEW_AMD_shader_image_load_store_lod;
+  GLboolean __GLEW_AMD_shader_stencil_export;
+  GLboolean __GLEW_AMD_shader_stencil_value_export;
+  GLboolean __GLEW_AMD_shader_trinary_minmax;
+  GLboolean __GLEW_AMD_sparse_texture;
+  GLboolean __GLEW_AMD_stencil_operation_extended;
+  GLboolean __GLEW_AMD_texture_gather_bias_lod;
+  GLboolean __GLEW_AMD_texture_texture4;
+  GLboolean __GLEW_AMD_transform_feedback3_lines_triangles;
+  GLboolean __GLEW_AMD_transform_feedback4;
+  GLboolean __GLEW_AMD_vertex_shader_layer;
+  GLboolean __GLEW_AMD_vertex_shader_tessellator;
+  GLboolean __GLEW_AMD_vertex_shader_viewport_index;
+  GLboolean __GLEW_ANDROID_extension_pack_es31a;
+  GLboolean __GLEW_ANGLE_depth_texture;
+  GLboolean __GLEW_ANGLE_framebuffer_blit;
+  GLboolean __GLEW_ANGLE_framebuffer_multisample;
+  GLboolean __GLEW_ANGLE_instanced_arrays;
+  GLboolean __GLEW_ANGLE_pack_reverse_row_order;
+  GLboolean __GLEW_ANGLE_program_binary;
+  GLboolean __GLEW_ANGLE_texture_compression_dxt1;
+  GLboolean __GLEW_ANGLE_texture_compression_dxt3;
+  GLboolean __GLEW_ANGLE_texture_compression_dxt5;
+  GLboolean __GLEW_ANGLE_texture_usage;
+  GLboolean __GLEW_ANGLE_timer_query;
+  GLboolean __GLEW_ANGLE_translated_shader_source;
+  GLboolean __GLEW_APPLE_aux_depth_stencil;
+  GLboolean __GLEW_APPLE_client_storage;
+  GLboolean __GLEW_APPLE_clip_distance;
+  GLboolean __GLEW_APPLE_color_buffer_packed_float;
+  GLboolean __GLEW_APPLE_copy_texture_levels;
+  GLboolean __GLEW_APPLE_element_array;
+  GLboolean __GLEW_APPLE_fence;
+  GLboolean __GLEW_APPLE_float_pixels;
+  GLboolean __GLEW_APPLE_flush_buffer_range;
+  GLboolean __GLEW_APPLE_framebuffer_multisample;
+  GLboolean __GLEW_APPLE_object_purgeable;
+  GLboolean __GLEW_APPLE_pixel_buffer;
+  GLboolean __GLEW_APPLE_rgb_422;
+  GLboolean __GLEW_APPLE_row_bytes;
+  GLboolean __GLEW_APPLE_specular_vector;
+  GLboolean __GLEW_APPLE_sync;
+  GLboolean __GLEW_APPLE_texture_2D_limited_npot;
+  GLboolean __GLEW_APPLE_texture_format_BGRA8888;
+  GLboolean __GLEW_APPLE_texture_max_level;
+  GLboolean __GLEW_APPLE_texture_packed_float;
+  GLboolean __GLEW_APPLE_texture_range;
+  GLboolean __GLEW_APPLE_transform_hint;
+  GLboolean __GLEW_APPLE_vertex_array_object;
+  GLboolean __GLEW_APPLE_vertex_array_range;
+  GLboolean __GLEW_APPLE_vertex_program_evaluators;
+  GLboolean __GLEW_APPLE_ycbcr_422;
+  GLboolean __GLEW_ARB_ES2_compatibility;
+  GLboolean __GLEW_ARB_ES3_1_compatibility;
+  GLboolean __GLEW_ARB_ES3_2_compatibility;
+  GLboolean __GLEW_ARB_ES3_compatibility;
+  GLboolean __GLEW_ARB_arrays_of_arrays;
+  GLboolean __GLEW_ARB_base_instance;
+  GLboolean __GLEW_ARB_bindless_texture;
+  GLboolean __GLEW_ARB_blend_func_extended;
+  GLboolean __GLEW_ARB_buffer_storage;
+  GLboolean __GLEW_ARB_cl_event;
+  GLboolean __GLEW_ARB_clear_buffer_object;
+  GLboolean __GLEW_ARB_clear_texture;
+  GLboolean __GLEW_ARB_clip_control;
+  GLboolean __GLEW_ARB_color_buffer_float;
+  GLboolean __GLEW_ARB_compatibility;
+  GLboolean __GLEW_ARB_compressed_texture_pixel_storage;
+  GLboolean __GLEW_ARB_compute_shader;
+  GLboolean __GLEW_ARB_compute_variable_group_size;
+  GLboolean __GLEW_ARB_conditional_render_inverted;
+  GLboolean __GLEW_ARB_conservative_depth;
+  GLboolean __GLEW_ARB_copy_buffer;
+  GLboolean __GLEW_ARB_copy_image;
+  GLboolean __GLEW_ARB_cull_distance;
+  GLboolean __GLEW_ARB_debug_output;
+  GLboolean __GLEW_ARB_depth_buffer_float;
+  GLboolean __GLEW_ARB_depth_clamp;
+  GLboolean __GLEW_ARB_depth_texture;
+  GLboolean __GLEW_ARB_derivative_control;
+  GLboolean __GLEW_ARB_direct_state_access;
+  GLboolean __GLEW_ARB_draw_buffers;
+  GLboolean __GLEW_ARB_draw_buffers_blend;
+  GLboolean __GLEW_ARB_draw_elements_base_vertex;
+  GLboolean __GLEW_ARB_draw_indirect;
+  GLboolean __GLEW_ARB_draw_instanced;
+  GLboolean __GLEW_ARB_enhanced_layouts;
+  GLboolean __GLEW_ARB_explicit_attrib_location;
+  GLboolean __GLEW_ARB_explicit_uniform_location;
+  GLboolean __GLEW_ARB_fragment_coord_conventions;
+  GLboolean __GLEW_ARB_fragment_layer_viewport;
+  GLboolean __GLEW_ARB_fragment_program;
+  GLboolean __GLEW_ARB_fragment_program_shadow;
+  GLboolean __GLEW_ARB_fragment_shader;
+  GLboolean __GLEW_ARB_fragment_shader_interlock;
+  GLboolean __GLEW_ARB_framebuffer_no_attachments;
+  GLboolean __GLEW_ARB_framebuffer_object;
+  GLboolean __GLEW_ARB_framebuffer_sRGB;
+  GLboolean __GLEW_ARB_geometry_shader4;
+  GLboolean __GLEW_ARB_get_program_binary;
+  GLboolean __GLEW_ARB_get_texture_sub_image;
+  GLboolean __GLEW_ARB_gl_spirv;
+  GLboolean __GLEW_ARB_gpu_shader5;
+  GLboolean __GLEW_ARB_gpu_shader_fp64;
+  GLboolean __GLEW_ARB_gpu_shader_int64;
+  GLboolean __GLEW_ARB_half_float_pixel;
+  GLboolean __GLEW_ARB_half_float_vertex;
+  GLboolean __GLEW_ARB_imaging;
+  GLboolean __GLEW_ARB_indirect_parameters;
+  GLboolean __GLEW_ARB_instanced_arrays;
+  GLboolean __GLEW_ARB_internalformat_query;
+  GLboolean __GLEW_ARB_internalformat_query2;
+  GLboolean __GLEW_ARB_invalidate_subdata;
+  GLboolean __GLEW_ARB_map_buffer_alignment;
+  GLboolean __GLEW_ARB_map_buffer_range;
+  GLboolean __GLEW_ARB_matrix_palette;
+  GLboolean __GLEW_ARB_multi_bind;
+  GLboolean __GLEW_ARB_multi_draw_indirect;
+  GLboolean __GLEW_ARB_multisample;
+  GLboolean __GLEW_ARB_multitexture;
+  GLboolean __GLEW_ARB_occlusion_query;
+  GLboolean __GLEW_ARB_occlusion_query2;
+  GLboolean __GLEW_ARB_parallel_shader_compile;
+  GLboolean __GLEW_ARB_pipeline_statistics_query;
+  GLboolean __GLEW_ARB_pixel_buffer_object;
+  GLboolean __GLEW_ARB_point_parameters;
+  GLboolean __GLEW_ARB_point_sprite;
+  GLboolean __GLEW_ARB_polygon_offset_clamp;
+  GLboolean __GLEW_ARB_post_depth_coverage;
+  GLboolean __GLEW_ARB_program_interface_query;
+  GLboolean __GLEW_ARB_provoking_vertex;
+  GLboolean __GLEW_ARB_query_buffer_object;
+  GLboolean __GLEW_ARB_robust_buffer_access_behavior;
+  GLboolean __GLEW_ARB_robustness;
+  GLboolean __GLEW_ARB_robustness_application_isolation;
+  GLboolean __GLEW_ARB_robustness_share_group_isolation;
+  GLboolean __GLEW_ARB_sample_locations;
+  GLboolean __GLEW_ARB_sample_shading;
+  GLboolean __GLEW_ARB_sampler_objects;
+  GLboolean __GLEW_ARB_seamless_cube_map;
+  GLboolean __GLEW_ARB_seamless_cubemap_per_texture;
+  GLboolean __GLEW_ARB_separate_shader_objects;
+  GLboolean __GLEW_ARB_shader_atomic_counter_ops;
+  GLboolean __GLEW_ARB_shader_atomic_counters;
+  GLboolean __GLEW_ARB_shader_ballot;
+  GLboolean __GLEW_ARB_shader_bit_encoding;
+  GLboolean __GLEW_ARB_shader_clock;
+  GLboolean __GLEW_ARB_shader_draw_parameters;
+  GLboolean __GLEW_ARB_shader_group_vote;
+  GLboolean __GLEW_ARB_shader_image_load_store;
+  GLboolean __GLEW_ARB_shader_image_size;
+  GLboolean __GLEW_ARB_shader_objects;
+  GLboolean __GLEW_ARB_shader_precision;
+  GLboolean __GLEW_ARB_shader_stencil_export;
+  GLboolean __GLEW_ARB_shader_storage_buffer_object;
+  GLboolean __GLEW_ARB_shader_subroutine;
+  GLboolean __GLEW_ARB_shader_texture_image_samples;
+  GLboolean __GLEW_ARB_shader_texture_lod;
+  GLboolean __GLEW_ARB_shader_viewport_layer_array;
+  GLboolean __GLEW_ARB_shading_language_100;
+  GLboolean __GLEW_ARB_shading_language_420pack;
+  GLboolean __GLEW_ARB_shading_language_include;
+  GLboolean __GLEW_ARB_shading_language_packing;
+  GLboolean __GLEW_ARB_shadow;
+  GLboolean __GLEW_ARB_shadow_ambient;
+  GLboolean __GLEW_ARB_sparse_buffer;
+  GLboolean __GLEW_ARB_sparse_texture;
+  GLboolean __GLEW_ARB_sparse_texture2;
+  GLboolean __GLEW_ARB_sparse_texture_clamp;
+  GLboolean __GLEW_ARB_spirv_extensions;
+  GLboolean __GLEW_ARB_stencil_texturing;
+  GLboolean __GLEW_ARB_sync;
+  GLboolean __GLEW_ARB_tessellation_shader;
+  GLboolean __GLEW_ARB_texture_barrier;
+  GLboolean __GLEW_ARB_texture_border_clamp;
+  GLboolean __GLEW_ARB_texture_buffer_object;
+  GLboolean __GLEW_ARB_texture_buffer_object_rgb32;
+  GLboolean __GLEW_ARB_texture_buffer_range;
+  GLboolean __GLEW_ARB_texture_compression;
+  GLboolean __GLEW_ARB_texture_compression_bptc;
+  GLboolean __GLEW_ARB_texture_compression_rgtc;
+  GLboolean __GLEW_ARB_texture_cube_map;
+  GLboolean __GLEW_ARB_texture_cube_map_array;
+  GLboolean __GLEW_ARB_texture_env_add;
+  GLboolean __GLEW_ARB_texture_env_combine;
+  GLboolean __GLEW_ARB_texture_env_crossbar;
+  GLboolean __GLEW_ARB_texture_env_dot3;
+  GLboolean __GLEW_ARB_texture_filter_anisotropic;
+  GLboolean __GLEW_ARB_texture_filter_minmax;
+  GLboolean __GLEW_ARB_texture_float;
+  GLboolean __GLEW_ARB_texture_gather;
+  GLboolean __GLEW_ARB_texture_mirror_clamp_to_edge;
+  GLboolean __GLEW_ARB_texture_mirrored_repeat;
+  GLboolean __GLEW_ARB_texture_multisample;
+  GLboolean __GLEW_ARB_texture_non_power_of_two;
+  GLboolean __GLEW_ARB_texture_query_levels;
+  GLboolean __GLEW_ARB_texture_query_lod;
+  GLboolean __GLEW_ARB_texture_rectangle;
+  GLboolean __GLEW_ARB_texture_rg;
+  GLboolean __GLEW_ARB_texture_rgb10_a2ui;
+  GLboolean __GLEW_ARB_texture_stencil8;
+  GLboolean __GLEW_ARB_texture_storage;
+  GLboolean __GLEW_ARB_texture_storage_multisample;
+  GLboolean __GLEW_ARB_texture_swizzle;
+  GLboolean __GLEW_ARB_texture_view;
+  GLboolean __GLEW_ARB_timer_query;
+  GLboolean __GLEW_ARB_transform_feedback2;
+  GLboolean __GLEW_ARB_transform_feedback3;
+  GLboolean __GLEW_ARB_transform_feedback_instanced;
+  GLboolean __GLEW_ARB_transform_feedback_overflow_query;
+  GLboolean __GLEW_ARB_transpose_matrix;
+  GLboolean __GLEW_ARB_uniform_buffer_object;
+  GLboolean __GLEW_ARB_vertex_array_bgra;
+  GLboolean __GLEW_ARB_vertex_array_object;
+  GLboolean __GLEW_ARB_vertex_attrib_64bit;
+  GLboolean __GLEW_ARB_vertex_attrib_binding;
+  GLboolean __GLEW_ARB_vertex_blend;
+  GLboolean __GLEW_ARB_vertex_buffer_object;
+  GLboolean __GLEW_ARB_vertex_program;
+  GLboolean __GLEW_ARB_vertex_shader;
+  GLboolean __GLEW_ARB_vertex_type_10f_11f_11f_rev;
+  GLboolean __GLEW_ARB_vertex_type_2_10_10_10_rev;
+  GLboolean __GLEW_ARB_viewport_array;
+  GLboolean __GLEW_ARB_window_pos;
+  GLboolean __GLEW_ARM_mali_program_binary;
+  GLboolean __GLEW_ARM_mali_shader_binary;
+  GLboolean __GLEW_ARM_rgba8;
+  GLboolean __GLEW_ARM_shader_framebuffer_fetch;
+  GLboolean __GLEW_ARM_shader_framebuffer_fetch_depth_stencil;
+  GLboolean __GLEW_ARM_texture_unnormalized_coordinates;
+  GLboolean __GLEW_ATIX_point_sprites;
+  GLboolean __GLEW_ATIX_texture_env_combine3;
+  GLboolean __GLEW_ATIX_texture_env_route;
+  GLboolean __GLEW_ATIX_vertex_shader_output_point_size;
+  GLboolean __GLEW_ATI_draw_buffers;
+  GLboolean __GLEW_ATI_element_array;
+  GLboolean __GLEW_ATI_envmap_bumpmap;
+  GLboolean __GLEW_ATI_fragment_shader;
+  GLboolean __GLEW_ATI_map_object_buffer;
+  GLboolean __GLEW_ATI_meminfo;
+  GLboolean __GLEW_ATI_pn_triangles;
+  GLboolean __GLEW_ATI_separate_stencil;
+  GLboolean __GLEW_ATI_shader_texture_lod;
+  GLboolean __GLEW_ATI_text_fragment_shader;
+  GLboolean __GLEW_ATI_texture_compression_3dc;
+  GLboolean __GLEW_ATI_texture_env_combine3;
+  GLboolean __GLEW_ATI_texture_float;
+  GLboolean __GLEW_ATI_texture_mirror_once;
+  GLboolean __GLEW_ATI_vertex_array_object;
+  GLboolean __GLEW_ATI_vertex_attrib_array_object;
+  GLboolean __GLEW_ATI_vertex_streams;
+  GLboolean __GLEW_DMP_program_binary;
+  GLboolean __GLEW_DMP_shader_binary;
+  GLboolean __GLEW_EXT_422_pixels;
+  GLboolean __GLEW_EXT_Cg_shader;
+  GLboolean __GLEW_EXT_EGL_image_array;
+  GLboolean __GLEW_EXT_EGL_image_external_wrap_modes;
+  GLboolean __GLEW_EXT_EGL_image_storage;
+  GLboolean __GLEW_EXT_EGL_sync;
+  GLboolean __GLEW_EXT_YUV_target;
+  GLboolean __GLEW_EXT_abgr;
+  GLboolean __GLEW_EXT_base_instance;
+  GLboolean __GLEW_EXT_bgra;
+  GLboolean __GLEW_EXT_bindable_uniform;
+  GLboolean __GLEW_EXT_blend_color;
+  GLboolean __GLEW_EXT_blend_equation_separate;
+  GLboolean __GLEW_EXT_blend_func_extended;
+  GLboolean __GLEW_EXT_blend_func_separate;
+  GLboolean __GLEW_EXT_blend_logic_op;
+  GLboolean __GLEW_EXT_blend_minmax;
+  GLboolean __GLEW_EXT_blend_subtract;
+  GLboolean __GLEW_EXT_buffer_storage;
+  GLboolean __GLEW_EXT_clear_texture;
+  GLboolean __GLEW_EXT_clip_control;
+  GLboolean __GLEW_EXT_clip_cull_distance;
+  GLboolean __GLEW_EXT_clip_volume_hint;
+  GLboolean __GLEW_EXT_cmyka;
+  GLboolean __GLEW_EXT_color_buffer_float;
+  GLboolean __GLEW_EXT_color_buffer_half_float;
+  GLboolean __GLEW_EXT_color_subtable;
+  GLboolean __GLEW_EXT_compiled_vertex_array;
+  GLboolean __GLEW_EXT_compressed_ETC1_RGB8_sub_texture;
+  GLboolean __GLEW_EXT_conservative_depth;
+  GLboolean __GLEW_EXT_convolution;
+  GLboolean __GLEW_EXT_coordinate_frame;
+  GLboolean __GLEW_EXT_copy_image;
+  GLboolean __GLEW_EXT_copy_texture;
+  GLboolean __GLEW_EXT_cull_vertex;
+  GLboolean __GLEW_EXT_debug_label;
+  GLboolean __GLEW_EXT_debug_marker;
+  GLboolean __GLEW_EXT_depth_bounds_test;
+  GLboolean __GLEW_EXT_depth_clamp;
+  GLboolean __GLEW_EXT_direct_state_access;
+  GLboolean __GLEW_EXT_discard_framebuffer;
+  GLboolean __GLEW_EXT_disjoint_timer_query;
+  GLboolean __GLEW_EXT_draw_buffers;
+  GLboolean __GLEW_EXT_draw_buffers2;
+  GLboolean __GLEW_EXT_draw_buffers_indexed;
+  GLboolean __GLEW_EXT_draw_elements_base_vertex;
+  GLboolean __GLEW_EXT_draw_instanced;
+  GLboolean __GLEW_EXT_draw_range_elements;
+  GLboolean __GLEW_EXT_draw_transform_feedback;
+  GLboolean __GLEW_EXT_external_buffer;
+  GLboolean __GLEW_EXT_float_blend;
+  GLboolean __GLEW_EXT_fog_coord;
+  GLboolean __GLEW_EXT_frag_depth;
+  GLboolean __GLEW_EXT_fragment_lighting;
+  GLboolean __GLEW_EXT_framebuffer_blit;
+  GLboolean __GLEW_EXT_framebuffer_multisample;
+  GLboolean __GLEW_EXT_framebuffer_multisample_blit_scaled;
+  GLboolean __GLEW_EXT_framebuffer_object;
+  GLboolean __GLEW_EXT_framebuffer_sRGB;
+  GLboolean __GLEW_EXT_geometry_point_size;
+  GLboolean __GLEW_EXT_geometry_shader;
+  GLboolean __GLEW_EXT_geometry_shader4;
+  GLboolean __GLEW_EXT_gpu_program_parameters;
+  GLboolean __GLEW_EXT_gpu_shader4;
+  GLboolean __GLEW_EXT_gpu_shader5;
+  GLboolean __GLEW_EXT_histogram;
+  GLboolean __GLEW_EXT_index_array_formats;
+  GLboolean __GLEW_EXT_index_func;
+  GLboolean __GLEW_EXT_index_material;
+  GLboolean __GLEW_EXT_index_texture;
+  GLboolean __GLEW_EXT_instanced_arrays;
+  GLboolean __GLEW_EXT_light_texture;
+  GLboolean __GLEW_EXT_map_buffer_range;
+  GLboolean __GLEW_EXT_memory_object;
+  GLboolean __GLEW_EXT_memory_object_fd;
+  GLboolean __GLEW_EXT_memory_object_win32;
+  GLboolean __GLEW_EXT_misc_attribute;
+  GLboolean __GLEW_EXT_multi_draw_arrays;
+  GLboolean __GLEW_EXT_multi_draw_indirect;
+  GLboolean __GLEW_EXT_multiple_textures;
+  GLboolean __GLEW_EXT_multisample;
+  GLboolean __GLEW_EXT_multisample_compatibility;
+  GLboolean __GLEW_EXT_multisampled_render_to_texture;
+  GLboolean __GLEW_EXT_multisampled_render_to_texture2;
+  GLboolean __GLEW_EXT_multiview_draw_buffers;
+  GLboolean __GLEW_EXT_multiview_tessellation_geometry_shader;
+  GLboolean __GLEW_EXT_multiview_texture_multisample;
+  GLboolean __GLEW_EXT_multiview_timer_query;
+  GLboolean __GLEW_EXT_occlusion_query_boolean;
+  GLboolean __GLEW_EXT_packed_depth_stencil;
+  GLboolean __GLEW_EXT_packed_float;
+  GLboolean __GLEW_EXT_packed_pixels;
+  GLboolean __GLEW_EXT_paletted_texture;
+  GLboolean __GLEW_EXT_pixel_buffer_object;
+  GLboolean __GLEW_EXT_pixel_transform;
+  GLboolean __GLEW_EXT_pixel_transform_color_table;
+  GLboolean __GLEW_EXT_point_parameters;
+  GLboolean __GLEW_EXT_polygon_offset;
+  GLboolean __GLEW_EXT_polygon_offset_clamp;
+  GLboolean __GLEW_EXT_post_depth_coverage;
+  GLboolean __GLEW_EXT_primitive_bounding_box;
+  GLboolean __GLEW_EXT_protected_textures;
+  GLboolean __GLEW_EXT_provoking_vertex;
+  GLboolean __GLEW_EXT_pvrtc_sRGB;
+  GLboolean __GLEW_EXT_raster_multisample;
+  GLboolean __GLEW_EXT_read_format_bgra;
+  GLboolean __GLEW_EXT_render_snorm;
+  GLboolean __GLEW_EXT_rescale_normal;
+  GLboolean __GLEW_EXT_robustness;
+  GLboolean __GLEW_EXT_sRGB;
+  GLboolean __GLEW_EXT_sRGB_write_control;
+  GLboolean __GLEW_EXT_scene_marker;
+  GLboolean __GLEW_EXT_secondary_color;
+  GLboolean __GLEW_EXT_semaphore;
+  GLboolean __GLEW_EXT_semaphore_fd;
+  GLboolean __GLEW_EXT_semaphore_win32;
+  GLboolean __GLEW_EXT_separate_shader_objects;
+  GLboolean __GLEW_EXT_separate_specular_color;
+  GLboolean __GLEW_EXT_shader_framebuffer_fetch;
+  GLboolean __GLEW_EXT_shader_framebuffer_fetch_non_coherent;
+  GLboolean __GLEW_EXT_shader_group_vote;
+  GLboolean __GLEW_EXT_shader_image_load_formatted;
+  GLboolean __GLEW_EXT_shader_image_load_store;
+  GLboolean __GLEW_EXT_shader_implicit_conversions;
+  GLboolean __GLEW_EXT_shader_integer_mix;
+  GLboolean __GLEW_EXT_shader_io_blocks;
+  GLboolean __GLEW_EXT_shader_non_constant_global_initializers;
+  GLboolean __GLEW_EXT_shader_pixel_local_storage;
+  GLboolean __GLEW_EXT_shader_pixel_local_storage2;
+  GLboolean __GLEW_EXT_shader_texture_lod;
+  GLboolean __GLEW_EXT_shadow_funcs;
+  GLboolean __GLEW_EXT_shadow_samplers;
+  GLboolean __GLEW_EXT_shared_texture_palette;
+  GLboolean __GLEW_EXT_sparse_texture;
+  GLboolean __GLEW_EXT_sparse_texture2;
+  GLboolean __GLEW_EXT_static_vertex_array;
+  GLboolean __GLEW_EXT_stencil_clear_tag;
+  GLboolean __GLEW_EXT_stencil_two_side;
+  GLboolean __GLEW_EXT_stencil_wrap;
+  GLboolean __GLEW_EXT_subtexture;
+  GLboolean __GLEW_EXT_tessellation_point_size;
+  GLboolean __GLEW_EXT_tessellation_shader;
+  GLboolean __GLEW_EXT_texture;
+  GLboolean __GLEW_EXT_texture3D;
+  GLboolean __GLEW_EXT_texture_array;
+  GLboolean __GLEW_EXT_texture_border_clamp;
+  GLboolean __GLEW_EXT_texture_buffer;
+  GLboolean __GLEW_EXT_texture_buffer_object;
+  GLboolean __GLEW_EXT_texture_compression_astc_decode_mode;
+  GLboolean __GLEW_EXT_texture_compression_astc_decode_mode_rgb9e5;
+  GLboolean __GLEW_EXT_texture_compression_bptc;
+  GLboolean __GLEW_EXT_texture_compression_dxt1;
+  GLboolean __GLEW_EXT_texture_compression_latc;
+  GLboolean __GLEW_EXT_texture_compression_rgtc;
+  GLboolean __GLEW_EXT_texture_compression_s3tc;
+  GLboolean __GLEW_EXT_texture_compression_s3tc_srgb;
+  GLboolean __GLEW_EXT_texture_cube_map;
+  GLboolean __GLEW_EXT_texture_cube_map_array;
+  GLboolean __GLEW_EXT_texture_edge_clamp;
+  GLboolean __GLEW_EXT_texture_env;
+  GLboolean __GLEW_EXT_texture_env_add;
+  GLboolean __GLEW_EXT_texture_env_combine;
+  GLboolean __GLEW_EXT_texture_env_dot3;
+  GLboolean __GLEW_EXT_texture_filter_anisotropic;
+  GLboolean __GLEW_EXT_texture_filter_minmax;
+  GLboolean __GLEW_EXT_texture_format_BGRA8888;
+  GLboolean __GLEW_EXT_texture_format_sRGB_override;
+  GLboolean __GLEW_EXT_texture_integer;
+  GLboolean __GLEW_EXT_texture_lod_bias;
+  GLboolean __GLEW_EXT_texture_mirror_clamp;
+  GLboolean __GLEW_EXT_texture_mirror_clamp_to_edge;
+  GLboolean __GLEW_EXT_texture_norm16;
+  GLboolean __GLEW_EXT_texture_object;
+  GLboolean __GLEW_EXT_texture_perturb_normal;
+  GLboolean __GLEW_EXT_texture_query_lod;
+  GLboolean __GLEW_EXT_texture_rectangle;
+  GLboolean __GLEW_EXT_texture_rg;
+  GLboolean __GLEW_EXT_texture_sRGB;
+  GLboolean __GLEW_EXT_texture_sRGB_R8;
+  GLboolean __GLEW_EXT_texture_sRGB_RG8;
+  GLboolean __GLEW_EXT_texture_sRGB_decode;
+  GLboolean __GLEW_EXT_texture_shadow_lod;
+  GLboolean __GLEW_EXT_texture_shared_exponent;
+  GLboolean __GLEW_EXT_texture_snorm;
+  GLboolean __GLEW_EXT_texture_storage;
+  GLboolean __GLEW_EXT_texture_swizzle;
+  GLboolean __GLEW_EXT_texture_type_2_10_10_10_REV;
+  GLboolean __GLEW_EXT_texture_view;
+  GLboolean __GLEW_EXT_timer_query;
+  GLboolean __GLEW_EXT_transform_feedback;
+  GLboolean __GLEW_EXT_unpack_subimage;
+  GLboolean __GLEW_EXT_vertex_array;
+  GLboolean __GLEW_EXT_vertex_array_bgra;
+  GLboolean __GLEW_EXT_vertex_array_setXXX;
+  GLboolean __GLEW_EXT_vertex_attrib_64bit;
+  GLboolean __GLEW_EXT_vertex_shader;
+  GLboolean __GLEW_EXT_vertex_weighting;
+  GLboolean __GLEW_EXT_win32_keyed_mutex;
+  GLboolean __GLEW_EXT_window_rectangles;
+  GLboolean __GLEW_EXT_x11_sync_object;
+  GLboolean __GLEW_FJ_shader_binary_GCCSO;
+  GLboolean __GLEW_GREMEDY_frame_terminator;
+  GLboolean __GLEW_GREMEDY_string_marker;
+  GLboolean __GLEW_HP_convolution_border_modes;
+  GLboolean __GLEW_HP_image_transform;
+  GLboolean __GLEW_HP_occlusion_test;
+  GLboolean __GLEW_HP_texture_lighting;
+  GLboolean __GLEW_IBM_cull_vertex;
+  GLboolean __GLEW_IBM_multimode_draw_arrays;
+  GLboolean __GLEW_IBM_rasterpos_clip;
+  GLboolean __GLEW_IBM_static_data;
+  GLboolean __GLEW_IBM_texture_mirrored_repeat;
+  GLboolean __GLEW_IBM_vertex_array_lists;
+  GLboolean __GLEW_IMG_bindless_texture;
+  GLboolean __GLEW_IMG_framebuffer_downsample;
+  GLboolean __GLEW_IMG_multisampled_render_to_texture;
+  GLboolean __GLEW_IMG_program_binary;
+  GLboolean __GLEW_IMG_read_format;
+  GLboolean __GLEW_IMG_shader_binary;
+  GLboolean __GLEW_IMG_texture_compression_pvrtc;
+  GLboolean __GLEW_IMG_texture_compression_pvrtc2;
+  GLboolean __GLEW_IMG_texture_env_enhanced_fixed_function;
+  GLboolean __GLEW_IMG_texture_filter_cubic;
+  GLboolean __GLEW_INGR_color_clamp;
+  GLboolean __GLEW_INGR_interlace_read;
+  GLboolean __GLEW_INTEL_blackhole_render;
+  GLboolean __GLEW_INTEL_conservative_rasterization;
+  GLboolean __GLEW_INTEL_fragment_shader_ordering;
+  GLboolean __GLEW_INTEL_framebuffer_CMAA;
+  GLboolean __GLEW_INTEL_map_texture;
+  GLboolean __GLEW_INTEL_parallel_arrays;
+  GLboolean __GLEW_INTEL_performance_query;
+  GLboolean __GLEW_INTEL_shader_integer_functions2;
+  GLboolean __GLEW_INTEL_texture_scissor;
+  GLboolean __GLEW_KHR_blend_equation_advanced;
+  GLboolean __GLEW_KHR_blend_equation_advanced_coherent;
+  GLboolean __GLEW_KHR_context_flush_control;
+  GLboolean __GLEW_KHR_debug;
+  GLboolean __GLEW_KHR_no_error;
+  GLboolean __GLEW_KHR_parallel_shader_compile;
+  GLboolean __GLEW_KHR_robust_buffer_access_behavior;
+  GLboolean __GLEW_KHR_robustness;
+  GLboolean __GLEW_KHR_shader_subgroup;
+  GLboolean __GLEW_KHR_texture_compression_astc_hdr;
+  GLboolean __GLEW_KHR_texture_compression_astc_ldr;
+  GLboolean __GLEW_KHR_texture_compression_astc_sliced_3d;
+  GLboolean __GLEW_KTX_buffer_region;
+  GLboolean __GLEW_MESAX_texture_stack;
+  GLboolean __GLEW_MESA_framebuffer_flip_y;
+  GLboolean __GLEW_MESA_pack_invert;
+  GLboolean __GLEW_MESA_program_binary_formats;
+  GLboolean __GLEW_MESA_resize_buffers;
+  GLboolean __GLEW_MESA_shader_integer_functions;
+  GLboolean __GLEW_MESA_tile_raster_order;
+  GLboolean __GLEW_MESA_window_pos;
+  GLboolean __GLEW_MESA_ycbcr_texture;
+  GLboolean __GLEW_NVX_blend_equation_advanced_multi_draw_buffers;
+  GLboolean __GLEW_NVX_conditional_render;
+  GLboolean __GLEW_NVX_gpu_memory_info;
+  GLboolean __GLEW_NVX_gpu_multicast2;
+  GLboolean __GLEW_NVX_linked_gpu_multicast;
+  GLboolean __GLEW_NVX_progress_fence;
+  GLboolean __GLEW_NV_3dvision_settings;
+  GLboolean __GLEW_NV_EGL_stream_consumer_external;
+  GLboolean __GLEW_NV_alpha_to_coverage_dither_control;
+  GLboolean __GLEW_NV_bgr;
+  GLboolean __GLEW_NV_bindless_multi_draw_indirect;
+  GLboolean __GLEW_NV_bindless_multi_draw_indirect_count;
+  GLboolean __GLEW_NV_bindless_texture;
+  GLboolean __GLEW_NV_blend_equation_advanced;
+  GLboolean __GLEW_NV_blend_equation_advanced_coherent;
+  GLboolean __GLEW_NV_blend_minmax_factor;
+  GLboolean __GLEW_NV_blend_square;
+  GLboolean __GLEW_NV_clip_space_w_scaling;
+  GLboolean __GLEW_NV_command_list;
+  GLboolean __GLEW_NV_compute_program5;
+  GLboolean __GLEW_NV_compute_shader_derivatives;
+  GLboolean __GLEW_NV_conditional_render;
+  GLboolean __GLEW_NV_conservative_raster;
+  GLboolean __GLEW_NV_conservative_raster_dilate;
+  GLboolean __GLEW_NV_conservative_raster_pre_snap;
+  GLboolean __GLEW_NV_conservative_raster_pre_snap_triangles;
+  GLboolean __GLEW_NV_conservative_raster_underestimation;
+  GLboolean __GLEW_NV_copy_buffer;
+  GLboolean __GLEW_NV_copy_depth_to_color;
+  GLboolean __GLEW_NV_copy_image;
+  GLboolean __GLEW_NV_deep_texture3D;
+  GLboolean __GLEW_NV_depth_buffer_float;
+  GLboolean __GLEW_NV_depth_clamp;
+  GLboolean __GLEW_NV_depth_nonlinear;
+  GLboolean __GLEW_NV_depth_range_unclamped;
+  GLboolean __GLEW_NV_draw_buffers;
+  GLboolean __GLEW_NV_draw_instanced;
+  GLboolean __GLEW_NV_draw_texture;
+  GLboolean __GLEW_NV_draw_vulkan_image;
+  GLboolean __GLEW_NV_evaluators;
+  GLboolean __GLEW_NV_explicit_attrib_location;
+  GLboolean __GLEW_NV_explicit_multisample;
+  GLboolean __GLEW_NV_fbo_color_attachments;
+  GLboolean __GLEW_NV_fence;
+  GLboolean __GLEW_NV_fill_rectangle;
+  GLboolean __GLEW_NV_float_buffer;
+  GLboolean __GLEW_NV_fog_distance;
+  GLboolean __GLEW_NV_fragment_coverage_to_color;
+  GLboolean __GLEW_NV_fragment_program;
+  GLboolean __GLEW_NV_fragment_program2;
+  GLboolean __GLEW_NV_fragment_program4;
+  GLboolean __GLEW_NV_fragment_program_option;
+  GLboolean __GLEW_NV_fragment_shader_barycentric;
+  GLboolean __GLEW_NV_fragment_shader_interlock;
+  GLboolean __GLEW_NV_framebuffer_blit;
+  GLboolean __GLEW_NV_framebuffer_mixed_samples;
+  GLboolean __GLEW_NV_framebuffer_multisample;
+  GLboolean __GLEW_NV_framebuffer_multisample_coverage;
+  GLboolean __GLEW_NV_generate_mipmap_sRGB;
+  GLboolean __GLEW_NV_geometry_program4;
+  GLboolean __GLEW_NV_geometry_shader4;
+  GLboolean __GLEW_NV_geometry_shader_passthrough;
+  GLboolean __GLEW_NV_gpu_multicast;
+  GLboolean __GLEW_NV_gpu_program4;
+  GLboolean __GLEW_NV_gpu_program5;
+  GLboolean __GLEW_NV_gpu_program5_mem_extended;
+  GLboolean __GLEW_NV_gpu_program_fp64;
+  GLboolean __GLEW_NV_gpu_shader5;
+  GLboolean __GLEW_NV_half_float;
+  GLboolean __GLEW_NV_image_formats;
+  GLboolean __GLEW_NV_instanced_arrays;
+  GLboolean __GLEW_NV_internalformat_sample_query;
+  GLboolean __GLEW_NV_light_max_exponent;
+  GLboolean __GLEW_NV_memory_attachment;
+  GLboolean __GLEW_NV_mesh_shader;
+  GLboolean __GLEW_NV_multisample_coverage;
+  GLboolean __GLEW_NV_multisample_filter_hint;
+  GLboolean __GLEW_NV_non_square_matrices;
+  GLboolean __GLEW_NV_occlusion_query;
+  GLboolean __GLEW_NV_pack_subimage;
+  GLboolean __GLEW_NV_packed_depth_stencil;
+  GLboolean __GLEW_NV_packed_float;
+  GLboolean __GLEW_NV_packed_float_linear;
+  GLboolean __GLEW_NV_parameter_buffer_object;
+  GLboolean __GLEW_NV_parameter_buffer_object2;
+  GLboolean __GLEW_NV_path_rendering;
+  GLboolean __GLEW_NV_path_rendering_shared_edge;
+  GLboolean __GLEW_NV_pixel_buffer_object;
+  GLboolean __GLEW_NV_pixel_data_range;
+  GLboolean __GLEW_NV_platform_binary;
+  GLboolean __GLEW_NV_point_sprite;
+  GLboolean __GLEW_NV_polygon_mode;
+  GLboolean __GLEW_NV_present_video;
+  GLboolean __GLEW_NV_primitive_restart;
+  GLboolean __GLEW_NV_query_resource_tag;
+  GLboolean __GLEW_NV_read_buffer;
+  GLboolean __GLEW_NV_read_buffer_front;
+  GLboolean __GLEW_NV_read_depth;
+  GLboolean __GLEW_NV_read_depth_stencil;
+  GLboolean __GLEW_NV_read_stencil;
+  GLboolean __GLEW_NV_register_combiners;
+  GLboolean __GLEW_NV_register_combiners2;
+  GLboolean __GLEW_NV_representative_fragment_test;
+  GLboolean __GLEW_NV_robustness_video_memory_purge;
+  GLboolean __GLEW_NV_sRGB_formats;
+  GLboolean __GLEW_NV_sample_locations;
+  GLboolean __GLEW_NV_sample_mask_override_coverage;
+  GLboolean __GLEW_NV_scissor_exclusive;
+  GLboolean __GLEW_NV_shader_atomic_counters;
+  GLboolean __GLEW_NV_shader_atomic_float;
+  GLboolean __GLEW_NV_shader_atomic_float64;
+  GLboolean __GLEW_NV_shader_atomic_fp16_vector;
+  GLboolean __GLEW_NV_shader_atomic_int64;
+  GLboolean __GLEW_NV_shader_buffer_load;
+  GLboolean __GLEW_NV_shader_noperspective_interpolation;
+  GLboolean __GLEW_NV_shader_storage_buffer_object;
+  GLboolean __GLEW_NV_shader_subgroup_partitioned;
+  GLboolean __GLEW_NV_shader_texture_footprint;
+  GLboolean __GLEW_NV_shader_thread_group;
+  GLboolean __GLEW_NV_shader_thread_shuffle;
+  GLboolean __GLEW_NV_shading_rate_image;
+  GLboolean __GLEW_NV_shadow_samplers_array;
+  GLboolean __GLEW_NV_shadow_samplers_cube;
+  GLboolean __GLEW_NV_stereo_view_rendering;
+  GLboolean __GLEW_NV_tessellation_program5;
+  GLboolean __GLEW_NV_texgen_emboss;
+  GLboolean __GLEW_NV_texgen_reflection;
+  GLboolean __GLEW_NV_texture_array;
+  GLboolean __GLEW_NV_texture_barrier;
+  GLboolean __GLEW_NV_texture_border_clamp;
+  GLboolean __GLEW_NV_texture_compression_latc;
+  GLboolean __GLEW_NV_texture_compression_s3tc;
+  GLboolean __GLEW_NV_texture_compression_s3tc_update;
+  GLboolean __GLEW_NV_texture_compression_vtc;
+  GLboolean __GLEW_NV_texture_env_combine4;
+  GLboolean __GLEW_NV_texture_expand_normal;
+  GLboolean __GLEW_NV_texture_multisample;
+  GLboolean __GLEW_NV_texture_npot_2D_mipmap;
+  GLboolean __GLEW_NV_texture_rectangle;
+  GLboolean __GLEW_NV_texture_rectangle_compressed;
+  GLboolean __GLEW_NV_texture_shader;
+  GLboolean __GLEW_NV_texture_shader2;
+  GLboolean __GLEW_NV_texture_shader3;
+  GLboolean __GLEW_NV_transform_feedback;
+  GLboolean __GLEW_NV_transform_feedback2;
+  GLboolean __GLEW_NV_uniform_buffer_unified_memory;
+  GLboolean __GLEW_NV_vdpau_interop;
+  GLboolean __GLEW_NV_vdpau_interop2;
+  GLboolean __GLEW_NV_vertex_array_range;
+  GLboolean __GLEW_NV_vertex_array_range2;
+  GLboolean __GLEW_NV_vertex_attrib_integer_64bit;
+  GLboolean __GLEW_NV_vertex_buffer_unified_memory;
+  GLboolean __GLEW_NV_vertex_program;
+  GLboolean __GLEW_NV_vertex_program1_1;
+  GLboolean __GLEW_NV_vertex_program2;
+  GLboolean __GLEW_NV_vertex_program2_option;
+  GLboolean __GLEW_NV_vertex_program3;
+  GLboolean __GLEW_NV_vertex_program4;
+  GLboolean __GLEW_NV_video_capture;
+  GLboolean __GLEW_NV_viewport_array;
+  GLboolean __GLEW_NV_viewport_array2;
+  GLboolean __GLEW_NV_viewport_swizzle;
+  GLboolean __GLEW_OES_EGL_image;
+  GLboolean __GLEW_OES_EGL_image_external;
+  GLboolean __GLEW_OES_EGL_image_external_essl3;
+  GLboolean __GLEW_OES_blend_equation_separate;
+  GLboolean __GLEW_OES_blend_func_separate;
+  GLboolean __GLEW_OES_blend_subtract;
+  GLboolean __GLEW_OES_byte_coordinates;
+  GLboolean __GLEW_OES_compressed_ETC1_RGB8_texture;
+  GLboolean __GLEW_OES_compressed_paletted_texture;
+  GLboolean __GLEW_OES_copy_image;
+  GLboolean __GLEW_OES_depth24;
+  GLboolean __GLEW_OES_depth32;
+  GLboolean __GLEW_OES_depth_texture;
+  GLboolean __GLEW_OES_depth_texture_cube_map;
+  GLboolean __GLEW_OES_draw_buffers_indexed;
+  GLboolean __GLEW_OES_draw_texture;
+  GLboolean __GLEW_OES_element_index_uint;
+  GLboolean __GLEW_OES_extended_matrix_palette;
+  GLboolean __GLEW_OES_fbo_render_mipmap;
+  GLboolean __GLEW_OES_fragment_precision_high;
+  GLboolean __GLEW_OES_framebuffer_object;
+  GLboolean __GLEW_OES_geometry_point_size;
+  GLboolean __GLEW_OES_geometry_shader;
+  GLboolean __GLEW_OES_get_program_binary;
+  GLboolean __GLEW_OES_gpu_shader5;
+  GLboolean __GLEW_OES_mapbuffer;
+  GLboolean __GLEW_OES_matrix_get;
+  GLboolean __GLEW_OES_matrix_palette;
+  GLboolean __GLEW_OES_packed_depth_stencil;
+  GLboolean __GLEW_OES_point_size_array;
+  GLboolean __GLEW_OES_point_sprite;
+  GLboolean __GLEW_OES_read_format;
+  GLboolean __GLEW_OES_required_internalformat;
+  GLboolean __GLEW_OES_rgb8_rgba8;
+  GLboolean __GLEW_OES_sample_shading;
+  GLboolean __GLEW_OES_sample_variables;
+  GLboolean __GLEW_OES_shader_image_atomic;
+  GLboolean __GLEW_OES_shader_io_blocks;
+  GLboolean __GLEW_OES_shader_multisample_interpolation;
+  GLboolean __GLEW_OES_single_precision;
+  GLboolean __GLEW_OES_standard_derivatives;
+  GLboolean __GLEW_OES_stencil1;
+  GLboolean __GLEW_OES_stencil4;
+  GLboolean __GLEW_OES_stencil8;
+  GLboolean __GLEW_OES_surfaceless_context;
+  GLboolean __GLEW_OES_tessellation_point_size;
+  GLboolean __GLEW_OES_tessellation_shader;
+  GLboolean __GLEW_OES_texture_3D;
+  GLboolean __GLEW_OES_texture_border_clamp;
+  GLboolean __GLEW_OES_texture_buffer;
+  GLboolean __GLEW_OES_texture_compression_astc;
+  GLboolean __GLEW_OES_texture_cube_map;
+  GLboolean __GLEW_OES_texture_cube_map_array;
+  GLboolean __GLEW_OES_texture_env_crossbar;
+  GLboolean __GLEW_OES_texture_mirrored_repeat;
+  GLboolean __GLEW_OES_texture_npot;
+  GLboolean __GLEW_OES_texture_stencil8;
+  GLboolean __GLEW_OES_texture_storage_multisample_2d_array;
+  GLboolean __GLEW_OES_texture_view;
+  GLboolean __GLEW_OES_vertex_array_object;
+  GLboolean __GLEW_OES_vertex_half_float;
+  GLboolean __GLEW_OES_vertex_type_10_10_10_2;
+  GLboolean __GLEW_OML_interlace;
+  GLboolean __GLEW_OML_resample;
+  GLboolean __GLEW_OML_subsample;
+  GLboolean __GLEW_OVR_multiview;
+  GLboolean __GLEW_OVR_multiview2;
+  GLboolean __GLEW_OVR_multiview_multisampled_render_to_texture;
+  GLboolean __GLEW_PGI_misc_hints;
+  GLboolean __GLEW_PGI_vertex_hints;
+  GLboolean __GLEW_QCOM_YUV_texture_gather;
+  GLboolean __GLEW_QCOM_alpha_test;
+  GLboolean __GLEW_QCOM_binning_control;
+  GLboolean __GLEW_QCOM_driver_control;
+  GLboolean __GLEW_QCOM_extended_get;
+  GLboolean __GLEW_QCOM_extended_get2;
+  GLboolean __GLEW_QCOM_framebuffer_foveated;
+  GLboolean __GLEW_QCOM_perfmon_global_mode;
+  GLboolean __GLEW_QCOM_shader_framebuffer_fetch_noncoherent;
+  GLboolean __GLEW_QCOM_shader_framebuffer_fetch_rate;
+  GLboolean __GLEW_QCOM_texture_foveated;
+  GLboolean __GLEW_QCOM_texture_foveated_subsampled_layout;
+  GLboolean __GLEW_QCOM_tiled_rendering;
+  GLboolean __GLEW_QCOM_writeonly_rendering;
+  GLboolean __GLEW_REGAL_ES1_0_compatibility;
+  GLboolean __GLEW_REGAL_ES1_1_compatibility;
+  GLboolean __GLEW_REGAL_enable;
+  GLboolean __GLEW_REGAL_error_string;
+  GLboolean __GLEW_REGAL_extension_query;
+  GLboolean __GLEW_REGAL_log;
+  GLboolean __GLEW_REGAL_proc_address;
+  GLboolean __GLEW_REND_screen_coordinates;
+  GLboolean __GLEW_S3_s3tc;
+  GLboolean __GLEW_SGIS_clip_band_hint;
+  GLboolean __GLEW_SGIS_color_range;
+  GLboolean __GLEW_SGIS_detail_texture;
+  GLboolean __GLEW_SGIS_fog_function;
+  GLboolean __GLEW_SGIS_generate_mipmap;
+  GLboolean __GLEW_SGIS_line_texgen;
+  GLboolean __GLEW_SGIS_multisample;
+  GLboolean __GLEW_SGIS_multitexture;
+  GLboolean __GLEW_SGIS_pixel_texture;
+  GLboolean __GLEW_SGIS_point_line_texgen;
+  GLboolean __GLEW_SGIS_shared_multisample;
+  GLboolean __GLEW_SGIS_sharpen_texture;
+  GLboolean __GLEW_SGIS_texture4D;
+  GLboolean __GLEW_SGIS_texture_border_clamp;
+  GLboolean __GLEW_SGIS_texture_edge_clamp;
+  GLboolean __GLEW_SGIS_texture_filter4;
+  GLboolean __GLEW_SGIS_texture_lod;
+  GLboolean __GLEW_SGIS_texture_select;
+  GLboolean __GLEW_SGIX_async;
+  GLboolean __GLEW_SGIX_async_histogram;
+  GLboolean __GLEW_SGIX_async_pixel;
+  GLboolean __GLEW_SGIX_bali_g_instruments;
+  GLboolean __GLEW_SGIX_bali_r_instruments;
+  GLboolean __GLEW_SGIX_bali_timer_instruments;
+  GLboolean __GLEW_SGIX_blend_alpha_minmax;
+  GLboolean __GLEW_SGIX_blend_cadd;
+  GLboolean __GLEW_SGIX_blend_cmultiply;
+  GLboolean __GLEW_SGIX_calligraphic_fragment;
+  GLboolean __GLEW_SGIX_clipmap;
+  GLboolean __GLEW_SGIX_color_matrix_accuracy;
+  GLboolean __GLEW_SGIX_color_table_index_mode;
+  GLboolean __GLEW_SGIX_complex_polar;
+  GLboolean __GLEW_SGIX_convolution_accuracy;
+  GLboolean __GLEW_SGIX_cube_map;
+  GLboolean __GLEW_SGIX_cylinder_texgen;
+  GLboolean __GLEW_SGIX_datapipe;
+  GLboolean __GLEW_SGIX_decimation;
+  GLboolean __GLEW_SGIX_depth_pass_instrument;
+  GLboolean __GLEW_SGIX_depth_texture;
+  GLboolean __GLEW_SGIX_dvc;
+  GLboolean __GLEW_SGIX_flush_raster;
+  GLboolean __GLEW_SGIX_fog_blend;
+  GLboolean __GLEW_SGIX_fog_factor_to_alpha;
+  GLboolean __GLEW_SGIX_fog_layers;
+  GLboolean __GLEW_SGIX_fog_offset;
+  GLboolean __GLEW_SGIX_fog_patchy;
+  GLboolean __GLEW_SGIX_fog_scale;
+  GLboolean __GLEW_SGIX_fog_texture;
+  GLboolean __GLEW_SGIX_fragment_lighting_space;
+  GLboolean __GLEW_SGIX_fragment_specular_lighting;
+  GLboolean __GLEW_SGIX_fragments_instrument;
+  GLboolean __GLEW_SGIX_framezoom;
+  GLboolean __GLEW_SGIX_icc_texture;
+  GLboolean __GLEW_SGIX_igloo_interface;
+  GLboolean __GLEW_SGIX_image_compression;
+  GLboolean __GLEW_SGIX_impact_pixel_texture;
+  GLboolean __GLEW_SGIX_instrument_error;
+  GLboolean __GLEW_SGIX_interlace;
+  GLboolean __GLEW_SGIX_ir_instrument1;
+  GLboolean __GLEW_SGIX_line_quality_hint;
+  GLboolean __GLEW_SGIX_list_priority;
+  GLboolean __GLEW_SGIX_mpeg1;
+  GLboolean __GLEW_SGIX_mpeg2;
+  GLboolean __GLEW_SGIX_nonlinear_lighting_pervertex;
+  GLboolean __GLEW_SGIX_nurbs_eval;
+  GLboolean __GLEW_SGIX_occlusion_instrument;
+  GLboolean __GLEW_SGIX_packed_6bytes;
+  GLboolean __GLEW_SGIX_pixel_texture;
+  GLboolean __GLEW_SGIX_pixel_texture_bits;
+  GLboolean __GLEW_SGIX_pixel_texture_lod;
+  GLboolean __GLEW_SGIX_pixel_tiles;
+  GLboolean __GLEW_SGIX_polynomial_ffd;
+  GLboolean __GLEW_SGIX_quad_mesh;
+  GLboolean __GLEW_SGIX_reference_plane;
+  GLboolean __GLEW_SGIX_resample;
+  GLboolean __GLEW_SGIX_scalebias_hint;
+  GLboolean __GLEW_SGIX_shadow;
+  GLboolean __GLEW_SGIX_shadow_ambient;
+  GLboolean __GLEW_SGIX_slim;
+  GLboolean __GLEW_SGIX_spotlight_cutoff;
+  GLboolean __GLEW_SGIX_sprite;
+  GLboolean __GLEW_SGIX_subdiv_patch;
+  GLboolean __GLEW_SGIX_subsample;
+  GLboolean __GLEW_SGIX_tag_sample_buffer;
+  GLboolean __GLEW_SGIX_texture_add_env;
+  GLboolean __GLEW_SGIX_texture_coordinate_clamp;
+  GLboolean __GLEW_SGIX_texture_lod_bias;
+  GLboolean __GLEW_SGIX_texture_mipmap_anisotropic;
+  GLboolean __GLEW_SGIX_texture_multi_buffer;
+  GLboolean __GLEW_SGIX_texture_phase;
+  GLboolean __GLEW_SGIX_texture_range;
+  GLboolean __GLEW_SGIX_texture_scale_bias;
+  GLboolean __GLEW_SGIX_texture_supersample;
+  GLboolean __GLEW_SGIX_vector_ops;
+  GLboolean __GLEW_SGIX_vertex_array_object;
+  GLboolean __GLEW_SGIX_vertex_preclip;
+  GLboolean __GLEW_SGIX_vertex_preclip_hint;
+  GLboolean __GLEW_SGIX_ycrcb;
+  GLboolean __GLEW_SGIX_ycrcb_subsample;
+  GLboolean __GLEW_SGIX_ycrcba;
+  GLboolean __GLEW_SGI_color_matrix;
+  GLboolean __GLEW_SGI_color_table;
+  GLboolean __GLEW_SGI_complex;
+  GLboolean __GLEW_SGI_complex_type;
+  GLboolean __GLEW_SGI_fft;
+  GLboolean __GLEW_SGI_texture_color_table;
+  GLboolean __GLEW_SUNX_constant_data;
+  GLboolean __GLEW_SUN_convolution_border_modes;
+  GLboolean __GLEW_SUN_global_alpha;
+  GLboolean __GLEW_SUN_mesh_array;
+  GLboolean __GLEW_SUN_read_video_pixels;
+  GLboolean __GLEW_SUN_slice_accum;
+  GLboolean __GLEW_SUN_triangle_list;
+  GLboolean __GLEW_SUN_vertex;
+  GLboolean __GLEW_VIV_shader_binary;
+  GLboolean __GLEW_WIN_phong_shading;
+  GLboolean __GLEW_WIN_scene_markerXXX;
+  GLboolean __GLEW_WIN_specular_fog;
+  GLboolean __GLEW_WIN_swap_hint;
+};
+
 /* ------------------------------------------------------------------------- */
 
 /* error codes */
@@ -26386,9 +30472,38 @@ VERSION_MICRO 0
 
 /* API */
 GLEWAPI GLenum GLEWAPIENTRY glewInit (void);
+GLEWAPI GLenum GLEWAPIENTRY glewInitLazy (void);
 GLEWAPI GLboolean GLEWAPIENTRY glewIsSupported (const char *name);
 #define glewIsExtensionSupported(x) glewIsSupported(x)
 
+/* Multiple contexts: a GLEWContext per GL context, current per thread */
+typedef struct GLEWContextStruct GLEWContext;
+GLEWAPI GLenum GLEWAPIENTRY glewContextInitFor (GLEWContext *ctx);
+GLEWAPI GLboolean GLEWAPIENTRY glewContextIsSupported (const GLEWContext *ctx, const char *name);
+GLEWAPI void GLEWAPIENTRY glewSetCurrentContext (GLEWContext *ctx);
+GLEWAPI GLEWContext * GLEWAPIENTRY glewGetCurrentContext (void);
+
+/* Profiling: calls and time per entry point, see GLEW_PROFILE */
+#define GLEW_PROFILE_CSV 1
+#define GLEW_PROFILE_JSON 2
+typedef struct GLEWProfileEntryStruct
+{
+  const char *name;
+  GLuint64 calls;
+  GLuint64 nanoseconds;
+} GLEWProfileEntry;
+GLEWAPI GLuint GLEWAPIENTRY glewProfileSnapshot (GLEWProfileEntry *entries, GLuint size);
+GLEWAPI void GLEWAPIENTRY glewProfileReset (void);
+GLEWAPI GLboolean GLEWAPIENTRY glewProfileDump (const char *filename, GLenum format);
+
+#ifdef GLEW_MX
+#ifndef glewGetContext
+#define glewGetContext() glewGetCurrentContext()
+#endif
+#define GLEW_GET_VAR(x) (*(const GLboolean*)&(glewGetContext()->x))
+#define GLEW_GET_FUN(x) (glewGetContext()->x)
+#endif
+
 #ifndef GLEW_GET_VAR
 #define GLEW_GET_VAR(x) (*(const GLboolean*)&x)
 #endif
@@ -26398,6 +30513,7 @@ GLEWAPI GLboolean GLEWAPIENTRY glewIsSupported (const char *name);
 #endif
 
 GLEWAPI GLboolean glewExperimental;
+GLEWAPI const char* glewCacheFile; /* capability cache, see GLEW_CACHE */
 GLEWAPI GLboolean GLEWAPIENTRY glewGetExtension (const char *name);
 GLEWAPI const GLubyte * GLEWAPIENTRY glewGetErrorString (GLenum error);
 GLEWAPI const GLubyte * GLEWAPIENTRY glewGetString (GLenum name);
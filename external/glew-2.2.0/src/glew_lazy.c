@@ -0,0 +1,20503 @@
+/*
+** The OpenGL Extension Wrangler Library
+** Copyright (C) 2008-2019, Nigel Stewart <nigels[]users sourceforge net>
+** Copyright (C) 2002-2008, Milan Ikits <milan ikits[]ieee org>
+** Copyright (C) 2002-2008, Marcelo E. Magallon <mmagallo[]debian org>
+** Copyright (C) 2002, Lev Povalahev
+** All rights reserved.
+** 
+** Redistribution and use in source and binary forms, with or without 
+** modification, are permitted provided that the following conditions are met:
+** 
+** * Redistributions of source code must retain the above copyright notice, 
+**   this list of conditions and the following disclaimer.
+** * Redistributions in binary form must reproduce the above copyright notice, 
+**   this list of conditions and the following disclaimer in the documentation 
+**   and/or other materials provided with the distribution.
+** * The name of the author may be used to endorse or promote products 
+**   derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+** THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Included by glew.c if GLEW_LAZY is defined */
+
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage3D (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage3D");
+  glCopyTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElements (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5)
+{
+  glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElements");
+  glDrawRangeElements(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3D (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glTexImage3D = (PFNGLTEXIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTexImage3D");
+  glTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage3D (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage3D");
+  glTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glActiveTexture (GLenum a0)
+{
+  glActiveTexture = (PFNGLACTIVETEXTUREPROC)glewGetProcAddress((const GLubyte*)"glActiveTexture");
+  glActiveTexture(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glClientActiveTexture (GLenum a0)
+{
+  glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)glewGetProcAddress((const GLubyte*)"glClientActiveTexture");
+  glClientActiveTexture(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage1D (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void * a6)
+{
+  glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage1D");
+  glCompressedTexImage1D(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage2D (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage2D");
+  glCompressedTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage3D (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage3D");
+  glCompressedTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage1D (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6)
+{
+  glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage1D");
+  glCompressedTexSubImage1D(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage2D (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8)
+{
+  glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage2D");
+  glCompressedTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage3D (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage3D");
+  glCompressedTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTexImage (GLenum a0, GLint a1, void * a2)
+{
+  glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTexImage");
+  glGetCompressedTexImage(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixd (const GLdouble a0[16])
+{
+  glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixd");
+  glLoadTransposeMatrixd(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixf (const GLfloat a0[16])
+{
+  glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixf");
+  glLoadTransposeMatrixf(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixd (const GLdouble a0[16])
+{
+  glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixd");
+  glMultTransposeMatrixd(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixf (const GLfloat a0[16])
+{
+  glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixf");
+  glMultTransposeMatrixf(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1d (GLenum a0, GLdouble a1)
+{
+  glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1d");
+  glMultiTexCoord1d(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1dv (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1dv");
+  glMultiTexCoord1dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1f (GLenum a0, GLfloat a1)
+{
+  glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1f");
+  glMultiTexCoord1f(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1fv (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1fv");
+  glMultiTexCoord1fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1i (GLenum a0, GLint a1)
+{
+  glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1i");
+  glMultiTexCoord1i(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1iv (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1iv");
+  glMultiTexCoord1iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1s (GLenum a0, GLshort a1)
+{
+  glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1s");
+  glMultiTexCoord1s(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1sv (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1sv");
+  glMultiTexCoord1sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2d (GLenum a0, GLdouble a1, GLdouble a2)
+{
+  glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2d");
+  glMultiTexCoord2d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2dv (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2dv");
+  glMultiTexCoord2dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2f (GLenum a0, GLfloat a1, GLfloat a2)
+{
+  glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2f");
+  glMultiTexCoord2f(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2fv (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2fv");
+  glMultiTexCoord2fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2i (GLenum a0, GLint a1, GLint a2)
+{
+  glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2i");
+  glMultiTexCoord2i(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2iv (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2iv");
+  glMultiTexCoord2iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2s (GLenum a0, GLshort a1, GLshort a2)
+{
+  glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2s");
+  glMultiTexCoord2s(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2sv (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2sv");
+  glMultiTexCoord2sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3d (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3d");
+  glMultiTexCoord3d(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3dv (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3dv");
+  glMultiTexCoord3dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3f (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3f");
+  glMultiTexCoord3f(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3fv (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3fv");
+  glMultiTexCoord3fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3i (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3i");
+  glMultiTexCoord3i(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3iv (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3iv");
+  glMultiTexCoord3iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3s (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3s");
+  glMultiTexCoord3s(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3sv (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3sv");
+  glMultiTexCoord3sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4d (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4d");
+  glMultiTexCoord4d(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4dv (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4dv");
+  glMultiTexCoord4dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4f (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4f");
+  glMultiTexCoord4f(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4fv (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4fv");
+  glMultiTexCoord4fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4i (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4i");
+  glMultiTexCoord4i(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4iv (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4iv");
+  glMultiTexCoord4iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4s (GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4s");
+  glMultiTexCoord4s(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4sv (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4sv");
+  glMultiTexCoord4sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleCoverage (GLclampf a0, GLboolean a1)
+{
+  glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glewGetProcAddress((const GLubyte*)"glSampleCoverage");
+  glSampleCoverage(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendColor (GLclampf a0, GLclampf a1, GLclampf a2, GLclampf a3)
+{
+  glBlendColor = (PFNGLBLENDCOLORPROC)glewGetProcAddress((const GLubyte*)"glBlendColor");
+  glBlendColor(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquation (GLenum a0)
+{
+  glBlendEquation = (PFNGLBLENDEQUATIONPROC)glewGetProcAddress((const GLubyte*)"glBlendEquation");
+  glBlendEquation(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparate (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparate");
+  glBlendFuncSeparate(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordPointer (GLenum a0, GLsizei a1, const void * a2)
+{
+  glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)glewGetProcAddress((const GLubyte*)"glFogCoordPointer");
+  glFogCoordPointer(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordd (GLdouble a0)
+{
+  glFogCoordd = (PFNGLFOGCOORDDPROC)glewGetProcAddress((const GLubyte*)"glFogCoordd");
+  glFogCoordd(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoorddv (const GLdouble * a0)
+{
+  glFogCoorddv = (PFNGLFOGCOORDDVPROC)glewGetProcAddress((const GLubyte*)"glFogCoorddv");
+  glFogCoorddv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordf (GLfloat a0)
+{
+  glFogCoordf = (PFNGLFOGCOORDFPROC)glewGetProcAddress((const GLubyte*)"glFogCoordf");
+  glFogCoordf(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordfv (const GLfloat * a0)
+{
+  glFogCoordfv = (PFNGLFOGCOORDFVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordfv");
+  glFogCoordfv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArrays (GLenum a0, const GLint * a1, const GLsizei * a2, GLsizei a3)
+{
+  glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArrays");
+  glMultiDrawArrays(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElements (GLenum a0, const GLsizei * a1, GLenum a2, const void *const* a3, GLsizei a4)
+{
+  glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElements");
+  glMultiDrawElements(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterf (GLenum a0, GLfloat a1)
+{
+  glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glPointParameterf");
+  glPointParameterf(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterfv (GLenum a0, const GLfloat * a1)
+{
+  glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfv");
+  glPointParameterfv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameteri (GLenum a0, GLint a1)
+{
+  glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glPointParameteri");
+  glPointParameteri(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameteriv (GLenum a0, const GLint * a1)
+{
+  glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glPointParameteriv");
+  glPointParameteriv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3b (GLbyte a0, GLbyte a1, GLbyte a2)
+{
+  glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3b");
+  glSecondaryColor3b(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3bv (const GLbyte * a0)
+{
+  glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3bv");
+  glSecondaryColor3bv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3d (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3d");
+  glSecondaryColor3d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3dv (const GLdouble * a0)
+{
+  glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3dv");
+  glSecondaryColor3dv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3f (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3f");
+  glSecondaryColor3f(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3fv (const GLfloat * a0)
+{
+  glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3fv");
+  glSecondaryColor3fv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3i (GLint a0, GLint a1, GLint a2)
+{
+  glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3i");
+  glSecondaryColor3i(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3iv (const GLint * a0)
+{
+  glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3iv");
+  glSecondaryColor3iv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3s (GLshort a0, GLshort a1, GLshort a2)
+{
+  glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3s");
+  glSecondaryColor3s(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3sv (const GLshort * a0)
+{
+  glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3sv");
+  glSecondaryColor3sv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ub (GLubyte a0, GLubyte a1, GLubyte a2)
+{
+  glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ub");
+  glSecondaryColor3ub(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ubv (const GLubyte * a0)
+{
+  glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ubv");
+  glSecondaryColor3ubv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ui (GLuint a0, GLuint a1, GLuint a2)
+{
+  glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ui");
+  glSecondaryColor3ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3uiv (const GLuint * a0)
+{
+  glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3uiv");
+  glSecondaryColor3uiv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3us (GLushort a0, GLushort a1, GLushort a2)
+{
+  glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3us");
+  glSecondaryColor3us(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3usv (const GLushort * a0)
+{
+  glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3usv");
+  glSecondaryColor3usv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorPointer (GLint a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorPointer");
+  glSecondaryColorPointer(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2d (GLdouble a0, GLdouble a1)
+{
+  glWindowPos2d = (PFNGLWINDOWPOS2DPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2d");
+  glWindowPos2d(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dv (const GLdouble * a0)
+{
+  glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dv");
+  glWindowPos2dv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2f (GLfloat a0, GLfloat a1)
+{
+  glWindowPos2f = (PFNGLWINDOWPOS2FPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2f");
+  glWindowPos2f(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fv (const GLfloat * a0)
+{
+  glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fv");
+  glWindowPos2fv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2i (GLint a0, GLint a1)
+{
+  glWindowPos2i = (PFNGLWINDOWPOS2IPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2i");
+  glWindowPos2i(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2iv (const GLint * a0)
+{
+  glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2iv");
+  glWindowPos2iv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2s (GLshort a0, GLshort a1)
+{
+  glWindowPos2s = (PFNGLWINDOWPOS2SPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2s");
+  glWindowPos2s(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2sv (const GLshort * a0)
+{
+  glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2sv");
+  glWindowPos2sv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3d (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  glWindowPos3d = (PFNGLWINDOWPOS3DPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3d");
+  glWindowPos3d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dv (const GLdouble * a0)
+{
+  glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dv");
+  glWindowPos3dv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3f (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glWindowPos3f = (PFNGLWINDOWPOS3FPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3f");
+  glWindowPos3f(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fv (const GLfloat * a0)
+{
+  glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fv");
+  glWindowPos3fv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3i (GLint a0, GLint a1, GLint a2)
+{
+  glWindowPos3i = (PFNGLWINDOWPOS3IPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3i");
+  glWindowPos3i(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3iv (const GLint * a0)
+{
+  glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3iv");
+  glWindowPos3iv(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3s (GLshort a0, GLshort a1, GLshort a2)
+{
+  glWindowPos3s = (PFNGLWINDOWPOS3SPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3s");
+  glWindowPos3s(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3sv (const GLshort * a0)
+{
+  glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3sv");
+  glWindowPos3sv(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginQuery (GLenum a0, GLuint a1)
+{
+  glBeginQuery = (PFNGLBEGINQUERYPROC)glewGetProcAddress((const GLubyte*)"glBeginQuery");
+  glBeginQuery(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBuffer (GLenum a0, GLuint a1)
+{
+  glBindBuffer = (PFNGLBINDBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindBuffer");
+  glBindBuffer(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferData (GLenum a0, GLsizeiptr a1, const void* a2, GLenum a3)
+{
+  glBufferData = (PFNGLBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glBufferData");
+  glBufferData(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferSubData (GLenum a0, GLintptr a1, GLsizeiptr a2, const void* a3)
+{
+  glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glBufferSubData");
+  glBufferSubData(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteBuffers (GLsizei a0, const GLuint* a1)
+{
+  glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteBuffers");
+  glDeleteBuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueries (GLsizei a0, const GLuint* a1)
+{
+  glDeleteQueries = (PFNGLDELETEQUERIESPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueries");
+  glDeleteQueries(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQuery (GLenum a0)
+{
+  glEndQuery = (PFNGLENDQUERYPROC)glewGetProcAddress((const GLubyte*)"glEndQuery");
+  glEndQuery(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenBuffers (GLsizei a0, GLuint* a1)
+{
+  glGenBuffers = (PFNGLGENBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glGenBuffers");
+  glGenBuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueries (GLsizei a0, GLuint* a1)
+{
+  glGenQueries = (PFNGLGENQUERIESPROC)glewGetProcAddress((const GLubyte*)"glGenQueries");
+  glGenQueries(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameteriv (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameteriv");
+  glGetBufferParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferPointerv (GLenum a0, GLenum a1, void** a2)
+{
+  glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glewGetProcAddress((const GLubyte*)"glGetBufferPointerv");
+  glGetBufferPointerv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferSubData (GLenum a0, GLintptr a1, GLsizeiptr a2, void* a3)
+{
+  glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glGetBufferSubData");
+  glGetBufferSubData(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectiv");
+  glGetQueryObjectiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuiv");
+  glGetQueryObjectuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryiv (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetQueryiv = (PFNGLGETQUERYIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryiv");
+  glGetQueryiv(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsBuffer (GLuint a0)
+{
+  glIsBuffer = (PFNGLISBUFFERPROC)glewGetProcAddress((const GLubyte*)"glIsBuffer");
+  return glIsBuffer(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQuery (GLuint a0)
+{
+  glIsQuery = (PFNGLISQUERYPROC)glewGetProcAddress((const GLubyte*)"glIsQuery");
+  return glIsQuery(a0);
+}
+
+static void* GLAPIENTRY _glewLazy_glMapBuffer (GLenum a0, GLenum a1)
+{
+  glMapBuffer = (PFNGLMAPBUFFERPROC)glewGetProcAddress((const GLubyte*)"glMapBuffer");
+  return glMapBuffer(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapBuffer (GLenum a0)
+{
+  glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glewGetProcAddress((const GLubyte*)"glUnmapBuffer");
+  return glUnmapBuffer(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAttachShader (GLuint a0, GLuint a1)
+{
+  glAttachShader = (PFNGLATTACHSHADERPROC)glewGetProcAddress((const GLubyte*)"glAttachShader");
+  glAttachShader(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindAttribLocation (GLuint a0, GLuint a1, const GLchar* a2)
+{
+  glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glBindAttribLocation");
+  glBindAttribLocation(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparate (GLenum a0, GLenum a1)
+{
+  glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparate");
+  glBlendEquationSeparate(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCompileShader (GLuint a0)
+{
+  glCompileShader = (PFNGLCOMPILESHADERPROC)glewGetProcAddress((const GLubyte*)"glCompileShader");
+  glCompileShader(a0);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateProgram (void)
+{
+  glCreateProgram = (PFNGLCREATEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glCreateProgram");
+  return glCreateProgram();
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateShader (GLenum a0)
+{
+  glCreateShader = (PFNGLCREATESHADERPROC)glewGetProcAddress((const GLubyte*)"glCreateShader");
+  return glCreateShader(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgram (GLuint a0)
+{
+  glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgram");
+  glDeleteProgram(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteShader (GLuint a0)
+{
+  glDeleteShader = (PFNGLDELETESHADERPROC)glewGetProcAddress((const GLubyte*)"glDeleteShader");
+  glDeleteShader(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDetachShader (GLuint a0, GLuint a1)
+{
+  glDetachShader = (PFNGLDETACHSHADERPROC)glewGetProcAddress((const GLubyte*)"glDetachShader");
+  glDetachShader(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexAttribArray (GLuint a0)
+{
+  glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexAttribArray");
+  glDisableVertexAttribArray(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawBuffers (GLsizei a0, const GLenum* a1)
+{
+  glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffers");
+  glDrawBuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexAttribArray (GLuint a0)
+{
+  glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexAttribArray");
+  glEnableVertexAttribArray(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveAttrib (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6)
+{
+  glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glewGetProcAddress((const GLubyte*)"glGetActiveAttrib");
+  glGetActiveAttrib(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniform (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6)
+{
+  glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniform");
+  glGetActiveUniform(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetAttachedShaders (GLuint a0, GLsizei a1, GLsizei* a2, GLuint* a3)
+{
+  glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glewGetProcAddress((const GLubyte*)"glGetAttachedShaders");
+  glGetAttachedShaders(a0, a1, a2, a3);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetAttribLocation (GLuint a0, const GLchar* a1)
+{
+  glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetAttribLocation");
+  return glGetAttribLocation(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramInfoLog (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glewGetProcAddress((const GLubyte*)"glGetProgramInfoLog");
+  glGetProgramInfoLog(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramiv");
+  glGetProgramiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderInfoLog (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glewGetProcAddress((const GLubyte*)"glGetShaderInfoLog");
+  glGetShaderInfoLog(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderSource (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glewGetProcAddress((const GLubyte*)"glGetShaderSource");
+  glGetShaderSource(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetShaderiv = (PFNGLGETSHADERIVPROC)glewGetProcAddress((const GLubyte*)"glGetShaderiv");
+  glGetShaderiv(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetUniformLocation (GLuint a0, const GLchar* a1)
+{
+  glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetUniformLocation");
+  return glGetUniformLocation(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformfv (GLuint a0, GLint a1, GLfloat* a2)
+{
+  glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformfv");
+  glGetUniformfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformiv (GLuint a0, GLint a1, GLint* a2)
+{
+  glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformiv");
+  glGetUniformiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribPointerv (GLuint a0, GLenum a1, void** a2)
+{
+  glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribPointerv");
+  glGetVertexAttribPointerv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribdv (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribdv");
+  glGetVertexAttribdv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribfv (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribfv");
+  glGetVertexAttribfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribiv");
+  glGetVertexAttribiv(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgram (GLuint a0)
+{
+  glIsProgram = (PFNGLISPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glIsProgram");
+  return glIsProgram(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsShader (GLuint a0)
+{
+  glIsShader = (PFNGLISSHADERPROC)glewGetProcAddress((const GLubyte*)"glIsShader");
+  return glIsShader(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glLinkProgram (GLuint a0)
+{
+  glLinkProgram = (PFNGLLINKPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glLinkProgram");
+  glLinkProgram(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderSource (GLuint a0, GLsizei a1, const GLchar *const* a2, const GLint* a3)
+{
+  glShaderSource = (PFNGLSHADERSOURCEPROC)glewGetProcAddress((const GLubyte*)"glShaderSource");
+  glShaderSource(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilFuncSeparate (GLenum a0, GLenum a1, GLint a2, GLuint a3)
+{
+  glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glStencilFuncSeparate");
+  glStencilFuncSeparate(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilMaskSeparate (GLenum a0, GLuint a1)
+{
+  glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glStencilMaskSeparate");
+  glStencilMaskSeparate(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilOpSeparate (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glStencilOpSeparate");
+  glStencilOpSeparate(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1f (GLint a0, GLfloat a1)
+{
+  glUniform1f = (PFNGLUNIFORM1FPROC)glewGetProcAddress((const GLubyte*)"glUniform1f");
+  glUniform1f(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform1fv = (PFNGLUNIFORM1FVPROC)glewGetProcAddress((const GLubyte*)"glUniform1fv");
+  glUniform1fv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i (GLint a0, GLint a1)
+{
+  glUniform1i = (PFNGLUNIFORM1IPROC)glewGetProcAddress((const GLubyte*)"glUniform1i");
+  glUniform1i(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform1iv = (PFNGLUNIFORM1IVPROC)glewGetProcAddress((const GLubyte*)"glUniform1iv");
+  glUniform1iv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2f (GLint a0, GLfloat a1, GLfloat a2)
+{
+  glUniform2f = (PFNGLUNIFORM2FPROC)glewGetProcAddress((const GLubyte*)"glUniform2f");
+  glUniform2f(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform2fv = (PFNGLUNIFORM2FVPROC)glewGetProcAddress((const GLubyte*)"glUniform2fv");
+  glUniform2fv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i (GLint a0, GLint a1, GLint a2)
+{
+  glUniform2i = (PFNGLUNIFORM2IPROC)glewGetProcAddress((const GLubyte*)"glUniform2i");
+  glUniform2i(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform2iv = (PFNGLUNIFORM2IVPROC)glewGetProcAddress((const GLubyte*)"glUniform2iv");
+  glUniform2iv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3f (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glUniform3f = (PFNGLUNIFORM3FPROC)glewGetProcAddress((const GLubyte*)"glUniform3f");
+  glUniform3f(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform3fv = (PFNGLUNIFORM3FVPROC)glewGetProcAddress((const GLubyte*)"glUniform3fv");
+  glUniform3fv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  glUniform3i = (PFNGLUNIFORM3IPROC)glewGetProcAddress((const GLubyte*)"glUniform3i");
+  glUniform3i(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform3iv = (PFNGLUNIFORM3IVPROC)glewGetProcAddress((const GLubyte*)"glUniform3iv");
+  glUniform3iv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4f (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glUniform4f = (PFNGLUNIFORM4FPROC)glewGetProcAddress((const GLubyte*)"glUniform4f");
+  glUniform4f(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform4fv = (PFNGLUNIFORM4FVPROC)glewGetProcAddress((const GLubyte*)"glUniform4fv");
+  glUniform4fv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glUniform4i = (PFNGLUNIFORM4IPROC)glewGetProcAddress((const GLubyte*)"glUniform4i");
+  glUniform4i(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform4iv = (PFNGLUNIFORM4IVPROC)glewGetProcAddress((const GLubyte*)"glUniform4iv");
+  glUniform4iv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2fv");
+  glUniformMatrix2fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3fv");
+  glUniformMatrix3fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4fv");
+  glUniformMatrix4fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUseProgram (GLuint a0)
+{
+  glUseProgram = (PFNGLUSEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glUseProgram");
+  glUseProgram(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glValidateProgram (GLuint a0)
+{
+  glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glValidateProgram");
+  glValidateProgram(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1d (GLuint a0, GLdouble a1)
+{
+  glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1d");
+  glVertexAttrib1d(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dv");
+  glVertexAttrib1dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1f (GLuint a0, GLfloat a1)
+{
+  glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1f");
+  glVertexAttrib1f(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fv (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fv");
+  glVertexAttrib1fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1s (GLuint a0, GLshort a1)
+{
+  glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1s");
+  glVertexAttrib1s(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1sv (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1sv");
+  glVertexAttrib1sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2d (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2d");
+  glVertexAttrib2d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dv");
+  glVertexAttrib2dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2f (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2f");
+  glVertexAttrib2f(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fv (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fv");
+  glVertexAttrib2fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2s (GLuint a0, GLshort a1, GLshort a2)
+{
+  glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2s");
+  glVertexAttrib2s(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2sv (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2sv");
+  glVertexAttrib2sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3d");
+  glVertexAttrib3d(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dv");
+  glVertexAttrib3dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3f (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3f");
+  glVertexAttrib3f(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fv (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fv");
+  glVertexAttrib3fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3s (GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3s");
+  glVertexAttrib3s(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3sv (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3sv");
+  glVertexAttrib3sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nbv (GLuint a0, const GLbyte* a1)
+{
+  glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nbv");
+  glVertexAttrib4Nbv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Niv (GLuint a0, const GLint* a1)
+{
+  glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Niv");
+  glVertexAttrib4Niv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nsv (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nsv");
+  glVertexAttrib4Nsv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nub (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+{
+  glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nub");
+  glVertexAttrib4Nub(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nubv (GLuint a0, const GLubyte* a1)
+{
+  glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nubv");
+  glVertexAttrib4Nubv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nuiv (GLuint a0, const GLuint* a1)
+{
+  glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nuiv");
+  glVertexAttrib4Nuiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nusv (GLuint a0, const GLushort* a1)
+{
+  glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nusv");
+  glVertexAttrib4Nusv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4bv (GLuint a0, const GLbyte* a1)
+{
+  glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4bv");
+  glVertexAttrib4bv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4d");
+  glVertexAttrib4d(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dv");
+  glVertexAttrib4dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4f (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4f");
+  glVertexAttrib4f(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fv (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fv");
+  glVertexAttrib4fv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4iv (GLuint a0, const GLint* a1)
+{
+  glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4iv");
+  glVertexAttrib4iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4s (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4s");
+  glVertexAttrib4s(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4sv (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4sv");
+  glVertexAttrib4sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubv (GLuint a0, const GLubyte* a1)
+{
+  glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubv");
+  glVertexAttrib4ubv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4uiv (GLuint a0, const GLuint* a1)
+{
+  glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4uiv");
+  glVertexAttrib4uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4usv (GLuint a0, const GLushort* a1)
+{
+  glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4usv");
+  glVertexAttrib4usv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribPointer (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void* a5)
+{
+  glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribPointer");
+  glVertexAttribPointer(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x3fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x3fv");
+  glUniformMatrix2x3fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x4fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x4fv");
+  glUniformMatrix2x4fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x2fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x2fv");
+  glUniformMatrix3x2fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x4fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x4fv");
+  glUniformMatrix3x4fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x2fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x2fv");
+  glUniformMatrix4x2fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x3fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x3fv");
+  glUniformMatrix4x3fv(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginConditionalRender (GLuint a0, GLenum a1)
+{
+  glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glewGetProcAddress((const GLubyte*)"glBeginConditionalRender");
+  glBeginConditionalRender(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBeginTransformFeedback (GLenum a0)
+{
+  glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glBeginTransformFeedback");
+  glBeginTransformFeedback(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocation (GLuint a0, GLuint a1, const GLchar* a2)
+{
+  glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocation");
+  glBindFragDataLocation(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glClampColor (GLenum a0, GLenum a1)
+{
+  glClampColor = (PFNGLCLAMPCOLORPROC)glewGetProcAddress((const GLubyte*)"glClampColor");
+  glClampColor(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferfi (GLenum a0, GLint a1, GLfloat a2, GLint a3)
+{
+  glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glewGetProcAddress((const GLubyte*)"glClearBufferfi");
+  glClearBufferfi(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferfv (GLenum a0, GLint a1, const GLfloat* a2)
+{
+  glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glewGetProcAddress((const GLubyte*)"glClearBufferfv");
+  glClearBufferfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferiv (GLenum a0, GLint a1, const GLint* a2)
+{
+  glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glewGetProcAddress((const GLubyte*)"glClearBufferiv");
+  glClearBufferiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferuiv (GLenum a0, GLint a1, const GLuint* a2)
+{
+  glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glewGetProcAddress((const GLubyte*)"glClearBufferuiv");
+  glClearBufferuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColorMaski (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  glColorMaski = (PFNGLCOLORMASKIPROC)glewGetProcAddress((const GLubyte*)"glColorMaski");
+  glColorMaski(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDisablei (GLenum a0, GLuint a1)
+{
+  glDisablei = (PFNGLDISABLEIPROC)glewGetProcAddress((const GLubyte*)"glDisablei");
+  glDisablei(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnablei (GLenum a0, GLuint a1)
+{
+  glEnablei = (PFNGLENABLEIPROC)glewGetProcAddress((const GLubyte*)"glEnablei");
+  glEnablei(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndConditionalRender (void)
+{
+  glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glewGetProcAddress((const GLubyte*)"glEndConditionalRender");
+  glEndConditionalRender();
+}
+
+static void GLAPIENTRY _glewLazy_glEndTransformFeedback (void)
+{
+  glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glEndTransformFeedback");
+  glEndTransformFeedback();
+}
+
+static void GLAPIENTRY _glewLazy_glGetBooleani_v (GLenum a0, GLuint a1, GLboolean* a2)
+{
+  glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glewGetProcAddress((const GLubyte*)"glGetBooleani_v");
+  glGetBooleani_v(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataLocation (GLuint a0, const GLchar* a1)
+{
+  glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataLocation");
+  return glGetFragDataLocation(a0, a1);
+}
+
+static const GLubyte* GLAPIENTRY _glewLazy_glGetStringi (GLenum a0, GLuint a1)
+{
+  glGetStringi = (PFNGLGETSTRINGIPROC)glewGetProcAddress((const GLubyte*)"glGetStringi");
+  return glGetStringi(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIiv (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIiv");
+  glGetTexParameterIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIuiv (GLenum a0, GLenum a1, GLuint* a2)
+{
+  glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIuiv");
+  glGetTexParameterIuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackVarying (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLsizei * a4, GLenum * a5, GLchar * a6)
+{
+  glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackVarying");
+  glGetTransformFeedbackVarying(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformuiv (GLuint a0, GLint a1, GLuint* a2)
+{
+  glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformuiv");
+  glGetUniformuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIiv");
+  glGetVertexAttribIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIuiv");
+  glGetVertexAttribIuiv(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnabledi (GLenum a0, GLuint a1)
+{
+  glIsEnabledi = (PFNGLISENABLEDIPROC)glewGetProcAddress((const GLubyte*)"glIsEnabledi");
+  return glIsEnabledi(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIiv (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIiv");
+  glTexParameterIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIuiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIuiv");
+  glTexParameterIuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackVaryings (GLuint a0, GLsizei a1, const GLchar *const* a2, GLenum a3)
+{
+  glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackVaryings");
+  glTransformFeedbackVaryings(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui (GLint a0, GLuint a1)
+{
+  glUniform1ui = (PFNGLUNIFORM1UIPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui");
+  glUniform1ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform1uiv");
+  glUniform1uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui (GLint a0, GLuint a1, GLuint a2)
+{
+  glUniform2ui = (PFNGLUNIFORM2UIPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui");
+  glUniform2ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform2uiv");
+  glUniform2uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui (GLint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  glUniform3ui = (PFNGLUNIFORM3UIPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui");
+  glUniform3ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform3uiv");
+  glUniform3uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui (GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glUniform4ui = (PFNGLUNIFORM4UIPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui");
+  glUniform4ui(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform4uiv");
+  glUniform4uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1i (GLuint a0, GLint a1)
+{
+  glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1i");
+  glVertexAttribI1i(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1iv (GLuint a0, const GLint* a1)
+{
+  glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1iv");
+  glVertexAttribI1iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1ui (GLuint a0, GLuint a1)
+{
+  glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1ui");
+  glVertexAttribI1ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1uiv (GLuint a0, const GLuint* a1)
+{
+  glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1uiv");
+  glVertexAttribI1uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2i (GLuint a0, GLint a1, GLint a2)
+{
+  glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2i");
+  glVertexAttribI2i(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2iv (GLuint a0, const GLint* a1)
+{
+  glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2iv");
+  glVertexAttribI2iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2ui (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2ui");
+  glVertexAttribI2ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2uiv (GLuint a0, const GLuint* a1)
+{
+  glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2uiv");
+  glVertexAttribI2uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3i (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3i");
+  glVertexAttribI3i(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3iv (GLuint a0, const GLint* a1)
+{
+  glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3iv");
+  glVertexAttribI3iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3ui (GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3ui");
+  glVertexAttribI3ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3uiv (GLuint a0, const GLuint* a1)
+{
+  glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3uiv");
+  glVertexAttribI3uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4bv (GLuint a0, const GLbyte* a1)
+{
+  glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4bv");
+  glVertexAttribI4bv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4i (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4i");
+  glVertexAttribI4i(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4iv (GLuint a0, const GLint* a1)
+{
+  glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4iv");
+  glVertexAttribI4iv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4sv (GLuint a0, const GLshort* a1)
+{
+  glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4sv");
+  glVertexAttribI4sv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ubv (GLuint a0, const GLubyte* a1)
+{
+  glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ubv");
+  glVertexAttribI4ubv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ui (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ui");
+  glVertexAttribI4ui(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4uiv (GLuint a0, const GLuint* a1)
+{
+  glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4uiv");
+  glVertexAttribI4uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4usv (GLuint a0, const GLushort* a1)
+{
+  glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4usv");
+  glVertexAttribI4usv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIPointer (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void* a4)
+{
+  glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIPointer");
+  glVertexAttribIPointer(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstanced (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstanced");
+  glDrawArraysInstanced(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstanced (GLenum a0, GLsizei a1, GLenum a2, const void* a3, GLsizei a4)
+{
+  glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstanced");
+  glDrawElementsInstanced(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glPrimitiveRestartIndex (GLuint a0)
+{
+  glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveRestartIndex");
+  glPrimitiveRestartIndex(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBuffer (GLenum a0, GLenum a1, GLuint a2)
+{
+  glTexBuffer = (PFNGLTEXBUFFERPROC)glewGetProcAddress((const GLubyte*)"glTexBuffer");
+  glTexBuffer(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture (GLenum a0, GLenum a1, GLuint a2, GLint a3)
+{
+  glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture");
+  glFramebufferTexture(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameteri64v (GLenum a0, GLenum a1, GLint64 * a2)
+{
+  glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameteri64v");
+  glGetBufferParameteri64v(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInteger64i_v (GLenum a0, GLuint a1, GLint64 * a2)
+{
+  glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glewGetProcAddress((const GLubyte*)"glGetInteger64i_v");
+  glGetInteger64i_v(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisor (GLuint a0, GLuint a1)
+{
+  glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisor");
+  glVertexAttribDivisor(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparatei (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparatei");
+  glBlendEquationSeparatei(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationi (GLuint a0, GLenum a1)
+{
+  glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationi");
+  glBlendEquationi(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparatei (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparatei");
+  glBlendFuncSeparatei(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFunci (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendFunci = (PFNGLBLENDFUNCIPROC)glewGetProcAddress((const GLubyte*)"glBlendFunci");
+  glBlendFunci(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMinSampleShading (GLclampf a0)
+{
+  glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)glewGetProcAddress((const GLubyte*)"glMinSampleShading");
+  glMinSampleShading(a0);
+}
+
+
+
+static GLenum GLAPIENTRY _glewLazy_glGetGraphicsResetStatus (void)
+{
+  glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)glewGetProcAddress((const GLubyte*)"glGetGraphicsResetStatus");
+  return glGetGraphicsResetStatus();
+}
+
+static void GLAPIENTRY _glewLazy_glGetnCompressedTexImage (GLenum a0, GLint a1, GLsizei a2, GLvoid * a3)
+{
+  glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetnCompressedTexImage");
+  glGetnCompressedTexImage(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnTexImage (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, GLvoid * a5)
+{
+  glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetnTexImage");
+  glGetnTexImage(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformdv (GLuint a0, GLint a1, GLsizei a2, GLdouble * a3)
+{
+  glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformdv");
+  glGetnUniformdv(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectCount (GLenum a0, const GLvoid * a1, GLintptr a2, GLsizei a3, GLsizei a4)
+{
+  glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectCount");
+  glMultiDrawArraysIndirectCount(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectCount (GLenum a0, GLenum a1, const GLvoid * a2, GLintptr a3, GLsizei a4, GLsizei a5)
+{
+  glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectCount");
+  glMultiDrawElementsIndirectCount(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glSpecializeShader (GLuint a0, const GLchar * a1, GLuint a2, const GLuint * a3, const GLuint * a4)
+{
+  glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)glewGetProcAddress((const GLubyte*)"glSpecializeShader");
+  glSpecializeShader(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTbufferMask3DFX (GLuint a0)
+{
+  glTbufferMask3DFX = (PFNGLTBUFFERMASK3DFXPROC)glewGetProcAddress((const GLubyte*)"glTbufferMask3DFX");
+  glTbufferMask3DFX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDebugMessageCallbackAMD (GLDEBUGPROCAMD a0, void * a1)
+{
+  glDebugMessageCallbackAMD = (PFNGLDEBUGMESSAGECALLBACKAMDPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageCallbackAMD");
+  glDebugMessageCallbackAMD(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageEnableAMD (GLenum a0, GLenum a1, GLsizei a2, const GLuint* a3, GLboolean a4)
+{
+  glDebugMessageEnableAMD = (PFNGLDEBUGMESSAGEENABLEAMDPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageEnableAMD");
+  glDebugMessageEnableAMD(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageInsertAMD (GLenum a0, GLenum a1, GLuint a2, GLsizei a3, const GLchar* a4)
+{
+  glDebugMessageInsertAMD = (PFNGLDEBUGMESSAGEINSERTAMDPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageInsertAMD");
+  glDebugMessageInsertAMD(a0, a1, a2, a3, a4);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetDebugMessageLogAMD (GLuint a0, GLsizei a1, GLenum* a2, GLuint* a3, GLuint* a4, GLsizei* a5, GLchar* a6)
+{
+  glGetDebugMessageLogAMD = (PFNGLGETDEBUGMESSAGELOGAMDPROC)glewGetProcAddress((const GLubyte*)"glGetDebugMessageLogAMD");
+  return glGetDebugMessageLogAMD(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationIndexedAMD (GLuint a0, GLenum a1)
+{
+  glBlendEquationIndexedAMD = (PFNGLBLENDEQUATIONINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationIndexedAMD");
+  glBlendEquationIndexedAMD(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateIndexedAMD (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendEquationSeparateIndexedAMD = (PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateIndexedAMD");
+  glBlendEquationSeparateIndexedAMD(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncIndexedAMD (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendFuncIndexedAMD = (PFNGLBLENDFUNCINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncIndexedAMD");
+  glBlendFuncIndexedAMD(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateIndexedAMD (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  glBlendFuncSeparateIndexedAMD = (PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateIndexedAMD");
+  glBlendFuncSeparateIndexedAMD(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisampleAdvancedAMD (GLuint a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  glNamedRenderbufferStorageMultisampleAdvancedAMD = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisampleAdvancedAMD");
+  glNamedRenderbufferStorageMultisampleAdvancedAMD(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleAdvancedAMD (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  glRenderbufferStorageMultisampleAdvancedAMD = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleAdvancedAMD");
+  glRenderbufferStorageMultisampleAdvancedAMD(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferSamplePositionsfvAMD (GLenum a0, GLuint a1, GLuint a2, const GLfloat* a3)
+{
+  glFramebufferSamplePositionsfvAMD = (PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)glewGetProcAddress((const GLubyte*)"glFramebufferSamplePositionsfvAMD");
+  glFramebufferSamplePositionsfvAMD(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferParameterfvAMD (GLenum a0, GLenum a1, GLuint a2, GLuint a3, GLsizei a4, GLfloat* a5)
+{
+  glGetFramebufferParameterfvAMD = (PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferParameterfvAMD");
+  glGetFramebufferParameterfvAMD(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferParameterfvAMD (GLuint a0, GLenum a1, GLuint a2, GLuint a3, GLsizei a4, GLfloat* a5)
+{
+  glGetNamedFramebufferParameterfvAMD = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferParameterfvAMD");
+  glGetNamedFramebufferParameterfvAMD(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferSamplePositionsfvAMD (GLuint a0, GLuint a1, GLuint a2, const GLfloat* a3)
+{
+  glNamedFramebufferSamplePositionsfvAMD = (PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferSamplePositionsfvAMD");
+  glNamedFramebufferSamplePositionsfvAMD(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVertexAttribParameteriAMD (GLuint a0, GLenum a1, GLint a2)
+{
+  glVertexAttribParameteriAMD = (PFNGLVERTEXATTRIBPARAMETERIAMDPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribParameteriAMD");
+  glVertexAttribParameteriAMD(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectAMD (GLenum a0, const void * a1, GLsizei a2, GLsizei a3)
+{
+  glMultiDrawArraysIndirectAMD = (PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectAMD");
+  glMultiDrawArraysIndirectAMD(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectAMD (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4)
+{
+  glMultiDrawElementsIndirectAMD = (PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectAMD");
+  glMultiDrawElementsIndirectAMD(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDeleteNamesAMD (GLenum a0, GLuint a1, const GLuint* a2)
+{
+  glDeleteNamesAMD = (PFNGLDELETENAMESAMDPROC)glewGetProcAddress((const GLubyte*)"glDeleteNamesAMD");
+  glDeleteNamesAMD(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGenNamesAMD (GLenum a0, GLuint a1, GLuint* a2)
+{
+  glGenNamesAMD = (PFNGLGENNAMESAMDPROC)glewGetProcAddress((const GLubyte*)"glGenNamesAMD");
+  glGenNamesAMD(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsNameAMD (GLenum a0, GLuint a1)
+{
+  glIsNameAMD = (PFNGLISNAMEAMDPROC)glewGetProcAddress((const GLubyte*)"glIsNameAMD");
+  return glIsNameAMD(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glQueryObjectParameteruiAMD (GLenum a0, GLuint a1, GLenum a2, GLuint a3)
+{
+  glQueryObjectParameteruiAMD = (PFNGLQUERYOBJECTPARAMETERUIAMDPROC)glewGetProcAddress((const GLubyte*)"glQueryObjectParameteruiAMD");
+  glQueryObjectParameteruiAMD(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginPerfMonitorAMD (GLuint a0)
+{
+  glBeginPerfMonitorAMD = (PFNGLBEGINPERFMONITORAMDPROC)glewGetProcAddress((const GLubyte*)"glBeginPerfMonitorAMD");
+  glBeginPerfMonitorAMD(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeletePerfMonitorsAMD (GLsizei a0, GLuint* a1)
+{
+  glDeletePerfMonitorsAMD = (PFNGLDELETEPERFMONITORSAMDPROC)glewGetProcAddress((const GLubyte*)"glDeletePerfMonitorsAMD");
+  glDeletePerfMonitorsAMD(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndPerfMonitorAMD (GLuint a0)
+{
+  glEndPerfMonitorAMD = (PFNGLENDPERFMONITORAMDPROC)glewGetProcAddress((const GLubyte*)"glEndPerfMonitorAMD");
+  glEndPerfMonitorAMD(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenPerfMonitorsAMD (GLsizei a0, GLuint* a1)
+{
+  glGenPerfMonitorsAMD = (PFNGLGENPERFMONITORSAMDPROC)glewGetProcAddress((const GLubyte*)"glGenPerfMonitorsAMD");
+  glGenPerfMonitorsAMD(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCounterDataAMD (GLuint a0, GLenum a1, GLsizei a2, GLuint* a3, GLint * a4)
+{
+  glGetPerfMonitorCounterDataAMD = (PFNGLGETPERFMONITORCOUNTERDATAAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCounterDataAMD");
+  glGetPerfMonitorCounterDataAMD(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCounterInfoAMD (GLuint a0, GLuint a1, GLenum a2, void * a3)
+{
+  glGetPerfMonitorCounterInfoAMD = (PFNGLGETPERFMONITORCOUNTERINFOAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCounterInfoAMD");
+  glGetPerfMonitorCounterInfoAMD(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCounterStringAMD (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar * a4)
+{
+  glGetPerfMonitorCounterStringAMD = (PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCounterStringAMD");
+  glGetPerfMonitorCounterStringAMD(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCountersAMD (GLuint a0, GLint* a1, GLint * a2, GLsizei a3, GLuint * a4)
+{
+  glGetPerfMonitorCountersAMD = (PFNGLGETPERFMONITORCOUNTERSAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCountersAMD");
+  glGetPerfMonitorCountersAMD(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorGroupStringAMD (GLuint a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  glGetPerfMonitorGroupStringAMD = (PFNGLGETPERFMONITORGROUPSTRINGAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorGroupStringAMD");
+  glGetPerfMonitorGroupStringAMD(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorGroupsAMD (GLint* a0, GLsizei a1, GLuint * a2)
+{
+  glGetPerfMonitorGroupsAMD = (PFNGLGETPERFMONITORGROUPSAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorGroupsAMD");
+  glGetPerfMonitorGroupsAMD(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSelectPerfMonitorCountersAMD (GLuint a0, GLboolean a1, GLuint a2, GLint a3, GLuint* a4)
+{
+  glSelectPerfMonitorCountersAMD = (PFNGLSELECTPERFMONITORCOUNTERSAMDPROC)glewGetProcAddress((const GLubyte*)"glSelectPerfMonitorCountersAMD");
+  glSelectPerfMonitorCountersAMD(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSetMultisamplefvAMD (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  glSetMultisamplefvAMD = (PFNGLSETMULTISAMPLEFVAMDPROC)glewGetProcAddress((const GLubyte*)"glSetMultisamplefvAMD");
+  glSetMultisamplefvAMD(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexStorageSparseAMD (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLsizei a4, GLsizei a5, GLbitfield a6)
+{
+  glTexStorageSparseAMD = (PFNGLTEXSTORAGESPARSEAMDPROC)glewGetProcAddress((const GLubyte*)"glTexStorageSparseAMD");
+  glTexStorageSparseAMD(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageSparseAMD (GLuint a0, GLenum a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLsizei a6, GLbitfield a7)
+{
+  glTextureStorageSparseAMD = (PFNGLTEXTURESTORAGESPARSEAMDPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageSparseAMD");
+  glTextureStorageSparseAMD(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glStencilOpValueAMD (GLenum a0, GLuint a1)
+{
+  glStencilOpValueAMD = (PFNGLSTENCILOPVALUEAMDPROC)glewGetProcAddress((const GLubyte*)"glStencilOpValueAMD");
+  glStencilOpValueAMD(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTessellationFactorAMD (GLfloat a0)
+{
+  glTessellationFactorAMD = (PFNGLTESSELLATIONFACTORAMDPROC)glewGetProcAddress((const GLubyte*)"glTessellationFactorAMD");
+  glTessellationFactorAMD(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTessellationModeAMD (GLenum a0)
+{
+  glTessellationModeAMD = (PFNGLTESSELLATIONMODEAMDPROC)glewGetProcAddress((const GLubyte*)"glTessellationModeAMD");
+  glTessellationModeAMD(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlitFramebufferANGLE (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  glBlitFramebufferANGLE = (PFNGLBLITFRAMEBUFFERANGLEPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebufferANGLE");
+  glBlitFramebufferANGLE(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleANGLE (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glRenderbufferStorageMultisampleANGLE = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleANGLE");
+  glRenderbufferStorageMultisampleANGLE(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedANGLE (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glDrawArraysInstancedANGLE = (PFNGLDRAWARRAYSINSTANCEDANGLEPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedANGLE");
+  glDrawArraysInstancedANGLE(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedANGLE (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4)
+{
+  glDrawElementsInstancedANGLE = (PFNGLDRAWELEMENTSINSTANCEDANGLEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedANGLE");
+  glDrawElementsInstancedANGLE(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisorANGLE (GLuint a0, GLuint a1)
+{
+  glVertexAttribDivisorANGLE = (PFNGLVERTEXATTRIBDIVISORANGLEPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisorANGLE");
+  glVertexAttribDivisorANGLE(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryANGLE (GLenum a0, GLuint a1)
+{
+  glBeginQueryANGLE = (PFNGLBEGINQUERYANGLEPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryANGLE");
+  glBeginQueryANGLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueriesANGLE (GLsizei a0, const GLuint* a1)
+{
+  glDeleteQueriesANGLE = (PFNGLDELETEQUERIESANGLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueriesANGLE");
+  glDeleteQueriesANGLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryANGLE (GLenum a0)
+{
+  glEndQueryANGLE = (PFNGLENDQUERYANGLEPROC)glewGetProcAddress((const GLubyte*)"glEndQueryANGLE");
+  glEndQueryANGLE(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueriesANGLE (GLsizei a0, GLuint* a1)
+{
+  glGenQueriesANGLE = (PFNGLGENQUERIESANGLEPROC)glewGetProcAddress((const GLubyte*)"glGenQueriesANGLE");
+  glGenQueriesANGLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjecti64vANGLE (GLuint a0, GLenum a1, GLint64* a2)
+{
+  glGetQueryObjecti64vANGLE = (PFNGLGETQUERYOBJECTI64VANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjecti64vANGLE");
+  glGetQueryObjecti64vANGLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectivANGLE (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetQueryObjectivANGLE = (PFNGLGETQUERYOBJECTIVANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectivANGLE");
+  glGetQueryObjectivANGLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectui64vANGLE (GLuint a0, GLenum a1, GLuint64* a2)
+{
+  glGetQueryObjectui64vANGLE = (PFNGLGETQUERYOBJECTUI64VANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectui64vANGLE");
+  glGetQueryObjectui64vANGLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuivANGLE (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetQueryObjectuivANGLE = (PFNGLGETQUERYOBJECTUIVANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuivANGLE");
+  glGetQueryObjectuivANGLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryivANGLE (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetQueryivANGLE = (PFNGLGETQUERYIVANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryivANGLE");
+  glGetQueryivANGLE(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQueryANGLE (GLuint a0)
+{
+  glIsQueryANGLE = (PFNGLISQUERYANGLEPROC)glewGetProcAddress((const GLubyte*)"glIsQueryANGLE");
+  return glIsQueryANGLE(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glQueryCounterANGLE (GLuint a0, GLenum a1)
+{
+  glQueryCounterANGLE = (PFNGLQUERYCOUNTERANGLEPROC)glewGetProcAddress((const GLubyte*)"glQueryCounterANGLE");
+  glQueryCounterANGLE(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetTranslatedShaderSourceANGLE (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  glGetTranslatedShaderSourceANGLE = (PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetTranslatedShaderSourceANGLE");
+  glGetTranslatedShaderSourceANGLE(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyTextureLevelsAPPLE (GLuint a0, GLuint a1, GLint a2, GLsizei a3)
+{
+  glCopyTextureLevelsAPPLE = (PFNGLCOPYTEXTURELEVELSAPPLEPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureLevelsAPPLE");
+  glCopyTextureLevelsAPPLE(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementArrayAPPLE (GLenum a0, GLint a1, GLsizei a2)
+{
+  glDrawElementArrayAPPLE = (PFNGLDRAWELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementArrayAPPLE");
+  glDrawElementArrayAPPLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementArrayAPPLE (GLenum a0, GLuint a1, GLuint a2, GLint a3, GLsizei a4)
+{
+  glDrawRangeElementArrayAPPLE = (PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementArrayAPPLE");
+  glDrawRangeElementArrayAPPLE(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glElementPointerAPPLE (GLenum a0, const void * a1)
+{
+  glElementPointerAPPLE = (PFNGLELEMENTPOINTERAPPLEPROC)glewGetProcAddress((const GLubyte*)"glElementPointerAPPLE");
+  glElementPointerAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementArrayAPPLE (GLenum a0, const GLint* a1, const GLsizei * a2, GLsizei a3)
+{
+  glMultiDrawElementArrayAPPLE = (PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementArrayAPPLE");
+  glMultiDrawElementArrayAPPLE(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawRangeElementArrayAPPLE (GLenum a0, GLuint a1, GLuint a2, const GLint* a3, const GLsizei * a4, GLsizei a5)
+{
+  glMultiDrawRangeElementArrayAPPLE = (PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawRangeElementArrayAPPLE");
+  glMultiDrawRangeElementArrayAPPLE(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDeleteFencesAPPLE (GLsizei a0, const GLuint* a1)
+{
+  glDeleteFencesAPPLE = (PFNGLDELETEFENCESAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteFencesAPPLE");
+  glDeleteFencesAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFinishFenceAPPLE (GLuint a0)
+{
+  glFinishFenceAPPLE = (PFNGLFINISHFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFinishFenceAPPLE");
+  glFinishFenceAPPLE(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFinishObjectAPPLE (GLenum a0, GLint a1)
+{
+  glFinishObjectAPPLE = (PFNGLFINISHOBJECTAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFinishObjectAPPLE");
+  glFinishObjectAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFencesAPPLE (GLsizei a0, GLuint* a1)
+{
+  glGenFencesAPPLE = (PFNGLGENFENCESAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGenFencesAPPLE");
+  glGenFencesAPPLE(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFenceAPPLE (GLuint a0)
+{
+  glIsFenceAPPLE = (PFNGLISFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsFenceAPPLE");
+  return glIsFenceAPPLE(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSetFenceAPPLE (GLuint a0)
+{
+  glSetFenceAPPLE = (PFNGLSETFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glSetFenceAPPLE");
+  glSetFenceAPPLE(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glTestFenceAPPLE (GLuint a0)
+{
+  glTestFenceAPPLE = (PFNGLTESTFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glTestFenceAPPLE");
+  return glTestFenceAPPLE(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glTestObjectAPPLE (GLenum a0, GLuint a1)
+{
+  glTestObjectAPPLE = (PFNGLTESTOBJECTAPPLEPROC)glewGetProcAddress((const GLubyte*)"glTestObjectAPPLE");
+  return glTestObjectAPPLE(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferParameteriAPPLE (GLenum a0, GLenum a1, GLint a2)
+{
+  glBufferParameteriAPPLE = (PFNGLBUFFERPARAMETERIAPPLEPROC)glewGetProcAddress((const GLubyte*)"glBufferParameteriAPPLE");
+  glBufferParameteriAPPLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFlushMappedBufferRangeAPPLE (GLenum a0, GLintptr a1, GLsizeiptr a2)
+{
+  glFlushMappedBufferRangeAPPLE = (PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedBufferRangeAPPLE");
+  glFlushMappedBufferRangeAPPLE(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleAPPLE (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glRenderbufferStorageMultisampleAPPLE = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleAPPLE");
+  glRenderbufferStorageMultisampleAPPLE(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glResolveMultisampleFramebufferAPPLE (void)
+{
+  glResolveMultisampleFramebufferAPPLE = (PFNGLRESOLVEMULTISAMPLEFRAMEBUFFERAPPLEPROC)glewGetProcAddress((const GLubyte*)"glResolveMultisampleFramebufferAPPLE");
+  glResolveMultisampleFramebufferAPPLE();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetObjectParameterivAPPLE (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetObjectParameterivAPPLE = (PFNGLGETOBJECTPARAMETERIVAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGetObjectParameterivAPPLE");
+  glGetObjectParameterivAPPLE(a0, a1, a2, a3);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glObjectPurgeableAPPLE (GLenum a0, GLuint a1, GLenum a2)
+{
+  glObjectPurgeableAPPLE = (PFNGLOBJECTPURGEABLEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glObjectPurgeableAPPLE");
+  return glObjectPurgeableAPPLE(a0, a1, a2);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glObjectUnpurgeableAPPLE (GLenum a0, GLuint a1, GLenum a2)
+{
+  glObjectUnpurgeableAPPLE = (PFNGLOBJECTUNPURGEABLEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glObjectUnpurgeableAPPLE");
+  return glObjectUnpurgeableAPPLE(a0, a1, a2);
+}
+
+
+
+static GLenum GLAPIENTRY _glewLazy_glClientWaitSyncAPPLE (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  glClientWaitSyncAPPLE = (PFNGLCLIENTWAITSYNCAPPLEPROC)glewGetProcAddress((const GLubyte*)"glClientWaitSyncAPPLE");
+  return glClientWaitSyncAPPLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteSyncAPPLE (GLsync a0)
+{
+  glDeleteSyncAPPLE = (PFNGLDELETESYNCAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteSyncAPPLE");
+  glDeleteSyncAPPLE(a0);
+}
+
+static GLsync GLAPIENTRY _glewLazy_glFenceSyncAPPLE (GLenum a0, GLbitfield a1)
+{
+  glFenceSyncAPPLE = (PFNGLFENCESYNCAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFenceSyncAPPLE");
+  return glFenceSyncAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInteger64vAPPLE (GLenum a0, GLint64* a1)
+{
+  glGetInteger64vAPPLE = (PFNGLGETINTEGER64VAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGetInteger64vAPPLE");
+  glGetInteger64vAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSyncivAPPLE (GLsync a0, GLenum a1, GLsizei a2, GLsizei* a3, GLint * a4)
+{
+  glGetSyncivAPPLE = (PFNGLGETSYNCIVAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGetSyncivAPPLE");
+  glGetSyncivAPPLE(a0, a1, a2, a3, a4);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSyncAPPLE (GLsync a0)
+{
+  glIsSyncAPPLE = (PFNGLISSYNCAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsSyncAPPLE");
+  return glIsSyncAPPLE(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWaitSyncAPPLE (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  glWaitSyncAPPLE = (PFNGLWAITSYNCAPPLEPROC)glewGetProcAddress((const GLubyte*)"glWaitSyncAPPLE");
+  glWaitSyncAPPLE(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterPointervAPPLE (GLenum a0, GLenum a1, void ** a2)
+{
+  glGetTexParameterPointervAPPLE = (PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterPointervAPPLE");
+  glGetTexParameterPointervAPPLE(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureRangeAPPLE (GLenum a0, GLsizei a1, void * a2)
+{
+  glTextureRangeAPPLE = (PFNGLTEXTURERANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glTextureRangeAPPLE");
+  glTextureRangeAPPLE(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexArrayAPPLE (GLuint a0)
+{
+  glBindVertexArrayAPPLE = (PFNGLBINDVERTEXARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glBindVertexArrayAPPLE");
+  glBindVertexArrayAPPLE(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexArraysAPPLE (GLsizei a0, const GLuint* a1)
+{
+  glDeleteVertexArraysAPPLE = (PFNGLDELETEVERTEXARRAYSAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexArraysAPPLE");
+  glDeleteVertexArraysAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenVertexArraysAPPLE (GLsizei a0, const GLuint* a1)
+{
+  glGenVertexArraysAPPLE = (PFNGLGENVERTEXARRAYSAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGenVertexArraysAPPLE");
+  glGenVertexArraysAPPLE(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexArrayAPPLE (GLuint a0)
+{
+  glIsVertexArrayAPPLE = (PFNGLISVERTEXARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsVertexArrayAPPLE");
+  return glIsVertexArrayAPPLE(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFlushVertexArrayRangeAPPLE (GLsizei a0, void * a1)
+{
+  glFlushVertexArrayRangeAPPLE = (PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFlushVertexArrayRangeAPPLE");
+  glFlushVertexArrayRangeAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayParameteriAPPLE (GLenum a0, GLint a1)
+{
+  glVertexArrayParameteriAPPLE = (PFNGLVERTEXARRAYPARAMETERIAPPLEPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayParameteriAPPLE");
+  glVertexArrayParameteriAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayRangeAPPLE (GLsizei a0, void * a1)
+{
+  glVertexArrayRangeAPPLE = (PFNGLVERTEXARRAYRANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayRangeAPPLE");
+  glVertexArrayRangeAPPLE(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDisableVertexAttribAPPLE (GLuint a0, GLenum a1)
+{
+  glDisableVertexAttribAPPLE = (PFNGLDISABLEVERTEXATTRIBAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexAttribAPPLE");
+  glDisableVertexAttribAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexAttribAPPLE (GLuint a0, GLenum a1)
+{
+  glEnableVertexAttribAPPLE = (PFNGLENABLEVERTEXATTRIBAPPLEPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexAttribAPPLE");
+  glEnableVertexAttribAPPLE(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexAttribEnabledAPPLE (GLuint a0, GLenum a1)
+{
+  glIsVertexAttribEnabledAPPLE = (PFNGLISVERTEXATTRIBENABLEDAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsVertexAttribEnabledAPPLE");
+  return glIsVertexAttribEnabledAPPLE(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib1dAPPLE (GLuint a0, GLuint a1, GLdouble a2, GLdouble a3, GLint a4, GLint a5, const GLdouble* a6)
+{
+  glMapVertexAttrib1dAPPLE = (PFNGLMAPVERTEXATTRIB1DAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib1dAPPLE");
+  glMapVertexAttrib1dAPPLE(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib1fAPPLE (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3, GLint a4, GLint a5, const GLfloat* a6)
+{
+  glMapVertexAttrib1fAPPLE = (PFNGLMAPVERTEXATTRIB1FAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib1fAPPLE");
+  glMapVertexAttrib1fAPPLE(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib2dAPPLE (GLuint a0, GLuint a1, GLdouble a2, GLdouble a3, GLint a4, GLint a5, GLdouble a6, GLdouble a7, GLint a8, GLint a9, const GLdouble* a10)
+{
+  glMapVertexAttrib2dAPPLE = (PFNGLMAPVERTEXATTRIB2DAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib2dAPPLE");
+  glMapVertexAttrib2dAPPLE(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib2fAPPLE (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3, GLint a4, GLint a5, GLfloat a6, GLfloat a7, GLint a8, GLint a9, const GLfloat* a10)
+{
+  glMapVertexAttrib2fAPPLE = (PFNGLMAPVERTEXATTRIB2FAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib2fAPPLE");
+  glMapVertexAttrib2fAPPLE(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearDepthf (GLclampf a0)
+{
+  glClearDepthf = (PFNGLCLEARDEPTHFPROC)glewGetProcAddress((const GLubyte*)"glClearDepthf");
+  glClearDepthf(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangef (GLclampf a0, GLclampf a1)
+{
+  glDepthRangef = (PFNGLDEPTHRANGEFPROC)glewGetProcAddress((const GLubyte*)"glDepthRangef");
+  glDepthRangef(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderPrecisionFormat (GLenum a0, GLenum a1, GLint* a2, GLint * a3)
+{
+  glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)glewGetProcAddress((const GLubyte*)"glGetShaderPrecisionFormat");
+  glGetShaderPrecisionFormat(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReleaseShaderCompiler (void)
+{
+  glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)glewGetProcAddress((const GLubyte*)"glReleaseShaderCompiler");
+  glReleaseShaderCompiler();
+}
+
+static void GLAPIENTRY _glewLazy_glShaderBinary (GLsizei a0, const GLuint* a1, GLenum a2, const void* a3, GLsizei a4)
+{
+  glShaderBinary = (PFNGLSHADERBINARYPROC)glewGetProcAddress((const GLubyte*)"glShaderBinary");
+  glShaderBinary(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMemoryBarrierByRegion (GLbitfield a0)
+{
+  glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)glewGetProcAddress((const GLubyte*)"glMemoryBarrierByRegion");
+  glMemoryBarrierByRegion(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPrimitiveBoundingBoxARB (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glPrimitiveBoundingBoxARB = (PFNGLPRIMITIVEBOUNDINGBOXARBPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveBoundingBoxARB");
+  glPrimitiveBoundingBoxARB(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedBaseInstance (GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4)
+{
+  glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedBaseInstance");
+  glDrawArraysInstancedBaseInstance(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseInstance (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLuint a5)
+{
+  glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseInstance");
+  glDrawElementsInstancedBaseInstance(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseVertexBaseInstance (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5, GLuint a6)
+{
+  glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseVertexBaseInstance");
+  glDrawElementsInstancedBaseVertexBaseInstance(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetImageHandleARB (GLuint a0, GLint a1, GLboolean a2, GLint a3, GLenum a4)
+{
+  glGetImageHandleARB = (PFNGLGETIMAGEHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetImageHandleARB");
+  return glGetImageHandleARB(a0, a1, a2, a3, a4);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureHandleARB (GLuint a0)
+{
+  glGetTextureHandleARB = (PFNGLGETTEXTUREHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetTextureHandleARB");
+  return glGetTextureHandleARB(a0);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureSamplerHandleARB (GLuint a0, GLuint a1)
+{
+  glGetTextureSamplerHandleARB = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSamplerHandleARB");
+  return glGetTextureSamplerHandleARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLui64vARB (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  glGetVertexAttribLui64vARB = (PFNGLGETVERTEXATTRIBLUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLui64vARB");
+  glGetVertexAttribLui64vARB(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsImageHandleResidentARB (GLuint64 a0)
+{
+  glIsImageHandleResidentARB = (PFNGLISIMAGEHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glIsImageHandleResidentARB");
+  return glIsImageHandleResidentARB(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTextureHandleResidentARB (GLuint64 a0)
+{
+  glIsTextureHandleResidentARB = (PFNGLISTEXTUREHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glIsTextureHandleResidentARB");
+  return glIsTextureHandleResidentARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleNonResidentARB (GLuint64 a0)
+{
+  glMakeImageHandleNonResidentARB = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleNonResidentARB");
+  glMakeImageHandleNonResidentARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleResidentARB (GLuint64 a0, GLenum a1)
+{
+  glMakeImageHandleResidentARB = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleResidentARB");
+  glMakeImageHandleResidentARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleNonResidentARB (GLuint64 a0)
+{
+  glMakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleNonResidentARB");
+  glMakeTextureHandleNonResidentARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleResidentARB (GLuint64 a0)
+{
+  glMakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleResidentARB");
+  glMakeTextureHandleResidentARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64ARB (GLuint a0, GLint a1, GLuint64 a2)
+{
+  glProgramUniformHandleui64ARB = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64ARB");
+  glProgramUniformHandleui64ARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniformHandleui64vARB = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64vARB");
+  glProgramUniformHandleui64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64ARB (GLint a0, GLuint64 a1)
+{
+  glUniformHandleui64ARB = (PFNGLUNIFORMHANDLEUI64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64ARB");
+  glUniformHandleui64ARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniformHandleui64vARB = (PFNGLUNIFORMHANDLEUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64vARB");
+  glUniformHandleui64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64ARB (GLuint a0, GLuint64EXT a1)
+{
+  glVertexAttribL1ui64ARB = (PFNGLVERTEXATTRIBL1UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64ARB");
+  glVertexAttribL1ui64ARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64vARB (GLuint a0, const GLuint64EXT* a1)
+{
+  glVertexAttribL1ui64vARB = (PFNGLVERTEXATTRIBL1UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64vARB");
+  glVertexAttribL1ui64vARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocationIndexed (GLuint a0, GLuint a1, GLuint a2, const GLchar * a3)
+{
+  glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocationIndexed");
+  glBindFragDataLocationIndexed(a0, a1, a2, a3);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataIndex (GLuint a0, const GLchar * a1)
+{
+  glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataIndex");
+  return glGetFragDataIndex(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferStorage (GLenum a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glBufferStorage");
+  glBufferStorage(a0, a1, a2, a3);
+}
+
+
+
+static GLsync GLAPIENTRY _glewLazy_glCreateSyncFromCLeventARB (cl_context a0, cl_event a1, GLbitfield a2)
+{
+  glCreateSyncFromCLeventARB = (PFNGLCREATESYNCFROMCLEVENTARBPROC)glewGetProcAddress((const GLubyte*)"glCreateSyncFromCLeventARB");
+  return glCreateSyncFromCLeventARB(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearBufferData (GLenum a0, GLenum a1, GLenum a2, GLenum a3, const void * a4)
+{
+  glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glClearBufferData");
+  glClearBufferData(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferSubData (GLenum a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glClearBufferSubData");
+  glClearBufferSubData(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferDataEXT (GLuint a0, GLenum a1, GLenum a2, GLenum a3, const void * a4)
+{
+  glClearNamedBufferDataEXT = (PFNGLCLEARNAMEDBUFFERDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferDataEXT");
+  glClearNamedBufferDataEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferSubDataEXT (GLuint a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glClearNamedBufferSubDataEXT = (PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferSubDataEXT");
+  glClearNamedBufferSubDataEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearTexImage (GLuint a0, GLint a1, GLenum a2, GLenum a3, const void * a4)
+{
+  glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glClearTexImage");
+  glClearTexImage(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glClearTexSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glClearTexSubImage");
+  glClearTexSubImage(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClipControl (GLenum a0, GLenum a1)
+{
+  glClipControl = (PFNGLCLIPCONTROLPROC)glewGetProcAddress((const GLubyte*)"glClipControl");
+  glClipControl(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClampColorARB (GLenum a0, GLenum a1)
+{
+  glClampColorARB = (PFNGLCLAMPCOLORARBPROC)glewGetProcAddress((const GLubyte*)"glClampColorARB");
+  glClampColorARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDispatchCompute (GLuint a0, GLuint a1, GLuint a2)
+{
+  glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glewGetProcAddress((const GLubyte*)"glDispatchCompute");
+  glDispatchCompute(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDispatchComputeIndirect (GLintptr a0)
+{
+  glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glDispatchComputeIndirect");
+  glDispatchComputeIndirect(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDispatchComputeGroupSizeARB (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  glDispatchComputeGroupSizeARB = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)glewGetProcAddress((const GLubyte*)"glDispatchComputeGroupSizeARB");
+  glDispatchComputeGroupSizeARB(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyBufferSubData (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glCopyBufferSubData");
+  glCopyBufferSubData(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyImageSubData (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)glewGetProcAddress((const GLubyte*)"glCopyImageSubData");
+  glCopyImageSubData(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDebugMessageCallbackARB (GLDEBUGPROCARB a0, const void * a1)
+{
+  glDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageCallbackARB");
+  glDebugMessageCallbackARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageControlARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint* a4, GLboolean a5)
+{
+  glDebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageControlARB");
+  glDebugMessageControlARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageInsertARB (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar* a5)
+{
+  glDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageInsertARB");
+  glDebugMessageInsertARB(a0, a1, a2, a3, a4, a5);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetDebugMessageLogARB (GLuint a0, GLsizei a1, GLenum* a2, GLenum* a3, GLuint* a4, GLenum* a5, GLsizei* a6, GLchar* a7)
+{
+  glGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC)glewGetProcAddress((const GLubyte*)"glGetDebugMessageLogARB");
+  return glGetDebugMessageLogARB(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindTextureUnit (GLuint a0, GLuint a1)
+{
+  glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)glewGetProcAddress((const GLubyte*)"glBindTextureUnit");
+  glBindTextureUnit(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlitNamedFramebuffer (GLuint a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLint a8, GLint a9, GLbitfield a10, GLenum a11)
+{
+  glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBlitNamedFramebuffer");
+  glBlitNamedFramebuffer(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckNamedFramebufferStatus (GLuint a0, GLenum a1)
+{
+  glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glewGetProcAddress((const GLubyte*)"glCheckNamedFramebufferStatus");
+  return glCheckNamedFramebufferStatus(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferData (GLuint a0, GLenum a1, GLenum a2, GLenum a3, const void * a4)
+{
+  glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferData");
+  glClearNamedBufferData(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferSubData (GLuint a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferSubData");
+  glClearNamedBufferSubData(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferfi (GLuint a0, GLenum a1, GLint a2, GLfloat a3, GLint a4)
+{
+  glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferfi");
+  glClearNamedFramebufferfi(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferfv (GLuint a0, GLenum a1, GLint a2, const GLfloat* a3)
+{
+  glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferfv");
+  glClearNamedFramebufferfv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferiv (GLuint a0, GLenum a1, GLint a2, const GLint* a3)
+{
+  glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferiv");
+  glClearNamedFramebufferiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferuiv (GLuint a0, GLenum a1, GLint a2, const GLuint* a3)
+{
+  glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferuiv");
+  glClearNamedFramebufferuiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage1D (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6)
+{
+  glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage1D");
+  glCompressedTextureSubImage1D(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage2D (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8)
+{
+  glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage2D");
+  glCompressedTextureSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage3D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage3D");
+  glCompressedTextureSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyNamedBufferSubData (GLuint a0, GLuint a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glCopyNamedBufferSubData");
+  glCopyNamedBufferSubData(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage1D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage1D");
+  glCopyTextureSubImage1D(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage2D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7)
+{
+  glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage2D");
+  glCopyTextureSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage3D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage3D");
+  glCopyTextureSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateBuffers (GLsizei a0, GLuint* a1)
+{
+  glCreateBuffers = (PFNGLCREATEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glCreateBuffers");
+  glCreateBuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateFramebuffers (GLsizei a0, GLuint* a1)
+{
+  glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glCreateFramebuffers");
+  glCreateFramebuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateProgramPipelines (GLsizei a0, GLuint* a1)
+{
+  glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)glewGetProcAddress((const GLubyte*)"glCreateProgramPipelines");
+  glCreateProgramPipelines(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateQueries (GLenum a0, GLsizei a1, GLuint* a2)
+{
+  glCreateQueries = (PFNGLCREATEQUERIESPROC)glewGetProcAddress((const GLubyte*)"glCreateQueries");
+  glCreateQueries(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateRenderbuffers (GLsizei a0, GLuint* a1)
+{
+  glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glCreateRenderbuffers");
+  glCreateRenderbuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateSamplers (GLsizei a0, GLuint* a1)
+{
+  glCreateSamplers = (PFNGLCREATESAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glCreateSamplers");
+  glCreateSamplers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateTextures (GLenum a0, GLsizei a1, GLuint* a2)
+{
+  glCreateTextures = (PFNGLCREATETEXTURESPROC)glewGetProcAddress((const GLubyte*)"glCreateTextures");
+  glCreateTextures(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateTransformFeedbacks (GLsizei a0, GLuint* a1)
+{
+  glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glewGetProcAddress((const GLubyte*)"glCreateTransformFeedbacks");
+  glCreateTransformFeedbacks(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateVertexArrays (GLsizei a0, GLuint* a1)
+{
+  glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)glewGetProcAddress((const GLubyte*)"glCreateVertexArrays");
+  glCreateVertexArrays(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexArrayAttrib (GLuint a0, GLuint a1)
+{
+  glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexArrayAttrib");
+  glDisableVertexArrayAttrib(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexArrayAttrib (GLuint a0, GLuint a1)
+{
+  glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexArrayAttrib");
+  glEnableVertexArrayAttrib(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFlushMappedNamedBufferRange (GLuint a0, GLintptr a1, GLsizeiptr a2)
+{
+  glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedNamedBufferRange");
+  glFlushMappedNamedBufferRange(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateTextureMipmap (GLuint a0)
+{
+  glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)glewGetProcAddress((const GLubyte*)"glGenerateTextureMipmap");
+  glGenerateTextureMipmap(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTextureImage (GLuint a0, GLint a1, GLsizei a2, void * a3)
+{
+  glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTextureImage");
+  glGetCompressedTextureImage(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameteri64v (GLuint a0, GLenum a1, GLint64* a2)
+{
+  glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameteri64v");
+  glGetNamedBufferParameteri64v(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameteriv");
+  glGetNamedBufferParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferPointerv (GLuint a0, GLenum a1, void** a2)
+{
+  glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferPointerv");
+  glGetNamedBufferPointerv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferSubData (GLuint a0, GLintptr a1, GLsizeiptr a2, void * a3)
+{
+  glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferSubData");
+  glGetNamedBufferSubData(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferAttachmentParameteriv (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferAttachmentParameteriv");
+  glGetNamedFramebufferAttachmentParameteriv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferParameteriv");
+  glGetNamedFramebufferParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedRenderbufferParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedRenderbufferParameteriv");
+  glGetNamedRenderbufferParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjecti64v (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjecti64v");
+  glGetQueryBufferObjecti64v(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjectiv (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjectiv");
+  glGetQueryBufferObjectiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjectui64v (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjectui64v");
+  glGetQueryBufferObjectui64v(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjectuiv (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjectuiv");
+  glGetQueryBufferObjectuiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureImage (GLuint a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5)
+{
+  glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetTextureImage");
+  glGetTextureImage(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameterfv (GLuint a0, GLint a1, GLenum a2, GLfloat* a3)
+{
+  glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameterfv");
+  glGetTextureLevelParameterfv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameteriv (GLuint a0, GLint a1, GLenum a2, GLint* a3)
+{
+  glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameteriv");
+  glGetTextureLevelParameteriv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIiv");
+  glGetTextureParameterIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIuiv");
+  glGetTextureParameterIuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterfv (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterfv");
+  glGetTextureParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameteriv");
+  glGetTextureParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbacki64_v (GLuint a0, GLenum a1, GLuint a2, GLint64* a3)
+{
+  glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbacki64_v");
+  glGetTransformFeedbacki64_v(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbacki_v (GLuint a0, GLenum a1, GLuint a2, GLint* a3)
+{
+  glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbacki_v");
+  glGetTransformFeedbacki_v(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackiv");
+  glGetTransformFeedbackiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIndexed64iv (GLuint a0, GLuint a1, GLenum a2, GLint64* a3)
+{
+  glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIndexed64iv");
+  glGetVertexArrayIndexed64iv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIndexediv (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIndexediv");
+  glGetVertexArrayIndexediv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayiv");
+  glGetVertexArrayiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateNamedFramebufferData (GLuint a0, GLsizei a1, const GLenum* a2)
+{
+  glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateNamedFramebufferData");
+  glInvalidateNamedFramebufferData(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateNamedFramebufferSubData (GLuint a0, GLsizei a1, const GLenum* a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6)
+{
+  glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateNamedFramebufferSubData");
+  glInvalidateNamedFramebufferSubData(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBuffer (GLuint a0, GLenum a1)
+{
+  glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBuffer");
+  return glMapNamedBuffer(a0, a1);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBufferRange (GLuint a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBufferRange");
+  return glMapNamedBufferRange(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferData (GLuint a0, GLsizeiptr a1, const void * a2, GLenum a3)
+{
+  glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferData");
+  glNamedBufferData(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferStorage (GLuint a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferStorage");
+  glNamedBufferStorage(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferSubData (GLuint a0, GLintptr a1, GLsizeiptr a2, const void * a3)
+{
+  glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferSubData");
+  glNamedBufferSubData(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferDrawBuffer (GLuint a0, GLenum a1)
+{
+  glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferDrawBuffer");
+  glNamedFramebufferDrawBuffer(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferDrawBuffers (GLuint a0, GLsizei a1, const GLenum* a2)
+{
+  glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferDrawBuffers");
+  glNamedFramebufferDrawBuffers(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferParameteri");
+  glNamedFramebufferParameteri(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferReadBuffer (GLuint a0, GLenum a1)
+{
+  glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferReadBuffer");
+  glNamedFramebufferReadBuffer(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferRenderbuffer (GLuint a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferRenderbuffer");
+  glNamedFramebufferRenderbuffer(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture (GLuint a0, GLenum a1, GLuint a2, GLint a3)
+{
+  glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture");
+  glNamedFramebufferTexture(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureLayer (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureLayer");
+  glNamedFramebufferTextureLayer(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorage (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorage");
+  glNamedRenderbufferStorage(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisample (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisample");
+  glNamedRenderbufferStorageMultisample(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBuffer (GLuint a0, GLenum a1, GLuint a2)
+{
+  glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)glewGetProcAddress((const GLubyte*)"glTextureBuffer");
+  glTextureBuffer(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBufferRange (GLuint a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glTextureBufferRange");
+  glTextureBufferRange(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIiv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIiv");
+  glTextureParameterIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIuiv (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIuiv");
+  glTextureParameterIuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterf (GLuint a0, GLenum a1, GLfloat a2)
+{
+  glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterf");
+  glTextureParameterf(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterfv (GLuint a0, GLenum a1, const GLfloat* a2)
+{
+  glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterfv");
+  glTextureParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glTextureParameteri");
+  glTextureParameteri(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameteriv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameteriv");
+  glTextureParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage1D (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3)
+{
+  glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage1D");
+  glTextureStorage1D(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2D (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2D");
+  glTextureStorage2D(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2DMultisample (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+{
+  glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2DMultisample");
+  glTextureStorage2DMultisample(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3D (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+{
+  glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3D");
+  glTextureStorage3D(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3DMultisample (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3DMultisample");
+  glTextureStorage3DMultisample(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage1D (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage1D");
+  glTextureSubImage1D(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage2D (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8)
+{
+  glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage2D");
+  glTextureSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage3D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage3D");
+  glTextureSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackBufferBase (GLuint a0, GLuint a1, GLuint a2)
+{
+  glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackBufferBase");
+  glTransformFeedbackBufferBase(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackBufferRange (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackBufferRange");
+  glTransformFeedbackBufferRange(a0, a1, a2, a3, a4);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapNamedBuffer (GLuint a0)
+{
+  glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)glewGetProcAddress((const GLubyte*)"glUnmapNamedBuffer");
+  return glUnmapNamedBuffer(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribBinding (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribBinding");
+  glVertexArrayAttribBinding(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribFormat (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLboolean a4, GLuint a5)
+{
+  glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribFormat");
+  glVertexArrayAttribFormat(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribIFormat (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribIFormat");
+  glVertexArrayAttribIFormat(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribLFormat (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribLFormat");
+  glVertexArrayAttribLFormat(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayBindingDivisor (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayBindingDivisor");
+  glVertexArrayBindingDivisor(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayElementBuffer (GLuint a0, GLuint a1)
+{
+  glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayElementBuffer");
+  glVertexArrayElementBuffer(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexBuffer (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizei a4)
+{
+  glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexBuffer");
+  glVertexArrayVertexBuffer(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexBuffers (GLuint a0, GLuint a1, GLsizei a2, const GLuint* a3, const GLintptr * a4, const GLsizei * a5)
+{
+  glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexBuffers");
+  glVertexArrayVertexBuffers(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersARB (GLsizei a0, const GLenum* a1)
+{
+  glDrawBuffersARB = (PFNGLDRAWBUFFERSARBPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersARB");
+  glDrawBuffersARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateiARB (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendEquationSeparateiARB = (PFNGLBLENDEQUATIONSEPARATEIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateiARB");
+  glBlendEquationSeparateiARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationiARB (GLuint a0, GLenum a1)
+{
+  glBlendEquationiARB = (PFNGLBLENDEQUATIONIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationiARB");
+  glBlendEquationiARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateiARB (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  glBlendFuncSeparateiARB = (PFNGLBLENDFUNCSEPARATEIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateiARB");
+  glBlendFuncSeparateiARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFunciARB (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendFunciARB = (PFNGLBLENDFUNCIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendFunciARB");
+  glBlendFunciARB(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementsBaseVertex (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLint a4)
+{
+  glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsBaseVertex");
+  glDrawElementsBaseVertex(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseVertex (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5)
+{
+  glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseVertex");
+  glDrawElementsInstancedBaseVertex(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementsBaseVertex (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5, GLint a6)
+{
+  glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementsBaseVertex");
+  glDrawRangeElementsBaseVertex(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsBaseVertex (GLenum a0, const GLsizei* a1, GLenum a2, const void*const * a3, GLsizei a4, const GLint * a5)
+{
+  glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsBaseVertex");
+  glMultiDrawElementsBaseVertex(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysIndirect (GLenum a0, const void * a1)
+{
+  glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysIndirect");
+  glDrawArraysIndirect(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsIndirect (GLenum a0, GLenum a1, const void * a2)
+{
+  glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsIndirect");
+  glDrawElementsIndirect(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferParameteri (GLenum a0, GLenum a1, GLint a2)
+{
+  glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glFramebufferParameteri");
+  glFramebufferParameteri(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferParameteriv (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferParameteriv");
+  glGetFramebufferParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetNamedFramebufferParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferParameterivEXT");
+  glGetNamedFramebufferParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferParameteriEXT (GLuint a0, GLenum a1, GLint a2)
+{
+  glNamedFramebufferParameteriEXT = (PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferParameteriEXT");
+  glNamedFramebufferParameteriEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindFramebuffer (GLenum a0, GLuint a1)
+{
+  glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindFramebuffer");
+  glBindFramebuffer(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindRenderbuffer (GLenum a0, GLuint a1)
+{
+  glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindRenderbuffer");
+  glBindRenderbuffer(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlitFramebuffer (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebuffer");
+  glBlitFramebuffer(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckFramebufferStatus (GLenum a0)
+{
+  glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glewGetProcAddress((const GLubyte*)"glCheckFramebufferStatus");
+  return glCheckFramebufferStatus(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFramebuffers (GLsizei a0, const GLuint* a1)
+{
+  glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteFramebuffers");
+  glDeleteFramebuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteRenderbuffers (GLsizei a0, const GLuint* a1)
+{
+  glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteRenderbuffers");
+  glDeleteRenderbuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferRenderbuffer (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glFramebufferRenderbuffer");
+  glFramebufferRenderbuffer(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture1D (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture1D");
+  glFramebufferTexture1D(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2D (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2D");
+  glFramebufferTexture2D(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture3D (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture3D");
+  glFramebufferTexture3D(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayer (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayer");
+  glFramebufferTextureLayer(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFramebuffers (GLsizei a0, GLuint* a1)
+{
+  glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glGenFramebuffers");
+  glGenFramebuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenRenderbuffers (GLsizei a0, GLuint* a1)
+{
+  glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glGenRenderbuffers");
+  glGenRenderbuffers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMipmap (GLenum a0)
+{
+  glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glewGetProcAddress((const GLubyte*)"glGenerateMipmap");
+  glGenerateMipmap(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferAttachmentParameteriv (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferAttachmentParameteriv");
+  glGetFramebufferAttachmentParameteriv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetRenderbufferParameteriv (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetRenderbufferParameteriv");
+  glGetRenderbufferParameteriv(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFramebuffer (GLuint a0)
+{
+  glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glIsFramebuffer");
+  return glIsFramebuffer(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsRenderbuffer (GLuint a0)
+{
+  glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glIsRenderbuffer");
+  return glIsRenderbuffer(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorage (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorage");
+  glRenderbufferStorage(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisample");
+  glRenderbufferStorageMultisample(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureARB (GLenum a0, GLenum a1, GLuint a2, GLint a3)
+{
+  glFramebufferTextureARB = (PFNGLFRAMEBUFFERTEXTUREARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureARB");
+  glFramebufferTextureARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureFaceARB (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLenum a4)
+{
+  glFramebufferTextureFaceARB = (PFNGLFRAMEBUFFERTEXTUREFACEARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureFaceARB");
+  glFramebufferTextureFaceARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayerARB (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  glFramebufferTextureLayerARB = (PFNGLFRAMEBUFFERTEXTURELAYERARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayerARB");
+  glFramebufferTextureLayerARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameteriARB (GLuint a0, GLenum a1, GLint a2)
+{
+  glProgramParameteriARB = (PFNGLPROGRAMPARAMETERIARBPROC)glewGetProcAddress((const GLubyte*)"glProgramParameteriARB");
+  glProgramParameteriARB(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramBinary (GLuint a0, GLsizei a1, GLsizei* a2, GLenum * a3, void* a4)
+{
+  glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glewGetProcAddress((const GLubyte*)"glGetProgramBinary");
+  glGetProgramBinary(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBinary (GLuint a0, GLenum a1, const void * a2, GLsizei a3)
+{
+  glProgramBinary = (PFNGLPROGRAMBINARYPROC)glewGetProcAddress((const GLubyte*)"glProgramBinary");
+  glProgramBinary(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glProgramParameteri");
+  glProgramParameteri(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTextureSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLsizei a8, void * a9)
+{
+  glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTextureSubImage");
+  glGetCompressedTextureSubImage(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, GLsizei a10, void * a11)
+{
+  glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSubImage");
+  glGetTextureSubImage(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSpecializeShaderARB (GLuint a0, const GLchar* a1, GLuint a2, const GLuint* a3, const GLuint* a4)
+{
+  glSpecializeShaderARB = (PFNGLSPECIALIZESHADERARBPROC)glewGetProcAddress((const GLubyte*)"glSpecializeShaderARB");
+  glSpecializeShaderARB(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetUniformdv (GLuint a0, GLint a1, GLdouble* a2)
+{
+  glGetUniformdv = (PFNGLGETUNIFORMDVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformdv");
+  glGetUniformdv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1d (GLint a0, GLdouble a1)
+{
+  glUniform1d = (PFNGLUNIFORM1DPROC)glewGetProcAddress((const GLubyte*)"glUniform1d");
+  glUniform1d(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  glUniform1dv = (PFNGLUNIFORM1DVPROC)glewGetProcAddress((const GLubyte*)"glUniform1dv");
+  glUniform1dv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2d (GLint a0, GLdouble a1, GLdouble a2)
+{
+  glUniform2d = (PFNGLUNIFORM2DPROC)glewGetProcAddress((const GLubyte*)"glUniform2d");
+  glUniform2d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  glUniform2dv = (PFNGLUNIFORM2DVPROC)glewGetProcAddress((const GLubyte*)"glUniform2dv");
+  glUniform2dv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3d (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glUniform3d = (PFNGLUNIFORM3DPROC)glewGetProcAddress((const GLubyte*)"glUniform3d");
+  glUniform3d(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  glUniform3dv = (PFNGLUNIFORM3DVPROC)glewGetProcAddress((const GLubyte*)"glUniform3dv");
+  glUniform3dv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4d (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glUniform4d = (PFNGLUNIFORM4DPROC)glewGetProcAddress((const GLubyte*)"glUniform4d");
+  glUniform4d(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  glUniform4dv = (PFNGLUNIFORM4DVPROC)glewGetProcAddress((const GLubyte*)"glUniform4dv");
+  glUniform4dv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2dv");
+  glUniformMatrix2dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x3dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x3dv");
+  glUniformMatrix2x3dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x4dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x4dv");
+  glUniformMatrix2x4dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3dv");
+  glUniformMatrix3dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x2dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x2dv");
+  glUniformMatrix3x2dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x4dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x4dv");
+  glUniformMatrix3x4dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4dv");
+  glUniformMatrix4dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x2dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x2dv");
+  glUniformMatrix4x2dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x3dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x3dv");
+  glUniformMatrix4x3dv(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetUniformi64vARB (GLuint a0, GLint a1, GLint64* a2)
+{
+  glGetUniformi64vARB = (PFNGLGETUNIFORMI64VARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformi64vARB");
+  glGetUniformi64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformui64vARB (GLuint a0, GLint a1, GLuint64* a2)
+{
+  glGetUniformui64vARB = (PFNGLGETUNIFORMUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformui64vARB");
+  glGetUniformui64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformi64vARB (GLuint a0, GLint a1, GLsizei a2, GLint64* a3)
+{
+  glGetnUniformi64vARB = (PFNGLGETNUNIFORMI64VARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformi64vARB");
+  glGetnUniformi64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformui64vARB (GLuint a0, GLint a1, GLsizei a2, GLuint64* a3)
+{
+  glGetnUniformui64vARB = (PFNGLGETNUNIFORMUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformui64vARB");
+  glGetnUniformui64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i64ARB (GLuint a0, GLint a1, GLint64 a2)
+{
+  glProgramUniform1i64ARB = (PFNGLPROGRAMUNIFORM1I64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i64ARB");
+  glProgramUniform1i64ARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  glProgramUniform1i64vARB = (PFNGLPROGRAMUNIFORM1I64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i64vARB");
+  glProgramUniform1i64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui64ARB (GLuint a0, GLint a1, GLuint64 a2)
+{
+  glProgramUniform1ui64ARB = (PFNGLPROGRAMUNIFORM1UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui64ARB");
+  glProgramUniform1ui64ARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniform1ui64vARB = (PFNGLPROGRAMUNIFORM1UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui64vARB");
+  glProgramUniform1ui64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i64ARB (GLuint a0, GLint a1, GLint64 a2, GLint64 a3)
+{
+  glProgramUniform2i64ARB = (PFNGLPROGRAMUNIFORM2I64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i64ARB");
+  glProgramUniform2i64ARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  glProgramUniform2i64vARB = (PFNGLPROGRAMUNIFORM2I64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i64vARB");
+  glProgramUniform2i64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui64ARB (GLuint a0, GLint a1, GLuint64 a2, GLuint64 a3)
+{
+  glProgramUniform2ui64ARB = (PFNGLPROGRAMUNIFORM2UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui64ARB");
+  glProgramUniform2ui64ARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniform2ui64vARB = (PFNGLPROGRAMUNIFORM2UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui64vARB");
+  glProgramUniform2ui64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i64ARB (GLuint a0, GLint a1, GLint64 a2, GLint64 a3, GLint64 a4)
+{
+  glProgramUniform3i64ARB = (PFNGLPROGRAMUNIFORM3I64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i64ARB");
+  glProgramUniform3i64ARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  glProgramUniform3i64vARB = (PFNGLPROGRAMUNIFORM3I64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i64vARB");
+  glProgramUniform3i64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui64ARB (GLuint a0, GLint a1, GLuint64 a2, GLuint64 a3, GLuint64 a4)
+{
+  glProgramUniform3ui64ARB = (PFNGLPROGRAMUNIFORM3UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui64ARB");
+  glProgramUniform3ui64ARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniform3ui64vARB = (PFNGLPROGRAMUNIFORM3UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui64vARB");
+  glProgramUniform3ui64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i64ARB (GLuint a0, GLint a1, GLint64 a2, GLint64 a3, GLint64 a4, GLint64 a5)
+{
+  glProgramUniform4i64ARB = (PFNGLPROGRAMUNIFORM4I64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i64ARB");
+  glProgramUniform4i64ARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  glProgramUniform4i64vARB = (PFNGLPROGRAMUNIFORM4I64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i64vARB");
+  glProgramUniform4i64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui64ARB (GLuint a0, GLint a1, GLuint64 a2, GLuint64 a3, GLuint64 a4, GLuint64 a5)
+{
+  glProgramUniform4ui64ARB = (PFNGLPROGRAMUNIFORM4UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui64ARB");
+  glProgramUniform4ui64ARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniform4ui64vARB = (PFNGLPROGRAMUNIFORM4UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui64vARB");
+  glProgramUniform4ui64vARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i64ARB (GLint a0, GLint64 a1)
+{
+  glUniform1i64ARB = (PFNGLUNIFORM1I64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1i64ARB");
+  glUniform1i64ARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  glUniform1i64vARB = (PFNGLUNIFORM1I64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1i64vARB");
+  glUniform1i64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui64ARB (GLint a0, GLuint64 a1)
+{
+  glUniform1ui64ARB = (PFNGLUNIFORM1UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui64ARB");
+  glUniform1ui64ARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniform1ui64vARB = (PFNGLUNIFORM1UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui64vARB");
+  glUniform1ui64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i64ARB (GLint a0, GLint64 a1, GLint64 a2)
+{
+  glUniform2i64ARB = (PFNGLUNIFORM2I64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2i64ARB");
+  glUniform2i64ARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  glUniform2i64vARB = (PFNGLUNIFORM2I64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2i64vARB");
+  glUniform2i64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui64ARB (GLint a0, GLuint64 a1, GLuint64 a2)
+{
+  glUniform2ui64ARB = (PFNGLUNIFORM2UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui64ARB");
+  glUniform2ui64ARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniform2ui64vARB = (PFNGLUNIFORM2UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui64vARB");
+  glUniform2ui64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i64ARB (GLint a0, GLint64 a1, GLint64 a2, GLint64 a3)
+{
+  glUniform3i64ARB = (PFNGLUNIFORM3I64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3i64ARB");
+  glUniform3i64ARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  glUniform3i64vARB = (PFNGLUNIFORM3I64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3i64vARB");
+  glUniform3i64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui64ARB (GLint a0, GLuint64 a1, GLuint64 a2, GLuint64 a3)
+{
+  glUniform3ui64ARB = (PFNGLUNIFORM3UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui64ARB");
+  glUniform3ui64ARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniform3ui64vARB = (PFNGLUNIFORM3UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui64vARB");
+  glUniform3ui64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i64ARB (GLint a0, GLint64 a1, GLint64 a2, GLint64 a3, GLint64 a4)
+{
+  glUniform4i64ARB = (PFNGLUNIFORM4I64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4i64ARB");
+  glUniform4i64ARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  glUniform4i64vARB = (PFNGLUNIFORM4I64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4i64vARB");
+  glUniform4i64vARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui64ARB (GLint a0, GLuint64 a1, GLuint64 a2, GLuint64 a3, GLuint64 a4)
+{
+  glUniform4ui64ARB = (PFNGLUNIFORM4UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui64ARB");
+  glUniform4ui64ARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniform4ui64vARB = (PFNGLUNIFORM4UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui64vARB");
+  glUniform4ui64vARB(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorSubTable (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glColorSubTable = (PFNGLCOLORSUBTABLEPROC)glewGetProcAddress((const GLubyte*)"glColorSubTable");
+  glColorSubTable(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTable (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glColorTable = (PFNGLCOLORTABLEPROC)glewGetProcAddress((const GLubyte*)"glColorTable");
+  glColorTable(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableParameterfv (GLenum a0, GLenum a1, const GLfloat * a2)
+{
+  glColorTableParameterfv = (PFNGLCOLORTABLEPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameterfv");
+  glColorTableParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableParameteriv (GLenum a0, GLenum a1, const GLint * a2)
+{
+  glColorTableParameteriv = (PFNGLCOLORTABLEPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameteriv");
+  glColorTableParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter1D (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glConvolutionFilter1D = (PFNGLCONVOLUTIONFILTER1DPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter1D");
+  glConvolutionFilter1D(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter2D (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glConvolutionFilter2D = (PFNGLCONVOLUTIONFILTER2DPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter2D");
+  glConvolutionFilter2D(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterf (GLenum a0, GLenum a1, GLfloat a2)
+{
+  glConvolutionParameterf = (PFNGLCONVOLUTIONPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterf");
+  glConvolutionParameterf(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterfv (GLenum a0, GLenum a1, const GLfloat * a2)
+{
+  glConvolutionParameterfv = (PFNGLCONVOLUTIONPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterfv");
+  glConvolutionParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameteri (GLenum a0, GLenum a1, GLint a2)
+{
+  glConvolutionParameteri = (PFNGLCONVOLUTIONPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameteri");
+  glConvolutionParameteri(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameteriv (GLenum a0, GLenum a1, const GLint * a2)
+{
+  glConvolutionParameteriv = (PFNGLCONVOLUTIONPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameteriv");
+  glConvolutionParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorSubTable (GLenum a0, GLsizei a1, GLint a2, GLint a3, GLsizei a4)
+{
+  glCopyColorSubTable = (PFNGLCOPYCOLORSUBTABLEPROC)glewGetProcAddress((const GLubyte*)"glCopyColorSubTable");
+  glCopyColorSubTable(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorTable (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  glCopyColorTable = (PFNGLCOPYCOLORTABLEPROC)glewGetProcAddress((const GLubyte*)"glCopyColorTable");
+  glCopyColorTable(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter1D (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  glCopyConvolutionFilter1D = (PFNGLCOPYCONVOLUTIONFILTER1DPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter1D");
+  glCopyConvolutionFilter1D(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter2D (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5)
+{
+  glCopyConvolutionFilter2D = (PFNGLCOPYCONVOLUTIONFILTER2DPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter2D");
+  glCopyConvolutionFilter2D(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTable (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetColorTable = (PFNGLGETCOLORTABLEPROC)glewGetProcAddress((const GLubyte*)"glGetColorTable");
+  glGetColorTable(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  glGetColorTableParameterfv = (PFNGLGETCOLORTABLEPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterfv");
+  glGetColorTableParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  glGetColorTableParameteriv = (PFNGLGETCOLORTABLEPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameteriv");
+  glGetColorTableParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionFilter (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetConvolutionFilter = (PFNGLGETCONVOLUTIONFILTERPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionFilter");
+  glGetConvolutionFilter(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  glGetConvolutionParameterfv = (PFNGLGETCONVOLUTIONPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameterfv");
+  glGetConvolutionParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  glGetConvolutionParameteriv = (PFNGLGETCONVOLUTIONPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameteriv");
+  glGetConvolutionParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogram (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  glGetHistogram = (PFNGLGETHISTOGRAMPROC)glewGetProcAddress((const GLubyte*)"glGetHistogram");
+  glGetHistogram(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  glGetHistogramParameterfv = (PFNGLGETHISTOGRAMPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameterfv");
+  glGetHistogramParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  glGetHistogramParameteriv = (PFNGLGETHISTOGRAMPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameteriv");
+  glGetHistogramParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmax (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  glGetMinmax = (PFNGLGETMINMAXPROC)glewGetProcAddress((const GLubyte*)"glGetMinmax");
+  glGetMinmax(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  glGetMinmaxParameterfv = (PFNGLGETMINMAXPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameterfv");
+  glGetMinmaxParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  glGetMinmaxParameteriv = (PFNGLGETMINMAXPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameteriv");
+  glGetMinmaxParameteriv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSeparableFilter (GLenum a0, GLenum a1, GLenum a2, void * a3, void * a4, void * a5)
+{
+  glGetSeparableFilter = (PFNGLGETSEPARABLEFILTERPROC)glewGetProcAddress((const GLubyte*)"glGetSeparableFilter");
+  glGetSeparableFilter(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glHistogram (GLenum a0, GLsizei a1, GLenum a2, GLboolean a3)
+{
+  glHistogram = (PFNGLHISTOGRAMPROC)glewGetProcAddress((const GLubyte*)"glHistogram");
+  glHistogram(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMinmax (GLenum a0, GLenum a1, GLboolean a2)
+{
+  glMinmax = (PFNGLMINMAXPROC)glewGetProcAddress((const GLubyte*)"glMinmax");
+  glMinmax(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glResetHistogram (GLenum a0)
+{
+  glResetHistogram = (PFNGLRESETHISTOGRAMPROC)glewGetProcAddress((const GLubyte*)"glResetHistogram");
+  glResetHistogram(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glResetMinmax (GLenum a0)
+{
+  glResetMinmax = (PFNGLRESETMINMAXPROC)glewGetProcAddress((const GLubyte*)"glResetMinmax");
+  glResetMinmax(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSeparableFilter2D (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6, const void * a7)
+{
+  glSeparableFilter2D = (PFNGLSEPARABLEFILTER2DPROC)glewGetProcAddress((const GLubyte*)"glSeparableFilter2D");
+  glSeparableFilter2D(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectCountARB (GLenum a0, const void * a1, GLintptr a2, GLsizei a3, GLsizei a4)
+{
+  glMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectCountARB");
+  glMultiDrawArraysIndirectCountARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectCountARB (GLenum a0, GLenum a1, const void * a2, GLintptr a3, GLsizei a4, GLsizei a5)
+{
+  glMultiDrawElementsIndirectCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectCountARB");
+  glMultiDrawElementsIndirectCountARB(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedARB (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glDrawArraysInstancedARB = (PFNGLDRAWARRAYSINSTANCEDARBPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedARB");
+  glDrawArraysInstancedARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedARB (GLenum a0, GLsizei a1, GLenum a2, const void* a3, GLsizei a4)
+{
+  glDrawElementsInstancedARB = (PFNGLDRAWELEMENTSINSTANCEDARBPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedARB");
+  glDrawElementsInstancedARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisorARB (GLuint a0, GLuint a1)
+{
+  glVertexAttribDivisorARB = (PFNGLVERTEXATTRIBDIVISORARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisorARB");
+  glVertexAttribDivisorARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetInternalformativ (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint* a4)
+{
+  glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)glewGetProcAddress((const GLubyte*)"glGetInternalformativ");
+  glGetInternalformativ(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetInternalformati64v (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint64* a4)
+{
+  glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)glewGetProcAddress((const GLubyte*)"glGetInternalformati64v");
+  glGetInternalformati64v(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glInvalidateBufferData (GLuint a0)
+{
+  glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateBufferData");
+  glInvalidateBufferData(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateBufferSubData (GLuint a0, GLintptr a1, GLsizeiptr a2)
+{
+  glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateBufferSubData");
+  glInvalidateBufferSubData(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateFramebuffer (GLenum a0, GLsizei a1, const GLenum* a2)
+{
+  glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glInvalidateFramebuffer");
+  glInvalidateFramebuffer(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateSubFramebuffer (GLenum a0, GLsizei a1, const GLenum* a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6)
+{
+  glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glInvalidateSubFramebuffer");
+  glInvalidateSubFramebuffer(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateTexImage (GLuint a0, GLint a1)
+{
+  glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glInvalidateTexImage");
+  glInvalidateTexImage(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateTexSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7)
+{
+  glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glInvalidateTexSubImage");
+  glInvalidateTexSubImage(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFlushMappedBufferRange (GLenum a0, GLintptr a1, GLsizeiptr a2)
+{
+  glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedBufferRange");
+  glFlushMappedBufferRange(a0, a1, a2);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapBufferRange (GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glMapBufferRange");
+  return glMapBufferRange(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCurrentPaletteMatrixARB (GLint a0)
+{
+  glCurrentPaletteMatrixARB = (PFNGLCURRENTPALETTEMATRIXARBPROC)glewGetProcAddress((const GLubyte*)"glCurrentPaletteMatrixARB");
+  glCurrentPaletteMatrixARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexPointerARB (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  glMatrixIndexPointerARB = (PFNGLMATRIXINDEXPOINTERARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexPointerARB");
+  glMatrixIndexPointerARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexubvARB (GLint a0, GLubyte * a1)
+{
+  glMatrixIndexubvARB = (PFNGLMATRIXINDEXUBVARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexubvARB");
+  glMatrixIndexubvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexuivARB (GLint a0, GLuint * a1)
+{
+  glMatrixIndexuivARB = (PFNGLMATRIXINDEXUIVARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexuivARB");
+  glMatrixIndexuivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexusvARB (GLint a0, GLushort * a1)
+{
+  glMatrixIndexusvARB = (PFNGLMATRIXINDEXUSVARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexusvARB");
+  glMatrixIndexusvARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindBuffersBase (GLenum a0, GLuint a1, GLsizei a2, const GLuint* a3)
+{
+  glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)glewGetProcAddress((const GLubyte*)"glBindBuffersBase");
+  glBindBuffersBase(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBuffersRange (GLenum a0, GLuint a1, GLsizei a2, const GLuint* a3, const GLintptr * a4, const GLsizeiptr * a5)
+{
+  glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)glewGetProcAddress((const GLubyte*)"glBindBuffersRange");
+  glBindBuffersRange(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glBindImageTextures (GLuint a0, GLsizei a1, const GLuint* a2)
+{
+  glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)glewGetProcAddress((const GLubyte*)"glBindImageTextures");
+  glBindImageTextures(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindSamplers (GLuint a0, GLsizei a1, const GLuint* a2)
+{
+  glBindSamplers = (PFNGLBINDSAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glBindSamplers");
+  glBindSamplers(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindTextures (GLuint a0, GLsizei a1, const GLuint* a2)
+{
+  glBindTextures = (PFNGLBINDTEXTURESPROC)glewGetProcAddress((const GLubyte*)"glBindTextures");
+  glBindTextures(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVertexBuffers (GLuint a0, GLsizei a1, const GLuint* a2, const GLintptr * a3, const GLsizei * a4)
+{
+  glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glBindVertexBuffers");
+  glBindVertexBuffers(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirect (GLenum a0, const void * a1, GLsizei a2, GLsizei a3)
+{
+  glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirect");
+  glMultiDrawArraysIndirect(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirect (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4)
+{
+  glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirect");
+  glMultiDrawElementsIndirect(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSampleCoverageARB (GLclampf a0, GLboolean a1)
+{
+  glSampleCoverageARB = (PFNGLSAMPLECOVERAGEARBPROC)glewGetProcAddress((const GLubyte*)"glSampleCoverageARB");
+  glSampleCoverageARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glActiveTextureARB (GLenum a0)
+{
+  glActiveTextureARB = (PFNGLACTIVETEXTUREARBPROC)glewGetProcAddress((const GLubyte*)"glActiveTextureARB");
+  glActiveTextureARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glClientActiveTextureARB (GLenum a0)
+{
+  glClientActiveTextureARB = (PFNGLCLIENTACTIVETEXTUREARBPROC)glewGetProcAddress((const GLubyte*)"glClientActiveTextureARB");
+  glClientActiveTextureARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1dARB (GLenum a0, GLdouble a1)
+{
+  glMultiTexCoord1dARB = (PFNGLMULTITEXCOORD1DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1dARB");
+  glMultiTexCoord1dARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1dvARB (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord1dvARB = (PFNGLMULTITEXCOORD1DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1dvARB");
+  glMultiTexCoord1dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1fARB (GLenum a0, GLfloat a1)
+{
+  glMultiTexCoord1fARB = (PFNGLMULTITEXCOORD1FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1fARB");
+  glMultiTexCoord1fARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1fvARB (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord1fvARB = (PFNGLMULTITEXCOORD1FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1fvARB");
+  glMultiTexCoord1fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1iARB (GLenum a0, GLint a1)
+{
+  glMultiTexCoord1iARB = (PFNGLMULTITEXCOORD1IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1iARB");
+  glMultiTexCoord1iARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1ivARB (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord1ivARB = (PFNGLMULTITEXCOORD1IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1ivARB");
+  glMultiTexCoord1ivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1sARB (GLenum a0, GLshort a1)
+{
+  glMultiTexCoord1sARB = (PFNGLMULTITEXCOORD1SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1sARB");
+  glMultiTexCoord1sARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1svARB (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord1svARB = (PFNGLMULTITEXCOORD1SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1svARB");
+  glMultiTexCoord1svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2dARB (GLenum a0, GLdouble a1, GLdouble a2)
+{
+  glMultiTexCoord2dARB = (PFNGLMULTITEXCOORD2DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2dARB");
+  glMultiTexCoord2dARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2dvARB (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord2dvARB = (PFNGLMULTITEXCOORD2DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2dvARB");
+  glMultiTexCoord2dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2fARB (GLenum a0, GLfloat a1, GLfloat a2)
+{
+  glMultiTexCoord2fARB = (PFNGLMULTITEXCOORD2FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2fARB");
+  glMultiTexCoord2fARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2fvARB (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord2fvARB = (PFNGLMULTITEXCOORD2FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2fvARB");
+  glMultiTexCoord2fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2iARB (GLenum a0, GLint a1, GLint a2)
+{
+  glMultiTexCoord2iARB = (PFNGLMULTITEXCOORD2IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2iARB");
+  glMultiTexCoord2iARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2ivARB (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord2ivARB = (PFNGLMULTITEXCOORD2IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2ivARB");
+  glMultiTexCoord2ivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2sARB (GLenum a0, GLshort a1, GLshort a2)
+{
+  glMultiTexCoord2sARB = (PFNGLMULTITEXCOORD2SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2sARB");
+  glMultiTexCoord2sARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2svARB (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord2svARB = (PFNGLMULTITEXCOORD2SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2svARB");
+  glMultiTexCoord2svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3dARB (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glMultiTexCoord3dARB = (PFNGLMULTITEXCOORD3DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3dARB");
+  glMultiTexCoord3dARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3dvARB (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord3dvARB = (PFNGLMULTITEXCOORD3DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3dvARB");
+  glMultiTexCoord3dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3fARB (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glMultiTexCoord3fARB = (PFNGLMULTITEXCOORD3FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3fARB");
+  glMultiTexCoord3fARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3fvARB (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord3fvARB = (PFNGLMULTITEXCOORD3FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3fvARB");
+  glMultiTexCoord3fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3iARB (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  glMultiTexCoord3iARB = (PFNGLMULTITEXCOORD3IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3iARB");
+  glMultiTexCoord3iARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3ivARB (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord3ivARB = (PFNGLMULTITEXCOORD3IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3ivARB");
+  glMultiTexCoord3ivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3sARB (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glMultiTexCoord3sARB = (PFNGLMULTITEXCOORD3SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3sARB");
+  glMultiTexCoord3sARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3svARB (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord3svARB = (PFNGLMULTITEXCOORD3SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3svARB");
+  glMultiTexCoord3svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4dARB (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glMultiTexCoord4dARB = (PFNGLMULTITEXCOORD4DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4dARB");
+  glMultiTexCoord4dARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4dvARB (GLenum a0, const GLdouble * a1)
+{
+  glMultiTexCoord4dvARB = (PFNGLMULTITEXCOORD4DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4dvARB");
+  glMultiTexCoord4dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4fARB (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glMultiTexCoord4fARB = (PFNGLMULTITEXCOORD4FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4fARB");
+  glMultiTexCoord4fARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4fvARB (GLenum a0, const GLfloat * a1)
+{
+  glMultiTexCoord4fvARB = (PFNGLMULTITEXCOORD4FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4fvARB");
+  glMultiTexCoord4fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4iARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glMultiTexCoord4iARB = (PFNGLMULTITEXCOORD4IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4iARB");
+  glMultiTexCoord4iARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4ivARB (GLenum a0, const GLint * a1)
+{
+  glMultiTexCoord4ivARB = (PFNGLMULTITEXCOORD4IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4ivARB");
+  glMultiTexCoord4ivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4sARB (GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  glMultiTexCoord4sARB = (PFNGLMULTITEXCOORD4SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4sARB");
+  glMultiTexCoord4sARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4svARB (GLenum a0, const GLshort * a1)
+{
+  glMultiTexCoord4svARB = (PFNGLMULTITEXCOORD4SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4svARB");
+  glMultiTexCoord4svARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryARB (GLenum a0, GLuint a1)
+{
+  glBeginQueryARB = (PFNGLBEGINQUERYARBPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryARB");
+  glBeginQueryARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueriesARB (GLsizei a0, const GLuint* a1)
+{
+  glDeleteQueriesARB = (PFNGLDELETEQUERIESARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueriesARB");
+  glDeleteQueriesARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryARB (GLenum a0)
+{
+  glEndQueryARB = (PFNGLENDQUERYARBPROC)glewGetProcAddress((const GLubyte*)"glEndQueryARB");
+  glEndQueryARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueriesARB (GLsizei a0, GLuint* a1)
+{
+  glGenQueriesARB = (PFNGLGENQUERIESARBPROC)glewGetProcAddress((const GLubyte*)"glGenQueriesARB");
+  glGenQueriesARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectivARB (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetQueryObjectivARB = (PFNGLGETQUERYOBJECTIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectivARB");
+  glGetQueryObjectivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuivARB (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetQueryObjectuivARB = (PFNGLGETQUERYOBJECTUIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuivARB");
+  glGetQueryObjectuivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryivARB (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetQueryivARB = (PFNGLGETQUERYIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetQueryivARB");
+  glGetQueryivARB(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQueryARB (GLuint a0)
+{
+  glIsQueryARB = (PFNGLISQUERYARBPROC)glewGetProcAddress((const GLubyte*)"glIsQueryARB");
+  return glIsQueryARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMaxShaderCompilerThreadsARB (GLuint a0)
+{
+  glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)glewGetProcAddress((const GLubyte*)"glMaxShaderCompilerThreadsARB");
+  glMaxShaderCompilerThreadsARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPointParameterfARB (GLenum a0, GLfloat a1)
+{
+  glPointParameterfARB = (PFNGLPOINTPARAMETERFARBPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfARB");
+  glPointParameterfARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterfvARB (GLenum a0, const GLfloat* a1)
+{
+  glPointParameterfvARB = (PFNGLPOINTPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfvARB");
+  glPointParameterfvARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetClamp (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetClamp");
+  glPolygonOffsetClamp(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramInterfaceiv (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramInterfaceiv");
+  glGetProgramInterfaceiv(a0, a1, a2, a3);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetProgramResourceIndex (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceIndex");
+  return glGetProgramResourceIndex(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetProgramResourceLocation (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceLocation");
+  return glGetProgramResourceLocation(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetProgramResourceLocationIndex (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceLocationIndex");
+  return glGetProgramResourceLocationIndex(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramResourceName (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei* a4, GLchar * a5)
+{
+  glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceName");
+  glGetProgramResourceName(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramResourceiv (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum* a4, GLsizei a5, GLsizei * a6, GLint * a7)
+{
+  glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceiv");
+  glGetProgramResourceiv(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glProvokingVertex (GLenum a0)
+{
+  glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glewGetProcAddress((const GLubyte*)"glProvokingVertex");
+  glProvokingVertex(a0);
+}
+
+
+
+static GLenum GLAPIENTRY _glewLazy_glGetGraphicsResetStatusARB (void)
+{
+  glGetGraphicsResetStatusARB = (PFNGLGETGRAPHICSRESETSTATUSARBPROC)glewGetProcAddress((const GLubyte*)"glGetGraphicsResetStatusARB");
+  return glGetGraphicsResetStatusARB();
+}
+
+static void GLAPIENTRY _glewLazy_glGetnColorTableARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, void* a4)
+{
+  glGetnColorTableARB = (PFNGLGETNCOLORTABLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnColorTableARB");
+  glGetnColorTableARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnCompressedTexImageARB (GLenum a0, GLint a1, GLsizei a2, void* a3)
+{
+  glGetnCompressedTexImageARB = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnCompressedTexImageARB");
+  glGetnCompressedTexImageARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnConvolutionFilterARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, void* a4)
+{
+  glGetnConvolutionFilterARB = (PFNGLGETNCONVOLUTIONFILTERARBPROC)glewGetProcAddress((const GLubyte*)"glGetnConvolutionFilterARB");
+  glGetnConvolutionFilterARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnHistogramARB (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, GLsizei a4, void* a5)
+{
+  glGetnHistogramARB = (PFNGLGETNHISTOGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glGetnHistogramARB");
+  glGetnHistogramARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMapdvARB (GLenum a0, GLenum a1, GLsizei a2, GLdouble* a3)
+{
+  glGetnMapdvARB = (PFNGLGETNMAPDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMapdvARB");
+  glGetnMapdvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMapfvARB (GLenum a0, GLenum a1, GLsizei a2, GLfloat* a3)
+{
+  glGetnMapfvARB = (PFNGLGETNMAPFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMapfvARB");
+  glGetnMapfvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMapivARB (GLenum a0, GLenum a1, GLsizei a2, GLint* a3)
+{
+  glGetnMapivARB = (PFNGLGETNMAPIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMapivARB");
+  glGetnMapivARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMinmaxARB (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, GLsizei a4, void* a5)
+{
+  glGetnMinmaxARB = (PFNGLGETNMINMAXARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMinmaxARB");
+  glGetnMinmaxARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPixelMapfvARB (GLenum a0, GLsizei a1, GLfloat* a2)
+{
+  glGetnPixelMapfvARB = (PFNGLGETNPIXELMAPFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPixelMapfvARB");
+  glGetnPixelMapfvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPixelMapuivARB (GLenum a0, GLsizei a1, GLuint* a2)
+{
+  glGetnPixelMapuivARB = (PFNGLGETNPIXELMAPUIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPixelMapuivARB");
+  glGetnPixelMapuivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPixelMapusvARB (GLenum a0, GLsizei a1, GLushort* a2)
+{
+  glGetnPixelMapusvARB = (PFNGLGETNPIXELMAPUSVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPixelMapusvARB");
+  glGetnPixelMapusvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPolygonStippleARB (GLsizei a0, GLubyte* a1)
+{
+  glGetnPolygonStippleARB = (PFNGLGETNPOLYGONSTIPPLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPolygonStippleARB");
+  glGetnPolygonStippleARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnSeparableFilterARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, void* a4, GLsizei a5, void* a6, void* a7)
+{
+  glGetnSeparableFilterARB = (PFNGLGETNSEPARABLEFILTERARBPROC)glewGetProcAddress((const GLubyte*)"glGetnSeparableFilterARB");
+  glGetnSeparableFilterARB(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnTexImageARB (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void* a5)
+{
+  glGetnTexImageARB = (PFNGLGETNTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnTexImageARB");
+  glGetnTexImageARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformdvARB (GLuint a0, GLint a1, GLsizei a2, GLdouble* a3)
+{
+  glGetnUniformdvARB = (PFNGLGETNUNIFORMDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformdvARB");
+  glGetnUniformdvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformfvARB (GLuint a0, GLint a1, GLsizei a2, GLfloat* a3)
+{
+  glGetnUniformfvARB = (PFNGLGETNUNIFORMFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformfvARB");
+  glGetnUniformfvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformivARB (GLuint a0, GLint a1, GLsizei a2, GLint* a3)
+{
+  glGetnUniformivARB = (PFNGLGETNUNIFORMIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformivARB");
+  glGetnUniformivARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformuivARB (GLuint a0, GLint a1, GLsizei a2, GLuint* a3)
+{
+  glGetnUniformuivARB = (PFNGLGETNUNIFORMUIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformuivARB");
+  glGetnUniformuivARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReadnPixelsARB (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void* a7)
+{
+  glReadnPixelsARB = (PFNGLREADNPIXELSARBPROC)glewGetProcAddress((const GLubyte*)"glReadnPixelsARB");
+  glReadnPixelsARB(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferSampleLocationsfvARB (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glFramebufferSampleLocationsfvARB = (PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferSampleLocationsfvARB");
+  glFramebufferSampleLocationsfvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferSampleLocationsfvARB (GLuint a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glNamedFramebufferSampleLocationsfvARB = (PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferSampleLocationsfvARB");
+  glNamedFramebufferSampleLocationsfvARB(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMinSampleShadingARB (GLclampf a0)
+{
+  glMinSampleShadingARB = (PFNGLMINSAMPLESHADINGARBPROC)glewGetProcAddress((const GLubyte*)"glMinSampleShadingARB");
+  glMinSampleShadingARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindSampler (GLuint a0, GLuint a1)
+{
+  glBindSampler = (PFNGLBINDSAMPLERPROC)glewGetProcAddress((const GLubyte*)"glBindSampler");
+  glBindSampler(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteSamplers (GLsizei a0, const GLuint * a1)
+{
+  glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteSamplers");
+  glDeleteSamplers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenSamplers (GLsizei a0, GLuint* a1)
+{
+  glGenSamplers = (PFNGLGENSAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glGenSamplers");
+  glGenSamplers(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIiv");
+  glGetSamplerParameterIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIuiv");
+  glGetSamplerParameterIuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterfv (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterfv");
+  glGetSamplerParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameteriv");
+  glGetSamplerParameteriv(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSampler (GLuint a0)
+{
+  glIsSampler = (PFNGLISSAMPLERPROC)glewGetProcAddress((const GLubyte*)"glIsSampler");
+  return glIsSampler(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIiv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIiv");
+  glSamplerParameterIiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIuiv (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIuiv");
+  glSamplerParameterIuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterf (GLuint a0, GLenum a1, GLfloat a2)
+{
+  glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterf");
+  glSamplerParameterf(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterfv (GLuint a0, GLenum a1, const GLfloat* a2)
+{
+  glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterfv");
+  glSamplerParameterfv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameteri");
+  glSamplerParameteri(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameteriv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameteriv");
+  glSamplerParameteriv(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glActiveShaderProgram (GLuint a0, GLuint a1)
+{
+  glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glActiveShaderProgram");
+  glActiveShaderProgram(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindProgramPipeline (GLuint a0)
+{
+  glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)glewGetProcAddress((const GLubyte*)"glBindProgramPipeline");
+  glBindProgramPipeline(a0);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateShaderProgramv (GLenum a0, GLsizei a1, const GLchar * const * a2)
+{
+  glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)glewGetProcAddress((const GLubyte*)"glCreateShaderProgramv");
+  return glCreateShaderProgramv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgramPipelines (GLsizei a0, const GLuint* a1)
+{
+  glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgramPipelines");
+  glDeleteProgramPipelines(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenProgramPipelines (GLsizei a0, GLuint* a1)
+{
+  glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)glewGetProcAddress((const GLubyte*)"glGenProgramPipelines");
+  glGenProgramPipelines(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramPipelineInfoLog (GLuint a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glewGetProcAddress((const GLubyte*)"glGetProgramPipelineInfoLog");
+  glGetProgramPipelineInfoLog(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramPipelineiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramPipelineiv");
+  glGetProgramPipelineiv(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgramPipeline (GLuint a0)
+{
+  glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)glewGetProcAddress((const GLubyte*)"glIsProgramPipeline");
+  return glIsProgramPipeline(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1d (GLuint a0, GLint a1, GLdouble a2)
+{
+  glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1d");
+  glProgramUniform1d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1dv");
+  glProgramUniform1dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1f (GLuint a0, GLint a1, GLfloat a2)
+{
+  glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1f");
+  glProgramUniform1f(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1fv");
+  glProgramUniform1fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i (GLuint a0, GLint a1, GLint a2)
+{
+  glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i");
+  glProgramUniform1i(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1iv");
+  glProgramUniform1iv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui (GLuint a0, GLint a1, GLuint a2)
+{
+  glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui");
+  glProgramUniform1ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1uiv");
+  glProgramUniform1uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2d (GLuint a0, GLint a1, GLdouble a2, GLdouble a3)
+{
+  glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2d");
+  glProgramUniform2d(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2dv");
+  glProgramUniform2dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2f (GLuint a0, GLint a1, GLfloat a2, GLfloat a3)
+{
+  glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2f");
+  glProgramUniform2f(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2fv");
+  glProgramUniform2fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i");
+  glProgramUniform2i(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2iv");
+  glProgramUniform2iv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui (GLuint a0, GLint a1, GLuint a2, GLuint a3)
+{
+  glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui");
+  glProgramUniform2ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2uiv");
+  glProgramUniform2uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3d (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3d");
+  glProgramUniform3d(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3dv");
+  glProgramUniform3dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3f (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3f");
+  glProgramUniform3f(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3fv");
+  glProgramUniform3fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i");
+  glProgramUniform3i(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3iv");
+  glProgramUniform3iv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui");
+  glProgramUniform3ui(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3uiv");
+  glProgramUniform3uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4d (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4d");
+  glProgramUniform4d(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4dv");
+  glProgramUniform4dv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4f (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4f");
+  glProgramUniform4f(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4fv");
+  glProgramUniform4fv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i");
+  glProgramUniform4i(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4iv");
+  glProgramUniform4iv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui");
+  glProgramUniform4ui(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4uiv");
+  glProgramUniform4uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2dv");
+  glProgramUniformMatrix2dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2fv");
+  glProgramUniformMatrix2fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x3dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x3dv");
+  glProgramUniformMatrix2x3dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x3fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x3fv");
+  glProgramUniformMatrix2x3fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x4dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x4dv");
+  glProgramUniformMatrix2x4dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x4fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x4fv");
+  glProgramUniformMatrix2x4fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3dv");
+  glProgramUniformMatrix3dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3fv");
+  glProgramUniformMatrix3fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x2dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x2dv");
+  glProgramUniformMatrix3x2dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x2fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x2fv");
+  glProgramUniformMatrix3x2fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x4dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x4dv");
+  glProgramUniformMatrix3x4dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x4fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x4fv");
+  glProgramUniformMatrix3x4fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4dv");
+  glProgramUniformMatrix4dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4fv");
+  glProgramUniformMatrix4fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x2dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x2dv");
+  glProgramUniformMatrix4x2dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x2fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x2fv");
+  glProgramUniformMatrix4x2fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x3dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x3dv");
+  glProgramUniformMatrix4x3dv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x3fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x3fv");
+  glProgramUniformMatrix4x3fv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUseProgramStages (GLuint a0, GLbitfield a1, GLuint a2)
+{
+  glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)glewGetProcAddress((const GLubyte*)"glUseProgramStages");
+  glUseProgramStages(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glValidateProgramPipeline (GLuint a0)
+{
+  glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glewGetProcAddress((const GLubyte*)"glValidateProgramPipeline");
+  glValidateProgramPipeline(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetActiveAtomicCounterBufferiv (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveAtomicCounterBufferiv");
+  glGetActiveAtomicCounterBufferiv(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindImageTexture (GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLenum a6)
+{
+  glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)glewGetProcAddress((const GLubyte*)"glBindImageTexture");
+  glBindImageTexture(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMemoryBarrier (GLbitfield a0)
+{
+  glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)glewGetProcAddress((const GLubyte*)"glMemoryBarrier");
+  glMemoryBarrier(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAttachObjectARB (GLhandleARB a0, GLhandleARB a1)
+{
+  glAttachObjectARB = (PFNGLATTACHOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glAttachObjectARB");
+  glAttachObjectARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCompileShaderARB (GLhandleARB a0)
+{
+  glCompileShaderARB = (PFNGLCOMPILESHADERARBPROC)glewGetProcAddress((const GLubyte*)"glCompileShaderARB");
+  glCompileShaderARB(a0);
+}
+
+static GLhandleARB GLAPIENTRY _glewLazy_glCreateProgramObjectARB (void)
+{
+  glCreateProgramObjectARB = (PFNGLCREATEPROGRAMOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glCreateProgramObjectARB");
+  return glCreateProgramObjectARB();
+}
+
+static GLhandleARB GLAPIENTRY _glewLazy_glCreateShaderObjectARB (GLenum a0)
+{
+  glCreateShaderObjectARB = (PFNGLCREATESHADEROBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glCreateShaderObjectARB");
+  return glCreateShaderObjectARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteObjectARB (GLhandleARB a0)
+{
+  glDeleteObjectARB = (PFNGLDELETEOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteObjectARB");
+  glDeleteObjectARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDetachObjectARB (GLhandleARB a0, GLhandleARB a1)
+{
+  glDetachObjectARB = (PFNGLDETACHOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glDetachObjectARB");
+  glDetachObjectARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformARB (GLhandleARB a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint * a4, GLenum * a5, GLcharARB * a6)
+{
+  glGetActiveUniformARB = (PFNGLGETACTIVEUNIFORMARBPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformARB");
+  glGetActiveUniformARB(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetAttachedObjectsARB (GLhandleARB a0, GLsizei a1, GLsizei* a2, GLhandleARB * a3)
+{
+  glGetAttachedObjectsARB = (PFNGLGETATTACHEDOBJECTSARBPROC)glewGetProcAddress((const GLubyte*)"glGetAttachedObjectsARB");
+  glGetAttachedObjectsARB(a0, a1, a2, a3);
+}
+
+static GLhandleARB GLAPIENTRY _glewLazy_glGetHandleARB (GLenum a0)
+{
+  glGetHandleARB = (PFNGLGETHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetHandleARB");
+  return glGetHandleARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInfoLogARB (GLhandleARB a0, GLsizei a1, GLsizei* a2, GLcharARB * a3)
+{
+  glGetInfoLogARB = (PFNGLGETINFOLOGARBPROC)glewGetProcAddress((const GLubyte*)"glGetInfoLogARB");
+  glGetInfoLogARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectParameterfvARB (GLhandleARB a0, GLenum a1, GLfloat* a2)
+{
+  glGetObjectParameterfvARB = (PFNGLGETOBJECTPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetObjectParameterfvARB");
+  glGetObjectParameterfvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectParameterivARB (GLhandleARB a0, GLenum a1, GLint* a2)
+{
+  glGetObjectParameterivARB = (PFNGLGETOBJECTPARAMETERIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetObjectParameterivARB");
+  glGetObjectParameterivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderSourceARB (GLhandleARB a0, GLsizei a1, GLsizei* a2, GLcharARB * a3)
+{
+  glGetShaderSourceARB = (PFNGLGETSHADERSOURCEARBPROC)glewGetProcAddress((const GLubyte*)"glGetShaderSourceARB");
+  glGetShaderSourceARB(a0, a1, a2, a3);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetUniformLocationARB (GLhandleARB a0, const GLcharARB* a1)
+{
+  glGetUniformLocationARB = (PFNGLGETUNIFORMLOCATIONARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformLocationARB");
+  return glGetUniformLocationARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformfvARB (GLhandleARB a0, GLint a1, GLfloat* a2)
+{
+  glGetUniformfvARB = (PFNGLGETUNIFORMFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformfvARB");
+  glGetUniformfvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformivARB (GLhandleARB a0, GLint a1, GLint* a2)
+{
+  glGetUniformivARB = (PFNGLGETUNIFORMIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformivARB");
+  glGetUniformivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glLinkProgramARB (GLhandleARB a0)
+{
+  glLinkProgramARB = (PFNGLLINKPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glLinkProgramARB");
+  glLinkProgramARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderSourceARB (GLhandleARB a0, GLsizei a1, const GLcharARB ** a2, const GLint * a3)
+{
+  glShaderSourceARB = (PFNGLSHADERSOURCEARBPROC)glewGetProcAddress((const GLubyte*)"glShaderSourceARB");
+  glShaderSourceARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1fARB (GLint a0, GLfloat a1)
+{
+  glUniform1fARB = (PFNGLUNIFORM1FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1fARB");
+  glUniform1fARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform1fvARB = (PFNGLUNIFORM1FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1fvARB");
+  glUniform1fvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1iARB (GLint a0, GLint a1)
+{
+  glUniform1iARB = (PFNGLUNIFORM1IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1iARB");
+  glUniform1iARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform1ivARB = (PFNGLUNIFORM1IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1ivARB");
+  glUniform1ivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2fARB (GLint a0, GLfloat a1, GLfloat a2)
+{
+  glUniform2fARB = (PFNGLUNIFORM2FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2fARB");
+  glUniform2fARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform2fvARB = (PFNGLUNIFORM2FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2fvARB");
+  glUniform2fvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2iARB (GLint a0, GLint a1, GLint a2)
+{
+  glUniform2iARB = (PFNGLUNIFORM2IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2iARB");
+  glUniform2iARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform2ivARB = (PFNGLUNIFORM2IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2ivARB");
+  glUniform2ivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3fARB (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glUniform3fARB = (PFNGLUNIFORM3FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3fARB");
+  glUniform3fARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform3fvARB = (PFNGLUNIFORM3FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3fvARB");
+  glUniform3fvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3iARB (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  glUniform3iARB = (PFNGLUNIFORM3IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3iARB");
+  glUniform3iARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform3ivARB = (PFNGLUNIFORM3IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3ivARB");
+  glUniform3ivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4fARB (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glUniform4fARB = (PFNGLUNIFORM4FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4fARB");
+  glUniform4fARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  glUniform4fvARB = (PFNGLUNIFORM4FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4fvARB");
+  glUniform4fvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4iARB (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glUniform4iARB = (PFNGLUNIFORM4IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4iARB");
+  glUniform4iARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  glUniform4ivARB = (PFNGLUNIFORM4IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4ivARB");
+  glUniform4ivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2fvARB (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix2fvARB = (PFNGLUNIFORMMATRIX2FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2fvARB");
+  glUniformMatrix2fvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3fvARB (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix3fvARB = (PFNGLUNIFORMMATRIX3FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3fvARB");
+  glUniformMatrix3fvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4fvARB (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix4fvARB = (PFNGLUNIFORMMATRIX4FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4fvARB");
+  glUniformMatrix4fvARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUseProgramObjectARB (GLhandleARB a0)
+{
+  glUseProgramObjectARB = (PFNGLUSEPROGRAMOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glUseProgramObjectARB");
+  glUseProgramObjectARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glValidateProgramARB (GLhandleARB a0)
+{
+  glValidateProgramARB = (PFNGLVALIDATEPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glValidateProgramARB");
+  glValidateProgramARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glShaderStorageBlockBinding (GLuint a0, GLuint a1, GLuint a2)
+{
+  glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glewGetProcAddress((const GLubyte*)"glShaderStorageBlockBinding");
+  glShaderStorageBlockBinding(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetActiveSubroutineName (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei* a4, GLchar * a5)
+{
+  glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveSubroutineName");
+  glGetActiveSubroutineName(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveSubroutineUniformName (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei* a4, GLchar * a5)
+{
+  glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveSubroutineUniformName");
+  glGetActiveSubroutineUniformName(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveSubroutineUniformiv (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLint* a4)
+{
+  glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveSubroutineUniformiv");
+  glGetActiveSubroutineUniformiv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramStageiv (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramStageiv");
+  glGetProgramStageiv(a0, a1, a2, a3);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetSubroutineIndex (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetSubroutineIndex");
+  return glGetSubroutineIndex(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetSubroutineUniformLocation (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetSubroutineUniformLocation");
+  return glGetSubroutineUniformLocation(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformSubroutineuiv (GLenum a0, GLint a1, GLuint* a2)
+{
+  glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformSubroutineuiv");
+  glGetUniformSubroutineuiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformSubroutinesuiv (GLenum a0, GLsizei a1, const GLuint* a2)
+{
+  glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)glewGetProcAddress((const GLubyte*)"glUniformSubroutinesuiv");
+  glUniformSubroutinesuiv(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCompileShaderIncludeARB (GLuint a0, GLsizei a1, const GLchar* const * a2, const GLint * a3)
+{
+  glCompileShaderIncludeARB = (PFNGLCOMPILESHADERINCLUDEARBPROC)glewGetProcAddress((const GLubyte*)"glCompileShaderIncludeARB");
+  glCompileShaderIncludeARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteNamedStringARB (GLint a0, const GLchar* a1)
+{
+  glDeleteNamedStringARB = (PFNGLDELETENAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteNamedStringARB");
+  glDeleteNamedStringARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedStringARB (GLint a0, const GLchar* a1, GLsizei a2, GLint * a3, GLchar * a4)
+{
+  glGetNamedStringARB = (PFNGLGETNAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glGetNamedStringARB");
+  glGetNamedStringARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedStringivARB (GLint a0, const GLchar* a1, GLenum a2, GLint * a3)
+{
+  glGetNamedStringivARB = (PFNGLGETNAMEDSTRINGIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetNamedStringivARB");
+  glGetNamedStringivARB(a0, a1, a2, a3);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsNamedStringARB (GLint a0, const GLchar* a1)
+{
+  glIsNamedStringARB = (PFNGLISNAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glIsNamedStringARB");
+  return glIsNamedStringARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedStringARB (GLenum a0, GLint a1, const GLchar* a2, GLint a3, const GLchar * a4)
+{
+  glNamedStringARB = (PFNGLNAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glNamedStringARB");
+  glNamedStringARB(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferPageCommitmentARB (GLenum a0, GLintptr a1, GLsizeiptr a2, GLboolean a3)
+{
+  glBufferPageCommitmentARB = (PFNGLBUFFERPAGECOMMITMENTARBPROC)glewGetProcAddress((const GLubyte*)"glBufferPageCommitmentARB");
+  glBufferPageCommitmentARB(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexPageCommitmentARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  glTexPageCommitmentARB = (PFNGLTEXPAGECOMMITMENTARBPROC)glewGetProcAddress((const GLubyte*)"glTexPageCommitmentARB");
+  glTexPageCommitmentARB(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+
+
+static GLenum GLAPIENTRY _glewLazy_glClientWaitSync (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glewGetProcAddress((const GLubyte*)"glClientWaitSync");
+  return glClientWaitSync(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteSync (GLsync a0)
+{
+  glDeleteSync = (PFNGLDELETESYNCPROC)glewGetProcAddress((const GLubyte*)"glDeleteSync");
+  glDeleteSync(a0);
+}
+
+static GLsync GLAPIENTRY _glewLazy_glFenceSync (GLenum a0, GLbitfield a1)
+{
+  glFenceSync = (PFNGLFENCESYNCPROC)glewGetProcAddress((const GLubyte*)"glFenceSync");
+  return glFenceSync(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInteger64v (GLenum a0, GLint64* a1)
+{
+  glGetInteger64v = (PFNGLGETINTEGER64VPROC)glewGetProcAddress((const GLubyte*)"glGetInteger64v");
+  glGetInteger64v(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSynciv (GLsync a0, GLenum a1, GLsizei a2, GLsizei* a3, GLint * a4)
+{
+  glGetSynciv = (PFNGLGETSYNCIVPROC)glewGetProcAddress((const GLubyte*)"glGetSynciv");
+  glGetSynciv(a0, a1, a2, a3, a4);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSync (GLsync a0)
+{
+  glIsSync = (PFNGLISSYNCPROC)glewGetProcAddress((const GLubyte*)"glIsSync");
+  return glIsSync(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWaitSync (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  glWaitSync = (PFNGLWAITSYNCPROC)glewGetProcAddress((const GLubyte*)"glWaitSync");
+  glWaitSync(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPatchParameterfv (GLenum a0, const GLfloat* a1)
+{
+  glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glPatchParameterfv");
+  glPatchParameterfv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPatchParameteri (GLenum a0, GLint a1)
+{
+  glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glPatchParameteri");
+  glPatchParameteri(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureBarrier (void)
+{
+  glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)glewGetProcAddress((const GLubyte*)"glTextureBarrier");
+  glTextureBarrier();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferARB (GLenum a0, GLenum a1, GLuint a2)
+{
+  glTexBufferARB = (PFNGLTEXBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glTexBufferARB");
+  glTexBufferARB(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferRange (GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glTexBufferRange");
+  glTexBufferRange(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBufferRangeEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLintptr a4, GLsizeiptr a5)
+{
+  glTextureBufferRangeEXT = (PFNGLTEXTUREBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureBufferRangeEXT");
+  glTextureBufferRangeEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage1DARB (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void * a6)
+{
+  glCompressedTexImage1DARB = (PFNGLCOMPRESSEDTEXIMAGE1DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage1DARB");
+  glCompressedTexImage1DARB(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage2DARB (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  glCompressedTexImage2DARB = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage2DARB");
+  glCompressedTexImage2DARB(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage3DARB (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  glCompressedTexImage3DARB = (PFNGLCOMPRESSEDTEXIMAGE3DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage3DARB");
+  glCompressedTexImage3DARB(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage1DARB (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6)
+{
+  glCompressedTexSubImage1DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage1DARB");
+  glCompressedTexSubImage1DARB(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage2DARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8)
+{
+  glCompressedTexSubImage2DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage2DARB");
+  glCompressedTexSubImage2DARB(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage3DARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  glCompressedTexSubImage3DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage3DARB");
+  glCompressedTexSubImage3DARB(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTexImageARB (GLenum a0, GLint a1, void * a2)
+{
+  glGetCompressedTexImageARB = (PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTexImageARB");
+  glGetCompressedTexImageARB(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetMultisamplefv (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glewGetProcAddress((const GLubyte*)"glGetMultisamplefv");
+  glGetMultisamplefv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleMaski (GLuint a0, GLbitfield a1)
+{
+  glSampleMaski = (PFNGLSAMPLEMASKIPROC)glewGetProcAddress((const GLubyte*)"glSampleMaski");
+  glSampleMaski(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage2DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+{
+  glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexImage2DMultisample");
+  glTexImage2DMultisample(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DMultisample");
+  glTexImage3DMultisample(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexStorage1D (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3)
+{
+  glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)glewGetProcAddress((const GLubyte*)"glTexStorage1D");
+  glTexStorage1D(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage2D (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)glewGetProcAddress((const GLubyte*)"glTexStorage2D");
+  glTexStorage2D(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage3D (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+{
+  glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTexStorage3D");
+  glTexStorage3D(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexStorage2DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+{
+  glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexStorage2DMultisample");
+  glTexStorage2DMultisample(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage3DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexStorage3DMultisample");
+  glTexStorage3DMultisample(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2DMultisampleEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTextureStorage2DMultisampleEXT = (PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2DMultisampleEXT");
+  glTextureStorage2DMultisampleEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3DMultisampleEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  glTextureStorage3DMultisampleEXT = (PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3DMultisampleEXT");
+  glTextureStorage3DMultisampleEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureView (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+{
+  glTextureView = (PFNGLTEXTUREVIEWPROC)glewGetProcAddress((const GLubyte*)"glTextureView");
+  glTextureView(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjecti64v (GLuint a0, GLenum a1, GLint64* a2)
+{
+  glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjecti64v");
+  glGetQueryObjecti64v(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectui64v (GLuint a0, GLenum a1, GLuint64* a2)
+{
+  glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectui64v");
+  glGetQueryObjectui64v(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glQueryCounter (GLuint a0, GLenum a1)
+{
+  glQueryCounter = (PFNGLQUERYCOUNTERPROC)glewGetProcAddress((const GLubyte*)"glQueryCounter");
+  glQueryCounter(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindTransformFeedback (GLenum a0, GLuint a1)
+{
+  glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glBindTransformFeedback");
+  glBindTransformFeedback(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteTransformFeedbacks (GLsizei a0, const GLuint* a1)
+{
+  glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glewGetProcAddress((const GLubyte*)"glDeleteTransformFeedbacks");
+  glDeleteTransformFeedbacks(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedback (GLenum a0, GLuint a1)
+{
+  glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedback");
+  glDrawTransformFeedback(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenTransformFeedbacks (GLsizei a0, GLuint* a1)
+{
+  glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)glewGetProcAddress((const GLubyte*)"glGenTransformFeedbacks");
+  glGenTransformFeedbacks(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTransformFeedback (GLuint a0)
+{
+  glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glIsTransformFeedback");
+  return glIsTransformFeedback(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPauseTransformFeedback (void)
+{
+  glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glPauseTransformFeedback");
+  glPauseTransformFeedback();
+}
+
+static void GLAPIENTRY _glewLazy_glResumeTransformFeedback (void)
+{
+  glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glResumeTransformFeedback");
+  glResumeTransformFeedback();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryIndexed (GLenum a0, GLuint a1, GLuint a2)
+{
+  glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryIndexed");
+  glBeginQueryIndexed(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackStream (GLenum a0, GLuint a1, GLuint a2)
+{
+  glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackStream");
+  glDrawTransformFeedbackStream(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryIndexed (GLenum a0, GLuint a1)
+{
+  glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glEndQueryIndexed");
+  glEndQueryIndexed(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryIndexediv (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryIndexediv");
+  glGetQueryIndexediv(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackInstanced (GLenum a0, GLuint a1, GLsizei a2)
+{
+  glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackInstanced");
+  glDrawTransformFeedbackInstanced(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackStreamInstanced (GLenum a0, GLuint a1, GLuint a2, GLsizei a3)
+{
+  glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackStreamInstanced");
+  glDrawTransformFeedbackStreamInstanced(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixdARB (GLdouble a0[16])
+{
+  glLoadTransposeMatrixdARB = (PFNGLLOADTRANSPOSEMATRIXDARBPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixdARB");
+  glLoadTransposeMatrixdARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixfARB (GLfloat a0[16])
+{
+  glLoadTransposeMatrixfARB = (PFNGLLOADTRANSPOSEMATRIXFARBPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixfARB");
+  glLoadTransposeMatrixfARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixdARB (GLdouble a0[16])
+{
+  glMultTransposeMatrixdARB = (PFNGLMULTTRANSPOSEMATRIXDARBPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixdARB");
+  glMultTransposeMatrixdARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixfARB (GLfloat a0[16])
+{
+  glMultTransposeMatrixfARB = (PFNGLMULTTRANSPOSEMATRIXFARBPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixfARB");
+  glMultTransposeMatrixfARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindBufferBase (GLenum a0, GLuint a1, GLuint a2)
+{
+  glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glewGetProcAddress((const GLubyte*)"glBindBufferBase");
+  glBindBufferBase(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferRange (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glBindBufferRange");
+  glBindBufferRange(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformBlockName (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar* a4)
+{
+  glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformBlockName");
+  glGetActiveUniformBlockName(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformBlockiv (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformBlockiv");
+  glGetActiveUniformBlockiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformName (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar* a4)
+{
+  glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformName");
+  glGetActiveUniformName(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformsiv (GLuint a0, GLsizei a1, const GLuint* a2, GLenum a3, GLint* a4)
+{
+  glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformsiv");
+  glGetActiveUniformsiv(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegeri_v (GLenum a0, GLuint a1, GLint* a2)
+{
+  glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glewGetProcAddress((const GLubyte*)"glGetIntegeri_v");
+  glGetIntegeri_v(a0, a1, a2);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetUniformBlockIndex (GLuint a0, const GLchar* a1)
+{
+  glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetUniformBlockIndex");
+  return glGetUniformBlockIndex(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformIndices (GLuint a0, GLsizei a1, const GLchar* const * a2, GLuint* a3)
+{
+  glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glewGetProcAddress((const GLubyte*)"glGetUniformIndices");
+  glGetUniformIndices(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformBlockBinding (GLuint a0, GLuint a1, GLuint a2)
+{
+  glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glewGetProcAddress((const GLubyte*)"glUniformBlockBinding");
+  glUniformBlockBinding(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexArray (GLuint a0)
+{
+  glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glewGetProcAddress((const GLubyte*)"glBindVertexArray");
+  glBindVertexArray(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexArrays (GLsizei a0, const GLuint* a1)
+{
+  glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexArrays");
+  glDeleteVertexArrays(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenVertexArrays (GLsizei a0, GLuint* a1)
+{
+  glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glewGetProcAddress((const GLubyte*)"glGenVertexArrays");
+  glGenVertexArrays(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexArray (GLuint a0)
+{
+  glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glewGetProcAddress((const GLubyte*)"glIsVertexArray");
+  return glIsVertexArray(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLdv (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLdv");
+  glGetVertexAttribLdv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1d (GLuint a0, GLdouble a1)
+{
+  glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1d");
+  glVertexAttribL1d(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1dv");
+  glVertexAttribL1dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2d (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2d");
+  glVertexAttribL2d(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2dv");
+  glVertexAttribL2dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3d");
+  glVertexAttribL3d(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3dv");
+  glVertexAttribL3dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4d");
+  glVertexAttribL4d(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4dv (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4dv");
+  glVertexAttribL4dv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLPointer (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void* a4)
+{
+  glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLPointer");
+  glVertexAttribLPointer(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexBuffer (GLuint a0, GLuint a1, GLintptr a2, GLsizei a3)
+{
+  glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindVertexBuffer");
+  glBindVertexBuffer(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayBindVertexBufferEXT (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizei a4)
+{
+  glVertexArrayBindVertexBufferEXT = (PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayBindVertexBufferEXT");
+  glVertexArrayBindVertexBufferEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribBindingEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexArrayVertexAttribBindingEXT = (PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribBindingEXT");
+  glVertexArrayVertexAttribBindingEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribFormatEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLboolean a4, GLuint a5)
+{
+  glVertexArrayVertexAttribFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribFormatEXT");
+  glVertexArrayVertexAttribFormatEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribIFormatEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  glVertexArrayVertexAttribIFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribIFormatEXT");
+  glVertexArrayVertexAttribIFormatEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribLFormatEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  glVertexArrayVertexAttribLFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribLFormatEXT");
+  glVertexArrayVertexAttribLFormatEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexBindingDivisorEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexArrayVertexBindingDivisorEXT = (PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexBindingDivisorEXT");
+  glVertexArrayVertexBindingDivisorEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribBinding (GLuint a0, GLuint a1)
+{
+  glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribBinding");
+  glVertexAttribBinding(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribFormat (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLuint a4)
+{
+  glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribFormat");
+  glVertexAttribFormat(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIFormat (GLuint a0, GLint a1, GLenum a2, GLuint a3)
+{
+  glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIFormat");
+  glVertexAttribIFormat(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLFormat (GLuint a0, GLint a1, GLenum a2, GLuint a3)
+{
+  glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLFormat");
+  glVertexAttribLFormat(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexBindingDivisor (GLuint a0, GLuint a1)
+{
+  glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)glewGetProcAddress((const GLubyte*)"glVertexBindingDivisor");
+  glVertexBindingDivisor(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVertexBlendARB (GLint a0)
+{
+  glVertexBlendARB = (PFNGLVERTEXBLENDARBPROC)glewGetProcAddress((const GLubyte*)"glVertexBlendARB");
+  glVertexBlendARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightPointerARB (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  glWeightPointerARB = (PFNGLWEIGHTPOINTERARBPROC)glewGetProcAddress((const GLubyte*)"glWeightPointerARB");
+  glWeightPointerARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightbvARB (GLint a0, GLbyte * a1)
+{
+  glWeightbvARB = (PFNGLWEIGHTBVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightbvARB");
+  glWeightbvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightdvARB (GLint a0, GLdouble * a1)
+{
+  glWeightdvARB = (PFNGLWEIGHTDVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightdvARB");
+  glWeightdvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightfvARB (GLint a0, GLfloat * a1)
+{
+  glWeightfvARB = (PFNGLWEIGHTFVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightfvARB");
+  glWeightfvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightivARB (GLint a0, GLint * a1)
+{
+  glWeightivARB = (PFNGLWEIGHTIVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightivARB");
+  glWeightivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightsvARB (GLint a0, GLshort * a1)
+{
+  glWeightsvARB = (PFNGLWEIGHTSVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightsvARB");
+  glWeightsvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightubvARB (GLint a0, GLubyte * a1)
+{
+  glWeightubvARB = (PFNGLWEIGHTUBVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightubvARB");
+  glWeightubvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightuivARB (GLint a0, GLuint * a1)
+{
+  glWeightuivARB = (PFNGLWEIGHTUIVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightuivARB");
+  glWeightuivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightusvARB (GLint a0, GLushort * a1)
+{
+  glWeightusvARB = (PFNGLWEIGHTUSVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightusvARB");
+  glWeightusvARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindBufferARB (GLenum a0, GLuint a1)
+{
+  glBindBufferARB = (PFNGLBINDBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glBindBufferARB");
+  glBindBufferARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferDataARB (GLenum a0, GLsizeiptrARB a1, const void * a2, GLenum a3)
+{
+  glBufferDataARB = (PFNGLBUFFERDATAARBPROC)glewGetProcAddress((const GLubyte*)"glBufferDataARB");
+  glBufferDataARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferSubDataARB (GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, const void * a3)
+{
+  glBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC)glewGetProcAddress((const GLubyte*)"glBufferSubDataARB");
+  glBufferSubDataARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteBuffersARB (GLsizei a0, const GLuint* a1)
+{
+  glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteBuffersARB");
+  glDeleteBuffersARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenBuffersARB (GLsizei a0, GLuint* a1)
+{
+  glGenBuffersARB = (PFNGLGENBUFFERSARBPROC)glewGetProcAddress((const GLubyte*)"glGenBuffersARB");
+  glGenBuffersARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameterivARB (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetBufferParameterivARB = (PFNGLGETBUFFERPARAMETERIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameterivARB");
+  glGetBufferParameterivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferPointervARB (GLenum a0, GLenum a1, void** a2)
+{
+  glGetBufferPointervARB = (PFNGLGETBUFFERPOINTERVARBPROC)glewGetProcAddress((const GLubyte*)"glGetBufferPointervARB");
+  glGetBufferPointervARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferSubDataARB (GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, void * a3)
+{
+  glGetBufferSubDataARB = (PFNGLGETBUFFERSUBDATAARBPROC)glewGetProcAddress((const GLubyte*)"glGetBufferSubDataARB");
+  glGetBufferSubDataARB(a0, a1, a2, a3);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsBufferARB (GLuint a0)
+{
+  glIsBufferARB = (PFNGLISBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glIsBufferARB");
+  return glIsBufferARB(a0);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapBufferARB (GLenum a0, GLenum a1)
+{
+  glMapBufferARB = (PFNGLMAPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glMapBufferARB");
+  return glMapBufferARB(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapBufferARB (GLenum a0)
+{
+  glUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glUnmapBufferARB");
+  return glUnmapBufferARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindProgramARB (GLenum a0, GLuint a1)
+{
+  glBindProgramARB = (PFNGLBINDPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glBindProgramARB");
+  glBindProgramARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgramsARB (GLsizei a0, const GLuint* a1)
+{
+  glDeleteProgramsARB = (PFNGLDELETEPROGRAMSARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgramsARB");
+  glDeleteProgramsARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexAttribArrayARB (GLuint a0)
+{
+  glDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexAttribArrayARB");
+  glDisableVertexAttribArrayARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexAttribArrayARB (GLuint a0)
+{
+  glEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexAttribArrayARB");
+  glEnableVertexAttribArrayARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenProgramsARB (GLsizei a0, GLuint* a1)
+{
+  glGenProgramsARB = (PFNGLGENPROGRAMSARBPROC)glewGetProcAddress((const GLubyte*)"glGenProgramsARB");
+  glGenProgramsARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramEnvParameterdvARB (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  glGetProgramEnvParameterdvARB = (PFNGLGETPROGRAMENVPARAMETERDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramEnvParameterdvARB");
+  glGetProgramEnvParameterdvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramEnvParameterfvARB (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetProgramEnvParameterfvARB = (PFNGLGETPROGRAMENVPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramEnvParameterfvARB");
+  glGetProgramEnvParameterfvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramLocalParameterdvARB (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  glGetProgramLocalParameterdvARB = (PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramLocalParameterdvARB");
+  glGetProgramLocalParameterdvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramLocalParameterfvARB (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetProgramLocalParameterfvARB = (PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramLocalParameterfvARB");
+  glGetProgramLocalParameterfvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramStringARB (GLenum a0, GLenum a1, void * a2)
+{
+  glGetProgramStringARB = (PFNGLGETPROGRAMSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramStringARB");
+  glGetProgramStringARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramivARB (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetProgramivARB = (PFNGLGETPROGRAMIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramivARB");
+  glGetProgramivARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribPointervARB (GLuint a0, GLenum a1, void** a2)
+{
+  glGetVertexAttribPointervARB = (PFNGLGETVERTEXATTRIBPOINTERVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribPointervARB");
+  glGetVertexAttribPointervARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribdvARB (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  glGetVertexAttribdvARB = (PFNGLGETVERTEXATTRIBDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribdvARB");
+  glGetVertexAttribdvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribfvARB (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetVertexAttribfvARB = (PFNGLGETVERTEXATTRIBFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribfvARB");
+  glGetVertexAttribfvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribivARB (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexAttribivARB = (PFNGLGETVERTEXATTRIBIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribivARB");
+  glGetVertexAttribivARB(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgramARB (GLuint a0)
+{
+  glIsProgramARB = (PFNGLISPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glIsProgramARB");
+  return glIsProgramARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4dARB (GLenum a0, GLuint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  glProgramEnvParameter4dARB = (PFNGLPROGRAMENVPARAMETER4DARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4dARB");
+  glProgramEnvParameter4dARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4dvARB (GLenum a0, GLuint a1, const GLdouble* a2)
+{
+  glProgramEnvParameter4dvARB = (PFNGLPROGRAMENVPARAMETER4DVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4dvARB");
+  glProgramEnvParameter4dvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4fARB (GLenum a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glProgramEnvParameter4fARB = (PFNGLPROGRAMENVPARAMETER4FARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4fARB");
+  glProgramEnvParameter4fARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4fvARB (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  glProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4fvARB");
+  glProgramEnvParameter4fvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4dARB (GLenum a0, GLuint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  glProgramLocalParameter4dARB = (PFNGLPROGRAMLOCALPARAMETER4DARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4dARB");
+  glProgramLocalParameter4dARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4dvARB (GLenum a0, GLuint a1, const GLdouble* a2)
+{
+  glProgramLocalParameter4dvARB = (PFNGLPROGRAMLOCALPARAMETER4DVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4dvARB");
+  glProgramLocalParameter4dvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4fARB (GLenum a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glProgramLocalParameter4fARB = (PFNGLPROGRAMLOCALPARAMETER4FARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4fARB");
+  glProgramLocalParameter4fARB(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4fvARB (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  glProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4fvARB");
+  glProgramLocalParameter4fvARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramStringARB (GLenum a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  glProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glProgramStringARB");
+  glProgramStringARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dARB (GLuint a0, GLdouble a1)
+{
+  glVertexAttrib1dARB = (PFNGLVERTEXATTRIB1DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dARB");
+  glVertexAttrib1dARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dvARB (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib1dvARB = (PFNGLVERTEXATTRIB1DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dvARB");
+  glVertexAttrib1dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fARB (GLuint a0, GLfloat a1)
+{
+  glVertexAttrib1fARB = (PFNGLVERTEXATTRIB1FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fARB");
+  glVertexAttrib1fARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fvARB (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib1fvARB = (PFNGLVERTEXATTRIB1FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fvARB");
+  glVertexAttrib1fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1sARB (GLuint a0, GLshort a1)
+{
+  glVertexAttrib1sARB = (PFNGLVERTEXATTRIB1SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1sARB");
+  glVertexAttrib1sARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1svARB (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib1svARB = (PFNGLVERTEXATTRIB1SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1svARB");
+  glVertexAttrib1svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dARB (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  glVertexAttrib2dARB = (PFNGLVERTEXATTRIB2DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dARB");
+  glVertexAttrib2dARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dvARB (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib2dvARB = (PFNGLVERTEXATTRIB2DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dvARB");
+  glVertexAttrib2dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fARB (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  glVertexAttrib2fARB = (PFNGLVERTEXATTRIB2FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fARB");
+  glVertexAttrib2fARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fvARB (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib2fvARB = (PFNGLVERTEXATTRIB2FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fvARB");
+  glVertexAttrib2fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2sARB (GLuint a0, GLshort a1, GLshort a2)
+{
+  glVertexAttrib2sARB = (PFNGLVERTEXATTRIB2SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2sARB");
+  glVertexAttrib2sARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2svARB (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib2svARB = (PFNGLVERTEXATTRIB2SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2svARB");
+  glVertexAttrib2svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dARB (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glVertexAttrib3dARB = (PFNGLVERTEXATTRIB3DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dARB");
+  glVertexAttrib3dARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dvARB (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib3dvARB = (PFNGLVERTEXATTRIB3DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dvARB");
+  glVertexAttrib3dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fARB (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glVertexAttrib3fARB = (PFNGLVERTEXATTRIB3FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fARB");
+  glVertexAttrib3fARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fvARB (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib3fvARB = (PFNGLVERTEXATTRIB3FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fvARB");
+  glVertexAttrib3fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3sARB (GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glVertexAttrib3sARB = (PFNGLVERTEXATTRIB3SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3sARB");
+  glVertexAttrib3sARB(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3svARB (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib3svARB = (PFNGLVERTEXATTRIB3SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3svARB");
+  glVertexAttrib3svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NbvARB (GLuint a0, const GLbyte* a1)
+{
+  glVertexAttrib4NbvARB = (PFNGLVERTEXATTRIB4NBVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NbvARB");
+  glVertexAttrib4NbvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NivARB (GLuint a0, const GLint* a1)
+{
+  glVertexAttrib4NivARB = (PFNGLVERTEXATTRIB4NIVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NivARB");
+  glVertexAttrib4NivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NsvARB (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib4NsvARB = (PFNGLVERTEXATTRIB4NSVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NsvARB");
+  glVertexAttrib4NsvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NubARB (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+{
+  glVertexAttrib4NubARB = (PFNGLVERTEXATTRIB4NUBARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NubARB");
+  glVertexAttrib4NubARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NubvARB (GLuint a0, const GLubyte* a1)
+{
+  glVertexAttrib4NubvARB = (PFNGLVERTEXATTRIB4NUBVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NubvARB");
+  glVertexAttrib4NubvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NuivARB (GLuint a0, const GLuint* a1)
+{
+  glVertexAttrib4NuivARB = (PFNGLVERTEXATTRIB4NUIVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NuivARB");
+  glVertexAttrib4NuivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NusvARB (GLuint a0, const GLushort* a1)
+{
+  glVertexAttrib4NusvARB = (PFNGLVERTEXATTRIB4NUSVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NusvARB");
+  glVertexAttrib4NusvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4bvARB (GLuint a0, const GLbyte* a1)
+{
+  glVertexAttrib4bvARB = (PFNGLVERTEXATTRIB4BVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4bvARB");
+  glVertexAttrib4bvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dARB (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glVertexAttrib4dARB = (PFNGLVERTEXATTRIB4DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dARB");
+  glVertexAttrib4dARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dvARB (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib4dvARB = (PFNGLVERTEXATTRIB4DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dvARB");
+  glVertexAttrib4dvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fARB (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glVertexAttrib4fARB = (PFNGLVERTEXATTRIB4FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fARB");
+  glVertexAttrib4fARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fvARB (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib4fvARB = (PFNGLVERTEXATTRIB4FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fvARB");
+  glVertexAttrib4fvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ivARB (GLuint a0, const GLint* a1)
+{
+  glVertexAttrib4ivARB = (PFNGLVERTEXATTRIB4IVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ivARB");
+  glVertexAttrib4ivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4sARB (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  glVertexAttrib4sARB = (PFNGLVERTEXATTRIB4SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4sARB");
+  glVertexAttrib4sARB(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4svARB (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib4svARB = (PFNGLVERTEXATTRIB4SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4svARB");
+  glVertexAttrib4svARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubvARB (GLuint a0, const GLubyte* a1)
+{
+  glVertexAttrib4ubvARB = (PFNGLVERTEXATTRIB4UBVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubvARB");
+  glVertexAttrib4ubvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4uivARB (GLuint a0, const GLuint* a1)
+{
+  glVertexAttrib4uivARB = (PFNGLVERTEXATTRIB4UIVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4uivARB");
+  glVertexAttrib4uivARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4usvARB (GLuint a0, const GLushort* a1)
+{
+  glVertexAttrib4usvARB = (PFNGLVERTEXATTRIB4USVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4usvARB");
+  glVertexAttrib4usvARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribPointerARB (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void * a5)
+{
+  glVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribPointerARB");
+  glVertexAttribPointerARB(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindAttribLocationARB (GLhandleARB a0, GLuint a1, const GLcharARB* a2)
+{
+  glBindAttribLocationARB = (PFNGLBINDATTRIBLOCATIONARBPROC)glewGetProcAddress((const GLubyte*)"glBindAttribLocationARB");
+  glBindAttribLocationARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveAttribARB (GLhandleARB a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint * a4, GLenum * a5, GLcharARB * a6)
+{
+  glGetActiveAttribARB = (PFNGLGETACTIVEATTRIBARBPROC)glewGetProcAddress((const GLubyte*)"glGetActiveAttribARB");
+  glGetActiveAttribARB(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetAttribLocationARB (GLhandleARB a0, const GLcharARB* a1)
+{
+  glGetAttribLocationARB = (PFNGLGETATTRIBLOCATIONARBPROC)glewGetProcAddress((const GLubyte*)"glGetAttribLocationARB");
+  return glGetAttribLocationARB(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorP3ui (GLenum a0, GLuint a1)
+{
+  glColorP3ui = (PFNGLCOLORP3UIPROC)glewGetProcAddress((const GLubyte*)"glColorP3ui");
+  glColorP3ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glColorP3uiv (GLenum a0, const GLuint* a1)
+{
+  glColorP3uiv = (PFNGLCOLORP3UIVPROC)glewGetProcAddress((const GLubyte*)"glColorP3uiv");
+  glColorP3uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glColorP4ui (GLenum a0, GLuint a1)
+{
+  glColorP4ui = (PFNGLCOLORP4UIPROC)glewGetProcAddress((const GLubyte*)"glColorP4ui");
+  glColorP4ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glColorP4uiv (GLenum a0, const GLuint* a1)
+{
+  glColorP4uiv = (PFNGLCOLORP4UIVPROC)glewGetProcAddress((const GLubyte*)"glColorP4uiv");
+  glColorP4uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP1ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP1ui");
+  glMultiTexCoordP1ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP1uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP1uiv");
+  glMultiTexCoordP1uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP2ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP2ui");
+  glMultiTexCoordP2ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP2uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP2uiv");
+  glMultiTexCoordP2uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP3ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP3ui");
+  glMultiTexCoordP3ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP3uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP3uiv");
+  glMultiTexCoordP3uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP4ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP4ui");
+  glMultiTexCoordP4ui(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP4uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP4uiv");
+  glMultiTexCoordP4uiv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalP3ui (GLenum a0, GLuint a1)
+{
+  glNormalP3ui = (PFNGLNORMALP3UIPROC)glewGetProcAddress((const GLubyte*)"glNormalP3ui");
+  glNormalP3ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalP3uiv (GLenum a0, const GLuint* a1)
+{
+  glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glewGetProcAddress((const GLubyte*)"glNormalP3uiv");
+  glNormalP3uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorP3ui (GLenum a0, GLuint a1)
+{
+  glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorP3ui");
+  glSecondaryColorP3ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorP3uiv (GLenum a0, const GLuint* a1)
+{
+  glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorP3uiv");
+  glSecondaryColorP3uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP1ui (GLenum a0, GLuint a1)
+{
+  glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP1ui");
+  glTexCoordP1ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP1uiv (GLenum a0, const GLuint* a1)
+{
+  glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP1uiv");
+  glTexCoordP1uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP2ui (GLenum a0, GLuint a1)
+{
+  glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP2ui");
+  glTexCoordP2ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP2uiv (GLenum a0, const GLuint* a1)
+{
+  glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP2uiv");
+  glTexCoordP2uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP3ui (GLenum a0, GLuint a1)
+{
+  glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP3ui");
+  glTexCoordP3ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP3uiv (GLenum a0, const GLuint* a1)
+{
+  glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP3uiv");
+  glTexCoordP3uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP4ui (GLenum a0, GLuint a1)
+{
+  glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP4ui");
+  glTexCoordP4ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP4uiv (GLenum a0, const GLuint* a1)
+{
+  glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP4uiv");
+  glTexCoordP4uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP1ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP1ui");
+  glVertexAttribP1ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP1uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP1uiv");
+  glVertexAttribP1uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP2ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP2ui");
+  glVertexAttribP2ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP2uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP2uiv");
+  glVertexAttribP2uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP3ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP3ui");
+  glVertexAttribP3ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP3uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP3uiv");
+  glVertexAttribP3uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP4ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP4ui");
+  glVertexAttribP4ui(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP4uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP4uiv");
+  glVertexAttribP4uiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP2ui (GLenum a0, GLuint a1)
+{
+  glVertexP2ui = (PFNGLVERTEXP2UIPROC)glewGetProcAddress((const GLubyte*)"glVertexP2ui");
+  glVertexP2ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP2uiv (GLenum a0, const GLuint* a1)
+{
+  glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexP2uiv");
+  glVertexP2uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP3ui (GLenum a0, GLuint a1)
+{
+  glVertexP3ui = (PFNGLVERTEXP3UIPROC)glewGetProcAddress((const GLubyte*)"glVertexP3ui");
+  glVertexP3ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP3uiv (GLenum a0, const GLuint* a1)
+{
+  glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexP3uiv");
+  glVertexP3uiv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP4ui (GLenum a0, GLuint a1)
+{
+  glVertexP4ui = (PFNGLVERTEXP4UIPROC)glewGetProcAddress((const GLubyte*)"glVertexP4ui");
+  glVertexP4ui(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP4uiv (GLenum a0, const GLuint* a1)
+{
+  glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexP4uiv");
+  glVertexP4uiv(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDepthRangeArrayv (GLuint a0, GLsizei a1, const GLclampd * a2)
+{
+  glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)glewGetProcAddress((const GLubyte*)"glDepthRangeArrayv");
+  glDepthRangeArrayv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangeIndexed (GLuint a0, GLclampd a1, GLclampd a2)
+{
+  glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glDepthRangeIndexed");
+  glDepthRangeIndexed(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDoublei_v (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)glewGetProcAddress((const GLubyte*)"glGetDoublei_v");
+  glGetDoublei_v(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloati_v (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetFloati_v = (PFNGLGETFLOATI_VPROC)glewGetProcAddress((const GLubyte*)"glGetFloati_v");
+  glGetFloati_v(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorArrayv (GLuint a0, GLsizei a1, const GLint * a2)
+{
+  glScissorArrayv = (PFNGLSCISSORARRAYVPROC)glewGetProcAddress((const GLubyte*)"glScissorArrayv");
+  glScissorArrayv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorIndexed (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+{
+  glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glScissorIndexed");
+  glScissorIndexed(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorIndexedv (GLuint a0, const GLint * a1)
+{
+  glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)glewGetProcAddress((const GLubyte*)"glScissorIndexedv");
+  glScissorIndexedv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportArrayv (GLuint a0, GLsizei a1, const GLfloat * a2)
+{
+  glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)glewGetProcAddress((const GLubyte*)"glViewportArrayv");
+  glViewportArrayv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportIndexedf (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)glewGetProcAddress((const GLubyte*)"glViewportIndexedf");
+  glViewportIndexedf(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportIndexedfv (GLuint a0, const GLfloat * a1)
+{
+  glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)glewGetProcAddress((const GLubyte*)"glViewportIndexedfv");
+  glViewportIndexedfv(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dARB (GLdouble a0, GLdouble a1)
+{
+  glWindowPos2dARB = (PFNGLWINDOWPOS2DARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dARB");
+  glWindowPos2dARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dvARB (const GLdouble* a0)
+{
+  glWindowPos2dvARB = (PFNGLWINDOWPOS2DVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dvARB");
+  glWindowPos2dvARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fARB (GLfloat a0, GLfloat a1)
+{
+  glWindowPos2fARB = (PFNGLWINDOWPOS2FARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fARB");
+  glWindowPos2fARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fvARB (const GLfloat* a0)
+{
+  glWindowPos2fvARB = (PFNGLWINDOWPOS2FVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fvARB");
+  glWindowPos2fvARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2iARB (GLint a0, GLint a1)
+{
+  glWindowPos2iARB = (PFNGLWINDOWPOS2IARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2iARB");
+  glWindowPos2iARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2ivARB (const GLint* a0)
+{
+  glWindowPos2ivARB = (PFNGLWINDOWPOS2IVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2ivARB");
+  glWindowPos2ivARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2sARB (GLshort a0, GLshort a1)
+{
+  glWindowPos2sARB = (PFNGLWINDOWPOS2SARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2sARB");
+  glWindowPos2sARB(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2svARB (const GLshort* a0)
+{
+  glWindowPos2svARB = (PFNGLWINDOWPOS2SVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2svARB");
+  glWindowPos2svARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dARB (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  glWindowPos3dARB = (PFNGLWINDOWPOS3DARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dARB");
+  glWindowPos3dARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dvARB (const GLdouble* a0)
+{
+  glWindowPos3dvARB = (PFNGLWINDOWPOS3DVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dvARB");
+  glWindowPos3dvARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fARB (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glWindowPos3fARB = (PFNGLWINDOWPOS3FARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fARB");
+  glWindowPos3fARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fvARB (const GLfloat* a0)
+{
+  glWindowPos3fvARB = (PFNGLWINDOWPOS3FVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fvARB");
+  glWindowPos3fvARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3iARB (GLint a0, GLint a1, GLint a2)
+{
+  glWindowPos3iARB = (PFNGLWINDOWPOS3IARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3iARB");
+  glWindowPos3iARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3ivARB (const GLint* a0)
+{
+  glWindowPos3ivARB = (PFNGLWINDOWPOS3IVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3ivARB");
+  glWindowPos3ivARB(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3sARB (GLshort a0, GLshort a1, GLshort a2)
+{
+  glWindowPos3sARB = (PFNGLWINDOWPOS3SARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3sARB");
+  glWindowPos3sARB(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3svARB (const GLshort* a0)
+{
+  glWindowPos3svARB = (PFNGLWINDOWPOS3SVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3svARB");
+  glWindowPos3svARB(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersATI (GLsizei a0, const GLenum* a1)
+{
+  glDrawBuffersATI = (PFNGLDRAWBUFFERSATIPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersATI");
+  glDrawBuffersATI(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementArrayATI (GLenum a0, GLsizei a1)
+{
+  glDrawElementArrayATI = (PFNGLDRAWELEMENTARRAYATIPROC)glewGetProcAddress((const GLubyte*)"glDrawElementArrayATI");
+  glDrawElementArrayATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementArrayATI (GLenum a0, GLuint a1, GLuint a2, GLsizei a3)
+{
+  glDrawRangeElementArrayATI = (PFNGLDRAWRANGEELEMENTARRAYATIPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementArrayATI");
+  glDrawRangeElementArrayATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glElementPointerATI (GLenum a0, const void * a1)
+{
+  glElementPointerATI = (PFNGLELEMENTPOINTERATIPROC)glewGetProcAddress((const GLubyte*)"glElementPointerATI");
+  glElementPointerATI(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetTexBumpParameterfvATI (GLenum a0, GLfloat * a1)
+{
+  glGetTexBumpParameterfvATI = (PFNGLGETTEXBUMPPARAMETERFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetTexBumpParameterfvATI");
+  glGetTexBumpParameterfvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexBumpParameterivATI (GLenum a0, GLint * a1)
+{
+  glGetTexBumpParameterivATI = (PFNGLGETTEXBUMPPARAMETERIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetTexBumpParameterivATI");
+  glGetTexBumpParameterivATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBumpParameterfvATI (GLenum a0, GLfloat * a1)
+{
+  glTexBumpParameterfvATI = (PFNGLTEXBUMPPARAMETERFVATIPROC)glewGetProcAddress((const GLubyte*)"glTexBumpParameterfvATI");
+  glTexBumpParameterfvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBumpParameterivATI (GLenum a0, GLint * a1)
+{
+  glTexBumpParameterivATI = (PFNGLTEXBUMPPARAMETERIVATIPROC)glewGetProcAddress((const GLubyte*)"glTexBumpParameterivATI");
+  glTexBumpParameterivATI(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAlphaFragmentOp1ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  glAlphaFragmentOp1ATI = (PFNGLALPHAFRAGMENTOP1ATIPROC)glewGetProcAddress((const GLubyte*)"glAlphaFragmentOp1ATI");
+  glAlphaFragmentOp1ATI(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glAlphaFragmentOp2ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8)
+{
+  glAlphaFragmentOp2ATI = (PFNGLALPHAFRAGMENTOP2ATIPROC)glewGetProcAddress((const GLubyte*)"glAlphaFragmentOp2ATI");
+  glAlphaFragmentOp2ATI(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glAlphaFragmentOp3ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8, GLuint a9, GLuint a10, GLuint a11)
+{
+  glAlphaFragmentOp3ATI = (PFNGLALPHAFRAGMENTOP3ATIPROC)glewGetProcAddress((const GLubyte*)"glAlphaFragmentOp3ATI");
+  glAlphaFragmentOp3ATI(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static void GLAPIENTRY _glewLazy_glBeginFragmentShaderATI (void)
+{
+  glBeginFragmentShaderATI = (PFNGLBEGINFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glBeginFragmentShaderATI");
+  glBeginFragmentShaderATI();
+}
+
+static void GLAPIENTRY _glewLazy_glBindFragmentShaderATI (GLuint a0)
+{
+  glBindFragmentShaderATI = (PFNGLBINDFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glBindFragmentShaderATI");
+  glBindFragmentShaderATI(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFragmentOp1ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6)
+{
+  glColorFragmentOp1ATI = (PFNGLCOLORFRAGMENTOP1ATIPROC)glewGetProcAddress((const GLubyte*)"glColorFragmentOp1ATI");
+  glColorFragmentOp1ATI(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFragmentOp2ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8, GLuint a9)
+{
+  glColorFragmentOp2ATI = (PFNGLCOLORFRAGMENTOP2ATIPROC)glewGetProcAddress((const GLubyte*)"glColorFragmentOp2ATI");
+  glColorFragmentOp2ATI(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFragmentOp3ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8, GLuint a9, GLuint a10, GLuint a11, GLuint a12)
+{
+  glColorFragmentOp3ATI = (PFNGLCOLORFRAGMENTOP3ATIPROC)glewGetProcAddress((const GLubyte*)"glColorFragmentOp3ATI");
+  glColorFragmentOp3ATI(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFragmentShaderATI (GLuint a0)
+{
+  glDeleteFragmentShaderATI = (PFNGLDELETEFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glDeleteFragmentShaderATI");
+  glDeleteFragmentShaderATI(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEndFragmentShaderATI (void)
+{
+  glEndFragmentShaderATI = (PFNGLENDFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glEndFragmentShaderATI");
+  glEndFragmentShaderATI();
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenFragmentShadersATI (GLuint a0)
+{
+  glGenFragmentShadersATI = (PFNGLGENFRAGMENTSHADERSATIPROC)glewGetProcAddress((const GLubyte*)"glGenFragmentShadersATI");
+  return glGenFragmentShadersATI(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPassTexCoordATI (GLuint a0, GLuint a1, GLenum a2)
+{
+  glPassTexCoordATI = (PFNGLPASSTEXCOORDATIPROC)glewGetProcAddress((const GLubyte*)"glPassTexCoordATI");
+  glPassTexCoordATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleMapATI (GLuint a0, GLuint a1, GLenum a2)
+{
+  glSampleMapATI = (PFNGLSAMPLEMAPATIPROC)glewGetProcAddress((const GLubyte*)"glSampleMapATI");
+  glSampleMapATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSetFragmentShaderConstantATI (GLuint a0, const GLfloat* a1)
+{
+  glSetFragmentShaderConstantATI = (PFNGLSETFRAGMENTSHADERCONSTANTATIPROC)glewGetProcAddress((const GLubyte*)"glSetFragmentShaderConstantATI");
+  glSetFragmentShaderConstantATI(a0, a1);
+}
+
+
+
+static void * GLAPIENTRY _glewLazy_glMapObjectBufferATI (GLuint a0)
+{
+  glMapObjectBufferATI = (PFNGLMAPOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glMapObjectBufferATI");
+  return glMapObjectBufferATI(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glUnmapObjectBufferATI (GLuint a0)
+{
+  glUnmapObjectBufferATI = (PFNGLUNMAPOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glUnmapObjectBufferATI");
+  glUnmapObjectBufferATI(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPNTrianglesfATI (GLenum a0, GLfloat a1)
+{
+  glPNTrianglesfATI = (PFNGLPNTRIANGLESFATIPROC)glewGetProcAddress((const GLubyte*)"glPNTrianglesfATI");
+  glPNTrianglesfATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPNTrianglesiATI (GLenum a0, GLint a1)
+{
+  glPNTrianglesiATI = (PFNGLPNTRIANGLESIATIPROC)glewGetProcAddress((const GLubyte*)"glPNTrianglesiATI");
+  glPNTrianglesiATI(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glStencilFuncSeparateATI (GLenum a0, GLenum a1, GLint a2, GLuint a3)
+{
+  glStencilFuncSeparateATI = (PFNGLSTENCILFUNCSEPARATEATIPROC)glewGetProcAddress((const GLubyte*)"glStencilFuncSeparateATI");
+  glStencilFuncSeparateATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilOpSeparateATI (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  glStencilOpSeparateATI = (PFNGLSTENCILOPSEPARATEATIPROC)glewGetProcAddress((const GLubyte*)"glStencilOpSeparateATI");
+  glStencilOpSeparateATI(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glArrayObjectATI (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLuint a4, GLuint a5)
+{
+  glArrayObjectATI = (PFNGLARRAYOBJECTATIPROC)glewGetProcAddress((const GLubyte*)"glArrayObjectATI");
+  glArrayObjectATI(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glFreeObjectBufferATI (GLuint a0)
+{
+  glFreeObjectBufferATI = (PFNGLFREEOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glFreeObjectBufferATI");
+  glFreeObjectBufferATI(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetArrayObjectfvATI (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetArrayObjectfvATI = (PFNGLGETARRAYOBJECTFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetArrayObjectfvATI");
+  glGetArrayObjectfvATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetArrayObjectivATI (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetArrayObjectivATI = (PFNGLGETARRAYOBJECTIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetArrayObjectivATI");
+  glGetArrayObjectivATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectBufferfvATI (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetObjectBufferfvATI = (PFNGLGETOBJECTBUFFERFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetObjectBufferfvATI");
+  glGetObjectBufferfvATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectBufferivATI (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetObjectBufferivATI = (PFNGLGETOBJECTBUFFERIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetObjectBufferivATI");
+  glGetObjectBufferivATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantArrayObjectfvATI (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetVariantArrayObjectfvATI = (PFNGLGETVARIANTARRAYOBJECTFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVariantArrayObjectfvATI");
+  glGetVariantArrayObjectfvATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantArrayObjectivATI (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVariantArrayObjectivATI = (PFNGLGETVARIANTARRAYOBJECTIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVariantArrayObjectivATI");
+  glGetVariantArrayObjectivATI(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsObjectBufferATI (GLuint a0)
+{
+  glIsObjectBufferATI = (PFNGLISOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glIsObjectBufferATI");
+  return glIsObjectBufferATI(a0);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glNewObjectBufferATI (GLsizei a0, const void * a1, GLenum a2)
+{
+  glNewObjectBufferATI = (PFNGLNEWOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glNewObjectBufferATI");
+  return glNewObjectBufferATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUpdateObjectBufferATI (GLuint a0, GLuint a1, GLsizei a2, const void * a3, GLenum a4)
+{
+  glUpdateObjectBufferATI = (PFNGLUPDATEOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glUpdateObjectBufferATI");
+  glUpdateObjectBufferATI(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantArrayObjectATI (GLuint a0, GLenum a1, GLsizei a2, GLuint a3, GLuint a4)
+{
+  glVariantArrayObjectATI = (PFNGLVARIANTARRAYOBJECTATIPROC)glewGetProcAddress((const GLubyte*)"glVariantArrayObjectATI");
+  glVariantArrayObjectATI(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribArrayObjectfvATI (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetVertexAttribArrayObjectfvATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribArrayObjectfvATI");
+  glGetVertexAttribArrayObjectfvATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribArrayObjectivATI (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexAttribArrayObjectivATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribArrayObjectivATI");
+  glGetVertexAttribArrayObjectivATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribArrayObjectATI (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, GLuint a5, GLuint a6)
+{
+  glVertexAttribArrayObjectATI = (PFNGLVERTEXATTRIBARRAYOBJECTATIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribArrayObjectATI");
+  glVertexAttribArrayObjectATI(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClientActiveVertexStreamATI (GLenum a0)
+{
+  glClientActiveVertexStreamATI = (PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)glewGetProcAddress((const GLubyte*)"glClientActiveVertexStreamATI");
+  glClientActiveVertexStreamATI(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3bATI (GLenum a0, GLbyte a1, GLbyte a2, GLbyte a3)
+{
+  glNormalStream3bATI = (PFNGLNORMALSTREAM3BATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3bATI");
+  glNormalStream3bATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3bvATI (GLenum a0, const GLbyte * a1)
+{
+  glNormalStream3bvATI = (PFNGLNORMALSTREAM3BVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3bvATI");
+  glNormalStream3bvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3dATI (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glNormalStream3dATI = (PFNGLNORMALSTREAM3DATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3dATI");
+  glNormalStream3dATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3dvATI (GLenum a0, const GLdouble * a1)
+{
+  glNormalStream3dvATI = (PFNGLNORMALSTREAM3DVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3dvATI");
+  glNormalStream3dvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3fATI (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glNormalStream3fATI = (PFNGLNORMALSTREAM3FATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3fATI");
+  glNormalStream3fATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3fvATI (GLenum a0, const GLfloat * a1)
+{
+  glNormalStream3fvATI = (PFNGLNORMALSTREAM3FVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3fvATI");
+  glNormalStream3fvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3iATI (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  glNormalStream3iATI = (PFNGLNORMALSTREAM3IATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3iATI");
+  glNormalStream3iATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3ivATI (GLenum a0, const GLint * a1)
+{
+  glNormalStream3ivATI = (PFNGLNORMALSTREAM3IVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3ivATI");
+  glNormalStream3ivATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3sATI (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glNormalStream3sATI = (PFNGLNORMALSTREAM3SATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3sATI");
+  glNormalStream3sATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3svATI (GLenum a0, const GLshort * a1)
+{
+  glNormalStream3svATI = (PFNGLNORMALSTREAM3SVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3svATI");
+  glNormalStream3svATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexBlendEnvfATI (GLenum a0, GLfloat a1)
+{
+  glVertexBlendEnvfATI = (PFNGLVERTEXBLENDENVFATIPROC)glewGetProcAddress((const GLubyte*)"glVertexBlendEnvfATI");
+  glVertexBlendEnvfATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexBlendEnviATI (GLenum a0, GLint a1)
+{
+  glVertexBlendEnviATI = (PFNGLVERTEXBLENDENVIATIPROC)glewGetProcAddress((const GLubyte*)"glVertexBlendEnviATI");
+  glVertexBlendEnviATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1dATI (GLenum a0, GLdouble a1)
+{
+  glVertexStream1dATI = (PFNGLVERTEXSTREAM1DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1dATI");
+  glVertexStream1dATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1dvATI (GLenum a0, const GLdouble * a1)
+{
+  glVertexStream1dvATI = (PFNGLVERTEXSTREAM1DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1dvATI");
+  glVertexStream1dvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1fATI (GLenum a0, GLfloat a1)
+{
+  glVertexStream1fATI = (PFNGLVERTEXSTREAM1FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1fATI");
+  glVertexStream1fATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1fvATI (GLenum a0, const GLfloat * a1)
+{
+  glVertexStream1fvATI = (PFNGLVERTEXSTREAM1FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1fvATI");
+  glVertexStream1fvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1iATI (GLenum a0, GLint a1)
+{
+  glVertexStream1iATI = (PFNGLVERTEXSTREAM1IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1iATI");
+  glVertexStream1iATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1ivATI (GLenum a0, const GLint * a1)
+{
+  glVertexStream1ivATI = (PFNGLVERTEXSTREAM1IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1ivATI");
+  glVertexStream1ivATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1sATI (GLenum a0, GLshort a1)
+{
+  glVertexStream1sATI = (PFNGLVERTEXSTREAM1SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1sATI");
+  glVertexStream1sATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1svATI (GLenum a0, const GLshort * a1)
+{
+  glVertexStream1svATI = (PFNGLVERTEXSTREAM1SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1svATI");
+  glVertexStream1svATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2dATI (GLenum a0, GLdouble a1, GLdouble a2)
+{
+  glVertexStream2dATI = (PFNGLVERTEXSTREAM2DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2dATI");
+  glVertexStream2dATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2dvATI (GLenum a0, const GLdouble * a1)
+{
+  glVertexStream2dvATI = (PFNGLVERTEXSTREAM2DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2dvATI");
+  glVertexStream2dvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2fATI (GLenum a0, GLfloat a1, GLfloat a2)
+{
+  glVertexStream2fATI = (PFNGLVERTEXSTREAM2FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2fATI");
+  glVertexStream2fATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2fvATI (GLenum a0, const GLfloat * a1)
+{
+  glVertexStream2fvATI = (PFNGLVERTEXSTREAM2FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2fvATI");
+  glVertexStream2fvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2iATI (GLenum a0, GLint a1, GLint a2)
+{
+  glVertexStream2iATI = (PFNGLVERTEXSTREAM2IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2iATI");
+  glVertexStream2iATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2ivATI (GLenum a0, const GLint * a1)
+{
+  glVertexStream2ivATI = (PFNGLVERTEXSTREAM2IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2ivATI");
+  glVertexStream2ivATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2sATI (GLenum a0, GLshort a1, GLshort a2)
+{
+  glVertexStream2sATI = (PFNGLVERTEXSTREAM2SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2sATI");
+  glVertexStream2sATI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2svATI (GLenum a0, const GLshort * a1)
+{
+  glVertexStream2svATI = (PFNGLVERTEXSTREAM2SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2svATI");
+  glVertexStream2svATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3dATI (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glVertexStream3dATI = (PFNGLVERTEXSTREAM3DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3dATI");
+  glVertexStream3dATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3dvATI (GLenum a0, const GLdouble * a1)
+{
+  glVertexStream3dvATI = (PFNGLVERTEXSTREAM3DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3dvATI");
+  glVertexStream3dvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3fATI (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glVertexStream3fATI = (PFNGLVERTEXSTREAM3FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3fATI");
+  glVertexStream3fATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3fvATI (GLenum a0, const GLfloat * a1)
+{
+  glVertexStream3fvATI = (PFNGLVERTEXSTREAM3FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3fvATI");
+  glVertexStream3fvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3iATI (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  glVertexStream3iATI = (PFNGLVERTEXSTREAM3IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3iATI");
+  glVertexStream3iATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3ivATI (GLenum a0, const GLint * a1)
+{
+  glVertexStream3ivATI = (PFNGLVERTEXSTREAM3IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3ivATI");
+  glVertexStream3ivATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3sATI (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glVertexStream3sATI = (PFNGLVERTEXSTREAM3SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3sATI");
+  glVertexStream3sATI(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3svATI (GLenum a0, const GLshort * a1)
+{
+  glVertexStream3svATI = (PFNGLVERTEXSTREAM3SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3svATI");
+  glVertexStream3svATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4dATI (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glVertexStream4dATI = (PFNGLVERTEXSTREAM4DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4dATI");
+  glVertexStream4dATI(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4dvATI (GLenum a0, const GLdouble * a1)
+{
+  glVertexStream4dvATI = (PFNGLVERTEXSTREAM4DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4dvATI");
+  glVertexStream4dvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4fATI (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glVertexStream4fATI = (PFNGLVERTEXSTREAM4FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4fATI");
+  glVertexStream4fATI(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4fvATI (GLenum a0, const GLfloat * a1)
+{
+  glVertexStream4fvATI = (PFNGLVERTEXSTREAM4FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4fvATI");
+  glVertexStream4fvATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4iATI (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glVertexStream4iATI = (PFNGLVERTEXSTREAM4IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4iATI");
+  glVertexStream4iATI(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4ivATI (GLenum a0, const GLint * a1)
+{
+  glVertexStream4ivATI = (PFNGLVERTEXSTREAM4IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4ivATI");
+  glVertexStream4ivATI(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4sATI (GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  glVertexStream4sATI = (PFNGLVERTEXSTREAM4SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4sATI");
+  glVertexStream4sATI(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4svATI (GLenum a0, const GLshort * a1)
+{
+  glVertexStream4svATI = (PFNGLVERTEXSTREAM4SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4svATI");
+  glVertexStream4svATI(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glEGLImageTargetTexStorageEXT (GLenum a0, GLeglImageOES a1, const GLint* a2)
+{
+  glEGLImageTargetTexStorageEXT = (PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glEGLImageTargetTexStorageEXT");
+  glEGLImageTargetTexStorageEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glEGLImageTargetTextureStorageEXT (GLuint a0, GLeglImageOES a1, const GLint* a2)
+{
+  glEGLImageTargetTextureStorageEXT = (PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glEGLImageTargetTextureStorageEXT");
+  glEGLImageTargetTextureStorageEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedBaseInstanceEXT (GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4)
+{
+  glDrawArraysInstancedBaseInstanceEXT = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedBaseInstanceEXT");
+  glDrawArraysInstancedBaseInstanceEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseInstanceEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLuint a5)
+{
+  glDrawElementsInstancedBaseInstanceEXT = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseInstanceEXT");
+  glDrawElementsInstancedBaseInstanceEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseVertexBaseInstanceEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5, GLuint a6)
+{
+  glDrawElementsInstancedBaseVertexBaseInstanceEXT = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseVertexBaseInstanceEXT");
+  glDrawElementsInstancedBaseVertexBaseInstanceEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static GLint GLAPIENTRY _glewLazy_glGetUniformBufferSizeEXT (GLuint a0, GLint a1)
+{
+  glGetUniformBufferSizeEXT = (PFNGLGETUNIFORMBUFFERSIZEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUniformBufferSizeEXT");
+  return glGetUniformBufferSizeEXT(a0, a1);
+}
+
+static GLintptr GLAPIENTRY _glewLazy_glGetUniformOffsetEXT (GLuint a0, GLint a1)
+{
+  glGetUniformOffsetEXT = (PFNGLGETUNIFORMOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUniformOffsetEXT");
+  return glGetUniformOffsetEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformBufferEXT (GLuint a0, GLint a1, GLuint a2)
+{
+  glUniformBufferEXT = (PFNGLUNIFORMBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glUniformBufferEXT");
+  glUniformBufferEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendColorEXT (GLclampf a0, GLclampf a1, GLclampf a2, GLclampf a3)
+{
+  glBlendColorEXT = (PFNGLBLENDCOLOREXTPROC)glewGetProcAddress((const GLubyte*)"glBlendColorEXT");
+  glBlendColorEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateEXT (GLenum a0, GLenum a1)
+{
+  glBlendEquationSeparateEXT = (PFNGLBLENDEQUATIONSEPARATEEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateEXT");
+  glBlendEquationSeparateEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocationIndexedEXT (GLuint a0, GLuint a1, GLuint a2, const GLchar * a3)
+{
+  glBindFragDataLocationIndexedEXT = (PFNGLBINDFRAGDATALOCATIONINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocationIndexedEXT");
+  glBindFragDataLocationIndexedEXT(a0, a1, a2, a3);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataIndexEXT (GLuint a0, const GLchar * a1)
+{
+  glGetFragDataIndexEXT = (PFNGLGETFRAGDATAINDEXEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataIndexEXT");
+  return glGetFragDataIndexEXT(a0, a1);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetProgramResourceLocationIndexEXT (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  glGetProgramResourceLocationIndexEXT = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXEXTPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceLocationIndexEXT");
+  return glGetProgramResourceLocationIndexEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateEXT (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  glBlendFuncSeparateEXT = (PFNGLBLENDFUNCSEPARATEEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateEXT");
+  glBlendFuncSeparateEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationEXT (GLenum a0)
+{
+  glBlendEquationEXT = (PFNGLBLENDEQUATIONEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationEXT");
+  glBlendEquationEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferStorageEXT (GLenum a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  glBufferStorageEXT = (PFNGLBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glBufferStorageEXT");
+  glBufferStorageEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferStorageEXT (GLuint a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  glNamedBufferStorageEXT = (PFNGLNAMEDBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferStorageEXT");
+  glNamedBufferStorageEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearTexImageEXT (GLuint a0, GLint a1, GLenum a2, GLenum a3, const void * a4)
+{
+  glClearTexImageEXT = (PFNGLCLEARTEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glClearTexImageEXT");
+  glClearTexImageEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glClearTexSubImageEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glClearTexSubImageEXT = (PFNGLCLEARTEXSUBIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glClearTexSubImageEXT");
+  glClearTexSubImageEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClipControlEXT (GLenum a0, GLenum a1)
+{
+  glClipControlEXT = (PFNGLCLIPCONTROLEXTPROC)glewGetProcAddress((const GLubyte*)"glClipControlEXT");
+  glClipControlEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorSubTableEXT (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glColorSubTableEXT = (PFNGLCOLORSUBTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glColorSubTableEXT");
+  glColorSubTableEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorSubTableEXT (GLenum a0, GLsizei a1, GLint a2, GLint a3, GLsizei a4)
+{
+  glCopyColorSubTableEXT = (PFNGLCOPYCOLORSUBTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyColorSubTableEXT");
+  glCopyColorSubTableEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glLockArraysEXT (GLint a0, GLsizei a1)
+{
+  glLockArraysEXT = (PFNGLLOCKARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glLockArraysEXT");
+  glLockArraysEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUnlockArraysEXT (void)
+{
+  glUnlockArraysEXT = (PFNGLUNLOCKARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glUnlockArraysEXT");
+  glUnlockArraysEXT();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter1DEXT (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glConvolutionFilter1DEXT = (PFNGLCONVOLUTIONFILTER1DEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter1DEXT");
+  glConvolutionFilter1DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter2DEXT (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glConvolutionFilter2DEXT = (PFNGLCONVOLUTIONFILTER2DEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter2DEXT");
+  glConvolutionFilter2DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterfEXT (GLenum a0, GLenum a1, GLfloat a2)
+{
+  glConvolutionParameterfEXT = (PFNGLCONVOLUTIONPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterfEXT");
+  glConvolutionParameterfEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glConvolutionParameterfvEXT = (PFNGLCONVOLUTIONPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterfvEXT");
+  glConvolutionParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameteriEXT (GLenum a0, GLenum a1, GLint a2)
+{
+  glConvolutionParameteriEXT = (PFNGLCONVOLUTIONPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameteriEXT");
+  glConvolutionParameteriEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glConvolutionParameterivEXT = (PFNGLCONVOLUTIONPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterivEXT");
+  glConvolutionParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  glCopyConvolutionFilter1DEXT = (PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter1DEXT");
+  glCopyConvolutionFilter1DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5)
+{
+  glCopyConvolutionFilter2DEXT = (PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter2DEXT");
+  glCopyConvolutionFilter2DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionFilterEXT (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetConvolutionFilterEXT = (PFNGLGETCONVOLUTIONFILTEREXTPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionFilterEXT");
+  glGetConvolutionFilterEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetConvolutionParameterfvEXT = (PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameterfvEXT");
+  glGetConvolutionParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetConvolutionParameterivEXT = (PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameterivEXT");
+  glGetConvolutionParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSeparableFilterEXT (GLenum a0, GLenum a1, GLenum a2, void * a3, void * a4, void * a5)
+{
+  glGetSeparableFilterEXT = (PFNGLGETSEPARABLEFILTEREXTPROC)glewGetProcAddress((const GLubyte*)"glGetSeparableFilterEXT");
+  glGetSeparableFilterEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glSeparableFilter2DEXT (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6, const void * a7)
+{
+  glSeparableFilter2DEXT = (PFNGLSEPARABLEFILTER2DEXTPROC)glewGetProcAddress((const GLubyte*)"glSeparableFilter2DEXT");
+  glSeparableFilter2DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBinormalPointerEXT (GLenum a0, GLsizei a1, void * a2)
+{
+  glBinormalPointerEXT = (PFNGLBINORMALPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glBinormalPointerEXT");
+  glBinormalPointerEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTangentPointerEXT (GLenum a0, GLsizei a1, void * a2)
+{
+  glTangentPointerEXT = (PFNGLTANGENTPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glTangentPointerEXT");
+  glTangentPointerEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyImageSubDataEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  glCopyImageSubDataEXT = (PFNGLCOPYIMAGESUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyImageSubDataEXT");
+  glCopyImageSubDataEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyTexImage1DEXT (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6)
+{
+  glCopyTexImage1DEXT = (PFNGLCOPYTEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexImage1DEXT");
+  glCopyTexImage1DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexImage2DEXT (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7)
+{
+  glCopyTexImage2DEXT = (PFNGLCOPYTEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexImage2DEXT");
+  glCopyTexImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage1DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  glCopyTexSubImage1DEXT = (PFNGLCOPYTEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage1DEXT");
+  glCopyTexSubImage1DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage2DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7)
+{
+  glCopyTexSubImage2DEXT = (PFNGLCOPYTEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage2DEXT");
+  glCopyTexSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage3DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyTexSubImage3DEXT = (PFNGLCOPYTEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage3DEXT");
+  glCopyTexSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCullParameterdvEXT (GLenum a0, GLdouble* a1)
+{
+  glCullParameterdvEXT = (PFNGLCULLPARAMETERDVEXTPROC)glewGetProcAddress((const GLubyte*)"glCullParameterdvEXT");
+  glCullParameterdvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCullParameterfvEXT (GLenum a0, GLfloat* a1)
+{
+  glCullParameterfvEXT = (PFNGLCULLPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glCullParameterfvEXT");
+  glCullParameterfvEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetObjectLabelEXT (GLenum a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar * a4)
+{
+  glGetObjectLabelEXT = (PFNGLGETOBJECTLABELEXTPROC)glewGetProcAddress((const GLubyte*)"glGetObjectLabelEXT");
+  glGetObjectLabelEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glLabelObjectEXT (GLenum a0, GLuint a1, GLsizei a2, const GLchar* a3)
+{
+  glLabelObjectEXT = (PFNGLLABELOBJECTEXTPROC)glewGetProcAddress((const GLubyte*)"glLabelObjectEXT");
+  glLabelObjectEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glInsertEventMarkerEXT (GLsizei a0, const GLchar* a1)
+{
+  glInsertEventMarkerEXT = (PFNGLINSERTEVENTMARKEREXTPROC)glewGetProcAddress((const GLubyte*)"glInsertEventMarkerEXT");
+  glInsertEventMarkerEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPopGroupMarkerEXT (void)
+{
+  glPopGroupMarkerEXT = (PFNGLPOPGROUPMARKEREXTPROC)glewGetProcAddress((const GLubyte*)"glPopGroupMarkerEXT");
+  glPopGroupMarkerEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glPushGroupMarkerEXT (GLsizei a0, const GLchar* a1)
+{
+  glPushGroupMarkerEXT = (PFNGLPUSHGROUPMARKEREXTPROC)glewGetProcAddress((const GLubyte*)"glPushGroupMarkerEXT");
+  glPushGroupMarkerEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDepthBoundsEXT (GLclampd a0, GLclampd a1)
+{
+  glDepthBoundsEXT = (PFNGLDEPTHBOUNDSEXTPROC)glewGetProcAddress((const GLubyte*)"glDepthBoundsEXT");
+  glDepthBoundsEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindMultiTextureEXT (GLenum a0, GLenum a1, GLuint a2)
+{
+  glBindMultiTextureEXT = (PFNGLBINDMULTITEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glBindMultiTextureEXT");
+  glBindMultiTextureEXT(a0, a1, a2);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckNamedFramebufferStatusEXT (GLuint a0, GLenum a1)
+{
+  glCheckNamedFramebufferStatusEXT = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)glewGetProcAddress((const GLubyte*)"glCheckNamedFramebufferStatusEXT");
+  return glCheckNamedFramebufferStatusEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glClientAttribDefaultEXT (GLbitfield a0)
+{
+  glClientAttribDefaultEXT = (PFNGLCLIENTATTRIBDEFAULTEXTPROC)glewGetProcAddress((const GLubyte*)"glClientAttribDefaultEXT");
+  glClientAttribDefaultEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  glCompressedMultiTexImage1DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexImage1DEXT");
+  glCompressedMultiTexImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  glCompressedMultiTexImage2DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexImage2DEXT");
+  glCompressedMultiTexImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLsizei a8, const void * a9)
+{
+  glCompressedMultiTexImage3DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexImage3DEXT");
+  glCompressedMultiTexImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexSubImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLsizei a6, const void * a7)
+{
+  glCompressedMultiTexSubImage1DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexSubImage1DEXT");
+  glCompressedMultiTexSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexSubImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLsizei a8, const void * a9)
+{
+  glCompressedMultiTexSubImage2DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexSubImage2DEXT");
+  glCompressedMultiTexSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexSubImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLsizei a10, const void * a11)
+{
+  glCompressedMultiTexSubImage3DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexSubImage3DEXT");
+  glCompressedMultiTexSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  glCompressedTextureImage1DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureImage1DEXT");
+  glCompressedTextureImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  glCompressedTextureImage2DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureImage2DEXT");
+  glCompressedTextureImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLsizei a8, const void * a9)
+{
+  glCompressedTextureImage3DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureImage3DEXT");
+  glCompressedTextureImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLsizei a6, const void * a7)
+{
+  glCompressedTextureSubImage1DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage1DEXT");
+  glCompressedTextureSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLsizei a8, const void * a9)
+{
+  glCompressedTextureSubImage2DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage2DEXT");
+  glCompressedTextureSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLsizei a10, const void * a11)
+{
+  glCompressedTextureSubImage3DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage3DEXT");
+  glCompressedTextureSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLint a7)
+{
+  glCopyMultiTexImage1DEXT = (PFNGLCOPYMULTITEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexImage1DEXT");
+  glCopyMultiTexImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLint a8)
+{
+  glCopyMultiTexImage2DEXT = (PFNGLCOPYMULTITEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexImage2DEXT");
+  glCopyMultiTexImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexSubImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6)
+{
+  glCopyMultiTexSubImage1DEXT = (PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexSubImage1DEXT");
+  glCopyMultiTexSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexSubImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyMultiTexSubImage2DEXT = (PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexSubImage2DEXT");
+  glCopyMultiTexSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexSubImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLsizei a8, GLsizei a9)
+{
+  glCopyMultiTexSubImage3DEXT = (PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexSubImage3DEXT");
+  glCopyMultiTexSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLint a7)
+{
+  glCopyTextureImage1DEXT = (PFNGLCOPYTEXTUREIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureImage1DEXT");
+  glCopyTextureImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLint a8)
+{
+  glCopyTextureImage2DEXT = (PFNGLCOPYTEXTUREIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureImage2DEXT");
+  glCopyTextureImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6)
+{
+  glCopyTextureSubImage1DEXT = (PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage1DEXT");
+  glCopyTextureSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyTextureSubImage2DEXT = (PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage2DEXT");
+  glCopyTextureSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLsizei a8, GLsizei a9)
+{
+  glCopyTextureSubImage3DEXT = (PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage3DEXT");
+  glCopyTextureSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableClientStateIndexedEXT (GLenum a0, GLuint a1)
+{
+  glDisableClientStateIndexedEXT = (PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableClientStateIndexedEXT");
+  glDisableClientStateIndexedEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableClientStateiEXT (GLenum a0, GLuint a1)
+{
+  glDisableClientStateiEXT = (PFNGLDISABLECLIENTSTATEIEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableClientStateiEXT");
+  glDisableClientStateiEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexArrayAttribEXT (GLuint a0, GLuint a1)
+{
+  glDisableVertexArrayAttribEXT = (PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexArrayAttribEXT");
+  glDisableVertexArrayAttribEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexArrayEXT (GLuint a0, GLenum a1)
+{
+  glDisableVertexArrayEXT = (PFNGLDISABLEVERTEXARRAYEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexArrayEXT");
+  glDisableVertexArrayEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableClientStateIndexedEXT (GLenum a0, GLuint a1)
+{
+  glEnableClientStateIndexedEXT = (PFNGLENABLECLIENTSTATEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableClientStateIndexedEXT");
+  glEnableClientStateIndexedEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableClientStateiEXT (GLenum a0, GLuint a1)
+{
+  glEnableClientStateiEXT = (PFNGLENABLECLIENTSTATEIEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableClientStateiEXT");
+  glEnableClientStateiEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexArrayAttribEXT (GLuint a0, GLuint a1)
+{
+  glEnableVertexArrayAttribEXT = (PFNGLENABLEVERTEXARRAYATTRIBEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexArrayAttribEXT");
+  glEnableVertexArrayAttribEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexArrayEXT (GLuint a0, GLenum a1)
+{
+  glEnableVertexArrayEXT = (PFNGLENABLEVERTEXARRAYEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexArrayEXT");
+  glEnableVertexArrayEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFlushMappedNamedBufferRangeEXT (GLuint a0, GLintptr a1, GLsizeiptr a2)
+{
+  glFlushMappedNamedBufferRangeEXT = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedNamedBufferRangeEXT");
+  glFlushMappedNamedBufferRangeEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferDrawBufferEXT (GLuint a0, GLenum a1)
+{
+  glFramebufferDrawBufferEXT = (PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferDrawBufferEXT");
+  glFramebufferDrawBufferEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferDrawBuffersEXT (GLuint a0, GLsizei a1, const GLenum* a2)
+{
+  glFramebufferDrawBuffersEXT = (PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferDrawBuffersEXT");
+  glFramebufferDrawBuffersEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferReadBufferEXT (GLuint a0, GLenum a1)
+{
+  glFramebufferReadBufferEXT = (PFNGLFRAMEBUFFERREADBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferReadBufferEXT");
+  glFramebufferReadBufferEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMultiTexMipmapEXT (GLenum a0, GLenum a1)
+{
+  glGenerateMultiTexMipmapEXT = (PFNGLGENERATEMULTITEXMIPMAPEXTPROC)glewGetProcAddress((const GLubyte*)"glGenerateMultiTexMipmapEXT");
+  glGenerateMultiTexMipmapEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateTextureMipmapEXT (GLuint a0, GLenum a1)
+{
+  glGenerateTextureMipmapEXT = (PFNGLGENERATETEXTUREMIPMAPEXTPROC)glewGetProcAddress((const GLubyte*)"glGenerateTextureMipmapEXT");
+  glGenerateTextureMipmapEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedMultiTexImageEXT (GLenum a0, GLenum a1, GLint a2, void * a3)
+{
+  glGetCompressedMultiTexImageEXT = (PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedMultiTexImageEXT");
+  glGetCompressedMultiTexImageEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTextureImageEXT (GLuint a0, GLenum a1, GLint a2, void * a3)
+{
+  glGetCompressedTextureImageEXT = (PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTextureImageEXT");
+  glGetCompressedTextureImageEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDoubleIndexedvEXT (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  glGetDoubleIndexedvEXT = (PFNGLGETDOUBLEINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetDoubleIndexedvEXT");
+  glGetDoubleIndexedvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDoublei_vEXT (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  glGetDoublei_vEXT = (PFNGLGETDOUBLEI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetDoublei_vEXT");
+  glGetDoublei_vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloatIndexedvEXT (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetFloatIndexedvEXT = (PFNGLGETFLOATINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFloatIndexedvEXT");
+  glGetFloatIndexedvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloati_vEXT (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetFloati_vEXT = (PFNGLGETFLOATI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFloati_vEXT");
+  glGetFloati_vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetFramebufferParameterivEXT = (PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferParameterivEXT");
+  glGetFramebufferParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexEnvfvEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  glGetMultiTexEnvfvEXT = (PFNGLGETMULTITEXENVFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexEnvfvEXT");
+  glGetMultiTexEnvfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexEnvivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetMultiTexEnvivEXT = (PFNGLGETMULTITEXENVIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexEnvivEXT");
+  glGetMultiTexEnvivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexGendvEXT (GLenum a0, GLenum a1, GLenum a2, GLdouble* a3)
+{
+  glGetMultiTexGendvEXT = (PFNGLGETMULTITEXGENDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexGendvEXT");
+  glGetMultiTexGendvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexGenfvEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  glGetMultiTexGenfvEXT = (PFNGLGETMULTITEXGENFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexGenfvEXT");
+  glGetMultiTexGenfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexGenivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetMultiTexGenivEXT = (PFNGLGETMULTITEXGENIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexGenivEXT");
+  glGetMultiTexGenivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexImageEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLenum a4, void * a5)
+{
+  glGetMultiTexImageEXT = (PFNGLGETMULTITEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexImageEXT");
+  glGetMultiTexImageEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexLevelParameterfvEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLfloat* a4)
+{
+  glGetMultiTexLevelParameterfvEXT = (PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexLevelParameterfvEXT");
+  glGetMultiTexLevelParameterfvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexLevelParameterivEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLint* a4)
+{
+  glGetMultiTexLevelParameterivEXT = (PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexLevelParameterivEXT");
+  glGetMultiTexLevelParameterivEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterIivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetMultiTexParameterIivEXT = (PFNGLGETMULTITEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterIivEXT");
+  glGetMultiTexParameterIivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterIuivEXT (GLenum a0, GLenum a1, GLenum a2, GLuint* a3)
+{
+  glGetMultiTexParameterIuivEXT = (PFNGLGETMULTITEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterIuivEXT");
+  glGetMultiTexParameterIuivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterfvEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  glGetMultiTexParameterfvEXT = (PFNGLGETMULTITEXPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterfvEXT");
+  glGetMultiTexParameterfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetMultiTexParameterivEXT = (PFNGLGETMULTITEXPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterivEXT");
+  glGetMultiTexParameterivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetNamedBufferParameterivEXT = (PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameterivEXT");
+  glGetNamedBufferParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferPointervEXT (GLuint a0, GLenum a1, void** a2)
+{
+  glGetNamedBufferPointervEXT = (PFNGLGETNAMEDBUFFERPOINTERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferPointervEXT");
+  glGetNamedBufferPointervEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferSubDataEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, void * a3)
+{
+  glGetNamedBufferSubDataEXT = (PFNGLGETNAMEDBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferSubDataEXT");
+  glGetNamedBufferSubDataEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferAttachmentParameterivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetNamedFramebufferAttachmentParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferAttachmentParameterivEXT");
+  glGetNamedFramebufferAttachmentParameterivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterIivEXT (GLuint a0, GLenum a1, GLuint a2, GLint* a3)
+{
+  glGetNamedProgramLocalParameterIivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterIivEXT");
+  glGetNamedProgramLocalParameterIivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterIuivEXT (GLuint a0, GLenum a1, GLuint a2, GLuint* a3)
+{
+  glGetNamedProgramLocalParameterIuivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterIuivEXT");
+  glGetNamedProgramLocalParameterIuivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterdvEXT (GLuint a0, GLenum a1, GLuint a2, GLdouble* a3)
+{
+  glGetNamedProgramLocalParameterdvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterdvEXT");
+  glGetNamedProgramLocalParameterdvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterfvEXT (GLuint a0, GLenum a1, GLuint a2, GLfloat* a3)
+{
+  glGetNamedProgramLocalParameterfvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterfvEXT");
+  glGetNamedProgramLocalParameterfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramStringEXT (GLuint a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetNamedProgramStringEXT = (PFNGLGETNAMEDPROGRAMSTRINGEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramStringEXT");
+  glGetNamedProgramStringEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetNamedProgramivEXT = (PFNGLGETNAMEDPROGRAMIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramivEXT");
+  glGetNamedProgramivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedRenderbufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetNamedRenderbufferParameterivEXT = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedRenderbufferParameterivEXT");
+  glGetNamedRenderbufferParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPointerIndexedvEXT (GLenum a0, GLuint a1, void** a2)
+{
+  glGetPointerIndexedvEXT = (PFNGLGETPOINTERINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPointerIndexedvEXT");
+  glGetPointerIndexedvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPointeri_vEXT (GLenum a0, GLuint a1, void** a2)
+{
+  glGetPointeri_vEXT = (PFNGLGETPOINTERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPointeri_vEXT");
+  glGetPointeri_vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureImageEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLenum a4, void * a5)
+{
+  glGetTextureImageEXT = (PFNGLGETTEXTUREIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureImageEXT");
+  glGetTextureImageEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameterfvEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLfloat* a4)
+{
+  glGetTextureLevelParameterfvEXT = (PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameterfvEXT");
+  glGetTextureLevelParameterfvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameterivEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint* a4)
+{
+  glGetTextureLevelParameterivEXT = (PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameterivEXT");
+  glGetTextureLevelParameterivEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetTextureParameterIivEXT = (PFNGLGETTEXTUREPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIivEXT");
+  glGetTextureParameterIivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIuivEXT (GLuint a0, GLenum a1, GLenum a2, GLuint* a3)
+{
+  glGetTextureParameterIuivEXT = (PFNGLGETTEXTUREPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIuivEXT");
+  glGetTextureParameterIuivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterfvEXT (GLuint a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  glGetTextureParameterfvEXT = (PFNGLGETTEXTUREPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterfvEXT");
+  glGetTextureParameterfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetTextureParameterivEXT = (PFNGLGETTEXTUREPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterivEXT");
+  glGetTextureParameterivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIntegeri_vEXT (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetVertexArrayIntegeri_vEXT = (PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIntegeri_vEXT");
+  glGetVertexArrayIntegeri_vEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIntegervEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexArrayIntegervEXT = (PFNGLGETVERTEXARRAYINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIntegervEXT");
+  glGetVertexArrayIntegervEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayPointeri_vEXT (GLuint a0, GLuint a1, GLenum a2, void** a3)
+{
+  glGetVertexArrayPointeri_vEXT = (PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayPointeri_vEXT");
+  glGetVertexArrayPointeri_vEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayPointervEXT (GLuint a0, GLenum a1, void** a2)
+{
+  glGetVertexArrayPointervEXT = (PFNGLGETVERTEXARRAYPOINTERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayPointervEXT");
+  glGetVertexArrayPointervEXT(a0, a1, a2);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBufferEXT (GLuint a0, GLenum a1)
+{
+  glMapNamedBufferEXT = (PFNGLMAPNAMEDBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBufferEXT");
+  return glMapNamedBufferEXT(a0, a1);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBufferRangeEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  glMapNamedBufferRangeEXT = (PFNGLMAPNAMEDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBufferRangeEXT");
+  return glMapNamedBufferRangeEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixFrustumEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  glMatrixFrustumEXT = (PFNGLMATRIXFRUSTUMEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixFrustumEXT");
+  glMatrixFrustumEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadIdentityEXT (GLenum a0)
+{
+  glMatrixLoadIdentityEXT = (PFNGLMATRIXLOADIDENTITYEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadIdentityEXT");
+  glMatrixLoadIdentityEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadTransposedEXT (GLenum a0, const GLdouble* a1)
+{
+  glMatrixLoadTransposedEXT = (PFNGLMATRIXLOADTRANSPOSEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadTransposedEXT");
+  glMatrixLoadTransposedEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadTransposefEXT (GLenum a0, const GLfloat* a1)
+{
+  glMatrixLoadTransposefEXT = (PFNGLMATRIXLOADTRANSPOSEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadTransposefEXT");
+  glMatrixLoadTransposefEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoaddEXT (GLenum a0, const GLdouble* a1)
+{
+  glMatrixLoaddEXT = (PFNGLMATRIXLOADDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoaddEXT");
+  glMatrixLoaddEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadfEXT (GLenum a0, const GLfloat* a1)
+{
+  glMatrixLoadfEXT = (PFNGLMATRIXLOADFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadfEXT");
+  glMatrixLoadfEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultTransposedEXT (GLenum a0, const GLdouble* a1)
+{
+  glMatrixMultTransposedEXT = (PFNGLMATRIXMULTTRANSPOSEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultTransposedEXT");
+  glMatrixMultTransposedEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultTransposefEXT (GLenum a0, const GLfloat* a1)
+{
+  glMatrixMultTransposefEXT = (PFNGLMATRIXMULTTRANSPOSEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultTransposefEXT");
+  glMatrixMultTransposefEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultdEXT (GLenum a0, const GLdouble* a1)
+{
+  glMatrixMultdEXT = (PFNGLMATRIXMULTDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultdEXT");
+  glMatrixMultdEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultfEXT (GLenum a0, const GLfloat* a1)
+{
+  glMatrixMultfEXT = (PFNGLMATRIXMULTFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultfEXT");
+  glMatrixMultfEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixOrthoEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  glMatrixOrthoEXT = (PFNGLMATRIXORTHOEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixOrthoEXT");
+  glMatrixOrthoEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixPopEXT (GLenum a0)
+{
+  glMatrixPopEXT = (PFNGLMATRIXPOPEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixPopEXT");
+  glMatrixPopEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixPushEXT (GLenum a0)
+{
+  glMatrixPushEXT = (PFNGLMATRIXPUSHEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixPushEXT");
+  glMatrixPushEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixRotatedEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glMatrixRotatedEXT = (PFNGLMATRIXROTATEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixRotatedEXT");
+  glMatrixRotatedEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixRotatefEXT (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glMatrixRotatefEXT = (PFNGLMATRIXROTATEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixRotatefEXT");
+  glMatrixRotatefEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixScaledEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glMatrixScaledEXT = (PFNGLMATRIXSCALEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixScaledEXT");
+  glMatrixScaledEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixScalefEXT (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glMatrixScalefEXT = (PFNGLMATRIXSCALEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixScalefEXT");
+  glMatrixScalefEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixTranslatedEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glMatrixTranslatedEXT = (PFNGLMATRIXTRANSLATEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixTranslatedEXT");
+  glMatrixTranslatedEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixTranslatefEXT (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glMatrixTranslatefEXT = (PFNGLMATRIXTRANSLATEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixTranslatefEXT");
+  glMatrixTranslatefEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexBufferEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glMultiTexBufferEXT = (PFNGLMULTITEXBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexBufferEXT");
+  glMultiTexBufferEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordPointerEXT (GLenum a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  glMultiTexCoordPointerEXT = (PFNGLMULTITEXCOORDPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordPointerEXT");
+  glMultiTexCoordPointerEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnvfEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  glMultiTexEnvfEXT = (PFNGLMULTITEXENVFEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnvfEXT");
+  glMultiTexEnvfEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnvfvEXT (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  glMultiTexEnvfvEXT = (PFNGLMULTITEXENVFVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnvfvEXT");
+  glMultiTexEnvfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnviEXT (GLenum a0, GLenum a1, GLenum a2, GLint a3)
+{
+  glMultiTexEnviEXT = (PFNGLMULTITEXENVIEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnviEXT");
+  glMultiTexEnviEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnvivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  glMultiTexEnvivEXT = (PFNGLMULTITEXENVIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnvivEXT");
+  glMultiTexEnvivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGendEXT (GLenum a0, GLenum a1, GLenum a2, GLdouble a3)
+{
+  glMultiTexGendEXT = (PFNGLMULTITEXGENDEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGendEXT");
+  glMultiTexGendEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGendvEXT (GLenum a0, GLenum a1, GLenum a2, const GLdouble* a3)
+{
+  glMultiTexGendvEXT = (PFNGLMULTITEXGENDVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGendvEXT");
+  glMultiTexGendvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGenfEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  glMultiTexGenfEXT = (PFNGLMULTITEXGENFEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGenfEXT");
+  glMultiTexGenfEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGenfvEXT (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  glMultiTexGenfvEXT = (PFNGLMULTITEXGENFVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGenfvEXT");
+  glMultiTexGenfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGeniEXT (GLenum a0, GLenum a1, GLenum a2, GLint a3)
+{
+  glMultiTexGeniEXT = (PFNGLMULTITEXGENIEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGeniEXT");
+  glMultiTexGeniEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGenivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  glMultiTexGenivEXT = (PFNGLMULTITEXGENIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGenivEXT");
+  glMultiTexGenivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void * a8)
+{
+  glMultiTexImage1DEXT = (PFNGLMULTITEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexImage1DEXT");
+  glMultiTexImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glMultiTexImage2DEXT = (PFNGLMULTITEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexImage2DEXT");
+  glMultiTexImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glMultiTexImage3DEXT = (PFNGLMULTITEXIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexImage3DEXT");
+  glMultiTexImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterIivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  glMultiTexParameterIivEXT = (PFNGLMULTITEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterIivEXT");
+  glMultiTexParameterIivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterIuivEXT (GLenum a0, GLenum a1, GLenum a2, const GLuint* a3)
+{
+  glMultiTexParameterIuivEXT = (PFNGLMULTITEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterIuivEXT");
+  glMultiTexParameterIuivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterfEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  glMultiTexParameterfEXT = (PFNGLMULTITEXPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterfEXT");
+  glMultiTexParameterfEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterfvEXT (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  glMultiTexParameterfvEXT = (PFNGLMULTITEXPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterfvEXT");
+  glMultiTexParameterfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameteriEXT (GLenum a0, GLenum a1, GLenum a2, GLint a3)
+{
+  glMultiTexParameteriEXT = (PFNGLMULTITEXPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameteriEXT");
+  glMultiTexParameteriEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  glMultiTexParameterivEXT = (PFNGLMULTITEXPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterivEXT");
+  glMultiTexParameterivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexRenderbufferEXT (GLenum a0, GLenum a1, GLuint a2)
+{
+  glMultiTexRenderbufferEXT = (PFNGLMULTITEXRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexRenderbufferEXT");
+  glMultiTexRenderbufferEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexSubImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLenum a6, const void * a7)
+{
+  glMultiTexSubImage1DEXT = (PFNGLMULTITEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexSubImage1DEXT");
+  glMultiTexSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexSubImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glMultiTexSubImage2DEXT = (PFNGLMULTITEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexSubImage2DEXT");
+  glMultiTexSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexSubImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLenum a10, const void * a11)
+{
+  glMultiTexSubImage3DEXT = (PFNGLMULTITEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexSubImage3DEXT");
+  glMultiTexSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferDataEXT (GLuint a0, GLsizeiptr a1, const void * a2, GLenum a3)
+{
+  glNamedBufferDataEXT = (PFNGLNAMEDBUFFERDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferDataEXT");
+  glNamedBufferDataEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferSubDataEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, const void * a3)
+{
+  glNamedBufferSubDataEXT = (PFNGLNAMEDBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferSubDataEXT");
+  glNamedBufferSubDataEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedCopyBufferSubDataEXT (GLuint a0, GLuint a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  glNamedCopyBufferSubDataEXT = (PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedCopyBufferSubDataEXT");
+  glNamedCopyBufferSubDataEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferRenderbufferEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glNamedFramebufferRenderbufferEXT = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferRenderbufferEXT");
+  glNamedFramebufferRenderbufferEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture1DEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glNamedFramebufferTexture1DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture1DEXT");
+  glNamedFramebufferTexture1DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture2DEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glNamedFramebufferTexture2DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture2DEXT");
+  glNamedFramebufferTexture2DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture3DEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  glNamedFramebufferTexture3DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture3DEXT");
+  glNamedFramebufferTexture3DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3)
+{
+  glNamedFramebufferTextureEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureEXT");
+  glNamedFramebufferTextureEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureFaceEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLenum a4)
+{
+  glNamedFramebufferTextureFaceEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureFaceEXT");
+  glNamedFramebufferTextureFaceEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureLayerEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  glNamedFramebufferTextureLayerEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureLayerEXT");
+  glNamedFramebufferTextureLayerEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4dEXT (GLuint a0, GLenum a1, GLuint a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  glNamedProgramLocalParameter4dEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4dEXT");
+  glNamedProgramLocalParameter4dEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4dvEXT (GLuint a0, GLenum a1, GLuint a2, const GLdouble* a3)
+{
+  glNamedProgramLocalParameter4dvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4dvEXT");
+  glNamedProgramLocalParameter4dvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4fEXT (GLuint a0, GLenum a1, GLuint a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  glNamedProgramLocalParameter4fEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4fEXT");
+  glNamedProgramLocalParameter4fEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4fvEXT (GLuint a0, GLenum a1, GLuint a2, const GLfloat* a3)
+{
+  glNamedProgramLocalParameter4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4fvEXT");
+  glNamedProgramLocalParameter4fvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4iEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLint a5, GLint a6)
+{
+  glNamedProgramLocalParameterI4iEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4iEXT");
+  glNamedProgramLocalParameterI4iEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4ivEXT (GLuint a0, GLenum a1, GLuint a2, const GLint* a3)
+{
+  glNamedProgramLocalParameterI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4ivEXT");
+  glNamedProgramLocalParameterI4ivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4uiEXT (GLuint a0, GLenum a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6)
+{
+  glNamedProgramLocalParameterI4uiEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4uiEXT");
+  glNamedProgramLocalParameterI4uiEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4uivEXT (GLuint a0, GLenum a1, GLuint a2, const GLuint* a3)
+{
+  glNamedProgramLocalParameterI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4uivEXT");
+  glNamedProgramLocalParameterI4uivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameters4fvEXT (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLfloat* a4)
+{
+  glNamedProgramLocalParameters4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameters4fvEXT");
+  glNamedProgramLocalParameters4fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParametersI4ivEXT (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLint* a4)
+{
+  glNamedProgramLocalParametersI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParametersI4ivEXT");
+  glNamedProgramLocalParametersI4ivEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParametersI4uivEXT (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLuint* a4)
+{
+  glNamedProgramLocalParametersI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParametersI4uivEXT");
+  glNamedProgramLocalParametersI4uivEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramStringEXT (GLuint a0, GLenum a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  glNamedProgramStringEXT = (PFNGLNAMEDPROGRAMSTRINGEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramStringEXT");
+  glNamedProgramStringEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageEXT (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  glNamedRenderbufferStorageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageEXT");
+  glNamedRenderbufferStorageEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisampleCoverageEXT (GLuint a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  glNamedRenderbufferStorageMultisampleCoverageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisampleCoverageEXT");
+  glNamedRenderbufferStorageMultisampleCoverageEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisampleEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glNamedRenderbufferStorageMultisampleEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisampleEXT");
+  glNamedRenderbufferStorageMultisampleEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1fEXT (GLuint a0, GLint a1, GLfloat a2)
+{
+  glProgramUniform1fEXT = (PFNGLPROGRAMUNIFORM1FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1fEXT");
+  glProgramUniform1fEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform1fvEXT = (PFNGLPROGRAMUNIFORM1FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1fvEXT");
+  glProgramUniform1fvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1iEXT (GLuint a0, GLint a1, GLint a2)
+{
+  glProgramUniform1iEXT = (PFNGLPROGRAMUNIFORM1IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1iEXT");
+  glProgramUniform1iEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform1ivEXT = (PFNGLPROGRAMUNIFORM1IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ivEXT");
+  glProgramUniform1ivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1uiEXT (GLuint a0, GLint a1, GLuint a2)
+{
+  glProgramUniform1uiEXT = (PFNGLPROGRAMUNIFORM1UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1uiEXT");
+  glProgramUniform1uiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform1uivEXT = (PFNGLPROGRAMUNIFORM1UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1uivEXT");
+  glProgramUniform1uivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2fEXT (GLuint a0, GLint a1, GLfloat a2, GLfloat a3)
+{
+  glProgramUniform2fEXT = (PFNGLPROGRAMUNIFORM2FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2fEXT");
+  glProgramUniform2fEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform2fvEXT = (PFNGLPROGRAMUNIFORM2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2fvEXT");
+  glProgramUniform2fvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2iEXT (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  glProgramUniform2iEXT = (PFNGLPROGRAMUNIFORM2IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2iEXT");
+  glProgramUniform2iEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform2ivEXT = (PFNGLPROGRAMUNIFORM2IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ivEXT");
+  glProgramUniform2ivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2uiEXT (GLuint a0, GLint a1, GLuint a2, GLuint a3)
+{
+  glProgramUniform2uiEXT = (PFNGLPROGRAMUNIFORM2UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2uiEXT");
+  glProgramUniform2uiEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform2uivEXT = (PFNGLPROGRAMUNIFORM2UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2uivEXT");
+  glProgramUniform2uivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3fEXT (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glProgramUniform3fEXT = (PFNGLPROGRAMUNIFORM3FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3fEXT");
+  glProgramUniform3fEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform3fvEXT = (PFNGLPROGRAMUNIFORM3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3fvEXT");
+  glProgramUniform3fvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3iEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glProgramUniform3iEXT = (PFNGLPROGRAMUNIFORM3IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3iEXT");
+  glProgramUniform3iEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform3ivEXT = (PFNGLPROGRAMUNIFORM3IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ivEXT");
+  glProgramUniform3ivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3uiEXT (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glProgramUniform3uiEXT = (PFNGLPROGRAMUNIFORM3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3uiEXT");
+  glProgramUniform3uiEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform3uivEXT = (PFNGLPROGRAMUNIFORM3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3uivEXT");
+  glProgramUniform3uivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4fEXT (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glProgramUniform4fEXT = (PFNGLPROGRAMUNIFORM4FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4fEXT");
+  glProgramUniform4fEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramUniform4fvEXT = (PFNGLPROGRAMUNIFORM4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4fvEXT");
+  glProgramUniform4fvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4iEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  glProgramUniform4iEXT = (PFNGLPROGRAMUNIFORM4IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4iEXT");
+  glProgramUniform4iEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  glProgramUniform4ivEXT = (PFNGLPROGRAMUNIFORM4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ivEXT");
+  glProgramUniform4ivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4uiEXT (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  glProgramUniform4uiEXT = (PFNGLPROGRAMUNIFORM4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4uiEXT");
+  glProgramUniform4uiEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  glProgramUniform4uivEXT = (PFNGLPROGRAMUNIFORM4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4uivEXT");
+  glProgramUniform4uivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2fvEXT");
+  glProgramUniformMatrix2fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x3fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix2x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x3fvEXT");
+  glProgramUniformMatrix2x3fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x4fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix2x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x4fvEXT");
+  glProgramUniformMatrix2x4fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3fvEXT");
+  glProgramUniformMatrix3fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x2fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix3x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x2fvEXT");
+  glProgramUniformMatrix3x2fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x4fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix3x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x4fvEXT");
+  glProgramUniformMatrix3x4fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4fvEXT");
+  glProgramUniformMatrix4fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x2fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix4x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x2fvEXT");
+  glProgramUniformMatrix4x2fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x3fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  glProgramUniformMatrix4x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x3fvEXT");
+  glProgramUniformMatrix4x3fvEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glPushClientAttribDefaultEXT (GLbitfield a0)
+{
+  glPushClientAttribDefaultEXT = (PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)glewGetProcAddress((const GLubyte*)"glPushClientAttribDefaultEXT");
+  glPushClientAttribDefaultEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBufferEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glTextureBufferEXT = (PFNGLTEXTUREBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glTextureBufferEXT");
+  glTextureBufferEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void * a8)
+{
+  glTextureImage1DEXT = (PFNGLTEXTUREIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureImage1DEXT");
+  glTextureImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glTextureImage2DEXT = (PFNGLTEXTUREIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureImage2DEXT");
+  glTextureImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTextureImage3DEXT = (PFNGLTEXTUREIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureImage3DEXT");
+  glTextureImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIivEXT (GLuint a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  glTextureParameterIivEXT = (PFNGLTEXTUREPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIivEXT");
+  glTextureParameterIivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIuivEXT (GLuint a0, GLenum a1, GLenum a2, const GLuint* a3)
+{
+  glTextureParameterIuivEXT = (PFNGLTEXTUREPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIuivEXT");
+  glTextureParameterIuivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterfEXT (GLuint a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  glTextureParameterfEXT = (PFNGLTEXTUREPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterfEXT");
+  glTextureParameterfEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterfvEXT (GLuint a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  glTextureParameterfvEXT = (PFNGLTEXTUREPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterfvEXT");
+  glTextureParameterfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameteriEXT (GLuint a0, GLenum a1, GLenum a2, GLint a3)
+{
+  glTextureParameteriEXT = (PFNGLTEXTUREPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameteriEXT");
+  glTextureParameteriEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterivEXT (GLuint a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  glTextureParameterivEXT = (PFNGLTEXTUREPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterivEXT");
+  glTextureParameterivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureRenderbufferEXT (GLuint a0, GLenum a1, GLuint a2)
+{
+  glTextureRenderbufferEXT = (PFNGLTEXTURERENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glTextureRenderbufferEXT");
+  glTextureRenderbufferEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLenum a6, const void * a7)
+{
+  glTextureSubImage1DEXT = (PFNGLTEXTURESUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage1DEXT");
+  glTextureSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glTextureSubImage2DEXT = (PFNGLTEXTURESUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage2DEXT");
+  glTextureSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLenum a10, const void * a11)
+{
+  glTextureSubImage3DEXT = (PFNGLTEXTURESUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage3DEXT");
+  glTextureSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapNamedBufferEXT (GLuint a0)
+{
+  glUnmapNamedBufferEXT = (PFNGLUNMAPNAMEDBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glUnmapNamedBufferEXT");
+  return glUnmapNamedBufferEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayColorOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  glVertexArrayColorOffsetEXT = (PFNGLVERTEXARRAYCOLOROFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayColorOffsetEXT");
+  glVertexArrayColorOffsetEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayEdgeFlagOffsetEXT (GLuint a0, GLuint a1, GLsizei a2, GLintptr a3)
+{
+  glVertexArrayEdgeFlagOffsetEXT = (PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayEdgeFlagOffsetEXT");
+  glVertexArrayEdgeFlagOffsetEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayFogCoordOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLsizei a3, GLintptr a4)
+{
+  glVertexArrayFogCoordOffsetEXT = (PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayFogCoordOffsetEXT");
+  glVertexArrayFogCoordOffsetEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayIndexOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLsizei a3, GLintptr a4)
+{
+  glVertexArrayIndexOffsetEXT = (PFNGLVERTEXARRAYINDEXOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayIndexOffsetEXT");
+  glVertexArrayIndexOffsetEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayMultiTexCoordOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLint a3, GLenum a4, GLsizei a5, GLintptr a6)
+{
+  glVertexArrayMultiTexCoordOffsetEXT = (PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayMultiTexCoordOffsetEXT");
+  glVertexArrayMultiTexCoordOffsetEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayNormalOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLsizei a3, GLintptr a4)
+{
+  glVertexArrayNormalOffsetEXT = (PFNGLVERTEXARRAYNORMALOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayNormalOffsetEXT");
+  glVertexArrayNormalOffsetEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArraySecondaryColorOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  glVertexArraySecondaryColorOffsetEXT = (PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArraySecondaryColorOffsetEXT");
+  glVertexArraySecondaryColorOffsetEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayTexCoordOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  glVertexArrayTexCoordOffsetEXT = (PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayTexCoordOffsetEXT");
+  glVertexArrayTexCoordOffsetEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribDivisorEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexArrayVertexAttribDivisorEXT = (PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribDivisorEXT");
+  glVertexArrayVertexAttribDivisorEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribIOffsetEXT (GLuint a0, GLuint a1, GLuint a2, GLint a3, GLenum a4, GLsizei a5, GLintptr a6)
+{
+  glVertexArrayVertexAttribIOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribIOffsetEXT");
+  glVertexArrayVertexAttribIOffsetEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribOffsetEXT (GLuint a0, GLuint a1, GLuint a2, GLint a3, GLenum a4, GLboolean a5, GLsizei a6, GLintptr a7)
+{
+  glVertexArrayVertexAttribOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribOffsetEXT");
+  glVertexArrayVertexAttribOffsetEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  glVertexArrayVertexOffsetEXT = (PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexOffsetEXT");
+  glVertexArrayVertexOffsetEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDiscardFramebufferEXT (GLenum a0, GLsizei a1, const GLenum* a2)
+{
+  glDiscardFramebufferEXT = (PFNGLDISCARDFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glDiscardFramebufferEXT");
+  glDiscardFramebufferEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryEXT (GLenum a0, GLuint a1)
+{
+  glBeginQueryEXT = (PFNGLBEGINQUERYEXTPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryEXT");
+  glBeginQueryEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueriesEXT (GLsizei a0, const GLuint* a1)
+{
+  glDeleteQueriesEXT = (PFNGLDELETEQUERIESEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueriesEXT");
+  glDeleteQueriesEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryEXT (GLenum a0)
+{
+  glEndQueryEXT = (PFNGLENDQUERYEXTPROC)glewGetProcAddress((const GLubyte*)"glEndQueryEXT");
+  glEndQueryEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueriesEXT (GLsizei a0, GLuint* a1)
+{
+  glGenQueriesEXT = (PFNGLGENQUERIESEXTPROC)glewGetProcAddress((const GLubyte*)"glGenQueriesEXT");
+  glGenQueriesEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInteger64vEXT (GLenum a0, GLint64* a1)
+{
+  glGetInteger64vEXT = (PFNGLGETINTEGER64VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInteger64vEXT");
+  glGetInteger64vEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetQueryObjectivEXT = (PFNGLGETQUERYOBJECTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectivEXT");
+  glGetQueryObjectivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuivEXT (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetQueryObjectuivEXT = (PFNGLGETQUERYOBJECTUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuivEXT");
+  glGetQueryObjectuivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetQueryivEXT = (PFNGLGETQUERYIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryivEXT");
+  glGetQueryivEXT(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQueryEXT (GLuint a0)
+{
+  glIsQueryEXT = (PFNGLISQUERYEXTPROC)glewGetProcAddress((const GLubyte*)"glIsQueryEXT");
+  return glIsQueryEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glQueryCounterEXT (GLuint a0, GLenum a1)
+{
+  glQueryCounterEXT = (PFNGLQUERYCOUNTEREXTPROC)glewGetProcAddress((const GLubyte*)"glQueryCounterEXT");
+  glQueryCounterEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersEXT (GLsizei a0, const GLenum* a1)
+{
+  glDrawBuffersEXT = (PFNGLDRAWBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersEXT");
+  glDrawBuffersEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorMaskIndexedEXT (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  glColorMaskIndexedEXT = (PFNGLCOLORMASKINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glColorMaskIndexedEXT");
+  glColorMaskIndexedEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableIndexedEXT (GLenum a0, GLuint a1)
+{
+  glDisableIndexedEXT = (PFNGLDISABLEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableIndexedEXT");
+  glDisableIndexedEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableIndexedEXT (GLenum a0, GLuint a1)
+{
+  glEnableIndexedEXT = (PFNGLENABLEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableIndexedEXT");
+  glEnableIndexedEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBooleanIndexedvEXT (GLenum a0, GLuint a1, GLboolean* a2)
+{
+  glGetBooleanIndexedvEXT = (PFNGLGETBOOLEANINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetBooleanIndexedvEXT");
+  glGetBooleanIndexedvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegerIndexedvEXT (GLenum a0, GLuint a1, GLint* a2)
+{
+  glGetIntegerIndexedvEXT = (PFNGLGETINTEGERINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetIntegerIndexedvEXT");
+  glGetIntegerIndexedvEXT(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnabledIndexedEXT (GLenum a0, GLuint a1)
+{
+  glIsEnabledIndexedEXT = (PFNGLISENABLEDINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glIsEnabledIndexedEXT");
+  return glIsEnabledIndexedEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateiEXT (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendEquationSeparateiEXT = (PFNGLBLENDEQUATIONSEPARATEIEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateiEXT");
+  glBlendEquationSeparateiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationiEXT (GLuint a0, GLenum a1)
+{
+  glBlendEquationiEXT = (PFNGLBLENDEQUATIONIEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationiEXT");
+  glBlendEquationiEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateiEXT (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  glBlendFuncSeparateiEXT = (PFNGLBLENDFUNCSEPARATEIEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateiEXT");
+  glBlendFuncSeparateiEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFunciEXT (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendFunciEXT = (PFNGLBLENDFUNCIEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendFunciEXT");
+  glBlendFunciEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColorMaskiEXT (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  glColorMaskiEXT = (PFNGLCOLORMASKIEXTPROC)glewGetProcAddress((const GLubyte*)"glColorMaskiEXT");
+  glColorMaskiEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableiEXT (GLenum a0, GLuint a1)
+{
+  glDisableiEXT = (PFNGLDISABLEIEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableiEXT");
+  glDisableiEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableiEXT (GLenum a0, GLuint a1)
+{
+  glEnableiEXT = (PFNGLENABLEIEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableiEXT");
+  glEnableiEXT(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnablediEXT (GLenum a0, GLuint a1)
+{
+  glIsEnablediEXT = (PFNGLISENABLEDIEXTPROC)glewGetProcAddress((const GLubyte*)"glIsEnablediEXT");
+  return glIsEnablediEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementsBaseVertexEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLint a4)
+{
+  glDrawElementsBaseVertexEXT = (PFNGLDRAWELEMENTSBASEVERTEXEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsBaseVertexEXT");
+  glDrawElementsBaseVertexEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseVertexEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5)
+{
+  glDrawElementsInstancedBaseVertexEXT = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseVertexEXT");
+  glDrawElementsInstancedBaseVertexEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementsBaseVertexEXT (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5, GLint a6)
+{
+  glDrawRangeElementsBaseVertexEXT = (PFNGLDRAWRANGEELEMENTSBASEVERTEXEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementsBaseVertexEXT");
+  glDrawRangeElementsBaseVertexEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsBaseVertexEXT (GLenum a0, const GLsizei* a1, GLenum a2, const void *const * a3, GLsizei a4, const GLint * a5)
+{
+  glMultiDrawElementsBaseVertexEXT = (PFNGLMULTIDRAWELEMENTSBASEVERTEXEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsBaseVertexEXT");
+  glMultiDrawElementsBaseVertexEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedEXT (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedEXT");
+  glDrawArraysInstancedEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4)
+{
+  glDrawElementsInstancedEXT = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedEXT");
+  glDrawElementsInstancedEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementsEXT (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5)
+{
+  glDrawRangeElementsEXT = (PFNGLDRAWRANGEELEMENTSEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementsEXT");
+  glDrawRangeElementsEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackEXT (GLenum a0, GLuint a1)
+{
+  glDrawTransformFeedbackEXT = (PFNGLDRAWTRANSFORMFEEDBACKEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackEXT");
+  glDrawTransformFeedbackEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackInstancedEXT (GLenum a0, GLuint a1, GLsizei a2)
+{
+  glDrawTransformFeedbackInstancedEXT = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackInstancedEXT");
+  glDrawTransformFeedbackInstancedEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferStorageExternalEXT (GLenum a0, GLintptr a1, GLsizeiptr a2, GLeglClientBufferEXT a3, GLbitfield a4)
+{
+  glBufferStorageExternalEXT = (PFNGLBUFFERSTORAGEEXTERNALEXTPROC)glewGetProcAddress((const GLubyte*)"glBufferStorageExternalEXT");
+  glBufferStorageExternalEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferStorageExternalEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, GLeglClientBufferEXT a3, GLbitfield a4)
+{
+  glNamedBufferStorageExternalEXT = (PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferStorageExternalEXT");
+  glNamedBufferStorageExternalEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFogCoordPointerEXT (GLenum a0, GLsizei a1, const void * a2)
+{
+  glFogCoordPointerEXT = (PFNGLFOGCOORDPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoordPointerEXT");
+  glFogCoordPointerEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoorddEXT (GLdouble a0)
+{
+  glFogCoorddEXT = (PFNGLFOGCOORDDEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoorddEXT");
+  glFogCoorddEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoorddvEXT (const GLdouble * a0)
+{
+  glFogCoorddvEXT = (PFNGLFOGCOORDDVEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoorddvEXT");
+  glFogCoorddvEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordfEXT (GLfloat a0)
+{
+  glFogCoordfEXT = (PFNGLFOGCOORDFEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoordfEXT");
+  glFogCoordfEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordfvEXT (const GLfloat * a0)
+{
+  glFogCoordfvEXT = (PFNGLFOGCOORDFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoordfvEXT");
+  glFogCoordfvEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFragmentColorMaterialEXT (GLenum a0, GLenum a1)
+{
+  glFragmentColorMaterialEXT = (PFNGLFRAGMENTCOLORMATERIALEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentColorMaterialEXT");
+  glFragmentColorMaterialEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfEXT (GLenum a0, GLfloat a1)
+{
+  glFragmentLightModelfEXT = (PFNGLFRAGMENTLIGHTMODELFEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfEXT");
+  glFragmentLightModelfEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfvEXT (GLenum a0, GLfloat* a1)
+{
+  glFragmentLightModelfvEXT = (PFNGLFRAGMENTLIGHTMODELFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfvEXT");
+  glFragmentLightModelfvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModeliEXT (GLenum a0, GLint a1)
+{
+  glFragmentLightModeliEXT = (PFNGLFRAGMENTLIGHTMODELIEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModeliEXT");
+  glFragmentLightModeliEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelivEXT (GLenum a0, GLint* a1)
+{
+  glFragmentLightModelivEXT = (PFNGLFRAGMENTLIGHTMODELIVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelivEXT");
+  glFragmentLightModelivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfEXT (GLenum a0, GLenum a1, GLfloat a2)
+{
+  glFragmentLightfEXT = (PFNGLFRAGMENTLIGHTFEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfEXT");
+  glFragmentLightfEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glFragmentLightfvEXT = (PFNGLFRAGMENTLIGHTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfvEXT");
+  glFragmentLightfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightiEXT (GLenum a0, GLenum a1, GLint a2)
+{
+  glFragmentLightiEXT = (PFNGLFRAGMENTLIGHTIEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightiEXT");
+  glFragmentLightiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glFragmentLightivEXT = (PFNGLFRAGMENTLIGHTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightivEXT");
+  glFragmentLightivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfEXT (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  glFragmentMaterialfEXT = (PFNGLFRAGMENTMATERIALFEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfEXT");
+  glFragmentMaterialfEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glFragmentMaterialfvEXT = (PFNGLFRAGMENTMATERIALFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfvEXT");
+  glFragmentMaterialfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialiEXT (GLenum a0, GLenum a1, const GLint a2)
+{
+  glFragmentMaterialiEXT = (PFNGLFRAGMENTMATERIALIEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialiEXT");
+  glFragmentMaterialiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glFragmentMaterialivEXT = (PFNGLFRAGMENTMATERIALIVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialivEXT");
+  glFragmentMaterialivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetFragmentLightfvEXT = (PFNGLGETFRAGMENTLIGHTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightfvEXT");
+  glGetFragmentLightfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetFragmentLightivEXT = (PFNGLGETFRAGMENTLIGHTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightivEXT");
+  glGetFragmentLightivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glGetFragmentMaterialfvEXT = (PFNGLGETFRAGMENTMATERIALFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialfvEXT");
+  glGetFragmentMaterialfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glGetFragmentMaterialivEXT = (PFNGLGETFRAGMENTMATERIALIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialivEXT");
+  glGetFragmentMaterialivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glLightEnviEXT (GLenum a0, GLint a1)
+{
+  glLightEnviEXT = (PFNGLLIGHTENVIEXTPROC)glewGetProcAddress((const GLubyte*)"glLightEnviEXT");
+  glLightEnviEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlitFramebufferEXT (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  glBlitFramebufferEXT = (PFNGLBLITFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebufferEXT");
+  glBlitFramebufferEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glRenderbufferStorageMultisampleEXT = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleEXT");
+  glRenderbufferStorageMultisampleEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindFramebufferEXT (GLenum a0, GLuint a1)
+{
+  glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindFramebufferEXT");
+  glBindFramebufferEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindRenderbufferEXT (GLenum a0, GLuint a1)
+{
+  glBindRenderbufferEXT = (PFNGLBINDRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindRenderbufferEXT");
+  glBindRenderbufferEXT(a0, a1);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckFramebufferStatusEXT (GLenum a0)
+{
+  glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)glewGetProcAddress((const GLubyte*)"glCheckFramebufferStatusEXT");
+  return glCheckFramebufferStatusEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFramebuffersEXT (GLsizei a0, const GLuint* a1)
+{
+  glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteFramebuffersEXT");
+  glDeleteFramebuffersEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteRenderbuffersEXT (GLsizei a0, const GLuint* a1)
+{
+  glDeleteRenderbuffersEXT = (PFNGLDELETERENDERBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteRenderbuffersEXT");
+  glDeleteRenderbuffersEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferRenderbufferEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glFramebufferRenderbufferEXT = (PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferRenderbufferEXT");
+  glFramebufferRenderbufferEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture1DEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glFramebufferTexture1DEXT = (PFNGLFRAMEBUFFERTEXTURE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture1DEXT");
+  glFramebufferTexture1DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2DEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glFramebufferTexture2DEXT = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2DEXT");
+  glFramebufferTexture2DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture3DEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  glFramebufferTexture3DEXT = (PFNGLFRAMEBUFFERTEXTURE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture3DEXT");
+  glFramebufferTexture3DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFramebuffersEXT (GLsizei a0, GLuint* a1)
+{
+  glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenFramebuffersEXT");
+  glGenFramebuffersEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenRenderbuffersEXT (GLsizei a0, GLuint* a1)
+{
+  glGenRenderbuffersEXT = (PFNGLGENRENDERBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenRenderbuffersEXT");
+  glGenRenderbuffersEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMipmapEXT (GLenum a0)
+{
+  glGenerateMipmapEXT = (PFNGLGENERATEMIPMAPEXTPROC)glewGetProcAddress((const GLubyte*)"glGenerateMipmapEXT");
+  glGenerateMipmapEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferAttachmentParameterivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetFramebufferAttachmentParameterivEXT = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferAttachmentParameterivEXT");
+  glGetFramebufferAttachmentParameterivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetRenderbufferParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetRenderbufferParameterivEXT = (PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetRenderbufferParameterivEXT");
+  glGetRenderbufferParameterivEXT(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFramebufferEXT (GLuint a0)
+{
+  glIsFramebufferEXT = (PFNGLISFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glIsFramebufferEXT");
+  return glIsFramebufferEXT(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsRenderbufferEXT (GLuint a0)
+{
+  glIsRenderbufferEXT = (PFNGLISRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glIsRenderbufferEXT");
+  return glIsRenderbufferEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageEXT (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  glRenderbufferStorageEXT = (PFNGLRENDERBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageEXT");
+  glRenderbufferStorageEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureEXT (GLenum a0, GLenum a1, GLuint a2, GLint a3)
+{
+  glFramebufferTextureEXT = (PFNGLFRAMEBUFFERTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureEXT");
+  glFramebufferTextureEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureFaceEXT (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLenum a4)
+{
+  glFramebufferTextureFaceEXT = (PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureFaceEXT");
+  glFramebufferTextureFaceEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameteriEXT (GLuint a0, GLenum a1, GLint a2)
+{
+  glProgramParameteriEXT = (PFNGLPROGRAMPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramParameteriEXT");
+  glProgramParameteriEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameters4fvEXT (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramEnvParameters4fvEXT = (PFNGLPROGRAMENVPARAMETERS4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameters4fvEXT");
+  glProgramEnvParameters4fvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameters4fvEXT (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramLocalParameters4fvEXT = (PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameters4fvEXT");
+  glProgramLocalParameters4fvEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocationEXT (GLuint a0, GLuint a1, const GLchar * a2)
+{
+  glBindFragDataLocationEXT = (PFNGLBINDFRAGDATALOCATIONEXTPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocationEXT");
+  glBindFragDataLocationEXT(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataLocationEXT (GLuint a0, const GLchar * a1)
+{
+  glGetFragDataLocationEXT = (PFNGLGETFRAGDATALOCATIONEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataLocationEXT");
+  return glGetFragDataLocationEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformuivEXT (GLuint a0, GLint a1, GLuint * a2)
+{
+  glGetUniformuivEXT = (PFNGLGETUNIFORMUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUniformuivEXT");
+  glGetUniformuivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIivEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  glGetVertexAttribIivEXT = (PFNGLGETVERTEXATTRIBIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIivEXT");
+  glGetVertexAttribIivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIuivEXT (GLuint a0, GLenum a1, GLuint * a2)
+{
+  glGetVertexAttribIuivEXT = (PFNGLGETVERTEXATTRIBIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIuivEXT");
+  glGetVertexAttribIuivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1uiEXT (GLint a0, GLuint a1)
+{
+  glUniform1uiEXT = (PFNGLUNIFORM1UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform1uiEXT");
+  glUniform1uiEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  glUniform1uivEXT = (PFNGLUNIFORM1UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform1uivEXT");
+  glUniform1uivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2uiEXT (GLint a0, GLuint a1, GLuint a2)
+{
+  glUniform2uiEXT = (PFNGLUNIFORM2UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform2uiEXT");
+  glUniform2uiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  glUniform2uivEXT = (PFNGLUNIFORM2UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform2uivEXT");
+  glUniform2uivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3uiEXT (GLint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  glUniform3uiEXT = (PFNGLUNIFORM3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform3uiEXT");
+  glUniform3uiEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  glUniform3uivEXT = (PFNGLUNIFORM3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform3uivEXT");
+  glUniform3uivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4uiEXT (GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glUniform4uiEXT = (PFNGLUNIFORM4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform4uiEXT");
+  glUniform4uiEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  glUniform4uivEXT = (PFNGLUNIFORM4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform4uivEXT");
+  glUniform4uivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1iEXT (GLuint a0, GLint a1)
+{
+  glVertexAttribI1iEXT = (PFNGLVERTEXATTRIBI1IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1iEXT");
+  glVertexAttribI1iEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1ivEXT (GLuint a0, const GLint * a1)
+{
+  glVertexAttribI1ivEXT = (PFNGLVERTEXATTRIBI1IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1ivEXT");
+  glVertexAttribI1ivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1uiEXT (GLuint a0, GLuint a1)
+{
+  glVertexAttribI1uiEXT = (PFNGLVERTEXATTRIBI1UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1uiEXT");
+  glVertexAttribI1uiEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1uivEXT (GLuint a0, const GLuint * a1)
+{
+  glVertexAttribI1uivEXT = (PFNGLVERTEXATTRIBI1UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1uivEXT");
+  glVertexAttribI1uivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2iEXT (GLuint a0, GLint a1, GLint a2)
+{
+  glVertexAttribI2iEXT = (PFNGLVERTEXATTRIBI2IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2iEXT");
+  glVertexAttribI2iEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2ivEXT (GLuint a0, const GLint * a1)
+{
+  glVertexAttribI2ivEXT = (PFNGLVERTEXATTRIBI2IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2ivEXT");
+  glVertexAttribI2ivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2uiEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glVertexAttribI2uiEXT = (PFNGLVERTEXATTRIBI2UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2uiEXT");
+  glVertexAttribI2uiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2uivEXT (GLuint a0, const GLuint * a1)
+{
+  glVertexAttribI2uivEXT = (PFNGLVERTEXATTRIBI2UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2uivEXT");
+  glVertexAttribI2uivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3iEXT (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  glVertexAttribI3iEXT = (PFNGLVERTEXATTRIBI3IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3iEXT");
+  glVertexAttribI3iEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3ivEXT (GLuint a0, const GLint * a1)
+{
+  glVertexAttribI3ivEXT = (PFNGLVERTEXATTRIBI3IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3ivEXT");
+  glVertexAttribI3ivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3uiEXT (GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  glVertexAttribI3uiEXT = (PFNGLVERTEXATTRIBI3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3uiEXT");
+  glVertexAttribI3uiEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3uivEXT (GLuint a0, const GLuint * a1)
+{
+  glVertexAttribI3uivEXT = (PFNGLVERTEXATTRIBI3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3uivEXT");
+  glVertexAttribI3uivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4bvEXT (GLuint a0, const GLbyte * a1)
+{
+  glVertexAttribI4bvEXT = (PFNGLVERTEXATTRIBI4BVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4bvEXT");
+  glVertexAttribI4bvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4iEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  glVertexAttribI4iEXT = (PFNGLVERTEXATTRIBI4IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4iEXT");
+  glVertexAttribI4iEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ivEXT (GLuint a0, const GLint * a1)
+{
+  glVertexAttribI4ivEXT = (PFNGLVERTEXATTRIBI4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ivEXT");
+  glVertexAttribI4ivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4svEXT (GLuint a0, const GLshort * a1)
+{
+  glVertexAttribI4svEXT = (PFNGLVERTEXATTRIBI4SVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4svEXT");
+  glVertexAttribI4svEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ubvEXT (GLuint a0, const GLubyte * a1)
+{
+  glVertexAttribI4ubvEXT = (PFNGLVERTEXATTRIBI4UBVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ubvEXT");
+  glVertexAttribI4ubvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4uiEXT (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glVertexAttribI4uiEXT = (PFNGLVERTEXATTRIBI4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4uiEXT");
+  glVertexAttribI4uiEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4uivEXT (GLuint a0, const GLuint * a1)
+{
+  glVertexAttribI4uivEXT = (PFNGLVERTEXATTRIBI4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4uivEXT");
+  glVertexAttribI4uivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4usvEXT (GLuint a0, const GLushort * a1)
+{
+  glVertexAttribI4usvEXT = (PFNGLVERTEXATTRIBI4USVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4usvEXT");
+  glVertexAttribI4usvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIPointerEXT (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  glVertexAttribIPointerEXT = (PFNGLVERTEXATTRIBIPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIPointerEXT");
+  glVertexAttribIPointerEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetHistogramEXT (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  glGetHistogramEXT = (PFNGLGETHISTOGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramEXT");
+  glGetHistogramEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetHistogramParameterfvEXT = (PFNGLGETHISTOGRAMPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameterfvEXT");
+  glGetHistogramParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetHistogramParameterivEXT = (PFNGLGETHISTOGRAMPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameterivEXT");
+  glGetHistogramParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxEXT (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  glGetMinmaxEXT = (PFNGLGETMINMAXEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxEXT");
+  glGetMinmaxEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetMinmaxParameterfvEXT = (PFNGLGETMINMAXPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameterfvEXT");
+  glGetMinmaxParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetMinmaxParameterivEXT = (PFNGLGETMINMAXPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameterivEXT");
+  glGetMinmaxParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glHistogramEXT (GLenum a0, GLsizei a1, GLenum a2, GLboolean a3)
+{
+  glHistogramEXT = (PFNGLHISTOGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glHistogramEXT");
+  glHistogramEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMinmaxEXT (GLenum a0, GLenum a1, GLboolean a2)
+{
+  glMinmaxEXT = (PFNGLMINMAXEXTPROC)glewGetProcAddress((const GLubyte*)"glMinmaxEXT");
+  glMinmaxEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glResetHistogramEXT (GLenum a0)
+{
+  glResetHistogramEXT = (PFNGLRESETHISTOGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glResetHistogramEXT");
+  glResetHistogramEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glResetMinmaxEXT (GLenum a0)
+{
+  glResetMinmaxEXT = (PFNGLRESETMINMAXEXTPROC)glewGetProcAddress((const GLubyte*)"glResetMinmaxEXT");
+  glResetMinmaxEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glIndexFuncEXT (GLenum a0, GLfloat a1)
+{
+  glIndexFuncEXT = (PFNGLINDEXFUNCEXTPROC)glewGetProcAddress((const GLubyte*)"glIndexFuncEXT");
+  glIndexFuncEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glIndexMaterialEXT (GLenum a0, GLenum a1)
+{
+  glIndexMaterialEXT = (PFNGLINDEXMATERIALEXTPROC)glewGetProcAddress((const GLubyte*)"glIndexMaterialEXT");
+  glIndexMaterialEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisorEXT (GLuint a0, GLuint a1)
+{
+  glVertexAttribDivisorEXT = (PFNGLVERTEXATTRIBDIVISOREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisorEXT");
+  glVertexAttribDivisorEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glApplyTextureEXT (GLenum a0)
+{
+  glApplyTextureEXT = (PFNGLAPPLYTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glApplyTextureEXT");
+  glApplyTextureEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureLightEXT (GLenum a0)
+{
+  glTextureLightEXT = (PFNGLTEXTURELIGHTEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureLightEXT");
+  glTextureLightEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureMaterialEXT (GLenum a0, GLenum a1)
+{
+  glTextureMaterialEXT = (PFNGLTEXTUREMATERIALEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureMaterialEXT");
+  glTextureMaterialEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFlushMappedBufferRangeEXT (GLenum a0, GLintptr a1, GLsizeiptr a2)
+{
+  glFlushMappedBufferRangeEXT = (PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedBufferRangeEXT");
+  glFlushMappedBufferRangeEXT(a0, a1, a2);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapBufferRangeEXT (GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  glMapBufferRangeEXT = (PFNGLMAPBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glMapBufferRangeEXT");
+  return glMapBufferRangeEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferStorageMemEXT (GLenum a0, GLsizeiptr a1, GLuint a2, GLuint64 a3)
+{
+  glBufferStorageMemEXT = (PFNGLBUFFERSTORAGEMEMEXTPROC)glewGetProcAddress((const GLubyte*)"glBufferStorageMemEXT");
+  glBufferStorageMemEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateMemoryObjectsEXT (GLsizei a0, GLuint* a1)
+{
+  glCreateMemoryObjectsEXT = (PFNGLCREATEMEMORYOBJECTSEXTPROC)glewGetProcAddress((const GLubyte*)"glCreateMemoryObjectsEXT");
+  glCreateMemoryObjectsEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteMemoryObjectsEXT (GLsizei a0, const GLuint* a1)
+{
+  glDeleteMemoryObjectsEXT = (PFNGLDELETEMEMORYOBJECTSEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteMemoryObjectsEXT");
+  glDeleteMemoryObjectsEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMemoryObjectParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetMemoryObjectParameterivEXT = (PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMemoryObjectParameterivEXT");
+  glGetMemoryObjectParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUnsignedBytei_vEXT (GLenum a0, GLuint a1, GLubyte* a2)
+{
+  glGetUnsignedBytei_vEXT = (PFNGLGETUNSIGNEDBYTEI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUnsignedBytei_vEXT");
+  glGetUnsignedBytei_vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUnsignedBytevEXT (GLenum a0, GLubyte* a1)
+{
+  glGetUnsignedBytevEXT = (PFNGLGETUNSIGNEDBYTEVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUnsignedBytevEXT");
+  glGetUnsignedBytevEXT(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsMemoryObjectEXT (GLuint a0)
+{
+  glIsMemoryObjectEXT = (PFNGLISMEMORYOBJECTEXTPROC)glewGetProcAddress((const GLubyte*)"glIsMemoryObjectEXT");
+  return glIsMemoryObjectEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMemoryObjectParameterivEXT (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glMemoryObjectParameterivEXT = (PFNGLMEMORYOBJECTPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMemoryObjectParameterivEXT");
+  glMemoryObjectParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferStorageMemEXT (GLuint a0, GLsizeiptr a1, GLuint a2, GLuint64 a3)
+{
+  glNamedBufferStorageMemEXT = (PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferStorageMemEXT");
+  glNamedBufferStorageMemEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorageMem1DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLuint a4, GLuint64 a5)
+{
+  glTexStorageMem1DEXT = (PFNGLTEXSTORAGEMEM1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorageMem1DEXT");
+  glTexStorageMem1DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorageMem2DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLuint a5, GLuint64 a6)
+{
+  glTexStorageMem2DEXT = (PFNGLTEXSTORAGEMEM2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorageMem2DEXT");
+  glTexStorageMem2DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorageMem2DMultisampleEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5, GLuint a6, GLuint64 a7)
+{
+  glTexStorageMem2DMultisampleEXT = (PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorageMem2DMultisampleEXT");
+  glTexStorageMem2DMultisampleEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorageMem3DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLuint a6, GLuint64 a7)
+{
+  glTexStorageMem3DEXT = (PFNGLTEXSTORAGEMEM3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorageMem3DEXT");
+  glTexStorageMem3DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorageMem3DMultisampleEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6, GLuint a7, GLuint64 a8)
+{
+  glTexStorageMem3DMultisampleEXT = (PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorageMem3DMultisampleEXT");
+  glTexStorageMem3DMultisampleEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageMem1DEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLuint a4, GLuint64 a5)
+{
+  glTextureStorageMem1DEXT = (PFNGLTEXTURESTORAGEMEM1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageMem1DEXT");
+  glTextureStorageMem1DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageMem2DEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLuint a5, GLuint64 a6)
+{
+  glTextureStorageMem2DEXT = (PFNGLTEXTURESTORAGEMEM2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageMem2DEXT");
+  glTextureStorageMem2DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageMem2DMultisampleEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5, GLuint a6, GLuint64 a7)
+{
+  glTextureStorageMem2DMultisampleEXT = (PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageMem2DMultisampleEXT");
+  glTextureStorageMem2DMultisampleEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageMem3DEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLuint a6, GLuint64 a7)
+{
+  glTextureStorageMem3DEXT = (PFNGLTEXTURESTORAGEMEM3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageMem3DEXT");
+  glTextureStorageMem3DEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageMem3DMultisampleEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6, GLuint a7, GLuint64 a8)
+{
+  glTextureStorageMem3DMultisampleEXT = (PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageMem3DMultisampleEXT");
+  glTextureStorageMem3DMultisampleEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glImportMemoryFdEXT (GLuint a0, GLuint64 a1, GLenum a2, GLint a3)
+{
+  glImportMemoryFdEXT = (PFNGLIMPORTMEMORYFDEXTPROC)glewGetProcAddress((const GLubyte*)"glImportMemoryFdEXT");
+  glImportMemoryFdEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glImportMemoryWin32HandleEXT (GLuint a0, GLuint64 a1, GLenum a2, void * a3)
+{
+  glImportMemoryWin32HandleEXT = (PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)glewGetProcAddress((const GLubyte*)"glImportMemoryWin32HandleEXT");
+  glImportMemoryWin32HandleEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glImportMemoryWin32NameEXT (GLuint a0, GLuint64 a1, GLenum a2, const void * a3)
+{
+  glImportMemoryWin32NameEXT = (PFNGLIMPORTMEMORYWIN32NAMEEXTPROC)glewGetProcAddress((const GLubyte*)"glImportMemoryWin32NameEXT");
+  glImportMemoryWin32NameEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysEXT (GLenum a0, const GLint* a1, const GLsizei * a2, GLsizei a3)
+{
+  glMultiDrawArraysEXT = (PFNGLMULTIDRAWARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysEXT");
+  glMultiDrawArraysEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsEXT (GLenum a0, GLsizei* a1, GLenum a2, const void *const * a3, GLsizei a4)
+{
+  glMultiDrawElementsEXT = (PFNGLMULTIDRAWELEMENTSEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsEXT");
+  glMultiDrawElementsEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectEXT (GLenum a0, const void * a1, GLsizei a2, GLsizei a3)
+{
+  glMultiDrawArraysIndirectEXT = (PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectEXT");
+  glMultiDrawArraysIndirectEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectEXT (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4)
+{
+  glMultiDrawElementsIndirectEXT = (PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectEXT");
+  glMultiDrawElementsIndirectEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSampleMaskEXT (GLclampf a0, GLboolean a1)
+{
+  glSampleMaskEXT = (PFNGLSAMPLEMASKEXTPROC)glewGetProcAddress((const GLubyte*)"glSampleMaskEXT");
+  glSampleMaskEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplePatternEXT (GLenum a0)
+{
+  glSamplePatternEXT = (PFNGLSAMPLEPATTERNEXTPROC)glewGetProcAddress((const GLubyte*)"glSamplePatternEXT");
+  glSamplePatternEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2DMultisampleEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLsizei a5)
+{
+  glFramebufferTexture2DMultisampleEXT = (PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2DMultisampleEXT");
+  glFramebufferTexture2DMultisampleEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersIndexedEXT (GLint a0, const GLenum* a1, const GLint * a2)
+{
+  glDrawBuffersIndexedEXT = (PFNGLDRAWBUFFERSINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersIndexedEXT");
+  glDrawBuffersIndexedEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegeri_vEXT (GLenum a0, GLuint a1, GLint* a2)
+{
+  glGetIntegeri_vEXT = (PFNGLGETINTEGERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetIntegeri_vEXT");
+  glGetIntegeri_vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glReadBufferIndexedEXT (GLenum a0, GLint a1)
+{
+  glReadBufferIndexedEXT = (PFNGLREADBUFFERINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glReadBufferIndexedEXT");
+  glReadBufferIndexedEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorTableEXT (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glColorTableEXT = (PFNGLCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glColorTableEXT");
+  glColorTableEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableEXT (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetColorTableEXT = (PFNGLGETCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableEXT");
+  glGetColorTableEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetColorTableParameterfvEXT = (PFNGLGETCOLORTABLEPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterfvEXT");
+  glGetColorTableParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetColorTableParameterivEXT = (PFNGLGETCOLORTABLEPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterivEXT");
+  glGetColorTableParameterivEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetPixelTransformParameterfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glGetPixelTransformParameterfvEXT = (PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPixelTransformParameterfvEXT");
+  glGetPixelTransformParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPixelTransformParameterivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glGetPixelTransformParameterivEXT = (PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPixelTransformParameterivEXT");
+  glGetPixelTransformParameterivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterfEXT (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  glPixelTransformParameterfEXT = (PFNGLPIXELTRANSFORMPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterfEXT");
+  glPixelTransformParameterfEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glPixelTransformParameterfvEXT = (PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterfvEXT");
+  glPixelTransformParameterfvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameteriEXT (GLenum a0, GLenum a1, const GLint a2)
+{
+  glPixelTransformParameteriEXT = (PFNGLPIXELTRANSFORMPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameteriEXT");
+  glPixelTransformParameteriEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glPixelTransformParameterivEXT = (PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterivEXT");
+  glPixelTransformParameterivEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPointParameterfEXT (GLenum a0, GLfloat a1)
+{
+  glPointParameterfEXT = (PFNGLPOINTPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfEXT");
+  glPointParameterfEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterfvEXT (GLenum a0, const GLfloat* a1)
+{
+  glPointParameterfvEXT = (PFNGLPOINTPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfvEXT");
+  glPointParameterfvEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetEXT (GLfloat a0, GLfloat a1)
+{
+  glPolygonOffsetEXT = (PFNGLPOLYGONOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetEXT");
+  glPolygonOffsetEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetClampEXT (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glPolygonOffsetClampEXT = (PFNGLPOLYGONOFFSETCLAMPEXTPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetClampEXT");
+  glPolygonOffsetClampEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPrimitiveBoundingBoxEXT (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glPrimitiveBoundingBoxEXT = (PFNGLPRIMITIVEBOUNDINGBOXEXTPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveBoundingBoxEXT");
+  glPrimitiveBoundingBoxEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glProvokingVertexEXT (GLenum a0)
+{
+  glProvokingVertexEXT = (PFNGLPROVOKINGVERTEXEXTPROC)glewGetProcAddress((const GLubyte*)"glProvokingVertexEXT");
+  glProvokingVertexEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCoverageModulationNV (GLenum a0)
+{
+  glCoverageModulationNV = (PFNGLCOVERAGEMODULATIONNVPROC)glewGetProcAddress((const GLubyte*)"glCoverageModulationNV");
+  glCoverageModulationNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverageModulationTableNV (GLsizei a0, const GLfloat* a1)
+{
+  glCoverageModulationTableNV = (PFNGLCOVERAGEMODULATIONTABLENVPROC)glewGetProcAddress((const GLubyte*)"glCoverageModulationTableNV");
+  glCoverageModulationTableNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCoverageModulationTableNV (GLsizei a0, GLfloat* a1)
+{
+  glGetCoverageModulationTableNV = (PFNGLGETCOVERAGEMODULATIONTABLENVPROC)glewGetProcAddress((const GLubyte*)"glGetCoverageModulationTableNV");
+  glGetCoverageModulationTableNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glRasterSamplesEXT (GLuint a0, GLboolean a1)
+{
+  glRasterSamplesEXT = (PFNGLRASTERSAMPLESEXTPROC)glewGetProcAddress((const GLubyte*)"glRasterSamplesEXT");
+  glRasterSamplesEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetnUniformfvEXT (GLuint a0, GLint a1, GLsizei a2, GLfloat* a3)
+{
+  glGetnUniformfvEXT = (PFNGLGETNUNIFORMFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformfvEXT");
+  glGetnUniformfvEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformivEXT (GLuint a0, GLint a1, GLsizei a2, GLint* a3)
+{
+  glGetnUniformivEXT = (PFNGLGETNUNIFORMIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformivEXT");
+  glGetnUniformivEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReadnPixelsEXT (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7)
+{
+  glReadnPixelsEXT = (PFNGLREADNPIXELSEXTPROC)glewGetProcAddress((const GLubyte*)"glReadnPixelsEXT");
+  glReadnPixelsEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginSceneEXT (void)
+{
+  glBeginSceneEXT = (PFNGLBEGINSCENEEXTPROC)glewGetProcAddress((const GLubyte*)"glBeginSceneEXT");
+  glBeginSceneEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glEndSceneEXT (void)
+{
+  glEndSceneEXT = (PFNGLENDSCENEEXTPROC)glewGetProcAddress((const GLubyte*)"glEndSceneEXT");
+  glEndSceneEXT();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3bEXT (GLbyte a0, GLbyte a1, GLbyte a2)
+{
+  glSecondaryColor3bEXT = (PFNGLSECONDARYCOLOR3BEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3bEXT");
+  glSecondaryColor3bEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3bvEXT (const GLbyte * a0)
+{
+  glSecondaryColor3bvEXT = (PFNGLSECONDARYCOLOR3BVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3bvEXT");
+  glSecondaryColor3bvEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3dEXT (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  glSecondaryColor3dEXT = (PFNGLSECONDARYCOLOR3DEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3dEXT");
+  glSecondaryColor3dEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3dvEXT (const GLdouble * a0)
+{
+  glSecondaryColor3dvEXT = (PFNGLSECONDARYCOLOR3DVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3dvEXT");
+  glSecondaryColor3dvEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3fEXT (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glSecondaryColor3fEXT = (PFNGLSECONDARYCOLOR3FEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3fEXT");
+  glSecondaryColor3fEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3fvEXT (const GLfloat * a0)
+{
+  glSecondaryColor3fvEXT = (PFNGLSECONDARYCOLOR3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3fvEXT");
+  glSecondaryColor3fvEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3iEXT (GLint a0, GLint a1, GLint a2)
+{
+  glSecondaryColor3iEXT = (PFNGLSECONDARYCOLOR3IEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3iEXT");
+  glSecondaryColor3iEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ivEXT (const GLint * a0)
+{
+  glSecondaryColor3ivEXT = (PFNGLSECONDARYCOLOR3IVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ivEXT");
+  glSecondaryColor3ivEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3sEXT (GLshort a0, GLshort a1, GLshort a2)
+{
+  glSecondaryColor3sEXT = (PFNGLSECONDARYCOLOR3SEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3sEXT");
+  glSecondaryColor3sEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3svEXT (const GLshort * a0)
+{
+  glSecondaryColor3svEXT = (PFNGLSECONDARYCOLOR3SVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3svEXT");
+  glSecondaryColor3svEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ubEXT (GLubyte a0, GLubyte a1, GLubyte a2)
+{
+  glSecondaryColor3ubEXT = (PFNGLSECONDARYCOLOR3UBEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ubEXT");
+  glSecondaryColor3ubEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ubvEXT (const GLubyte * a0)
+{
+  glSecondaryColor3ubvEXT = (PFNGLSECONDARYCOLOR3UBVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ubvEXT");
+  glSecondaryColor3ubvEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3uiEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glSecondaryColor3uiEXT = (PFNGLSECONDARYCOLOR3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3uiEXT");
+  glSecondaryColor3uiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3uivEXT (const GLuint * a0)
+{
+  glSecondaryColor3uivEXT = (PFNGLSECONDARYCOLOR3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3uivEXT");
+  glSecondaryColor3uivEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3usEXT (GLushort a0, GLushort a1, GLushort a2)
+{
+  glSecondaryColor3usEXT = (PFNGLSECONDARYCOLOR3USEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3usEXT");
+  glSecondaryColor3usEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3usvEXT (const GLushort * a0)
+{
+  glSecondaryColor3usvEXT = (PFNGLSECONDARYCOLOR3USVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3usvEXT");
+  glSecondaryColor3usvEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorPointerEXT (GLint a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  glSecondaryColorPointerEXT = (PFNGLSECONDARYCOLORPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorPointerEXT");
+  glSecondaryColorPointerEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDeleteSemaphoresEXT (GLsizei a0, const GLuint* a1)
+{
+  glDeleteSemaphoresEXT = (PFNGLDELETESEMAPHORESEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteSemaphoresEXT");
+  glDeleteSemaphoresEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenSemaphoresEXT (GLsizei a0, GLuint* a1)
+{
+  glGenSemaphoresEXT = (PFNGLGENSEMAPHORESEXTPROC)glewGetProcAddress((const GLubyte*)"glGenSemaphoresEXT");
+  glGenSemaphoresEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSemaphoreParameterui64vEXT (GLuint a0, GLenum a1, GLuint64* a2)
+{
+  glGetSemaphoreParameterui64vEXT = (PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetSemaphoreParameterui64vEXT");
+  glGetSemaphoreParameterui64vEXT(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSemaphoreEXT (GLuint a0)
+{
+  glIsSemaphoreEXT = (PFNGLISSEMAPHOREEXTPROC)glewGetProcAddress((const GLubyte*)"glIsSemaphoreEXT");
+  return glIsSemaphoreEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSemaphoreParameterui64vEXT (GLuint a0, GLenum a1, const GLuint64* a2)
+{
+  glSemaphoreParameterui64vEXT = (PFNGLSEMAPHOREPARAMETERUI64VEXTPROC)glewGetProcAddress((const GLubyte*)"glSemaphoreParameterui64vEXT");
+  glSemaphoreParameterui64vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSignalSemaphoreEXT (GLuint a0, GLuint a1, const GLuint* a2, GLuint a3, const GLuint * a4, const GLenum * a5)
+{
+  glSignalSemaphoreEXT = (PFNGLSIGNALSEMAPHOREEXTPROC)glewGetProcAddress((const GLubyte*)"glSignalSemaphoreEXT");
+  glSignalSemaphoreEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glWaitSemaphoreEXT (GLuint a0, GLuint a1, const GLuint* a2, GLuint a3, const GLuint * a4, const GLenum * a5)
+{
+  glWaitSemaphoreEXT = (PFNGLWAITSEMAPHOREEXTPROC)glewGetProcAddress((const GLubyte*)"glWaitSemaphoreEXT");
+  glWaitSemaphoreEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glImportSemaphoreFdEXT (GLuint a0, GLenum a1, GLint a2)
+{
+  glImportSemaphoreFdEXT = (PFNGLIMPORTSEMAPHOREFDEXTPROC)glewGetProcAddress((const GLubyte*)"glImportSemaphoreFdEXT");
+  glImportSemaphoreFdEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glImportSemaphoreWin32HandleEXT (GLuint a0, GLenum a1, void * a2)
+{
+  glImportSemaphoreWin32HandleEXT = (PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)glewGetProcAddress((const GLubyte*)"glImportSemaphoreWin32HandleEXT");
+  glImportSemaphoreWin32HandleEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glImportSemaphoreWin32NameEXT (GLuint a0, GLenum a1, const void * a2)
+{
+  glImportSemaphoreWin32NameEXT = (PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)glewGetProcAddress((const GLubyte*)"glImportSemaphoreWin32NameEXT");
+  glImportSemaphoreWin32NameEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glActiveProgramEXT (GLuint a0)
+{
+  glActiveProgramEXT = (PFNGLACTIVEPROGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glActiveProgramEXT");
+  glActiveProgramEXT(a0);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateShaderProgramEXT (GLenum a0, const GLchar* a1)
+{
+  glCreateShaderProgramEXT = (PFNGLCREATESHADERPROGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glCreateShaderProgramEXT");
+  return glCreateShaderProgramEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUseShaderProgramEXT (GLenum a0, GLuint a1)
+{
+  glUseShaderProgramEXT = (PFNGLUSESHADERPROGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glUseShaderProgramEXT");
+  glUseShaderProgramEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferFetchBarrierEXT (void)
+{
+  glFramebufferFetchBarrierEXT = (PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferFetchBarrierEXT");
+  glFramebufferFetchBarrierEXT();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindImageTextureEXT (GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLint a6)
+{
+  glBindImageTextureEXT = (PFNGLBINDIMAGETEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glBindImageTextureEXT");
+  glBindImageTextureEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMemoryBarrierEXT (GLbitfield a0)
+{
+  glMemoryBarrierEXT = (PFNGLMEMORYBARRIEREXTPROC)glewGetProcAddress((const GLubyte*)"glMemoryBarrierEXT");
+  glMemoryBarrierEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearPixelLocalStorageuiEXT (GLsizei a0, GLsizei a1, const GLuint* a2)
+{
+  glClearPixelLocalStorageuiEXT = (PFNGLCLEARPIXELLOCALSTORAGEUIEXTPROC)glewGetProcAddress((const GLubyte*)"glClearPixelLocalStorageuiEXT");
+  glClearPixelLocalStorageuiEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferPixelLocalStorageSizeEXT (GLuint a0, GLsizei a1)
+{
+  glFramebufferPixelLocalStorageSizeEXT = (PFNGLFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferPixelLocalStorageSizeEXT");
+  glFramebufferPixelLocalStorageSizeEXT(a0, a1);
+}
+
+static GLsizei GLAPIENTRY _glewLazy_glGetFramebufferPixelLocalStorageSizeEXT (GLuint a0)
+{
+  glGetFramebufferPixelLocalStorageSizeEXT = (PFNGLGETFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferPixelLocalStorageSizeEXT");
+  return glGetFramebufferPixelLocalStorageSizeEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexPageCommitmentEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  glTexPageCommitmentEXT = (PFNGLTEXPAGECOMMITMENTEXTPROC)glewGetProcAddress((const GLubyte*)"glTexPageCommitmentEXT");
+  glTexPageCommitmentEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTexturePageCommitmentEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  glTexturePageCommitmentEXT = (PFNGLTEXTUREPAGECOMMITMENTEXTPROC)glewGetProcAddress((const GLubyte*)"glTexturePageCommitmentEXT");
+  glTexturePageCommitmentEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glActiveStencilFaceEXT (GLenum a0)
+{
+  glActiveStencilFaceEXT = (PFNGLACTIVESTENCILFACEEXTPROC)glewGetProcAddress((const GLubyte*)"glActiveStencilFaceEXT");
+  glActiveStencilFaceEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexSubImage1DEXT (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  glTexSubImage1DEXT = (PFNGLTEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage1DEXT");
+  glTexSubImage1DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage2DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8)
+{
+  glTexSubImage2DEXT = (PFNGLTEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage2DEXT");
+  glTexSubImage2DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage3DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTexSubImage3DEXT = (PFNGLTEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage3DEXT");
+  glTexSubImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPatchParameteriEXT (GLenum a0, GLint a1)
+{
+  glPatchParameteriEXT = (PFNGLPATCHPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glPatchParameteriEXT");
+  glPatchParameteriEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexImage3DEXT (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glTexImage3DEXT = (PFNGLTEXIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DEXT");
+  glTexImage3DEXT(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayerEXT (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  glFramebufferTextureLayerEXT = (PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayerEXT");
+  glFramebufferTextureLayerEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetSamplerParameterIivEXT = (PFNGLGETSAMPLERPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIivEXT");
+  glGetSamplerParameterIivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIuivEXT (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetSamplerParameterIuivEXT = (PFNGLGETSAMPLERPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIuivEXT");
+  glGetSamplerParameterIuivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIivEXT (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glSamplerParameterIivEXT = (PFNGLSAMPLERPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIivEXT");
+  glSamplerParameterIivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIuivEXT (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  glSamplerParameterIuivEXT = (PFNGLSAMPLERPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIuivEXT");
+  glSamplerParameterIuivEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferEXT (GLenum a0, GLenum a1, GLuint a2)
+{
+  glTexBufferEXT = (PFNGLTEXBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glTexBufferEXT");
+  glTexBufferEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearColorIiEXT (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  glClearColorIiEXT = (PFNGLCLEARCOLORIIEXTPROC)glewGetProcAddress((const GLubyte*)"glClearColorIiEXT");
+  glClearColorIiEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glClearColorIuiEXT (GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  glClearColorIuiEXT = (PFNGLCLEARCOLORIUIEXTPROC)glewGetProcAddress((const GLubyte*)"glClearColorIuiEXT");
+  glClearColorIuiEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIivEXT (GLenum a0, GLenum a1, GLint * a2)
+{
+  glGetTexParameterIivEXT = (PFNGLGETTEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIivEXT");
+  glGetTexParameterIivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIuivEXT (GLenum a0, GLenum a1, GLuint * a2)
+{
+  glGetTexParameterIuivEXT = (PFNGLGETTEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIuivEXT");
+  glGetTexParameterIuivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIivEXT (GLenum a0, GLenum a1, const GLint * a2)
+{
+  glTexParameterIivEXT = (PFNGLTEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIivEXT");
+  glTexParameterIivEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIuivEXT (GLenum a0, GLenum a1, const GLuint * a2)
+{
+  glTexParameterIuivEXT = (PFNGLTEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIuivEXT");
+  glTexParameterIuivEXT(a0, a1, a2);
+}
+
+
+
+static GLboolean GLAPIENTRY _glewLazy_glAreTexturesResidentEXT (GLsizei a0, const GLuint* a1, GLboolean* a2)
+{
+  glAreTexturesResidentEXT = (PFNGLARETEXTURESRESIDENTEXTPROC)glewGetProcAddress((const GLubyte*)"glAreTexturesResidentEXT");
+  return glAreTexturesResidentEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindTextureEXT (GLenum a0, GLuint a1)
+{
+  glBindTextureEXT = (PFNGLBINDTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glBindTextureEXT");
+  glBindTextureEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteTexturesEXT (GLsizei a0, const GLuint* a1)
+{
+  glDeleteTexturesEXT = (PFNGLDELETETEXTURESEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteTexturesEXT");
+  glDeleteTexturesEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenTexturesEXT (GLsizei a0, GLuint* a1)
+{
+  glGenTexturesEXT = (PFNGLGENTEXTURESEXTPROC)glewGetProcAddress((const GLubyte*)"glGenTexturesEXT");
+  glGenTexturesEXT(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTextureEXT (GLuint a0)
+{
+  glIsTextureEXT = (PFNGLISTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glIsTextureEXT");
+  return glIsTextureEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPrioritizeTexturesEXT (GLsizei a0, const GLuint* a1, const GLclampf* a2)
+{
+  glPrioritizeTexturesEXT = (PFNGLPRIORITIZETEXTURESEXTPROC)glewGetProcAddress((const GLubyte*)"glPrioritizeTexturesEXT");
+  glPrioritizeTexturesEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureNormalEXT (GLenum a0)
+{
+  glTextureNormalEXT = (PFNGLTEXTURENORMALEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureNormalEXT");
+  glTextureNormalEXT(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexStorage1DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3)
+{
+  glTexStorage1DEXT = (PFNGLTEXSTORAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorage1DEXT");
+  glTexStorage1DEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage2DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glTexStorage2DEXT = (PFNGLTEXSTORAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorage2DEXT");
+  glTexStorage2DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage3DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+{
+  glTexStorage3DEXT = (PFNGLTEXSTORAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexStorage3DEXT");
+  glTexStorage3DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage1DEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4)
+{
+  glTextureStorage1DEXT = (PFNGLTEXTURESTORAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage1DEXT");
+  glTextureStorage1DEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2DEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  glTextureStorage2DEXT = (PFNGLTEXTURESTORAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2DEXT");
+  glTextureStorage2DEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3DEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6)
+{
+  glTextureStorage3DEXT = (PFNGLTEXTURESTORAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3DEXT");
+  glTextureStorage3DEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureViewEXT (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+{
+  glTextureViewEXT = (PFNGLTEXTUREVIEWEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureViewEXT");
+  glTextureViewEXT(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjecti64vEXT (GLuint a0, GLenum a1, GLint64EXT * a2)
+{
+  glGetQueryObjecti64vEXT = (PFNGLGETQUERYOBJECTI64VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjecti64vEXT");
+  glGetQueryObjecti64vEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectui64vEXT (GLuint a0, GLenum a1, GLuint64EXT * a2)
+{
+  glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectui64vEXT");
+  glGetQueryObjectui64vEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginTransformFeedbackEXT (GLenum a0)
+{
+  glBeginTransformFeedbackEXT = (PFNGLBEGINTRANSFORMFEEDBACKEXTPROC)glewGetProcAddress((const GLubyte*)"glBeginTransformFeedbackEXT");
+  glBeginTransformFeedbackEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferBaseEXT (GLenum a0, GLuint a1, GLuint a2)
+{
+  glBindBufferBaseEXT = (PFNGLBINDBUFFERBASEEXTPROC)glewGetProcAddress((const GLubyte*)"glBindBufferBaseEXT");
+  glBindBufferBaseEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferOffsetEXT (GLenum a0, GLuint a1, GLuint a2, GLintptr a3)
+{
+  glBindBufferOffsetEXT = (PFNGLBINDBUFFEROFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glBindBufferOffsetEXT");
+  glBindBufferOffsetEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferRangeEXT (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glBindBufferRangeEXT = (PFNGLBINDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glBindBufferRangeEXT");
+  glBindBufferRangeEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glEndTransformFeedbackEXT (void)
+{
+  glEndTransformFeedbackEXT = (PFNGLENDTRANSFORMFEEDBACKEXTPROC)glewGetProcAddress((const GLubyte*)"glEndTransformFeedbackEXT");
+  glEndTransformFeedbackEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackVaryingEXT (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLsizei * a4, GLenum * a5, GLchar * a6)
+{
+  glGetTransformFeedbackVaryingEXT = (PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackVaryingEXT");
+  glGetTransformFeedbackVaryingEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackVaryingsEXT (GLuint a0, GLsizei a1, const GLchar * const* a2, GLenum a3)
+{
+  glTransformFeedbackVaryingsEXT = (PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackVaryingsEXT");
+  glTransformFeedbackVaryingsEXT(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glArrayElementEXT (GLint a0)
+{
+  glArrayElementEXT = (PFNGLARRAYELEMENTEXTPROC)glewGetProcAddress((const GLubyte*)"glArrayElementEXT");
+  glArrayElementEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glColorPointerEXT (GLint a0, GLenum a1, GLsizei a2, GLsizei a3, const void * a4)
+{
+  glColorPointerEXT = (PFNGLCOLORPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glColorPointerEXT");
+  glColorPointerEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawArraysEXT (GLenum a0, GLint a1, GLsizei a2)
+{
+  glDrawArraysEXT = (PFNGLDRAWARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysEXT");
+  glDrawArraysEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glEdgeFlagPointerEXT (GLsizei a0, GLsizei a1, const GLboolean* a2)
+{
+  glEdgeFlagPointerEXT = (PFNGLEDGEFLAGPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glEdgeFlagPointerEXT");
+  glEdgeFlagPointerEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glIndexPointerEXT (GLenum a0, GLsizei a1, GLsizei a2, const void * a3)
+{
+  glIndexPointerEXT = (PFNGLINDEXPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glIndexPointerEXT");
+  glIndexPointerEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalPointerEXT (GLenum a0, GLsizei a1, GLsizei a2, const void * a3)
+{
+  glNormalPointerEXT = (PFNGLNORMALPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glNormalPointerEXT");
+  glNormalPointerEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordPointerEXT (GLint a0, GLenum a1, GLsizei a2, GLsizei a3, const void * a4)
+{
+  glTexCoordPointerEXT = (PFNGLTEXCOORDPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glTexCoordPointerEXT");
+  glTexCoordPointerEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexPointerEXT (GLint a0, GLenum a1, GLsizei a2, GLsizei a3, const void * a4)
+{
+  glVertexPointerEXT = (PFNGLVERTEXPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexPointerEXT");
+  glVertexPointerEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindArraySetEXT (const void * a0)
+{
+  glBindArraySetEXT = (PFNGLBINDARRAYSETEXTPROC)glewGetProcAddress((const GLubyte*)"glBindArraySetEXT");
+  glBindArraySetEXT(a0);
+}
+
+static const void * GLAPIENTRY _glewLazy_glCreateArraySetExt (void)
+{
+  glCreateArraySetExt = (PFNGLCREATEARRAYSETEXTPROC)glewGetProcAddress((const GLubyte*)"glCreateArraySetExt");
+  return glCreateArraySetExt();
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteArraySetsEXT (GLsizei a0, const void * a1[])
+{
+  glDeleteArraySetsEXT = (PFNGLDELETEARRAYSETSEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteArraySetsEXT");
+  glDeleteArraySetsEXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLdvEXT (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  glGetVertexAttribLdvEXT = (PFNGLGETVERTEXATTRIBLDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLdvEXT");
+  glGetVertexAttribLdvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribLOffsetEXT (GLuint a0, GLuint a1, GLuint a2, GLint a3, GLenum a4, GLsizei a5, GLintptr a6)
+{
+  glVertexArrayVertexAttribLOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribLOffsetEXT");
+  glVertexArrayVertexAttribLOffsetEXT(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1dEXT (GLuint a0, GLdouble a1)
+{
+  glVertexAttribL1dEXT = (PFNGLVERTEXATTRIBL1DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1dEXT");
+  glVertexAttribL1dEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1dvEXT (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL1dvEXT = (PFNGLVERTEXATTRIBL1DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1dvEXT");
+  glVertexAttribL1dvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2dEXT (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  glVertexAttribL2dEXT = (PFNGLVERTEXATTRIBL2DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2dEXT");
+  glVertexAttribL2dEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2dvEXT (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL2dvEXT = (PFNGLVERTEXATTRIBL2DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2dvEXT");
+  glVertexAttribL2dvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3dEXT (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glVertexAttribL3dEXT = (PFNGLVERTEXATTRIBL3DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3dEXT");
+  glVertexAttribL3dEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3dvEXT (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL3dvEXT = (PFNGLVERTEXATTRIBL3DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3dvEXT");
+  glVertexAttribL3dvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4dEXT (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glVertexAttribL4dEXT = (PFNGLVERTEXATTRIBL4DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4dEXT");
+  glVertexAttribL4dEXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4dvEXT (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttribL4dvEXT = (PFNGLVERTEXATTRIBL4DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4dvEXT");
+  glVertexAttribL4dvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLPointerEXT (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  glVertexAttribLPointerEXT = (PFNGLVERTEXATTRIBLPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLPointerEXT");
+  glVertexAttribLPointerEXT(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginVertexShaderEXT (void)
+{
+  glBeginVertexShaderEXT = (PFNGLBEGINVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glBeginVertexShaderEXT");
+  glBeginVertexShaderEXT();
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindLightParameterEXT (GLenum a0, GLenum a1)
+{
+  glBindLightParameterEXT = (PFNGLBINDLIGHTPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindLightParameterEXT");
+  return glBindLightParameterEXT(a0, a1);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindMaterialParameterEXT (GLenum a0, GLenum a1)
+{
+  glBindMaterialParameterEXT = (PFNGLBINDMATERIALPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindMaterialParameterEXT");
+  return glBindMaterialParameterEXT(a0, a1);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindParameterEXT (GLenum a0)
+{
+  glBindParameterEXT = (PFNGLBINDPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindParameterEXT");
+  return glBindParameterEXT(a0);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindTexGenParameterEXT (GLenum a0, GLenum a1, GLenum a2)
+{
+  glBindTexGenParameterEXT = (PFNGLBINDTEXGENPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindTexGenParameterEXT");
+  return glBindTexGenParameterEXT(a0, a1, a2);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindTextureUnitParameterEXT (GLenum a0, GLenum a1)
+{
+  glBindTextureUnitParameterEXT = (PFNGLBINDTEXTUREUNITPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindTextureUnitParameterEXT");
+  return glBindTextureUnitParameterEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVertexShaderEXT (GLuint a0)
+{
+  glBindVertexShaderEXT = (PFNGLBINDVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindVertexShaderEXT");
+  glBindVertexShaderEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexShaderEXT (GLuint a0)
+{
+  glDeleteVertexShaderEXT = (PFNGLDELETEVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexShaderEXT");
+  glDeleteVertexShaderEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVariantClientStateEXT (GLuint a0)
+{
+  glDisableVariantClientStateEXT = (PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableVariantClientStateEXT");
+  glDisableVariantClientStateEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVariantClientStateEXT (GLuint a0)
+{
+  glEnableVariantClientStateEXT = (PFNGLENABLEVARIANTCLIENTSTATEEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableVariantClientStateEXT");
+  glEnableVariantClientStateEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEndVertexShaderEXT (void)
+{
+  glEndVertexShaderEXT = (PFNGLENDVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glEndVertexShaderEXT");
+  glEndVertexShaderEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glExtractComponentEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glExtractComponentEXT = (PFNGLEXTRACTCOMPONENTEXTPROC)glewGetProcAddress((const GLubyte*)"glExtractComponentEXT");
+  glExtractComponentEXT(a0, a1, a2);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenSymbolsEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glGenSymbolsEXT = (PFNGLGENSYMBOLSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenSymbolsEXT");
+  return glGenSymbolsEXT(a0, a1, a2, a3);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenVertexShadersEXT (GLuint a0)
+{
+  glGenVertexShadersEXT = (PFNGLGENVERTEXSHADERSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenVertexShadersEXT");
+  return glGenVertexShadersEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInvariantBooleanvEXT (GLuint a0, GLenum a1, GLboolean * a2)
+{
+  glGetInvariantBooleanvEXT = (PFNGLGETINVARIANTBOOLEANVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInvariantBooleanvEXT");
+  glGetInvariantBooleanvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInvariantFloatvEXT (GLuint a0, GLenum a1, GLfloat * a2)
+{
+  glGetInvariantFloatvEXT = (PFNGLGETINVARIANTFLOATVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInvariantFloatvEXT");
+  glGetInvariantFloatvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInvariantIntegervEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  glGetInvariantIntegervEXT = (PFNGLGETINVARIANTINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInvariantIntegervEXT");
+  glGetInvariantIntegervEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLocalConstantBooleanvEXT (GLuint a0, GLenum a1, GLboolean * a2)
+{
+  glGetLocalConstantBooleanvEXT = (PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetLocalConstantBooleanvEXT");
+  glGetLocalConstantBooleanvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLocalConstantFloatvEXT (GLuint a0, GLenum a1, GLfloat * a2)
+{
+  glGetLocalConstantFloatvEXT = (PFNGLGETLOCALCONSTANTFLOATVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetLocalConstantFloatvEXT");
+  glGetLocalConstantFloatvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLocalConstantIntegervEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  glGetLocalConstantIntegervEXT = (PFNGLGETLOCALCONSTANTINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetLocalConstantIntegervEXT");
+  glGetLocalConstantIntegervEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantBooleanvEXT (GLuint a0, GLenum a1, GLboolean * a2)
+{
+  glGetVariantBooleanvEXT = (PFNGLGETVARIANTBOOLEANVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantBooleanvEXT");
+  glGetVariantBooleanvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantFloatvEXT (GLuint a0, GLenum a1, GLfloat * a2)
+{
+  glGetVariantFloatvEXT = (PFNGLGETVARIANTFLOATVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantFloatvEXT");
+  glGetVariantFloatvEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantIntegervEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  glGetVariantIntegervEXT = (PFNGLGETVARIANTINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantIntegervEXT");
+  glGetVariantIntegervEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantPointervEXT (GLuint a0, GLenum a1, void ** a2)
+{
+  glGetVariantPointervEXT = (PFNGLGETVARIANTPOINTERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantPointervEXT");
+  glGetVariantPointervEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glInsertComponentEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  glInsertComponentEXT = (PFNGLINSERTCOMPONENTEXTPROC)glewGetProcAddress((const GLubyte*)"glInsertComponentEXT");
+  glInsertComponentEXT(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVariantEnabledEXT (GLuint a0, GLenum a1)
+{
+  glIsVariantEnabledEXT = (PFNGLISVARIANTENABLEDEXTPROC)glewGetProcAddress((const GLubyte*)"glIsVariantEnabledEXT");
+  return glIsVariantEnabledEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSetInvariantEXT (GLuint a0, GLenum a1, void * a2)
+{
+  glSetInvariantEXT = (PFNGLSETINVARIANTEXTPROC)glewGetProcAddress((const GLubyte*)"glSetInvariantEXT");
+  glSetInvariantEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSetLocalConstantEXT (GLuint a0, GLenum a1, void * a2)
+{
+  glSetLocalConstantEXT = (PFNGLSETLOCALCONSTANTEXTPROC)glewGetProcAddress((const GLubyte*)"glSetLocalConstantEXT");
+  glSetLocalConstantEXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderOp1EXT (GLenum a0, GLuint a1, GLuint a2)
+{
+  glShaderOp1EXT = (PFNGLSHADEROP1EXTPROC)glewGetProcAddress((const GLubyte*)"glShaderOp1EXT");
+  glShaderOp1EXT(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderOp2EXT (GLenum a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  glShaderOp2EXT = (PFNGLSHADEROP2EXTPROC)glewGetProcAddress((const GLubyte*)"glShaderOp2EXT");
+  glShaderOp2EXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderOp3EXT (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  glShaderOp3EXT = (PFNGLSHADEROP3EXTPROC)glewGetProcAddress((const GLubyte*)"glShaderOp3EXT");
+  glShaderOp3EXT(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glSwizzleEXT (GLuint a0, GLuint a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5)
+{
+  glSwizzleEXT = (PFNGLSWIZZLEEXTPROC)glewGetProcAddress((const GLubyte*)"glSwizzleEXT");
+  glSwizzleEXT(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantPointerEXT (GLuint a0, GLenum a1, GLuint a2, void * a3)
+{
+  glVariantPointerEXT = (PFNGLVARIANTPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVariantPointerEXT");
+  glVariantPointerEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantbvEXT (GLuint a0, GLbyte * a1)
+{
+  glVariantbvEXT = (PFNGLVARIANTBVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantbvEXT");
+  glVariantbvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantdvEXT (GLuint a0, GLdouble * a1)
+{
+  glVariantdvEXT = (PFNGLVARIANTDVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantdvEXT");
+  glVariantdvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantfvEXT (GLuint a0, GLfloat * a1)
+{
+  glVariantfvEXT = (PFNGLVARIANTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantfvEXT");
+  glVariantfvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantivEXT (GLuint a0, GLint * a1)
+{
+  glVariantivEXT = (PFNGLVARIANTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantivEXT");
+  glVariantivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantsvEXT (GLuint a0, GLshort * a1)
+{
+  glVariantsvEXT = (PFNGLVARIANTSVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantsvEXT");
+  glVariantsvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantubvEXT (GLuint a0, GLubyte * a1)
+{
+  glVariantubvEXT = (PFNGLVARIANTUBVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantubvEXT");
+  glVariantubvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantuivEXT (GLuint a0, GLuint * a1)
+{
+  glVariantuivEXT = (PFNGLVARIANTUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantuivEXT");
+  glVariantuivEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantusvEXT (GLuint a0, GLushort * a1)
+{
+  glVariantusvEXT = (PFNGLVARIANTUSVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantusvEXT");
+  glVariantusvEXT(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWriteMaskEXT (GLuint a0, GLuint a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5)
+{
+  glWriteMaskEXT = (PFNGLWRITEMASKEXTPROC)glewGetProcAddress((const GLubyte*)"glWriteMaskEXT");
+  glWriteMaskEXT(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVertexWeightPointerEXT (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  glVertexWeightPointerEXT = (PFNGLVERTEXWEIGHTPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexWeightPointerEXT");
+  glVertexWeightPointerEXT(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeightfEXT (GLfloat a0)
+{
+  glVertexWeightfEXT = (PFNGLVERTEXWEIGHTFEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexWeightfEXT");
+  glVertexWeightfEXT(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeightfvEXT (GLfloat* a0)
+{
+  glVertexWeightfvEXT = (PFNGLVERTEXWEIGHTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexWeightfvEXT");
+  glVertexWeightfvEXT(a0);
+}
+
+
+
+static GLboolean GLAPIENTRY _glewLazy_glAcquireKeyedMutexWin32EXT (GLuint a0, GLuint64 a1, GLuint a2)
+{
+  glAcquireKeyedMutexWin32EXT = (PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)glewGetProcAddress((const GLubyte*)"glAcquireKeyedMutexWin32EXT");
+  return glAcquireKeyedMutexWin32EXT(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glReleaseKeyedMutexWin32EXT (GLuint a0, GLuint64 a1)
+{
+  glReleaseKeyedMutexWin32EXT = (PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)glewGetProcAddress((const GLubyte*)"glReleaseKeyedMutexWin32EXT");
+  return glReleaseKeyedMutexWin32EXT(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glWindowRectanglesEXT (GLenum a0, GLsizei a1, const GLint a2[])
+{
+  glWindowRectanglesEXT = (PFNGLWINDOWRECTANGLESEXTPROC)glewGetProcAddress((const GLubyte*)"glWindowRectanglesEXT");
+  glWindowRectanglesEXT(a0, a1, a2);
+}
+
+
+
+static GLsync GLAPIENTRY _glewLazy_glImportSyncEXT (GLenum a0, GLintptr a1, GLbitfield a2)
+{
+  glImportSyncEXT = (PFNGLIMPORTSYNCEXTPROC)glewGetProcAddress((const GLubyte*)"glImportSyncEXT");
+  return glImportSyncEXT(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFrameTerminatorGREMEDY (void)
+{
+  glFrameTerminatorGREMEDY = (PFNGLFRAMETERMINATORGREMEDYPROC)glewGetProcAddress((const GLubyte*)"glFrameTerminatorGREMEDY");
+  glFrameTerminatorGREMEDY();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glStringMarkerGREMEDY (GLsizei a0, const void * a1)
+{
+  glStringMarkerGREMEDY = (PFNGLSTRINGMARKERGREMEDYPROC)glewGetProcAddress((const GLubyte*)"glStringMarkerGREMEDY");
+  glStringMarkerGREMEDY(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetImageTransformParameterfvHP (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glGetImageTransformParameterfvHP = (PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)glewGetProcAddress((const GLubyte*)"glGetImageTransformParameterfvHP");
+  glGetImageTransformParameterfvHP(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetImageTransformParameterivHP (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glGetImageTransformParameterivHP = (PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)glewGetProcAddress((const GLubyte*)"glGetImageTransformParameterivHP");
+  glGetImageTransformParameterivHP(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameterfHP (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  glImageTransformParameterfHP = (PFNGLIMAGETRANSFORMPARAMETERFHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameterfHP");
+  glImageTransformParameterfHP(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameterfvHP (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glImageTransformParameterfvHP = (PFNGLIMAGETRANSFORMPARAMETERFVHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameterfvHP");
+  glImageTransformParameterfvHP(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameteriHP (GLenum a0, GLenum a1, const GLint a2)
+{
+  glImageTransformParameteriHP = (PFNGLIMAGETRANSFORMPARAMETERIHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameteriHP");
+  glImageTransformParameteriHP(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameterivHP (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glImageTransformParameterivHP = (PFNGLIMAGETRANSFORMPARAMETERIVHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameterivHP");
+  glImageTransformParameterivHP(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiModeDrawArraysIBM (const GLenum* a0, const GLint * a1, const GLsizei * a2, GLsizei a3, GLint a4)
+{
+  glMultiModeDrawArraysIBM = (PFNGLMULTIMODEDRAWARRAYSIBMPROC)glewGetProcAddress((const GLubyte*)"glMultiModeDrawArraysIBM");
+  glMultiModeDrawArraysIBM(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiModeDrawElementsIBM (const GLenum* a0, const GLsizei * a1, GLenum a2, const void *const * a3, GLsizei a4, GLint a5)
+{
+  glMultiModeDrawElementsIBM = (PFNGLMULTIMODEDRAWELEMENTSIBMPROC)glewGetProcAddress((const GLubyte*)"glMultiModeDrawElementsIBM");
+  glMultiModeDrawElementsIBM(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  glColorPointerListIBM = (PFNGLCOLORPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glColorPointerListIBM");
+  glColorPointerListIBM(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glEdgeFlagPointerListIBM (GLint a0, const GLboolean ** a1, GLint a2)
+{
+  glEdgeFlagPointerListIBM = (PFNGLEDGEFLAGPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glEdgeFlagPointerListIBM");
+  glEdgeFlagPointerListIBM(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordPointerListIBM (GLenum a0, GLint a1, const void** a2, GLint a3)
+{
+  glFogCoordPointerListIBM = (PFNGLFOGCOORDPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glFogCoordPointerListIBM");
+  glFogCoordPointerListIBM(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glIndexPointerListIBM (GLenum a0, GLint a1, const void** a2, GLint a3)
+{
+  glIndexPointerListIBM = (PFNGLINDEXPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glIndexPointerListIBM");
+  glIndexPointerListIBM(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalPointerListIBM (GLenum a0, GLint a1, const void** a2, GLint a3)
+{
+  glNormalPointerListIBM = (PFNGLNORMALPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glNormalPointerListIBM");
+  glNormalPointerListIBM(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  glSecondaryColorPointerListIBM = (PFNGLSECONDARYCOLORPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorPointerListIBM");
+  glSecondaryColorPointerListIBM(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  glTexCoordPointerListIBM = (PFNGLTEXCOORDPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glTexCoordPointerListIBM");
+  glTexCoordPointerListIBM(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  glVertexPointerListIBM = (PFNGLVERTEXPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glVertexPointerListIBM");
+  glVertexPointerListIBM(a0, a1, a2, a3, a4);
+}
+
+
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureHandleIMG (GLuint a0)
+{
+  glGetTextureHandleIMG = (PFNGLGETTEXTUREHANDLEIMGPROC)glewGetProcAddress((const GLubyte*)"glGetTextureHandleIMG");
+  return glGetTextureHandleIMG(a0);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureSamplerHandleIMG (GLuint a0, GLuint a1)
+{
+  glGetTextureSamplerHandleIMG = (PFNGLGETTEXTURESAMPLERHANDLEIMGPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSamplerHandleIMG");
+  return glGetTextureSamplerHandleIMG(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64IMG (GLuint a0, GLint a1, GLuint64 a2)
+{
+  glProgramUniformHandleui64IMG = (PFNGLPROGRAMUNIFORMHANDLEUI64IMGPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64IMG");
+  glProgramUniformHandleui64IMG(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64vIMG (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniformHandleui64vIMG = (PFNGLPROGRAMUNIFORMHANDLEUI64VIMGPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64vIMG");
+  glProgramUniformHandleui64vIMG(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64IMG (GLint a0, GLuint64 a1)
+{
+  glUniformHandleui64IMG = (PFNGLUNIFORMHANDLEUI64IMGPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64IMG");
+  glUniformHandleui64IMG(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64vIMG (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniformHandleui64vIMG = (PFNGLUNIFORMHANDLEUI64VIMGPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64vIMG");
+  glUniformHandleui64vIMG(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2DDownsampleIMG (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5, GLint a6)
+{
+  glFramebufferTexture2DDownsampleIMG = (PFNGLFRAMEBUFFERTEXTURE2DDOWNSAMPLEIMGPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2DDownsampleIMG");
+  glFramebufferTexture2DDownsampleIMG(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayerDownsampleIMG (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLint a5, GLint a6)
+{
+  glFramebufferTextureLayerDownsampleIMG = (PFNGLFRAMEBUFFERTEXTURELAYERDOWNSAMPLEIMGPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayerDownsampleIMG");
+  glFramebufferTextureLayerDownsampleIMG(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2DMultisampleIMG (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLsizei a5)
+{
+  glFramebufferTexture2DMultisampleIMG = (PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEIMGPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2DMultisampleIMG");
+  glFramebufferTexture2DMultisampleIMG(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleIMG (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glRenderbufferStorageMultisampleIMG = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEIMGPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleIMG");
+  glRenderbufferStorageMultisampleIMG(a0, a1, a2, a3, a4);
+}
+
+
+
+static void * GLAPIENTRY _glewLazy_glMapTexture2DINTEL (GLuint a0, GLint a1, GLbitfield a2, GLint* a3, GLenum * a4)
+{
+  glMapTexture2DINTEL = (PFNGLMAPTEXTURE2DINTELPROC)glewGetProcAddress((const GLubyte*)"glMapTexture2DINTEL");
+  return glMapTexture2DINTEL(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glSyncTextureINTEL (GLuint a0)
+{
+  glSyncTextureINTEL = (PFNGLSYNCTEXTUREINTELPROC)glewGetProcAddress((const GLubyte*)"glSyncTextureINTEL");
+  glSyncTextureINTEL(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glUnmapTexture2DINTEL (GLuint a0, GLint a1)
+{
+  glUnmapTexture2DINTEL = (PFNGLUNMAPTEXTURE2DINTELPROC)glewGetProcAddress((const GLubyte*)"glUnmapTexture2DINTEL");
+  glUnmapTexture2DINTEL(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorPointervINTEL (GLint a0, GLenum a1, const void** a2)
+{
+  glColorPointervINTEL = (PFNGLCOLORPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glColorPointervINTEL");
+  glColorPointervINTEL(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalPointervINTEL (GLenum a0, const void** a1)
+{
+  glNormalPointervINTEL = (PFNGLNORMALPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glNormalPointervINTEL");
+  glNormalPointervINTEL(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordPointervINTEL (GLint a0, GLenum a1, const void** a2)
+{
+  glTexCoordPointervINTEL = (PFNGLTEXCOORDPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glTexCoordPointervINTEL");
+  glTexCoordPointervINTEL(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexPointervINTEL (GLint a0, GLenum a1, const void** a2)
+{
+  glVertexPointervINTEL = (PFNGLVERTEXPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glVertexPointervINTEL");
+  glVertexPointervINTEL(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginPerfQueryINTEL (GLuint a0)
+{
+  glBeginPerfQueryINTEL = (PFNGLBEGINPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glBeginPerfQueryINTEL");
+  glBeginPerfQueryINTEL(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glCreatePerfQueryINTEL (GLuint a0, GLuint* a1)
+{
+  glCreatePerfQueryINTEL = (PFNGLCREATEPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glCreatePerfQueryINTEL");
+  glCreatePerfQueryINTEL(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeletePerfQueryINTEL (GLuint a0)
+{
+  glDeletePerfQueryINTEL = (PFNGLDELETEPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glDeletePerfQueryINTEL");
+  glDeletePerfQueryINTEL(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEndPerfQueryINTEL (GLuint a0)
+{
+  glEndPerfQueryINTEL = (PFNGLENDPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glEndPerfQueryINTEL");
+  glEndPerfQueryINTEL(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFirstPerfQueryIdINTEL (GLuint* a0)
+{
+  glGetFirstPerfQueryIdINTEL = (PFNGLGETFIRSTPERFQUERYIDINTELPROC)glewGetProcAddress((const GLubyte*)"glGetFirstPerfQueryIdINTEL");
+  glGetFirstPerfQueryIdINTEL(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNextPerfQueryIdINTEL (GLuint a0, GLuint* a1)
+{
+  glGetNextPerfQueryIdINTEL = (PFNGLGETNEXTPERFQUERYIDINTELPROC)glewGetProcAddress((const GLubyte*)"glGetNextPerfQueryIdINTEL");
+  glGetNextPerfQueryIdINTEL(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfCounterInfoINTEL (GLuint a0, GLuint a1, GLuint a2, GLchar* a3, GLuint a4, GLchar * a5, GLuint * a6, GLuint * a7, GLuint * a8, GLuint * a9, GLuint64 * a10)
+{
+  glGetPerfCounterInfoINTEL = (PFNGLGETPERFCOUNTERINFOINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfCounterInfoINTEL");
+  glGetPerfCounterInfoINTEL(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfQueryDataINTEL (GLuint a0, GLuint a1, GLsizei a2, void * a3, GLuint * a4)
+{
+  glGetPerfQueryDataINTEL = (PFNGLGETPERFQUERYDATAINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfQueryDataINTEL");
+  glGetPerfQueryDataINTEL(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfQueryIdByNameINTEL (GLchar* a0, GLuint * a1)
+{
+  glGetPerfQueryIdByNameINTEL = (PFNGLGETPERFQUERYIDBYNAMEINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfQueryIdByNameINTEL");
+  glGetPerfQueryIdByNameINTEL(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfQueryInfoINTEL (GLuint a0, GLuint a1, GLchar* a2, GLuint * a3, GLuint * a4, GLuint * a5, GLuint * a6)
+{
+  glGetPerfQueryInfoINTEL = (PFNGLGETPERFQUERYINFOINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfQueryInfoINTEL");
+  glGetPerfQueryInfoINTEL(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexScissorFuncINTEL (GLenum a0, GLenum a1, GLenum a2)
+{
+  glTexScissorFuncINTEL = (PFNGLTEXSCISSORFUNCINTELPROC)glewGetProcAddress((const GLubyte*)"glTexScissorFuncINTEL");
+  glTexScissorFuncINTEL(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexScissorINTEL (GLenum a0, GLclampf a1, GLclampf a2)
+{
+  glTexScissorINTEL = (PFNGLTEXSCISSORINTELPROC)glewGetProcAddress((const GLubyte*)"glTexScissorINTEL");
+  glTexScissorINTEL(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendBarrierKHR (void)
+{
+  glBlendBarrierKHR = (PFNGLBLENDBARRIERKHRPROC)glewGetProcAddress((const GLubyte*)"glBlendBarrierKHR");
+  glBlendBarrierKHR();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDebugMessageCallback (GLDEBUGPROC a0, const void * a1)
+{
+  glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageCallback");
+  glDebugMessageCallback(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageControl (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint* a4, GLboolean a5)
+{
+  glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageControl");
+  glDebugMessageControl(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageInsert (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar* a5)
+{
+  glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageInsert");
+  glDebugMessageInsert(a0, a1, a2, a3, a4, a5);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetDebugMessageLog (GLuint a0, GLsizei a1, GLenum* a2, GLenum* a3, GLuint* a4, GLenum* a5, GLsizei* a6, GLchar* a7)
+{
+  glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)glewGetProcAddress((const GLubyte*)"glGetDebugMessageLog");
+  return glGetDebugMessageLog(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectLabel (GLenum a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar * a4)
+{
+  glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)glewGetProcAddress((const GLubyte*)"glGetObjectLabel");
+  glGetObjectLabel(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectPtrLabel (void* a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)glewGetProcAddress((const GLubyte*)"glGetObjectPtrLabel");
+  glGetObjectPtrLabel(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glObjectLabel (GLenum a0, GLuint a1, GLsizei a2, const GLchar* a3)
+{
+  glObjectLabel = (PFNGLOBJECTLABELPROC)glewGetProcAddress((const GLubyte*)"glObjectLabel");
+  glObjectLabel(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glObjectPtrLabel (void* a0, GLsizei a1, const GLchar* a2)
+{
+  glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)glewGetProcAddress((const GLubyte*)"glObjectPtrLabel");
+  glObjectPtrLabel(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPopDebugGroup (void)
+{
+  glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)glewGetProcAddress((const GLubyte*)"glPopDebugGroup");
+  glPopDebugGroup();
+}
+
+static void GLAPIENTRY _glewLazy_glPushDebugGroup (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3)
+{
+  glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)glewGetProcAddress((const GLubyte*)"glPushDebugGroup");
+  glPushDebugGroup(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMaxShaderCompilerThreadsKHR (GLuint a0)
+{
+  glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glewGetProcAddress((const GLubyte*)"glMaxShaderCompilerThreadsKHR");
+  glMaxShaderCompilerThreadsKHR(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetnUniformfv (GLuint a0, GLint a1, GLsizei a2, GLfloat* a3)
+{
+  glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformfv");
+  glGetnUniformfv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformiv (GLuint a0, GLint a1, GLsizei a2, GLint* a3)
+{
+  glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformiv");
+  glGetnUniformiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformuiv (GLuint a0, GLint a1, GLsizei a2, GLuint* a3)
+{
+  glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformuiv");
+  glGetnUniformuiv(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReadnPixels (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7)
+{
+  glReadnPixels = (PFNGLREADNPIXELSPROC)glewGetProcAddress((const GLubyte*)"glReadnPixels");
+  glReadnPixels(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static GLuint GLAPIENTRY _glewLazy_glBufferRegionEnabled (void)
+{
+  glBufferRegionEnabled = (PFNGLBUFFERREGIONENABLEDPROC)glewGetProcAddress((const GLubyte*)"glBufferRegionEnabled");
+  return glBufferRegionEnabled();
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteBufferRegion (GLenum a0)
+{
+  glDeleteBufferRegion = (PFNGLDELETEBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glDeleteBufferRegion");
+  glDeleteBufferRegion(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawBufferRegion (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLint a6)
+{
+  glDrawBufferRegion = (PFNGLDRAWBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glDrawBufferRegion");
+  glDrawBufferRegion(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glNewBufferRegion (GLenum a0)
+{
+  glNewBufferRegion = (PFNGLNEWBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glNewBufferRegion");
+  return glNewBufferRegion(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glReadBufferRegion (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+{
+  glReadBufferRegion = (PFNGLREADBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glReadBufferRegion");
+  glReadBufferRegion(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferParameteriMESA (GLenum a0, GLenum a1, GLint a2)
+{
+  glFramebufferParameteriMESA = (PFNGLFRAMEBUFFERPARAMETERIMESAPROC)glewGetProcAddress((const GLubyte*)"glFramebufferParameteriMESA");
+  glFramebufferParameteriMESA(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferParameterivMESA (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetFramebufferParameterivMESA = (PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferParameterivMESA");
+  glGetFramebufferParameterivMESA(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glResizeBuffersMESA (void)
+{
+  glResizeBuffersMESA = (PFNGLRESIZEBUFFERSMESAPROC)glewGetProcAddress((const GLubyte*)"glResizeBuffersMESA");
+  glResizeBuffersMESA();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dMESA (GLdouble a0, GLdouble a1)
+{
+  glWindowPos2dMESA = (PFNGLWINDOWPOS2DMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dMESA");
+  glWindowPos2dMESA(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dvMESA (const GLdouble* a0)
+{
+  glWindowPos2dvMESA = (PFNGLWINDOWPOS2DVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dvMESA");
+  glWindowPos2dvMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fMESA (GLfloat a0, GLfloat a1)
+{
+  glWindowPos2fMESA = (PFNGLWINDOWPOS2FMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fMESA");
+  glWindowPos2fMESA(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fvMESA (const GLfloat* a0)
+{
+  glWindowPos2fvMESA = (PFNGLWINDOWPOS2FVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fvMESA");
+  glWindowPos2fvMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2iMESA (GLint a0, GLint a1)
+{
+  glWindowPos2iMESA = (PFNGLWINDOWPOS2IMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2iMESA");
+  glWindowPos2iMESA(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2ivMESA (const GLint* a0)
+{
+  glWindowPos2ivMESA = (PFNGLWINDOWPOS2IVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2ivMESA");
+  glWindowPos2ivMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2sMESA (GLshort a0, GLshort a1)
+{
+  glWindowPos2sMESA = (PFNGLWINDOWPOS2SMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2sMESA");
+  glWindowPos2sMESA(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2svMESA (const GLshort* a0)
+{
+  glWindowPos2svMESA = (PFNGLWINDOWPOS2SVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2svMESA");
+  glWindowPos2svMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dMESA (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  glWindowPos3dMESA = (PFNGLWINDOWPOS3DMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dMESA");
+  glWindowPos3dMESA(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dvMESA (const GLdouble* a0)
+{
+  glWindowPos3dvMESA = (PFNGLWINDOWPOS3DVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dvMESA");
+  glWindowPos3dvMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fMESA (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  glWindowPos3fMESA = (PFNGLWINDOWPOS3FMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fMESA");
+  glWindowPos3fMESA(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fvMESA (const GLfloat* a0)
+{
+  glWindowPos3fvMESA = (PFNGLWINDOWPOS3FVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fvMESA");
+  glWindowPos3fvMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3iMESA (GLint a0, GLint a1, GLint a2)
+{
+  glWindowPos3iMESA = (PFNGLWINDOWPOS3IMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3iMESA");
+  glWindowPos3iMESA(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3ivMESA (const GLint* a0)
+{
+  glWindowPos3ivMESA = (PFNGLWINDOWPOS3IVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3ivMESA");
+  glWindowPos3ivMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3sMESA (GLshort a0, GLshort a1, GLshort a2)
+{
+  glWindowPos3sMESA = (PFNGLWINDOWPOS3SMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3sMESA");
+  glWindowPos3sMESA(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3svMESA (const GLshort* a0)
+{
+  glWindowPos3svMESA = (PFNGLWINDOWPOS3SVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3svMESA");
+  glWindowPos3svMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4dMESA (GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glWindowPos4dMESA = (PFNGLWINDOWPOS4DMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4dMESA");
+  glWindowPos4dMESA(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4dvMESA (const GLdouble* a0)
+{
+  glWindowPos4dvMESA = (PFNGLWINDOWPOS4DVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4dvMESA");
+  glWindowPos4dvMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4fMESA (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glWindowPos4fMESA = (PFNGLWINDOWPOS4FMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4fMESA");
+  glWindowPos4fMESA(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4fvMESA (const GLfloat* a0)
+{
+  glWindowPos4fvMESA = (PFNGLWINDOWPOS4FVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4fvMESA");
+  glWindowPos4fvMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4iMESA (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  glWindowPos4iMESA = (PFNGLWINDOWPOS4IMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4iMESA");
+  glWindowPos4iMESA(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4ivMESA (const GLint* a0)
+{
+  glWindowPos4ivMESA = (PFNGLWINDOWPOS4IVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4ivMESA");
+  glWindowPos4ivMESA(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4sMESA (GLshort a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glWindowPos4sMESA = (PFNGLWINDOWPOS4SMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4sMESA");
+  glWindowPos4sMESA(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4svMESA (const GLshort* a0)
+{
+  glWindowPos4svMESA = (PFNGLWINDOWPOS4SVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4svMESA");
+  glWindowPos4svMESA(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginConditionalRenderNVX (GLuint a0)
+{
+  glBeginConditionalRenderNVX = (PFNGLBEGINCONDITIONALRENDERNVXPROC)glewGetProcAddress((const GLubyte*)"glBeginConditionalRenderNVX");
+  glBeginConditionalRenderNVX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEndConditionalRenderNVX (void)
+{
+  glEndConditionalRenderNVX = (PFNGLENDCONDITIONALRENDERNVXPROC)glewGetProcAddress((const GLubyte*)"glEndConditionalRenderNVX");
+  glEndConditionalRenderNVX();
+}
+
+
+
+static GLsync GLAPIENTRY _glewLazy_glAsyncCopyBufferSubDataNVX (GLsizei a0, const GLuint* a1, const GLuint64 * a2, GLuint a3, GLbitfield a4, GLuint a5, GLuint a6, GLintptr a7, GLintptr a8, GLsizeiptr a9, GLsizei a10, const GLuint * a11, const GLuint64 * a12)
+{
+  glAsyncCopyBufferSubDataNVX = (PFNGLASYNCCOPYBUFFERSUBDATANVXPROC)glewGetProcAddress((const GLubyte*)"glAsyncCopyBufferSubDataNVX");
+  return glAsyncCopyBufferSubDataNVX(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glAsyncCopyImageSubDataNVX (GLsizei a0, const GLuint* a1, const GLuint64 * a2, GLuint a3, GLbitfield a4, GLuint a5, GLenum a6, GLint a7, GLint a8, GLint a9, GLint a10, GLuint a11, GLenum a12, GLint a13, GLint a14, GLint a15, GLint a16, GLsizei a17, GLsizei a18, GLsizei a19, GLsizei a20, const GLuint * a21, const GLuint64 * a22)
+{
+  glAsyncCopyImageSubDataNVX = (PFNGLASYNCCOPYIMAGESUBDATANVXPROC)glewGetProcAddress((const GLubyte*)"glAsyncCopyImageSubDataNVX");
+  return glAsyncCopyImageSubDataNVX(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastScissorArrayvNVX (GLuint a0, GLuint a1, GLsizei a2, const GLint* a3)
+{
+  glMulticastScissorArrayvNVX = (PFNGLMULTICASTSCISSORARRAYVNVXPROC)glewGetProcAddress((const GLubyte*)"glMulticastScissorArrayvNVX");
+  glMulticastScissorArrayvNVX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastViewportArrayvNVX (GLuint a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glMulticastViewportArrayvNVX = (PFNGLMULTICASTVIEWPORTARRAYVNVXPROC)glewGetProcAddress((const GLubyte*)"glMulticastViewportArrayvNVX");
+  glMulticastViewportArrayvNVX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastViewportPositionWScaleNVX (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3)
+{
+  glMulticastViewportPositionWScaleNVX = (PFNGLMULTICASTVIEWPORTPOSITIONWSCALENVXPROC)glewGetProcAddress((const GLubyte*)"glMulticastViewportPositionWScaleNVX");
+  glMulticastViewportPositionWScaleNVX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUploadGpuMaskNVX (GLbitfield a0)
+{
+  glUploadGpuMaskNVX = (PFNGLUPLOADGPUMASKNVXPROC)glewGetProcAddress((const GLubyte*)"glUploadGpuMaskNVX");
+  glUploadGpuMaskNVX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glLGPUCopyImageSubDataNVX (GLuint a0, GLbitfield a1, GLuint a2, GLenum a3, GLint a4, GLint a5, GLint a6, GLint a7, GLuint a8, GLenum a9, GLint a10, GLint a11, GLint a12, GLint a13, GLsizei a14, GLsizei a15, GLsizei a16)
+{
+  glLGPUCopyImageSubDataNVX = (PFNGLLGPUCOPYIMAGESUBDATANVXPROC)glewGetProcAddress((const GLubyte*)"glLGPUCopyImageSubDataNVX");
+  glLGPUCopyImageSubDataNVX(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16);
+}
+
+static void GLAPIENTRY _glewLazy_glLGPUInterlockNVX (void)
+{
+  glLGPUInterlockNVX = (PFNGLLGPUINTERLOCKNVXPROC)glewGetProcAddress((const GLubyte*)"glLGPUInterlockNVX");
+  glLGPUInterlockNVX();
+}
+
+static void GLAPIENTRY _glewLazy_glLGPUNamedBufferSubDataNVX (GLbitfield a0, GLuint a1, GLintptr a2, GLsizeiptr a3, const void * a4)
+{
+  glLGPUNamedBufferSubDataNVX = (PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)glewGetProcAddress((const GLubyte*)"glLGPUNamedBufferSubDataNVX");
+  glLGPUNamedBufferSubDataNVX(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClientWaitSemaphoreui64NVX (GLsizei a0, const GLuint* a1, const GLuint64 * a2)
+{
+  glClientWaitSemaphoreui64NVX = (PFNGLCLIENTWAITSEMAPHOREUI64NVXPROC)glewGetProcAddress((const GLubyte*)"glClientWaitSemaphoreui64NVX");
+  glClientWaitSemaphoreui64NVX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSignalSemaphoreui64NVX (GLuint a0, GLsizei a1, const GLuint* a2, const GLuint64 * a3)
+{
+  glSignalSemaphoreui64NVX = (PFNGLSIGNALSEMAPHOREUI64NVXPROC)glewGetProcAddress((const GLubyte*)"glSignalSemaphoreui64NVX");
+  glSignalSemaphoreui64NVX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWaitSemaphoreui64NVX (GLuint a0, GLsizei a1, const GLuint* a2, const GLuint64 * a3)
+{
+  glWaitSemaphoreui64NVX = (PFNGLWAITSEMAPHOREUI64NVXPROC)glewGetProcAddress((const GLubyte*)"glWaitSemaphoreui64NVX");
+  glWaitSemaphoreui64NVX(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glStereoParameterfNV (GLenum a0, GLfloat a1)
+{
+  glStereoParameterfNV = (PFNGLSTEREOPARAMETERFNVPROC)glewGetProcAddress((const GLubyte*)"glStereoParameterfNV");
+  glStereoParameterfNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glStereoParameteriNV (GLenum a0, GLint a1)
+{
+  glStereoParameteriNV = (PFNGLSTEREOPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glStereoParameteriNV");
+  glStereoParameteriNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAlphaToCoverageDitherControlNV (GLenum a0)
+{
+  glAlphaToCoverageDitherControlNV = (PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)glewGetProcAddress((const GLubyte*)"glAlphaToCoverageDitherControlNV");
+  glAlphaToCoverageDitherControlNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectBindlessNV (GLenum a0, const void * a1, GLsizei a2, GLsizei a3, GLint a4)
+{
+  glMultiDrawArraysIndirectBindlessNV = (PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectBindlessNV");
+  glMultiDrawArraysIndirectBindlessNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectBindlessNV (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4, GLint a5)
+{
+  glMultiDrawElementsIndirectBindlessNV = (PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectBindlessNV");
+  glMultiDrawElementsIndirectBindlessNV(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectBindlessCountNV (GLenum a0, const void * a1, GLintptr a2, GLsizei a3, GLsizei a4, GLint a5)
+{
+  glMultiDrawArraysIndirectBindlessCountNV = (PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectBindlessCountNV");
+  glMultiDrawArraysIndirectBindlessCountNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectBindlessCountNV (GLenum a0, GLenum a1, const void * a2, GLintptr a3, GLsizei a4, GLsizei a5, GLint a6)
+{
+  glMultiDrawElementsIndirectBindlessCountNV = (PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectBindlessCountNV");
+  glMultiDrawElementsIndirectBindlessCountNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetImageHandleNV (GLuint a0, GLint a1, GLboolean a2, GLint a3, GLenum a4)
+{
+  glGetImageHandleNV = (PFNGLGETIMAGEHANDLENVPROC)glewGetProcAddress((const GLubyte*)"glGetImageHandleNV");
+  return glGetImageHandleNV(a0, a1, a2, a3, a4);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureHandleNV (GLuint a0)
+{
+  glGetTextureHandleNV = (PFNGLGETTEXTUREHANDLENVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureHandleNV");
+  return glGetTextureHandleNV(a0);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureSamplerHandleNV (GLuint a0, GLuint a1)
+{
+  glGetTextureSamplerHandleNV = (PFNGLGETTEXTURESAMPLERHANDLENVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSamplerHandleNV");
+  return glGetTextureSamplerHandleNV(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsImageHandleResidentNV (GLuint64 a0)
+{
+  glIsImageHandleResidentNV = (PFNGLISIMAGEHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsImageHandleResidentNV");
+  return glIsImageHandleResidentNV(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTextureHandleResidentNV (GLuint64 a0)
+{
+  glIsTextureHandleResidentNV = (PFNGLISTEXTUREHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsTextureHandleResidentNV");
+  return glIsTextureHandleResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleNonResidentNV (GLuint64 a0)
+{
+  glMakeImageHandleNonResidentNV = (PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleNonResidentNV");
+  glMakeImageHandleNonResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleResidentNV (GLuint64 a0, GLenum a1)
+{
+  glMakeImageHandleResidentNV = (PFNGLMAKEIMAGEHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleResidentNV");
+  glMakeImageHandleResidentNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleNonResidentNV (GLuint64 a0)
+{
+  glMakeTextureHandleNonResidentNV = (PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleNonResidentNV");
+  glMakeTextureHandleNonResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleResidentNV (GLuint64 a0)
+{
+  glMakeTextureHandleResidentNV = (PFNGLMAKETEXTUREHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleResidentNV");
+  glMakeTextureHandleResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64NV (GLuint a0, GLint a1, GLuint64 a2)
+{
+  glProgramUniformHandleui64NV = (PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64NV");
+  glProgramUniformHandleui64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  glProgramUniformHandleui64vNV = (PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64vNV");
+  glProgramUniformHandleui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64NV (GLint a0, GLuint64 a1)
+{
+  glUniformHandleui64NV = (PFNGLUNIFORMHANDLEUI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64NV");
+  glUniformHandleui64NV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64vNV (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  glUniformHandleui64vNV = (PFNGLUNIFORMHANDLEUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64vNV");
+  glUniformHandleui64vNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendBarrierNV (void)
+{
+  glBlendBarrierNV = (PFNGLBLENDBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glBlendBarrierNV");
+  glBlendBarrierNV();
+}
+
+static void GLAPIENTRY _glewLazy_glBlendParameteriNV (GLenum a0, GLint a1)
+{
+  glBlendParameteriNV = (PFNGLBLENDPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glBlendParameteriNV");
+  glBlendParameteriNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glViewportPositionWScaleNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  glViewportPositionWScaleNV = (PFNGLVIEWPORTPOSITIONWSCALENVPROC)glewGetProcAddress((const GLubyte*)"glViewportPositionWScaleNV");
+  glViewportPositionWScaleNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCallCommandListNV (GLuint a0)
+{
+  glCallCommandListNV = (PFNGLCALLCOMMANDLISTNVPROC)glewGetProcAddress((const GLubyte*)"glCallCommandListNV");
+  glCallCommandListNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glCommandListSegmentsNV (GLuint a0, GLuint a1)
+{
+  glCommandListSegmentsNV = (PFNGLCOMMANDLISTSEGMENTSNVPROC)glewGetProcAddress((const GLubyte*)"glCommandListSegmentsNV");
+  glCommandListSegmentsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCompileCommandListNV (GLuint a0)
+{
+  glCompileCommandListNV = (PFNGLCOMPILECOMMANDLISTNVPROC)glewGetProcAddress((const GLubyte*)"glCompileCommandListNV");
+  glCompileCommandListNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateCommandListsNV (GLsizei a0, GLuint* a1)
+{
+  glCreateCommandListsNV = (PFNGLCREATECOMMANDLISTSNVPROC)glewGetProcAddress((const GLubyte*)"glCreateCommandListsNV");
+  glCreateCommandListsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateStatesNV (GLsizei a0, GLuint* a1)
+{
+  glCreateStatesNV = (PFNGLCREATESTATESNVPROC)glewGetProcAddress((const GLubyte*)"glCreateStatesNV");
+  glCreateStatesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteCommandListsNV (GLsizei a0, const GLuint* a1)
+{
+  glDeleteCommandListsNV = (PFNGLDELETECOMMANDLISTSNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteCommandListsNV");
+  glDeleteCommandListsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteStatesNV (GLsizei a0, const GLuint* a1)
+{
+  glDeleteStatesNV = (PFNGLDELETESTATESNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteStatesNV");
+  glDeleteStatesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawCommandsAddressNV (GLenum a0, const GLuint64* a1, const GLsizei* a2, GLuint a3)
+{
+  glDrawCommandsAddressNV = (PFNGLDRAWCOMMANDSADDRESSNVPROC)glewGetProcAddress((const GLubyte*)"glDrawCommandsAddressNV");
+  glDrawCommandsAddressNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawCommandsNV (GLenum a0, GLuint a1, const GLintptr* a2, const GLsizei* a3, GLuint a4)
+{
+  glDrawCommandsNV = (PFNGLDRAWCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glDrawCommandsNV");
+  glDrawCommandsNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawCommandsStatesAddressNV (const GLuint64* a0, const GLsizei* a1, const GLuint* a2, const GLuint* a3, GLuint a4)
+{
+  glDrawCommandsStatesAddressNV = (PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)glewGetProcAddress((const GLubyte*)"glDrawCommandsStatesAddressNV");
+  glDrawCommandsStatesAddressNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawCommandsStatesNV (GLuint a0, const GLintptr* a1, const GLsizei* a2, const GLuint* a3, const GLuint* a4, GLuint a5)
+{
+  glDrawCommandsStatesNV = (PFNGLDRAWCOMMANDSSTATESNVPROC)glewGetProcAddress((const GLubyte*)"glDrawCommandsStatesNV");
+  glDrawCommandsStatesNV(a0, a1, a2, a3, a4, a5);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetCommandHeaderNV (GLenum a0, GLuint a1)
+{
+  glGetCommandHeaderNV = (PFNGLGETCOMMANDHEADERNVPROC)glewGetProcAddress((const GLubyte*)"glGetCommandHeaderNV");
+  return glGetCommandHeaderNV(a0, a1);
+}
+
+static GLushort GLAPIENTRY _glewLazy_glGetStageIndexNV (GLenum a0)
+{
+  glGetStageIndexNV = (PFNGLGETSTAGEINDEXNVPROC)glewGetProcAddress((const GLubyte*)"glGetStageIndexNV");
+  return glGetStageIndexNV(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsCommandListNV (GLuint a0)
+{
+  glIsCommandListNV = (PFNGLISCOMMANDLISTNVPROC)glewGetProcAddress((const GLubyte*)"glIsCommandListNV");
+  return glIsCommandListNV(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsStateNV (GLuint a0)
+{
+  glIsStateNV = (PFNGLISSTATENVPROC)glewGetProcAddress((const GLubyte*)"glIsStateNV");
+  return glIsStateNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glListDrawCommandsStatesClientNV (GLuint a0, GLuint a1, const void** a2, const GLsizei* a3, const GLuint* a4, const GLuint* a5, GLuint a6)
+{
+  glListDrawCommandsStatesClientNV = (PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)glewGetProcAddress((const GLubyte*)"glListDrawCommandsStatesClientNV");
+  glListDrawCommandsStatesClientNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glStateCaptureNV (GLuint a0, GLenum a1)
+{
+  glStateCaptureNV = (PFNGLSTATECAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glStateCaptureNV");
+  glStateCaptureNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginConditionalRenderNV (GLuint a0, GLenum a1)
+{
+  glBeginConditionalRenderNV = (PFNGLBEGINCONDITIONALRENDERNVPROC)glewGetProcAddress((const GLubyte*)"glBeginConditionalRenderNV");
+  glBeginConditionalRenderNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndConditionalRenderNV (void)
+{
+  glEndConditionalRenderNV = (PFNGLENDCONDITIONALRENDERNVPROC)glewGetProcAddress((const GLubyte*)"glEndConditionalRenderNV");
+  glEndConditionalRenderNV();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSubpixelPrecisionBiasNV (GLuint a0, GLuint a1)
+{
+  glSubpixelPrecisionBiasNV = (PFNGLSUBPIXELPRECISIONBIASNVPROC)glewGetProcAddress((const GLubyte*)"glSubpixelPrecisionBiasNV");
+  glSubpixelPrecisionBiasNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glConservativeRasterParameterfNV (GLenum a0, GLfloat a1)
+{
+  glConservativeRasterParameterfNV = (PFNGLCONSERVATIVERASTERPARAMETERFNVPROC)glewGetProcAddress((const GLubyte*)"glConservativeRasterParameterfNV");
+  glConservativeRasterParameterfNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glConservativeRasterParameteriNV (GLenum a0, GLint a1)
+{
+  glConservativeRasterParameteriNV = (PFNGLCONSERVATIVERASTERPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glConservativeRasterParameteriNV");
+  glConservativeRasterParameteriNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyBufferSubDataNV (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  glCopyBufferSubDataNV = (PFNGLCOPYBUFFERSUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glCopyBufferSubDataNV");
+  glCopyBufferSubDataNV(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyImageSubDataNV (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  glCopyImageSubDataNV = (PFNGLCOPYIMAGESUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glCopyImageSubDataNV");
+  glCopyImageSubDataNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearDepthdNV (GLdouble a0)
+{
+  glClearDepthdNV = (PFNGLCLEARDEPTHDNVPROC)glewGetProcAddress((const GLubyte*)"glClearDepthdNV");
+  glClearDepthdNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthBoundsdNV (GLdouble a0, GLdouble a1)
+{
+  glDepthBoundsdNV = (PFNGLDEPTHBOUNDSDNVPROC)glewGetProcAddress((const GLubyte*)"glDepthBoundsdNV");
+  glDepthBoundsdNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangedNV (GLdouble a0, GLdouble a1)
+{
+  glDepthRangedNV = (PFNGLDEPTHRANGEDNVPROC)glewGetProcAddress((const GLubyte*)"glDepthRangedNV");
+  glDepthRangedNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersNV (GLsizei a0, const GLenum* a1)
+{
+  glDrawBuffersNV = (PFNGLDRAWBUFFERSNVPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersNV");
+  glDrawBuffersNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedNV (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glDrawArraysInstancedNV = (PFNGLDRAWARRAYSINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedNV");
+  glDrawArraysInstancedNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedNV (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4)
+{
+  glDrawElementsInstancedNV = (PFNGLDRAWELEMENTSINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedNV");
+  glDrawElementsInstancedNV(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawTextureNV (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10)
+{
+  glDrawTextureNV = (PFNGLDRAWTEXTURENVPROC)glewGetProcAddress((const GLubyte*)"glDrawTextureNV");
+  glDrawTextureNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawVkImageNV (GLuint64 a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10)
+{
+  glDrawVkImageNV = (PFNGLDRAWVKIMAGENVPROC)glewGetProcAddress((const GLubyte*)"glDrawVkImageNV");
+  glDrawVkImageNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static GLVULKANPROCNV GLAPIENTRY _glewLazy_glGetVkProcAddrNV (const GLchar* a0)
+{
+  glGetVkProcAddrNV = (PFNGLGETVKPROCADDRNVPROC)glewGetProcAddress((const GLubyte*)"glGetVkProcAddrNV");
+  return glGetVkProcAddrNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSignalVkFenceNV (GLuint64 a0)
+{
+  glSignalVkFenceNV = (PFNGLSIGNALVKFENCENVPROC)glewGetProcAddress((const GLubyte*)"glSignalVkFenceNV");
+  glSignalVkFenceNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSignalVkSemaphoreNV (GLuint64 a0)
+{
+  glSignalVkSemaphoreNV = (PFNGLSIGNALVKSEMAPHORENVPROC)glewGetProcAddress((const GLubyte*)"glSignalVkSemaphoreNV");
+  glSignalVkSemaphoreNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glWaitVkSemaphoreNV (GLuint64 a0)
+{
+  glWaitVkSemaphoreNV = (PFNGLWAITVKSEMAPHORENVPROC)glewGetProcAddress((const GLubyte*)"glWaitVkSemaphoreNV");
+  glWaitVkSemaphoreNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glEvalMapsNV (GLenum a0, GLenum a1)
+{
+  glEvalMapsNV = (PFNGLEVALMAPSNVPROC)glewGetProcAddress((const GLubyte*)"glEvalMapsNV");
+  glEvalMapsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapAttribParameterfvNV (GLenum a0, GLuint a1, GLenum a2, GLfloat* a3)
+{
+  glGetMapAttribParameterfvNV = (PFNGLGETMAPATTRIBPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapAttribParameterfvNV");
+  glGetMapAttribParameterfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapAttribParameterivNV (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetMapAttribParameterivNV = (PFNGLGETMAPATTRIBPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapAttribParameterivNV");
+  glGetMapAttribParameterivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapControlPointsNV (GLenum a0, GLuint a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5, void * a6)
+{
+  glGetMapControlPointsNV = (PFNGLGETMAPCONTROLPOINTSNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapControlPointsNV");
+  glGetMapControlPointsNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapParameterfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetMapParameterfvNV = (PFNGLGETMAPPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapParameterfvNV");
+  glGetMapParameterfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapParameterivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetMapParameterivNV = (PFNGLGETMAPPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapParameterivNV");
+  glGetMapParameterivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMapControlPointsNV (GLenum a0, GLuint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLint a6, GLboolean a7, const void * a8)
+{
+  glMapControlPointsNV = (PFNGLMAPCONTROLPOINTSNVPROC)glewGetProcAddress((const GLubyte*)"glMapControlPointsNV");
+  glMapControlPointsNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glMapParameterfvNV (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glMapParameterfvNV = (PFNGLMAPPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glMapParameterfvNV");
+  glMapParameterfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMapParameterivNV (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glMapParameterivNV = (PFNGLMAPPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glMapParameterivNV");
+  glMapParameterivNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetMultisamplefvNV (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetMultisamplefvNV = (PFNGLGETMULTISAMPLEFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMultisamplefvNV");
+  glGetMultisamplefvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleMaskIndexedNV (GLuint a0, GLbitfield a1)
+{
+  glSampleMaskIndexedNV = (PFNGLSAMPLEMASKINDEXEDNVPROC)glewGetProcAddress((const GLubyte*)"glSampleMaskIndexedNV");
+  glSampleMaskIndexedNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexRenderbufferNV (GLenum a0, GLuint a1)
+{
+  glTexRenderbufferNV = (PFNGLTEXRENDERBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glTexRenderbufferNV");
+  glTexRenderbufferNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDeleteFencesNV (GLsizei a0, const GLuint* a1)
+{
+  glDeleteFencesNV = (PFNGLDELETEFENCESNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteFencesNV");
+  glDeleteFencesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFinishFenceNV (GLuint a0)
+{
+  glFinishFenceNV = (PFNGLFINISHFENCENVPROC)glewGetProcAddress((const GLubyte*)"glFinishFenceNV");
+  glFinishFenceNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFencesNV (GLsizei a0, GLuint* a1)
+{
+  glGenFencesNV = (PFNGLGENFENCESNVPROC)glewGetProcAddress((const GLubyte*)"glGenFencesNV");
+  glGenFencesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFenceivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetFenceivNV = (PFNGLGETFENCEIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetFenceivNV");
+  glGetFenceivNV(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFenceNV (GLuint a0)
+{
+  glIsFenceNV = (PFNGLISFENCENVPROC)glewGetProcAddress((const GLubyte*)"glIsFenceNV");
+  return glIsFenceNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSetFenceNV (GLuint a0, GLenum a1)
+{
+  glSetFenceNV = (PFNGLSETFENCENVPROC)glewGetProcAddress((const GLubyte*)"glSetFenceNV");
+  glSetFenceNV(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glTestFenceNV (GLuint a0)
+{
+  glTestFenceNV = (PFNGLTESTFENCENVPROC)glewGetProcAddress((const GLubyte*)"glTestFenceNV");
+  return glTestFenceNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFragmentCoverageColorNV (GLuint a0)
+{
+  glFragmentCoverageColorNV = (PFNGLFRAGMENTCOVERAGECOLORNVPROC)glewGetProcAddress((const GLubyte*)"glFragmentCoverageColorNV");
+  glFragmentCoverageColorNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramNamedParameterdvNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLdouble * a3)
+{
+  glGetProgramNamedParameterdvNV = (PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramNamedParameterdvNV");
+  glGetProgramNamedParameterdvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramNamedParameterfvNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLfloat * a3)
+{
+  glGetProgramNamedParameterfvNV = (PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramNamedParameterfvNV");
+  glGetProgramNamedParameterfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4dNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  glProgramNamedParameter4dNV = (PFNGLPROGRAMNAMEDPARAMETER4DNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4dNV");
+  glProgramNamedParameter4dNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4dvNV (GLuint a0, GLsizei a1, const GLubyte* a2, const GLdouble a3[])
+{
+  glProgramNamedParameter4dvNV = (PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4dvNV");
+  glProgramNamedParameter4dvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4fNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  glProgramNamedParameter4fNV = (PFNGLPROGRAMNAMEDPARAMETER4FNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4fNV");
+  glProgramNamedParameter4fNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4fvNV (GLuint a0, GLsizei a1, const GLubyte* a2, const GLfloat a3[])
+{
+  glProgramNamedParameter4fvNV = (PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4fvNV");
+  glProgramNamedParameter4fvNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlitFramebufferNV (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  glBlitFramebufferNV = (PFNGLBLITFRAMEBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebufferNV");
+  glBlitFramebufferNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleNV (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  glRenderbufferStorageMultisampleNV = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLENVPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleNV");
+  glRenderbufferStorageMultisampleNV(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleCoverageNV (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  glRenderbufferStorageMultisampleCoverageNV = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleCoverageNV");
+  glRenderbufferStorageMultisampleCoverageNV(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glProgramVertexLimitNV (GLenum a0, GLint a1)
+{
+  glProgramVertexLimitNV = (PFNGLPROGRAMVERTEXLIMITNVPROC)glewGetProcAddress((const GLubyte*)"glProgramVertexLimitNV");
+  glProgramVertexLimitNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMulticastBarrierNV (void)
+{
+  glMulticastBarrierNV = (PFNGLMULTICASTBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastBarrierNV");
+  glMulticastBarrierNV();
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastBlitFramebufferNV (GLuint a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLint a8, GLint a9, GLbitfield a10, GLenum a11)
+{
+  glMulticastBlitFramebufferNV = (PFNGLMULTICASTBLITFRAMEBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastBlitFramebufferNV");
+  glMulticastBlitFramebufferNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastBufferSubDataNV (GLbitfield a0, GLuint a1, GLintptr a2, GLsizeiptr a3, const void * a4)
+{
+  glMulticastBufferSubDataNV = (PFNGLMULTICASTBUFFERSUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glMulticastBufferSubDataNV");
+  glMulticastBufferSubDataNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastCopyBufferSubDataNV (GLuint a0, GLbitfield a1, GLuint a2, GLuint a3, GLintptr a4, GLintptr a5, GLsizeiptr a6)
+{
+  glMulticastCopyBufferSubDataNV = (PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glMulticastCopyBufferSubDataNV");
+  glMulticastCopyBufferSubDataNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastCopyImageSubDataNV (GLuint a0, GLbitfield a1, GLuint a2, GLenum a3, GLint a4, GLint a5, GLint a6, GLint a7, GLuint a8, GLenum a9, GLint a10, GLint a11, GLint a12, GLint a13, GLsizei a14, GLsizei a15, GLsizei a16)
+{
+  glMulticastCopyImageSubDataNV = (PFNGLMULTICASTCOPYIMAGESUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glMulticastCopyImageSubDataNV");
+  glMulticastCopyImageSubDataNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastFramebufferSampleLocationsfvNV (GLuint a0, GLuint a1, GLuint a2, GLsizei a3, const GLfloat* a4)
+{
+  glMulticastFramebufferSampleLocationsfvNV = (PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastFramebufferSampleLocationsfvNV");
+  glMulticastFramebufferSampleLocationsfvNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastGetQueryObjecti64vNV (GLuint a0, GLuint a1, GLenum a2, GLint64* a3)
+{
+  glMulticastGetQueryObjecti64vNV = (PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastGetQueryObjecti64vNV");
+  glMulticastGetQueryObjecti64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastGetQueryObjectivNV (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glMulticastGetQueryObjectivNV = (PFNGLMULTICASTGETQUERYOBJECTIVNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastGetQueryObjectivNV");
+  glMulticastGetQueryObjectivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastGetQueryObjectui64vNV (GLuint a0, GLuint a1, GLenum a2, GLuint64* a3)
+{
+  glMulticastGetQueryObjectui64vNV = (PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastGetQueryObjectui64vNV");
+  glMulticastGetQueryObjectui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastGetQueryObjectuivNV (GLuint a0, GLuint a1, GLenum a2, GLuint* a3)
+{
+  glMulticastGetQueryObjectuivNV = (PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastGetQueryObjectuivNV");
+  glMulticastGetQueryObjectuivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMulticastWaitSyncNV (GLuint a0, GLbitfield a1)
+{
+  glMulticastWaitSyncNV = (PFNGLMULTICASTWAITSYNCNVPROC)glewGetProcAddress((const GLubyte*)"glMulticastWaitSyncNV");
+  glMulticastWaitSyncNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderGpuMaskNV (GLbitfield a0)
+{
+  glRenderGpuMaskNV = (PFNGLRENDERGPUMASKNVPROC)glewGetProcAddress((const GLubyte*)"glRenderGpuMaskNV");
+  glRenderGpuMaskNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4iNV (GLenum a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  glProgramEnvParameterI4iNV = (PFNGLPROGRAMENVPARAMETERI4INVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4iNV");
+  glProgramEnvParameterI4iNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4ivNV (GLenum a0, GLuint a1, const GLint * a2)
+{
+  glProgramEnvParameterI4ivNV = (PFNGLPROGRAMENVPARAMETERI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4ivNV");
+  glProgramEnvParameterI4ivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4uiNV (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  glProgramEnvParameterI4uiNV = (PFNGLPROGRAMENVPARAMETERI4UINVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4uiNV");
+  glProgramEnvParameterI4uiNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4uivNV (GLenum a0, GLuint a1, const GLuint * a2)
+{
+  glProgramEnvParameterI4uivNV = (PFNGLPROGRAMENVPARAMETERI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4uivNV");
+  glProgramEnvParameterI4uivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParametersI4ivNV (GLenum a0, GLuint a1, GLsizei a2, const GLint * a3)
+{
+  glProgramEnvParametersI4ivNV = (PFNGLPROGRAMENVPARAMETERSI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParametersI4ivNV");
+  glProgramEnvParametersI4ivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParametersI4uivNV (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3)
+{
+  glProgramEnvParametersI4uivNV = (PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParametersI4uivNV");
+  glProgramEnvParametersI4uivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4iNV (GLenum a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  glProgramLocalParameterI4iNV = (PFNGLPROGRAMLOCALPARAMETERI4INVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4iNV");
+  glProgramLocalParameterI4iNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4ivNV (GLenum a0, GLuint a1, const GLint * a2)
+{
+  glProgramLocalParameterI4ivNV = (PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4ivNV");
+  glProgramLocalParameterI4ivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4uiNV (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  glProgramLocalParameterI4uiNV = (PFNGLPROGRAMLOCALPARAMETERI4UINVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4uiNV");
+  glProgramLocalParameterI4uiNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4uivNV (GLenum a0, GLuint a1, const GLuint * a2)
+{
+  glProgramLocalParameterI4uivNV = (PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4uivNV");
+  glProgramLocalParameterI4uivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParametersI4ivNV (GLenum a0, GLuint a1, GLsizei a2, const GLint * a3)
+{
+  glProgramLocalParametersI4ivNV = (PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParametersI4ivNV");
+  glProgramLocalParametersI4ivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParametersI4uivNV (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3)
+{
+  glProgramLocalParametersI4uivNV = (PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParametersI4uivNV");
+  glProgramLocalParametersI4uivNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetUniformi64vNV (GLuint a0, GLint a1, GLint64EXT* a2)
+{
+  glGetUniformi64vNV = (PFNGLGETUNIFORMI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformi64vNV");
+  glGetUniformi64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformui64vNV (GLuint a0, GLint a1, GLuint64EXT* a2)
+{
+  glGetUniformui64vNV = (PFNGLGETUNIFORMUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformui64vNV");
+  glGetUniformui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i64NV (GLuint a0, GLint a1, GLint64EXT a2)
+{
+  glProgramUniform1i64NV = (PFNGLPROGRAMUNIFORM1I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i64NV");
+  glProgramUniform1i64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  glProgramUniform1i64vNV = (PFNGLPROGRAMUNIFORM1I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i64vNV");
+  glProgramUniform1i64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui64NV (GLuint a0, GLint a1, GLuint64EXT a2)
+{
+  glProgramUniform1ui64NV = (PFNGLPROGRAMUNIFORM1UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui64NV");
+  glProgramUniform1ui64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  glProgramUniform1ui64vNV = (PFNGLPROGRAMUNIFORM1UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui64vNV");
+  glProgramUniform1ui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i64NV (GLuint a0, GLint a1, GLint64EXT a2, GLint64EXT a3)
+{
+  glProgramUniform2i64NV = (PFNGLPROGRAMUNIFORM2I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i64NV");
+  glProgramUniform2i64NV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  glProgramUniform2i64vNV = (PFNGLPROGRAMUNIFORM2I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i64vNV");
+  glProgramUniform2i64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui64NV (GLuint a0, GLint a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  glProgramUniform2ui64NV = (PFNGLPROGRAMUNIFORM2UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui64NV");
+  glProgramUniform2ui64NV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  glProgramUniform2ui64vNV = (PFNGLPROGRAMUNIFORM2UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui64vNV");
+  glProgramUniform2ui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i64NV (GLuint a0, GLint a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4)
+{
+  glProgramUniform3i64NV = (PFNGLPROGRAMUNIFORM3I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i64NV");
+  glProgramUniform3i64NV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  glProgramUniform3i64vNV = (PFNGLPROGRAMUNIFORM3I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i64vNV");
+  glProgramUniform3i64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui64NV (GLuint a0, GLint a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4)
+{
+  glProgramUniform3ui64NV = (PFNGLPROGRAMUNIFORM3UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui64NV");
+  glProgramUniform3ui64NV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  glProgramUniform3ui64vNV = (PFNGLPROGRAMUNIFORM3UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui64vNV");
+  glProgramUniform3ui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i64NV (GLuint a0, GLint a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4, GLint64EXT a5)
+{
+  glProgramUniform4i64NV = (PFNGLPROGRAMUNIFORM4I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i64NV");
+  glProgramUniform4i64NV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  glProgramUniform4i64vNV = (PFNGLPROGRAMUNIFORM4I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i64vNV");
+  glProgramUniform4i64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui64NV (GLuint a0, GLint a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4, GLuint64EXT a5)
+{
+  glProgramUniform4ui64NV = (PFNGLPROGRAMUNIFORM4UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui64NV");
+  glProgramUniform4ui64NV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  glProgramUniform4ui64vNV = (PFNGLPROGRAMUNIFORM4UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui64vNV");
+  glProgramUniform4ui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i64NV (GLint a0, GLint64EXT a1)
+{
+  glUniform1i64NV = (PFNGLUNIFORM1I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform1i64NV");
+  glUniform1i64NV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  glUniform1i64vNV = (PFNGLUNIFORM1I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform1i64vNV");
+  glUniform1i64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui64NV (GLint a0, GLuint64EXT a1)
+{
+  glUniform1ui64NV = (PFNGLUNIFORM1UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui64NV");
+  glUniform1ui64NV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  glUniform1ui64vNV = (PFNGLUNIFORM1UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui64vNV");
+  glUniform1ui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i64NV (GLint a0, GLint64EXT a1, GLint64EXT a2)
+{
+  glUniform2i64NV = (PFNGLUNIFORM2I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform2i64NV");
+  glUniform2i64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  glUniform2i64vNV = (PFNGLUNIFORM2I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform2i64vNV");
+  glUniform2i64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui64NV (GLint a0, GLuint64EXT a1, GLuint64EXT a2)
+{
+  glUniform2ui64NV = (PFNGLUNIFORM2UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui64NV");
+  glUniform2ui64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  glUniform2ui64vNV = (PFNGLUNIFORM2UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui64vNV");
+  glUniform2ui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i64NV (GLint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3)
+{
+  glUniform3i64NV = (PFNGLUNIFORM3I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform3i64NV");
+  glUniform3i64NV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  glUniform3i64vNV = (PFNGLUNIFORM3I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform3i64vNV");
+  glUniform3i64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui64NV (GLint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  glUniform3ui64NV = (PFNGLUNIFORM3UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui64NV");
+  glUniform3ui64NV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  glUniform3ui64vNV = (PFNGLUNIFORM3UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui64vNV");
+  glUniform3ui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i64NV (GLint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4)
+{
+  glUniform4i64NV = (PFNGLUNIFORM4I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform4i64NV");
+  glUniform4i64NV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  glUniform4i64vNV = (PFNGLUNIFORM4I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform4i64vNV");
+  glUniform4i64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui64NV (GLint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4)
+{
+  glUniform4ui64NV = (PFNGLUNIFORM4UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui64NV");
+  glUniform4ui64NV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  glUniform4ui64vNV = (PFNGLUNIFORM4UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui64vNV");
+  glUniform4ui64vNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColor3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  glColor3hNV = (PFNGLCOLOR3HNVPROC)glewGetProcAddress((const GLubyte*)"glColor3hNV");
+  glColor3hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColor3hvNV (const GLhalf* a0)
+{
+  glColor3hvNV = (PFNGLCOLOR3HVNVPROC)glewGetProcAddress((const GLubyte*)"glColor3hvNV");
+  glColor3hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4hNV (GLhalf a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  glColor4hNV = (PFNGLCOLOR4HNVPROC)glewGetProcAddress((const GLubyte*)"glColor4hNV");
+  glColor4hNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4hvNV (const GLhalf* a0)
+{
+  glColor4hvNV = (PFNGLCOLOR4HVNVPROC)glewGetProcAddress((const GLubyte*)"glColor4hvNV");
+  glColor4hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordhNV (GLhalf a0)
+{
+  glFogCoordhNV = (PFNGLFOGCOORDHNVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordhNV");
+  glFogCoordhNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordhvNV (const GLhalf* a0)
+{
+  glFogCoordhvNV = (PFNGLFOGCOORDHVNVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordhvNV");
+  glFogCoordhvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1hNV (GLenum a0, GLhalf a1)
+{
+  glMultiTexCoord1hNV = (PFNGLMULTITEXCOORD1HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1hNV");
+  glMultiTexCoord1hNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1hvNV (GLenum a0, const GLhalf* a1)
+{
+  glMultiTexCoord1hvNV = (PFNGLMULTITEXCOORD1HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1hvNV");
+  glMultiTexCoord1hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2hNV (GLenum a0, GLhalf a1, GLhalf a2)
+{
+  glMultiTexCoord2hNV = (PFNGLMULTITEXCOORD2HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2hNV");
+  glMultiTexCoord2hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2hvNV (GLenum a0, const GLhalf* a1)
+{
+  glMultiTexCoord2hvNV = (PFNGLMULTITEXCOORD2HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2hvNV");
+  glMultiTexCoord2hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3hNV (GLenum a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  glMultiTexCoord3hNV = (PFNGLMULTITEXCOORD3HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3hNV");
+  glMultiTexCoord3hNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3hvNV (GLenum a0, const GLhalf* a1)
+{
+  glMultiTexCoord3hvNV = (PFNGLMULTITEXCOORD3HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3hvNV");
+  glMultiTexCoord3hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4hNV (GLenum a0, GLhalf a1, GLhalf a2, GLhalf a3, GLhalf a4)
+{
+  glMultiTexCoord4hNV = (PFNGLMULTITEXCOORD4HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4hNV");
+  glMultiTexCoord4hNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4hvNV (GLenum a0, const GLhalf* a1)
+{
+  glMultiTexCoord4hvNV = (PFNGLMULTITEXCOORD4HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4hvNV");
+  glMultiTexCoord4hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  glNormal3hNV = (PFNGLNORMAL3HNVPROC)glewGetProcAddress((const GLubyte*)"glNormal3hNV");
+  glNormal3hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3hvNV (const GLhalf* a0)
+{
+  glNormal3hvNV = (PFNGLNORMAL3HVNVPROC)glewGetProcAddress((const GLubyte*)"glNormal3hvNV");
+  glNormal3hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  glSecondaryColor3hNV = (PFNGLSECONDARYCOLOR3HNVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3hNV");
+  glSecondaryColor3hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3hvNV (const GLhalf* a0)
+{
+  glSecondaryColor3hvNV = (PFNGLSECONDARYCOLOR3HVNVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3hvNV");
+  glSecondaryColor3hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord1hNV (GLhalf a0)
+{
+  glTexCoord1hNV = (PFNGLTEXCOORD1HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord1hNV");
+  glTexCoord1hNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord1hvNV (const GLhalf* a0)
+{
+  glTexCoord1hvNV = (PFNGLTEXCOORD1HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord1hvNV");
+  glTexCoord1hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2hNV (GLhalf a0, GLhalf a1)
+{
+  glTexCoord2hNV = (PFNGLTEXCOORD2HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2hNV");
+  glTexCoord2hNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2hvNV (const GLhalf* a0)
+{
+  glTexCoord2hvNV = (PFNGLTEXCOORD2HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2hvNV");
+  glTexCoord2hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  glTexCoord3hNV = (PFNGLTEXCOORD3HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord3hNV");
+  glTexCoord3hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord3hvNV (const GLhalf* a0)
+{
+  glTexCoord3hvNV = (PFNGLTEXCOORD3HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord3hvNV");
+  glTexCoord3hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4hNV (GLhalf a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  glTexCoord4hNV = (PFNGLTEXCOORD4HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4hNV");
+  glTexCoord4hNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4hvNV (const GLhalf* a0)
+{
+  glTexCoord4hvNV = (PFNGLTEXCOORD4HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4hvNV");
+  glTexCoord4hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex2hNV (GLhalf a0, GLhalf a1)
+{
+  glVertex2hNV = (PFNGLVERTEX2HNVPROC)glewGetProcAddress((const GLubyte*)"glVertex2hNV");
+  glVertex2hNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex2hvNV (const GLhalf* a0)
+{
+  glVertex2hvNV = (PFNGLVERTEX2HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertex2hvNV");
+  glVertex2hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  glVertex3hNV = (PFNGLVERTEX3HNVPROC)glewGetProcAddress((const GLubyte*)"glVertex3hNV");
+  glVertex3hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex3hvNV (const GLhalf* a0)
+{
+  glVertex3hvNV = (PFNGLVERTEX3HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertex3hvNV");
+  glVertex3hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex4hNV (GLhalf a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  glVertex4hNV = (PFNGLVERTEX4HNVPROC)glewGetProcAddress((const GLubyte*)"glVertex4hNV");
+  glVertex4hNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex4hvNV (const GLhalf* a0)
+{
+  glVertex4hvNV = (PFNGLVERTEX4HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertex4hvNV");
+  glVertex4hvNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1hNV (GLuint a0, GLhalf a1)
+{
+  glVertexAttrib1hNV = (PFNGLVERTEXATTRIB1HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1hNV");
+  glVertexAttrib1hNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1hvNV (GLuint a0, const GLhalf* a1)
+{
+  glVertexAttrib1hvNV = (PFNGLVERTEXATTRIB1HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1hvNV");
+  glVertexAttrib1hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2hNV (GLuint a0, GLhalf a1, GLhalf a2)
+{
+  glVertexAttrib2hNV = (PFNGLVERTEXATTRIB2HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2hNV");
+  glVertexAttrib2hNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2hvNV (GLuint a0, const GLhalf* a1)
+{
+  glVertexAttrib2hvNV = (PFNGLVERTEXATTRIB2HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2hvNV");
+  glVertexAttrib2hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3hNV (GLuint a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  glVertexAttrib3hNV = (PFNGLVERTEXATTRIB3HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3hNV");
+  glVertexAttrib3hNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3hvNV (GLuint a0, const GLhalf* a1)
+{
+  glVertexAttrib3hvNV = (PFNGLVERTEXATTRIB3HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3hvNV");
+  glVertexAttrib3hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4hNV (GLuint a0, GLhalf a1, GLhalf a2, GLhalf a3, GLhalf a4)
+{
+  glVertexAttrib4hNV = (PFNGLVERTEXATTRIB4HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4hNV");
+  glVertexAttrib4hNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4hvNV (GLuint a0, const GLhalf* a1)
+{
+  glVertexAttrib4hvNV = (PFNGLVERTEXATTRIB4HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4hvNV");
+  glVertexAttrib4hvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  glVertexAttribs1hvNV = (PFNGLVERTEXATTRIBS1HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1hvNV");
+  glVertexAttribs1hvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  glVertexAttribs2hvNV = (PFNGLVERTEXATTRIBS2HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2hvNV");
+  glVertexAttribs2hvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  glVertexAttribs3hvNV = (PFNGLVERTEXATTRIBS3HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3hvNV");
+  glVertexAttribs3hvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  glVertexAttribs4hvNV = (PFNGLVERTEXATTRIBS4HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4hvNV");
+  glVertexAttribs4hvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeighthNV (GLhalf a0)
+{
+  glVertexWeighthNV = (PFNGLVERTEXWEIGHTHNVPROC)glewGetProcAddress((const GLubyte*)"glVertexWeighthNV");
+  glVertexWeighthNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeighthvNV (const GLhalf* a0)
+{
+  glVertexWeighthvNV = (PFNGLVERTEXWEIGHTHVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexWeighthvNV");
+  glVertexWeighthvNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisorNV (GLuint a0, GLuint a1)
+{
+  glVertexAttribDivisorNV = (PFNGLVERTEXATTRIBDIVISORNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisorNV");
+  glVertexAttribDivisorNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetInternalformatSampleivNV (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLint* a5)
+{
+  glGetInternalformatSampleivNV = (PFNGLGETINTERNALFORMATSAMPLEIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetInternalformatSampleivNV");
+  glGetInternalformatSampleivNV(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferAttachMemoryNV (GLenum a0, GLuint a1, GLuint64 a2)
+{
+  glBufferAttachMemoryNV = (PFNGLBUFFERATTACHMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"glBufferAttachMemoryNV");
+  glBufferAttachMemoryNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMemoryObjectDetachedResourcesuivNV (GLuint a0, GLenum a1, GLint a2, GLsizei a3, GLuint* a4)
+{
+  glGetMemoryObjectDetachedResourcesuivNV = (PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMemoryObjectDetachedResourcesuivNV");
+  glGetMemoryObjectDetachedResourcesuivNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferAttachMemoryNV (GLuint a0, GLuint a1, GLuint64 a2)
+{
+  glNamedBufferAttachMemoryNV = (PFNGLNAMEDBUFFERATTACHMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferAttachMemoryNV");
+  glNamedBufferAttachMemoryNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glResetMemoryObjectParameterNV (GLuint a0, GLenum a1)
+{
+  glResetMemoryObjectParameterNV = (PFNGLRESETMEMORYOBJECTPARAMETERNVPROC)glewGetProcAddress((const GLubyte*)"glResetMemoryObjectParameterNV");
+  glResetMemoryObjectParameterNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexAttachMemoryNV (GLenum a0, GLuint a1, GLuint64 a2)
+{
+  glTexAttachMemoryNV = (PFNGLTEXATTACHMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"glTexAttachMemoryNV");
+  glTexAttachMemoryNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureAttachMemoryNV (GLuint a0, GLuint a1, GLuint64 a2)
+{
+  glTextureAttachMemoryNV = (PFNGLTEXTUREATTACHMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"glTextureAttachMemoryNV");
+  glTextureAttachMemoryNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDrawMeshTasksIndirectNV (GLintptr a0)
+{
+  glDrawMeshTasksIndirectNV = (PFNGLDRAWMESHTASKSINDIRECTNVPROC)glewGetProcAddress((const GLubyte*)"glDrawMeshTasksIndirectNV");
+  glDrawMeshTasksIndirectNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawMeshTasksNV (GLuint a0, GLuint a1)
+{
+  glDrawMeshTasksNV = (PFNGLDRAWMESHTASKSNVPROC)glewGetProcAddress((const GLubyte*)"glDrawMeshTasksNV");
+  glDrawMeshTasksNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawMeshTasksIndirectCountNV (GLintptr a0, GLintptr a1, GLsizei a2, GLsizei a3)
+{
+  glMultiDrawMeshTasksIndirectCountNV = (PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawMeshTasksIndirectCountNV");
+  glMultiDrawMeshTasksIndirectCountNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawMeshTasksIndirectNV (GLintptr a0, GLsizei a1, GLsizei a2)
+{
+  glMultiDrawMeshTasksIndirectNV = (PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawMeshTasksIndirectNV");
+  glMultiDrawMeshTasksIndirectNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x3fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix2x3fvNV = (PFNGLUNIFORMMATRIX2X3FVNVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x3fvNV");
+  glUniformMatrix2x3fvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x4fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix2x4fvNV = (PFNGLUNIFORMMATRIX2X4FVNVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x4fvNV");
+  glUniformMatrix2x4fvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x2fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix3x2fvNV = (PFNGLUNIFORMMATRIX3X2FVNVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x2fvNV");
+  glUniformMatrix3x2fvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x4fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix3x4fvNV = (PFNGLUNIFORMMATRIX3X4FVNVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x4fvNV");
+  glUniformMatrix3x4fvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x2fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix4x2fvNV = (PFNGLUNIFORMMATRIX4X2FVNVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x2fvNV");
+  glUniformMatrix4x2fvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x3fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  glUniformMatrix4x3fvNV = (PFNGLUNIFORMMATRIX4X3FVNVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x3fvNV");
+  glUniformMatrix4x3fvNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginOcclusionQueryNV (GLuint a0)
+{
+  glBeginOcclusionQueryNV = (PFNGLBEGINOCCLUSIONQUERYNVPROC)glewGetProcAddress((const GLubyte*)"glBeginOcclusionQueryNV");
+  glBeginOcclusionQueryNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteOcclusionQueriesNV (GLsizei a0, const GLuint* a1)
+{
+  glDeleteOcclusionQueriesNV = (PFNGLDELETEOCCLUSIONQUERIESNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteOcclusionQueriesNV");
+  glDeleteOcclusionQueriesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEndOcclusionQueryNV (void)
+{
+  glEndOcclusionQueryNV = (PFNGLENDOCCLUSIONQUERYNVPROC)glewGetProcAddress((const GLubyte*)"glEndOcclusionQueryNV");
+  glEndOcclusionQueryNV();
+}
+
+static void GLAPIENTRY _glewLazy_glGenOcclusionQueriesNV (GLsizei a0, GLuint* a1)
+{
+  glGenOcclusionQueriesNV = (PFNGLGENOCCLUSIONQUERIESNVPROC)glewGetProcAddress((const GLubyte*)"glGenOcclusionQueriesNV");
+  glGenOcclusionQueriesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetOcclusionQueryivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetOcclusionQueryivNV = (PFNGLGETOCCLUSIONQUERYIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetOcclusionQueryivNV");
+  glGetOcclusionQueryivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetOcclusionQueryuivNV (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetOcclusionQueryuivNV = (PFNGLGETOCCLUSIONQUERYUIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetOcclusionQueryuivNV");
+  glGetOcclusionQueryuivNV(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsOcclusionQueryNV (GLuint a0)
+{
+  glIsOcclusionQueryNV = (PFNGLISOCCLUSIONQUERYNVPROC)glewGetProcAddress((const GLubyte*)"glIsOcclusionQueryNV");
+  return glIsOcclusionQueryNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glProgramBufferParametersIivNV (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, const GLint * a4)
+{
+  glProgramBufferParametersIivNV = (PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramBufferParametersIivNV");
+  glProgramBufferParametersIivNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBufferParametersIuivNV (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, const GLuint * a4)
+{
+  glProgramBufferParametersIuivNV = (PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramBufferParametersIuivNV");
+  glProgramBufferParametersIuivNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBufferParametersfvNV (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, const GLfloat * a4)
+{
+  glProgramBufferParametersfvNV = (PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramBufferParametersfvNV");
+  glProgramBufferParametersfvNV(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyPathNV (GLuint a0, GLuint a1)
+{
+  glCopyPathNV = (PFNGLCOPYPATHNVPROC)glewGetProcAddress((const GLubyte*)"glCopyPathNV");
+  glCopyPathNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverFillPathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLenum a5, const GLfloat * a6)
+{
+  glCoverFillPathInstancedNV = (PFNGLCOVERFILLPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glCoverFillPathInstancedNV");
+  glCoverFillPathInstancedNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverFillPathNV (GLuint a0, GLenum a1)
+{
+  glCoverFillPathNV = (PFNGLCOVERFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glCoverFillPathNV");
+  glCoverFillPathNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverStrokePathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLenum a5, const GLfloat * a6)
+{
+  glCoverStrokePathInstancedNV = (PFNGLCOVERSTROKEPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glCoverStrokePathInstancedNV");
+  glCoverStrokePathInstancedNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverStrokePathNV (GLuint a0, GLenum a1)
+{
+  glCoverStrokePathNV = (PFNGLCOVERSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glCoverStrokePathNV");
+  glCoverStrokePathNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeletePathsNV (GLuint a0, GLsizei a1)
+{
+  glDeletePathsNV = (PFNGLDELETEPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glDeletePathsNV");
+  glDeletePathsNV(a0, a1);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenPathsNV (GLsizei a0)
+{
+  glGenPathsNV = (PFNGLGENPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glGenPathsNV");
+  return glGenPathsNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathColorGenfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetPathColorGenfvNV = (PFNGLGETPATHCOLORGENFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathColorGenfvNV");
+  glGetPathColorGenfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathColorGenivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetPathColorGenivNV = (PFNGLGETPATHCOLORGENIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathColorGenivNV");
+  glGetPathColorGenivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathCommandsNV (GLuint a0, GLubyte* a1)
+{
+  glGetPathCommandsNV = (PFNGLGETPATHCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathCommandsNV");
+  glGetPathCommandsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathCoordsNV (GLuint a0, GLfloat* a1)
+{
+  glGetPathCoordsNV = (PFNGLGETPATHCOORDSNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathCoordsNV");
+  glGetPathCoordsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathDashArrayNV (GLuint a0, GLfloat* a1)
+{
+  glGetPathDashArrayNV = (PFNGLGETPATHDASHARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathDashArrayNV");
+  glGetPathDashArrayNV(a0, a1);
+}
+
+static GLfloat GLAPIENTRY _glewLazy_glGetPathLengthNV (GLuint a0, GLsizei a1, GLsizei a2)
+{
+  glGetPathLengthNV = (PFNGLGETPATHLENGTHNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathLengthNV");
+  return glGetPathLengthNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathMetricRangeNV (GLbitfield a0, GLuint a1, GLsizei a2, GLsizei a3, GLfloat* a4)
+{
+  glGetPathMetricRangeNV = (PFNGLGETPATHMETRICRANGENVPROC)glewGetProcAddress((const GLubyte*)"glGetPathMetricRangeNV");
+  glGetPathMetricRangeNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathMetricsNV (GLbitfield a0, GLsizei a1, GLenum a2, const void * a3, GLuint a4, GLsizei a5, GLfloat * a6)
+{
+  glGetPathMetricsNV = (PFNGLGETPATHMETRICSNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathMetricsNV");
+  glGetPathMetricsNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathParameterfvNV (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetPathParameterfvNV = (PFNGLGETPATHPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathParameterfvNV");
+  glGetPathParameterfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathParameterivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetPathParameterivNV = (PFNGLGETPATHPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathParameterivNV");
+  glGetPathParameterivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathSpacingNV (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLuint a4, GLfloat a5, GLfloat a6, GLenum a7, GLfloat * a8)
+{
+  glGetPathSpacingNV = (PFNGLGETPATHSPACINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathSpacingNV");
+  glGetPathSpacingNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathTexGenfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetPathTexGenfvNV = (PFNGLGETPATHTEXGENFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathTexGenfvNV");
+  glGetPathTexGenfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathTexGenivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetPathTexGenivNV = (PFNGLGETPATHTEXGENIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathTexGenivNV");
+  glGetPathTexGenivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramResourcefvNV (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum* a4, GLsizei a5, GLsizei * a6, GLfloat * a7)
+{
+  glGetProgramResourcefvNV = (PFNGLGETPROGRAMRESOURCEFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourcefvNV");
+  glGetProgramResourcefvNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glInterpolatePathsNV (GLuint a0, GLuint a1, GLuint a2, GLfloat a3)
+{
+  glInterpolatePathsNV = (PFNGLINTERPOLATEPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glInterpolatePathsNV");
+  glInterpolatePathsNV(a0, a1, a2, a3);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsPathNV (GLuint a0)
+{
+  glIsPathNV = (PFNGLISPATHNVPROC)glewGetProcAddress((const GLubyte*)"glIsPathNV");
+  return glIsPathNV(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsPointInFillPathNV (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3)
+{
+  glIsPointInFillPathNV = (PFNGLISPOINTINFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glIsPointInFillPathNV");
+  return glIsPointInFillPathNV(a0, a1, a2, a3);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsPointInStrokePathNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  glIsPointInStrokePathNV = (PFNGLISPOINTINSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glIsPointInStrokePathNV");
+  return glIsPointInStrokePathNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoad3x2fNV (GLenum a0, const GLfloat* a1)
+{
+  glMatrixLoad3x2fNV = (PFNGLMATRIXLOAD3X2FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoad3x2fNV");
+  glMatrixLoad3x2fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoad3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  glMatrixLoad3x3fNV = (PFNGLMATRIXLOAD3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoad3x3fNV");
+  glMatrixLoad3x3fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadTranspose3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  glMatrixLoadTranspose3x3fNV = (PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadTranspose3x3fNV");
+  glMatrixLoadTranspose3x3fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMult3x2fNV (GLenum a0, const GLfloat* a1)
+{
+  glMatrixMult3x2fNV = (PFNGLMATRIXMULT3X2FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixMult3x2fNV");
+  glMatrixMult3x2fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMult3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  glMatrixMult3x3fNV = (PFNGLMATRIXMULT3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixMult3x3fNV");
+  glMatrixMult3x3fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultTranspose3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  glMatrixMultTranspose3x3fNV = (PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultTranspose3x3fNV");
+  glMatrixMultTranspose3x3fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPathColorGenNV (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  glPathColorGenNV = (PFNGLPATHCOLORGENNVPROC)glewGetProcAddress((const GLubyte*)"glPathColorGenNV");
+  glPathColorGenNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glPathCommandsNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLsizei a3, GLenum a4, const void* a5)
+{
+  glPathCommandsNV = (PFNGLPATHCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathCommandsNV");
+  glPathCommandsNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glPathCoordsNV (GLuint a0, GLsizei a1, GLenum a2, const void * a3)
+{
+  glPathCoordsNV = (PFNGLPATHCOORDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathCoordsNV");
+  glPathCoordsNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glPathCoverDepthFuncNV (GLenum a0)
+{
+  glPathCoverDepthFuncNV = (PFNGLPATHCOVERDEPTHFUNCNVPROC)glewGetProcAddress((const GLubyte*)"glPathCoverDepthFuncNV");
+  glPathCoverDepthFuncNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPathDashArrayNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  glPathDashArrayNV = (PFNGLPATHDASHARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glPathDashArrayNV");
+  glPathDashArrayNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPathFogGenNV (GLenum a0)
+{
+  glPathFogGenNV = (PFNGLPATHFOGGENNVPROC)glewGetProcAddress((const GLubyte*)"glPathFogGenNV");
+  glPathFogGenNV(a0);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glPathGlyphIndexArrayNV (GLuint a0, GLenum a1, const void * a2, GLbitfield a3, GLuint a4, GLsizei a5, GLuint a6, GLfloat a7)
+{
+  glPathGlyphIndexArrayNV = (PFNGLPATHGLYPHINDEXARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphIndexArrayNV");
+  return glPathGlyphIndexArrayNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glPathGlyphIndexRangeNV (GLenum a0, const void * a1, GLbitfield a2, GLuint a3, GLfloat a4, GLuint a5[2])
+{
+  glPathGlyphIndexRangeNV = (PFNGLPATHGLYPHINDEXRANGENVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphIndexRangeNV");
+  return glPathGlyphIndexRangeNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glPathGlyphRangeNV (GLuint a0, GLenum a1, const void * a2, GLbitfield a3, GLuint a4, GLsizei a5, GLenum a6, GLuint a7, GLfloat a8)
+{
+  glPathGlyphRangeNV = (PFNGLPATHGLYPHRANGENVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphRangeNV");
+  glPathGlyphRangeNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glPathGlyphsNV (GLuint a0, GLenum a1, const void * a2, GLbitfield a3, GLsizei a4, GLenum a5, const void* a6, GLenum a7, GLuint a8, GLfloat a9)
+{
+  glPathGlyphsNV = (PFNGLPATHGLYPHSNVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphsNV");
+  glPathGlyphsNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glPathMemoryGlyphIndexArrayNV (GLuint a0, GLenum a1, GLsizeiptr a2, const void * a3, GLsizei a4, GLuint a5, GLsizei a6, GLuint a7, GLfloat a8)
+{
+  glPathMemoryGlyphIndexArrayNV = (PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glPathMemoryGlyphIndexArrayNV");
+  return glPathMemoryGlyphIndexArrayNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameterfNV (GLuint a0, GLenum a1, GLfloat a2)
+{
+  glPathParameterfNV = (PFNGLPATHPARAMETERFNVPROC)glewGetProcAddress((const GLubyte*)"glPathParameterfNV");
+  glPathParameterfNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameterfvNV (GLuint a0, GLenum a1, const GLfloat* a2)
+{
+  glPathParameterfvNV = (PFNGLPATHPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glPathParameterfvNV");
+  glPathParameterfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameteriNV (GLuint a0, GLenum a1, GLint a2)
+{
+  glPathParameteriNV = (PFNGLPATHPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glPathParameteriNV");
+  glPathParameteriNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameterivNV (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glPathParameterivNV = (PFNGLPATHPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glPathParameterivNV");
+  glPathParameterivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPathStencilDepthOffsetNV (GLfloat a0, GLfloat a1)
+{
+  glPathStencilDepthOffsetNV = (PFNGLPATHSTENCILDEPTHOFFSETNVPROC)glewGetProcAddress((const GLubyte*)"glPathStencilDepthOffsetNV");
+  glPathStencilDepthOffsetNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPathStencilFuncNV (GLenum a0, GLint a1, GLuint a2)
+{
+  glPathStencilFuncNV = (PFNGLPATHSTENCILFUNCNVPROC)glewGetProcAddress((const GLubyte*)"glPathStencilFuncNV");
+  glPathStencilFuncNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPathStringNV (GLuint a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  glPathStringNV = (PFNGLPATHSTRINGNVPROC)glewGetProcAddress((const GLubyte*)"glPathStringNV");
+  glPathStringNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glPathSubCommandsNV (GLuint a0, GLsizei a1, GLsizei a2, GLsizei a3, const GLubyte* a4, GLsizei a5, GLenum a6, const void* a7)
+{
+  glPathSubCommandsNV = (PFNGLPATHSUBCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathSubCommandsNV");
+  glPathSubCommandsNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glPathSubCoordsNV (GLuint a0, GLsizei a1, GLsizei a2, GLenum a3, const void * a4)
+{
+  glPathSubCoordsNV = (PFNGLPATHSUBCOORDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathSubCoordsNV");
+  glPathSubCoordsNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glPathTexGenNV (GLenum a0, GLenum a1, GLint a2, const GLfloat* a3)
+{
+  glPathTexGenNV = (PFNGLPATHTEXGENNVPROC)glewGetProcAddress((const GLubyte*)"glPathTexGenNV");
+  glPathTexGenNV(a0, a1, a2, a3);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glPointAlongPathNV (GLuint a0, GLsizei a1, GLsizei a2, GLfloat a3, GLfloat* a4, GLfloat * a5, GLfloat * a6, GLfloat * a7)
+{
+  glPointAlongPathNV = (PFNGLPOINTALONGPATHNVPROC)glewGetProcAddress((const GLubyte*)"glPointAlongPathNV");
+  return glPointAlongPathNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramPathFragmentInputGenNV (GLuint a0, GLint a1, GLenum a2, GLint a3, const GLfloat* a4)
+{
+  glProgramPathFragmentInputGenNV = (PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)glewGetProcAddress((const GLubyte*)"glProgramPathFragmentInputGenNV");
+  glProgramPathFragmentInputGenNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilFillPathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLuint a5, GLenum a6, const GLfloat * a7)
+{
+  glStencilFillPathInstancedNV = (PFNGLSTENCILFILLPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilFillPathInstancedNV");
+  glStencilFillPathInstancedNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilFillPathNV (GLuint a0, GLenum a1, GLuint a2)
+{
+  glStencilFillPathNV = (PFNGLSTENCILFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilFillPathNV");
+  glStencilFillPathNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilStrokePathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLint a4, GLuint a5, GLenum a6, const GLfloat * a7)
+{
+  glStencilStrokePathInstancedNV = (PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilStrokePathInstancedNV");
+  glStencilStrokePathInstancedNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilStrokePathNV (GLuint a0, GLint a1, GLuint a2)
+{
+  glStencilStrokePathNV = (PFNGLSTENCILSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilStrokePathNV");
+  glStencilStrokePathNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverFillPathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLuint a5, GLenum a6, GLenum a7, const GLfloat * a8)
+{
+  glStencilThenCoverFillPathInstancedNV = (PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverFillPathInstancedNV");
+  glStencilThenCoverFillPathInstancedNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverFillPathNV (GLuint a0, GLenum a1, GLuint a2, GLenum a3)
+{
+  glStencilThenCoverFillPathNV = (PFNGLSTENCILTHENCOVERFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverFillPathNV");
+  glStencilThenCoverFillPathNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverStrokePathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLint a4, GLuint a5, GLenum a6, GLenum a7, const GLfloat * a8)
+{
+  glStencilThenCoverStrokePathInstancedNV = (PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverStrokePathInstancedNV");
+  glStencilThenCoverStrokePathInstancedNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverStrokePathNV (GLuint a0, GLint a1, GLuint a2, GLenum a3)
+{
+  glStencilThenCoverStrokePathNV = (PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverStrokePathNV");
+  glStencilThenCoverStrokePathNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformPathNV (GLuint a0, GLuint a1, GLenum a2, const GLfloat* a3)
+{
+  glTransformPathNV = (PFNGLTRANSFORMPATHNVPROC)glewGetProcAddress((const GLubyte*)"glTransformPathNV");
+  glTransformPathNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightPathsNV (GLuint a0, GLsizei a1, const GLuint a2[], const GLfloat a3[])
+{
+  glWeightPathsNV = (PFNGLWEIGHTPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glWeightPathsNV");
+  glWeightPathsNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFlushPixelDataRangeNV (GLenum a0)
+{
+  glFlushPixelDataRangeNV = (PFNGLFLUSHPIXELDATARANGENVPROC)glewGetProcAddress((const GLubyte*)"glFlushPixelDataRangeNV");
+  glFlushPixelDataRangeNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelDataRangeNV (GLenum a0, GLsizei a1, void * a2)
+{
+  glPixelDataRangeNV = (PFNGLPIXELDATARANGENVPROC)glewGetProcAddress((const GLubyte*)"glPixelDataRangeNV");
+  glPixelDataRangeNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPointParameteriNV (GLenum a0, GLint a1)
+{
+  glPointParameteriNV = (PFNGLPOINTPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glPointParameteriNV");
+  glPointParameteriNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterivNV (GLenum a0, const GLint* a1)
+{
+  glPointParameterivNV = (PFNGLPOINTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glPointParameterivNV");
+  glPointParameterivNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPolygonModeNV (GLenum a0, GLenum a1)
+{
+  glPolygonModeNV = (PFNGLPOLYGONMODENVPROC)glewGetProcAddress((const GLubyte*)"glPolygonModeNV");
+  glPolygonModeNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetVideoi64vNV (GLuint a0, GLenum a1, GLint64EXT* a2)
+{
+  glGetVideoi64vNV = (PFNGLGETVIDEOI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoi64vNV");
+  glGetVideoi64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVideoivNV = (PFNGLGETVIDEOIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoivNV");
+  glGetVideoivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoui64vNV (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  glGetVideoui64vNV = (PFNGLGETVIDEOUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoui64vNV");
+  glGetVideoui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideouivNV (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetVideouivNV = (PFNGLGETVIDEOUIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideouivNV");
+  glGetVideouivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPresentFrameDualFillNV (GLuint a0, GLuint64EXT a1, GLuint a2, GLuint a3, GLenum a4, GLenum a5, GLuint a6, GLenum a7, GLuint a8, GLenum a9, GLuint a10, GLenum a11, GLuint a12)
+{
+  glPresentFrameDualFillNV = (PFNGLPRESENTFRAMEDUALFILLNVPROC)glewGetProcAddress((const GLubyte*)"glPresentFrameDualFillNV");
+  glPresentFrameDualFillNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+}
+
+static void GLAPIENTRY _glewLazy_glPresentFrameKeyedNV (GLuint a0, GLuint64EXT a1, GLuint a2, GLuint a3, GLenum a4, GLenum a5, GLuint a6, GLuint a7, GLenum a8, GLuint a9, GLuint a10)
+{
+  glPresentFrameKeyedNV = (PFNGLPRESENTFRAMEKEYEDNVPROC)glewGetProcAddress((const GLubyte*)"glPresentFrameKeyedNV");
+  glPresentFrameKeyedNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPrimitiveRestartIndexNV (GLuint a0)
+{
+  glPrimitiveRestartIndexNV = (PFNGLPRIMITIVERESTARTINDEXNVPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveRestartIndexNV");
+  glPrimitiveRestartIndexNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPrimitiveRestartNV (void)
+{
+  glPrimitiveRestartNV = (PFNGLPRIMITIVERESTARTNVPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveRestartNV");
+  glPrimitiveRestartNV();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glReadBufferNV (GLenum a0)
+{
+  glReadBufferNV = (PFNGLREADBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glReadBufferNV");
+  glReadBufferNV(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCombinerInputNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5)
+{
+  glCombinerInputNV = (PFNGLCOMBINERINPUTNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerInputNV");
+  glCombinerInputNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerOutputNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5, GLenum a6, GLboolean a7, GLboolean a8, GLboolean a9)
+{
+  glCombinerOutputNV = (PFNGLCOMBINEROUTPUTNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerOutputNV");
+  glCombinerOutputNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameterfNV (GLenum a0, GLfloat a1)
+{
+  glCombinerParameterfNV = (PFNGLCOMBINERPARAMETERFNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameterfNV");
+  glCombinerParameterfNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameterfvNV (GLenum a0, const GLfloat* a1)
+{
+  glCombinerParameterfvNV = (PFNGLCOMBINERPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameterfvNV");
+  glCombinerParameterfvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameteriNV (GLenum a0, GLint a1)
+{
+  glCombinerParameteriNV = (PFNGLCOMBINERPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameteriNV");
+  glCombinerParameteriNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameterivNV (GLenum a0, const GLint* a1)
+{
+  glCombinerParameterivNV = (PFNGLCOMBINERPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameterivNV");
+  glCombinerParameterivNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFinalCombinerInputNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  glFinalCombinerInputNV = (PFNGLFINALCOMBINERINPUTNVPROC)glewGetProcAddress((const GLubyte*)"glFinalCombinerInputNV");
+  glFinalCombinerInputNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerInputParameterfvNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLfloat* a4)
+{
+  glGetCombinerInputParameterfvNV = (PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerInputParameterfvNV");
+  glGetCombinerInputParameterfvNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerInputParameterivNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLint* a4)
+{
+  glGetCombinerInputParameterivNV = (PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerInputParameterivNV");
+  glGetCombinerInputParameterivNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerOutputParameterfvNV (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  glGetCombinerOutputParameterfvNV = (PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerOutputParameterfvNV");
+  glGetCombinerOutputParameterfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerOutputParameterivNV (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetCombinerOutputParameterivNV = (PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerOutputParameterivNV");
+  glGetCombinerOutputParameterivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFinalCombinerInputParameterfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetFinalCombinerInputParameterfvNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetFinalCombinerInputParameterfvNV");
+  glGetFinalCombinerInputParameterfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFinalCombinerInputParameterivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetFinalCombinerInputParameterivNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetFinalCombinerInputParameterivNV");
+  glGetFinalCombinerInputParameterivNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCombinerStageParameterfvNV (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glCombinerStageParameterfvNV = (PFNGLCOMBINERSTAGEPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerStageParameterfvNV");
+  glCombinerStageParameterfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerStageParameterfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetCombinerStageParameterfvNV = (PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerStageParameterfvNV");
+  glGetCombinerStageParameterfvNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferSampleLocationsfvNV (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glFramebufferSampleLocationsfvNV = (PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)glewGetProcAddress((const GLubyte*)"glFramebufferSampleLocationsfvNV");
+  glFramebufferSampleLocationsfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferSampleLocationsfvNV (GLuint a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glNamedFramebufferSampleLocationsfvNV = (PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferSampleLocationsfvNV");
+  glNamedFramebufferSampleLocationsfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glResolveDepthValuesNV (void)
+{
+  glResolveDepthValuesNV = (PFNGLRESOLVEDEPTHVALUESNVPROC)glewGetProcAddress((const GLubyte*)"glResolveDepthValuesNV");
+  glResolveDepthValuesNV();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glScissorExclusiveArrayvNV (GLuint a0, GLsizei a1, const GLint* a2)
+{
+  glScissorExclusiveArrayvNV = (PFNGLSCISSOREXCLUSIVEARRAYVNVPROC)glewGetProcAddress((const GLubyte*)"glScissorExclusiveArrayvNV");
+  glScissorExclusiveArrayvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorExclusiveNV (GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glScissorExclusiveNV = (PFNGLSCISSOREXCLUSIVENVPROC)glewGetProcAddress((const GLubyte*)"glScissorExclusiveNV");
+  glScissorExclusiveNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameterui64vNV (GLenum a0, GLenum a1, GLuint64EXT* a2)
+{
+  glGetBufferParameterui64vNV = (PFNGLGETBUFFERPARAMETERUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameterui64vNV");
+  glGetBufferParameterui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegerui64vNV (GLenum a0, GLuint64EXT* a1)
+{
+  glGetIntegerui64vNV = (PFNGLGETINTEGERUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetIntegerui64vNV");
+  glGetIntegerui64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameterui64vNV (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  glGetNamedBufferParameterui64vNV = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameterui64vNV");
+  glGetNamedBufferParameterui64vNV(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsBufferResidentNV (GLenum a0)
+{
+  glIsBufferResidentNV = (PFNGLISBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsBufferResidentNV");
+  return glIsBufferResidentNV(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsNamedBufferResidentNV (GLuint a0)
+{
+  glIsNamedBufferResidentNV = (PFNGLISNAMEDBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsNamedBufferResidentNV");
+  return glIsNamedBufferResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeBufferNonResidentNV (GLenum a0)
+{
+  glMakeBufferNonResidentNV = (PFNGLMAKEBUFFERNONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeBufferNonResidentNV");
+  glMakeBufferNonResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeBufferResidentNV (GLenum a0, GLenum a1)
+{
+  glMakeBufferResidentNV = (PFNGLMAKEBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeBufferResidentNV");
+  glMakeBufferResidentNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeNamedBufferNonResidentNV (GLuint a0)
+{
+  glMakeNamedBufferNonResidentNV = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeNamedBufferNonResidentNV");
+  glMakeNamedBufferNonResidentNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeNamedBufferResidentNV (GLuint a0, GLenum a1)
+{
+  glMakeNamedBufferResidentNV = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeNamedBufferResidentNV");
+  glMakeNamedBufferResidentNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformui64NV (GLuint a0, GLint a1, GLuint64EXT a2)
+{
+  glProgramUniformui64NV = (PFNGLPROGRAMUNIFORMUI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformui64NV");
+  glProgramUniformui64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  glProgramUniformui64vNV = (PFNGLPROGRAMUNIFORMUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformui64vNV");
+  glProgramUniformui64vNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformui64NV (GLint a0, GLuint64EXT a1)
+{
+  glUniformui64NV = (PFNGLUNIFORMUI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniformui64NV");
+  glUniformui64NV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  glUniformui64vNV = (PFNGLUNIFORMUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniformui64vNV");
+  glUniformui64vNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindShadingRateImageNV (GLuint a0)
+{
+  glBindShadingRateImageNV = (PFNGLBINDSHADINGRATEIMAGENVPROC)glewGetProcAddress((const GLubyte*)"glBindShadingRateImageNV");
+  glBindShadingRateImageNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShadingRateImagePaletteNV (GLuint a0, GLuint a1, GLenum* a2)
+{
+  glGetShadingRateImagePaletteNV = (PFNGLGETSHADINGRATEIMAGEPALETTENVPROC)glewGetProcAddress((const GLubyte*)"glGetShadingRateImagePaletteNV");
+  glGetShadingRateImagePaletteNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShadingRateSampleLocationivNV (GLenum a0, GLuint a1, GLuint a2, GLint* a3)
+{
+  glGetShadingRateSampleLocationivNV = (PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetShadingRateSampleLocationivNV");
+  glGetShadingRateSampleLocationivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glShadingRateImageBarrierNV (GLenum a0)
+{
+  glShadingRateImageBarrierNV = (PFNGLSHADINGRATEIMAGEBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glShadingRateImageBarrierNV");
+  glShadingRateImageBarrierNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glShadingRateImagePaletteNV (GLuint a0, GLuint a1, GLsizei a2, const GLenum* a3)
+{
+  glShadingRateImagePaletteNV = (PFNGLSHADINGRATEIMAGEPALETTENVPROC)glewGetProcAddress((const GLubyte*)"glShadingRateImagePaletteNV");
+  glShadingRateImagePaletteNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glShadingRateSampleOrderCustomNV (GLenum a0, GLuint a1, const GLint* a2)
+{
+  glShadingRateSampleOrderCustomNV = (PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC)glewGetProcAddress((const GLubyte*)"glShadingRateSampleOrderCustomNV");
+  glShadingRateSampleOrderCustomNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage3DNV (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  glCompressedTexImage3DNV = (PFNGLCOMPRESSEDTEXIMAGE3DNVPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage3DNV");
+  glCompressedTexImage3DNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage3DNV (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  glCompressedTexSubImage3DNV = (PFNGLCOMPRESSEDTEXSUBIMAGE3DNVPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage3DNV");
+  glCompressedTexSubImage3DNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage3DNV (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyTexSubImage3DNV = (PFNGLCOPYTEXSUBIMAGE3DNVPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage3DNV");
+  glCopyTexSubImage3DNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayerNV (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  glFramebufferTextureLayerNV = (PFNGLFRAMEBUFFERTEXTURELAYERNVPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayerNV");
+  glFramebufferTextureLayerNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3DNV (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glTexImage3DNV = (PFNGLTEXIMAGE3DNVPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DNV");
+  glTexImage3DNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage3DNV (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTexSubImage3DNV = (PFNGLTEXSUBIMAGE3DNVPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage3DNV");
+  glTexSubImage3DNV(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureBarrierNV (void)
+{
+  glTextureBarrierNV = (PFNGLTEXTUREBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glTextureBarrierNV");
+  glTextureBarrierNV();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexImage2DMultisampleCoverageNV (GLenum a0, GLsizei a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTexImage2DMultisampleCoverageNV = (PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTexImage2DMultisampleCoverageNV");
+  glTexImage2DMultisampleCoverageNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3DMultisampleCoverageNV (GLenum a0, GLsizei a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  glTexImage3DMultisampleCoverageNV = (PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DMultisampleCoverageNV");
+  glTexImage3DMultisampleCoverageNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage2DMultisampleCoverageNV (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3, GLint a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  glTextureImage2DMultisampleCoverageNV = (PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage2DMultisampleCoverageNV");
+  glTextureImage2DMultisampleCoverageNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage2DMultisampleNV (GLuint a0, GLenum a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTextureImage2DMultisampleNV = (PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage2DMultisampleNV");
+  glTextureImage2DMultisampleNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage3DMultisampleCoverageNV (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  glTextureImage3DMultisampleCoverageNV = (PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage3DMultisampleCoverageNV");
+  glTextureImage3DMultisampleCoverageNV(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage3DMultisampleNV (GLuint a0, GLenum a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  glTextureImage3DMultisampleNV = (PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage3DMultisampleNV");
+  glTextureImage3DMultisampleNV(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glActiveVaryingNV (GLuint a0, const GLchar * a1)
+{
+  glActiveVaryingNV = (PFNGLACTIVEVARYINGNVPROC)glewGetProcAddress((const GLubyte*)"glActiveVaryingNV");
+  glActiveVaryingNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBeginTransformFeedbackNV (GLenum a0)
+{
+  glBeginTransformFeedbackNV = (PFNGLBEGINTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glBeginTransformFeedbackNV");
+  glBeginTransformFeedbackNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferBaseNV (GLenum a0, GLuint a1, GLuint a2)
+{
+  glBindBufferBaseNV = (PFNGLBINDBUFFERBASENVPROC)glewGetProcAddress((const GLubyte*)"glBindBufferBaseNV");
+  glBindBufferBaseNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferOffsetNV (GLenum a0, GLuint a1, GLuint a2, GLintptr a3)
+{
+  glBindBufferOffsetNV = (PFNGLBINDBUFFEROFFSETNVPROC)glewGetProcAddress((const GLubyte*)"glBindBufferOffsetNV");
+  glBindBufferOffsetNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferRangeNV (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glBindBufferRangeNV = (PFNGLBINDBUFFERRANGENVPROC)glewGetProcAddress((const GLubyte*)"glBindBufferRangeNV");
+  glBindBufferRangeNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glEndTransformFeedbackNV (void)
+{
+  glEndTransformFeedbackNV = (PFNGLENDTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glEndTransformFeedbackNV");
+  glEndTransformFeedbackNV();
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveVaryingNV (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLsizei * a4, GLenum * a5, GLchar * a6)
+{
+  glGetActiveVaryingNV = (PFNGLGETACTIVEVARYINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveVaryingNV");
+  glGetActiveVaryingNV(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackVaryingNV (GLuint a0, GLuint a1, GLint * a2)
+{
+  glGetTransformFeedbackVaryingNV = (PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackVaryingNV");
+  glGetTransformFeedbackVaryingNV(a0, a1, a2);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetVaryingLocationNV (GLuint a0, const GLchar * a1)
+{
+  glGetVaryingLocationNV = (PFNGLGETVARYINGLOCATIONNVPROC)glewGetProcAddress((const GLubyte*)"glGetVaryingLocationNV");
+  return glGetVaryingLocationNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackAttribsNV (GLuint a0, const GLint * a1, GLenum a2)
+{
+  glTransformFeedbackAttribsNV = (PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackAttribsNV");
+  glTransformFeedbackAttribsNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackVaryingsNV (GLuint a0, GLsizei a1, const GLint * a2, GLenum a3)
+{
+  glTransformFeedbackVaryingsNV = (PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackVaryingsNV");
+  glTransformFeedbackVaryingsNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindTransformFeedbackNV (GLenum a0, GLuint a1)
+{
+  glBindTransformFeedbackNV = (PFNGLBINDTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glBindTransformFeedbackNV");
+  glBindTransformFeedbackNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteTransformFeedbacksNV (GLsizei a0, const GLuint* a1)
+{
+  glDeleteTransformFeedbacksNV = (PFNGLDELETETRANSFORMFEEDBACKSNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteTransformFeedbacksNV");
+  glDeleteTransformFeedbacksNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackNV (GLenum a0, GLuint a1)
+{
+  glDrawTransformFeedbackNV = (PFNGLDRAWTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackNV");
+  glDrawTransformFeedbackNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenTransformFeedbacksNV (GLsizei a0, GLuint* a1)
+{
+  glGenTransformFeedbacksNV = (PFNGLGENTRANSFORMFEEDBACKSNVPROC)glewGetProcAddress((const GLubyte*)"glGenTransformFeedbacksNV");
+  glGenTransformFeedbacksNV(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTransformFeedbackNV (GLuint a0)
+{
+  glIsTransformFeedbackNV = (PFNGLISTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glIsTransformFeedbackNV");
+  return glIsTransformFeedbackNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPauseTransformFeedbackNV (void)
+{
+  glPauseTransformFeedbackNV = (PFNGLPAUSETRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glPauseTransformFeedbackNV");
+  glPauseTransformFeedbackNV();
+}
+
+static void GLAPIENTRY _glewLazy_glResumeTransformFeedbackNV (void)
+{
+  glResumeTransformFeedbackNV = (PFNGLRESUMETRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glResumeTransformFeedbackNV");
+  glResumeTransformFeedbackNV();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glVDPAUFiniNV (void)
+{
+  glVDPAUFiniNV = (PFNGLVDPAUFININVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUFiniNV");
+  glVDPAUFiniNV();
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUGetSurfaceivNV (GLvdpauSurfaceNV a0, GLenum a1, GLsizei a2, GLsizei* a3, GLint * a4)
+{
+  glVDPAUGetSurfaceivNV = (PFNGLVDPAUGETSURFACEIVNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUGetSurfaceivNV");
+  glVDPAUGetSurfaceivNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUInitNV (const void* a0, const void* a1)
+{
+  glVDPAUInitNV = (PFNGLVDPAUINITNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUInitNV");
+  glVDPAUInitNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUIsSurfaceNV (GLvdpauSurfaceNV a0)
+{
+  glVDPAUIsSurfaceNV = (PFNGLVDPAUISSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUIsSurfaceNV");
+  glVDPAUIsSurfaceNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUMapSurfacesNV (GLsizei a0, const GLvdpauSurfaceNV* a1)
+{
+  glVDPAUMapSurfacesNV = (PFNGLVDPAUMAPSURFACESNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUMapSurfacesNV");
+  glVDPAUMapSurfacesNV(a0, a1);
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewLazy_glVDPAURegisterOutputSurfaceNV (const void* a0, GLenum a1, GLsizei a2, const GLuint * a3)
+{
+  glVDPAURegisterOutputSurfaceNV = (PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAURegisterOutputSurfaceNV");
+  return glVDPAURegisterOutputSurfaceNV(a0, a1, a2, a3);
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewLazy_glVDPAURegisterVideoSurfaceNV (const void* a0, GLenum a1, GLsizei a2, const GLuint * a3)
+{
+  glVDPAURegisterVideoSurfaceNV = (PFNGLVDPAUREGISTERVIDEOSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAURegisterVideoSurfaceNV");
+  return glVDPAURegisterVideoSurfaceNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUSurfaceAccessNV (GLvdpauSurfaceNV a0, GLenum a1)
+{
+  glVDPAUSurfaceAccessNV = (PFNGLVDPAUSURFACEACCESSNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUSurfaceAccessNV");
+  glVDPAUSurfaceAccessNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUUnmapSurfacesNV (GLsizei a0, const GLvdpauSurfaceNV* a1)
+{
+  glVDPAUUnmapSurfacesNV = (PFNGLVDPAUUNMAPSURFACESNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUUnmapSurfacesNV");
+  glVDPAUUnmapSurfacesNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUUnregisterSurfaceNV (GLvdpauSurfaceNV a0)
+{
+  glVDPAUUnregisterSurfaceNV = (PFNGLVDPAUUNREGISTERSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUUnregisterSurfaceNV");
+  glVDPAUUnregisterSurfaceNV(a0);
+}
+
+
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewLazy_glVDPAURegisterVideoSurfaceWithPictureStructureNV (const void * a0, GLenum a1, GLsizei a2, const GLuint * a3, GLboolean a4)
+{
+  glVDPAURegisterVideoSurfaceWithPictureStructureNV = (PFNGLVDPAUREGISTERVIDEOSURFACEWITHPICTURESTRUCTURENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAURegisterVideoSurfaceWithPictureStructureNV");
+  return glVDPAURegisterVideoSurfaceWithPictureStructureNV(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFlushVertexArrayRangeNV (void)
+{
+  glFlushVertexArrayRangeNV = (PFNGLFLUSHVERTEXARRAYRANGENVPROC)glewGetProcAddress((const GLubyte*)"glFlushVertexArrayRangeNV");
+  glFlushVertexArrayRangeNV();
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayRangeNV (GLsizei a0, void * a1)
+{
+  glVertexArrayRangeNV = (PFNGLVERTEXARRAYRANGENVPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayRangeNV");
+  glVertexArrayRangeNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLi64vNV (GLuint a0, GLenum a1, GLint64EXT* a2)
+{
+  glGetVertexAttribLi64vNV = (PFNGLGETVERTEXATTRIBLI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLi64vNV");
+  glGetVertexAttribLi64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLui64vNV (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  glGetVertexAttribLui64vNV = (PFNGLGETVERTEXATTRIBLUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLui64vNV");
+  glGetVertexAttribLui64vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1i64NV (GLuint a0, GLint64EXT a1)
+{
+  glVertexAttribL1i64NV = (PFNGLVERTEXATTRIBL1I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1i64NV");
+  glVertexAttribL1i64NV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  glVertexAttribL1i64vNV = (PFNGLVERTEXATTRIBL1I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1i64vNV");
+  glVertexAttribL1i64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64NV (GLuint a0, GLuint64EXT a1)
+{
+  glVertexAttribL1ui64NV = (PFNGLVERTEXATTRIBL1UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64NV");
+  glVertexAttribL1ui64NV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  glVertexAttribL1ui64vNV = (PFNGLVERTEXATTRIBL1UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64vNV");
+  glVertexAttribL1ui64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2i64NV (GLuint a0, GLint64EXT a1, GLint64EXT a2)
+{
+  glVertexAttribL2i64NV = (PFNGLVERTEXATTRIBL2I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2i64NV");
+  glVertexAttribL2i64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  glVertexAttribL2i64vNV = (PFNGLVERTEXATTRIBL2I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2i64vNV");
+  glVertexAttribL2i64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2ui64NV (GLuint a0, GLuint64EXT a1, GLuint64EXT a2)
+{
+  glVertexAttribL2ui64NV = (PFNGLVERTEXATTRIBL2UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2ui64NV");
+  glVertexAttribL2ui64NV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  glVertexAttribL2ui64vNV = (PFNGLVERTEXATTRIBL2UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2ui64vNV");
+  glVertexAttribL2ui64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3i64NV (GLuint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3)
+{
+  glVertexAttribL3i64NV = (PFNGLVERTEXATTRIBL3I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3i64NV");
+  glVertexAttribL3i64NV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  glVertexAttribL3i64vNV = (PFNGLVERTEXATTRIBL3I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3i64vNV");
+  glVertexAttribL3i64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3ui64NV (GLuint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  glVertexAttribL3ui64NV = (PFNGLVERTEXATTRIBL3UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3ui64NV");
+  glVertexAttribL3ui64NV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  glVertexAttribL3ui64vNV = (PFNGLVERTEXATTRIBL3UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3ui64vNV");
+  glVertexAttribL3ui64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4i64NV (GLuint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4)
+{
+  glVertexAttribL4i64NV = (PFNGLVERTEXATTRIBL4I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4i64NV");
+  glVertexAttribL4i64NV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  glVertexAttribL4i64vNV = (PFNGLVERTEXATTRIBL4I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4i64vNV");
+  glVertexAttribL4i64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4ui64NV (GLuint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4)
+{
+  glVertexAttribL4ui64NV = (PFNGLVERTEXATTRIBL4UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4ui64NV");
+  glVertexAttribL4ui64NV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  glVertexAttribL4ui64vNV = (PFNGLVERTEXATTRIBL4UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4ui64vNV");
+  glVertexAttribL4ui64vNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLFormatNV (GLuint a0, GLint a1, GLenum a2, GLsizei a3)
+{
+  glVertexAttribLFormatNV = (PFNGLVERTEXATTRIBLFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLFormatNV");
+  glVertexAttribLFormatNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBufferAddressRangeNV (GLenum a0, GLuint a1, GLuint64EXT a2, GLsizeiptr a3)
+{
+  glBufferAddressRangeNV = (PFNGLBUFFERADDRESSRANGENVPROC)glewGetProcAddress((const GLubyte*)"glBufferAddressRangeNV");
+  glBufferAddressRangeNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  glColorFormatNV = (PFNGLCOLORFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glColorFormatNV");
+  glColorFormatNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glEdgeFlagFormatNV (GLsizei a0)
+{
+  glEdgeFlagFormatNV = (PFNGLEDGEFLAGFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glEdgeFlagFormatNV");
+  glEdgeFlagFormatNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordFormatNV (GLenum a0, GLsizei a1)
+{
+  glFogCoordFormatNV = (PFNGLFOGCOORDFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordFormatNV");
+  glFogCoordFormatNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegerui64i_vNV (GLenum a0, GLuint a1, GLuint64EXT a2[])
+{
+  glGetIntegerui64i_vNV = (PFNGLGETINTEGERUI64I_VNVPROC)glewGetProcAddress((const GLubyte*)"glGetIntegerui64i_vNV");
+  glGetIntegerui64i_vNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glIndexFormatNV (GLenum a0, GLsizei a1)
+{
+  glIndexFormatNV = (PFNGLINDEXFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glIndexFormatNV");
+  glIndexFormatNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalFormatNV (GLenum a0, GLsizei a1)
+{
+  glNormalFormatNV = (PFNGLNORMALFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glNormalFormatNV");
+  glNormalFormatNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  glSecondaryColorFormatNV = (PFNGLSECONDARYCOLORFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorFormatNV");
+  glSecondaryColorFormatNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  glTexCoordFormatNV = (PFNGLTEXCOORDFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordFormatNV");
+  glTexCoordFormatNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribFormatNV (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4)
+{
+  glVertexAttribFormatNV = (PFNGLVERTEXATTRIBFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribFormatNV");
+  glVertexAttribFormatNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIFormatNV (GLuint a0, GLint a1, GLenum a2, GLsizei a3)
+{
+  glVertexAttribIFormatNV = (PFNGLVERTEXATTRIBIFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIFormatNV");
+  glVertexAttribIFormatNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  glVertexFormatNV = (PFNGLVERTEXFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexFormatNV");
+  glVertexFormatNV(a0, a1, a2);
+}
+
+
+
+static GLboolean GLAPIENTRY _glewLazy_glAreProgramsResidentNV (GLsizei a0, const GLuint* a1, GLboolean * a2)
+{
+  glAreProgramsResidentNV = (PFNGLAREPROGRAMSRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glAreProgramsResidentNV");
+  return glAreProgramsResidentNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindProgramNV (GLenum a0, GLuint a1)
+{
+  glBindProgramNV = (PFNGLBINDPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glBindProgramNV");
+  glBindProgramNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgramsNV (GLsizei a0, const GLuint* a1)
+{
+  glDeleteProgramsNV = (PFNGLDELETEPROGRAMSNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgramsNV");
+  glDeleteProgramsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glExecuteProgramNV (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  glExecuteProgramNV = (PFNGLEXECUTEPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glExecuteProgramNV");
+  glExecuteProgramNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGenProgramsNV (GLsizei a0, GLuint* a1)
+{
+  glGenProgramsNV = (PFNGLGENPROGRAMSNVPROC)glewGetProcAddress((const GLubyte*)"glGenProgramsNV");
+  glGenProgramsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramParameterdvNV (GLenum a0, GLuint a1, GLenum a2, GLdouble* a3)
+{
+  glGetProgramParameterdvNV = (PFNGLGETPROGRAMPARAMETERDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramParameterdvNV");
+  glGetProgramParameterdvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramParameterfvNV (GLenum a0, GLuint a1, GLenum a2, GLfloat* a3)
+{
+  glGetProgramParameterfvNV = (PFNGLGETPROGRAMPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramParameterfvNV");
+  glGetProgramParameterfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramStringNV (GLuint a0, GLenum a1, GLubyte* a2)
+{
+  glGetProgramStringNV = (PFNGLGETPROGRAMSTRINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramStringNV");
+  glGetProgramStringNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetProgramivNV = (PFNGLGETPROGRAMIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramivNV");
+  glGetProgramivNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTrackMatrixivNV (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetTrackMatrixivNV = (PFNGLGETTRACKMATRIXIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetTrackMatrixivNV");
+  glGetTrackMatrixivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribPointervNV (GLuint a0, GLenum a1, void** a2)
+{
+  glGetVertexAttribPointervNV = (PFNGLGETVERTEXATTRIBPOINTERVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribPointervNV");
+  glGetVertexAttribPointervNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribdvNV (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  glGetVertexAttribdvNV = (PFNGLGETVERTEXATTRIBDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribdvNV");
+  glGetVertexAttribdvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribfvNV (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  glGetVertexAttribfvNV = (PFNGLGETVERTEXATTRIBFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribfvNV");
+  glGetVertexAttribfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVertexAttribivNV = (PFNGLGETVERTEXATTRIBIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribivNV");
+  glGetVertexAttribivNV(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgramNV (GLuint a0)
+{
+  glIsProgramNV = (PFNGLISPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glIsProgramNV");
+  return glIsProgramNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadProgramNV (GLenum a0, GLuint a1, GLsizei a2, const GLubyte* a3)
+{
+  glLoadProgramNV = (PFNGLLOADPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glLoadProgramNV");
+  glLoadProgramNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4dNV (GLenum a0, GLuint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  glProgramParameter4dNV = (PFNGLPROGRAMPARAMETER4DNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4dNV");
+  glProgramParameter4dNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4dvNV (GLenum a0, GLuint a1, const GLdouble* a2)
+{
+  glProgramParameter4dvNV = (PFNGLPROGRAMPARAMETER4DVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4dvNV");
+  glProgramParameter4dvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4fNV (GLenum a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glProgramParameter4fNV = (PFNGLPROGRAMPARAMETER4FNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4fNV");
+  glProgramParameter4fNV(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4fvNV (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  glProgramParameter4fvNV = (PFNGLPROGRAMPARAMETER4FVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4fvNV");
+  glProgramParameter4fvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameters4dvNV (GLenum a0, GLuint a1, GLsizei a2, const GLdouble* a3)
+{
+  glProgramParameters4dvNV = (PFNGLPROGRAMPARAMETERS4DVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameters4dvNV");
+  glProgramParameters4dvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameters4fvNV (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  glProgramParameters4fvNV = (PFNGLPROGRAMPARAMETERS4FVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameters4fvNV");
+  glProgramParameters4fvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glRequestResidentProgramsNV (GLsizei a0, GLuint* a1)
+{
+  glRequestResidentProgramsNV = (PFNGLREQUESTRESIDENTPROGRAMSNVPROC)glewGetProcAddress((const GLubyte*)"glRequestResidentProgramsNV");
+  glRequestResidentProgramsNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTrackMatrixNV (GLenum a0, GLuint a1, GLenum a2, GLenum a3)
+{
+  glTrackMatrixNV = (PFNGLTRACKMATRIXNVPROC)glewGetProcAddress((const GLubyte*)"glTrackMatrixNV");
+  glTrackMatrixNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dNV (GLuint a0, GLdouble a1)
+{
+  glVertexAttrib1dNV = (PFNGLVERTEXATTRIB1DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dNV");
+  glVertexAttrib1dNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dvNV (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib1dvNV = (PFNGLVERTEXATTRIB1DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dvNV");
+  glVertexAttrib1dvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fNV (GLuint a0, GLfloat a1)
+{
+  glVertexAttrib1fNV = (PFNGLVERTEXATTRIB1FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fNV");
+  glVertexAttrib1fNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fvNV (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib1fvNV = (PFNGLVERTEXATTRIB1FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fvNV");
+  glVertexAttrib1fvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1sNV (GLuint a0, GLshort a1)
+{
+  glVertexAttrib1sNV = (PFNGLVERTEXATTRIB1SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1sNV");
+  glVertexAttrib1sNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1svNV (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib1svNV = (PFNGLVERTEXATTRIB1SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1svNV");
+  glVertexAttrib1svNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dNV (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  glVertexAttrib2dNV = (PFNGLVERTEXATTRIB2DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dNV");
+  glVertexAttrib2dNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dvNV (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib2dvNV = (PFNGLVERTEXATTRIB2DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dvNV");
+  glVertexAttrib2dvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  glVertexAttrib2fNV = (PFNGLVERTEXATTRIB2FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fNV");
+  glVertexAttrib2fNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fvNV (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib2fvNV = (PFNGLVERTEXATTRIB2FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fvNV");
+  glVertexAttrib2fvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2sNV (GLuint a0, GLshort a1, GLshort a2)
+{
+  glVertexAttrib2sNV = (PFNGLVERTEXATTRIB2SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2sNV");
+  glVertexAttrib2sNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2svNV (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib2svNV = (PFNGLVERTEXATTRIB2SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2svNV");
+  glVertexAttrib2svNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dNV (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  glVertexAttrib3dNV = (PFNGLVERTEXATTRIB3DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dNV");
+  glVertexAttrib3dNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dvNV (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib3dvNV = (PFNGLVERTEXATTRIB3DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dvNV");
+  glVertexAttrib3dvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fNV (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glVertexAttrib3fNV = (PFNGLVERTEXATTRIB3FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fNV");
+  glVertexAttrib3fNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fvNV (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib3fvNV = (PFNGLVERTEXATTRIB3FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fvNV");
+  glVertexAttrib3fvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3sNV (GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  glVertexAttrib3sNV = (PFNGLVERTEXATTRIB3SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3sNV");
+  glVertexAttrib3sNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3svNV (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib3svNV = (PFNGLVERTEXATTRIB3SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3svNV");
+  glVertexAttrib3svNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dNV (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  glVertexAttrib4dNV = (PFNGLVERTEXATTRIB4DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dNV");
+  glVertexAttrib4dNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dvNV (GLuint a0, const GLdouble* a1)
+{
+  glVertexAttrib4dvNV = (PFNGLVERTEXATTRIB4DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dvNV");
+  glVertexAttrib4dvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fNV (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glVertexAttrib4fNV = (PFNGLVERTEXATTRIB4FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fNV");
+  glVertexAttrib4fNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fvNV (GLuint a0, const GLfloat* a1)
+{
+  glVertexAttrib4fvNV = (PFNGLVERTEXATTRIB4FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fvNV");
+  glVertexAttrib4fvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4sNV (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  glVertexAttrib4sNV = (PFNGLVERTEXATTRIB4SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4sNV");
+  glVertexAttrib4sNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4svNV (GLuint a0, const GLshort* a1)
+{
+  glVertexAttrib4svNV = (PFNGLVERTEXATTRIB4SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4svNV");
+  glVertexAttrib4svNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubNV (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+{
+  glVertexAttrib4ubNV = (PFNGLVERTEXATTRIB4UBNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubNV");
+  glVertexAttrib4ubNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubvNV (GLuint a0, const GLubyte* a1)
+{
+  glVertexAttrib4ubvNV = (PFNGLVERTEXATTRIB4UBVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubvNV");
+  glVertexAttrib4ubvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribPointerNV (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  glVertexAttribPointerNV = (PFNGLVERTEXATTRIBPOINTERNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribPointerNV");
+  glVertexAttribPointerNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  glVertexAttribs1dvNV = (PFNGLVERTEXATTRIBS1DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1dvNV");
+  glVertexAttribs1dvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  glVertexAttribs1fvNV = (PFNGLVERTEXATTRIBS1FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1fvNV");
+  glVertexAttribs1fvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  glVertexAttribs1svNV = (PFNGLVERTEXATTRIBS1SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1svNV");
+  glVertexAttribs1svNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  glVertexAttribs2dvNV = (PFNGLVERTEXATTRIBS2DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2dvNV");
+  glVertexAttribs2dvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  glVertexAttribs2fvNV = (PFNGLVERTEXATTRIBS2FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2fvNV");
+  glVertexAttribs2fvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  glVertexAttribs2svNV = (PFNGLVERTEXATTRIBS2SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2svNV");
+  glVertexAttribs2svNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  glVertexAttribs3dvNV = (PFNGLVERTEXATTRIBS3DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3dvNV");
+  glVertexAttribs3dvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  glVertexAttribs3fvNV = (PFNGLVERTEXATTRIBS3FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3fvNV");
+  glVertexAttribs3fvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  glVertexAttribs3svNV = (PFNGLVERTEXATTRIBS3SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3svNV");
+  glVertexAttribs3svNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  glVertexAttribs4dvNV = (PFNGLVERTEXATTRIBS4DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4dvNV");
+  glVertexAttribs4dvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  glVertexAttribs4fvNV = (PFNGLVERTEXATTRIBS4FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4fvNV");
+  glVertexAttribs4fvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  glVertexAttribs4svNV = (PFNGLVERTEXATTRIBS4SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4svNV");
+  glVertexAttribs4svNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4ubvNV (GLuint a0, GLsizei a1, const GLubyte* a2)
+{
+  glVertexAttribs4ubvNV = (PFNGLVERTEXATTRIBS4UBVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4ubvNV");
+  glVertexAttribs4ubvNV(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBeginVideoCaptureNV (GLuint a0)
+{
+  glBeginVideoCaptureNV = (PFNGLBEGINVIDEOCAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glBeginVideoCaptureNV");
+  glBeginVideoCaptureNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVideoCaptureStreamBufferNV (GLuint a0, GLuint a1, GLenum a2, GLintptrARB a3)
+{
+  glBindVideoCaptureStreamBufferNV = (PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glBindVideoCaptureStreamBufferNV");
+  glBindVideoCaptureStreamBufferNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVideoCaptureStreamTextureNV (GLuint a0, GLuint a1, GLenum a2, GLenum a3, GLuint a4)
+{
+  glBindVideoCaptureStreamTextureNV = (PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)glewGetProcAddress((const GLubyte*)"glBindVideoCaptureStreamTextureNV");
+  glBindVideoCaptureStreamTextureNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glEndVideoCaptureNV (GLuint a0)
+{
+  glEndVideoCaptureNV = (PFNGLENDVIDEOCAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glEndVideoCaptureNV");
+  glEndVideoCaptureNV(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureStreamdvNV (GLuint a0, GLuint a1, GLenum a2, GLdouble* a3)
+{
+  glGetVideoCaptureStreamdvNV = (PFNGLGETVIDEOCAPTURESTREAMDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureStreamdvNV");
+  glGetVideoCaptureStreamdvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureStreamfvNV (GLuint a0, GLuint a1, GLenum a2, GLfloat* a3)
+{
+  glGetVideoCaptureStreamfvNV = (PFNGLGETVIDEOCAPTURESTREAMFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureStreamfvNV");
+  glGetVideoCaptureStreamfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureStreamivNV (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  glGetVideoCaptureStreamivNV = (PFNGLGETVIDEOCAPTURESTREAMIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureStreamivNV");
+  glGetVideoCaptureStreamivNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetVideoCaptureivNV = (PFNGLGETVIDEOCAPTUREIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureivNV");
+  glGetVideoCaptureivNV(a0, a1, a2);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glVideoCaptureNV (GLuint a0, GLuint* a1, GLuint64EXT * a2)
+{
+  glVideoCaptureNV = (PFNGLVIDEOCAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureNV");
+  return glVideoCaptureNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glVideoCaptureStreamParameterdvNV (GLuint a0, GLuint a1, GLenum a2, const GLdouble* a3)
+{
+  glVideoCaptureStreamParameterdvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureStreamParameterdvNV");
+  glVideoCaptureStreamParameterdvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVideoCaptureStreamParameterfvNV (GLuint a0, GLuint a1, GLenum a2, const GLfloat* a3)
+{
+  glVideoCaptureStreamParameterfvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureStreamParameterfvNV");
+  glVideoCaptureStreamParameterfvNV(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glVideoCaptureStreamParameterivNV (GLuint a0, GLuint a1, GLenum a2, const GLint* a3)
+{
+  glVideoCaptureStreamParameterivNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureStreamParameterivNV");
+  glVideoCaptureStreamParameterivNV(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDepthRangeArrayfvNV (GLuint a0, GLsizei a1, const GLfloat * a2)
+{
+  glDepthRangeArrayfvNV = (PFNGLDEPTHRANGEARRAYFVNVPROC)glewGetProcAddress((const GLubyte*)"glDepthRangeArrayfvNV");
+  glDepthRangeArrayfvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangeIndexedfNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  glDepthRangeIndexedfNV = (PFNGLDEPTHRANGEINDEXEDFNVPROC)glewGetProcAddress((const GLubyte*)"glDepthRangeIndexedfNV");
+  glDepthRangeIndexedfNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableiNV (GLenum a0, GLuint a1)
+{
+  glDisableiNV = (PFNGLDISABLEINVPROC)glewGetProcAddress((const GLubyte*)"glDisableiNV");
+  glDisableiNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableiNV (GLenum a0, GLuint a1)
+{
+  glEnableiNV = (PFNGLENABLEINVPROC)glewGetProcAddress((const GLubyte*)"glEnableiNV");
+  glEnableiNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloati_vNV (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  glGetFloati_vNV = (PFNGLGETFLOATI_VNVPROC)glewGetProcAddress((const GLubyte*)"glGetFloati_vNV");
+  glGetFloati_vNV(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnablediNV (GLenum a0, GLuint a1)
+{
+  glIsEnablediNV = (PFNGLISENABLEDINVPROC)glewGetProcAddress((const GLubyte*)"glIsEnablediNV");
+  return glIsEnablediNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorArrayvNV (GLuint a0, GLsizei a1, const GLint * a2)
+{
+  glScissorArrayvNV = (PFNGLSCISSORARRAYVNVPROC)glewGetProcAddress((const GLubyte*)"glScissorArrayvNV");
+  glScissorArrayvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorIndexedNV (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+{
+  glScissorIndexedNV = (PFNGLSCISSORINDEXEDNVPROC)glewGetProcAddress((const GLubyte*)"glScissorIndexedNV");
+  glScissorIndexedNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorIndexedvNV (GLuint a0, const GLint * a1)
+{
+  glScissorIndexedvNV = (PFNGLSCISSORINDEXEDVNVPROC)glewGetProcAddress((const GLubyte*)"glScissorIndexedvNV");
+  glScissorIndexedvNV(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportArrayvNV (GLuint a0, GLsizei a1, const GLfloat * a2)
+{
+  glViewportArrayvNV = (PFNGLVIEWPORTARRAYVNVPROC)glewGetProcAddress((const GLubyte*)"glViewportArrayvNV");
+  glViewportArrayvNV(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportIndexedfNV (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glViewportIndexedfNV = (PFNGLVIEWPORTINDEXEDFNVPROC)glewGetProcAddress((const GLubyte*)"glViewportIndexedfNV");
+  glViewportIndexedfNV(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportIndexedfvNV (GLuint a0, const GLfloat * a1)
+{
+  glViewportIndexedfvNV = (PFNGLVIEWPORTINDEXEDFVNVPROC)glewGetProcAddress((const GLubyte*)"glViewportIndexedfvNV");
+  glViewportIndexedfvNV(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glViewportSwizzleNV (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  glViewportSwizzleNV = (PFNGLVIEWPORTSWIZZLENVPROC)glewGetProcAddress((const GLubyte*)"glViewportSwizzleNV");
+  glViewportSwizzleNV(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glEGLImageTargetRenderbufferStorageOES (GLenum a0, GLeglImageOES a1)
+{
+  glEGLImageTargetRenderbufferStorageOES = (PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)glewGetProcAddress((const GLubyte*)"glEGLImageTargetRenderbufferStorageOES");
+  glEGLImageTargetRenderbufferStorageOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEGLImageTargetTexture2DOES (GLenum a0, GLeglImageOES a1)
+{
+  glEGLImageTargetTexture2DOES = (PFNGLEGLIMAGETARGETTEXTURE2DOESPROC)glewGetProcAddress((const GLubyte*)"glEGLImageTargetTexture2DOES");
+  glEGLImageTargetTexture2DOES(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateOES (GLenum a0, GLenum a1)
+{
+  glBlendEquationSeparateOES = (PFNGLBLENDEQUATIONSEPARATEOESPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateOES");
+  glBlendEquationSeparateOES(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateOES (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  glBlendFuncSeparateOES = (PFNGLBLENDFUNCSEPARATEOESPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateOES");
+  glBlendFuncSeparateOES(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationOES (GLenum a0)
+{
+  glBlendEquationOES = (PFNGLBLENDEQUATIONOESPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationOES");
+  glBlendEquationOES(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCopyImageSubDataOES (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  glCopyImageSubDataOES = (PFNGLCOPYIMAGESUBDATAOESPROC)glewGetProcAddress((const GLubyte*)"glCopyImageSubDataOES");
+  glCopyImageSubDataOES(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateiOES (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendEquationSeparateiOES = (PFNGLBLENDEQUATIONSEPARATEIOESPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateiOES");
+  glBlendEquationSeparateiOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationiOES (GLuint a0, GLenum a1)
+{
+  glBlendEquationiOES = (PFNGLBLENDEQUATIONIOESPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationiOES");
+  glBlendEquationiOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateiOES (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  glBlendFuncSeparateiOES = (PFNGLBLENDFUNCSEPARATEIOESPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateiOES");
+  glBlendFuncSeparateiOES(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFunciOES (GLuint a0, GLenum a1, GLenum a2)
+{
+  glBlendFunciOES = (PFNGLBLENDFUNCIOESPROC)glewGetProcAddress((const GLubyte*)"glBlendFunciOES");
+  glBlendFunciOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColorMaskiOES (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  glColorMaskiOES = (PFNGLCOLORMASKIOESPROC)glewGetProcAddress((const GLubyte*)"glColorMaskiOES");
+  glColorMaskiOES(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableiOES (GLenum a0, GLuint a1)
+{
+  glDisableiOES = (PFNGLDISABLEIOESPROC)glewGetProcAddress((const GLubyte*)"glDisableiOES");
+  glDisableiOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableiOES (GLenum a0, GLuint a1)
+{
+  glEnableiOES = (PFNGLENABLEIOESPROC)glewGetProcAddress((const GLubyte*)"glEnableiOES");
+  glEnableiOES(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnablediOES (GLenum a0, GLuint a1)
+{
+  glIsEnablediOES = (PFNGLISENABLEDIOESPROC)glewGetProcAddress((const GLubyte*)"glIsEnablediOES");
+  return glIsEnablediOES(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindFramebufferOES (GLenum a0, GLuint a1)
+{
+  glBindFramebufferOES = (PFNGLBINDFRAMEBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glBindFramebufferOES");
+  glBindFramebufferOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glBindRenderbufferOES (GLenum a0, GLuint a1)
+{
+  glBindRenderbufferOES = (PFNGLBINDRENDERBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glBindRenderbufferOES");
+  glBindRenderbufferOES(a0, a1);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckFramebufferStatusOES (GLenum a0)
+{
+  glCheckFramebufferStatusOES = (PFNGLCHECKFRAMEBUFFERSTATUSOESPROC)glewGetProcAddress((const GLubyte*)"glCheckFramebufferStatusOES");
+  return glCheckFramebufferStatusOES(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFramebuffersOES (GLsizei a0, const GLuint* a1)
+{
+  glDeleteFramebuffersOES = (PFNGLDELETEFRAMEBUFFERSOESPROC)glewGetProcAddress((const GLubyte*)"glDeleteFramebuffersOES");
+  glDeleteFramebuffersOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteRenderbuffersOES (GLsizei a0, const GLuint* a1)
+{
+  glDeleteRenderbuffersOES = (PFNGLDELETERENDERBUFFERSOESPROC)glewGetProcAddress((const GLubyte*)"glDeleteRenderbuffersOES");
+  glDeleteRenderbuffersOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferRenderbufferOES (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  glFramebufferRenderbufferOES = (PFNGLFRAMEBUFFERRENDERBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glFramebufferRenderbufferOES");
+  glFramebufferRenderbufferOES(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2DOES (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  glFramebufferTexture2DOES = (PFNGLFRAMEBUFFERTEXTURE2DOESPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2DOES");
+  glFramebufferTexture2DOES(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFramebuffersOES (GLsizei a0, GLuint* a1)
+{
+  glGenFramebuffersOES = (PFNGLGENFRAMEBUFFERSOESPROC)glewGetProcAddress((const GLubyte*)"glGenFramebuffersOES");
+  glGenFramebuffersOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenRenderbuffersOES (GLsizei a0, GLuint* a1)
+{
+  glGenRenderbuffersOES = (PFNGLGENRENDERBUFFERSOESPROC)glewGetProcAddress((const GLubyte*)"glGenRenderbuffersOES");
+  glGenRenderbuffersOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMipmapOES (GLenum a0)
+{
+  glGenerateMipmapOES = (PFNGLGENERATEMIPMAPOESPROC)glewGetProcAddress((const GLubyte*)"glGenerateMipmapOES");
+  glGenerateMipmapOES(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferAttachmentParameterivOES (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  glGetFramebufferAttachmentParameterivOES = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferAttachmentParameterivOES");
+  glGetFramebufferAttachmentParameterivOES(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetRenderbufferParameterivOES (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetRenderbufferParameterivOES = (PFNGLGETRENDERBUFFERPARAMETERIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetRenderbufferParameterivOES");
+  glGetRenderbufferParameterivOES(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFramebufferOES (GLuint a0)
+{
+  glIsFramebufferOES = (PFNGLISFRAMEBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glIsFramebufferOES");
+  return glIsFramebufferOES(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsRenderbufferOES (GLuint a0)
+{
+  glIsRenderbufferOES = (PFNGLISRENDERBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glIsRenderbufferOES");
+  return glIsRenderbufferOES(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageOES (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  glRenderbufferStorageOES = (PFNGLRENDERBUFFERSTORAGEOESPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageOES");
+  glRenderbufferStorageOES(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramBinaryOES (GLuint a0, GLsizei a1, GLsizei* a2, GLenum * a3, void* a4)
+{
+  glGetProgramBinaryOES = (PFNGLGETPROGRAMBINARYOESPROC)glewGetProcAddress((const GLubyte*)"glGetProgramBinaryOES");
+  glGetProgramBinaryOES(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBinaryOES (GLuint a0, GLenum a1, const void * a2, GLint a3)
+{
+  glProgramBinaryOES = (PFNGLPROGRAMBINARYOESPROC)glewGetProcAddress((const GLubyte*)"glProgramBinaryOES");
+  glProgramBinaryOES(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetBufferPointervOES (GLenum a0, GLenum a1, void** a2)
+{
+  glGetBufferPointervOES = (PFNGLGETBUFFERPOINTERVOESPROC)glewGetProcAddress((const GLubyte*)"glGetBufferPointervOES");
+  glGetBufferPointervOES(a0, a1, a2);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapBufferOES (GLenum a0, GLenum a1)
+{
+  glMapBufferOES = (PFNGLMAPBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glMapBufferOES");
+  return glMapBufferOES(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapBufferOES (GLenum a0)
+{
+  glUnmapBufferOES = (PFNGLUNMAPBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glUnmapBufferOES");
+  return glUnmapBufferOES(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCurrentPaletteMatrixOES (GLuint a0)
+{
+  glCurrentPaletteMatrixOES = (PFNGLCURRENTPALETTEMATRIXOESPROC)glewGetProcAddress((const GLubyte*)"glCurrentPaletteMatrixOES");
+  glCurrentPaletteMatrixOES(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexPointerOES (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  glMatrixIndexPointerOES = (PFNGLMATRIXINDEXPOINTEROESPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexPointerOES");
+  glMatrixIndexPointerOES(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightPointerOES (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  glWeightPointerOES = (PFNGLWEIGHTPOINTEROESPROC)glewGetProcAddress((const GLubyte*)"glWeightPointerOES");
+  glWeightPointerOES(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMinSampleShadingOES (GLfloat a0)
+{
+  glMinSampleShadingOES = (PFNGLMINSAMPLESHADINGOESPROC)glewGetProcAddress((const GLubyte*)"glMinSampleShadingOES");
+  glMinSampleShadingOES(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClearDepthfOES (GLclampf a0)
+{
+  glClearDepthfOES = (PFNGLCLEARDEPTHFOESPROC)glewGetProcAddress((const GLubyte*)"glClearDepthfOES");
+  glClearDepthfOES(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glClipPlanefOES (GLenum a0, const GLfloat* a1)
+{
+  glClipPlanefOES = (PFNGLCLIPPLANEFOESPROC)glewGetProcAddress((const GLubyte*)"glClipPlanefOES");
+  glClipPlanefOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangefOES (GLclampf a0, GLclampf a1)
+{
+  glDepthRangefOES = (PFNGLDEPTHRANGEFOESPROC)glewGetProcAddress((const GLubyte*)"glDepthRangefOES");
+  glDepthRangefOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFrustumfOES (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glFrustumfOES = (PFNGLFRUSTUMFOESPROC)glewGetProcAddress((const GLubyte*)"glFrustumfOES");
+  glFrustumfOES(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glGetClipPlanefOES (GLenum a0, GLfloat* a1)
+{
+  glGetClipPlanefOES = (PFNGLGETCLIPPLANEFOESPROC)glewGetProcAddress((const GLubyte*)"glGetClipPlanefOES");
+  glGetClipPlanefOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glOrthofOES (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glOrthofOES = (PFNGLORTHOFOESPROC)glewGetProcAddress((const GLubyte*)"glOrthofOES");
+  glOrthofOES(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage3DOES (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  glCompressedTexImage3DOES = (PFNGLCOMPRESSEDTEXIMAGE3DOESPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage3DOES");
+  glCompressedTexImage3DOES(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage3DOES (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  glCompressedTexSubImage3DOES = (PFNGLCOMPRESSEDTEXSUBIMAGE3DOESPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage3DOES");
+  glCompressedTexSubImage3DOES(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage3DOES (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  glCopyTexSubImage3DOES = (PFNGLCOPYTEXSUBIMAGE3DOESPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage3DOES");
+  glCopyTexSubImage3DOES(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture3DOES (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  glFramebufferTexture3DOES = (PFNGLFRAMEBUFFERTEXTURE3DOESPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture3DOES");
+  glFramebufferTexture3DOES(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3DOES (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  glTexImage3DOES = (PFNGLTEXIMAGE3DOESPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DOES");
+  glTexImage3DOES(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage3DOES (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTexSubImage3DOES = (PFNGLTEXSUBIMAGE3DOESPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage3DOES");
+  glTexSubImage3DOES(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIivOES (GLuint a0, GLenum a1, GLint* a2)
+{
+  glGetSamplerParameterIivOES = (PFNGLGETSAMPLERPARAMETERIIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIivOES");
+  glGetSamplerParameterIivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIuivOES (GLuint a0, GLenum a1, GLuint* a2)
+{
+  glGetSamplerParameterIuivOES = (PFNGLGETSAMPLERPARAMETERIUIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIuivOES");
+  glGetSamplerParameterIuivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIivOES (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetTexParameterIivOES = (PFNGLGETTEXPARAMETERIIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIivOES");
+  glGetTexParameterIivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIuivOES (GLenum a0, GLenum a1, GLuint* a2)
+{
+  glGetTexParameterIuivOES = (PFNGLGETTEXPARAMETERIUIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIuivOES");
+  glGetTexParameterIuivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIivOES (GLuint a0, GLenum a1, const GLint* a2)
+{
+  glSamplerParameterIivOES = (PFNGLSAMPLERPARAMETERIIVOESPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIivOES");
+  glSamplerParameterIivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIuivOES (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  glSamplerParameterIuivOES = (PFNGLSAMPLERPARAMETERIUIVOESPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIuivOES");
+  glSamplerParameterIuivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIivOES (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glTexParameterIivOES = (PFNGLTEXPARAMETERIIVOESPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIivOES");
+  glTexParameterIivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIuivOES (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  glTexParameterIuivOES = (PFNGLTEXPARAMETERIUIVOESPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIuivOES");
+  glTexParameterIuivOES(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferOES (GLenum a0, GLenum a1, GLuint a2)
+{
+  glTexBufferOES = (PFNGLTEXBUFFEROESPROC)glewGetProcAddress((const GLubyte*)"glTexBufferOES");
+  glTexBufferOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBufferRangeOES (GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  glTexBufferRangeOES = (PFNGLTEXBUFFERRANGEOESPROC)glewGetProcAddress((const GLubyte*)"glTexBufferRangeOES");
+  glTexBufferRangeOES(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetTexGenfvOES (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetTexGenfvOES = (PFNGLGETTEXGENFVOESPROC)glewGetProcAddress((const GLubyte*)"glGetTexGenfvOES");
+  glGetTexGenfvOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexGenivOES (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetTexGenivOES = (PFNGLGETTEXGENIVOESPROC)glewGetProcAddress((const GLubyte*)"glGetTexGenivOES");
+  glGetTexGenivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexGenxvOES (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  glGetTexGenxvOES = (PFNGLGETTEXGENXVOESPROC)glewGetProcAddress((const GLubyte*)"glGetTexGenxvOES");
+  glGetTexGenxvOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexGenfOES (GLenum a0, GLenum a1, GLfloat a2)
+{
+  glTexGenfOES = (PFNGLTEXGENFOESPROC)glewGetProcAddress((const GLubyte*)"glTexGenfOES");
+  glTexGenfOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexGenfvOES (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glTexGenfvOES = (PFNGLTEXGENFVOESPROC)glewGetProcAddress((const GLubyte*)"glTexGenfvOES");
+  glTexGenfvOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexGeniOES (GLenum a0, GLenum a1, GLint a2)
+{
+  glTexGeniOES = (PFNGLTEXGENIOESPROC)glewGetProcAddress((const GLubyte*)"glTexGeniOES");
+  glTexGeniOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexGenivOES (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glTexGenivOES = (PFNGLTEXGENIVOESPROC)glewGetProcAddress((const GLubyte*)"glTexGenivOES");
+  glTexGenivOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexGenxOES (GLenum a0, GLenum a1, GLfixed a2)
+{
+  glTexGenxOES = (PFNGLTEXGENXOESPROC)glewGetProcAddress((const GLubyte*)"glTexGenxOES");
+  glTexGenxOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexGenxvOES (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  glTexGenxvOES = (PFNGLTEXGENXVOESPROC)glewGetProcAddress((const GLubyte*)"glTexGenxvOES");
+  glTexGenxvOES(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexStorage3DMultisampleOES (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  glTexStorage3DMultisampleOES = (PFNGLTEXSTORAGE3DMULTISAMPLEOESPROC)glewGetProcAddress((const GLubyte*)"glTexStorage3DMultisampleOES");
+  glTexStorage3DMultisampleOES(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureViewOES (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+{
+  glTextureViewOES = (PFNGLTEXTUREVIEWOESPROC)glewGetProcAddress((const GLubyte*)"glTextureViewOES");
+  glTextureViewOES(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexArrayOES (GLuint a0)
+{
+  glBindVertexArrayOES = (PFNGLBINDVERTEXARRAYOESPROC)glewGetProcAddress((const GLubyte*)"glBindVertexArrayOES");
+  glBindVertexArrayOES(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexArraysOES (GLsizei a0, const GLuint* a1)
+{
+  glDeleteVertexArraysOES = (PFNGLDELETEVERTEXARRAYSOESPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexArraysOES");
+  glDeleteVertexArraysOES(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenVertexArraysOES (GLsizei a0, GLuint* a1)
+{
+  glGenVertexArraysOES = (PFNGLGENVERTEXARRAYSOESPROC)glewGetProcAddress((const GLubyte*)"glGenVertexArraysOES");
+  glGenVertexArraysOES(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexArrayOES (GLuint a0)
+{
+  glIsVertexArrayOES = (PFNGLISVERTEXARRAYOESPROC)glewGetProcAddress((const GLubyte*)"glIsVertexArrayOES");
+  return glIsVertexArrayOES(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureMultiviewOVR (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  glFramebufferTextureMultiviewOVR = (PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureMultiviewOVR");
+  glFramebufferTextureMultiviewOVR(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureMultiviewOVR (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  glNamedFramebufferTextureMultiviewOVR = (PFNGLNAMEDFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureMultiviewOVR");
+  glNamedFramebufferTextureMultiviewOVR(a0, a1, a2, a3, a4, a5);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureMultisampleMultiviewOVR (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLsizei a4, GLint a5, GLsizei a6)
+{
+  glFramebufferTextureMultisampleMultiviewOVR = (PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureMultisampleMultiviewOVR");
+  glFramebufferTextureMultisampleMultiviewOVR(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAlphaFuncQCOM (GLenum a0, GLclampf a1)
+{
+  glAlphaFuncQCOM = (PFNGLALPHAFUNCQCOMPROC)glewGetProcAddress((const GLubyte*)"glAlphaFuncQCOM");
+  glAlphaFuncQCOM(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDisableDriverControlQCOM (GLuint a0)
+{
+  glDisableDriverControlQCOM = (PFNGLDISABLEDRIVERCONTROLQCOMPROC)glewGetProcAddress((const GLubyte*)"glDisableDriverControlQCOM");
+  glDisableDriverControlQCOM(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableDriverControlQCOM (GLuint a0)
+{
+  glEnableDriverControlQCOM = (PFNGLENABLEDRIVERCONTROLQCOMPROC)glewGetProcAddress((const GLubyte*)"glEnableDriverControlQCOM");
+  glEnableDriverControlQCOM(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDriverControlStringQCOM (GLuint a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  glGetDriverControlStringQCOM = (PFNGLGETDRIVERCONTROLSTRINGQCOMPROC)glewGetProcAddress((const GLubyte*)"glGetDriverControlStringQCOM");
+  glGetDriverControlStringQCOM(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDriverControlsQCOM (GLint* a0, GLsizei a1, GLuint * a2)
+{
+  glGetDriverControlsQCOM = (PFNGLGETDRIVERCONTROLSQCOMPROC)glewGetProcAddress((const GLubyte*)"glGetDriverControlsQCOM");
+  glGetDriverControlsQCOM(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glExtGetBufferPointervQCOM (GLenum a0, void** a1)
+{
+  glExtGetBufferPointervQCOM = (PFNGLEXTGETBUFFERPOINTERVQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetBufferPointervQCOM");
+  glExtGetBufferPointervQCOM(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetBuffersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  glExtGetBuffersQCOM = (PFNGLEXTGETBUFFERSQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetBuffersQCOM");
+  glExtGetBuffersQCOM(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetFramebuffersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  glExtGetFramebuffersQCOM = (PFNGLEXTGETFRAMEBUFFERSQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetFramebuffersQCOM");
+  glExtGetFramebuffersQCOM(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetRenderbuffersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  glExtGetRenderbuffersQCOM = (PFNGLEXTGETRENDERBUFFERSQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetRenderbuffersQCOM");
+  glExtGetRenderbuffersQCOM(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetTexLevelParameterivQCOM (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint* a4)
+{
+  glExtGetTexLevelParameterivQCOM = (PFNGLEXTGETTEXLEVELPARAMETERIVQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetTexLevelParameterivQCOM");
+  glExtGetTexLevelParameterivQCOM(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetTexSubImageQCOM (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, void * a10)
+{
+  glExtGetTexSubImageQCOM = (PFNGLEXTGETTEXSUBIMAGEQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetTexSubImageQCOM");
+  glExtGetTexSubImageQCOM(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetTexturesQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  glExtGetTexturesQCOM = (PFNGLEXTGETTEXTURESQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetTexturesQCOM");
+  glExtGetTexturesQCOM(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glExtTexObjectStateOverrideiQCOM (GLenum a0, GLenum a1, GLint a2)
+{
+  glExtTexObjectStateOverrideiQCOM = (PFNGLEXTTEXOBJECTSTATEOVERRIDEIQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtTexObjectStateOverrideiQCOM");
+  glExtTexObjectStateOverrideiQCOM(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glExtGetProgramBinarySourceQCOM (GLuint a0, GLenum a1, GLchar* a2, GLint* a3)
+{
+  glExtGetProgramBinarySourceQCOM = (PFNGLEXTGETPROGRAMBINARYSOURCEQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetProgramBinarySourceQCOM");
+  glExtGetProgramBinarySourceQCOM(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetProgramsQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  glExtGetProgramsQCOM = (PFNGLEXTGETPROGRAMSQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetProgramsQCOM");
+  glExtGetProgramsQCOM(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glExtGetShadersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  glExtGetShadersQCOM = (PFNGLEXTGETSHADERSQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtGetShadersQCOM");
+  glExtGetShadersQCOM(a0, a1, a2);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glExtIsProgramBinaryQCOM (GLuint a0)
+{
+  glExtIsProgramBinaryQCOM = (PFNGLEXTISPROGRAMBINARYQCOMPROC)glewGetProcAddress((const GLubyte*)"glExtIsProgramBinaryQCOM");
+  return glExtIsProgramBinaryQCOM(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferFoveationConfigQCOM (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint* a4)
+{
+  glFramebufferFoveationConfigQCOM = (PFNGLFRAMEBUFFERFOVEATIONCONFIGQCOMPROC)glewGetProcAddress((const GLubyte*)"glFramebufferFoveationConfigQCOM");
+  glFramebufferFoveationConfigQCOM(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferFoveationParametersQCOM (GLuint a0, GLuint a1, GLuint a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glFramebufferFoveationParametersQCOM = (PFNGLFRAMEBUFFERFOVEATIONPARAMETERSQCOMPROC)glewGetProcAddress((const GLubyte*)"glFramebufferFoveationParametersQCOM");
+  glFramebufferFoveationParametersQCOM(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferFetchBarrierQCOM (void)
+{
+  glFramebufferFetchBarrierQCOM = (PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC)glewGetProcAddress((const GLubyte*)"glFramebufferFetchBarrierQCOM");
+  glFramebufferFetchBarrierQCOM();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureFoveationParametersQCOM (GLuint a0, GLuint a1, GLuint a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glTextureFoveationParametersQCOM = (PFNGLTEXTUREFOVEATIONPARAMETERSQCOMPROC)glewGetProcAddress((const GLubyte*)"glTextureFoveationParametersQCOM");
+  glTextureFoveationParametersQCOM(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glEndTilingQCOM (GLbitfield a0)
+{
+  glEndTilingQCOM = (PFNGLENDTILINGQCOMPROC)glewGetProcAddress((const GLubyte*)"glEndTilingQCOM");
+  glEndTilingQCOM(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glStartTilingQCOM (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLbitfield a4)
+{
+  glStartTilingQCOM = (PFNGLSTARTTILINGQCOMPROC)glewGetProcAddress((const GLubyte*)"glStartTilingQCOM");
+  glStartTilingQCOM(a0, a1, a2, a3, a4);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAlphaFuncx (GLenum a0, GLclampx a1)
+{
+  glAlphaFuncx = (PFNGLALPHAFUNCXPROC)glewGetProcAddress((const GLubyte*)"glAlphaFuncx");
+  glAlphaFuncx(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glClearColorx (GLclampx a0, GLclampx a1, GLclampx a2, GLclampx a3)
+{
+  glClearColorx = (PFNGLCLEARCOLORXPROC)glewGetProcAddress((const GLubyte*)"glClearColorx");
+  glClearColorx(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glClearDepthx (GLclampx a0)
+{
+  glClearDepthx = (PFNGLCLEARDEPTHXPROC)glewGetProcAddress((const GLubyte*)"glClearDepthx");
+  glClearDepthx(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4x (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3)
+{
+  glColor4x = (PFNGLCOLOR4XPROC)glewGetProcAddress((const GLubyte*)"glColor4x");
+  glColor4x(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangex (GLclampx a0, GLclampx a1)
+{
+  glDepthRangex = (PFNGLDEPTHRANGEXPROC)glewGetProcAddress((const GLubyte*)"glDepthRangex");
+  glDepthRangex(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFogx (GLenum a0, GLfixed a1)
+{
+  glFogx = (PFNGLFOGXPROC)glewGetProcAddress((const GLubyte*)"glFogx");
+  glFogx(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFogxv (GLenum a0, const GLfixed* a1)
+{
+  glFogxv = (PFNGLFOGXVPROC)glewGetProcAddress((const GLubyte*)"glFogxv");
+  glFogxv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFrustumf (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glFrustumf = (PFNGLFRUSTUMFPROC)glewGetProcAddress((const GLubyte*)"glFrustumf");
+  glFrustumf(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glFrustumx (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3, GLfixed a4, GLfixed a5)
+{
+  glFrustumx = (PFNGLFRUSTUMXPROC)glewGetProcAddress((const GLubyte*)"glFrustumx");
+  glFrustumx(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glLightModelx (GLenum a0, GLfixed a1)
+{
+  glLightModelx = (PFNGLLIGHTMODELXPROC)glewGetProcAddress((const GLubyte*)"glLightModelx");
+  glLightModelx(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glLightModelxv (GLenum a0, const GLfixed* a1)
+{
+  glLightModelxv = (PFNGLLIGHTMODELXVPROC)glewGetProcAddress((const GLubyte*)"glLightModelxv");
+  glLightModelxv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glLightx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  glLightx = (PFNGLLIGHTXPROC)glewGetProcAddress((const GLubyte*)"glLightx");
+  glLightx(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glLightxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  glLightxv = (PFNGLLIGHTXVPROC)glewGetProcAddress((const GLubyte*)"glLightxv");
+  glLightxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glLineWidthx (GLfixed a0)
+{
+  glLineWidthx = (PFNGLLINEWIDTHXPROC)glewGetProcAddress((const GLubyte*)"glLineWidthx");
+  glLineWidthx(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadMatrixx (const GLfixed* a0)
+{
+  glLoadMatrixx = (PFNGLLOADMATRIXXPROC)glewGetProcAddress((const GLubyte*)"glLoadMatrixx");
+  glLoadMatrixx(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMaterialx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  glMaterialx = (PFNGLMATERIALXPROC)glewGetProcAddress((const GLubyte*)"glMaterialx");
+  glMaterialx(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMaterialxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  glMaterialxv = (PFNGLMATERIALXVPROC)glewGetProcAddress((const GLubyte*)"glMaterialxv");
+  glMaterialxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glMultMatrixx (const GLfixed* a0)
+{
+  glMultMatrixx = (PFNGLMULTMATRIXXPROC)glewGetProcAddress((const GLubyte*)"glMultMatrixx");
+  glMultMatrixx(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4x (GLenum a0, GLfixed a1, GLfixed a2, GLfixed a3, GLfixed a4)
+{
+  glMultiTexCoord4x = (PFNGLMULTITEXCOORD4XPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4x");
+  glMultiTexCoord4x(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3x (GLfixed a0, GLfixed a1, GLfixed a2)
+{
+  glNormal3x = (PFNGLNORMAL3XPROC)glewGetProcAddress((const GLubyte*)"glNormal3x");
+  glNormal3x(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glOrthof (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glOrthof = (PFNGLORTHOFPROC)glewGetProcAddress((const GLubyte*)"glOrthof");
+  glOrthof(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glOrthox (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3, GLfixed a4, GLfixed a5)
+{
+  glOrthox = (PFNGLORTHOXPROC)glewGetProcAddress((const GLubyte*)"glOrthox");
+  glOrthox(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glPointSizex (GLfixed a0)
+{
+  glPointSizex = (PFNGLPOINTSIZEXPROC)glewGetProcAddress((const GLubyte*)"glPointSizex");
+  glPointSizex(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetx (GLfixed a0, GLfixed a1)
+{
+  glPolygonOffsetx = (PFNGLPOLYGONOFFSETXPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetx");
+  glPolygonOffsetx(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glRotatex (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3)
+{
+  glRotatex = (PFNGLROTATEXPROC)glewGetProcAddress((const GLubyte*)"glRotatex");
+  glRotatex(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleCoveragex (GLclampx a0, GLboolean a1)
+{
+  glSampleCoveragex = (PFNGLSAMPLECOVERAGEXPROC)glewGetProcAddress((const GLubyte*)"glSampleCoveragex");
+  glSampleCoveragex(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glScalex (GLfixed a0, GLfixed a1, GLfixed a2)
+{
+  glScalex = (PFNGLSCALEXPROC)glewGetProcAddress((const GLubyte*)"glScalex");
+  glScalex(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexEnvx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  glTexEnvx = (PFNGLTEXENVXPROC)glewGetProcAddress((const GLubyte*)"glTexEnvx");
+  glTexEnvx(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexEnvxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  glTexEnvxv = (PFNGLTEXENVXVPROC)glewGetProcAddress((const GLubyte*)"glTexEnvxv");
+  glTexEnvxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  glTexParameterx = (PFNGLTEXPARAMETERXPROC)glewGetProcAddress((const GLubyte*)"glTexParameterx");
+  glTexParameterx(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTranslatex (GLfixed a0, GLfixed a1, GLfixed a2)
+{
+  glTranslatex = (PFNGLTRANSLATEXPROC)glewGetProcAddress((const GLubyte*)"glTranslatex");
+  glTranslatex(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glClipPlanef (GLenum a0, const GLfloat* a1)
+{
+  glClipPlanef = (PFNGLCLIPPLANEFPROC)glewGetProcAddress((const GLubyte*)"glClipPlanef");
+  glClipPlanef(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glClipPlanex (GLenum a0, const GLfixed* a1)
+{
+  glClipPlanex = (PFNGLCLIPPLANEXPROC)glewGetProcAddress((const GLubyte*)"glClipPlanex");
+  glClipPlanex(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetClipPlanef (GLenum a0, GLfloat a1[4])
+{
+  glGetClipPlanef = (PFNGLGETCLIPPLANEFPROC)glewGetProcAddress((const GLubyte*)"glGetClipPlanef");
+  glGetClipPlanef(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetClipPlanex (GLenum a0, GLfixed a1[4])
+{
+  glGetClipPlanex = (PFNGLGETCLIPPLANEXPROC)glewGetProcAddress((const GLubyte*)"glGetClipPlanex");
+  glGetClipPlanex(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFixedv (GLenum a0, GLfixed* a1)
+{
+  glGetFixedv = (PFNGLGETFIXEDVPROC)glewGetProcAddress((const GLubyte*)"glGetFixedv");
+  glGetFixedv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLightxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  glGetLightxv = (PFNGLGETLIGHTXVPROC)glewGetProcAddress((const GLubyte*)"glGetLightxv");
+  glGetLightxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMaterialxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  glGetMaterialxv = (PFNGLGETMATERIALXVPROC)glewGetProcAddress((const GLubyte*)"glGetMaterialxv");
+  glGetMaterialxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexEnvxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  glGetTexEnvxv = (PFNGLGETTEXENVXVPROC)glewGetProcAddress((const GLubyte*)"glGetTexEnvxv");
+  glGetTexEnvxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  glGetTexParameterxv = (PFNGLGETTEXPARAMETERXVPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterxv");
+  glGetTexParameterxv(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterx (GLenum a0, GLfixed a1)
+{
+  glPointParameterx = (PFNGLPOINTPARAMETERXPROC)glewGetProcAddress((const GLubyte*)"glPointParameterx");
+  glPointParameterx(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterxv (GLenum a0, const GLfixed* a1)
+{
+  glPointParameterxv = (PFNGLPOINTPARAMETERXVPROC)glewGetProcAddress((const GLubyte*)"glPointParameterxv");
+  glPointParameterxv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glPointSizePointerOES (GLenum a0, GLsizei a1, const void * a2)
+{
+  glPointSizePointerOES = (PFNGLPOINTSIZEPOINTEROESPROC)glewGetProcAddress((const GLubyte*)"glPointSizePointerOES");
+  glPointSizePointerOES(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  glTexParameterxv = (PFNGLTEXPARAMETERXVPROC)glewGetProcAddress((const GLubyte*)"glTexParameterxv");
+  glTexParameterxv(a0, a1, a2);
+}
+
+
+
+static const GLchar* GLAPIENTRY _glewLazy_glErrorStringREGAL (GLenum a0)
+{
+  glErrorStringREGAL = (PFNGLERRORSTRINGREGALPROC)glewGetProcAddress((const GLubyte*)"glErrorStringREGAL");
+  return glErrorStringREGAL(a0);
+}
+
+
+
+static GLboolean GLAPIENTRY _glewLazy_glGetExtensionREGAL (const GLchar* a0)
+{
+  glGetExtensionREGAL = (PFNGLGETEXTENSIONREGALPROC)glewGetProcAddress((const GLubyte*)"glGetExtensionREGAL");
+  return glGetExtensionREGAL(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSupportedREGAL (const GLchar* a0)
+{
+  glIsSupportedREGAL = (PFNGLISSUPPORTEDREGALPROC)glewGetProcAddress((const GLubyte*)"glIsSupportedREGAL");
+  return glIsSupportedREGAL(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glLogMessageCallbackREGAL (GLLOGPROCREGAL a0)
+{
+  glLogMessageCallbackREGAL = (PFNGLLOGMESSAGECALLBACKREGALPROC)glewGetProcAddress((const GLubyte*)"glLogMessageCallbackREGAL");
+  glLogMessageCallbackREGAL(a0);
+}
+
+
+
+static void * GLAPIENTRY _glewLazy_glGetProcAddressREGAL (const GLchar * a0)
+{
+  glGetProcAddressREGAL = (PFNGLGETPROCADDRESSREGALPROC)glewGetProcAddress((const GLubyte*)"glGetProcAddressREGAL");
+  return glGetProcAddressREGAL(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDetailTexFuncSGIS (GLenum a0, GLsizei a1, const GLfloat* a2)
+{
+  glDetailTexFuncSGIS = (PFNGLDETAILTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glDetailTexFuncSGIS");
+  glDetailTexFuncSGIS(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDetailTexFuncSGIS (GLenum a0, GLfloat* a1)
+{
+  glGetDetailTexFuncSGIS = (PFNGLGETDETAILTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetDetailTexFuncSGIS");
+  glGetDetailTexFuncSGIS(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFogFuncSGIS (GLsizei a0, const GLfloat* a1)
+{
+  glFogFuncSGIS = (PFNGLFOGFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glFogFuncSGIS");
+  glFogFuncSGIS(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFogFuncSGIS (GLfloat* a0)
+{
+  glGetFogFuncSGIS = (PFNGLGETFOGFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetFogFuncSGIS");
+  glGetFogFuncSGIS(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSampleMaskSGIS (GLclampf a0, GLboolean a1)
+{
+  glSampleMaskSGIS = (PFNGLSAMPLEMASKSGISPROC)glewGetProcAddress((const GLubyte*)"glSampleMaskSGIS");
+  glSampleMaskSGIS(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplePatternSGIS (GLenum a0)
+{
+  glSamplePatternSGIS = (PFNGLSAMPLEPATTERNSGISPROC)glewGetProcAddress((const GLubyte*)"glSamplePatternSGIS");
+  glSamplePatternSGIS(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glInterleavedTextureCoordSetsSGIS (GLint a0)
+{
+  glInterleavedTextureCoordSetsSGIS = (PFNGLINTERLEAVEDTEXTURECOORDSETSSGISPROC)glewGetProcAddress((const GLubyte*)"glInterleavedTextureCoordSetsSGIS");
+  glInterleavedTextureCoordSetsSGIS(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSelectTextureCoordSetSGIS (GLenum a0)
+{
+  glSelectTextureCoordSetSGIS = (PFNGLSELECTTEXTURECOORDSETSGISPROC)glewGetProcAddress((const GLubyte*)"glSelectTextureCoordSetSGIS");
+  glSelectTextureCoordSetSGIS(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSelectTextureSGIS (GLenum a0)
+{
+  glSelectTextureSGIS = (PFNGLSELECTTEXTURESGISPROC)glewGetProcAddress((const GLubyte*)"glSelectTextureSGIS");
+  glSelectTextureSGIS(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glSelectTextureTransformSGIS (GLenum a0)
+{
+  glSelectTextureTransformSGIS = (PFNGLSELECTTEXTURETRANSFORMSGISPROC)glewGetProcAddress((const GLubyte*)"glSelectTextureTransformSGIS");
+  glSelectTextureTransformSGIS(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMultisampleSubRectPosSGIS (GLint a0, GLint a1)
+{
+  glMultisampleSubRectPosSGIS = (PFNGLMULTISAMPLESUBRECTPOSSGISPROC)glewGetProcAddress((const GLubyte*)"glMultisampleSubRectPosSGIS");
+  glMultisampleSubRectPosSGIS(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetSharpenTexFuncSGIS (GLenum a0, GLfloat* a1)
+{
+  glGetSharpenTexFuncSGIS = (PFNGLGETSHARPENTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetSharpenTexFuncSGIS");
+  glGetSharpenTexFuncSGIS(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSharpenTexFuncSGIS (GLenum a0, GLsizei a1, const GLfloat* a2)
+{
+  glSharpenTexFuncSGIS = (PFNGLSHARPENTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glSharpenTexFuncSGIS");
+  glSharpenTexFuncSGIS(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTexImage4DSGIS (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLenum a8, GLenum a9, const void * a10)
+{
+  glTexImage4DSGIS = (PFNGLTEXIMAGE4DSGISPROC)glewGetProcAddress((const GLubyte*)"glTexImage4DSGIS");
+  glTexImage4DSGIS(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage4DSGIS (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLsizei a9, GLenum a10, GLenum a11, const void * a12)
+{
+  glTexSubImage4DSGIS = (PFNGLTEXSUBIMAGE4DSGISPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage4DSGIS");
+  glTexSubImage4DSGIS(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetTexFilterFuncSGIS (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetTexFilterFuncSGIS = (PFNGLGETTEXFILTERFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetTexFilterFuncSGIS");
+  glGetTexFilterFuncSGIS(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexFilterFuncSGIS (GLenum a0, GLenum a1, GLsizei a2, const GLfloat* a3)
+{
+  glTexFilterFuncSGIS = (PFNGLTEXFILTERFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glTexFilterFuncSGIS");
+  glTexFilterFuncSGIS(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAsyncMarkerSGIX (GLuint a0)
+{
+  glAsyncMarkerSGIX = (PFNGLASYNCMARKERSGIXPROC)glewGetProcAddress((const GLubyte*)"glAsyncMarkerSGIX");
+  glAsyncMarkerSGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteAsyncMarkersSGIX (GLuint a0, GLsizei a1)
+{
+  glDeleteAsyncMarkersSGIX = (PFNGLDELETEASYNCMARKERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glDeleteAsyncMarkersSGIX");
+  glDeleteAsyncMarkersSGIX(a0, a1);
+}
+
+static GLint GLAPIENTRY _glewLazy_glFinishAsyncSGIX (GLuint* a0)
+{
+  glFinishAsyncSGIX = (PFNGLFINISHASYNCSGIXPROC)glewGetProcAddress((const GLubyte*)"glFinishAsyncSGIX");
+  return glFinishAsyncSGIX(a0);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenAsyncMarkersSGIX (GLsizei a0)
+{
+  glGenAsyncMarkersSGIX = (PFNGLGENASYNCMARKERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glGenAsyncMarkersSGIX");
+  return glGenAsyncMarkersSGIX(a0);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsAsyncMarkerSGIX (GLuint a0)
+{
+  glIsAsyncMarkerSGIX = (PFNGLISASYNCMARKERSGIXPROC)glewGetProcAddress((const GLubyte*)"glIsAsyncMarkerSGIX");
+  return glIsAsyncMarkerSGIX(a0);
+}
+
+static GLint GLAPIENTRY _glewLazy_glPollAsyncSGIX (GLuint* a0)
+{
+  glPollAsyncSGIX = (PFNGLPOLLASYNCSGIXPROC)glewGetProcAddress((const GLubyte*)"glPollAsyncSGIX");
+  return glPollAsyncSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAddressSpace (GLenum a0, GLbitfield a1)
+{
+  glAddressSpace = (PFNGLADDRESSSPACEPROC)glewGetProcAddress((const GLubyte*)"glAddressSpace");
+  glAddressSpace(a0, a1);
+}
+
+static GLint GLAPIENTRY _glewLazy_glDataPipe (GLenum a0)
+{
+  glDataPipe = (PFNGLDATAPIPEPROC)glewGetProcAddress((const GLubyte*)"glDataPipe");
+  return glDataPipe(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFlushRasterSGIX (void)
+{
+  glFlushRasterSGIX = (PFNGLFLUSHRASTERSGIXPROC)glewGetProcAddress((const GLubyte*)"glFlushRasterSGIX");
+  glFlushRasterSGIX();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFogLayersSGIX (GLsizei a0, const GLfloat* a1)
+{
+  glFogLayersSGIX = (PFNGLFOGLAYERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glFogLayersSGIX");
+  glFogLayersSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFogLayersSGIX (GLfloat* a0)
+{
+  glGetFogLayersSGIX = (PFNGLGETFOGLAYERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFogLayersSGIX");
+  glGetFogLayersSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTextureFogSGIX (GLenum a0)
+{
+  glTextureFogSGIX = (PFNGLTEXTUREFOGSGIXPROC)glewGetProcAddress((const GLubyte*)"glTextureFogSGIX");
+  glTextureFogSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFragmentColorMaterialSGIX (GLenum a0, GLenum a1)
+{
+  glFragmentColorMaterialSGIX = (PFNGLFRAGMENTCOLORMATERIALSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentColorMaterialSGIX");
+  glFragmentColorMaterialSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfSGIX (GLenum a0, GLfloat a1)
+{
+  glFragmentLightModelfSGIX = (PFNGLFRAGMENTLIGHTMODELFSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfSGIX");
+  glFragmentLightModelfSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfvSGIX (GLenum a0, GLfloat* a1)
+{
+  glFragmentLightModelfvSGIX = (PFNGLFRAGMENTLIGHTMODELFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfvSGIX");
+  glFragmentLightModelfvSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModeliSGIX (GLenum a0, GLint a1)
+{
+  glFragmentLightModeliSGIX = (PFNGLFRAGMENTLIGHTMODELISGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModeliSGIX");
+  glFragmentLightModeliSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelivSGIX (GLenum a0, GLint* a1)
+{
+  glFragmentLightModelivSGIX = (PFNGLFRAGMENTLIGHTMODELIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelivSGIX");
+  glFragmentLightModelivSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfSGIX (GLenum a0, GLenum a1, GLfloat a2)
+{
+  glFragmentLightfSGIX = (PFNGLFRAGMENTLIGHTFSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfSGIX");
+  glFragmentLightfSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glFragmentLightfvSGIX = (PFNGLFRAGMENTLIGHTFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfvSGIX");
+  glFragmentLightfvSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightiSGIX (GLenum a0, GLenum a1, GLint a2)
+{
+  glFragmentLightiSGIX = (PFNGLFRAGMENTLIGHTISGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightiSGIX");
+  glFragmentLightiSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  glFragmentLightivSGIX = (PFNGLFRAGMENTLIGHTIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightivSGIX");
+  glFragmentLightivSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfSGIX (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  glFragmentMaterialfSGIX = (PFNGLFRAGMENTMATERIALFSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfSGIX");
+  glFragmentMaterialfSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfvSGIX (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glFragmentMaterialfvSGIX = (PFNGLFRAGMENTMATERIALFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfvSGIX");
+  glFragmentMaterialfvSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialiSGIX (GLenum a0, GLenum a1, const GLint a2)
+{
+  glFragmentMaterialiSGIX = (PFNGLFRAGMENTMATERIALISGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialiSGIX");
+  glFragmentMaterialiSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialivSGIX (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glFragmentMaterialivSGIX = (PFNGLFRAGMENTMATERIALIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialivSGIX");
+  glFragmentMaterialivSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetFragmentLightfvSGIX = (PFNGLGETFRAGMENTLIGHTFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightfvSGIX");
+  glGetFragmentLightfvSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetFragmentLightivSGIX = (PFNGLGETFRAGMENTLIGHTIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightivSGIX");
+  glGetFragmentLightivSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetFragmentMaterialfvSGIX = (PFNGLGETFRAGMENTMATERIALFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialfvSGIX");
+  glGetFragmentMaterialfvSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetFragmentMaterialivSGIX = (PFNGLGETFRAGMENTMATERIALIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialivSGIX");
+  glGetFragmentMaterialivSGIX(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFrameZoomSGIX (GLint a0)
+{
+  glFrameZoomSGIX = (PFNGLFRAMEZOOMSGIXPROC)glewGetProcAddress((const GLubyte*)"glFrameZoomSGIX");
+  glFrameZoomSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glIglooInterfaceSGIX (GLenum a0, void * a1)
+{
+  glIglooInterfaceSGIX = (PFNGLIGLOOINTERFACESGIXPROC)glewGetProcAddress((const GLubyte*)"glIglooInterfaceSGIX");
+  glIglooInterfaceSGIX(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAllocMPEGPredictorsSGIX (GLsizei a0, GLsizei a1, GLsizei a2, GLuint* a3)
+{
+  glAllocMPEGPredictorsSGIX = (PFNGLALLOCMPEGPREDICTORSSGIXPROC)glewGetProcAddress((const GLubyte*)"glAllocMPEGPredictorsSGIX");
+  glAllocMPEGPredictorsSGIX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteMPEGPredictorsSGIX (GLsizei a0, GLuint* a1)
+{
+  glDeleteMPEGPredictorsSGIX = (PFNGLDELETEMPEGPREDICTORSSGIXPROC)glewGetProcAddress((const GLubyte*)"glDeleteMPEGPredictorsSGIX");
+  glDeleteMPEGPredictorsSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenMPEGPredictorsSGIX (GLsizei a0, GLuint* a1)
+{
+  glGenMPEGPredictorsSGIX = (PFNGLGENMPEGPREDICTORSSGIXPROC)glewGetProcAddress((const GLubyte*)"glGenMPEGPredictorsSGIX");
+  glGenMPEGPredictorsSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMPEGParameterfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetMPEGParameterfvSGIX = (PFNGLGETMPEGPARAMETERFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetMPEGParameterfvSGIX");
+  glGetMPEGParameterfvSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMPEGParameterivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetMPEGParameterivSGIX = (PFNGLGETMPEGPARAMETERIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetMPEGParameterivSGIX");
+  glGetMPEGParameterivSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMPEGPredictorSGIX (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetMPEGPredictorSGIX = (PFNGLGETMPEGPREDICTORSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetMPEGPredictorSGIX");
+  glGetMPEGPredictorSGIX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMPEGQuantTableubv (GLenum a0, GLubyte* a1)
+{
+  glGetMPEGQuantTableubv = (PFNGLGETMPEGQUANTTABLEUBVPROC)glewGetProcAddress((const GLubyte*)"glGetMPEGQuantTableubv");
+  glGetMPEGQuantTableubv(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsMPEGPredictorSGIX (GLuint a0)
+{
+  glIsMPEGPredictorSGIX = (PFNGLISMPEGPREDICTORSGIXPROC)glewGetProcAddress((const GLubyte*)"glIsMPEGPredictorSGIX");
+  return glIsMPEGPredictorSGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMPEGPredictorSGIX (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glMPEGPredictorSGIX = (PFNGLMPEGPREDICTORSGIXPROC)glewGetProcAddress((const GLubyte*)"glMPEGPredictorSGIX");
+  glMPEGPredictorSGIX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glMPEGQuantTableubv (GLenum a0, GLubyte* a1)
+{
+  glMPEGQuantTableubv = (PFNGLMPEGQUANTTABLEUBVPROC)glewGetProcAddress((const GLubyte*)"glMPEGQuantTableubv");
+  glMPEGQuantTableubv(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSwapMPEGPredictorsSGIX (GLenum a0, GLenum a1)
+{
+  glSwapMPEGPredictorsSGIX = (PFNGLSWAPMPEGPREDICTORSSGIXPROC)glewGetProcAddress((const GLubyte*)"glSwapMPEGPredictorsSGIX");
+  glSwapMPEGPredictorsSGIX(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetNonlinLightfvSGIX (GLenum a0, GLenum a1, GLint* a2, GLfloat * a3)
+{
+  glGetNonlinLightfvSGIX = (PFNGLGETNONLINLIGHTFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetNonlinLightfvSGIX");
+  glGetNonlinLightfvSGIX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNonlinMaterialfvSGIX (GLenum a0, GLenum a1, GLint* a2, const GLfloat * a3)
+{
+  glGetNonlinMaterialfvSGIX = (PFNGLGETNONLINMATERIALFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetNonlinMaterialfvSGIX");
+  glGetNonlinMaterialfvSGIX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNonlinLightfvSGIX (GLenum a0, GLenum a1, GLint a2, GLfloat* a3)
+{
+  glNonlinLightfvSGIX = (PFNGLNONLINLIGHTFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glNonlinLightfvSGIX");
+  glNonlinLightfvSGIX(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glNonlinMaterialfvSGIX (GLenum a0, GLenum a1, GLint a2, const GLfloat* a3)
+{
+  glNonlinMaterialfvSGIX = (PFNGLNONLINMATERIALFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glNonlinMaterialfvSGIX");
+  glNonlinMaterialfvSGIX(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glPixelTexGenSGIX (GLenum a0)
+{
+  glPixelTexGenSGIX = (PFNGLPIXELTEXGENSGIXPROC)glewGetProcAddress((const GLubyte*)"glPixelTexGenSGIX");
+  glPixelTexGenSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glDeformSGIX (GLbitfield a0)
+{
+  glDeformSGIX = (PFNGLDEFORMSGIXPROC)glewGetProcAddress((const GLubyte*)"glDeformSGIX");
+  glDeformSGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadIdentityDeformationMapSGIX (GLbitfield a0)
+{
+  glLoadIdentityDeformationMapSGIX = (PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)glewGetProcAddress((const GLubyte*)"glLoadIdentityDeformationMapSGIX");
+  glLoadIdentityDeformationMapSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glMeshBreadthSGIX (GLint a0)
+{
+  glMeshBreadthSGIX = (PFNGLMESHBREADTHSGIXPROC)glewGetProcAddress((const GLubyte*)"glMeshBreadthSGIX");
+  glMeshBreadthSGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glMeshStrideSGIX (GLint a0)
+{
+  glMeshStrideSGIX = (PFNGLMESHSTRIDESGIXPROC)glewGetProcAddress((const GLubyte*)"glMeshStrideSGIX");
+  glMeshStrideSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glReferencePlaneSGIX (const GLdouble* a0)
+{
+  glReferencePlaneSGIX = (PFNGLREFERENCEPLANESGIXPROC)glewGetProcAddress((const GLubyte*)"glReferencePlaneSGIX");
+  glReferencePlaneSGIX(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glSpriteParameterfSGIX (GLenum a0, GLfloat a1)
+{
+  glSpriteParameterfSGIX = (PFNGLSPRITEPARAMETERFSGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameterfSGIX");
+  glSpriteParameterfSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSpriteParameterfvSGIX (GLenum a0, GLfloat* a1)
+{
+  glSpriteParameterfvSGIX = (PFNGLSPRITEPARAMETERFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameterfvSGIX");
+  glSpriteParameterfvSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSpriteParameteriSGIX (GLenum a0, GLint a1)
+{
+  glSpriteParameteriSGIX = (PFNGLSPRITEPARAMETERISGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameteriSGIX");
+  glSpriteParameteriSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glSpriteParameterivSGIX (GLenum a0, GLint* a1)
+{
+  glSpriteParameterivSGIX = (PFNGLSPRITEPARAMETERIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameterivSGIX");
+  glSpriteParameterivSGIX(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glTagSampleBufferSGIX (void)
+{
+  glTagSampleBufferSGIX = (PFNGLTAGSAMPLEBUFFERSGIXPROC)glewGetProcAddress((const GLubyte*)"glTagSampleBufferSGIX");
+  glTagSampleBufferSGIX();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetVectorOperationSGIX (GLenum a0)
+{
+  glGetVectorOperationSGIX = (PFNGLGETVECTOROPERATIONSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetVectorOperationSGIX");
+  glGetVectorOperationSGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glVectorOperationSGIX (GLenum a0)
+{
+  glVectorOperationSGIX = (PFNGLVECTOROPERATIONSGIXPROC)glewGetProcAddress((const GLubyte*)"glVectorOperationSGIX");
+  glVectorOperationSGIX(a0);
+}
+
+
+
+static GLboolean GLAPIENTRY _glewLazy_glAreVertexArraysResidentSGIX (GLsizei a0, const GLuint* a1, GLboolean* a2)
+{
+  glAreVertexArraysResidentSGIX = (PFNGLAREVERTEXARRAYSRESIDENTSGIXPROC)glewGetProcAddress((const GLubyte*)"glAreVertexArraysResidentSGIX");
+  return glAreVertexArraysResidentSGIX(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVertexArraySGIX (GLuint a0)
+{
+  glBindVertexArraySGIX = (PFNGLBINDVERTEXARRAYSGIXPROC)glewGetProcAddress((const GLubyte*)"glBindVertexArraySGIX");
+  glBindVertexArraySGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexArraysSGIX (GLsizei a0, const GLuint* a1)
+{
+  glDeleteVertexArraysSGIX = (PFNGLDELETEVERTEXARRAYSSGIXPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexArraysSGIX");
+  glDeleteVertexArraysSGIX(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glGenVertexArraysSGIX (GLsizei a0, GLuint* a1)
+{
+  glGenVertexArraysSGIX = (PFNGLGENVERTEXARRAYSSGIXPROC)glewGetProcAddress((const GLubyte*)"glGenVertexArraysSGIX");
+  glGenVertexArraysSGIX(a0, a1);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexArraySGIX (GLuint a0)
+{
+  glIsVertexArraySGIX = (PFNGLISVERTEXARRAYSGIXPROC)glewGetProcAddress((const GLubyte*)"glIsVertexArraySGIX");
+  return glIsVertexArraySGIX(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glPrioritizeVertexArraysSGIX (GLsizei a0, const GLuint* a1, const GLclampf* a2)
+{
+  glPrioritizeVertexArraysSGIX = (PFNGLPRIORITIZEVERTEXARRAYSSGIXPROC)glewGetProcAddress((const GLubyte*)"glPrioritizeVertexArraysSGIX");
+  glPrioritizeVertexArraysSGIX(a0, a1, a2);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColorTableParameterfvSGI (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glColorTableParameterfvSGI = (PFNGLCOLORTABLEPARAMETERFVSGIPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameterfvSGI");
+  glColorTableParameterfvSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableParameterivSGI (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glColorTableParameterivSGI = (PFNGLCOLORTABLEPARAMETERIVSGIPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameterivSGI");
+  glColorTableParameterivSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableSGI (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  glColorTableSGI = (PFNGLCOLORTABLESGIPROC)glewGetProcAddress((const GLubyte*)"glColorTableSGI");
+  glColorTableSGI(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorTableSGI (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  glCopyColorTableSGI = (PFNGLCOPYCOLORTABLESGIPROC)glewGetProcAddress((const GLubyte*)"glCopyColorTableSGI");
+  glCopyColorTableSGI(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterfvSGI (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetColorTableParameterfvSGI = (PFNGLGETCOLORTABLEPARAMETERFVSGIPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterfvSGI");
+  glGetColorTableParameterfvSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterivSGI (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetColorTableParameterivSGI = (PFNGLGETCOLORTABLEPARAMETERIVSGIPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterivSGI");
+  glGetColorTableParameterivSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableSGI (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  glGetColorTableSGI = (PFNGLGETCOLORTABLESGIPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableSGI");
+  glGetColorTableSGI(a0, a1, a2, a3);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGetPixelTransformParameterfvSGI (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  glGetPixelTransformParameterfvSGI = (PFNGLGETPIXELTRANSFORMPARAMETERFVSGIPROC)glewGetProcAddress((const GLubyte*)"glGetPixelTransformParameterfvSGI");
+  glGetPixelTransformParameterfvSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPixelTransformParameterivSGI (GLenum a0, GLenum a1, GLint* a2)
+{
+  glGetPixelTransformParameterivSGI = (PFNGLGETPIXELTRANSFORMPARAMETERIVSGIPROC)glewGetProcAddress((const GLubyte*)"glGetPixelTransformParameterivSGI");
+  glGetPixelTransformParameterivSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterfSGI (GLenum a0, GLenum a1, GLfloat a2)
+{
+  glPixelTransformParameterfSGI = (PFNGLPIXELTRANSFORMPARAMETERFSGIPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterfSGI");
+  glPixelTransformParameterfSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterfvSGI (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  glPixelTransformParameterfvSGI = (PFNGLPIXELTRANSFORMPARAMETERFVSGIPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterfvSGI");
+  glPixelTransformParameterfvSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameteriSGI (GLenum a0, GLenum a1, GLint a2)
+{
+  glPixelTransformParameteriSGI = (PFNGLPIXELTRANSFORMPARAMETERISGIPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameteriSGI");
+  glPixelTransformParameteriSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterivSGI (GLenum a0, GLenum a1, const GLint* a2)
+{
+  glPixelTransformParameterivSGI = (PFNGLPIXELTRANSFORMPARAMETERIVSGIPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterivSGI");
+  glPixelTransformParameterivSGI(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformSGI (GLenum a0)
+{
+  glPixelTransformSGI = (PFNGLPIXELTRANSFORMSGIPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformSGI");
+  glPixelTransformSGI(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glFinishTextureSUNX (void)
+{
+  glFinishTextureSUNX = (PFNGLFINISHTEXTURESUNXPROC)glewGetProcAddress((const GLubyte*)"glFinishTextureSUNX");
+  glFinishTextureSUNX();
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorbSUN (GLbyte a0)
+{
+  glGlobalAlphaFactorbSUN = (PFNGLGLOBALALPHAFACTORBSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorbSUN");
+  glGlobalAlphaFactorbSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactordSUN (GLdouble a0)
+{
+  glGlobalAlphaFactordSUN = (PFNGLGLOBALALPHAFACTORDSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactordSUN");
+  glGlobalAlphaFactordSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorfSUN (GLfloat a0)
+{
+  glGlobalAlphaFactorfSUN = (PFNGLGLOBALALPHAFACTORFSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorfSUN");
+  glGlobalAlphaFactorfSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactoriSUN (GLint a0)
+{
+  glGlobalAlphaFactoriSUN = (PFNGLGLOBALALPHAFACTORISUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactoriSUN");
+  glGlobalAlphaFactoriSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorsSUN (GLshort a0)
+{
+  glGlobalAlphaFactorsSUN = (PFNGLGLOBALALPHAFACTORSSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorsSUN");
+  glGlobalAlphaFactorsSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorubSUN (GLubyte a0)
+{
+  glGlobalAlphaFactorubSUN = (PFNGLGLOBALALPHAFACTORUBSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorubSUN");
+  glGlobalAlphaFactorubSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactoruiSUN (GLuint a0)
+{
+  glGlobalAlphaFactoruiSUN = (PFNGLGLOBALALPHAFACTORUISUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactoruiSUN");
+  glGlobalAlphaFactoruiSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorusSUN (GLushort a0)
+{
+  glGlobalAlphaFactorusSUN = (PFNGLGLOBALALPHAFACTORUSSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorusSUN");
+  glGlobalAlphaFactorusSUN(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glReadVideoPixelsSUN (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void* a6)
+{
+  glReadVideoPixelsSUN = (PFNGLREADVIDEOPIXELSSUNPROC)glewGetProcAddress((const GLubyte*)"glReadVideoPixelsSUN");
+  glReadVideoPixelsSUN(a0, a1, a2, a3, a4, a5, a6);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glReplacementCodePointerSUN (GLenum a0, GLsizei a1, const void * a2)
+{
+  glReplacementCodePointerSUN = (PFNGLREPLACEMENTCODEPOINTERSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodePointerSUN");
+  glReplacementCodePointerSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeubSUN (GLubyte a0)
+{
+  glReplacementCodeubSUN = (PFNGLREPLACEMENTCODEUBSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeubSUN");
+  glReplacementCodeubSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeubvSUN (const GLubyte* a0)
+{
+  glReplacementCodeubvSUN = (PFNGLREPLACEMENTCODEUBVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeubvSUN");
+  glReplacementCodeubvSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiSUN (GLuint a0)
+{
+  glReplacementCodeuiSUN = (PFNGLREPLACEMENTCODEUISUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiSUN");
+  glReplacementCodeuiSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuivSUN (const GLuint* a0)
+{
+  glReplacementCodeuivSUN = (PFNGLREPLACEMENTCODEUIVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuivSUN");
+  glReplacementCodeuivSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeusSUN (GLushort a0)
+{
+  glReplacementCodeusSUN = (PFNGLREPLACEMENTCODEUSSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeusSUN");
+  glReplacementCodeusSUN(a0);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeusvSUN (const GLushort* a0)
+{
+  glReplacementCodeusvSUN = (PFNGLREPLACEMENTCODEUSVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeusvSUN");
+  glReplacementCodeusvSUN(a0);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glColor3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glColor3fVertex3fSUN = (PFNGLCOLOR3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor3fVertex3fSUN");
+  glColor3fVertex3fSUN(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glColor3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  glColor3fVertex3fvSUN = (PFNGLCOLOR3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor3fVertex3fvSUN");
+  glColor3fVertex3fvSUN(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4fNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9)
+{
+  glColor4fNormal3fVertex3fSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4fNormal3fVertex3fSUN");
+  glColor4fNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4fNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  glColor4fNormal3fVertex3fvSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4fNormal3fVertex3fvSUN");
+  glColor4fNormal3fVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex2fSUN (GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3, GLfloat a4, GLfloat a5)
+{
+  glColor4ubVertex2fSUN = (PFNGLCOLOR4UBVERTEX2FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex2fSUN");
+  glColor4ubVertex2fSUN(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex2fvSUN (const GLubyte* a0, const GLfloat * a1)
+{
+  glColor4ubVertex2fvSUN = (PFNGLCOLOR4UBVERTEX2FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex2fvSUN");
+  glColor4ubVertex2fvSUN(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex3fSUN (GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  glColor4ubVertex3fSUN = (PFNGLCOLOR4UBVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex3fSUN");
+  glColor4ubVertex3fSUN(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex3fvSUN (const GLubyte* a0, const GLfloat * a1)
+{
+  glColor4ubVertex3fvSUN = (PFNGLCOLOR4UBVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex3fvSUN");
+  glColor4ubVertex3fvSUN(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glNormal3fVertex3fSUN = (PFNGLNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glNormal3fVertex3fSUN");
+  glNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  glNormal3fVertex3fvSUN = (PFNGLNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glNormal3fVertex3fvSUN");
+  glNormal3fVertex3fvSUN(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  glReplacementCodeuiColor3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor3fVertex3fSUN");
+  glReplacementCodeuiColor3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  glReplacementCodeuiColor3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor3fVertex3fvSUN");
+  glReplacementCodeuiColor3fVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10)
+{
+  glReplacementCodeuiColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4fNormal3fVertex3fSUN");
+  glReplacementCodeuiColor4fNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4fNormal3fVertex3fvSUN");
+  glReplacementCodeuiColor4fNormal3fVertex3fvSUN(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4ubVertex3fSUN (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glReplacementCodeuiColor4ubVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4ubVertex3fSUN");
+  glReplacementCodeuiColor4ubVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4ubVertex3fvSUN (const GLuint* a0, const GLubyte * a1, const GLfloat * a2)
+{
+  glReplacementCodeuiColor4ubVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4ubVertex3fvSUN");
+  glReplacementCodeuiColor4ubVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  glReplacementCodeuiNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiNormal3fVertex3fSUN");
+  glReplacementCodeuiNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  glReplacementCodeuiNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiNormal3fVertex3fvSUN");
+  glReplacementCodeuiNormal3fVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11, GLfloat a12)
+{
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN");
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3, const GLfloat * a4)
+{
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN");
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8)
+{
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN");
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN");
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  glReplacementCodeuiTexCoord2fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fVertex3fSUN");
+  glReplacementCodeuiTexCoord2fVertex3fSUN(a0, a1, a2, a3, a4, a5);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  glReplacementCodeuiTexCoord2fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fVertex3fvSUN");
+  glReplacementCodeuiTexCoord2fVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  glReplacementCodeuiVertex3fSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiVertex3fSUN");
+  glReplacementCodeuiVertex3fSUN(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiVertex3fvSUN (const GLuint* a0, const GLfloat * a1)
+{
+  glReplacementCodeuiVertex3fvSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiVertex3fvSUN");
+  glReplacementCodeuiVertex3fvSUN(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glTexCoord2fColor3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor3fVertex3fSUN");
+  glTexCoord2fColor3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  glTexCoord2fColor3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor3fVertex3fvSUN");
+  glTexCoord2fColor3fVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4fNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11)
+{
+  glTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4fNormal3fVertex3fSUN");
+  glTexCoord2fColor4fNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4fNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  glTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4fNormal3fVertex3fvSUN");
+  glTexCoord2fColor4fNormal3fVertex3fvSUN(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4ubVertex3fSUN (GLfloat a0, GLfloat a1, GLubyte a2, GLubyte a3, GLubyte a4, GLubyte a5, GLfloat a6, GLfloat a7, GLfloat a8)
+{
+  glTexCoord2fColor4ubVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4ubVertex3fSUN");
+  glTexCoord2fColor4ubVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4ubVertex3fvSUN (const GLfloat* a0, const GLubyte * a1, const GLfloat * a2)
+{
+  glTexCoord2fColor4ubVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4ubVertex3fvSUN");
+  glTexCoord2fColor4ubVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glTexCoord2fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fNormal3fVertex3fSUN");
+  glTexCoord2fNormal3fVertex3fSUN(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  glTexCoord2fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fNormal3fVertex3fvSUN");
+  glTexCoord2fNormal3fVertex3fvSUN(a0, a1, a2);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  glTexCoord2fVertex3fSUN = (PFNGLTEXCOORD2FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fVertex3fSUN");
+  glTexCoord2fVertex3fSUN(a0, a1, a2, a3, a4);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  glTexCoord2fVertex3fvSUN = (PFNGLTEXCOORD2FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fVertex3fvSUN");
+  glTexCoord2fVertex3fvSUN(a0, a1);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fColor4fNormal3fVertex4fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11, GLfloat a12, GLfloat a13, GLfloat a14)
+{
+  glTexCoord4fColor4fNormal3fVertex4fSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fColor4fNormal3fVertex4fSUN");
+  glTexCoord4fColor4fNormal3fVertex4fSUN(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fColor4fNormal3fVertex4fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  glTexCoord4fColor4fNormal3fVertex4fvSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fColor4fNormal3fVertex4fvSUN");
+  glTexCoord4fColor4fNormal3fVertex4fvSUN(a0, a1, a2, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fVertex4fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  glTexCoord4fVertex4fSUN = (PFNGLTEXCOORD4FVERTEX4FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fVertex4fSUN");
+  glTexCoord4fVertex4fSUN(a0, a1, a2, a3, a4, a5, a6, a7);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fVertex4fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  glTexCoord4fVertex4fvSUN = (PFNGLTEXCOORD4FVERTEX4FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fVertex4fvSUN");
+  glTexCoord4fVertex4fvSUN(a0, a1);
+}
+
+
+
+static void GLAPIENTRY _glewLazy_glAddSwapHintRectWIN (GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  glAddSwapHintRectWIN = (PFNGLADDSWAPHINTRECTWINPROC)glewGetProcAddress((const GLubyte*)"glAddSwapHintRectWIN");
+  glAddSwapHintRectWIN(a0, a1, a2, a3);
+}
+
+
+static const _GLEWProc _glewLazyFunctions[] = {
+  (_GLEWProc)_glewLazy_glCopyTexSubImage3D,
+  (_GLEWProc)_glewLazy_glDrawRangeElements,
+  (_GLEWProc)_glewLazy_glTexImage3D,
+  (_GLEWProc)_glewLazy_glTexSubImage3D,
+
+  (_GLEWProc)_glewLazy_glActiveTexture,
+  (_GLEWProc)_glewLazy_glClientActiveTexture,
+  (_GLEWProc)_glewLazy_glCompressedTexImage1D,
+  (_GLEWProc)_glewLazy_glCompressedTexImage2D,
+  (_GLEWProc)_glewLazy_glCompressedTexImage3D,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage1D,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage2D,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage3D,
+  (_GLEWProc)_glewLazy_glGetCompressedTexImage,
+  (_GLEWProc)_glewLazy_glLoadTransposeMatrixd,
+  (_GLEWProc)_glewLazy_glLoadTransposeMatrixf,
+  (_GLEWProc)_glewLazy_glMultTransposeMatrixd,
+  (_GLEWProc)_glewLazy_glMultTransposeMatrixf,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1d,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1dv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1f,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1fv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1i,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1iv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1s,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1sv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2d,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2dv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2f,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2fv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2i,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2iv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2s,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2sv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3d,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3dv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3f,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3fv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3i,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3iv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3s,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3sv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4d,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4dv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4f,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4fv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4i,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4iv,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4s,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4sv,
+  (_GLEWProc)_glewLazy_glSampleCoverage,
+
+  (_GLEWProc)_glewLazy_glBlendColor,
+  (_GLEWProc)_glewLazy_glBlendEquation,
+  (_GLEWProc)_glewLazy_glBlendFuncSeparate,
+  (_GLEWProc)_glewLazy_glFogCoordPointer,
+  (_GLEWProc)_glewLazy_glFogCoordd,
+  (_GLEWProc)_glewLazy_glFogCoorddv,
+  (_GLEWProc)_glewLazy_glFogCoordf,
+  (_GLEWProc)_glewLazy_glFogCoordfv,
+  (_GLEWProc)_glewLazy_glMultiDrawArrays,
+  (_GLEWProc)_glewLazy_glMultiDrawElements,
+  (_GLEWProc)_glewLazy_glPointParameterf,
+  (_GLEWProc)_glewLazy_glPointParameterfv,
+  (_GLEWProc)_glewLazy_glPointParameteri,
+  (_GLEWProc)_glewLazy_glPointParameteriv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3b,
+  (_GLEWProc)_glewLazy_glSecondaryColor3bv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3d,
+  (_GLEWProc)_glewLazy_glSecondaryColor3dv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3f,
+  (_GLEWProc)_glewLazy_glSecondaryColor3fv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3i,
+  (_GLEWProc)_glewLazy_glSecondaryColor3iv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3s,
+  (_GLEWProc)_glewLazy_glSecondaryColor3sv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3ub,
+  (_GLEWProc)_glewLazy_glSecondaryColor3ubv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3ui,
+  (_GLEWProc)_glewLazy_glSecondaryColor3uiv,
+  (_GLEWProc)_glewLazy_glSecondaryColor3us,
+  (_GLEWProc)_glewLazy_glSecondaryColor3usv,
+  (_GLEWProc)_glewLazy_glSecondaryColorPointer,
+  (_GLEWProc)_glewLazy_glWindowPos2d,
+  (_GLEWProc)_glewLazy_glWindowPos2dv,
+  (_GLEWProc)_glewLazy_glWindowPos2f,
+  (_GLEWProc)_glewLazy_glWindowPos2fv,
+  (_GLEWProc)_glewLazy_glWindowPos2i,
+  (_GLEWProc)_glewLazy_glWindowPos2iv,
+  (_GLEWProc)_glewLazy_glWindowPos2s,
+  (_GLEWProc)_glewLazy_glWindowPos2sv,
+  (_GLEWProc)_glewLazy_glWindowPos3d,
+  (_GLEWProc)_glewLazy_glWindowPos3dv,
+  (_GLEWProc)_glewLazy_glWindowPos3f,
+  (_GLEWProc)_glewLazy_glWindowPos3fv,
+  (_GLEWProc)_glewLazy_glWindowPos3i,
+  (_GLEWProc)_glewLazy_glWindowPos3iv,
+  (_GLEWProc)_glewLazy_glWindowPos3s,
+  (_GLEWProc)_glewLazy_glWindowPos3sv,
+
+  (_GLEWProc)_glewLazy_glBeginQuery,
+  (_GLEWProc)_glewLazy_glBindBuffer,
+  (_GLEWProc)_glewLazy_glBufferData,
+  (_GLEWProc)_glewLazy_glBufferSubData,
+  (_GLEWProc)_glewLazy_glDeleteBuffers,
+  (_GLEWProc)_glewLazy_glDeleteQueries,
+  (_GLEWProc)_glewLazy_glEndQuery,
+  (_GLEWProc)_glewLazy_glGenBuffers,
+  (_GLEWProc)_glewLazy_glGenQueries,
+  (_GLEWProc)_glewLazy_glGetBufferParameteriv,
+  (_GLEWProc)_glewLazy_glGetBufferPointerv,
+  (_GLEWProc)_glewLazy_glGetBufferSubData,
+  (_GLEWProc)_glewLazy_glGetQueryObjectiv,
+  (_GLEWProc)_glewLazy_glGetQueryObjectuiv,
+  (_GLEWProc)_glewLazy_glGetQueryiv,
+  (_GLEWProc)_glewLazy_glIsBuffer,
+  (_GLEWProc)_glewLazy_glIsQuery,
+  (_GLEWProc)_glewLazy_glMapBuffer,
+  (_GLEWProc)_glewLazy_glUnmapBuffer,
+
+  (_GLEWProc)_glewLazy_glAttachShader,
+  (_GLEWProc)_glewLazy_glBindAttribLocation,
+  (_GLEWProc)_glewLazy_glBlendEquationSeparate,
+  (_GLEWProc)_glewLazy_glCompileShader,
+  (_GLEWProc)_glewLazy_glCreateProgram,
+  (_GLEWProc)_glewLazy_glCreateShader,
+  (_GLEWProc)_glewLazy_glDeleteProgram,
+  (_GLEWProc)_glewLazy_glDeleteShader,
+  (_GLEWProc)_glewLazy_glDetachShader,
+  (_GLEWProc)_glewLazy_glDisableVertexAttribArray,
+  (_GLEWProc)_glewLazy_glDrawBuffers,
+  (_GLEWProc)_glewLazy_glEnableVertexAttribArray,
+  (_GLEWProc)_glewLazy_glGetActiveAttrib,
+  (_GLEWProc)_glewLazy_glGetActiveUniform,
+  (_GLEWProc)_glewLazy_glGetAttachedShaders,
+  (_GLEWProc)_glewLazy_glGetAttribLocation,
+  (_GLEWProc)_glewLazy_glGetProgramInfoLog,
+  (_GLEWProc)_glewLazy_glGetProgramiv,
+  (_GLEWProc)_glewLazy_glGetShaderInfoLog,
+  (_GLEWProc)_glewLazy_glGetShaderSource,
+  (_GLEWProc)_glewLazy_glGetShaderiv,
+  (_GLEWProc)_glewLazy_glGetUniformLocation,
+  (_GLEWProc)_glewLazy_glGetUniformfv,
+  (_GLEWProc)_glewLazy_glGetUniformiv,
+  (_GLEWProc)_glewLazy_glGetVertexAttribPointerv,
+  (_GLEWProc)_glewLazy_glGetVertexAttribdv,
+  (_GLEWProc)_glewLazy_glGetVertexAttribfv,
+  (_GLEWProc)_glewLazy_glGetVertexAttribiv,
+  (_GLEWProc)_glewLazy_glIsProgram,
+  (_GLEWProc)_glewLazy_glIsShader,
+  (_GLEWProc)_glewLazy_glLinkProgram,
+  (_GLEWProc)_glewLazy_glShaderSource,
+  (_GLEWProc)_glewLazy_glStencilFuncSeparate,
+  (_GLEWProc)_glewLazy_glStencilMaskSeparate,
+  (_GLEWProc)_glewLazy_glStencilOpSeparate,
+  (_GLEWProc)_glewLazy_glUniform1f,
+  (_GLEWProc)_glewLazy_glUniform1fv,
+  (_GLEWProc)_glewLazy_glUniform1i,
+  (_GLEWProc)_glewLazy_glUniform1iv,
+  (_GLEWProc)_glewLazy_glUniform2f,
+  (_GLEWProc)_glewLazy_glUniform2fv,
+  (_GLEWProc)_glewLazy_glUniform2i,
+  (_GLEWProc)_glewLazy_glUniform2iv,
+  (_GLEWProc)_glewLazy_glUniform3f,
+  (_GLEWProc)_glewLazy_glUniform3fv,
+  (_GLEWProc)_glewLazy_glUniform3i,
+  (_GLEWProc)_glewLazy_glUniform3iv,
+  (_GLEWProc)_glewLazy_glUniform4f,
+  (_GLEWProc)_glewLazy_glUniform4fv,
+  (_GLEWProc)_glewLazy_glUniform4i,
+  (_GLEWProc)_glewLazy_glUniform4iv,
+  (_GLEWProc)_glewLazy_glUniformMatrix2fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix3fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix4fv,
+  (_GLEWProc)_glewLazy_glUseProgram,
+  (_GLEWProc)_glewLazy_glValidateProgram,
+  (_GLEWProc)_glewLazy_glVertexAttrib1d,
+  (_GLEWProc)_glewLazy_glVertexAttrib1dv,
+  (_GLEWProc)_glewLazy_glVertexAttrib1f,
+  (_GLEWProc)_glewLazy_glVertexAttrib1fv,
+  (_GLEWProc)_glewLazy_glVertexAttrib1s,
+  (_GLEWProc)_glewLazy_glVertexAttrib1sv,
+  (_GLEWProc)_glewLazy_glVertexAttrib2d,
+  (_GLEWProc)_glewLazy_glVertexAttrib2dv,
+  (_GLEWProc)_glewLazy_glVertexAttrib2f,
+  (_GLEWProc)_glewLazy_glVertexAttrib2fv,
+  (_GLEWProc)_glewLazy_glVertexAttrib2s,
+  (_GLEWProc)_glewLazy_glVertexAttrib2sv,
+  (_GLEWProc)_glewLazy_glVertexAttrib3d,
+  (_GLEWProc)_glewLazy_glVertexAttrib3dv,
+  (_GLEWProc)_glewLazy_glVertexAttrib3f,
+  (_GLEWProc)_glewLazy_glVertexAttrib3fv,
+  (_GLEWProc)_glewLazy_glVertexAttrib3s,
+  (_GLEWProc)_glewLazy_glVertexAttrib3sv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Nbv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Niv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Nsv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Nub,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Nubv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Nuiv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4Nusv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4bv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4d,
+  (_GLEWProc)_glewLazy_glVertexAttrib4dv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4f,
+  (_GLEWProc)_glewLazy_glVertexAttrib4fv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4iv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4s,
+  (_GLEWProc)_glewLazy_glVertexAttrib4sv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4ubv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4uiv,
+  (_GLEWProc)_glewLazy_glVertexAttrib4usv,
+  (_GLEWProc)_glewLazy_glVertexAttribPointer,
+
+  (_GLEWProc)_glewLazy_glUniformMatrix2x3fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix2x4fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix3x2fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix3x4fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix4x2fv,
+  (_GLEWProc)_glewLazy_glUniformMatrix4x3fv,
+
+  (_GLEWProc)_glewLazy_glBeginConditionalRender,
+  (_GLEWProc)_glewLazy_glBeginTransformFeedback,
+  (_GLEWProc)_glewLazy_glBindFragDataLocation,
+  (_GLEWProc)_glewLazy_glClampColor,
+  (_GLEWProc)_glewLazy_glClearBufferfi,
+  (_GLEWProc)_glewLazy_glClearBufferfv,
+  (_GLEWProc)_glewLazy_glClearBufferiv,
+  (_GLEWProc)_glewLazy_glClearBufferuiv,
+  (_GLEWProc)_glewLazy_glColorMaski,
+  (_GLEWProc)_glewLazy_glDisablei,
+  (_GLEWProc)_glewLazy_glEnablei,
+  (_GLEWProc)_glewLazy_glEndConditionalRender,
+  (_GLEWProc)_glewLazy_glEndTransformFeedback,
+  (_GLEWProc)_glewLazy_glGetBooleani_v,
+  (_GLEWProc)_glewLazy_glGetFragDataLocation,
+  (_GLEWProc)_glewLazy_glGetStringi,
+  (_GLEWProc)_glewLazy_glGetTexParameterIiv,
+  (_GLEWProc)_glewLazy_glGetTexParameterIuiv,
+  (_GLEWProc)_glewLazy_glGetTransformFeedbackVarying,
+  (_GLEWProc)_glewLazy_glGetUniformuiv,
+  (_GLEWProc)_glewLazy_glGetVertexAttribIiv,
+  (_GLEWProc)_glewLazy_glGetVertexAttribIuiv,
+  (_GLEWProc)_glewLazy_glIsEnabledi,
+  (_GLEWProc)_glewLazy_glTexParameterIiv,
+  (_GLEWProc)_glewLazy_glTexParameterIuiv,
+  (_GLEWProc)_glewLazy_glTransformFeedbackVaryings,
+  (_GLEWProc)_glewLazy_glUniform1ui,
+  (_GLEWProc)_glewLazy_glUniform1uiv,
+  (_GLEWProc)_glewLazy_glUniform2ui,
+  (_GLEWProc)_glewLazy_glUniform2uiv,
+  (_GLEWProc)_glewLazy_glUniform3ui,
+  (_GLEWProc)_glewLazy_glUniform3uiv,
+  (_GLEWProc)_glewLazy_glUniform4ui,
+  (_GLEWProc)_glewLazy_glUniform4uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribI1i,
+  (_GLEWProc)_glewLazy_glVertexAttribI1iv,
+  (_GLEWProc)_glewLazy_glVertexAttribI1ui,
+  (_GLEWProc)_glewLazy_glVertexAttribI1uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribI2i,
+  (_GLEWProc)_glewLazy_glVertexAttribI2iv,
+  (_GLEWProc)_glewLazy_glVertexAttribI2ui,
+  (_GLEWProc)_glewLazy_glVertexAttribI2uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribI3i,
+  (_GLEWProc)_glewLazy_glVertexAttribI3iv,
+  (_GLEWProc)_glewLazy_glVertexAttribI3ui,
+  (_GLEWProc)_glewLazy_glVertexAttribI3uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribI4bv,
+  (_GLEWProc)_glewLazy_glVertexAttribI4i,
+  (_GLEWProc)_glewLazy_glVertexAttribI4iv,
+  (_GLEWProc)_glewLazy_glVertexAttribI4sv,
+  (_GLEWProc)_glewLazy_glVertexAttribI4ubv,
+  (_GLEWProc)_glewLazy_glVertexAttribI4ui,
+  (_GLEWProc)_glewLazy_glVertexAttribI4uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribI4usv,
+  (_GLEWProc)_glewLazy_glVertexAttribIPointer,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstanced,
+  (_GLEWProc)_glewLazy_glDrawElementsInstanced,
+  (_GLEWProc)_glewLazy_glPrimitiveRestartIndex,
+  (_GLEWProc)_glewLazy_glTexBuffer,
+
+  (_GLEWProc)_glewLazy_glFramebufferTexture,
+  (_GLEWProc)_glewLazy_glGetBufferParameteri64v,
+  (_GLEWProc)_glewLazy_glGetInteger64i_v,
+
+  (_GLEWProc)_glewLazy_glVertexAttribDivisor,
+
+  (_GLEWProc)_glewLazy_glBlendEquationSeparatei,
+  (_GLEWProc)_glewLazy_glBlendEquationi,
+  (_GLEWProc)_glewLazy_glBlendFuncSeparatei,
+  (_GLEWProc)_glewLazy_glBlendFunci,
+  (_GLEWProc)_glewLazy_glMinSampleShading,
+
+  (_GLEWProc)_glewLazy_glGetGraphicsResetStatus,
+  (_GLEWProc)_glewLazy_glGetnCompressedTexImage,
+  (_GLEWProc)_glewLazy_glGetnTexImage,
+  (_GLEWProc)_glewLazy_glGetnUniformdv,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirectCount,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirectCount,
+  (_GLEWProc)_glewLazy_glSpecializeShader,
+
+  (_GLEWProc)_glewLazy_glTbufferMask3DFX,
+
+  (_GLEWProc)_glewLazy_glDebugMessageCallbackAMD,
+  (_GLEWProc)_glewLazy_glDebugMessageEnableAMD,
+  (_GLEWProc)_glewLazy_glDebugMessageInsertAMD,
+  (_GLEWProc)_glewLazy_glGetDebugMessageLogAMD,
+
+  (_GLEWProc)_glewLazy_glBlendEquationIndexedAMD,
+  (_GLEWProc)_glewLazy_glBlendEquationSeparateIndexedAMD,
+  (_GLEWProc)_glewLazy_glBlendFuncIndexedAMD,
+  (_GLEWProc)_glewLazy_glBlendFuncSeparateIndexedAMD,
+
+  (_GLEWProc)_glewLazy_glNamedRenderbufferStorageMultisampleAdvancedAMD,
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleAdvancedAMD,
+
+  (_GLEWProc)_glewLazy_glFramebufferSamplePositionsfvAMD,
+  (_GLEWProc)_glewLazy_glGetFramebufferParameterfvAMD,
+  (_GLEWProc)_glewLazy_glGetNamedFramebufferParameterfvAMD,
+  (_GLEWProc)_glewLazy_glNamedFramebufferSamplePositionsfvAMD,
+
+  (_GLEWProc)_glewLazy_glVertexAttribParameteriAMD,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirectAMD,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirectAMD,
+
+  (_GLEWProc)_glewLazy_glDeleteNamesAMD,
+  (_GLEWProc)_glewLazy_glGenNamesAMD,
+  (_GLEWProc)_glewLazy_glIsNameAMD,
+
+  (_GLEWProc)_glewLazy_glQueryObjectParameteruiAMD,
+
+  (_GLEWProc)_glewLazy_glBeginPerfMonitorAMD,
+  (_GLEWProc)_glewLazy_glDeletePerfMonitorsAMD,
+  (_GLEWProc)_glewLazy_glEndPerfMonitorAMD,
+  (_GLEWProc)_glewLazy_glGenPerfMonitorsAMD,
+  (_GLEWProc)_glewLazy_glGetPerfMonitorCounterDataAMD,
+  (_GLEWProc)_glewLazy_glGetPerfMonitorCounterInfoAMD,
+  (_GLEWProc)_glewLazy_glGetPerfMonitorCounterStringAMD,
+  (_GLEWProc)_glewLazy_glGetPerfMonitorCountersAMD,
+  (_GLEWProc)_glewLazy_glGetPerfMonitorGroupStringAMD,
+  (_GLEWProc)_glewLazy_glGetPerfMonitorGroupsAMD,
+  (_GLEWProc)_glewLazy_glSelectPerfMonitorCountersAMD,
+
+  (_GLEWProc)_glewLazy_glSetMultisamplefvAMD,
+
+  (_GLEWProc)_glewLazy_glTexStorageSparseAMD,
+  (_GLEWProc)_glewLazy_glTextureStorageSparseAMD,
+
+  (_GLEWProc)_glewLazy_glStencilOpValueAMD,
+
+  (_GLEWProc)_glewLazy_glTessellationFactorAMD,
+  (_GLEWProc)_glewLazy_glTessellationModeAMD,
+
+  (_GLEWProc)_glewLazy_glBlitFramebufferANGLE,
+
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleANGLE,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstancedANGLE,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedANGLE,
+  (_GLEWProc)_glewLazy_glVertexAttribDivisorANGLE,
+
+  (_GLEWProc)_glewLazy_glBeginQueryANGLE,
+  (_GLEWProc)_glewLazy_glDeleteQueriesANGLE,
+  (_GLEWProc)_glewLazy_glEndQueryANGLE,
+  (_GLEWProc)_glewLazy_glGenQueriesANGLE,
+  (_GLEWProc)_glewLazy_glGetQueryObjecti64vANGLE,
+  (_GLEWProc)_glewLazy_glGetQueryObjectivANGLE,
+  (_GLEWProc)_glewLazy_glGetQueryObjectui64vANGLE,
+  (_GLEWProc)_glewLazy_glGetQueryObjectuivANGLE,
+  (_GLEWProc)_glewLazy_glGetQueryivANGLE,
+  (_GLEWProc)_glewLazy_glIsQueryANGLE,
+  (_GLEWProc)_glewLazy_glQueryCounterANGLE,
+
+  (_GLEWProc)_glewLazy_glGetTranslatedShaderSourceANGLE,
+
+  (_GLEWProc)_glewLazy_glCopyTextureLevelsAPPLE,
+
+  (_GLEWProc)_glewLazy_glDrawElementArrayAPPLE,
+  (_GLEWProc)_glewLazy_glDrawRangeElementArrayAPPLE,
+  (_GLEWProc)_glewLazy_glElementPointerAPPLE,
+  (_GLEWProc)_glewLazy_glMultiDrawElementArrayAPPLE,
+  (_GLEWProc)_glewLazy_glMultiDrawRangeElementArrayAPPLE,
+
+  (_GLEWProc)_glewLazy_glDeleteFencesAPPLE,
+  (_GLEWProc)_glewLazy_glFinishFenceAPPLE,
+  (_GLEWProc)_glewLazy_glFinishObjectAPPLE,
+  (_GLEWProc)_glewLazy_glGenFencesAPPLE,
+  (_GLEWProc)_glewLazy_glIsFenceAPPLE,
+  (_GLEWProc)_glewLazy_glSetFenceAPPLE,
+  (_GLEWProc)_glewLazy_glTestFenceAPPLE,
+  (_GLEWProc)_glewLazy_glTestObjectAPPLE,
+
+  (_GLEWProc)_glewLazy_glBufferParameteriAPPLE,
+  (_GLEWProc)_glewLazy_glFlushMappedBufferRangeAPPLE,
+
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleAPPLE,
+  (_GLEWProc)_glewLazy_glResolveMultisampleFramebufferAPPLE,
+
+  (_GLEWProc)_glewLazy_glGetObjectParameterivAPPLE,
+  (_GLEWProc)_glewLazy_glObjectPurgeableAPPLE,
+  (_GLEWProc)_glewLazy_glObjectUnpurgeableAPPLE,
+
+  (_GLEWProc)_glewLazy_glClientWaitSyncAPPLE,
+  (_GLEWProc)_glewLazy_glDeleteSyncAPPLE,
+  (_GLEWProc)_glewLazy_glFenceSyncAPPLE,
+  (_GLEWProc)_glewLazy_glGetInteger64vAPPLE,
+  (_GLEWProc)_glewLazy_glGetSyncivAPPLE,
+  (_GLEWProc)_glewLazy_glIsSyncAPPLE,
+  (_GLEWProc)_glewLazy_glWaitSyncAPPLE,
+
+  (_GLEWProc)_glewLazy_glGetTexParameterPointervAPPLE,
+  (_GLEWProc)_glewLazy_glTextureRangeAPPLE,
+
+  (_GLEWProc)_glewLazy_glBindVertexArrayAPPLE,
+  (_GLEWProc)_glewLazy_glDeleteVertexArraysAPPLE,
+  (_GLEWProc)_glewLazy_glGenVertexArraysAPPLE,
+  (_GLEWProc)_glewLazy_glIsVertexArrayAPPLE,
+
+  (_GLEWProc)_glewLazy_glFlushVertexArrayRangeAPPLE,
+  (_GLEWProc)_glewLazy_glVertexArrayParameteriAPPLE,
+  (_GLEWProc)_glewLazy_glVertexArrayRangeAPPLE,
+
+  (_GLEWProc)_glewLazy_glDisableVertexAttribAPPLE,
+  (_GLEWProc)_glewLazy_glEnableVertexAttribAPPLE,
+  (_GLEWProc)_glewLazy_glIsVertexAttribEnabledAPPLE,
+  (_GLEWProc)_glewLazy_glMapVertexAttrib1dAPPLE,
+  (_GLEWProc)_glewLazy_glMapVertexAttrib1fAPPLE,
+  (_GLEWProc)_glewLazy_glMapVertexAttrib2dAPPLE,
+  (_GLEWProc)_glewLazy_glMapVertexAttrib2fAPPLE,
+
+  (_GLEWProc)_glewLazy_glClearDepthf,
+  (_GLEWProc)_glewLazy_glDepthRangef,
+  (_GLEWProc)_glewLazy_glGetShaderPrecisionFormat,
+  (_GLEWProc)_glewLazy_glReleaseShaderCompiler,
+  (_GLEWProc)_glewLazy_glShaderBinary,
+
+  (_GLEWProc)_glewLazy_glMemoryBarrierByRegion,
+
+  (_GLEWProc)_glewLazy_glPrimitiveBoundingBoxARB,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstancedBaseInstance,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedBaseInstance,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedBaseVertexBaseInstance,
+
+  (_GLEWProc)_glewLazy_glGetImageHandleARB,
+  (_GLEWProc)_glewLazy_glGetTextureHandleARB,
+  (_GLEWProc)_glewLazy_glGetTextureSamplerHandleARB,
+  (_GLEWProc)_glewLazy_glGetVertexAttribLui64vARB,
+  (_GLEWProc)_glewLazy_glIsImageHandleResidentARB,
+  (_GLEWProc)_glewLazy_glIsTextureHandleResidentARB,
+  (_GLEWProc)_glewLazy_glMakeImageHandleNonResidentARB,
+  (_GLEWProc)_glewLazy_glMakeImageHandleResidentARB,
+  (_GLEWProc)_glewLazy_glMakeTextureHandleNonResidentARB,
+  (_GLEWProc)_glewLazy_glMakeTextureHandleResidentARB,
+  (_GLEWProc)_glewLazy_glProgramUniformHandleui64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniformHandleui64vARB,
+  (_GLEWProc)_glewLazy_glUniformHandleui64ARB,
+  (_GLEWProc)_glewLazy_glUniformHandleui64vARB,
+  (_GLEWProc)_glewLazy_glVertexAttribL1ui64ARB,
+  (_GLEWProc)_glewLazy_glVertexAttribL1ui64vARB,
+
+  (_GLEWProc)_glewLazy_glBindFragDataLocationIndexed,
+  (_GLEWProc)_glewLazy_glGetFragDataIndex,
+
+  (_GLEWProc)_glewLazy_glBufferStorage,
+
+  (_GLEWProc)_glewLazy_glCreateSyncFromCLeventARB,
+
+  (_GLEWProc)_glewLazy_glClearBufferData,
+  (_GLEWProc)_glewLazy_glClearBufferSubData,
+  (_GLEWProc)_glewLazy_glClearNamedBufferDataEXT,
+  (_GLEWProc)_glewLazy_glClearNamedBufferSubDataEXT,
+
+  (_GLEWProc)_glewLazy_glClearTexImage,
+  (_GLEWProc)_glewLazy_glClearTexSubImage,
+
+  (_GLEWProc)_glewLazy_glClipControl,
+
+  (_GLEWProc)_glewLazy_glClampColorARB,
+
+  (_GLEWProc)_glewLazy_glDispatchCompute,
+  (_GLEWProc)_glewLazy_glDispatchComputeIndirect,
+
+  (_GLEWProc)_glewLazy_glDispatchComputeGroupSizeARB,
+
+  (_GLEWProc)_glewLazy_glCopyBufferSubData,
+
+  (_GLEWProc)_glewLazy_glCopyImageSubData,
+
+  (_GLEWProc)_glewLazy_glDebugMessageCallbackARB,
+  (_GLEWProc)_glewLazy_glDebugMessageControlARB,
+  (_GLEWProc)_glewLazy_glDebugMessageInsertARB,
+  (_GLEWProc)_glewLazy_glGetDebugMessageLogARB,
+
+  (_GLEWProc)_glewLazy_glBindTextureUnit,
+  (_GLEWProc)_glewLazy_glBlitNamedFramebuffer,
+  (_GLEWProc)_glewLazy_glCheckNamedFramebufferStatus,
+  (_GLEWProc)_glewLazy_glClearNamedBufferData,
+  (_GLEWProc)_glewLazy_glClearNamedBufferSubData,
+  (_GLEWProc)_glewLazy_glClearNamedFramebufferfi,
+  (_GLEWProc)_glewLazy_glClearNamedFramebufferfv,
+  (_GLEWProc)_glewLazy_glClearNamedFramebufferiv,
+  (_GLEWProc)_glewLazy_glClearNamedFramebufferuiv,
+  (_GLEWProc)_glewLazy_glCompressedTextureSubImage1D,
+  (_GLEWProc)_glewLazy_glCompressedTextureSubImage2D,
+  (_GLEWProc)_glewLazy_glCompressedTextureSubImage3D,
+  (_GLEWProc)_glewLazy_glCopyNamedBufferSubData,
+  (_GLEWProc)_glewLazy_glCopyTextureSubImage1D,
+  (_GLEWProc)_glewLazy_glCopyTextureSubImage2D,
+  (_GLEWProc)_glewLazy_glCopyTextureSubImage3D,
+  (_GLEWProc)_glewLazy_glCreateBuffers,
+  (_GLEWProc)_glewLazy_glCreateFramebuffers,
+  (_GLEWProc)_glewLazy_glCreateProgramPipelines,
+  (_GLEWProc)_glewLazy_glCreateQueries,
+  (_GLEWProc)_glewLazy_glCreateRenderbuffers,
+  (_GLEWProc)_glewLazy_glCreateSamplers,
+  (_GLEWProc)_glewLazy_glCreateTextures,
+  (_GLEWProc)_glewLazy_glCreateTransformFeedbacks,
+  (_GLEWProc)_glewLazy_glCreateVertexArrays,
+  (_GLEWProc)_glewLazy_glDisableVertexArrayAttrib,
+  (_GLEWProc)_glewLazy_glEnableVertexArrayAttrib,
+  (_GLEWProc)_glewLazy_glFlushMappedNamedBufferRange,
+  (_GLEWProc)_glewLazy_glGenerateTextureMipmap,
+  (_GLEWProc)_glewLazy_glGetCompressedTextureImage,
+  (_GLEWProc)_glewLazy_glGetNamedBufferParameteri64v,
+  (_GLEWProc)_glewLazy_glGetNamedBufferParameteriv,
+  (_GLEWProc)_glewLazy_glGetNamedBufferPointerv,
+  (_GLEWProc)_glewLazy_glGetNamedBufferSubData,
+  (_GLEWProc)_glewLazy_glGetNamedFramebufferAttachmentParameteriv,
+  (_GLEWProc)_glewLazy_glGetNamedFramebufferParameteriv,
+  (_GLEWProc)_glewLazy_glGetNamedRenderbufferParameteriv,
+  (_GLEWProc)_glewLazy_glGetQueryBufferObjecti64v,
+  (_GLEWProc)_glewLazy_glGetQueryBufferObjectiv,
+  (_GLEWProc)_glewLazy_glGetQueryBufferObjectui64v,
+  (_GLEWProc)_glewLazy_glGetQueryBufferObjectuiv,
+  (_GLEWProc)_glewLazy_glGetTextureImage,
+  (_GLEWProc)_glewLazy_glGetTextureLevelParameterfv,
+  (_GLEWProc)_glewLazy_glGetTextureLevelParameteriv,
+  (_GLEWProc)_glewLazy_glGetTextureParameterIiv,
+  (_GLEWProc)_glewLazy_glGetTextureParameterIuiv,
+  (_GLEWProc)_glewLazy_glGetTextureParameterfv,
+  (_GLEWProc)_glewLazy_glGetTextureParameteriv,
+  (_GLEWProc)_glewLazy_glGetTransformFeedbacki64_v,
+  (_GLEWProc)_glewLazy_glGetTransformFeedbacki_v,
+  (_GLEWProc)_glewLazy_glGetTransformFeedbackiv,
+  (_GLEWProc)_glewLazy_glGetVertexArrayIndexed64iv,
+  (_GLEWProc)_glewLazy_glGetVertexArrayIndexediv,
+  (_GLEWProc)_glewLazy_glGetVertexArrayiv,
+  (_GLEWProc)_glewLazy_glInvalidateNamedFramebufferData,
+  (_GLEWProc)_glewLazy_glInvalidateNamedFramebufferSubData,
+  (_GLEWProc)_glewLazy_glMapNamedBuffer,
+  (_GLEWProc)_glewLazy_glMapNamedBufferRange,
+  (_GLEWProc)_glewLazy_glNamedBufferData,
+  (_GLEWProc)_glewLazy_glNamedBufferStorage,
+  (_GLEWProc)_glewLazy_glNamedBufferSubData,
+  (_GLEWProc)_glewLazy_glNamedFramebufferDrawBuffer,
+  (_GLEWProc)_glewLazy_glNamedFramebufferDrawBuffers,
+  (_GLEWProc)_glewLazy_glNamedFramebufferParameteri,
+  (_GLEWProc)_glewLazy_glNamedFramebufferReadBuffer,
+  (_GLEWProc)_glewLazy_glNamedFramebufferRenderbuffer,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTexture,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTextureLayer,
+  (_GLEWProc)_glewLazy_glNamedRenderbufferStorage,
+  (_GLEWProc)_glewLazy_glNamedRenderbufferStorageMultisample,
+  (_GLEWProc)_glewLazy_glTextureBuffer,
+  (_GLEWProc)_glewLazy_glTextureBufferRange,
+  (_GLEWProc)_glewLazy_glTextureParameterIiv,
+  (_GLEWProc)_glewLazy_glTextureParameterIuiv,
+  (_GLEWProc)_glewLazy_glTextureParameterf,
+  (_GLEWProc)_glewLazy_glTextureParameterfv,
+  (_GLEWProc)_glewLazy_glTextureParameteri,
+  (_GLEWProc)_glewLazy_glTextureParameteriv,
+  (_GLEWProc)_glewLazy_glTextureStorage1D,
+  (_GLEWProc)_glewLazy_glTextureStorage2D,
+  (_GLEWProc)_glewLazy_glTextureStorage2DMultisample,
+  (_GLEWProc)_glewLazy_glTextureStorage3D,
+  (_GLEWProc)_glewLazy_glTextureStorage3DMultisample,
+  (_GLEWProc)_glewLazy_glTextureSubImage1D,
+  (_GLEWProc)_glewLazy_glTextureSubImage2D,
+  (_GLEWProc)_glewLazy_glTextureSubImage3D,
+  (_GLEWProc)_glewLazy_glTransformFeedbackBufferBase,
+  (_GLEWProc)_glewLazy_glTransformFeedbackBufferRange,
+  (_GLEWProc)_glewLazy_glUnmapNamedBuffer,
+  (_GLEWProc)_glewLazy_glVertexArrayAttribBinding,
+  (_GLEWProc)_glewLazy_glVertexArrayAttribFormat,
+  (_GLEWProc)_glewLazy_glVertexArrayAttribIFormat,
+  (_GLEWProc)_glewLazy_glVertexArrayAttribLFormat,
+  (_GLEWProc)_glewLazy_glVertexArrayBindingDivisor,
+  (_GLEWProc)_glewLazy_glVertexArrayElementBuffer,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexBuffer,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexBuffers,
+
+  (_GLEWProc)_glewLazy_glDrawBuffersARB,
+
+  (_GLEWProc)_glewLazy_glBlendEquationSeparateiARB,
+  (_GLEWProc)_glewLazy_glBlendEquationiARB,
+  (_GLEWProc)_glewLazy_glBlendFuncSeparateiARB,
+  (_GLEWProc)_glewLazy_glBlendFunciARB,
+
+  (_GLEWProc)_glewLazy_glDrawElementsBaseVertex,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedBaseVertex,
+  (_GLEWProc)_glewLazy_glDrawRangeElementsBaseVertex,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsBaseVertex,
+
+  (_GLEWProc)_glewLazy_glDrawArraysIndirect,
+  (_GLEWProc)_glewLazy_glDrawElementsIndirect,
+
+  (_GLEWProc)_glewLazy_glFramebufferParameteri,
+  (_GLEWProc)_glewLazy_glGetFramebufferParameteriv,
+  (_GLEWProc)_glewLazy_glGetNamedFramebufferParameterivEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferParameteriEXT,
+
+  (_GLEWProc)_glewLazy_glBindFramebuffer,
+  (_GLEWProc)_glewLazy_glBindRenderbuffer,
+  (_GLEWProc)_glewLazy_glBlitFramebuffer,
+  (_GLEWProc)_glewLazy_glCheckFramebufferStatus,
+  (_GLEWProc)_glewLazy_glDeleteFramebuffers,
+  (_GLEWProc)_glewLazy_glDeleteRenderbuffers,
+  (_GLEWProc)_glewLazy_glFramebufferRenderbuffer,
+  (_GLEWProc)_glewLazy_glFramebufferTexture1D,
+  (_GLEWProc)_glewLazy_glFramebufferTexture2D,
+  (_GLEWProc)_glewLazy_glFramebufferTexture3D,
+  (_GLEWProc)_glewLazy_glFramebufferTextureLayer,
+  (_GLEWProc)_glewLazy_glGenFramebuffers,
+  (_GLEWProc)_glewLazy_glGenRenderbuffers,
+  (_GLEWProc)_glewLazy_glGenerateMipmap,
+  (_GLEWProc)_glewLazy_glGetFramebufferAttachmentParameteriv,
+  (_GLEWProc)_glewLazy_glGetRenderbufferParameteriv,
+  (_GLEWProc)_glewLazy_glIsFramebuffer,
+  (_GLEWProc)_glewLazy_glIsRenderbuffer,
+  (_GLEWProc)_glewLazy_glRenderbufferStorage,
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisample,
+
+  (_GLEWProc)_glewLazy_glFramebufferTextureARB,
+  (_GLEWProc)_glewLazy_glFramebufferTextureFaceARB,
+  (_GLEWProc)_glewLazy_glFramebufferTextureLayerARB,
+  (_GLEWProc)_glewLazy_glProgramParameteriARB,
+
+  (_GLEWProc)_glewLazy_glGetProgramBinary,
+  (_GLEWProc)_glewLazy_glProgramBinary,
+  (_GLEWProc)_glewLazy_glProgramParameteri,
+
+  (_GLEWProc)_glewLazy_glGetCompressedTextureSubImage,
+  (_GLEWProc)_glewLazy_glGetTextureSubImage,
+
+  (_GLEWProc)_glewLazy_glSpecializeShaderARB,
+
+  (_GLEWProc)_glewLazy_glGetUniformdv,
+  (_GLEWProc)_glewLazy_glUniform1d,
+  (_GLEWProc)_glewLazy_glUniform1dv,
+  (_GLEWProc)_glewLazy_glUniform2d,
+  (_GLEWProc)_glewLazy_glUniform2dv,
+  (_GLEWProc)_glewLazy_glUniform3d,
+  (_GLEWProc)_glewLazy_glUniform3dv,
+  (_GLEWProc)_glewLazy_glUniform4d,
+  (_GLEWProc)_glewLazy_glUniform4dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix2dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix2x3dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix2x4dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix3dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix3x2dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix3x4dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix4dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix4x2dv,
+  (_GLEWProc)_glewLazy_glUniformMatrix4x3dv,
+
+  (_GLEWProc)_glewLazy_glGetUniformi64vARB,
+  (_GLEWProc)_glewLazy_glGetUniformui64vARB,
+  (_GLEWProc)_glewLazy_glGetnUniformi64vARB,
+  (_GLEWProc)_glewLazy_glGetnUniformui64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform1i64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform1i64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform1ui64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform1ui64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform2i64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform2i64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform2ui64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform2ui64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform3i64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform3i64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform3ui64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform3ui64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform4i64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform4i64vARB,
+  (_GLEWProc)_glewLazy_glProgramUniform4ui64ARB,
+  (_GLEWProc)_glewLazy_glProgramUniform4ui64vARB,
+  (_GLEWProc)_glewLazy_glUniform1i64ARB,
+  (_GLEWProc)_glewLazy_glUniform1i64vARB,
+  (_GLEWProc)_glewLazy_glUniform1ui64ARB,
+  (_GLEWProc)_glewLazy_glUniform1ui64vARB,
+  (_GLEWProc)_glewLazy_glUniform2i64ARB,
+  (_GLEWProc)_glewLazy_glUniform2i64vARB,
+  (_GLEWProc)_glewLazy_glUniform2ui64ARB,
+  (_GLEWProc)_glewLazy_glUniform2ui64vARB,
+  (_GLEWProc)_glewLazy_glUniform3i64ARB,
+  (_GLEWProc)_glewLazy_glUniform3i64vARB,
+  (_GLEWProc)_glewLazy_glUniform3ui64ARB,
+  (_GLEWProc)_glewLazy_glUniform3ui64vARB,
+  (_GLEWProc)_glewLazy_glUniform4i64ARB,
+  (_GLEWProc)_glewLazy_glUniform4i64vARB,
+  (_GLEWProc)_glewLazy_glUniform4ui64ARB,
+  (_GLEWProc)_glewLazy_glUniform4ui64vARB,
+
+  (_GLEWProc)_glewLazy_glColorSubTable,
+  (_GLEWProc)_glewLazy_glColorTable,
+  (_GLEWProc)_glewLazy_glColorTableParameterfv,
+  (_GLEWProc)_glewLazy_glColorTableParameteriv,
+  (_GLEWProc)_glewLazy_glConvolutionFilter1D,
+  (_GLEWProc)_glewLazy_glConvolutionFilter2D,
+  (_GLEWProc)_glewLazy_glConvolutionParameterf,
+  (_GLEWProc)_glewLazy_glConvolutionParameterfv,
+  (_GLEWProc)_glewLazy_glConvolutionParameteri,
+  (_GLEWProc)_glewLazy_glConvolutionParameteriv,
+  (_GLEWProc)_glewLazy_glCopyColorSubTable,
+  (_GLEWProc)_glewLazy_glCopyColorTable,
+  (_GLEWProc)_glewLazy_glCopyConvolutionFilter1D,
+  (_GLEWProc)_glewLazy_glCopyConvolutionFilter2D,
+  (_GLEWProc)_glewLazy_glGetColorTable,
+  (_GLEWProc)_glewLazy_glGetColorTableParameterfv,
+  (_GLEWProc)_glewLazy_glGetColorTableParameteriv,
+  (_GLEWProc)_glewLazy_glGetConvolutionFilter,
+  (_GLEWProc)_glewLazy_glGetConvolutionParameterfv,
+  (_GLEWProc)_glewLazy_glGetConvolutionParameteriv,
+  (_GLEWProc)_glewLazy_glGetHistogram,
+  (_GLEWProc)_glewLazy_glGetHistogramParameterfv,
+  (_GLEWProc)_glewLazy_glGetHistogramParameteriv,
+  (_GLEWProc)_glewLazy_glGetMinmax,
+  (_GLEWProc)_glewLazy_glGetMinmaxParameterfv,
+  (_GLEWProc)_glewLazy_glGetMinmaxParameteriv,
+  (_GLEWProc)_glewLazy_glGetSeparableFilter,
+  (_GLEWProc)_glewLazy_glHistogram,
+  (_GLEWProc)_glewLazy_glMinmax,
+  (_GLEWProc)_glewLazy_glResetHistogram,
+  (_GLEWProc)_glewLazy_glResetMinmax,
+  (_GLEWProc)_glewLazy_glSeparableFilter2D,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirectCountARB,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirectCountARB,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstancedARB,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedARB,
+  (_GLEWProc)_glewLazy_glVertexAttribDivisorARB,
+
+  (_GLEWProc)_glewLazy_glGetInternalformativ,
+
+  (_GLEWProc)_glewLazy_glGetInternalformati64v,
+
+  (_GLEWProc)_glewLazy_glInvalidateBufferData,
+  (_GLEWProc)_glewLazy_glInvalidateBufferSubData,
+  (_GLEWProc)_glewLazy_glInvalidateFramebuffer,
+  (_GLEWProc)_glewLazy_glInvalidateSubFramebuffer,
+  (_GLEWProc)_glewLazy_glInvalidateTexImage,
+  (_GLEWProc)_glewLazy_glInvalidateTexSubImage,
+
+  (_GLEWProc)_glewLazy_glFlushMappedBufferRange,
+  (_GLEWProc)_glewLazy_glMapBufferRange,
+
+  (_GLEWProc)_glewLazy_glCurrentPaletteMatrixARB,
+  (_GLEWProc)_glewLazy_glMatrixIndexPointerARB,
+  (_GLEWProc)_glewLazy_glMatrixIndexubvARB,
+  (_GLEWProc)_glewLazy_glMatrixIndexuivARB,
+  (_GLEWProc)_glewLazy_glMatrixIndexusvARB,
+
+  (_GLEWProc)_glewLazy_glBindBuffersBase,
+  (_GLEWProc)_glewLazy_glBindBuffersRange,
+  (_GLEWProc)_glewLazy_glBindImageTextures,
+  (_GLEWProc)_glewLazy_glBindSamplers,
+  (_GLEWProc)_glewLazy_glBindTextures,
+  (_GLEWProc)_glewLazy_glBindVertexBuffers,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirect,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirect,
+
+  (_GLEWProc)_glewLazy_glSampleCoverageARB,
+
+  (_GLEWProc)_glewLazy_glActiveTextureARB,
+  (_GLEWProc)_glewLazy_glClientActiveTextureARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1dARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1dvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1fARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1fvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1iARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1ivARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1sARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1svARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2dARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2dvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2fARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2fvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2iARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2ivARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2sARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2svARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3dARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3dvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3fARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3fvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3iARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3ivARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3sARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3svARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4dARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4dvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4fARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4fvARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4iARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4ivARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4sARB,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4svARB,
+
+  (_GLEWProc)_glewLazy_glBeginQueryARB,
+  (_GLEWProc)_glewLazy_glDeleteQueriesARB,
+  (_GLEWProc)_glewLazy_glEndQueryARB,
+  (_GLEWProc)_glewLazy_glGenQueriesARB,
+  (_GLEWProc)_glewLazy_glGetQueryObjectivARB,
+  (_GLEWProc)_glewLazy_glGetQueryObjectuivARB,
+  (_GLEWProc)_glewLazy_glGetQueryivARB,
+  (_GLEWProc)_glewLazy_glIsQueryARB,
+
+  (_GLEWProc)_glewLazy_glMaxShaderCompilerThreadsARB,
+
+  (_GLEWProc)_glewLazy_glPointParameterfARB,
+  (_GLEWProc)_glewLazy_glPointParameterfvARB,
+
+  (_GLEWProc)_glewLazy_glPolygonOffsetClamp,
+
+  (_GLEWProc)_glewLazy_glGetProgramInterfaceiv,
+  (_GLEWProc)_glewLazy_glGetProgramResourceIndex,
+  (_GLEWProc)_glewLazy_glGetProgramResourceLocation,
+  (_GLEWProc)_glewLazy_glGetProgramResourceLocationIndex,
+  (_GLEWProc)_glewLazy_glGetProgramResourceName,
+  (_GLEWProc)_glewLazy_glGetProgramResourceiv,
+
+  (_GLEWProc)_glewLazy_glProvokingVertex,
+
+  (_GLEWProc)_glewLazy_glGetGraphicsResetStatusARB,
+  (_GLEWProc)_glewLazy_glGetnColorTableARB,
+  (_GLEWProc)_glewLazy_glGetnCompressedTexImageARB,
+  (_GLEWProc)_glewLazy_glGetnConvolutionFilterARB,
+  (_GLEWProc)_glewLazy_glGetnHistogramARB,
+  (_GLEWProc)_glewLazy_glGetnMapdvARB,
+  (_GLEWProc)_glewLazy_glGetnMapfvARB,
+  (_GLEWProc)_glewLazy_glGetnMapivARB,
+  (_GLEWProc)_glewLazy_glGetnMinmaxARB,
+  (_GLEWProc)_glewLazy_glGetnPixelMapfvARB,
+  (_GLEWProc)_glewLazy_glGetnPixelMapuivARB,
+  (_GLEWProc)_glewLazy_glGetnPixelMapusvARB,
+  (_GLEWProc)_glewLazy_glGetnPolygonStippleARB,
+  (_GLEWProc)_glewLazy_glGetnSeparableFilterARB,
+  (_GLEWProc)_glewLazy_glGetnTexImageARB,
+  (_GLEWProc)_glewLazy_glGetnUniformdvARB,
+  (_GLEWProc)_glewLazy_glGetnUniformfvARB,
+  (_GLEWProc)_glewLazy_glGetnUniformivARB,
+  (_GLEWProc)_glewLazy_glGetnUniformuivARB,
+  (_GLEWProc)_glewLazy_glReadnPixelsARB,
+
+  (_GLEWProc)_glewLazy_glFramebufferSampleLocationsfvARB,
+  (_GLEWProc)_glewLazy_glNamedFramebufferSampleLocationsfvARB,
+
+  (_GLEWProc)_glewLazy_glMinSampleShadingARB,
+
+  (_GLEWProc)_glewLazy_glBindSampler,
+  (_GLEWProc)_glewLazy_glDeleteSamplers,
+  (_GLEWProc)_glewLazy_glGenSamplers,
+  (_GLEWProc)_glewLazy_glGetSamplerParameterIiv,
+  (_GLEWProc)_glewLazy_glGetSamplerParameterIuiv,
+  (_GLEWProc)_glewLazy_glGetSamplerParameterfv,
+  (_GLEWProc)_glewLazy_glGetSamplerParameteriv,
+  (_GLEWProc)_glewLazy_glIsSampler,
+  (_GLEWProc)_glewLazy_glSamplerParameterIiv,
+  (_GLEWProc)_glewLazy_glSamplerParameterIuiv,
+  (_GLEWProc)_glewLazy_glSamplerParameterf,
+  (_GLEWProc)_glewLazy_glSamplerParameterfv,
+  (_GLEWProc)_glewLazy_glSamplerParameteri,
+  (_GLEWProc)_glewLazy_glSamplerParameteriv,
+
+  (_GLEWProc)_glewLazy_glActiveShaderProgram,
+  (_GLEWProc)_glewLazy_glBindProgramPipeline,
+  (_GLEWProc)_glewLazy_glCreateShaderProgramv,
+  (_GLEWProc)_glewLazy_glDeleteProgramPipelines,
+  (_GLEWProc)_glewLazy_glGenProgramPipelines,
+  (_GLEWProc)_glewLazy_glGetProgramPipelineInfoLog,
+  (_GLEWProc)_glewLazy_glGetProgramPipelineiv,
+  (_GLEWProc)_glewLazy_glIsProgramPipeline,
+  (_GLEWProc)_glewLazy_glProgramUniform1d,
+  (_GLEWProc)_glewLazy_glProgramUniform1dv,
+  (_GLEWProc)_glewLazy_glProgramUniform1f,
+  (_GLEWProc)_glewLazy_glProgramUniform1fv,
+  (_GLEWProc)_glewLazy_glProgramUniform1i,
+  (_GLEWProc)_glewLazy_glProgramUniform1iv,
+  (_GLEWProc)_glewLazy_glProgramUniform1ui,
+  (_GLEWProc)_glewLazy_glProgramUniform1uiv,
+  (_GLEWProc)_glewLazy_glProgramUniform2d,
+  (_GLEWProc)_glewLazy_glProgramUniform2dv,
+  (_GLEWProc)_glewLazy_glProgramUniform2f,
+  (_GLEWProc)_glewLazy_glProgramUniform2fv,
+  (_GLEWProc)_glewLazy_glProgramUniform2i,
+  (_GLEWProc)_glewLazy_glProgramUniform2iv,
+  (_GLEWProc)_glewLazy_glProgramUniform2ui,
+  (_GLEWProc)_glewLazy_glProgramUniform2uiv,
+  (_GLEWProc)_glewLazy_glProgramUniform3d,
+  (_GLEWProc)_glewLazy_glProgramUniform3dv,
+  (_GLEWProc)_glewLazy_glProgramUniform3f,
+  (_GLEWProc)_glewLazy_glProgramUniform3fv,
+  (_GLEWProc)_glewLazy_glProgramUniform3i,
+  (_GLEWProc)_glewLazy_glProgramUniform3iv,
+  (_GLEWProc)_glewLazy_glProgramUniform3ui,
+  (_GLEWProc)_glewLazy_glProgramUniform3uiv,
+  (_GLEWProc)_glewLazy_glProgramUniform4d,
+  (_GLEWProc)_glewLazy_glProgramUniform4dv,
+  (_GLEWProc)_glewLazy_glProgramUniform4f,
+  (_GLEWProc)_glewLazy_glProgramUniform4fv,
+  (_GLEWProc)_glewLazy_glProgramUniform4i,
+  (_GLEWProc)_glewLazy_glProgramUniform4iv,
+  (_GLEWProc)_glewLazy_glProgramUniform4ui,
+  (_GLEWProc)_glewLazy_glProgramUniform4uiv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2x3dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2x3fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2x4dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2x4fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3x2dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3x2fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3x4dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3x4fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4x2dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4x2fv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4x3dv,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4x3fv,
+  (_GLEWProc)_glewLazy_glUseProgramStages,
+  (_GLEWProc)_glewLazy_glValidateProgramPipeline,
+
+  (_GLEWProc)_glewLazy_glGetActiveAtomicCounterBufferiv,
+
+  (_GLEWProc)_glewLazy_glBindImageTexture,
+  (_GLEWProc)_glewLazy_glMemoryBarrier,
+
+  (_GLEWProc)_glewLazy_glAttachObjectARB,
+  (_GLEWProc)_glewLazy_glCompileShaderARB,
+  (_GLEWProc)_glewLazy_glCreateProgramObjectARB,
+  (_GLEWProc)_glewLazy_glCreateShaderObjectARB,
+  (_GLEWProc)_glewLazy_glDeleteObjectARB,
+  (_GLEWProc)_glewLazy_glDetachObjectARB,
+  (_GLEWProc)_glewLazy_glGetActiveUniformARB,
+  (_GLEWProc)_glewLazy_glGetAttachedObjectsARB,
+  (_GLEWProc)_glewLazy_glGetHandleARB,
+  (_GLEWProc)_glewLazy_glGetInfoLogARB,
+  (_GLEWProc)_glewLazy_glGetObjectParameterfvARB,
+  (_GLEWProc)_glewLazy_glGetObjectParameterivARB,
+  (_GLEWProc)_glewLazy_glGetShaderSourceARB,
+  (_GLEWProc)_glewLazy_glGetUniformLocationARB,
+  (_GLEWProc)_glewLazy_glGetUniformfvARB,
+  (_GLEWProc)_glewLazy_glGetUniformivARB,
+  (_GLEWProc)_glewLazy_glLinkProgramARB,
+  (_GLEWProc)_glewLazy_glShaderSourceARB,
+  (_GLEWProc)_glewLazy_glUniform1fARB,
+  (_GLEWProc)_glewLazy_glUniform1fvARB,
+  (_GLEWProc)_glewLazy_glUniform1iARB,
+  (_GLEWProc)_glewLazy_glUniform1ivARB,
+  (_GLEWProc)_glewLazy_glUniform2fARB,
+  (_GLEWProc)_glewLazy_glUniform2fvARB,
+  (_GLEWProc)_glewLazy_glUniform2iARB,
+  (_GLEWProc)_glewLazy_glUniform2ivARB,
+  (_GLEWProc)_glewLazy_glUniform3fARB,
+  (_GLEWProc)_glewLazy_glUniform3fvARB,
+  (_GLEWProc)_glewLazy_glUniform3iARB,
+  (_GLEWProc)_glewLazy_glUniform3ivARB,
+  (_GLEWProc)_glewLazy_glUniform4fARB,
+  (_GLEWProc)_glewLazy_glUniform4fvARB,
+  (_GLEWProc)_glewLazy_glUniform4iARB,
+  (_GLEWProc)_glewLazy_glUniform4ivARB,
+  (_GLEWProc)_glewLazy_glUniformMatrix2fvARB,
+  (_GLEWProc)_glewLazy_glUniformMatrix3fvARB,
+  (_GLEWProc)_glewLazy_glUniformMatrix4fvARB,
+  (_GLEWProc)_glewLazy_glUseProgramObjectARB,
+  (_GLEWProc)_glewLazy_glValidateProgramARB,
+
+  (_GLEWProc)_glewLazy_glShaderStorageBlockBinding,
+
+  (_GLEWProc)_glewLazy_glGetActiveSubroutineName,
+  (_GLEWProc)_glewLazy_glGetActiveSubroutineUniformName,
+  (_GLEWProc)_glewLazy_glGetActiveSubroutineUniformiv,
+  (_GLEWProc)_glewLazy_glGetProgramStageiv,
+  (_GLEWProc)_glewLazy_glGetSubroutineIndex,
+  (_GLEWProc)_glewLazy_glGetSubroutineUniformLocation,
+  (_GLEWProc)_glewLazy_glGetUniformSubroutineuiv,
+  (_GLEWProc)_glewLazy_glUniformSubroutinesuiv,
+
+  (_GLEWProc)_glewLazy_glCompileShaderIncludeARB,
+  (_GLEWProc)_glewLazy_glDeleteNamedStringARB,
+  (_GLEWProc)_glewLazy_glGetNamedStringARB,
+  (_GLEWProc)_glewLazy_glGetNamedStringivARB,
+  (_GLEWProc)_glewLazy_glIsNamedStringARB,
+  (_GLEWProc)_glewLazy_glNamedStringARB,
+
+  (_GLEWProc)_glewLazy_glBufferPageCommitmentARB,
+
+  (_GLEWProc)_glewLazy_glTexPageCommitmentARB,
+
+  (_GLEWProc)_glewLazy_glClientWaitSync,
+  (_GLEWProc)_glewLazy_glDeleteSync,
+  (_GLEWProc)_glewLazy_glFenceSync,
+  (_GLEWProc)_glewLazy_glGetInteger64v,
+  (_GLEWProc)_glewLazy_glGetSynciv,
+  (_GLEWProc)_glewLazy_glIsSync,
+  (_GLEWProc)_glewLazy_glWaitSync,
+
+  (_GLEWProc)_glewLazy_glPatchParameterfv,
+  (_GLEWProc)_glewLazy_glPatchParameteri,
+
+  (_GLEWProc)_glewLazy_glTextureBarrier,
+
+  (_GLEWProc)_glewLazy_glTexBufferARB,
+
+  (_GLEWProc)_glewLazy_glTexBufferRange,
+  (_GLEWProc)_glewLazy_glTextureBufferRangeEXT,
+
+  (_GLEWProc)_glewLazy_glCompressedTexImage1DARB,
+  (_GLEWProc)_glewLazy_glCompressedTexImage2DARB,
+  (_GLEWProc)_glewLazy_glCompressedTexImage3DARB,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage1DARB,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage2DARB,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage3DARB,
+  (_GLEWProc)_glewLazy_glGetCompressedTexImageARB,
+
+  (_GLEWProc)_glewLazy_glGetMultisamplefv,
+  (_GLEWProc)_glewLazy_glSampleMaski,
+  (_GLEWProc)_glewLazy_glTexImage2DMultisample,
+  (_GLEWProc)_glewLazy_glTexImage3DMultisample,
+
+  (_GLEWProc)_glewLazy_glTexStorage1D,
+  (_GLEWProc)_glewLazy_glTexStorage2D,
+  (_GLEWProc)_glewLazy_glTexStorage3D,
+
+  (_GLEWProc)_glewLazy_glTexStorage2DMultisample,
+  (_GLEWProc)_glewLazy_glTexStorage3DMultisample,
+  (_GLEWProc)_glewLazy_glTextureStorage2DMultisampleEXT,
+  (_GLEWProc)_glewLazy_glTextureStorage3DMultisampleEXT,
+
+  (_GLEWProc)_glewLazy_glTextureView,
+
+  (_GLEWProc)_glewLazy_glGetQueryObjecti64v,
+  (_GLEWProc)_glewLazy_glGetQueryObjectui64v,
+  (_GLEWProc)_glewLazy_glQueryCounter,
+
+  (_GLEWProc)_glewLazy_glBindTransformFeedback,
+  (_GLEWProc)_glewLazy_glDeleteTransformFeedbacks,
+  (_GLEWProc)_glewLazy_glDrawTransformFeedback,
+  (_GLEWProc)_glewLazy_glGenTransformFeedbacks,
+  (_GLEWProc)_glewLazy_glIsTransformFeedback,
+  (_GLEWProc)_glewLazy_glPauseTransformFeedback,
+  (_GLEWProc)_glewLazy_glResumeTransformFeedback,
+
+  (_GLEWProc)_glewLazy_glBeginQueryIndexed,
+  (_GLEWProc)_glewLazy_glDrawTransformFeedbackStream,
+  (_GLEWProc)_glewLazy_glEndQueryIndexed,
+  (_GLEWProc)_glewLazy_glGetQueryIndexediv,
+
+  (_GLEWProc)_glewLazy_glDrawTransformFeedbackInstanced,
+  (_GLEWProc)_glewLazy_glDrawTransformFeedbackStreamInstanced,
+
+  (_GLEWProc)_glewLazy_glLoadTransposeMatrixdARB,
+  (_GLEWProc)_glewLazy_glLoadTransposeMatrixfARB,
+  (_GLEWProc)_glewLazy_glMultTransposeMatrixdARB,
+  (_GLEWProc)_glewLazy_glMultTransposeMatrixfARB,
+
+  (_GLEWProc)_glewLazy_glBindBufferBase,
+  (_GLEWProc)_glewLazy_glBindBufferRange,
+  (_GLEWProc)_glewLazy_glGetActiveUniformBlockName,
+  (_GLEWProc)_glewLazy_glGetActiveUniformBlockiv,
+  (_GLEWProc)_glewLazy_glGetActiveUniformName,
+  (_GLEWProc)_glewLazy_glGetActiveUniformsiv,
+  (_GLEWProc)_glewLazy_glGetIntegeri_v,
+  (_GLEWProc)_glewLazy_glGetUniformBlockIndex,
+  (_GLEWProc)_glewLazy_glGetUniformIndices,
+  (_GLEWProc)_glewLazy_glUniformBlockBinding,
+
+  (_GLEWProc)_glewLazy_glBindVertexArray,
+  (_GLEWProc)_glewLazy_glDeleteVertexArrays,
+  (_GLEWProc)_glewLazy_glGenVertexArrays,
+  (_GLEWProc)_glewLazy_glIsVertexArray,
+
+  (_GLEWProc)_glewLazy_glGetVertexAttribLdv,
+  (_GLEWProc)_glewLazy_glVertexAttribL1d,
+  (_GLEWProc)_glewLazy_glVertexAttribL1dv,
+  (_GLEWProc)_glewLazy_glVertexAttribL2d,
+  (_GLEWProc)_glewLazy_glVertexAttribL2dv,
+  (_GLEWProc)_glewLazy_glVertexAttribL3d,
+  (_GLEWProc)_glewLazy_glVertexAttribL3dv,
+  (_GLEWProc)_glewLazy_glVertexAttribL4d,
+  (_GLEWProc)_glewLazy_glVertexAttribL4dv,
+  (_GLEWProc)_glewLazy_glVertexAttribLPointer,
+
+  (_GLEWProc)_glewLazy_glBindVertexBuffer,
+  (_GLEWProc)_glewLazy_glVertexArrayBindVertexBufferEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribBindingEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribFormatEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribIFormatEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribLFormatEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexBindingDivisorEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribBinding,
+  (_GLEWProc)_glewLazy_glVertexAttribFormat,
+  (_GLEWProc)_glewLazy_glVertexAttribIFormat,
+  (_GLEWProc)_glewLazy_glVertexAttribLFormat,
+  (_GLEWProc)_glewLazy_glVertexBindingDivisor,
+
+  (_GLEWProc)_glewLazy_glVertexBlendARB,
+  (_GLEWProc)_glewLazy_glWeightPointerARB,
+  (_GLEWProc)_glewLazy_glWeightbvARB,
+  (_GLEWProc)_glewLazy_glWeightdvARB,
+  (_GLEWProc)_glewLazy_glWeightfvARB,
+  (_GLEWProc)_glewLazy_glWeightivARB,
+  (_GLEWProc)_glewLazy_glWeightsvARB,
+  (_GLEWProc)_glewLazy_glWeightubvARB,
+  (_GLEWProc)_glewLazy_glWeightuivARB,
+  (_GLEWProc)_glewLazy_glWeightusvARB,
+
+  (_GLEWProc)_glewLazy_glBindBufferARB,
+  (_GLEWProc)_glewLazy_glBufferDataARB,
+  (_GLEWProc)_glewLazy_glBufferSubDataARB,
+  (_GLEWProc)_glewLazy_glDeleteBuffersARB,
+  (_GLEWProc)_glewLazy_glGenBuffersARB,
+  (_GLEWProc)_glewLazy_glGetBufferParameterivARB,
+  (_GLEWProc)_glewLazy_glGetBufferPointervARB,
+  (_GLEWProc)_glewLazy_glGetBufferSubDataARB,
+  (_GLEWProc)_glewLazy_glIsBufferARB,
+  (_GLEWProc)_glewLazy_glMapBufferARB,
+  (_GLEWProc)_glewLazy_glUnmapBufferARB,
+
+  (_GLEWProc)_glewLazy_glBindProgramARB,
+  (_GLEWProc)_glewLazy_glDeleteProgramsARB,
+  (_GLEWProc)_glewLazy_glDisableVertexAttribArrayARB,
+  (_GLEWProc)_glewLazy_glEnableVertexAttribArrayARB,
+  (_GLEWProc)_glewLazy_glGenProgramsARB,
+  (_GLEWProc)_glewLazy_glGetProgramEnvParameterdvARB,
+  (_GLEWProc)_glewLazy_glGetProgramEnvParameterfvARB,
+  (_GLEWProc)_glewLazy_glGetProgramLocalParameterdvARB,
+  (_GLEWProc)_glewLazy_glGetProgramLocalParameterfvARB,
+  (_GLEWProc)_glewLazy_glGetProgramStringARB,
+  (_GLEWProc)_glewLazy_glGetProgramivARB,
+  (_GLEWProc)_glewLazy_glGetVertexAttribPointervARB,
+  (_GLEWProc)_glewLazy_glGetVertexAttribdvARB,
+  (_GLEWProc)_glewLazy_glGetVertexAttribfvARB,
+  (_GLEWProc)_glewLazy_glGetVertexAttribivARB,
+  (_GLEWProc)_glewLazy_glIsProgramARB,
+  (_GLEWProc)_glewLazy_glProgramEnvParameter4dARB,
+  (_GLEWProc)_glewLazy_glProgramEnvParameter4dvARB,
+  (_GLEWProc)_glewLazy_glProgramEnvParameter4fARB,
+  (_GLEWProc)_glewLazy_glProgramEnvParameter4fvARB,
+  (_GLEWProc)_glewLazy_glProgramLocalParameter4dARB,
+  (_GLEWProc)_glewLazy_glProgramLocalParameter4dvARB,
+  (_GLEWProc)_glewLazy_glProgramLocalParameter4fARB,
+  (_GLEWProc)_glewLazy_glProgramLocalParameter4fvARB,
+  (_GLEWProc)_glewLazy_glProgramStringARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib1dARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib1dvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib1fARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib1fvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib1sARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib1svARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib2dARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib2dvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib2fARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib2fvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib2sARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib2svARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib3dARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib3dvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib3fARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib3fvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib3sARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib3svARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NbvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NivARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NsvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NubARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NubvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NuivARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4NusvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4bvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4dARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4dvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4fARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4fvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4ivARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4sARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4svARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4ubvARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4uivARB,
+  (_GLEWProc)_glewLazy_glVertexAttrib4usvARB,
+  (_GLEWProc)_glewLazy_glVertexAttribPointerARB,
+
+  (_GLEWProc)_glewLazy_glBindAttribLocationARB,
+  (_GLEWProc)_glewLazy_glGetActiveAttribARB,
+  (_GLEWProc)_glewLazy_glGetAttribLocationARB,
+
+  (_GLEWProc)_glewLazy_glColorP3ui,
+  (_GLEWProc)_glewLazy_glColorP3uiv,
+  (_GLEWProc)_glewLazy_glColorP4ui,
+  (_GLEWProc)_glewLazy_glColorP4uiv,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP1ui,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP1uiv,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP2ui,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP2uiv,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP3ui,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP3uiv,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP4ui,
+  (_GLEWProc)_glewLazy_glMultiTexCoordP4uiv,
+  (_GLEWProc)_glewLazy_glNormalP3ui,
+  (_GLEWProc)_glewLazy_glNormalP3uiv,
+  (_GLEWProc)_glewLazy_glSecondaryColorP3ui,
+  (_GLEWProc)_glewLazy_glSecondaryColorP3uiv,
+  (_GLEWProc)_glewLazy_glTexCoordP1ui,
+  (_GLEWProc)_glewLazy_glTexCoordP1uiv,
+  (_GLEWProc)_glewLazy_glTexCoordP2ui,
+  (_GLEWProc)_glewLazy_glTexCoordP2uiv,
+  (_GLEWProc)_glewLazy_glTexCoordP3ui,
+  (_GLEWProc)_glewLazy_glTexCoordP3uiv,
+  (_GLEWProc)_glewLazy_glTexCoordP4ui,
+  (_GLEWProc)_glewLazy_glTexCoordP4uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribP1ui,
+  (_GLEWProc)_glewLazy_glVertexAttribP1uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribP2ui,
+  (_GLEWProc)_glewLazy_glVertexAttribP2uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribP3ui,
+  (_GLEWProc)_glewLazy_glVertexAttribP3uiv,
+  (_GLEWProc)_glewLazy_glVertexAttribP4ui,
+  (_GLEWProc)_glewLazy_glVertexAttribP4uiv,
+  (_GLEWProc)_glewLazy_glVertexP2ui,
+  (_GLEWProc)_glewLazy_glVertexP2uiv,
+  (_GLEWProc)_glewLazy_glVertexP3ui,
+  (_GLEWProc)_glewLazy_glVertexP3uiv,
+  (_GLEWProc)_glewLazy_glVertexP4ui,
+  (_GLEWProc)_glewLazy_glVertexP4uiv,
+
+  (_GLEWProc)_glewLazy_glDepthRangeArrayv,
+  (_GLEWProc)_glewLazy_glDepthRangeIndexed,
+  (_GLEWProc)_glewLazy_glGetDoublei_v,
+  (_GLEWProc)_glewLazy_glGetFloati_v,
+  (_GLEWProc)_glewLazy_glScissorArrayv,
+  (_GLEWProc)_glewLazy_glScissorIndexed,
+  (_GLEWProc)_glewLazy_glScissorIndexedv,
+  (_GLEWProc)_glewLazy_glViewportArrayv,
+  (_GLEWProc)_glewLazy_glViewportIndexedf,
+  (_GLEWProc)_glewLazy_glViewportIndexedfv,
+
+  (_GLEWProc)_glewLazy_glWindowPos2dARB,
+  (_GLEWProc)_glewLazy_glWindowPos2dvARB,
+  (_GLEWProc)_glewLazy_glWindowPos2fARB,
+  (_GLEWProc)_glewLazy_glWindowPos2fvARB,
+  (_GLEWProc)_glewLazy_glWindowPos2iARB,
+  (_GLEWProc)_glewLazy_glWindowPos2ivARB,
+  (_GLEWProc)_glewLazy_glWindowPos2sARB,
+  (_GLEWProc)_glewLazy_glWindowPos2svARB,
+  (_GLEWProc)_glewLazy_glWindowPos3dARB,
+  (_GLEWProc)_glewLazy_glWindowPos3dvARB,
+  (_GLEWProc)_glewLazy_glWindowPos3fARB,
+  (_GLEWProc)_glewLazy_glWindowPos3fvARB,
+  (_GLEWProc)_glewLazy_glWindowPos3iARB,
+  (_GLEWProc)_glewLazy_glWindowPos3ivARB,
+  (_GLEWProc)_glewLazy_glWindowPos3sARB,
+  (_GLEWProc)_glewLazy_glWindowPos3svARB,
+
+  (_GLEWProc)_glewLazy_glDrawBuffersATI,
+
+  (_GLEWProc)_glewLazy_glDrawElementArrayATI,
+  (_GLEWProc)_glewLazy_glDrawRangeElementArrayATI,
+  (_GLEWProc)_glewLazy_glElementPointerATI,
+
+  (_GLEWProc)_glewLazy_glGetTexBumpParameterfvATI,
+  (_GLEWProc)_glewLazy_glGetTexBumpParameterivATI,
+  (_GLEWProc)_glewLazy_glTexBumpParameterfvATI,
+  (_GLEWProc)_glewLazy_glTexBumpParameterivATI,
+
+  (_GLEWProc)_glewLazy_glAlphaFragmentOp1ATI,
+  (_GLEWProc)_glewLazy_glAlphaFragmentOp2ATI,
+  (_GLEWProc)_glewLazy_glAlphaFragmentOp3ATI,
+  (_GLEWProc)_glewLazy_glBeginFragmentShaderATI,
+  (_GLEWProc)_glewLazy_glBindFragmentShaderATI,
+  (_GLEWProc)_glewLazy_glColorFragmentOp1ATI,
+  (_GLEWProc)_glewLazy_glColorFragmentOp2ATI,
+  (_GLEWProc)_glewLazy_glColorFragmentOp3ATI,
+  (_GLEWProc)_glewLazy_glDeleteFragmentShaderATI,
+  (_GLEWProc)_glewLazy_glEndFragmentShaderATI,
+  (_GLEWProc)_glewLazy_glGenFragmentShadersATI,
+  (_GLEWProc)_glewLazy_glPassTexCoordATI,
+  (_GLEWProc)_glewLazy_glSampleMapATI,
+  (_GLEWProc)_glewLazy_glSetFragmentShaderConstantATI,
+
+  (_GLEWProc)_glewLazy_glMapObjectBufferATI,
+  (_GLEWProc)_glewLazy_glUnmapObjectBufferATI,
+
+  (_GLEWProc)_glewLazy_glPNTrianglesfATI,
+  (_GLEWProc)_glewLazy_glPNTrianglesiATI,
+
+  (_GLEWProc)_glewLazy_glStencilFuncSeparateATI,
+  (_GLEWProc)_glewLazy_glStencilOpSeparateATI,
+
+  (_GLEWProc)_glewLazy_glArrayObjectATI,
+  (_GLEWProc)_glewLazy_glFreeObjectBufferATI,
+  (_GLEWProc)_glewLazy_glGetArrayObjectfvATI,
+  (_GLEWProc)_glewLazy_glGetArrayObjectivATI,
+  (_GLEWProc)_glewLazy_glGetObjectBufferfvATI,
+  (_GLEWProc)_glewLazy_glGetObjectBufferivATI,
+  (_GLEWProc)_glewLazy_glGetVariantArrayObjectfvATI,
+  (_GLEWProc)_glewLazy_glGetVariantArrayObjectivATI,
+  (_GLEWProc)_glewLazy_glIsObjectBufferATI,
+  (_GLEWProc)_glewLazy_glNewObjectBufferATI,
+  (_GLEWProc)_glewLazy_glUpdateObjectBufferATI,
+  (_GLEWProc)_glewLazy_glVariantArrayObjectATI,
+
+  (_GLEWProc)_glewLazy_glGetVertexAttribArrayObjectfvATI,
+  (_GLEWProc)_glewLazy_glGetVertexAttribArrayObjectivATI,
+  (_GLEWProc)_glewLazy_glVertexAttribArrayObjectATI,
+
+  (_GLEWProc)_glewLazy_glClientActiveVertexStreamATI,
+  (_GLEWProc)_glewLazy_glNormalStream3bATI,
+  (_GLEWProc)_glewLazy_glNormalStream3bvATI,
+  (_GLEWProc)_glewLazy_glNormalStream3dATI,
+  (_GLEWProc)_glewLazy_glNormalStream3dvATI,
+  (_GLEWProc)_glewLazy_glNormalStream3fATI,
+  (_GLEWProc)_glewLazy_glNormalStream3fvATI,
+  (_GLEWProc)_glewLazy_glNormalStream3iATI,
+  (_GLEWProc)_glewLazy_glNormalStream3ivATI,
+  (_GLEWProc)_glewLazy_glNormalStream3sATI,
+  (_GLEWProc)_glewLazy_glNormalStream3svATI,
+  (_GLEWProc)_glewLazy_glVertexBlendEnvfATI,
+  (_GLEWProc)_glewLazy_glVertexBlendEnviATI,
+  (_GLEWProc)_glewLazy_glVertexStream1dATI,
+  (_GLEWProc)_glewLazy_glVertexStream1dvATI,
+  (_GLEWProc)_glewLazy_glVertexStream1fATI,
+  (_GLEWProc)_glewLazy_glVertexStream1fvATI,
+  (_GLEWProc)_glewLazy_glVertexStream1iATI,
+  (_GLEWProc)_glewLazy_glVertexStream1ivATI,
+  (_GLEWProc)_glewLazy_glVertexStream1sATI,
+  (_GLEWProc)_glewLazy_glVertexStream1svATI,
+  (_GLEWProc)_glewLazy_glVertexStream2dATI,
+  (_GLEWProc)_glewLazy_glVertexStream2dvATI,
+  (_GLEWProc)_glewLazy_glVertexStream2fATI,
+  (_GLEWProc)_glewLazy_glVertexStream2fvATI,
+  (_GLEWProc)_glewLazy_glVertexStream2iATI,
+  (_GLEWProc)_glewLazy_glVertexStream2ivATI,
+  (_GLEWProc)_glewLazy_glVertexStream2sATI,
+  (_GLEWProc)_glewLazy_glVertexStream2svATI,
+  (_GLEWProc)_glewLazy_glVertexStream3dATI,
+  (_GLEWProc)_glewLazy_glVertexStream3dvATI,
+  (_GLEWProc)_glewLazy_glVertexStream3fATI,
+  (_GLEWProc)_glewLazy_glVertexStream3fvATI,
+  (_GLEWProc)_glewLazy_glVertexStream3iATI,
+  (_GLEWProc)_glewLazy_glVertexStream3ivATI,
+  (_GLEWProc)_glewLazy_glVertexStream3sATI,
+  (_GLEWProc)_glewLazy_glVertexStream3svATI,
+  (_GLEWProc)_glewLazy_glVertexStream4dATI,
+  (_GLEWProc)_glewLazy_glVertexStream4dvATI,
+  (_GLEWProc)_glewLazy_glVertexStream4fATI,
+  (_GLEWProc)_glewLazy_glVertexStream4fvATI,
+  (_GLEWProc)_glewLazy_glVertexStream4iATI,
+  (_GLEWProc)_glewLazy_glVertexStream4ivATI,
+  (_GLEWProc)_glewLazy_glVertexStream4sATI,
+  (_GLEWProc)_glewLazy_glVertexStream4svATI,
+
+  (_GLEWProc)_glewLazy_glEGLImageTargetTexStorageEXT,
+  (_GLEWProc)_glewLazy_glEGLImageTargetTextureStorageEXT,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstancedBaseInstanceEXT,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedBaseInstanceEXT,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedBaseVertexBaseInstanceEXT,
+
+  (_GLEWProc)_glewLazy_glGetUniformBufferSizeEXT,
+  (_GLEWProc)_glewLazy_glGetUniformOffsetEXT,
+  (_GLEWProc)_glewLazy_glUniformBufferEXT,
+
+  (_GLEWProc)_glewLazy_glBlendColorEXT,
+
+  (_GLEWProc)_glewLazy_glBlendEquationSeparateEXT,
+
+  (_GLEWProc)_glewLazy_glBindFragDataLocationIndexedEXT,
+  (_GLEWProc)_glewLazy_glGetFragDataIndexEXT,
+  (_GLEWProc)_glewLazy_glGetProgramResourceLocationIndexEXT,
+
+  (_GLEWProc)_glewLazy_glBlendFuncSeparateEXT,
+
+  (_GLEWProc)_glewLazy_glBlendEquationEXT,
+
+  (_GLEWProc)_glewLazy_glBufferStorageEXT,
+  (_GLEWProc)_glewLazy_glNamedBufferStorageEXT,
+
+  (_GLEWProc)_glewLazy_glClearTexImageEXT,
+  (_GLEWProc)_glewLazy_glClearTexSubImageEXT,
+
+  (_GLEWProc)_glewLazy_glClipControlEXT,
+
+  (_GLEWProc)_glewLazy_glColorSubTableEXT,
+  (_GLEWProc)_glewLazy_glCopyColorSubTableEXT,
+
+  (_GLEWProc)_glewLazy_glLockArraysEXT,
+  (_GLEWProc)_glewLazy_glUnlockArraysEXT,
+
+  (_GLEWProc)_glewLazy_glConvolutionFilter1DEXT,
+  (_GLEWProc)_glewLazy_glConvolutionFilter2DEXT,
+  (_GLEWProc)_glewLazy_glConvolutionParameterfEXT,
+  (_GLEWProc)_glewLazy_glConvolutionParameterfvEXT,
+  (_GLEWProc)_glewLazy_glConvolutionParameteriEXT,
+  (_GLEWProc)_glewLazy_glConvolutionParameterivEXT,
+  (_GLEWProc)_glewLazy_glCopyConvolutionFilter1DEXT,
+  (_GLEWProc)_glewLazy_glCopyConvolutionFilter2DEXT,
+  (_GLEWProc)_glewLazy_glGetConvolutionFilterEXT,
+  (_GLEWProc)_glewLazy_glGetConvolutionParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetConvolutionParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetSeparableFilterEXT,
+  (_GLEWProc)_glewLazy_glSeparableFilter2DEXT,
+
+  (_GLEWProc)_glewLazy_glBinormalPointerEXT,
+  (_GLEWProc)_glewLazy_glTangentPointerEXT,
+
+  (_GLEWProc)_glewLazy_glCopyImageSubDataEXT,
+
+  (_GLEWProc)_glewLazy_glCopyTexImage1DEXT,
+  (_GLEWProc)_glewLazy_glCopyTexImage2DEXT,
+  (_GLEWProc)_glewLazy_glCopyTexSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glCopyTexSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glCopyTexSubImage3DEXT,
+
+  (_GLEWProc)_glewLazy_glCullParameterdvEXT,
+  (_GLEWProc)_glewLazy_glCullParameterfvEXT,
+
+  (_GLEWProc)_glewLazy_glGetObjectLabelEXT,
+  (_GLEWProc)_glewLazy_glLabelObjectEXT,
+
+  (_GLEWProc)_glewLazy_glInsertEventMarkerEXT,
+  (_GLEWProc)_glewLazy_glPopGroupMarkerEXT,
+  (_GLEWProc)_glewLazy_glPushGroupMarkerEXT,
+
+  (_GLEWProc)_glewLazy_glDepthBoundsEXT,
+
+  (_GLEWProc)_glewLazy_glBindMultiTextureEXT,
+  (_GLEWProc)_glewLazy_glCheckNamedFramebufferStatusEXT,
+  (_GLEWProc)_glewLazy_glClientAttribDefaultEXT,
+  (_GLEWProc)_glewLazy_glCompressedMultiTexImage1DEXT,
+  (_GLEWProc)_glewLazy_glCompressedMultiTexImage2DEXT,
+  (_GLEWProc)_glewLazy_glCompressedMultiTexImage3DEXT,
+  (_GLEWProc)_glewLazy_glCompressedMultiTexSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glCompressedMultiTexSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glCompressedMultiTexSubImage3DEXT,
+  (_GLEWProc)_glewLazy_glCompressedTextureImage1DEXT,
+  (_GLEWProc)_glewLazy_glCompressedTextureImage2DEXT,
+  (_GLEWProc)_glewLazy_glCompressedTextureImage3DEXT,
+  (_GLEWProc)_glewLazy_glCompressedTextureSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glCompressedTextureSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glCompressedTextureSubImage3DEXT,
+  (_GLEWProc)_glewLazy_glCopyMultiTexImage1DEXT,
+  (_GLEWProc)_glewLazy_glCopyMultiTexImage2DEXT,
+  (_GLEWProc)_glewLazy_glCopyMultiTexSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glCopyMultiTexSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glCopyMultiTexSubImage3DEXT,
+  (_GLEWProc)_glewLazy_glCopyTextureImage1DEXT,
+  (_GLEWProc)_glewLazy_glCopyTextureImage2DEXT,
+  (_GLEWProc)_glewLazy_glCopyTextureSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glCopyTextureSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glCopyTextureSubImage3DEXT,
+  (_GLEWProc)_glewLazy_glDisableClientStateIndexedEXT,
+  (_GLEWProc)_glewLazy_glDisableClientStateiEXT,
+  (_GLEWProc)_glewLazy_glDisableVertexArrayAttribEXT,
+  (_GLEWProc)_glewLazy_glDisableVertexArrayEXT,
+  (_GLEWProc)_glewLazy_glEnableClientStateIndexedEXT,
+  (_GLEWProc)_glewLazy_glEnableClientStateiEXT,
+  (_GLEWProc)_glewLazy_glEnableVertexArrayAttribEXT,
+  (_GLEWProc)_glewLazy_glEnableVertexArrayEXT,
+  (_GLEWProc)_glewLazy_glFlushMappedNamedBufferRangeEXT,
+  (_GLEWProc)_glewLazy_glFramebufferDrawBufferEXT,
+  (_GLEWProc)_glewLazy_glFramebufferDrawBuffersEXT,
+  (_GLEWProc)_glewLazy_glFramebufferReadBufferEXT,
+  (_GLEWProc)_glewLazy_glGenerateMultiTexMipmapEXT,
+  (_GLEWProc)_glewLazy_glGenerateTextureMipmapEXT,
+  (_GLEWProc)_glewLazy_glGetCompressedMultiTexImageEXT,
+  (_GLEWProc)_glewLazy_glGetCompressedTextureImageEXT,
+  (_GLEWProc)_glewLazy_glGetDoubleIndexedvEXT,
+  (_GLEWProc)_glewLazy_glGetDoublei_vEXT,
+  (_GLEWProc)_glewLazy_glGetFloatIndexedvEXT,
+  (_GLEWProc)_glewLazy_glGetFloati_vEXT,
+  (_GLEWProc)_glewLazy_glGetFramebufferParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexEnvfvEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexEnvivEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexGendvEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexGenfvEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexGenivEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexImageEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexLevelParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexLevelParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexParameterIivEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetMultiTexParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetNamedBufferParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetNamedBufferPointervEXT,
+  (_GLEWProc)_glewLazy_glGetNamedBufferSubDataEXT,
+  (_GLEWProc)_glewLazy_glGetNamedFramebufferAttachmentParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetNamedProgramLocalParameterIivEXT,
+  (_GLEWProc)_glewLazy_glGetNamedProgramLocalParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glGetNamedProgramLocalParameterdvEXT,
+  (_GLEWProc)_glewLazy_glGetNamedProgramLocalParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetNamedProgramStringEXT,
+  (_GLEWProc)_glewLazy_glGetNamedProgramivEXT,
+  (_GLEWProc)_glewLazy_glGetNamedRenderbufferParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetPointerIndexedvEXT,
+  (_GLEWProc)_glewLazy_glGetPointeri_vEXT,
+  (_GLEWProc)_glewLazy_glGetTextureImageEXT,
+  (_GLEWProc)_glewLazy_glGetTextureLevelParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetTextureLevelParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetTextureParameterIivEXT,
+  (_GLEWProc)_glewLazy_glGetTextureParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glGetTextureParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetTextureParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetVertexArrayIntegeri_vEXT,
+  (_GLEWProc)_glewLazy_glGetVertexArrayIntegervEXT,
+  (_GLEWProc)_glewLazy_glGetVertexArrayPointeri_vEXT,
+  (_GLEWProc)_glewLazy_glGetVertexArrayPointervEXT,
+  (_GLEWProc)_glewLazy_glMapNamedBufferEXT,
+  (_GLEWProc)_glewLazy_glMapNamedBufferRangeEXT,
+  (_GLEWProc)_glewLazy_glMatrixFrustumEXT,
+  (_GLEWProc)_glewLazy_glMatrixLoadIdentityEXT,
+  (_GLEWProc)_glewLazy_glMatrixLoadTransposedEXT,
+  (_GLEWProc)_glewLazy_glMatrixLoadTransposefEXT,
+  (_GLEWProc)_glewLazy_glMatrixLoaddEXT,
+  (_GLEWProc)_glewLazy_glMatrixLoadfEXT,
+  (_GLEWProc)_glewLazy_glMatrixMultTransposedEXT,
+  (_GLEWProc)_glewLazy_glMatrixMultTransposefEXT,
+  (_GLEWProc)_glewLazy_glMatrixMultdEXT,
+  (_GLEWProc)_glewLazy_glMatrixMultfEXT,
+  (_GLEWProc)_glewLazy_glMatrixOrthoEXT,
+  (_GLEWProc)_glewLazy_glMatrixPopEXT,
+  (_GLEWProc)_glewLazy_glMatrixPushEXT,
+  (_GLEWProc)_glewLazy_glMatrixRotatedEXT,
+  (_GLEWProc)_glewLazy_glMatrixRotatefEXT,
+  (_GLEWProc)_glewLazy_glMatrixScaledEXT,
+  (_GLEWProc)_glewLazy_glMatrixScalefEXT,
+  (_GLEWProc)_glewLazy_glMatrixTranslatedEXT,
+  (_GLEWProc)_glewLazy_glMatrixTranslatefEXT,
+  (_GLEWProc)_glewLazy_glMultiTexBufferEXT,
+  (_GLEWProc)_glewLazy_glMultiTexCoordPointerEXT,
+  (_GLEWProc)_glewLazy_glMultiTexEnvfEXT,
+  (_GLEWProc)_glewLazy_glMultiTexEnvfvEXT,
+  (_GLEWProc)_glewLazy_glMultiTexEnviEXT,
+  (_GLEWProc)_glewLazy_glMultiTexEnvivEXT,
+  (_GLEWProc)_glewLazy_glMultiTexGendEXT,
+  (_GLEWProc)_glewLazy_glMultiTexGendvEXT,
+  (_GLEWProc)_glewLazy_glMultiTexGenfEXT,
+  (_GLEWProc)_glewLazy_glMultiTexGenfvEXT,
+  (_GLEWProc)_glewLazy_glMultiTexGeniEXT,
+  (_GLEWProc)_glewLazy_glMultiTexGenivEXT,
+  (_GLEWProc)_glewLazy_glMultiTexImage1DEXT,
+  (_GLEWProc)_glewLazy_glMultiTexImage2DEXT,
+  (_GLEWProc)_glewLazy_glMultiTexImage3DEXT,
+  (_GLEWProc)_glewLazy_glMultiTexParameterIivEXT,
+  (_GLEWProc)_glewLazy_glMultiTexParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glMultiTexParameterfEXT,
+  (_GLEWProc)_glewLazy_glMultiTexParameterfvEXT,
+  (_GLEWProc)_glewLazy_glMultiTexParameteriEXT,
+  (_GLEWProc)_glewLazy_glMultiTexParameterivEXT,
+  (_GLEWProc)_glewLazy_glMultiTexRenderbufferEXT,
+  (_GLEWProc)_glewLazy_glMultiTexSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glMultiTexSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glMultiTexSubImage3DEXT,
+  (_GLEWProc)_glewLazy_glNamedBufferDataEXT,
+  (_GLEWProc)_glewLazy_glNamedBufferSubDataEXT,
+  (_GLEWProc)_glewLazy_glNamedCopyBufferSubDataEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferRenderbufferEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTexture1DEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTexture2DEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTexture3DEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTextureEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTextureFaceEXT,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTextureLayerEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameter4dEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameter4dvEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameter4fEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameter4fvEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameterI4iEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameterI4ivEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameterI4uiEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameterI4uivEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParameters4fvEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParametersI4ivEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramLocalParametersI4uivEXT,
+  (_GLEWProc)_glewLazy_glNamedProgramStringEXT,
+  (_GLEWProc)_glewLazy_glNamedRenderbufferStorageEXT,
+  (_GLEWProc)_glewLazy_glNamedRenderbufferStorageMultisampleCoverageEXT,
+  (_GLEWProc)_glewLazy_glNamedRenderbufferStorageMultisampleEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform1fEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform1fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform1iEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform1ivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform1uiEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform1uivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform2fEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform2fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform2iEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform2ivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform2uiEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform2uivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform3fEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform3fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform3iEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform3ivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform3uiEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform3uivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform4fEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform4fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform4iEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform4ivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform4uiEXT,
+  (_GLEWProc)_glewLazy_glProgramUniform4uivEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2x3fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix2x4fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3x2fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix3x4fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4x2fvEXT,
+  (_GLEWProc)_glewLazy_glProgramUniformMatrix4x3fvEXT,
+  (_GLEWProc)_glewLazy_glPushClientAttribDefaultEXT,
+  (_GLEWProc)_glewLazy_glTextureBufferEXT,
+  (_GLEWProc)_glewLazy_glTextureImage1DEXT,
+  (_GLEWProc)_glewLazy_glTextureImage2DEXT,
+  (_GLEWProc)_glewLazy_glTextureImage3DEXT,
+  (_GLEWProc)_glewLazy_glTextureParameterIivEXT,
+  (_GLEWProc)_glewLazy_glTextureParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glTextureParameterfEXT,
+  (_GLEWProc)_glewLazy_glTextureParameterfvEXT,
+  (_GLEWProc)_glewLazy_glTextureParameteriEXT,
+  (_GLEWProc)_glewLazy_glTextureParameterivEXT,
+  (_GLEWProc)_glewLazy_glTextureRenderbufferEXT,
+  (_GLEWProc)_glewLazy_glTextureSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glTextureSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glTextureSubImage3DEXT,
+  (_GLEWProc)_glewLazy_glUnmapNamedBufferEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayColorOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayEdgeFlagOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayFogCoordOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayIndexOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayMultiTexCoordOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayNormalOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArraySecondaryColorOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayTexCoordOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribDivisorEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribIOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexOffsetEXT,
+
+  (_GLEWProc)_glewLazy_glDiscardFramebufferEXT,
+
+  (_GLEWProc)_glewLazy_glBeginQueryEXT,
+  (_GLEWProc)_glewLazy_glDeleteQueriesEXT,
+  (_GLEWProc)_glewLazy_glEndQueryEXT,
+  (_GLEWProc)_glewLazy_glGenQueriesEXT,
+  (_GLEWProc)_glewLazy_glGetInteger64vEXT,
+  (_GLEWProc)_glewLazy_glGetQueryObjectivEXT,
+  (_GLEWProc)_glewLazy_glGetQueryObjectuivEXT,
+  (_GLEWProc)_glewLazy_glGetQueryivEXT,
+  (_GLEWProc)_glewLazy_glIsQueryEXT,
+  (_GLEWProc)_glewLazy_glQueryCounterEXT,
+
+  (_GLEWProc)_glewLazy_glDrawBuffersEXT,
+
+  (_GLEWProc)_glewLazy_glColorMaskIndexedEXT,
+  (_GLEWProc)_glewLazy_glDisableIndexedEXT,
+  (_GLEWProc)_glewLazy_glEnableIndexedEXT,
+  (_GLEWProc)_glewLazy_glGetBooleanIndexedvEXT,
+  (_GLEWProc)_glewLazy_glGetIntegerIndexedvEXT,
+  (_GLEWProc)_glewLazy_glIsEnabledIndexedEXT,
+
+  (_GLEWProc)_glewLazy_glBlendEquationSeparateiEXT,
+  (_GLEWProc)_glewLazy_glBlendEquationiEXT,
+  (_GLEWProc)_glewLazy_glBlendFuncSeparateiEXT,
+  (_GLEWProc)_glewLazy_glBlendFunciEXT,
+  (_GLEWProc)_glewLazy_glColorMaskiEXT,
+  (_GLEWProc)_glewLazy_glDisableiEXT,
+  (_GLEWProc)_glewLazy_glEnableiEXT,
+  (_GLEWProc)_glewLazy_glIsEnablediEXT,
+
+  (_GLEWProc)_glewLazy_glDrawElementsBaseVertexEXT,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedBaseVertexEXT,
+  (_GLEWProc)_glewLazy_glDrawRangeElementsBaseVertexEXT,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsBaseVertexEXT,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstancedEXT,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedEXT,
+
+  (_GLEWProc)_glewLazy_glDrawRangeElementsEXT,
+
+  (_GLEWProc)_glewLazy_glDrawTransformFeedbackEXT,
+  (_GLEWProc)_glewLazy_glDrawTransformFeedbackInstancedEXT,
+
+  (_GLEWProc)_glewLazy_glBufferStorageExternalEXT,
+  (_GLEWProc)_glewLazy_glNamedBufferStorageExternalEXT,
+
+  (_GLEWProc)_glewLazy_glFogCoordPointerEXT,
+  (_GLEWProc)_glewLazy_glFogCoorddEXT,
+  (_GLEWProc)_glewLazy_glFogCoorddvEXT,
+  (_GLEWProc)_glewLazy_glFogCoordfEXT,
+  (_GLEWProc)_glewLazy_glFogCoordfvEXT,
+
+  (_GLEWProc)_glewLazy_glFragmentColorMaterialEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightModelfEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightModelfvEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightModeliEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightModelivEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightfEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightfvEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightiEXT,
+  (_GLEWProc)_glewLazy_glFragmentLightivEXT,
+  (_GLEWProc)_glewLazy_glFragmentMaterialfEXT,
+  (_GLEWProc)_glewLazy_glFragmentMaterialfvEXT,
+  (_GLEWProc)_glewLazy_glFragmentMaterialiEXT,
+  (_GLEWProc)_glewLazy_glFragmentMaterialivEXT,
+  (_GLEWProc)_glewLazy_glGetFragmentLightfvEXT,
+  (_GLEWProc)_glewLazy_glGetFragmentLightivEXT,
+  (_GLEWProc)_glewLazy_glGetFragmentMaterialfvEXT,
+  (_GLEWProc)_glewLazy_glGetFragmentMaterialivEXT,
+  (_GLEWProc)_glewLazy_glLightEnviEXT,
+
+  (_GLEWProc)_glewLazy_glBlitFramebufferEXT,
+
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleEXT,
+
+  (_GLEWProc)_glewLazy_glBindFramebufferEXT,
+  (_GLEWProc)_glewLazy_glBindRenderbufferEXT,
+  (_GLEWProc)_glewLazy_glCheckFramebufferStatusEXT,
+  (_GLEWProc)_glewLazy_glDeleteFramebuffersEXT,
+  (_GLEWProc)_glewLazy_glDeleteRenderbuffersEXT,
+  (_GLEWProc)_glewLazy_glFramebufferRenderbufferEXT,
+  (_GLEWProc)_glewLazy_glFramebufferTexture1DEXT,
+  (_GLEWProc)_glewLazy_glFramebufferTexture2DEXT,
+  (_GLEWProc)_glewLazy_glFramebufferTexture3DEXT,
+  (_GLEWProc)_glewLazy_glGenFramebuffersEXT,
+  (_GLEWProc)_glewLazy_glGenRenderbuffersEXT,
+  (_GLEWProc)_glewLazy_glGenerateMipmapEXT,
+  (_GLEWProc)_glewLazy_glGetFramebufferAttachmentParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetRenderbufferParameterivEXT,
+  (_GLEWProc)_glewLazy_glIsFramebufferEXT,
+  (_GLEWProc)_glewLazy_glIsRenderbufferEXT,
+  (_GLEWProc)_glewLazy_glRenderbufferStorageEXT,
+
+  (_GLEWProc)_glewLazy_glFramebufferTextureEXT,
+  (_GLEWProc)_glewLazy_glFramebufferTextureFaceEXT,
+  (_GLEWProc)_glewLazy_glProgramParameteriEXT,
+
+  (_GLEWProc)_glewLazy_glProgramEnvParameters4fvEXT,
+  (_GLEWProc)_glewLazy_glProgramLocalParameters4fvEXT,
+
+  (_GLEWProc)_glewLazy_glBindFragDataLocationEXT,
+  (_GLEWProc)_glewLazy_glGetFragDataLocationEXT,
+  (_GLEWProc)_glewLazy_glGetUniformuivEXT,
+  (_GLEWProc)_glewLazy_glGetVertexAttribIivEXT,
+  (_GLEWProc)_glewLazy_glGetVertexAttribIuivEXT,
+  (_GLEWProc)_glewLazy_glUniform1uiEXT,
+  (_GLEWProc)_glewLazy_glUniform1uivEXT,
+  (_GLEWProc)_glewLazy_glUniform2uiEXT,
+  (_GLEWProc)_glewLazy_glUniform2uivEXT,
+  (_GLEWProc)_glewLazy_glUniform3uiEXT,
+  (_GLEWProc)_glewLazy_glUniform3uivEXT,
+  (_GLEWProc)_glewLazy_glUniform4uiEXT,
+  (_GLEWProc)_glewLazy_glUniform4uivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI1iEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI1ivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI1uiEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI1uivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI2iEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI2ivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI2uiEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI2uivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI3iEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI3ivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI3uiEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI3uivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4bvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4iEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4ivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4svEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4ubvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4uiEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4uivEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribI4usvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribIPointerEXT,
+
+  (_GLEWProc)_glewLazy_glGetHistogramEXT,
+  (_GLEWProc)_glewLazy_glGetHistogramParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetHistogramParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetMinmaxEXT,
+  (_GLEWProc)_glewLazy_glGetMinmaxParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetMinmaxParameterivEXT,
+  (_GLEWProc)_glewLazy_glHistogramEXT,
+  (_GLEWProc)_glewLazy_glMinmaxEXT,
+  (_GLEWProc)_glewLazy_glResetHistogramEXT,
+  (_GLEWProc)_glewLazy_glResetMinmaxEXT,
+
+  (_GLEWProc)_glewLazy_glIndexFuncEXT,
+
+  (_GLEWProc)_glewLazy_glIndexMaterialEXT,
+
+  (_GLEWProc)_glewLazy_glVertexAttribDivisorEXT,
+
+  (_GLEWProc)_glewLazy_glApplyTextureEXT,
+  (_GLEWProc)_glewLazy_glTextureLightEXT,
+  (_GLEWProc)_glewLazy_glTextureMaterialEXT,
+
+  (_GLEWProc)_glewLazy_glFlushMappedBufferRangeEXT,
+  (_GLEWProc)_glewLazy_glMapBufferRangeEXT,
+
+  (_GLEWProc)_glewLazy_glBufferStorageMemEXT,
+  (_GLEWProc)_glewLazy_glCreateMemoryObjectsEXT,
+  (_GLEWProc)_glewLazy_glDeleteMemoryObjectsEXT,
+  (_GLEWProc)_glewLazy_glGetMemoryObjectParameterivEXT,
+  (_GLEWProc)_glewLazy_glGetUnsignedBytei_vEXT,
+  (_GLEWProc)_glewLazy_glGetUnsignedBytevEXT,
+  (_GLEWProc)_glewLazy_glIsMemoryObjectEXT,
+  (_GLEWProc)_glewLazy_glMemoryObjectParameterivEXT,
+  (_GLEWProc)_glewLazy_glNamedBufferStorageMemEXT,
+  (_GLEWProc)_glewLazy_glTexStorageMem1DEXT,
+  (_GLEWProc)_glewLazy_glTexStorageMem2DEXT,
+  (_GLEWProc)_glewLazy_glTexStorageMem2DMultisampleEXT,
+  (_GLEWProc)_glewLazy_glTexStorageMem3DEXT,
+  (_GLEWProc)_glewLazy_glTexStorageMem3DMultisampleEXT,
+  (_GLEWProc)_glewLazy_glTextureStorageMem1DEXT,
+  (_GLEWProc)_glewLazy_glTextureStorageMem2DEXT,
+  (_GLEWProc)_glewLazy_glTextureStorageMem2DMultisampleEXT,
+  (_GLEWProc)_glewLazy_glTextureStorageMem3DEXT,
+  (_GLEWProc)_glewLazy_glTextureStorageMem3DMultisampleEXT,
+
+  (_GLEWProc)_glewLazy_glImportMemoryFdEXT,
+
+  (_GLEWProc)_glewLazy_glImportMemoryWin32HandleEXT,
+  (_GLEWProc)_glewLazy_glImportMemoryWin32NameEXT,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysEXT,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsEXT,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirectEXT,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirectEXT,
+
+  (_GLEWProc)_glewLazy_glSampleMaskEXT,
+  (_GLEWProc)_glewLazy_glSamplePatternEXT,
+
+  (_GLEWProc)_glewLazy_glFramebufferTexture2DMultisampleEXT,
+
+  (_GLEWProc)_glewLazy_glDrawBuffersIndexedEXT,
+  (_GLEWProc)_glewLazy_glGetIntegeri_vEXT,
+  (_GLEWProc)_glewLazy_glReadBufferIndexedEXT,
+
+  (_GLEWProc)_glewLazy_glColorTableEXT,
+  (_GLEWProc)_glewLazy_glGetColorTableEXT,
+  (_GLEWProc)_glewLazy_glGetColorTableParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetColorTableParameterivEXT,
+
+  (_GLEWProc)_glewLazy_glGetPixelTransformParameterfvEXT,
+  (_GLEWProc)_glewLazy_glGetPixelTransformParameterivEXT,
+  (_GLEWProc)_glewLazy_glPixelTransformParameterfEXT,
+  (_GLEWProc)_glewLazy_glPixelTransformParameterfvEXT,
+  (_GLEWProc)_glewLazy_glPixelTransformParameteriEXT,
+  (_GLEWProc)_glewLazy_glPixelTransformParameterivEXT,
+
+  (_GLEWProc)_glewLazy_glPointParameterfEXT,
+  (_GLEWProc)_glewLazy_glPointParameterfvEXT,
+
+  (_GLEWProc)_glewLazy_glPolygonOffsetEXT,
+
+  (_GLEWProc)_glewLazy_glPolygonOffsetClampEXT,
+
+  (_GLEWProc)_glewLazy_glPrimitiveBoundingBoxEXT,
+
+  (_GLEWProc)_glewLazy_glProvokingVertexEXT,
+
+  (_GLEWProc)_glewLazy_glCoverageModulationNV,
+  (_GLEWProc)_glewLazy_glCoverageModulationTableNV,
+  (_GLEWProc)_glewLazy_glGetCoverageModulationTableNV,
+  (_GLEWProc)_glewLazy_glRasterSamplesEXT,
+
+  (_GLEWProc)_glewLazy_glGetnUniformfvEXT,
+  (_GLEWProc)_glewLazy_glGetnUniformivEXT,
+  (_GLEWProc)_glewLazy_glReadnPixelsEXT,
+
+  (_GLEWProc)_glewLazy_glBeginSceneEXT,
+  (_GLEWProc)_glewLazy_glEndSceneEXT,
+
+  (_GLEWProc)_glewLazy_glSecondaryColor3bEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3bvEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3dEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3dvEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3fEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3fvEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3iEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3ivEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3sEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3svEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3ubEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3ubvEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3uiEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3uivEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3usEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColor3usvEXT,
+  (_GLEWProc)_glewLazy_glSecondaryColorPointerEXT,
+
+  (_GLEWProc)_glewLazy_glDeleteSemaphoresEXT,
+  (_GLEWProc)_glewLazy_glGenSemaphoresEXT,
+  (_GLEWProc)_glewLazy_glGetSemaphoreParameterui64vEXT,
+  (_GLEWProc)_glewLazy_glIsSemaphoreEXT,
+  (_GLEWProc)_glewLazy_glSemaphoreParameterui64vEXT,
+  (_GLEWProc)_glewLazy_glSignalSemaphoreEXT,
+  (_GLEWProc)_glewLazy_glWaitSemaphoreEXT,
+
+  (_GLEWProc)_glewLazy_glImportSemaphoreFdEXT,
+
+  (_GLEWProc)_glewLazy_glImportSemaphoreWin32HandleEXT,
+  (_GLEWProc)_glewLazy_glImportSemaphoreWin32NameEXT,
+
+  (_GLEWProc)_glewLazy_glActiveProgramEXT,
+  (_GLEWProc)_glewLazy_glCreateShaderProgramEXT,
+  (_GLEWProc)_glewLazy_glUseShaderProgramEXT,
+
+  (_GLEWProc)_glewLazy_glFramebufferFetchBarrierEXT,
+
+  (_GLEWProc)_glewLazy_glBindImageTextureEXT,
+  (_GLEWProc)_glewLazy_glMemoryBarrierEXT,
+
+  (_GLEWProc)_glewLazy_glClearPixelLocalStorageuiEXT,
+  (_GLEWProc)_glewLazy_glFramebufferPixelLocalStorageSizeEXT,
+  (_GLEWProc)_glewLazy_glGetFramebufferPixelLocalStorageSizeEXT,
+
+  (_GLEWProc)_glewLazy_glTexPageCommitmentEXT,
+  (_GLEWProc)_glewLazy_glTexturePageCommitmentEXT,
+
+  (_GLEWProc)_glewLazy_glActiveStencilFaceEXT,
+
+  (_GLEWProc)_glewLazy_glTexSubImage1DEXT,
+  (_GLEWProc)_glewLazy_glTexSubImage2DEXT,
+  (_GLEWProc)_glewLazy_glTexSubImage3DEXT,
+
+  (_GLEWProc)_glewLazy_glPatchParameteriEXT,
+
+  (_GLEWProc)_glewLazy_glTexImage3DEXT,
+
+  (_GLEWProc)_glewLazy_glFramebufferTextureLayerEXT,
+
+  (_GLEWProc)_glewLazy_glGetSamplerParameterIivEXT,
+  (_GLEWProc)_glewLazy_glGetSamplerParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glSamplerParameterIivEXT,
+  (_GLEWProc)_glewLazy_glSamplerParameterIuivEXT,
+
+  (_GLEWProc)_glewLazy_glTexBufferEXT,
+
+  (_GLEWProc)_glewLazy_glClearColorIiEXT,
+  (_GLEWProc)_glewLazy_glClearColorIuiEXT,
+  (_GLEWProc)_glewLazy_glGetTexParameterIivEXT,
+  (_GLEWProc)_glewLazy_glGetTexParameterIuivEXT,
+  (_GLEWProc)_glewLazy_glTexParameterIivEXT,
+  (_GLEWProc)_glewLazy_glTexParameterIuivEXT,
+
+  (_GLEWProc)_glewLazy_glAreTexturesResidentEXT,
+  (_GLEWProc)_glewLazy_glBindTextureEXT,
+  (_GLEWProc)_glewLazy_glDeleteTexturesEXT,
+  (_GLEWProc)_glewLazy_glGenTexturesEXT,
+  (_GLEWProc)_glewLazy_glIsTextureEXT,
+  (_GLEWProc)_glewLazy_glPrioritizeTexturesEXT,
+
+  (_GLEWProc)_glewLazy_glTextureNormalEXT,
+
+  (_GLEWProc)_glewLazy_glTexStorage1DEXT,
+  (_GLEWProc)_glewLazy_glTexStorage2DEXT,
+  (_GLEWProc)_glewLazy_glTexStorage3DEXT,
+  (_GLEWProc)_glewLazy_glTextureStorage1DEXT,
+  (_GLEWProc)_glewLazy_glTextureStorage2DEXT,
+  (_GLEWProc)_glewLazy_glTextureStorage3DEXT,
+
+  (_GLEWProc)_glewLazy_glTextureViewEXT,
+
+  (_GLEWProc)_glewLazy_glGetQueryObjecti64vEXT,
+  (_GLEWProc)_glewLazy_glGetQueryObjectui64vEXT,
+
+  (_GLEWProc)_glewLazy_glBeginTransformFeedbackEXT,
+  (_GLEWProc)_glewLazy_glBindBufferBaseEXT,
+  (_GLEWProc)_glewLazy_glBindBufferOffsetEXT,
+  (_GLEWProc)_glewLazy_glBindBufferRangeEXT,
+  (_GLEWProc)_glewLazy_glEndTransformFeedbackEXT,
+  (_GLEWProc)_glewLazy_glGetTransformFeedbackVaryingEXT,
+  (_GLEWProc)_glewLazy_glTransformFeedbackVaryingsEXT,
+
+  (_GLEWProc)_glewLazy_glArrayElementEXT,
+  (_GLEWProc)_glewLazy_glColorPointerEXT,
+  (_GLEWProc)_glewLazy_glDrawArraysEXT,
+  (_GLEWProc)_glewLazy_glEdgeFlagPointerEXT,
+  (_GLEWProc)_glewLazy_glIndexPointerEXT,
+  (_GLEWProc)_glewLazy_glNormalPointerEXT,
+  (_GLEWProc)_glewLazy_glTexCoordPointerEXT,
+  (_GLEWProc)_glewLazy_glVertexPointerEXT,
+
+  (_GLEWProc)_glewLazy_glBindArraySetEXT,
+  (_GLEWProc)_glewLazy_glCreateArraySetExt,
+  (_GLEWProc)_glewLazy_glDeleteArraySetsEXT,
+
+  (_GLEWProc)_glewLazy_glGetVertexAttribLdvEXT,
+  (_GLEWProc)_glewLazy_glVertexArrayVertexAttribLOffsetEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL1dEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL1dvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL2dEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL2dvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL3dEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL3dvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL4dEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribL4dvEXT,
+  (_GLEWProc)_glewLazy_glVertexAttribLPointerEXT,
+
+  (_GLEWProc)_glewLazy_glBeginVertexShaderEXT,
+  (_GLEWProc)_glewLazy_glBindLightParameterEXT,
+  (_GLEWProc)_glewLazy_glBindMaterialParameterEXT,
+  (_GLEWProc)_glewLazy_glBindParameterEXT,
+  (_GLEWProc)_glewLazy_glBindTexGenParameterEXT,
+  (_GLEWProc)_glewLazy_glBindTextureUnitParameterEXT,
+  (_GLEWProc)_glewLazy_glBindVertexShaderEXT,
+  (_GLEWProc)_glewLazy_glDeleteVertexShaderEXT,
+  (_GLEWProc)_glewLazy_glDisableVariantClientStateEXT,
+  (_GLEWProc)_glewLazy_glEnableVariantClientStateEXT,
+  (_GLEWProc)_glewLazy_glEndVertexShaderEXT,
+  (_GLEWProc)_glewLazy_glExtractComponentEXT,
+  (_GLEWProc)_glewLazy_glGenSymbolsEXT,
+  (_GLEWProc)_glewLazy_glGenVertexShadersEXT,
+  (_GLEWProc)_glewLazy_glGetInvariantBooleanvEXT,
+  (_GLEWProc)_glewLazy_glGetInvariantFloatvEXT,
+  (_GLEWProc)_glewLazy_glGetInvariantIntegervEXT,
+  (_GLEWProc)_glewLazy_glGetLocalConstantBooleanvEXT,
+  (_GLEWProc)_glewLazy_glGetLocalConstantFloatvEXT,
+  (_GLEWProc)_glewLazy_glGetLocalConstantIntegervEXT,
+  (_GLEWProc)_glewLazy_glGetVariantBooleanvEXT,
+  (_GLEWProc)_glewLazy_glGetVariantFloatvEXT,
+  (_GLEWProc)_glewLazy_glGetVariantIntegervEXT,
+  (_GLEWProc)_glewLazy_glGetVariantPointervEXT,
+  (_GLEWProc)_glewLazy_glInsertComponentEXT,
+  (_GLEWProc)_glewLazy_glIsVariantEnabledEXT,
+  (_GLEWProc)_glewLazy_glSetInvariantEXT,
+  (_GLEWProc)_glewLazy_glSetLocalConstantEXT,
+  (_GLEWProc)_glewLazy_glShaderOp1EXT,
+  (_GLEWProc)_glewLazy_glShaderOp2EXT,
+  (_GLEWProc)_glewLazy_glShaderOp3EXT,
+  (_GLEWProc)_glewLazy_glSwizzleEXT,
+  (_GLEWProc)_glewLazy_glVariantPointerEXT,
+  (_GLEWProc)_glewLazy_glVariantbvEXT,
+  (_GLEWProc)_glewLazy_glVariantdvEXT,
+  (_GLEWProc)_glewLazy_glVariantfvEXT,
+  (_GLEWProc)_glewLazy_glVariantivEXT,
+  (_GLEWProc)_glewLazy_glVariantsvEXT,
+  (_GLEWProc)_glewLazy_glVariantubvEXT,
+  (_GLEWProc)_glewLazy_glVariantuivEXT,
+  (_GLEWProc)_glewLazy_glVariantusvEXT,
+  (_GLEWProc)_glewLazy_glWriteMaskEXT,
+
+  (_GLEWProc)_glewLazy_glVertexWeightPointerEXT,
+  (_GLEWProc)_glewLazy_glVertexWeightfEXT,
+  (_GLEWProc)_glewLazy_glVertexWeightfvEXT,
+
+  (_GLEWProc)_glewLazy_glAcquireKeyedMutexWin32EXT,
+  (_GLEWProc)_glewLazy_glReleaseKeyedMutexWin32EXT,
+
+  (_GLEWProc)_glewLazy_glWindowRectanglesEXT,
+
+  (_GLEWProc)_glewLazy_glImportSyncEXT,
+
+  (_GLEWProc)_glewLazy_glFrameTerminatorGREMEDY,
+
+  (_GLEWProc)_glewLazy_glStringMarkerGREMEDY,
+
+  (_GLEWProc)_glewLazy_glGetImageTransformParameterfvHP,
+  (_GLEWProc)_glewLazy_glGetImageTransformParameterivHP,
+  (_GLEWProc)_glewLazy_glImageTransformParameterfHP,
+  (_GLEWProc)_glewLazy_glImageTransformParameterfvHP,
+  (_GLEWProc)_glewLazy_glImageTransformParameteriHP,
+  (_GLEWProc)_glewLazy_glImageTransformParameterivHP,
+
+  (_GLEWProc)_glewLazy_glMultiModeDrawArraysIBM,
+  (_GLEWProc)_glewLazy_glMultiModeDrawElementsIBM,
+
+  (_GLEWProc)_glewLazy_glColorPointerListIBM,
+  (_GLEWProc)_glewLazy_glEdgeFlagPointerListIBM,
+  (_GLEWProc)_glewLazy_glFogCoordPointerListIBM,
+  (_GLEWProc)_glewLazy_glIndexPointerListIBM,
+  (_GLEWProc)_glewLazy_glNormalPointerListIBM,
+  (_GLEWProc)_glewLazy_glSecondaryColorPointerListIBM,
+  (_GLEWProc)_glewLazy_glTexCoordPointerListIBM,
+  (_GLEWProc)_glewLazy_glVertexPointerListIBM,
+
+  (_GLEWProc)_glewLazy_glGetTextureHandleIMG,
+  (_GLEWProc)_glewLazy_glGetTextureSamplerHandleIMG,
+  (_GLEWProc)_glewLazy_glProgramUniformHandleui64IMG,
+  (_GLEWProc)_glewLazy_glProgramUniformHandleui64vIMG,
+  (_GLEWProc)_glewLazy_glUniformHandleui64IMG,
+  (_GLEWProc)_glewLazy_glUniformHandleui64vIMG,
+
+  (_GLEWProc)_glewLazy_glFramebufferTexture2DDownsampleIMG,
+  (_GLEWProc)_glewLazy_glFramebufferTextureLayerDownsampleIMG,
+
+  (_GLEWProc)_glewLazy_glFramebufferTexture2DMultisampleIMG,
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleIMG,
+
+  (_GLEWProc)_glewLazy_glMapTexture2DINTEL,
+  (_GLEWProc)_glewLazy_glSyncTextureINTEL,
+  (_GLEWProc)_glewLazy_glUnmapTexture2DINTEL,
+
+  (_GLEWProc)_glewLazy_glColorPointervINTEL,
+  (_GLEWProc)_glewLazy_glNormalPointervINTEL,
+  (_GLEWProc)_glewLazy_glTexCoordPointervINTEL,
+  (_GLEWProc)_glewLazy_glVertexPointervINTEL,
+
+  (_GLEWProc)_glewLazy_glBeginPerfQueryINTEL,
+  (_GLEWProc)_glewLazy_glCreatePerfQueryINTEL,
+  (_GLEWProc)_glewLazy_glDeletePerfQueryINTEL,
+  (_GLEWProc)_glewLazy_glEndPerfQueryINTEL,
+  (_GLEWProc)_glewLazy_glGetFirstPerfQueryIdINTEL,
+  (_GLEWProc)_glewLazy_glGetNextPerfQueryIdINTEL,
+  (_GLEWProc)_glewLazy_glGetPerfCounterInfoINTEL,
+  (_GLEWProc)_glewLazy_glGetPerfQueryDataINTEL,
+  (_GLEWProc)_glewLazy_glGetPerfQueryIdByNameINTEL,
+  (_GLEWProc)_glewLazy_glGetPerfQueryInfoINTEL,
+
+  (_GLEWProc)_glewLazy_glTexScissorFuncINTEL,
+  (_GLEWProc)_glewLazy_glTexScissorINTEL,
+
+  (_GLEWProc)_glewLazy_glBlendBarrierKHR,
+
+  (_GLEWProc)_glewLazy_glDebugMessageCallback,
+  (_GLEWProc)_glewLazy_glDebugMessageControl,
+  (_GLEWProc)_glewLazy_glDebugMessageInsert,
+  (_GLEWProc)_glewLazy_glGetDebugMessageLog,
+  (_GLEWProc)_glewLazy_glGetObjectLabel,
+  (_GLEWProc)_glewLazy_glGetObjectPtrLabel,
+  (_GLEWProc)_glewLazy_glObjectLabel,
+  (_GLEWProc)_glewLazy_glObjectPtrLabel,
+  (_GLEWProc)_glewLazy_glPopDebugGroup,
+  (_GLEWProc)_glewLazy_glPushDebugGroup,
+
+  (_GLEWProc)_glewLazy_glMaxShaderCompilerThreadsKHR,
+
+  (_GLEWProc)_glewLazy_glGetnUniformfv,
+  (_GLEWProc)_glewLazy_glGetnUniformiv,
+  (_GLEWProc)_glewLazy_glGetnUniformuiv,
+  (_GLEWProc)_glewLazy_glReadnPixels,
+
+  (_GLEWProc)_glewLazy_glBufferRegionEnabled,
+  (_GLEWProc)_glewLazy_glDeleteBufferRegion,
+  (_GLEWProc)_glewLazy_glDrawBufferRegion,
+  (_GLEWProc)_glewLazy_glNewBufferRegion,
+  (_GLEWProc)_glewLazy_glReadBufferRegion,
+
+  (_GLEWProc)_glewLazy_glFramebufferParameteriMESA,
+  (_GLEWProc)_glewLazy_glGetFramebufferParameterivMESA,
+
+  (_GLEWProc)_glewLazy_glResizeBuffersMESA,
+
+  (_GLEWProc)_glewLazy_glWindowPos2dMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2dvMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2fMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2fvMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2iMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2ivMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2sMESA,
+  (_GLEWProc)_glewLazy_glWindowPos2svMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3dMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3dvMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3fMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3fvMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3iMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3ivMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3sMESA,
+  (_GLEWProc)_glewLazy_glWindowPos3svMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4dMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4dvMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4fMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4fvMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4iMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4ivMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4sMESA,
+  (_GLEWProc)_glewLazy_glWindowPos4svMESA,
+
+  (_GLEWProc)_glewLazy_glBeginConditionalRenderNVX,
+  (_GLEWProc)_glewLazy_glEndConditionalRenderNVX,
+
+  (_GLEWProc)_glewLazy_glAsyncCopyBufferSubDataNVX,
+  (_GLEWProc)_glewLazy_glAsyncCopyImageSubDataNVX,
+  (_GLEWProc)_glewLazy_glMulticastScissorArrayvNVX,
+  (_GLEWProc)_glewLazy_glMulticastViewportArrayvNVX,
+  (_GLEWProc)_glewLazy_glMulticastViewportPositionWScaleNVX,
+  (_GLEWProc)_glewLazy_glUploadGpuMaskNVX,
+
+  (_GLEWProc)_glewLazy_glLGPUCopyImageSubDataNVX,
+  (_GLEWProc)_glewLazy_glLGPUInterlockNVX,
+  (_GLEWProc)_glewLazy_glLGPUNamedBufferSubDataNVX,
+
+  (_GLEWProc)_glewLazy_glClientWaitSemaphoreui64NVX,
+  (_GLEWProc)_glewLazy_glSignalSemaphoreui64NVX,
+  (_GLEWProc)_glewLazy_glWaitSemaphoreui64NVX,
+
+  (_GLEWProc)_glewLazy_glStereoParameterfNV,
+  (_GLEWProc)_glewLazy_glStereoParameteriNV,
+
+  (_GLEWProc)_glewLazy_glAlphaToCoverageDitherControlNV,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirectBindlessNV,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirectBindlessNV,
+
+  (_GLEWProc)_glewLazy_glMultiDrawArraysIndirectBindlessCountNV,
+  (_GLEWProc)_glewLazy_glMultiDrawElementsIndirectBindlessCountNV,
+
+  (_GLEWProc)_glewLazy_glGetImageHandleNV,
+  (_GLEWProc)_glewLazy_glGetTextureHandleNV,
+  (_GLEWProc)_glewLazy_glGetTextureSamplerHandleNV,
+  (_GLEWProc)_glewLazy_glIsImageHandleResidentNV,
+  (_GLEWProc)_glewLazy_glIsTextureHandleResidentNV,
+  (_GLEWProc)_glewLazy_glMakeImageHandleNonResidentNV,
+  (_GLEWProc)_glewLazy_glMakeImageHandleResidentNV,
+  (_GLEWProc)_glewLazy_glMakeTextureHandleNonResidentNV,
+  (_GLEWProc)_glewLazy_glMakeTextureHandleResidentNV,
+  (_GLEWProc)_glewLazy_glProgramUniformHandleui64NV,
+  (_GLEWProc)_glewLazy_glProgramUniformHandleui64vNV,
+  (_GLEWProc)_glewLazy_glUniformHandleui64NV,
+  (_GLEWProc)_glewLazy_glUniformHandleui64vNV,
+
+  (_GLEWProc)_glewLazy_glBlendBarrierNV,
+  (_GLEWProc)_glewLazy_glBlendParameteriNV,
+
+  (_GLEWProc)_glewLazy_glViewportPositionWScaleNV,
+
+  (_GLEWProc)_glewLazy_glCallCommandListNV,
+  (_GLEWProc)_glewLazy_glCommandListSegmentsNV,
+  (_GLEWProc)_glewLazy_glCompileCommandListNV,
+  (_GLEWProc)_glewLazy_glCreateCommandListsNV,
+  (_GLEWProc)_glewLazy_glCreateStatesNV,
+  (_GLEWProc)_glewLazy_glDeleteCommandListsNV,
+  (_GLEWProc)_glewLazy_glDeleteStatesNV,
+  (_GLEWProc)_glewLazy_glDrawCommandsAddressNV,
+  (_GLEWProc)_glewLazy_glDrawCommandsNV,
+  (_GLEWProc)_glewLazy_glDrawCommandsStatesAddressNV,
+  (_GLEWProc)_glewLazy_glDrawCommandsStatesNV,
+  (_GLEWProc)_glewLazy_glGetCommandHeaderNV,
+  (_GLEWProc)_glewLazy_glGetStageIndexNV,
+  (_GLEWProc)_glewLazy_glIsCommandListNV,
+  (_GLEWProc)_glewLazy_glIsStateNV,
+  (_GLEWProc)_glewLazy_glListDrawCommandsStatesClientNV,
+  (_GLEWProc)_glewLazy_glStateCaptureNV,
+
+  (_GLEWProc)_glewLazy_glBeginConditionalRenderNV,
+  (_GLEWProc)_glewLazy_glEndConditionalRenderNV,
+
+  (_GLEWProc)_glewLazy_glSubpixelPrecisionBiasNV,
+
+  (_GLEWProc)_glewLazy_glConservativeRasterParameterfNV,
+
+  (_GLEWProc)_glewLazy_glConservativeRasterParameteriNV,
+
+  (_GLEWProc)_glewLazy_glCopyBufferSubDataNV,
+
+  (_GLEWProc)_glewLazy_glCopyImageSubDataNV,
+
+  (_GLEWProc)_glewLazy_glClearDepthdNV,
+  (_GLEWProc)_glewLazy_glDepthBoundsdNV,
+  (_GLEWProc)_glewLazy_glDepthRangedNV,
+
+  (_GLEWProc)_glewLazy_glDrawBuffersNV,
+
+  (_GLEWProc)_glewLazy_glDrawArraysInstancedNV,
+  (_GLEWProc)_glewLazy_glDrawElementsInstancedNV,
+
+  (_GLEWProc)_glewLazy_glDrawTextureNV,
+
+  (_GLEWProc)_glewLazy_glDrawVkImageNV,
+  (_GLEWProc)_glewLazy_glGetVkProcAddrNV,
+  (_GLEWProc)_glewLazy_glSignalVkFenceNV,
+  (_GLEWProc)_glewLazy_glSignalVkSemaphoreNV,
+  (_GLEWProc)_glewLazy_glWaitVkSemaphoreNV,
+
+  (_GLEWProc)_glewLazy_glEvalMapsNV,
+  (_GLEWProc)_glewLazy_glGetMapAttribParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetMapAttribParameterivNV,
+  (_GLEWProc)_glewLazy_glGetMapControlPointsNV,
+  (_GLEWProc)_glewLazy_glGetMapParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetMapParameterivNV,
+  (_GLEWProc)_glewLazy_glMapControlPointsNV,
+  (_GLEWProc)_glewLazy_glMapParameterfvNV,
+  (_GLEWProc)_glewLazy_glMapParameterivNV,
+
+  (_GLEWProc)_glewLazy_glGetMultisamplefvNV,
+  (_GLEWProc)_glewLazy_glSampleMaskIndexedNV,
+  (_GLEWProc)_glewLazy_glTexRenderbufferNV,
+
+  (_GLEWProc)_glewLazy_glDeleteFencesNV,
+  (_GLEWProc)_glewLazy_glFinishFenceNV,
+  (_GLEWProc)_glewLazy_glGenFencesNV,
+  (_GLEWProc)_glewLazy_glGetFenceivNV,
+  (_GLEWProc)_glewLazy_glIsFenceNV,
+  (_GLEWProc)_glewLazy_glSetFenceNV,
+  (_GLEWProc)_glewLazy_glTestFenceNV,
+
+  (_GLEWProc)_glewLazy_glFragmentCoverageColorNV,
+
+  (_GLEWProc)_glewLazy_glGetProgramNamedParameterdvNV,
+  (_GLEWProc)_glewLazy_glGetProgramNamedParameterfvNV,
+  (_GLEWProc)_glewLazy_glProgramNamedParameter4dNV,
+  (_GLEWProc)_glewLazy_glProgramNamedParameter4dvNV,
+  (_GLEWProc)_glewLazy_glProgramNamedParameter4fNV,
+  (_GLEWProc)_glewLazy_glProgramNamedParameter4fvNV,
+
+  (_GLEWProc)_glewLazy_glBlitFramebufferNV,
+
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleNV,
+
+  (_GLEWProc)_glewLazy_glRenderbufferStorageMultisampleCoverageNV,
+
+  (_GLEWProc)_glewLazy_glProgramVertexLimitNV,
+
+  (_GLEWProc)_glewLazy_glMulticastBarrierNV,
+  (_GLEWProc)_glewLazy_glMulticastBlitFramebufferNV,
+  (_GLEWProc)_glewLazy_glMulticastBufferSubDataNV,
+  (_GLEWProc)_glewLazy_glMulticastCopyBufferSubDataNV,
+  (_GLEWProc)_glewLazy_glMulticastCopyImageSubDataNV,
+  (_GLEWProc)_glewLazy_glMulticastFramebufferSampleLocationsfvNV,
+  (_GLEWProc)_glewLazy_glMulticastGetQueryObjecti64vNV,
+  (_GLEWProc)_glewLazy_glMulticastGetQueryObjectivNV,
+  (_GLEWProc)_glewLazy_glMulticastGetQueryObjectui64vNV,
+  (_GLEWProc)_glewLazy_glMulticastGetQueryObjectuivNV,
+  (_GLEWProc)_glewLazy_glMulticastWaitSyncNV,
+  (_GLEWProc)_glewLazy_glRenderGpuMaskNV,
+
+  (_GLEWProc)_glewLazy_glProgramEnvParameterI4iNV,
+  (_GLEWProc)_glewLazy_glProgramEnvParameterI4ivNV,
+  (_GLEWProc)_glewLazy_glProgramEnvParameterI4uiNV,
+  (_GLEWProc)_glewLazy_glProgramEnvParameterI4uivNV,
+  (_GLEWProc)_glewLazy_glProgramEnvParametersI4ivNV,
+  (_GLEWProc)_glewLazy_glProgramEnvParametersI4uivNV,
+  (_GLEWProc)_glewLazy_glProgramLocalParameterI4iNV,
+  (_GLEWProc)_glewLazy_glProgramLocalParameterI4ivNV,
+  (_GLEWProc)_glewLazy_glProgramLocalParameterI4uiNV,
+  (_GLEWProc)_glewLazy_glProgramLocalParameterI4uivNV,
+  (_GLEWProc)_glewLazy_glProgramLocalParametersI4ivNV,
+  (_GLEWProc)_glewLazy_glProgramLocalParametersI4uivNV,
+
+  (_GLEWProc)_glewLazy_glGetUniformi64vNV,
+  (_GLEWProc)_glewLazy_glGetUniformui64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform1i64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform1i64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform1ui64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform1ui64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform2i64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform2i64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform2ui64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform2ui64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform3i64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform3i64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform3ui64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform3ui64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform4i64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform4i64vNV,
+  (_GLEWProc)_glewLazy_glProgramUniform4ui64NV,
+  (_GLEWProc)_glewLazy_glProgramUniform4ui64vNV,
+  (_GLEWProc)_glewLazy_glUniform1i64NV,
+  (_GLEWProc)_glewLazy_glUniform1i64vNV,
+  (_GLEWProc)_glewLazy_glUniform1ui64NV,
+  (_GLEWProc)_glewLazy_glUniform1ui64vNV,
+  (_GLEWProc)_glewLazy_glUniform2i64NV,
+  (_GLEWProc)_glewLazy_glUniform2i64vNV,
+  (_GLEWProc)_glewLazy_glUniform2ui64NV,
+  (_GLEWProc)_glewLazy_glUniform2ui64vNV,
+  (_GLEWProc)_glewLazy_glUniform3i64NV,
+  (_GLEWProc)_glewLazy_glUniform3i64vNV,
+  (_GLEWProc)_glewLazy_glUniform3ui64NV,
+  (_GLEWProc)_glewLazy_glUniform3ui64vNV,
+  (_GLEWProc)_glewLazy_glUniform4i64NV,
+  (_GLEWProc)_glewLazy_glUniform4i64vNV,
+  (_GLEWProc)_glewLazy_glUniform4ui64NV,
+  (_GLEWProc)_glewLazy_glUniform4ui64vNV,
+
+  (_GLEWProc)_glewLazy_glColor3hNV,
+  (_GLEWProc)_glewLazy_glColor3hvNV,
+  (_GLEWProc)_glewLazy_glColor4hNV,
+  (_GLEWProc)_glewLazy_glColor4hvNV,
+  (_GLEWProc)_glewLazy_glFogCoordhNV,
+  (_GLEWProc)_glewLazy_glFogCoordhvNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1hNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord1hvNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2hNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord2hvNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3hNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord3hvNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4hNV,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4hvNV,
+  (_GLEWProc)_glewLazy_glNormal3hNV,
+  (_GLEWProc)_glewLazy_glNormal3hvNV,
+  (_GLEWProc)_glewLazy_glSecondaryColor3hNV,
+  (_GLEWProc)_glewLazy_glSecondaryColor3hvNV,
+  (_GLEWProc)_glewLazy_glTexCoord1hNV,
+  (_GLEWProc)_glewLazy_glTexCoord1hvNV,
+  (_GLEWProc)_glewLazy_glTexCoord2hNV,
+  (_GLEWProc)_glewLazy_glTexCoord2hvNV,
+  (_GLEWProc)_glewLazy_glTexCoord3hNV,
+  (_GLEWProc)_glewLazy_glTexCoord3hvNV,
+  (_GLEWProc)_glewLazy_glTexCoord4hNV,
+  (_GLEWProc)_glewLazy_glTexCoord4hvNV,
+  (_GLEWProc)_glewLazy_glVertex2hNV,
+  (_GLEWProc)_glewLazy_glVertex2hvNV,
+  (_GLEWProc)_glewLazy_glVertex3hNV,
+  (_GLEWProc)_glewLazy_glVertex3hvNV,
+  (_GLEWProc)_glewLazy_glVertex4hNV,
+  (_GLEWProc)_glewLazy_glVertex4hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1hNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2hNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3hNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4hNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs1hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs2hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs3hvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs4hvNV,
+  (_GLEWProc)_glewLazy_glVertexWeighthNV,
+  (_GLEWProc)_glewLazy_glVertexWeighthvNV,
+
+  (_GLEWProc)_glewLazy_glVertexAttribDivisorNV,
+
+  (_GLEWProc)_glewLazy_glGetInternalformatSampleivNV,
+
+  (_GLEWProc)_glewLazy_glBufferAttachMemoryNV,
+  (_GLEWProc)_glewLazy_glGetMemoryObjectDetachedResourcesuivNV,
+  (_GLEWProc)_glewLazy_glNamedBufferAttachMemoryNV,
+  (_GLEWProc)_glewLazy_glResetMemoryObjectParameterNV,
+  (_GLEWProc)_glewLazy_glTexAttachMemoryNV,
+  (_GLEWProc)_glewLazy_glTextureAttachMemoryNV,
+
+  (_GLEWProc)_glewLazy_glDrawMeshTasksIndirectNV,
+  (_GLEWProc)_glewLazy_glDrawMeshTasksNV,
+  (_GLEWProc)_glewLazy_glMultiDrawMeshTasksIndirectCountNV,
+  (_GLEWProc)_glewLazy_glMultiDrawMeshTasksIndirectNV,
+
+  (_GLEWProc)_glewLazy_glUniformMatrix2x3fvNV,
+  (_GLEWProc)_glewLazy_glUniformMatrix2x4fvNV,
+  (_GLEWProc)_glewLazy_glUniformMatrix3x2fvNV,
+  (_GLEWProc)_glewLazy_glUniformMatrix3x4fvNV,
+  (_GLEWProc)_glewLazy_glUniformMatrix4x2fvNV,
+  (_GLEWProc)_glewLazy_glUniformMatrix4x3fvNV,
+
+  (_GLEWProc)_glewLazy_glBeginOcclusionQueryNV,
+  (_GLEWProc)_glewLazy_glDeleteOcclusionQueriesNV,
+  (_GLEWProc)_glewLazy_glEndOcclusionQueryNV,
+  (_GLEWProc)_glewLazy_glGenOcclusionQueriesNV,
+  (_GLEWProc)_glewLazy_glGetOcclusionQueryivNV,
+  (_GLEWProc)_glewLazy_glGetOcclusionQueryuivNV,
+  (_GLEWProc)_glewLazy_glIsOcclusionQueryNV,
+
+  (_GLEWProc)_glewLazy_glProgramBufferParametersIivNV,
+  (_GLEWProc)_glewLazy_glProgramBufferParametersIuivNV,
+  (_GLEWProc)_glewLazy_glProgramBufferParametersfvNV,
+
+  (_GLEWProc)_glewLazy_glCopyPathNV,
+  (_GLEWProc)_glewLazy_glCoverFillPathInstancedNV,
+  (_GLEWProc)_glewLazy_glCoverFillPathNV,
+  (_GLEWProc)_glewLazy_glCoverStrokePathInstancedNV,
+  (_GLEWProc)_glewLazy_glCoverStrokePathNV,
+  (_GLEWProc)_glewLazy_glDeletePathsNV,
+  (_GLEWProc)_glewLazy_glGenPathsNV,
+  (_GLEWProc)_glewLazy_glGetPathColorGenfvNV,
+  (_GLEWProc)_glewLazy_glGetPathColorGenivNV,
+  (_GLEWProc)_glewLazy_glGetPathCommandsNV,
+  (_GLEWProc)_glewLazy_glGetPathCoordsNV,
+  (_GLEWProc)_glewLazy_glGetPathDashArrayNV,
+  (_GLEWProc)_glewLazy_glGetPathLengthNV,
+  (_GLEWProc)_glewLazy_glGetPathMetricRangeNV,
+  (_GLEWProc)_glewLazy_glGetPathMetricsNV,
+  (_GLEWProc)_glewLazy_glGetPathParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetPathParameterivNV,
+  (_GLEWProc)_glewLazy_glGetPathSpacingNV,
+  (_GLEWProc)_glewLazy_glGetPathTexGenfvNV,
+  (_GLEWProc)_glewLazy_glGetPathTexGenivNV,
+  (_GLEWProc)_glewLazy_glGetProgramResourcefvNV,
+  (_GLEWProc)_glewLazy_glInterpolatePathsNV,
+  (_GLEWProc)_glewLazy_glIsPathNV,
+  (_GLEWProc)_glewLazy_glIsPointInFillPathNV,
+  (_GLEWProc)_glewLazy_glIsPointInStrokePathNV,
+  (_GLEWProc)_glewLazy_glMatrixLoad3x2fNV,
+  (_GLEWProc)_glewLazy_glMatrixLoad3x3fNV,
+  (_GLEWProc)_glewLazy_glMatrixLoadTranspose3x3fNV,
+  (_GLEWProc)_glewLazy_glMatrixMult3x2fNV,
+  (_GLEWProc)_glewLazy_glMatrixMult3x3fNV,
+  (_GLEWProc)_glewLazy_glMatrixMultTranspose3x3fNV,
+  (_GLEWProc)_glewLazy_glPathColorGenNV,
+  (_GLEWProc)_glewLazy_glPathCommandsNV,
+  (_GLEWProc)_glewLazy_glPathCoordsNV,
+  (_GLEWProc)_glewLazy_glPathCoverDepthFuncNV,
+  (_GLEWProc)_glewLazy_glPathDashArrayNV,
+  (_GLEWProc)_glewLazy_glPathFogGenNV,
+  (_GLEWProc)_glewLazy_glPathGlyphIndexArrayNV,
+  (_GLEWProc)_glewLazy_glPathGlyphIndexRangeNV,
+  (_GLEWProc)_glewLazy_glPathGlyphRangeNV,
+  (_GLEWProc)_glewLazy_glPathGlyphsNV,
+  (_GLEWProc)_glewLazy_glPathMemoryGlyphIndexArrayNV,
+  (_GLEWProc)_glewLazy_glPathParameterfNV,
+  (_GLEWProc)_glewLazy_glPathParameterfvNV,
+  (_GLEWProc)_glewLazy_glPathParameteriNV,
+  (_GLEWProc)_glewLazy_glPathParameterivNV,
+  (_GLEWProc)_glewLazy_glPathStencilDepthOffsetNV,
+  (_GLEWProc)_glewLazy_glPathStencilFuncNV,
+  (_GLEWProc)_glewLazy_glPathStringNV,
+  (_GLEWProc)_glewLazy_glPathSubCommandsNV,
+  (_GLEWProc)_glewLazy_glPathSubCoordsNV,
+  (_GLEWProc)_glewLazy_glPathTexGenNV,
+  (_GLEWProc)_glewLazy_glPointAlongPathNV,
+  (_GLEWProc)_glewLazy_glProgramPathFragmentInputGenNV,
+  (_GLEWProc)_glewLazy_glStencilFillPathInstancedNV,
+  (_GLEWProc)_glewLazy_glStencilFillPathNV,
+  (_GLEWProc)_glewLazy_glStencilStrokePathInstancedNV,
+  (_GLEWProc)_glewLazy_glStencilStrokePathNV,
+  (_GLEWProc)_glewLazy_glStencilThenCoverFillPathInstancedNV,
+  (_GLEWProc)_glewLazy_glStencilThenCoverFillPathNV,
+  (_GLEWProc)_glewLazy_glStencilThenCoverStrokePathInstancedNV,
+  (_GLEWProc)_glewLazy_glStencilThenCoverStrokePathNV,
+  (_GLEWProc)_glewLazy_glTransformPathNV,
+  (_GLEWProc)_glewLazy_glWeightPathsNV,
+
+  (_GLEWProc)_glewLazy_glFlushPixelDataRangeNV,
+  (_GLEWProc)_glewLazy_glPixelDataRangeNV,
+
+  (_GLEWProc)_glewLazy_glPointParameteriNV,
+  (_GLEWProc)_glewLazy_glPointParameterivNV,
+
+  (_GLEWProc)_glewLazy_glPolygonModeNV,
+
+  (_GLEWProc)_glewLazy_glGetVideoi64vNV,
+  (_GLEWProc)_glewLazy_glGetVideoivNV,
+  (_GLEWProc)_glewLazy_glGetVideoui64vNV,
+  (_GLEWProc)_glewLazy_glGetVideouivNV,
+  (_GLEWProc)_glewLazy_glPresentFrameDualFillNV,
+  (_GLEWProc)_glewLazy_glPresentFrameKeyedNV,
+
+  (_GLEWProc)_glewLazy_glPrimitiveRestartIndexNV,
+  (_GLEWProc)_glewLazy_glPrimitiveRestartNV,
+
+  (_GLEWProc)_glewLazy_glReadBufferNV,
+
+  (_GLEWProc)_glewLazy_glCombinerInputNV,
+  (_GLEWProc)_glewLazy_glCombinerOutputNV,
+  (_GLEWProc)_glewLazy_glCombinerParameterfNV,
+  (_GLEWProc)_glewLazy_glCombinerParameterfvNV,
+  (_GLEWProc)_glewLazy_glCombinerParameteriNV,
+  (_GLEWProc)_glewLazy_glCombinerParameterivNV,
+  (_GLEWProc)_glewLazy_glFinalCombinerInputNV,
+  (_GLEWProc)_glewLazy_glGetCombinerInputParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetCombinerInputParameterivNV,
+  (_GLEWProc)_glewLazy_glGetCombinerOutputParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetCombinerOutputParameterivNV,
+  (_GLEWProc)_glewLazy_glGetFinalCombinerInputParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetFinalCombinerInputParameterivNV,
+
+  (_GLEWProc)_glewLazy_glCombinerStageParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetCombinerStageParameterfvNV,
+
+  (_GLEWProc)_glewLazy_glFramebufferSampleLocationsfvNV,
+  (_GLEWProc)_glewLazy_glNamedFramebufferSampleLocationsfvNV,
+  (_GLEWProc)_glewLazy_glResolveDepthValuesNV,
+
+  (_GLEWProc)_glewLazy_glScissorExclusiveArrayvNV,
+  (_GLEWProc)_glewLazy_glScissorExclusiveNV,
+
+  (_GLEWProc)_glewLazy_glGetBufferParameterui64vNV,
+  (_GLEWProc)_glewLazy_glGetIntegerui64vNV,
+  (_GLEWProc)_glewLazy_glGetNamedBufferParameterui64vNV,
+  (_GLEWProc)_glewLazy_glIsBufferResidentNV,
+  (_GLEWProc)_glewLazy_glIsNamedBufferResidentNV,
+  (_GLEWProc)_glewLazy_glMakeBufferNonResidentNV,
+  (_GLEWProc)_glewLazy_glMakeBufferResidentNV,
+  (_GLEWProc)_glewLazy_glMakeNamedBufferNonResidentNV,
+  (_GLEWProc)_glewLazy_glMakeNamedBufferResidentNV,
+  (_GLEWProc)_glewLazy_glProgramUniformui64NV,
+  (_GLEWProc)_glewLazy_glProgramUniformui64vNV,
+  (_GLEWProc)_glewLazy_glUniformui64NV,
+  (_GLEWProc)_glewLazy_glUniformui64vNV,
+
+  (_GLEWProc)_glewLazy_glBindShadingRateImageNV,
+  (_GLEWProc)_glewLazy_glGetShadingRateImagePaletteNV,
+  (_GLEWProc)_glewLazy_glGetShadingRateSampleLocationivNV,
+  (_GLEWProc)_glewLazy_glShadingRateImageBarrierNV,
+  (_GLEWProc)_glewLazy_glShadingRateImagePaletteNV,
+  (_GLEWProc)_glewLazy_glShadingRateSampleOrderCustomNV,
+
+  (_GLEWProc)_glewLazy_glCompressedTexImage3DNV,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage3DNV,
+  (_GLEWProc)_glewLazy_glCopyTexSubImage3DNV,
+  (_GLEWProc)_glewLazy_glFramebufferTextureLayerNV,
+  (_GLEWProc)_glewLazy_glTexImage3DNV,
+  (_GLEWProc)_glewLazy_glTexSubImage3DNV,
+
+  (_GLEWProc)_glewLazy_glTextureBarrierNV,
+
+  (_GLEWProc)_glewLazy_glTexImage2DMultisampleCoverageNV,
+  (_GLEWProc)_glewLazy_glTexImage3DMultisampleCoverageNV,
+  (_GLEWProc)_glewLazy_glTextureImage2DMultisampleCoverageNV,
+  (_GLEWProc)_glewLazy_glTextureImage2DMultisampleNV,
+  (_GLEWProc)_glewLazy_glTextureImage3DMultisampleCoverageNV,
+  (_GLEWProc)_glewLazy_glTextureImage3DMultisampleNV,
+
+  (_GLEWProc)_glewLazy_glActiveVaryingNV,
+  (_GLEWProc)_glewLazy_glBeginTransformFeedbackNV,
+  (_GLEWProc)_glewLazy_glBindBufferBaseNV,
+  (_GLEWProc)_glewLazy_glBindBufferOffsetNV,
+  (_GLEWProc)_glewLazy_glBindBufferRangeNV,
+  (_GLEWProc)_glewLazy_glEndTransformFeedbackNV,
+  (_GLEWProc)_glewLazy_glGetActiveVaryingNV,
+  (_GLEWProc)_glewLazy_glGetTransformFeedbackVaryingNV,
+  (_GLEWProc)_glewLazy_glGetVaryingLocationNV,
+  (_GLEWProc)_glewLazy_glTransformFeedbackAttribsNV,
+  (_GLEWProc)_glewLazy_glTransformFeedbackVaryingsNV,
+
+  (_GLEWProc)_glewLazy_glBindTransformFeedbackNV,
+  (_GLEWProc)_glewLazy_glDeleteTransformFeedbacksNV,
+  (_GLEWProc)_glewLazy_glDrawTransformFeedbackNV,
+  (_GLEWProc)_glewLazy_glGenTransformFeedbacksNV,
+  (_GLEWProc)_glewLazy_glIsTransformFeedbackNV,
+  (_GLEWProc)_glewLazy_glPauseTransformFeedbackNV,
+  (_GLEWProc)_glewLazy_glResumeTransformFeedbackNV,
+
+  (_GLEWProc)_glewLazy_glVDPAUFiniNV,
+  (_GLEWProc)_glewLazy_glVDPAUGetSurfaceivNV,
+  (_GLEWProc)_glewLazy_glVDPAUInitNV,
+  (_GLEWProc)_glewLazy_glVDPAUIsSurfaceNV,
+  (_GLEWProc)_glewLazy_glVDPAUMapSurfacesNV,
+  (_GLEWProc)_glewLazy_glVDPAURegisterOutputSurfaceNV,
+  (_GLEWProc)_glewLazy_glVDPAURegisterVideoSurfaceNV,
+  (_GLEWProc)_glewLazy_glVDPAUSurfaceAccessNV,
+  (_GLEWProc)_glewLazy_glVDPAUUnmapSurfacesNV,
+  (_GLEWProc)_glewLazy_glVDPAUUnregisterSurfaceNV,
+
+  (_GLEWProc)_glewLazy_glVDPAURegisterVideoSurfaceWithPictureStructureNV,
+
+  (_GLEWProc)_glewLazy_glFlushVertexArrayRangeNV,
+  (_GLEWProc)_glewLazy_glVertexArrayRangeNV,
+
+  (_GLEWProc)_glewLazy_glGetVertexAttribLi64vNV,
+  (_GLEWProc)_glewLazy_glGetVertexAttribLui64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL1i64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL1i64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL1ui64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL1ui64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL2i64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL2i64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL2ui64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL2ui64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL3i64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL3i64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL3ui64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL3ui64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL4i64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL4i64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribL4ui64NV,
+  (_GLEWProc)_glewLazy_glVertexAttribL4ui64vNV,
+  (_GLEWProc)_glewLazy_glVertexAttribLFormatNV,
+
+  (_GLEWProc)_glewLazy_glBufferAddressRangeNV,
+  (_GLEWProc)_glewLazy_glColorFormatNV,
+  (_GLEWProc)_glewLazy_glEdgeFlagFormatNV,
+  (_GLEWProc)_glewLazy_glFogCoordFormatNV,
+  (_GLEWProc)_glewLazy_glGetIntegerui64i_vNV,
+  (_GLEWProc)_glewLazy_glIndexFormatNV,
+  (_GLEWProc)_glewLazy_glNormalFormatNV,
+  (_GLEWProc)_glewLazy_glSecondaryColorFormatNV,
+  (_GLEWProc)_glewLazy_glTexCoordFormatNV,
+  (_GLEWProc)_glewLazy_glVertexAttribFormatNV,
+  (_GLEWProc)_glewLazy_glVertexAttribIFormatNV,
+  (_GLEWProc)_glewLazy_glVertexFormatNV,
+
+  (_GLEWProc)_glewLazy_glAreProgramsResidentNV,
+  (_GLEWProc)_glewLazy_glBindProgramNV,
+  (_GLEWProc)_glewLazy_glDeleteProgramsNV,
+  (_GLEWProc)_glewLazy_glExecuteProgramNV,
+  (_GLEWProc)_glewLazy_glGenProgramsNV,
+  (_GLEWProc)_glewLazy_glGetProgramParameterdvNV,
+  (_GLEWProc)_glewLazy_glGetProgramParameterfvNV,
+  (_GLEWProc)_glewLazy_glGetProgramStringNV,
+  (_GLEWProc)_glewLazy_glGetProgramivNV,
+  (_GLEWProc)_glewLazy_glGetTrackMatrixivNV,
+  (_GLEWProc)_glewLazy_glGetVertexAttribPointervNV,
+  (_GLEWProc)_glewLazy_glGetVertexAttribdvNV,
+  (_GLEWProc)_glewLazy_glGetVertexAttribfvNV,
+  (_GLEWProc)_glewLazy_glGetVertexAttribivNV,
+  (_GLEWProc)_glewLazy_glIsProgramNV,
+  (_GLEWProc)_glewLazy_glLoadProgramNV,
+  (_GLEWProc)_glewLazy_glProgramParameter4dNV,
+  (_GLEWProc)_glewLazy_glProgramParameter4dvNV,
+  (_GLEWProc)_glewLazy_glProgramParameter4fNV,
+  (_GLEWProc)_glewLazy_glProgramParameter4fvNV,
+  (_GLEWProc)_glewLazy_glProgramParameters4dvNV,
+  (_GLEWProc)_glewLazy_glProgramParameters4fvNV,
+  (_GLEWProc)_glewLazy_glRequestResidentProgramsNV,
+  (_GLEWProc)_glewLazy_glTrackMatrixNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1dNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1fNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1sNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib1svNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2dNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2fNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2sNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib2svNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3dNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3fNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3sNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib3svNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4dNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4fNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4sNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4svNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4ubNV,
+  (_GLEWProc)_glewLazy_glVertexAttrib4ubvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribPointerNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs1dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs1fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs1svNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs2dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs2fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs2svNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs3dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs3fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs3svNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs4dvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs4fvNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs4svNV,
+  (_GLEWProc)_glewLazy_glVertexAttribs4ubvNV,
+
+  (_GLEWProc)_glewLazy_glBeginVideoCaptureNV,
+  (_GLEWProc)_glewLazy_glBindVideoCaptureStreamBufferNV,
+  (_GLEWProc)_glewLazy_glBindVideoCaptureStreamTextureNV,
+  (_GLEWProc)_glewLazy_glEndVideoCaptureNV,
+  (_GLEWProc)_glewLazy_glGetVideoCaptureStreamdvNV,
+  (_GLEWProc)_glewLazy_glGetVideoCaptureStreamfvNV,
+  (_GLEWProc)_glewLazy_glGetVideoCaptureStreamivNV,
+  (_GLEWProc)_glewLazy_glGetVideoCaptureivNV,
+  (_GLEWProc)_glewLazy_glVideoCaptureNV,
+  (_GLEWProc)_glewLazy_glVideoCaptureStreamParameterdvNV,
+  (_GLEWProc)_glewLazy_glVideoCaptureStreamParameterfvNV,
+  (_GLEWProc)_glewLazy_glVideoCaptureStreamParameterivNV,
+
+  (_GLEWProc)_glewLazy_glDepthRangeArrayfvNV,
+  (_GLEWProc)_glewLazy_glDepthRangeIndexedfNV,
+  (_GLEWProc)_glewLazy_glDisableiNV,
+  (_GLEWProc)_glewLazy_glEnableiNV,
+  (_GLEWProc)_glewLazy_glGetFloati_vNV,
+  (_GLEWProc)_glewLazy_glIsEnablediNV,
+  (_GLEWProc)_glewLazy_glScissorArrayvNV,
+  (_GLEWProc)_glewLazy_glScissorIndexedNV,
+  (_GLEWProc)_glewLazy_glScissorIndexedvNV,
+  (_GLEWProc)_glewLazy_glViewportArrayvNV,
+  (_GLEWProc)_glewLazy_glViewportIndexedfNV,
+  (_GLEWProc)_glewLazy_glViewportIndexedfvNV,
+
+  (_GLEWProc)_glewLazy_glViewportSwizzleNV,
+
+  (_GLEWProc)_glewLazy_glEGLImageTargetRenderbufferStorageOES,
+  (_GLEWProc)_glewLazy_glEGLImageTargetTexture2DOES,
+
+  (_GLEWProc)_glewLazy_glBlendEquationSeparateOES,
+
+  (_GLEWProc)_glewLazy_glBlendFuncSeparateOES,
+
+  (_GLEWProc)_glewLazy_glBlendEquationOES,
+
+  (_GLEWProc)_glewLazy_glCopyImageSubDataOES,
+
+  (_GLEWProc)_glewLazy_glBlendEquationSeparateiOES,
+  (_GLEWProc)_glewLazy_glBlendEquationiOES,
+  (_GLEWProc)_glewLazy_glBlendFuncSeparateiOES,
+  (_GLEWProc)_glewLazy_glBlendFunciOES,
+  (_GLEWProc)_glewLazy_glColorMaskiOES,
+  (_GLEWProc)_glewLazy_glDisableiOES,
+  (_GLEWProc)_glewLazy_glEnableiOES,
+  (_GLEWProc)_glewLazy_glIsEnablediOES,
+
+  (_GLEWProc)_glewLazy_glBindFramebufferOES,
+  (_GLEWProc)_glewLazy_glBindRenderbufferOES,
+  (_GLEWProc)_glewLazy_glCheckFramebufferStatusOES,
+  (_GLEWProc)_glewLazy_glDeleteFramebuffersOES,
+  (_GLEWProc)_glewLazy_glDeleteRenderbuffersOES,
+  (_GLEWProc)_glewLazy_glFramebufferRenderbufferOES,
+  (_GLEWProc)_glewLazy_glFramebufferTexture2DOES,
+  (_GLEWProc)_glewLazy_glGenFramebuffersOES,
+  (_GLEWProc)_glewLazy_glGenRenderbuffersOES,
+  (_GLEWProc)_glewLazy_glGenerateMipmapOES,
+  (_GLEWProc)_glewLazy_glGetFramebufferAttachmentParameterivOES,
+  (_GLEWProc)_glewLazy_glGetRenderbufferParameterivOES,
+  (_GLEWProc)_glewLazy_glIsFramebufferOES,
+  (_GLEWProc)_glewLazy_glIsRenderbufferOES,
+  (_GLEWProc)_glewLazy_glRenderbufferStorageOES,
+
+  (_GLEWProc)_glewLazy_glGetProgramBinaryOES,
+  (_GLEWProc)_glewLazy_glProgramBinaryOES,
+
+  (_GLEWProc)_glewLazy_glGetBufferPointervOES,
+  (_GLEWProc)_glewLazy_glMapBufferOES,
+  (_GLEWProc)_glewLazy_glUnmapBufferOES,
+
+  (_GLEWProc)_glewLazy_glCurrentPaletteMatrixOES,
+  (_GLEWProc)_glewLazy_glMatrixIndexPointerOES,
+  (_GLEWProc)_glewLazy_glWeightPointerOES,
+
+  (_GLEWProc)_glewLazy_glMinSampleShadingOES,
+
+  (_GLEWProc)_glewLazy_glClearDepthfOES,
+  (_GLEWProc)_glewLazy_glClipPlanefOES,
+  (_GLEWProc)_glewLazy_glDepthRangefOES,
+  (_GLEWProc)_glewLazy_glFrustumfOES,
+  (_GLEWProc)_glewLazy_glGetClipPlanefOES,
+  (_GLEWProc)_glewLazy_glOrthofOES,
+
+  (_GLEWProc)_glewLazy_glCompressedTexImage3DOES,
+  (_GLEWProc)_glewLazy_glCompressedTexSubImage3DOES,
+  (_GLEWProc)_glewLazy_glCopyTexSubImage3DOES,
+  (_GLEWProc)_glewLazy_glFramebufferTexture3DOES,
+  (_GLEWProc)_glewLazy_glTexImage3DOES,
+  (_GLEWProc)_glewLazy_glTexSubImage3DOES,
+
+  (_GLEWProc)_glewLazy_glGetSamplerParameterIivOES,
+  (_GLEWProc)_glewLazy_glGetSamplerParameterIuivOES,
+  (_GLEWProc)_glewLazy_glGetTexParameterIivOES,
+  (_GLEWProc)_glewLazy_glGetTexParameterIuivOES,
+  (_GLEWProc)_glewLazy_glSamplerParameterIivOES,
+  (_GLEWProc)_glewLazy_glSamplerParameterIuivOES,
+  (_GLEWProc)_glewLazy_glTexParameterIivOES,
+  (_GLEWProc)_glewLazy_glTexParameterIuivOES,
+
+  (_GLEWProc)_glewLazy_glTexBufferOES,
+  (_GLEWProc)_glewLazy_glTexBufferRangeOES,
+
+  (_GLEWProc)_glewLazy_glGetTexGenfvOES,
+  (_GLEWProc)_glewLazy_glGetTexGenivOES,
+  (_GLEWProc)_glewLazy_glGetTexGenxvOES,
+  (_GLEWProc)_glewLazy_glTexGenfOES,
+  (_GLEWProc)_glewLazy_glTexGenfvOES,
+  (_GLEWProc)_glewLazy_glTexGeniOES,
+  (_GLEWProc)_glewLazy_glTexGenivOES,
+  (_GLEWProc)_glewLazy_glTexGenxOES,
+  (_GLEWProc)_glewLazy_glTexGenxvOES,
+
+  (_GLEWProc)_glewLazy_glTexStorage3DMultisampleOES,
+
+  (_GLEWProc)_glewLazy_glTextureViewOES,
+
+  (_GLEWProc)_glewLazy_glBindVertexArrayOES,
+  (_GLEWProc)_glewLazy_glDeleteVertexArraysOES,
+  (_GLEWProc)_glewLazy_glGenVertexArraysOES,
+  (_GLEWProc)_glewLazy_glIsVertexArrayOES,
+
+  (_GLEWProc)_glewLazy_glFramebufferTextureMultiviewOVR,
+  (_GLEWProc)_glewLazy_glNamedFramebufferTextureMultiviewOVR,
+
+  (_GLEWProc)_glewLazy_glFramebufferTextureMultisampleMultiviewOVR,
+
+  (_GLEWProc)_glewLazy_glAlphaFuncQCOM,
+
+  (_GLEWProc)_glewLazy_glDisableDriverControlQCOM,
+  (_GLEWProc)_glewLazy_glEnableDriverControlQCOM,
+  (_GLEWProc)_glewLazy_glGetDriverControlStringQCOM,
+  (_GLEWProc)_glewLazy_glGetDriverControlsQCOM,
+
+  (_GLEWProc)_glewLazy_glExtGetBufferPointervQCOM,
+  (_GLEWProc)_glewLazy_glExtGetBuffersQCOM,
+  (_GLEWProc)_glewLazy_glExtGetFramebuffersQCOM,
+  (_GLEWProc)_glewLazy_glExtGetRenderbuffersQCOM,
+  (_GLEWProc)_glewLazy_glExtGetTexLevelParameterivQCOM,
+  (_GLEWProc)_glewLazy_glExtGetTexSubImageQCOM,
+  (_GLEWProc)_glewLazy_glExtGetTexturesQCOM,
+  (_GLEWProc)_glewLazy_glExtTexObjectStateOverrideiQCOM,
+
+  (_GLEWProc)_glewLazy_glExtGetProgramBinarySourceQCOM,
+  (_GLEWProc)_glewLazy_glExtGetProgramsQCOM,
+  (_GLEWProc)_glewLazy_glExtGetShadersQCOM,
+  (_GLEWProc)_glewLazy_glExtIsProgramBinaryQCOM,
+
+  (_GLEWProc)_glewLazy_glFramebufferFoveationConfigQCOM,
+  (_GLEWProc)_glewLazy_glFramebufferFoveationParametersQCOM,
+
+  (_GLEWProc)_glewLazy_glFramebufferFetchBarrierQCOM,
+
+  (_GLEWProc)_glewLazy_glTextureFoveationParametersQCOM,
+
+  (_GLEWProc)_glewLazy_glEndTilingQCOM,
+  (_GLEWProc)_glewLazy_glStartTilingQCOM,
+
+  (_GLEWProc)_glewLazy_glAlphaFuncx,
+  (_GLEWProc)_glewLazy_glClearColorx,
+  (_GLEWProc)_glewLazy_glClearDepthx,
+  (_GLEWProc)_glewLazy_glColor4x,
+  (_GLEWProc)_glewLazy_glDepthRangex,
+  (_GLEWProc)_glewLazy_glFogx,
+  (_GLEWProc)_glewLazy_glFogxv,
+  (_GLEWProc)_glewLazy_glFrustumf,
+  (_GLEWProc)_glewLazy_glFrustumx,
+  (_GLEWProc)_glewLazy_glLightModelx,
+  (_GLEWProc)_glewLazy_glLightModelxv,
+  (_GLEWProc)_glewLazy_glLightx,
+  (_GLEWProc)_glewLazy_glLightxv,
+  (_GLEWProc)_glewLazy_glLineWidthx,
+  (_GLEWProc)_glewLazy_glLoadMatrixx,
+  (_GLEWProc)_glewLazy_glMaterialx,
+  (_GLEWProc)_glewLazy_glMaterialxv,
+  (_GLEWProc)_glewLazy_glMultMatrixx,
+  (_GLEWProc)_glewLazy_glMultiTexCoord4x,
+  (_GLEWProc)_glewLazy_glNormal3x,
+  (_GLEWProc)_glewLazy_glOrthof,
+  (_GLEWProc)_glewLazy_glOrthox,
+  (_GLEWProc)_glewLazy_glPointSizex,
+  (_GLEWProc)_glewLazy_glPolygonOffsetx,
+  (_GLEWProc)_glewLazy_glRotatex,
+  (_GLEWProc)_glewLazy_glSampleCoveragex,
+  (_GLEWProc)_glewLazy_glScalex,
+  (_GLEWProc)_glewLazy_glTexEnvx,
+  (_GLEWProc)_glewLazy_glTexEnvxv,
+  (_GLEWProc)_glewLazy_glTexParameterx,
+  (_GLEWProc)_glewLazy_glTranslatex,
+
+  (_GLEWProc)_glewLazy_glClipPlanef,
+  (_GLEWProc)_glewLazy_glClipPlanex,
+  (_GLEWProc)_glewLazy_glGetClipPlanef,
+  (_GLEWProc)_glewLazy_glGetClipPlanex,
+  (_GLEWProc)_glewLazy_glGetFixedv,
+  (_GLEWProc)_glewLazy_glGetLightxv,
+  (_GLEWProc)_glewLazy_glGetMaterialxv,
+  (_GLEWProc)_glewLazy_glGetTexEnvxv,
+  (_GLEWProc)_glewLazy_glGetTexParameterxv,
+  (_GLEWProc)_glewLazy_glPointParameterx,
+  (_GLEWProc)_glewLazy_glPointParameterxv,
+  (_GLEWProc)_glewLazy_glPointSizePointerOES,
+  (_GLEWProc)_glewLazy_glTexParameterxv,
+
+  (_GLEWProc)_glewLazy_glErrorStringREGAL,
+
+  (_GLEWProc)_glewLazy_glGetExtensionREGAL,
+  (_GLEWProc)_glewLazy_glIsSupportedREGAL,
+
+  (_GLEWProc)_glewLazy_glLogMessageCallbackREGAL,
+
+  (_GLEWProc)_glewLazy_glGetProcAddressREGAL,
+
+  (_GLEWProc)_glewLazy_glDetailTexFuncSGIS,
+  (_GLEWProc)_glewLazy_glGetDetailTexFuncSGIS,
+
+  (_GLEWProc)_glewLazy_glFogFuncSGIS,
+  (_GLEWProc)_glewLazy_glGetFogFuncSGIS,
+
+  (_GLEWProc)_glewLazy_glSampleMaskSGIS,
+  (_GLEWProc)_glewLazy_glSamplePatternSGIS,
+
+  (_GLEWProc)_glewLazy_glInterleavedTextureCoordSetsSGIS,
+  (_GLEWProc)_glewLazy_glSelectTextureCoordSetSGIS,
+  (_GLEWProc)_glewLazy_glSelectTextureSGIS,
+  (_GLEWProc)_glewLazy_glSelectTextureTransformSGIS,
+
+  (_GLEWProc)_glewLazy_glMultisampleSubRectPosSGIS,
+
+  (_GLEWProc)_glewLazy_glGetSharpenTexFuncSGIS,
+  (_GLEWProc)_glewLazy_glSharpenTexFuncSGIS,
+
+  (_GLEWProc)_glewLazy_glTexImage4DSGIS,
+  (_GLEWProc)_glewLazy_glTexSubImage4DSGIS,
+
+  (_GLEWProc)_glewLazy_glGetTexFilterFuncSGIS,
+  (_GLEWProc)_glewLazy_glTexFilterFuncSGIS,
+
+  (_GLEWProc)_glewLazy_glAsyncMarkerSGIX,
+  (_GLEWProc)_glewLazy_glDeleteAsyncMarkersSGIX,
+  (_GLEWProc)_glewLazy_glFinishAsyncSGIX,
+  (_GLEWProc)_glewLazy_glGenAsyncMarkersSGIX,
+  (_GLEWProc)_glewLazy_glIsAsyncMarkerSGIX,
+  (_GLEWProc)_glewLazy_glPollAsyncSGIX,
+
+  (_GLEWProc)_glewLazy_glAddressSpace,
+  (_GLEWProc)_glewLazy_glDataPipe,
+
+  (_GLEWProc)_glewLazy_glFlushRasterSGIX,
+
+  (_GLEWProc)_glewLazy_glFogLayersSGIX,
+  (_GLEWProc)_glewLazy_glGetFogLayersSGIX,
+
+  (_GLEWProc)_glewLazy_glTextureFogSGIX,
+
+  (_GLEWProc)_glewLazy_glFragmentColorMaterialSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightModelfSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightModelfvSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightModeliSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightModelivSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightfSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightfvSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightiSGIX,
+  (_GLEWProc)_glewLazy_glFragmentLightivSGIX,
+  (_GLEWProc)_glewLazy_glFragmentMaterialfSGIX,
+  (_GLEWProc)_glewLazy_glFragmentMaterialfvSGIX,
+  (_GLEWProc)_glewLazy_glFragmentMaterialiSGIX,
+  (_GLEWProc)_glewLazy_glFragmentMaterialivSGIX,
+  (_GLEWProc)_glewLazy_glGetFragmentLightfvSGIX,
+  (_GLEWProc)_glewLazy_glGetFragmentLightivSGIX,
+  (_GLEWProc)_glewLazy_glGetFragmentMaterialfvSGIX,
+  (_GLEWProc)_glewLazy_glGetFragmentMaterialivSGIX,
+
+  (_GLEWProc)_glewLazy_glFrameZoomSGIX,
+
+  (_GLEWProc)_glewLazy_glIglooInterfaceSGIX,
+
+  (_GLEWProc)_glewLazy_glAllocMPEGPredictorsSGIX,
+  (_GLEWProc)_glewLazy_glDeleteMPEGPredictorsSGIX,
+  (_GLEWProc)_glewLazy_glGenMPEGPredictorsSGIX,
+  (_GLEWProc)_glewLazy_glGetMPEGParameterfvSGIX,
+  (_GLEWProc)_glewLazy_glGetMPEGParameterivSGIX,
+  (_GLEWProc)_glewLazy_glGetMPEGPredictorSGIX,
+  (_GLEWProc)_glewLazy_glGetMPEGQuantTableubv,
+  (_GLEWProc)_glewLazy_glIsMPEGPredictorSGIX,
+  (_GLEWProc)_glewLazy_glMPEGPredictorSGIX,
+  (_GLEWProc)_glewLazy_glMPEGQuantTableubv,
+  (_GLEWProc)_glewLazy_glSwapMPEGPredictorsSGIX,
+
+  (_GLEWProc)_glewLazy_glGetNonlinLightfvSGIX,
+  (_GLEWProc)_glewLazy_glGetNonlinMaterialfvSGIX,
+  (_GLEWProc)_glewLazy_glNonlinLightfvSGIX,
+  (_GLEWProc)_glewLazy_glNonlinMaterialfvSGIX,
+
+  (_GLEWProc)_glewLazy_glPixelTexGenSGIX,
+
+  (_GLEWProc)_glewLazy_glDeformSGIX,
+  (_GLEWProc)_glewLazy_glLoadIdentityDeformationMapSGIX,
+
+  (_GLEWProc)_glewLazy_glMeshBreadthSGIX,
+  (_GLEWProc)_glewLazy_glMeshStrideSGIX,
+
+  (_GLEWProc)_glewLazy_glReferencePlaneSGIX,
+
+  (_GLEWProc)_glewLazy_glSpriteParameterfSGIX,
+  (_GLEWProc)_glewLazy_glSpriteParameterfvSGIX,
+  (_GLEWProc)_glewLazy_glSpriteParameteriSGIX,
+  (_GLEWProc)_glewLazy_glSpriteParameterivSGIX,
+
+  (_GLEWProc)_glewLazy_glTagSampleBufferSGIX,
+
+  (_GLEWProc)_glewLazy_glGetVectorOperationSGIX,
+  (_GLEWProc)_glewLazy_glVectorOperationSGIX,
+
+  (_GLEWProc)_glewLazy_glAreVertexArraysResidentSGIX,
+  (_GLEWProc)_glewLazy_glBindVertexArraySGIX,
+  (_GLEWProc)_glewLazy_glDeleteVertexArraysSGIX,
+  (_GLEWProc)_glewLazy_glGenVertexArraysSGIX,
+  (_GLEWProc)_glewLazy_glIsVertexArraySGIX,
+  (_GLEWProc)_glewLazy_glPrioritizeVertexArraysSGIX,
+
+  (_GLEWProc)_glewLazy_glColorTableParameterfvSGI,
+  (_GLEWProc)_glewLazy_glColorTableParameterivSGI,
+  (_GLEWProc)_glewLazy_glColorTableSGI,
+  (_GLEWProc)_glewLazy_glCopyColorTableSGI,
+  (_GLEWProc)_glewLazy_glGetColorTableParameterfvSGI,
+  (_GLEWProc)_glewLazy_glGetColorTableParameterivSGI,
+  (_GLEWProc)_glewLazy_glGetColorTableSGI,
+
+  (_GLEWProc)_glewLazy_glGetPixelTransformParameterfvSGI,
+  (_GLEWProc)_glewLazy_glGetPixelTransformParameterivSGI,
+  (_GLEWProc)_glewLazy_glPixelTransformParameterfSGI,
+  (_GLEWProc)_glewLazy_glPixelTransformParameterfvSGI,
+  (_GLEWProc)_glewLazy_glPixelTransformParameteriSGI,
+  (_GLEWProc)_glewLazy_glPixelTransformParameterivSGI,
+  (_GLEWProc)_glewLazy_glPixelTransformSGI,
+
+  (_GLEWProc)_glewLazy_glFinishTextureSUNX,
+
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactorbSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactordSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactorfSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactoriSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactorsSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactorubSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactoruiSUN,
+  (_GLEWProc)_glewLazy_glGlobalAlphaFactorusSUN,
+
+  (_GLEWProc)_glewLazy_glReadVideoPixelsSUN,
+
+  (_GLEWProc)_glewLazy_glReplacementCodePointerSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeubSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeubvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuivSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeusSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeusvSUN,
+
+  (_GLEWProc)_glewLazy_glColor3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glColor3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glColor4ubVertex2fSUN,
+  (_GLEWProc)_glewLazy_glColor4ubVertex2fvSUN,
+  (_GLEWProc)_glewLazy_glColor4ubVertex3fSUN,
+  (_GLEWProc)_glewLazy_glColor4ubVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiColor3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiColor3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiColor4ubVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiColor4ubVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiTexCoord2fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiTexCoord2fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiVertex3fSUN,
+  (_GLEWProc)_glewLazy_glReplacementCodeuiVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fColor3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fColor3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fColor4ubVertex3fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fColor4ubVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fVertex3fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord2fVertex3fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord4fColor4fNormal3fVertex4fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord4fColor4fNormal3fVertex4fvSUN,
+  (_GLEWProc)_glewLazy_glTexCoord4fVertex4fSUN,
+  (_GLEWProc)_glewLazy_glTexCoord4fVertex4fvSUN,
+
+  (_GLEWProc)_glewLazy_glAddSwapHintRectWIN,
+};
+
+static void _glewLazyInit_GL ()
+{
+  size_t i;
+  for (i = 0; i < sizeof(_glewLazyFunctions) / sizeof(_glewLazyFunctions[0]); ++i)
+    *_glewFunctions[i] = _glewLazyFunctions[i];
+}
+
@@ -0,0 +1,25156 @@
+/*
+** The OpenGL Extension Wrangler Library
+** Copyright (C) 2008-2019, Nigel Stewart <nigels[]users sourceforge net>
+** Copyright (C) 2002-2008, Milan Ikits <milan ikits[]ieee org>
+** Copyright (C) 2002-2008, Marcelo E. Magallon <mmagallo[]debian org>
+** Copyright (C) 2002, Lev Povalahev
+** All rights reserved.
+** 
+** Redistribution and use in source and binary forms, with or without 
+** modification, are permitted provided that the following conditions are met:
+** 
+** * Redistributions of source code must retain the above copyright notice, 
+**   this list of conditions and the following disclaimer.
+** * Redistributions in binary form must reproduce the above copyright notice, 
+**   this list of conditions and the following disclaimer in the documentation 
+**   and/or other materials provided with the distribution.
+** * The name of the author may be used to endorse or promote products 
+**   derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+** THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Included by glew.c if GLEW_PROFILE is defined */
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * Profiling.  If GLEW is built with GLEW_PROFILE, glewInit points every GL
+ * function pointer it resolves at a shim generated by make_profile.pl,
+ * which forwards the call and adds one call and the time it took to the
+ * counters of the calling thread.  A thread allocates its counters on its
+ * first call and pushes them on a list, which glewProfileSnapshot sums up,
+ * so neither calls nor snapshots take a lock.  Only the owning thread
+ * writes its counters, and glewProfileReset records the sums as a baseline
+ * rather than clearing them.  The counters of a thread outlive it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+/* Types extracted from windows.h to avoid polluting the rest of the file,
+   LARGE_INTEGER is a 64-bit union. */
+union _LARGE_INTEGER;
+__declspec(dllimport) int __stdcall QueryPerformanceCounter (union _LARGE_INTEGER* count);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency (union _LARGE_INTEGER* frequency);
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  endif
+#else
+#  include <time.h>
+#endif
+
+#define GLEW_PROFILE_COUNT (sizeof(_glewFunctions) / sizeof(_glewFunctions[0]))
+
+typedef struct _GLEWProfileThreadStruct
+{
+  struct _GLEWProfileThreadStruct* next;
+  GLuint64 counters[2 * GLEW_PROFILE_COUNT];  /* calls and ticks per entry point */
+} _GLEWProfileThread;
+
+static _GLEWProfileThread* _glewProfileThreads = NULL;
+static GLEW_THREAD_LOCAL _GLEWProfileThread* _glewProfileCurrent = NULL;
+static GLuint64 _glewProfileBase[2 * GLEW_PROFILE_COUNT];  /* sums at the last reset */
+
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+#  define _glewProfileLoad(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#  define _glewProfileStore(p, v) __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#else
+#  define _glewProfileLoad(p) (*(volatile GLuint64*)(p))
+#  define _glewProfileStore(p, v) (*(volatile GLuint64*)(p) = (v))
+#endif
+
+static GLuint64 _glewProfileClock (void)
+{
+#if defined(_WIN32)
+  static GLint64 frequency;
+  GLint64 counter;
+  if (frequency == 0)
+    QueryPerformanceFrequency((union _LARGE_INTEGER*)&frequency);
+  QueryPerformanceCounter((union _LARGE_INTEGER*)&counter);
+  return (GLuint64)(counter / frequency) * 1000000000u +
+         (GLuint64)(counter % frequency) * 1000000000u / (GLuint64)frequency;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (GLuint64)ts.tv_sec * 1000000000u + (GLuint64)ts.tv_nsec;
+#endif
+}
+
+/*
+ * The shims read the time stamp counter where there is one, which costs a
+ * fraction of reading the clock, and the snapshots convert the ticks to
+ * nanoseconds at the rate the counter advanced since the first glewInit.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#  define _glewProfileTime() ((GLuint64)__builtin_ia32_rdtsc())
+#else
+#  define _glewProfileTime() _glewProfileClock()
+#endif
+
+static GLuint64 _glewProfileEpoch[2];  /* ticks and nanoseconds at the first glewInit */
+
+static void _glewProfileStart (void)
+{
+  if (_glewProfileEpoch[1] != 0) return;
+  _glewProfileEpoch[0] = _glewProfileTime();
+  _glewProfileEpoch[1] = _glewProfileClock();
+}
+
+static GLuint64 _glewProfileNanoseconds (GLuint64 ticks)
+{
+  const GLuint64 t = _glewProfileTime() - _glewProfileEpoch[0];
+  const GLuint64 ns = _glewProfileClock() - _glewProfileEpoch[1];
+  return t == 0 ? ticks : (GLuint64)((double)ticks * (double)ns / (double)t);
+}
+
+static _GLEWProfileThread* _glewProfileAttach (void)
+{
+  _GLEWProfileThread* t = (_GLEWProfileThread*)calloc(1, sizeof(_GLEWProfileThread));
+  if (t == NULL) return NULL;
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+  t->next = __atomic_load_n(&_glewProfileThreads, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n(&_glewProfileThreads, &t->next, t, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#elif defined(_MSC_VER)
+  do t->next = _glewProfileThreads;
+  while (_InterlockedCompareExchangePointer((void* volatile*)&_glewProfileThreads, t, t->next) != t->next);
+#else
+  t->next = _glewProfileThreads;
+  _glewProfileThreads = t;
+#endif
+  _glewProfileCurrent = t;
+  return t;
+}
+
+/* Count a call of entry point i which started at tick start */
+static void _glewProfileEnd (size_t i, GLuint64 start)
+{
+  const GLuint64 t = _glewProfileTime() - start;
+  _GLEWProfileThread* p = _glewProfileCurrent;
+  if (p == NULL && (p = _glewProfileAttach()) == NULL) return;
+  _glewProfileStore(&p->counters[2*i], p->counters[2*i] + 1);
+  _glewProfileStore(&p->counters[2*i+1], p->counters[2*i+1] + t);
+}
+
+/* Sum the counters of every thread */
+static void _glewProfileSum (GLuint64* sums)
+{
+  const _GLEWProfileThread* p;
+  size_t i;
+  for (i = 0; i < 2 * GLEW_PROFILE_COUNT; ++i)
+    sums[i] = 0;
+#if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+  p = __atomic_load_n(&_glewProfileThreads, __ATOMIC_ACQUIRE);
+#else
+  p = *(_GLEWProfileThread* volatile*)&_glewProfileThreads;
+#endif
+  for (; p != NULL; p = p->next)
+    for (i = 0; i < 2 * GLEW_PROFILE_COUNT; ++i)
+      sums[i] += _glewProfileLoad(&p->counters[i]);
+}
+
+/* C89 printf has no 64-bit conversion */
+static void _glewProfilePrint (FILE* f, GLuint64 n)
+{
+  char s[24];
+  char* p = s + sizeof(s) - 1;
+  *p = '\0';
+  do *--p = (char)('0' + n % 10); while ((n /= 10) != 0);
+  fputs(p, f);
+}
+
+static _GLEWProc _glewProfileTargets[2754];
+
+static const char* const _glewProfileNames[] = {
+  "glCopyTexSubImage3D",
+  "glDrawRangeElements",
+  "glTexImage3D",
+  "glTexSubImage3D",
+  "glActiveTexture",
+  "glClientActiveTexture",
+  "glCompressedTexImage1D",
+  "glCompressedTexImage2D",
+  "glCompressedTexImage3D",
+  "glCompressedTexSubImage1D",
+  "glCompressedTexSubImage2D",
+  "glCompressedTexSubImage3D",
+  "glGetCompressedTexImage",
+  "glLoadTransposeMatrixd",
+  "glLoadTransposeMatrixf",
+  "glMultTransposeMatrixd",
+  "glMultTransposeMatrixf",
+  "glMultiTexCoord1d",
+  "glMultiTexCoord1dv",
+  "glMultiTexCoord1f",
+  "glMultiTexCoord1fv",
+  "glMultiTexCoord1i",
+  "glMultiTexCoord1iv",
+  "glMultiTexCoord1s",
+  "glMultiTexCoord1sv",
+  "glMultiTexCoord2d",
+  "glMultiTexCoord2dv",
+  "glMultiTexCoord2f",
+  "glMultiTexCoord2fv",
+  "glMultiTexCoord2i",
+  "glMultiTexCoord2iv",
+  "glMultiTexCoord2s",
+  "glMultiTexCoord2sv",
+  "glMultiTexCoord3d",
+  "glMultiTexCoord3dv",
+  "glMultiTexCoord3f",
+  "glMultiTexCoord3fv",
+  "glMultiTexCoord3i",
+  "glMultiTexCoord3iv",
+  "glMultiTexCoord3s",
+  "glMultiTexCoord3sv",
+  "glMultiTexCoord4d",
+  "glMultiTexCoord4dv",
+  "glMultiTexCoord4f",
+  "glMultiTexCoord4fv",
+  "glMultiTexCoord4i",
+  "glMultiTexCoord4iv",
+  "glMultiTexCoord4s",
+  "glMultiTexCoord4sv",
+  "glSampleCoverage",
+  "glBlendColor",
+  "glBlendEquation",
+  "glBlendFuncSeparate",
+  "glFogCoordPointer",
+  "glFogCoordd",
+  "glFogCoorddv",
+  "glFogCoordf",
+  "glFogCoordfv",
+  "glMultiDrawArrays",
+  "glMultiDrawElements",
+  "glPointParameterf",
+  "glPointParameterfv",
+  "glPointParameteri",
+  "glPointParameteriv",
+  "glSecondaryColor3b",
+  "glSecondaryColor3bv",
+  "glSecondaryColor3d",
+  "glSecondaryColor3dv",
+  "glSecondaryColor3f",
+  "glSecondaryColor3fv",
+  "glSecondaryColor3i",
+  "glSecondaryColor3iv",
+  "glSecondaryColor3s",
+  "glSecondaryColor3sv",
+  "glSecondaryColor3ub",
+  "glSecondaryColor3ubv",
+  "glSecondaryColor3ui",
+  "glSecondaryColor3uiv",
+  "glSecondaryColor3us",
+  "glSecondaryColor3usv",
+  "glSecondaryColorPointer",
+  "glWindowPos2d",
+  "glWindowPos2dv",
+  "glWindowPos2f",
+  "glWindowPos2fv",
+  "glWindowPos2i",
+  "glWindowPos2iv",
+  "glWindowPos2s",
+  "glWindowPos2sv",
+  "glWindowPos3d",
+  "glWindowPos3dv",
+  "glWindowPos3f",
+  "glWindowPos3fv",
+  "glWindowPos3i",
+  "glWindowPos3iv",
+  "glWindowPos3s",
+  "glWindowPos3sv",
+  "glBeginQuery",
+  "glBindBuffer",
+  "glBufferData",
+  "glBufferSubData",
+  "glDeleteBuffers",
+  "glDeleteQueries",
+  "glEndQuery",
+  "glGenBuffers",
+  "glGenQueries",
+  "glGetBufferParameteriv",
+  "glGetBufferPointerv",
+  "glGetBufferSubData",
+  "glGetQueryObjectiv",
+  "glGetQueryObjectuiv",
+  "glGetQueryiv",
+  "glIsBuffer",
+  "glIsQuery",
+  "glMapBuffer",
+  "glUnmapBuffer",
+  "glAttachShader",
+  "glBindAttribLocation",
+  "glBlendEquationSeparate",
+  "glCompileShader",
+  "glCreateProgram",
+  "glCreateShader",
+  "glDeleteProgram",
+  "glDeleteShader",
+  "glDetachShader",
+  "glDisableVertexAttribArray",
+  "glDrawBuffers",
+  "glEnableVertexAttribArray",
+  "glGetActiveAttrib",
+  "glGetActiveUniform",
+  "glGetAttachedShaders",
+  "glGetAttribLocation",
+  "glGetProgramInfoLog",
+  "glGetProgramiv",
+  "glGetShaderInfoLog",
+  "glGetShaderSource",
+  "glGetShaderiv",
+  "glGetUniformLocation",
+  "glGetUniformfv",
+  "glGetUniformiv",
+  "glGetVertexAttribPointerv",
+  "glGetVertexAttribdv",
+  "glGetVertexAttribfv",
+  "glGetVertexAttribiv",
+  "glIsProgram",
+  "glIsShader",
+  "glLinkProgram",
+  "glShaderSource",
+  "glStencilFuncSeparate",
+  "glStencilMaskSeparate",
+  "glStencilOpSeparate",
+  "glUniform1f",
+  "glUniform1fv",
+  "glUniform1i",
+  "glUniform1iv",
+  "glUniform2f",
+  "glUniform2fv",
+  "glUniform2i",
+  "glUniform2iv",
+  "glUniform3f",
+  "glUniform3fv",
+  "glUniform3i",
+  "glUniform3iv",
+  "glUniform4f",
+  "glUniform4fv",
+  "glUniform4i",
+  "glUniform4iv",
+  "glUniformMatrix2fv",
+  "glUniformMatrix3fv",
+  "glUniformMatrix4fv",
+  "glUseProgram",
+  "glValidateProgram",
+  "glVertexAttrib1d",
+  "glVertexAttrib1dv",
+  "glVertexAttrib1f",
+  "glVertexAttrib1fv",
+  "glVertexAttrib1s",
+  "glVertexAttrib1sv",
+  "glVertexAttrib2d",
+  "glVertexAttrib2dv",
+  "glVertexAttrib2f",
+  "glVertexAttrib2fv",
+  "glVertexAttrib2s",
+  "glVertexAttrib2sv",
+  "glVertexAttrib3d",
+  "glVertexAttrib3dv",
+  "glVertexAttrib3f",
+  "glVertexAttrib3fv",
+  "glVertexAttrib3s",
+  "glVertexAttrib3sv",
+  "glVertexAttrib4Nbv",
+  "glVertexAttrib4Niv",
+  "glVertexAttrib4Nsv",
+  "glVertexAttrib4Nub",
+  "glVertexAttrib4Nubv",
+  "glVertexAttrib4Nuiv",
+  "glVertexAttrib4Nusv",
+  "glVertexAttrib4bv",
+  "glVertexAttrib4d",
+  "glVertexAttrib4dv",
+  "glVertexAttrib4f",
+  "glVertexAttrib4fv",
+  "glVertexAttrib4iv",
+  "glVertexAttrib4s",
+  "glVertexAttrib4sv",
+  "glVertexAttrib4ubv",
+  "glVertexAttrib4uiv",
+  "glVertexAttrib4usv",
+  "glVertexAttribPointer",
+  "glUniformMatrix2x3fv",
+  "glUniformMatrix2x4fv",
+  "glUniformMatrix3x2fv",
+  "glUniformMatrix3x4fv",
+  "glUniformMatrix4x2fv",
+  "glUniformMatrix4x3fv",
+  "glBeginConditionalRender",
+  "glBeginTransformFeedback",
+  "glBindFragDataLocation",
+  "glClampColor",
+  "glClearBufferfi",
+  "glClearBufferfv",
+  "glClearBufferiv",
+  "glClearBufferuiv",
+  "glColorMaski",
+  "glDisablei",
+  "glEnablei",
+  "glEndConditionalRender",
+  "glEndTransformFeedback",
+  "glGetBooleani_v",
+  "glGetFragDataLocation",
+  "glGetStringi",
+  "glGetTexParameterIiv",
+  "glGetTexParameterIuiv",
+  "glGetTransformFeedbackVarying",
+  "glGetUniformuiv",
+  "glGetVertexAttribIiv",
+  "glGetVertexAttribIuiv",
+  "glIsEnabledi",
+  "glTexParameterIiv",
+  "glTexParameterIuiv",
+  "glTransformFeedbackVaryings",
+  "glUniform1ui",
+  "glUniform1uiv",
+  "glUniform2ui",
+  "glUniform2uiv",
+  "glUniform3ui",
+  "glUniform3uiv",
+  "glUniform4ui",
+  "glUniform4uiv",
+  "glVertexAttribI1i",
+  "glVertexAttribI1iv",
+  "glVertexAttribI1ui",
+  "glVertexAttribI1uiv",
+  "glVertexAttribI2i",
+  "glVertexAttribI2iv",
+  "glVertexAttribI2ui",
+  "glVertexAttribI2uiv",
+  "glVertexAttribI3i",
+  "glVertexAttribI3iv",
+  "glVertexAttribI3ui",
+  "glVertexAttribI3uiv",
+  "glVertexAttribI4bv",
+  "glVertexAttribI4i",
+  "glVertexAttribI4iv",
+  "glVertexAttribI4sv",
+  "glVertexAttribI4ubv",
+  "glVertexAttribI4ui",
+  "glVertexAttribI4uiv",
+  "glVertexAttribI4usv",
+  "glVertexAttribIPointer",
+  "glDrawArraysInstanced",
+  "glDrawElementsInstanced",
+  "glPrimitiveRestartIndex",
+  "glTexBuffer",
+  "glFramebufferTexture",
+  "glGetBufferParameteri64v",
+  "glGetInteger64i_v",
+  "glVertexAttribDivisor",
+  "glBlendEquationSeparatei",
+  "glBlendEquationi",
+  "glBlendFuncSeparatei",
+  "glBlendFunci",
+  "glMinSampleShading",
+  "glGetGraphicsResetStatus",
+  "glGetnCompressedTexImage",
+  "glGetnTexImage",
+  "glGetnUniformdv",
+  "glMultiDrawArraysIndirectCount",
+  "glMultiDrawElementsIndirectCount",
+  "glSpecializeShader",
+  "glTbufferMask3DFX",
+  "glDebugMessageCallbackAMD",
+  "glDebugMessageEnableAMD",
+  "glDebugMessageInsertAMD",
+  "glGetDebugMessageLogAMD",
+  "glBlendEquationIndexedAMD",
+  "glBlendEquationSeparateIndexedAMD",
+  "glBlendFuncIndexedAMD",
+  "glBlendFuncSeparateIndexedAMD",
+  "glNamedRenderbufferStorageMultisampleAdvancedAMD",
+  "glRenderbufferStorageMultisampleAdvancedAMD",
+  "glFramebufferSamplePositionsfvAMD",
+  "glGetFramebufferParameterfvAMD",
+  "glGetNamedFramebufferParameterfvAMD",
+  "glNamedFramebufferSamplePositionsfvAMD",
+  "glVertexAttribParameteriAMD",
+  "glMultiDrawArraysIndirectAMD",
+  "glMultiDrawElementsIndirectAMD",
+  "glDeleteNamesAMD",
+  "glGenNamesAMD",
+  "glIsNameAMD",
+  "glQueryObjectParameteruiAMD",
+  "glBeginPerfMonitorAMD",
+  "glDeletePerfMonitorsAMD",
+  "glEndPerfMonitorAMD",
+  "glGenPerfMonitorsAMD",
+  "glGetPerfMonitorCounterDataAMD",
+  "glGetPerfMonitorCounterInfoAMD",
+  "glGetPerfMonitorCounterStringAMD",
+  "glGetPerfMonitorCountersAMD",
+  "glGetPerfMonitorGroupStringAMD",
+  "glGetPerfMonitorGroupsAMD",
+  "glSelectPerfMonitorCountersAMD",
+  "glSetMultisamplefvAMD",
+  "glTexStorageSparseAMD",
+  "glTextureStorageSparseAMD",
+  "glStencilOpValueAMD",
+  "glTessellationFactorAMD",
+  "glTessellationModeAMD",
+  "glBlitFramebufferANGLE",
+  "glRenderbufferStorageMultisampleANGLE",
+  "glDrawArraysInstancedANGLE",
+  "glDrawElementsInstancedANGLE",
+  "glVertexAttribDivisorANGLE",
+  "glBeginQueryANGLE",
+  "glDeleteQueriesANGLE",
+  "glEndQueryANGLE",
+  "glGenQueriesANGLE",
+  "glGetQueryObjecti64vANGLE",
+  "glGetQueryObjectivANGLE",
+  "glGetQueryObjectui64vANGLE",
+  "glGetQueryObjectuivANGLE",
+  "glGetQueryivANGLE",
+  "glIsQueryANGLE",
+  "glQueryCounterANGLE",
+  "glGetTranslatedShaderSourceANGLE",
+  "glCopyTextureLevelsAPPLE",
+  "glDrawElementArrayAPPLE",
+  "glDrawRangeElementArrayAPPLE",
+  "glElementPointerAPPLE",
+  "glMultiDrawElementArrayAPPLE",
+  "glMultiDrawRangeElementArrayAPPLE",
+  "glDeleteFencesAPPLE",
+  "glFinishFenceAPPLE",
+  "glFinishObjectAPPLE",
+  "glGenFencesAPPLE",
+  "glIsFenceAPPLE",
+  "glSetFenceAPPLE",
+  "glTestFenceAPPLE",
+  "glTestObjectAPPLE",
+  "glBufferParameteriAPPLE",
+  "glFlushMappedBufferRangeAPPLE",
+  "glRenderbufferStorageMultisampleAPPLE",
+  "glResolveMultisampleFramebufferAPPLE",
+  "glGetObjectParameterivAPPLE",
+  "glObjectPurgeableAPPLE",
+  "glObjectUnpurgeableAPPLE",
+  "glClientWaitSyncAPPLE",
+  "glDeleteSyncAPPLE",
+  "glFenceSyncAPPLE",
+  "glGetInteger64vAPPLE",
+  "glGetSyncivAPPLE",
+  "glIsSyncAPPLE",
+  "glWaitSyncAPPLE",
+  "glGetTexParameterPointervAPPLE",
+  "glTextureRangeAPPLE",
+  "glBindVertexArrayAPPLE",
+  "glDeleteVertexArraysAPPLE",
+  "glGenVertexArraysAPPLE",
+  "glIsVertexArrayAPPLE",
+  "glFlushVertexArrayRangeAPPLE",
+  "glVertexArrayParameteriAPPLE",
+  "glVertexArrayRangeAPPLE",
+  "glDisableVertexAttribAPPLE",
+  "glEnableVertexAttribAPPLE",
+  "glIsVertexAttribEnabledAPPLE",
+  "glMapVertexAttrib1dAPPLE",
+  "glMapVertexAttrib1fAPPLE",
+  "glMapVertexAttrib2dAPPLE",
+  "glMapVertexAttrib2fAPPLE",
+  "glClearDepthf",
+  "glDepthRangef",
+  "glGetShaderPrecisionFormat",
+  "glReleaseShaderCompiler",
+  "glShaderBinary",
+  "glMemoryBarrierByRegion",
+  "glPrimitiveBoundingBoxARB",
+  "glDrawArraysInstancedBaseInstance",
+  "glDrawElementsInstancedBaseInstance",
+  "glDrawElementsInstancedBaseVertexBaseInstance",
+  "glGetImageHandleARB",
+  "glGetTextureHandleARB",
+  "glGetTextureSamplerHandleARB",
+  "glGetVertexAttribLui64vARB",
+  "glIsImageHandleResidentARB",
+  "glIsTextureHandleResidentARB",
+  "glMakeImageHandleNonResidentARB",
+  "glMakeImageHandleResidentARB",
+  "glMakeTextureHandleNonResidentARB",
+  "glMakeTextureHandleResidentARB",
+  "glProgramUniformHandleui64ARB",
+  "glProgramUniformHandleui64vARB",
+  "glUniformHandleui64ARB",
+  "glUniformHandleui64vARB",
+  "glVertexAttribL1ui64ARB",
+  "glVertexAttribL1ui64vARB",
+  "glBindFragDataLocationIndexed",
+  "glGetFragDataIndex",
+  "glBufferStorage",
+  "glCreateSyncFromCLeventARB",
+  "glClearBufferData",
+  "glClearBufferSubData",
+  "glClearNamedBufferDataEXT",
+  "glClearNamedBufferSubDataEXT",
+  "glClearTexImage",
+  "glClearTexSubImage",
+  "glClipControl",
+  "glClampColorARB",
+  "glDispatchCompute",
+  "glDispatchComputeIndirect",
+  "glDispatchComputeGroupSizeARB",
+  "glCopyBufferSubData",
+  "glCopyImageSubData",
+  "glDebugMessageCallbackARB",
+  "glDebugMessageControlARB",
+  "glDebugMessageInsertARB",
+  "glGetDebugMessageLogARB",
+  "glBindTextureUnit",
+  "glBlitNamedFramebuffer",
+  "glCheckNamedFramebufferStatus",
+  "glClearNamedBufferData",
+  "glClearNamedBufferSubData",
+  "glClearNamedFramebufferfi",
+  "glClearNamedFramebufferfv",
+  "glClearNamedFramebufferiv",
+  "glClearNamedFramebufferuiv",
+  "glCompressedTextureSubImage1D",
+  "glCompressedTextureSubImage2D",
+  "glCompressedTextureSubImage3D",
+  "glCopyNamedBufferSubData",
+  "glCopyTextureSubImage1D",
+  "glCopyTextureSubImage2D",
+  "glCopyTextureSubImage3D",
+  "glCreateBuffers",
+  "glCreateFramebuffers",
+  "glCreateProgramPipelines",
+  "glCreateQueries",
+  "glCreateRenderbuffers",
+  "glCreateSamplers",
+  "glCreateTextures",
+  "glCreateTransformFeedbacks",
+  "glCreateVertexArrays",
+  "glDisableVertexArrayAttrib",
+  "glEnableVertexArrayAttrib",
+  "glFlushMappedNamedBufferRange",
+  "glGenerateTextureMipmap",
+  "glGetCompressedTextureImage",
+  "glGetNamedBufferParameteri64v",
+  "glGetNamedBufferParameteriv",
+  "glGetNamedBufferPointerv",
+  "glGetNamedBufferSubData",
+  "glGetNamedFramebufferAttachmentParameteriv",
+  "glGetNamedFramebufferParameteriv",
+  "glGetNamedRenderbufferParameteriv",
+  "glGetQueryBufferObjecti64v",
+  "glGetQueryBufferObjectiv",
+  "glGetQueryBufferObjectui64v",
+  "glGetQueryBufferObjectuiv",
+  "glGetTextureImage",
+  "glGetTextureLevelParameterfv",
+  "glGetTextureLevelParameteriv",
+  "glGetTextureParameterIiv",
+  "glGetTextureParameterIuiv",
+  "glGetTextureParameterfv",
+  "glGetTextureParameteriv",
+  "glGetTransformFeedbacki64_v",
+  "glGetTransformFeedbacki_v",
+  "glGetTransformFeedbackiv",
+  "glGetVertexArrayIndexed64iv",
+  "glGetVertexArrayIndexediv",
+  "glGetVertexArrayiv",
+  "glInvalidateNamedFramebufferData",
+  "glInvalidateNamedFramebufferSubData",
+  "glMapNamedBuffer",
+  "glMapNamedBufferRange",
+  "glNamedBufferData",
+  "glNamedBufferStorage",
+  "glNamedBufferSubData",
+  "glNamedFramebufferDrawBuffer",
+  "glNamedFramebufferDrawBuffers",
+  "glNamedFramebufferParameteri",
+  "glNamedFramebufferReadBuffer",
+  "glNamedFramebufferRenderbuffer",
+  "glNamedFramebufferTexture",
+  "glNamedFramebufferTextureLayer",
+  "glNamedRenderbufferStorage",
+  "glNamedRenderbufferStorageMultisample",
+  "glTextureBuffer",
+  "glTextureBufferRange",
+  "glTextureParameterIiv",
+  "glTextureParameterIuiv",
+  "glTextureParameterf",
+  "glTextureParameterfv",
+  "glTextureParameteri",
+  "glTextureParameteriv",
+  "glTextureStorage1D",
+  "glTextureStorage2D",
+  "glTextureStorage2DMultisample",
+  "glTextureStorage3D",
+  "glTextureStorage3DMultisample",
+  "glTextureSubImage1D",
+  "glTextureSubImage2D",
+  "glTextureSubImage3D",
+  "glTransformFeedbackBufferBase",
+  "glTransformFeedbackBufferRange",
+  "glUnmapNamedBuffer",
+  "glVertexArrayAttribBinding",
+  "glVertexArrayAttribFormat",
+  "glVertexArrayAttribIFormat",
+  "glVertexArrayAttribLFormat",
+  "glVertexArrayBindingDivisor",
+  "glVertexArrayElementBuffer",
+  "glVertexArrayVertexBuffer",
+  "glVertexArrayVertexBuffers",
+  "glDrawBuffersARB",
+  "glBlendEquationSeparateiARB",
+  "glBlendEquationiARB",
+  "glBlendFuncSeparateiARB",
+  "glBlendFunciARB",
+  "glDrawElementsBaseVertex",
+  "glDrawElementsInstancedBaseVertex",
+  "glDrawRangeElementsBaseVertex",
+  "glMultiDrawElementsBaseVertex",
+  "glDrawArraysIndirect",
+  "glDrawElementsIndirect",
+  "glFramebufferParameteri",
+  "glGetFramebufferParameteriv",
+  "glGetNamedFramebufferParameterivEXT",
+  "glNamedFramebufferParameteriEXT",
+  "glBindFramebuffer",
+  "glBindRenderbuffer",
+  "glBlitFramebuffer",
+  "glCheckFramebufferStatus",
+  "glDeleteFramebuffers",
+  "glDeleteRenderbuffers",
+  "glFramebufferRenderbuffer",
+  "glFramebufferTexture1D",
+  "glFramebufferTexture2D",
+  "glFramebufferTexture3D",
+  "glFramebufferTextureLayer",
+  "glGenFramebuffers",
+  "glGenRenderbuffers",
+  "glGenerateMipmap",
+  "glGetFramebufferAttachmentParameteriv",
+  "glGetRenderbufferParameteriv",
+  "glIsFramebuffer",
+  "glIsRenderbuffer",
+  "glRenderbufferStorage",
+  "glRenderbufferStorageMultisample",
+  "glFramebufferTextureARB",
+  "glFramebufferTextureFaceARB",
+  "glFramebufferTextureLayerARB",
+  "glProgramParameteriARB",
+  "glGetProgramBinary",
+  "glProgramBinary",
+  "glProgramParameteri",
+  "glGetCompressedTextureSubImage",
+  "glGetTextureSubImage",
+  "glSpecializeShaderARB",
+  "glGetUniformdv",
+  "glUniform1d",
+  "glUniform1dv",
+  "glUniform2d",
+  "glUniform2dv",
+  "glUniform3d",
+  "glUniform3dv",
+  "glUniform4d",
+  "glUniform4dv",
+  "glUniformMatrix2dv",
+  "glUniformMatrix2x3dv",
+  "glUniformMatrix2x4dv",
+  "glUniformMatrix3dv",
+  "glUniformMatrix3x2dv",
+  "glUniformMatrix3x4dv",
+  "glUniformMatrix4dv",
+  "glUniformMatrix4x2dv",
+  "glUniformMatrix4x3dv",
+  "glGetUniformi64vARB",
+  "glGetUniformui64vARB",
+  "glGetnUniformi64vARB",
+  "glGetnUniformui64vARB",
+  "glProgramUniform1i64ARB",
+  "glProgramUniform1i64vARB",
+  "glProgramUniform1ui64ARB",
+  "glProgramUniform1ui64vARB",
+  "glProgramUniform2i64ARB",
+  "glProgramUniform2i64vARB",
+  "glProgramUniform2ui64ARB",
+  "glProgramUniform2ui64vARB",
+  "glProgramUniform3i64ARB",
+  "glProgramUniform3i64vARB",
+  "glProgramUniform3ui64ARB",
+  "glProgramUniform3ui64vARB",
+  "glProgramUniform4i64ARB",
+  "glProgramUniform4i64vARB",
+  "glProgramUniform4ui64ARB",
+  "glProgramUniform4ui64vARB",
+  "glUniform1i64ARB",
+  "glUniform1i64vARB",
+  "glUniform1ui64ARB",
+  "glUniform1ui64vARB",
+  "glUniform2i64ARB",
+  "glUniform2i64vARB",
+  "glUniform2ui64ARB",
+  "glUniform2ui64vARB",
+  "glUniform3i64ARB",
+  "glUniform3i64vARB",
+  "glUniform3ui64ARB",
+  "glUniform3ui64vARB",
+  "glUniform4i64ARB",
+  "glUniform4i64vARB",
+  "glUniform4ui64ARB",
+  "glUniform4ui64vARB",
+  "glColorSubTable",
+  "glColorTable",
+  "glColorTableParameterfv",
+  "glColorTableParameteriv",
+  "glConvolutionFilter1D",
+  "glConvolutionFilter2D",
+  "glConvolutionParameterf",
+  "glConvolutionParameterfv",
+  "glConvolutionParameteri",
+  "glConvolutionParameteriv",
+  "glCopyColorSubTable",
+  "glCopyColorTable",
+  "glCopyConvolutionFilter1D",
+  "glCopyConvolutionFilter2D",
+  "glGetColorTable",
+  "glGetColorTableParameterfv",
+  "glGetColorTableParameteriv",
+  "glGetConvolutionFilter",
+  "glGetConvolutionParameterfv",
+  "glGetConvolutionParameteriv",
+  "glGetHistogram",
+  "glGetHistogramParameterfv",
+  "glGetHistogramParameteriv",
+  "glGetMinmax",
+  "glGetMinmaxParameterfv",
+  "glGetMinmaxParameteriv",
+  "glGetSeparableFilter",
+  "glHistogram",
+  "glMinmax",
+  "glResetHistogram",
+  "glResetMinmax",
+  "glSeparableFilter2D",
+  "glMultiDrawArraysIndirectCountARB",
+  "glMultiDrawElementsIndirectCountARB",
+  "glDrawArraysInstancedARB",
+  "glDrawElementsInstancedARB",
+  "glVertexAttribDivisorARB",
+  "glGetInternalformativ",
+  "glGetInternalformati64v",
+  "glInvalidateBufferData",
+  "glInvalidateBufferSubData",
+  "glInvalidateFramebuffer",
+  "glInvalidateSubFramebuffer",
+  "glInvalidateTexImage",
+  "glInvalidateTexSubImage",
+  "glFlushMappedBufferRange",
+  "glMapBufferRange",
+  "glCurrentPaletteMatrixARB",
+  "glMatrixIndexPointerARB",
+  "glMatrixIndexubvARB",
+  "glMatrixIndexuivARB",
+  "glMatrixIndexusvARB",
+  "glBindBuffersBase",
+  "glBindBuffersRange",
+  "glBindImageTextures",
+  "glBindSamplers",
+  "glBindTextures",
+  "glBindVertexBuffers",
+  "glMultiDrawArraysIndirect",
+  "glMultiDrawElementsIndirect",
+  "glSampleCoverageARB",
+  "glActiveTextureARB",
+  "glClientActiveTextureARB",
+  "glMultiTexCoord1dARB",
+  "glMultiTexCoord1dvARB",
+  "glMultiTexCoord1fARB",
+  "glMultiTexCoord1fvARB",
+  "glMultiTexCoord1iARB",
+  "glMultiTexCoord1ivARB",
+  "glMultiTexCoord1sARB",
+  "glMultiTexCoord1svARB",
+  "glMultiTexCoord2dARB",
+  "glMultiTexCoord2dvARB",
+  "glMultiTexCoord2fARB",
+  "glMultiTexCoord2fvARB",
+  "glMultiTexCoord2iARB",
+  "glMultiTexCoord2ivARB",
+  "glMultiTexCoord2sARB",
+  "glMultiTexCoord2svARB",
+  "glMultiTexCoord3dARB",
+  "glMultiTexCoord3dvARB",
+  "glMultiTexCoord3fARB",
+  "glMultiTexCoord3fvARB",
+  "glMultiTexCoord3iARB",
+  "glMultiTexCoord3ivARB",
+  "glMultiTexCoord3sARB",
+  "glMultiTexCoord3svARB",
+  "glMultiTexCoord4dARB",
+  "glMultiTexCoord4dvARB",
+  "glMultiTexCoord4fARB",
+  "glMultiTexCoord4fvARB",
+  "glMultiTexCoord4iARB",
+  "glMultiTexCoord4ivARB",
+  "glMultiTexCoord4sARB",
+  "glMultiTexCoord4svARB",
+  "glBeginQueryARB",
+  "glDeleteQueriesARB",
+  "glEndQueryARB",
+  "glGenQueriesARB",
+  "glGetQueryObjectivARB",
+  "glGetQueryObjectuivARB",
+  "glGetQueryivARB",
+  "glIsQueryARB",
+  "glMaxShaderCompilerThreadsARB",
+  "glPointParameterfARB",
+  "glPointParameterfvARB",
+  "glPolygonOffsetClamp",
+  "glGetProgramInterfaceiv",
+  "glGetProgramResourceIndex",
+  "glGetProgramResourceLocation",
+  "glGetProgramResourceLocationIndex",
+  "glGetProgramResourceName",
+  "glGetProgramResourceiv",
+  "glProvokingVertex",
+  "glGetGraphicsResetStatusARB",
+  "glGetnColorTableARB",
+  "glGetnCompressedTexImageARB",
+  "glGetnConvolutionFilterARB",
+  "glGetnHistogramARB",
+  "glGetnMapdvARB",
+  "glGetnMapfvARB",
+  "glGetnMapivARB",
+  "glGetnMinmaxARB",
+  "glGetnPixelMapfvARB",
+  "glGetnPixelMapuivARB",
+  "glGetnPixelMapusvARB",
+  "glGetnPolygonStippleARB",
+  "glGetnSeparableFilterARB",
+  "glGetnTexImageARB",
+  "glGetnUniformdvARB",
+  "glGetnUniformfvARB",
+  "glGetnUniformivARB",
+  "glGetnUniformuivARB",
+  "glReadnPixelsARB",
+  "glFramebufferSampleLocationsfvARB",
+  "glNamedFramebufferSampleLocationsfvARB",
+  "glMinSampleShadingARB",
+  "glBindSampler",
+  "glDeleteSamplers",
+  "glGenSamplers",
+  "glGetSamplerParameterIiv",
+  "glGetSamplerParameterIuiv",
+  "glGetSamplerParameterfv",
+  "glGetSamplerParameteriv",
+  "glIsSampler",
+  "glSamplerParameterIiv",
+  "glSamplerParameterIuiv",
+  "glSamplerParameterf",
+  "glSamplerParameterfv",
+  "glSamplerParameteri",
+  "glSamplerParameteriv",
+  "glActiveShaderProgram",
+  "glBindProgramPipeline",
+  "glCreateShaderProgramv",
+  "glDeleteProgramPipelines",
+  "glGenProgramPipelines",
+  "glGetProgramPipelineInfoLog",
+  "glGetProgramPipelineiv",
+  "glIsProgramPipeline",
+  "glProgramUniform1d",
+  "glProgramUniform1dv",
+  "glProgramUniform1f",
+  "glProgramUniform1fv",
+  "glProgramUniform1i",
+  "glProgramUniform1iv",
+  "glProgramUniform1ui",
+  "glProgramUniform1uiv",
+  "glProgramUniform2d",
+  "glProgramUniform2dv",
+  "glProgramUniform2f",
+  "glProgramUniform2fv",
+  "glProgramUniform2i",
+  "glProgramUniform2iv",
+  "glProgramUniform2ui",
+  "glProgramUniform2uiv",
+  "glProgramUniform3d",
+  "glProgramUniform3dv",
+  "glProgramUniform3f",
+  "glProgramUniform3fv",
+  "glProgramUniform3i",
+  "glProgramUniform3iv",
+  "glProgramUniform3ui",
+  "glProgramUniform3uiv",
+  "glProgramUniform4d",
+  "glProgramUniform4dv",
+  "glProgramUniform4f",
+  "glProgramUniform4fv",
+  "glProgramUniform4i",
+  "glProgramUniform4iv",
+  "glProgramUniform4ui",
+  "glProgramUniform4uiv",
+  "glProgramUniformMatrix2dv",
+  "glProgramUniformMatrix2fv",
+  "glProgramUniformMatrix2x3dv",
+  "glProgramUniformMatrix2x3fv",
+  "glProgramUniformMatrix2x4dv",
+  "glProgramUniformMatrix2x4fv",
+  "glProgramUniformMatrix3dv",
+  "glProgramUniformMatrix3fv",
+  "glProgramUniformMatrix3x2dv",
+  "glProgramUniformMatrix3x2fv",
+  "glProgramUniformMatrix3x4dv",
+  "glProgramUniformMatrix3x4fv",
+  "glProgramUniformMatrix4dv",
+  "glProgramUniformMatrix4fv",
+  "glProgramUniformMatrix4x2dv",
+  "glProgramUniformMatrix4x2fv",
+  "glProgramUniformMatrix4x3dv",
+  "glProgramUniformMatrix4x3fv",
+  "glUseProgramStages",
+  "glValidateProgramPipeline",
+  "glGetActiveAtomicCounterBufferiv",
+  "glBindImageTexture",
+  "glMemoryBarrier",
+  "glAttachObjectARB",
+  "glCompileShaderARB",
+  "glCreateProgramObjectARB",
+  "glCreateShaderObjectARB",
+  "glDeleteObjectARB",
+  "glDetachObjectARB",
+  "glGetActiveUniformARB",
+  "glGetAttachedObjectsARB",
+  "glGetHandleARB",
+  "glGetInfoLogARB",
+  "glGetObjectParameterfvARB",
+  "glGetObjectParameterivARB",
+  "glGetShaderSourceARB",
+  "glGetUniformLocationARB",
+  "glGetUniformfvARB",
+  "glGetUniformivARB",
+  "glLinkProgramARB",
+  "glShaderSourceARB",
+  "glUniform1fARB",
+  "glUniform1fvARB",
+  "glUniform1iARB",
+  "glUniform1ivARB",
+  "glUniform2fARB",
+  "glUniform2fvARB",
+  "glUniform2iARB",
+  "glUniform2ivARB",
+  "glUniform3fARB",
+  "glUniform3fvARB",
+  "glUniform3iARB",
+  "glUniform3ivARB",
+  "glUniform4fARB",
+  "glUniform4fvARB",
+  "glUniform4iARB",
+  "glUniform4ivARB",
+  "glUniformMatrix2fvARB",
+  "glUniformMatrix3fvARB",
+  "glUniformMatrix4fvARB",
+  "glUseProgramObjectARB",
+  "glValidateProgramARB",
+  "glShaderStorageBlockBinding",
+  "glGetActiveSubroutineName",
+  "glGetActiveSubroutineUniformName",
+  "glGetActiveSubroutineUniformiv",
+  "glGetProgramStageiv",
+  "glGetSubroutineIndex",
+  "glGetSubroutineUniformLocation",
+  "glGetUniformSubroutineuiv",
+  "glUniformSubroutinesuiv",
+  "glCompileShaderIncludeARB",
+  "glDeleteNamedStringARB",
+  "glGetNamedStringARB",
+  "glGetNamedStringivARB",
+  "glIsNamedStringARB",
+  "glNamedStringARB",
+  "glBufferPageCommitmentARB",
+  "glTexPageCommitmentARB",
+  "glClientWaitSync",
+  "glDeleteSync",
+  "glFenceSync",
+  "glGetInteger64v",
+  "glGetSynciv",
+  "glIsSync",
+  "glWaitSync",
+  "glPatchParameterfv",
+  "glPatchParameteri",
+  "glTextureBarrier",
+  "glTexBufferARB",
+  "glTexBufferRange",
+  "glTextureBufferRangeEXT",
+  "glCompressedTexImage1DARB",
+  "glCompressedTexImage2DARB",
+  "glCompressedTexImage3DARB",
+  "glCompressedTexSubImage1DARB",
+  "glCompressedTexSubImage2DARB",
+  "glCompressedTexSubImage3DARB",
+  "glGetCompressedTexImageARB",
+  "glGetMultisamplefv",
+  "glSampleMaski",
+  "glTexImage2DMultisample",
+  "glTexImage3DMultisample",
+  "glTexStorage1D",
+  "glTexStorage2D",
+  "glTexStorage3D",
+  "glTexStorage2DMultisample",
+  "glTexStorage3DMultisample",
+  "glTextureStorage2DMultisampleEXT",
+  "glTextureStorage3DMultisampleEXT",
+  "glTextureView",
+  "glGetQueryObjecti64v",
+  "glGetQueryObjectui64v",
+  "glQueryCounter",
+  "glBindTransformFeedback",
+  "glDeleteTransformFeedbacks",
+  "glDrawTransformFeedback",
+  "glGenTransformFeedbacks",
+  "glIsTransformFeedback",
+  "glPauseTransformFeedback",
+  "glResumeTransformFeedback",
+  "glBeginQueryIndexed",
+  "glDrawTransformFeedbackStream",
+  "glEndQueryIndexed",
+  "glGetQueryIndexediv",
+  "glDrawTransformFeedbackInstanced",
+  "glDrawTransformFeedbackStreamInstanced",
+  "glLoadTransposeMatrixdARB",
+  "glLoadTransposeMatrixfARB",
+  "glMultTransposeMatrixdARB",
+  "glMultTransposeMatrixfARB",
+  "glBindBufferBase",
+  "glBindBufferRange",
+  "glGetActiveUniformBlockName",
+  "glGetActiveUniformBlockiv",
+  "glGetActiveUniformName",
+  "glGetActiveUniformsiv",
+  "glGetIntegeri_v",
+  "glGetUniformBlockIndex",
+  "glGetUniformIndices",
+  "glUniformBlockBinding",
+  "glBindVertexArray",
+  "glDeleteVertexArrays",
+  "glGenVertexArrays",
+  "glIsVertexArray",
+  "glGetVertexAttribLdv",
+  "glVertexAttribL1d",
+  "glVertexAttribL1dv",
+  "glVertexAttribL2d",
+  "glVertexAttribL2dv",
+  "glVertexAttribL3d",
+  "glVertexAttribL3dv",
+  "glVertexAttribL4d",
+  "glVertexAttribL4dv",
+  "glVertexAttribLPointer",
+  "glBindVertexBuffer",
+  "glVertexArrayBindVertexBufferEXT",
+  "glVertexArrayVertexAttribBindingEXT",
+  "glVertexArrayVertexAttribFormatEXT",
+  "glVertexArrayVertexAttribIFormatEXT",
+  "glVertexArrayVertexAttribLFormatEXT",
+  "glVertexArrayVertexBindingDivisorEXT",
+  "glVertexAttribBinding",
+  "glVertexAttribFormat",
+  "glVertexAttribIFormat",
+  "glVertexAttribLFormat",
+  "glVertexBindingDivisor",
+  "glVertexBlendARB",
+  "glWeightPointerARB",
+  "glWeightbvARB",
+  "glWeightdvARB",
+  "glWeightfvARB",
+  "glWeightivARB",
+  "glWeightsvARB",
+  "glWeightubvARB",
+  "glWeightuivARB",
+  "glWeightusvARB",
+  "glBindBufferARB",
+  "glBufferDataARB",
+  "glBufferSubDataARB",
+  "glDeleteBuffersARB",
+  "glGenBuffersARB",
+  "glGetBufferParameterivARB",
+  "glGetBufferPointervARB",
+  "glGetBufferSubDataARB",
+  "glIsBufferARB",
+  "glMapBufferARB",
+  "glUnmapBufferARB",
+  "glBindProgramARB",
+  "glDeleteProgramsARB",
+  "glDisableVertexAttribArrayARB",
+  "glEnableVertexAttribArrayARB",
+  "glGenProgramsARB",
+  "glGetProgramEnvParameterdvARB",
+  "glGetProgramEnvParameterfvARB",
+  "glGetProgramLocalParameterdvARB",
+  "glGetProgramLocalParameterfvARB",
+  "glGetProgramStringARB",
+  "glGetProgramivARB",
+  "glGetVertexAttribPointervARB",
+  "glGetVertexAttribdvARB",
+  "glGetVertexAttribfvARB",
+  "glGetVertexAttribivARB",
+  "glIsProgramARB",
+  "glProgramEnvParameter4dARB",
+  "glProgramEnvParameter4dvARB",
+  "glProgramEnvParameter4fARB",
+  "glProgramEnvParameter4fvARB",
+  "glProgramLocalParameter4dARB",
+  "glProgramLocalParameter4dvARB",
+  "glProgramLocalParameter4fARB",
+  "glProgramLocalParameter4fvARB",
+  "glProgramStringARB",
+  "glVertexAttrib1dARB",
+  "glVertexAttrib1dvARB",
+  "glVertexAttrib1fARB",
+  "glVertexAttrib1fvARB",
+  "glVertexAttrib1sARB",
+  "glVertexAttrib1svARB",
+  "glVertexAttrib2dARB",
+  "glVertexAttrib2dvARB",
+  "glVertexAttrib2fARB",
+  "glVertexAttrib2fvARB",
+  "glVertexAttrib2sARB",
+  "glVertexAttrib2svARB",
+  "glVertexAttrib3dARB",
+  "glVertexAttrib3dvARB",
+  "glVertexAttrib3fARB",
+  "glVertexAttrib3fvARB",
+  "glVertexAttrib3sARB",
+  "glVertexAttrib3svARB",
+  "glVertexAttrib4NbvARB",
+  "glVertexAttrib4NivARB",
+  "glVertexAttrib4NsvARB",
+  "glVertexAttrib4NubARB",
+  "glVertexAttrib4NubvARB",
+  "glVertexAttrib4NuivARB",
+  "glVertexAttrib4NusvARB",
+  "glVertexAttrib4bvARB",
+  "glVertexAttrib4dARB",
+  "glVertexAttrib4dvARB",
+  "glVertexAttrib4fARB",
+  "glVertexAttrib4fvARB",
+  "glVertexAttrib4ivARB",
+  "glVertexAttrib4sARB",
+  "glVertexAttrib4svARB",
+  "glVertexAttrib4ubvARB",
+  "glVertexAttrib4uivARB",
+  "glVertexAttrib4usvARB",
+  "glVertexAttribPointerARB",
+  "glBindAttribLocationARB",
+  "glGetActiveAttribARB",
+  "glGetAttribLocationARB",
+  "glColorP3ui",
+  "glColorP3uiv",
+  "glColorP4ui",
+  "glColorP4uiv",
+  "glMultiTexCoordP1ui",
+  "glMultiTexCoordP1uiv",
+  "glMultiTexCoordP2ui",
+  "glMultiTexCoordP2uiv",
+  "glMultiTexCoordP3ui",
+  "glMultiTexCoordP3uiv",
+  "glMultiTexCoordP4ui",
+  "glMultiTexCoordP4uiv",
+  "glNormalP3ui",
+  "glNormalP3uiv",
+  "glSecondaryColorP3ui",
+  "glSecondaryColorP3uiv",
+  "glTexCoordP1ui",
+  "glTexCoordP1uiv",
+  "glTexCoordP2ui",
+  "glTexCoordP2uiv",
+  "glTexCoordP3ui",
+  "glTexCoordP3uiv",
+  "glTexCoordP4ui",
+  "glTexCoordP4uiv",
+  "glVertexAttribP1ui",
+  "glVertexAttribP1uiv",
+  "glVertexAttribP2ui",
+  "glVertexAttribP2uiv",
+  "glVertexAttribP3ui",
+  "glVertexAttribP3uiv",
+  "glVertexAttribP4ui",
+  "glVertexAttribP4uiv",
+  "glVertexP2ui",
+  "glVertexP2uiv",
+  "glVertexP3ui",
+  "glVertexP3uiv",
+  "glVertexP4ui",
+  "glVertexP4uiv",
+  "glDepthRangeArrayv",
+  "glDepthRangeIndexed",
+  "glGetDoublei_v",
+  "glGetFloati_v",
+  "glScissorArrayv",
+  "glScissorIndexed",
+  "glScissorIndexedv",
+  "glViewportArrayv",
+  "glViewportIndexedf",
+  "glViewportIndexedfv",
+  "glWindowPos2dARB",
+  "glWindowPos2dvARB",
+  "glWindowPos2fARB",
+  "glWindowPos2fvARB",
+  "glWindowPos2iARB",
+  "glWindowPos2ivARB",
+  "glWindowPos2sARB",
+  "glWindowPos2svARB",
+  "glWindowPos3dARB",
+  "glWindowPos3dvARB",
+  "glWindowPos3fARB",
+  "glWindowPos3fvARB",
+  "glWindowPos3iARB",
+  "glWindowPos3ivARB",
+  "glWindowPos3sARB",
+  "glWindowPos3svARB",
+  "glDrawBuffersATI",
+  "glDrawElementArrayATI",
+  "glDrawRangeElementArrayATI",
+  "glElementPointerATI",
+  "glGetTexBumpParameterfvATI",
+  "glGetTexBumpParameterivATI",
+  "glTexBumpParameterfvATI",
+  "glTexBumpParameterivATI",
+  "glAlphaFragmentOp1ATI",
+  "glAlphaFragmentOp2ATI",
+  "glAlphaFragmentOp3ATI",
+  "glBeginFragmentShaderATI",
+  "glBindFragmentShaderATI",
+  "glColorFragmentOp1ATI",
+  "glColorFragmentOp2ATI",
+  "glColorFragmentOp3ATI",
+  "glDeleteFragmentShaderATI",
+  "glEndFragmentShaderATI",
+  "glGenFragmentShadersATI",
+  "glPassTexCoordATI",
+  "glSampleMapATI",
+  "glSetFragmentShaderConstantATI",
+  "glMapObjectBufferATI",
+  "glUnmapObjectBufferATI",
+  "glPNTrianglesfATI",
+  "glPNTrianglesiATI",
+  "glStencilFuncSeparateATI",
+  "glStencilOpSeparateATI",
+  "glArrayObjectATI",
+  "glFreeObjectBufferATI",
+  "glGetArrayObjectfvATI",
+  "glGetArrayObjectivATI",
+  "glGetObjectBufferfvATI",
+  "glGetObjectBufferivATI",
+  "glGetVariantArrayObjectfvATI",
+  "glGetVariantArrayObjectivATI",
+  "glIsObjectBufferATI",
+  "glNewObjectBufferATI",
+  "glUpdateObjectBufferATI",
+  "glVariantArrayObjectATI",
+  "glGetVertexAttribArrayObjectfvATI",
+  "glGetVertexAttribArrayObjectivATI",
+  "glVertexAttribArrayObjectATI",
+  "glClientActiveVertexStreamATI",
+  "glNormalStream3bATI",
+  "glNormalStream3bvATI",
+  "glNormalStream3dATI",
+  "glNormalStream3dvATI",
+  "glNormalStream3fATI",
+  "glNormalStream3fvATI",
+  "glNormalStream3iATI",
+  "glNormalStream3ivATI",
+  "glNormalStream3sATI",
+  "glNormalStream3svATI",
+  "glVertexBlendEnvfATI",
+  "glVertexBlendEnviATI",
+  "glVertexStream1dATI",
+  "glVertexStream1dvATI",
+  "glVertexStream1fATI",
+  "glVertexStream1fvATI",
+  "glVertexStream1iATI",
+  "glVertexStream1ivATI",
+  "glVertexStream1sATI",
+  "glVertexStream1svATI",
+  "glVertexStream2dATI",
+  "glVertexStream2dvATI",
+  "glVertexStream2fATI",
+  "glVertexStream2fvATI",
+  "glVertexStream2iATI",
+  "glVertexStream2ivATI",
+  "glVertexStream2sATI",
+  "glVertexStream2svATI",
+  "glVertexStream3dATI",
+  "glVertexStream3dvATI",
+  "glVertexStream3fATI",
+  "glVertexStream3fvATI",
+  "glVertexStream3iATI",
+  "glVertexStream3ivATI",
+  "glVertexStream3sATI",
+  "glVertexStream3svATI",
+  "glVertexStream4dATI",
+  "glVertexStream4dvATI",
+  "glVertexStream4fATI",
+  "glVertexStream4fvATI",
+  "glVertexStream4iATI",
+  "glVertexStream4ivATI",
+  "glVertexStream4sATI",
+  "glVertexStream4svATI",
+  "glEGLImageTargetTexStorageEXT",
+  "glEGLImageTargetTextureStorageEXT",
+  "glDrawArraysInstancedBaseInstanceEXT",
+  "glDrawElementsInstancedBaseInstanceEXT",
+  "glDrawElementsInstancedBaseVertexBaseInstanceEXT",
+  "glGetUniformBufferSizeEXT",
+  "glGetUniformOffsetEXT",
+  "glUniformBufferEXT",
+  "glBlendColorEXT",
+  "glBlendEquationSeparateEXT",
+  "glBindFragDataLocationIndexedEXT",
+  "glGetFragDataIndexEXT",
+  "glGetProgramResourceLocationIndexEXT",
+  "glBlendFuncSeparateEXT",
+  "glBlendEquationEXT",
+  "glBufferStorageEXT",
+  "glNamedBufferStorageEXT",
+  "glClearTexImageEXT",
+  "glClearTexSubImageEXT",
+  "glClipControlEXT",
+  "glColorSubTableEXT",
+  "glCopyColorSubTableEXT",
+  "glLockArraysEXT",
+  "glUnlockArraysEXT",
+  "glConvolutionFilter1DEXT",
+  "glConvolutionFilter2DEXT",
+  "glConvolutionParameterfEXT",
+  "glConvolutionParameterfvEXT",
+  "glConvolutionParameteriEXT",
+  "glConvolutionParameterivEXT",
+  "glCopyConvolutionFilter1DEXT",
+  "glCopyConvolutionFilter2DEXT",
+  "glGetConvolutionFilterEXT",
+  "glGetConvolutionParameterfvEXT",
+  "glGetConvolutionParameterivEXT",
+  "glGetSeparableFilterEXT",
+  "glSeparableFilter2DEXT",
+  "glBinormalPointerEXT",
+  "glTangentPointerEXT",
+  "glCopyImageSubDataEXT",
+  "glCopyTexImage1DEXT",
+  "glCopyTexImage2DEXT",
+  "glCopyTexSubImage1DEXT",
+  "glCopyTexSubImage2DEXT",
+  "glCopyTexSubImage3DEXT",
+  "glCullParameterdvEXT",
+  "glCullParameterfvEXT",
+  "glGetObjectLabelEXT",
+  "glLabelObjectEXT",
+  "glInsertEventMarkerEXT",
+  "glPopGroupMarkerEXT",
+  "glPushGroupMarkerEXT",
+  "glDepthBoundsEXT",
+  "glBindMultiTextureEXT",
+  "glCheckNamedFramebufferStatusEXT",
+  "glClientAttribDefaultEXT",
+  "glCompressedMultiTexImage1DEXT",
+  "glCompressedMultiTexImage2DEXT",
+  "glCompressedMultiTexImage3DEXT",
+  "glCompressedMultiTexSubImage1DEXT",
+  "glCompressedMultiTexSubImage2DEXT",
+  "glCompressedMultiTexSubImage3DEXT",
+  "glCompressedTextureImage1DEXT",
+  "glCompressedTextureImage2DEXT",
+  "glCompressedTextureImage3DEXT",
+  "glCompressedTextureSubImage1DEXT",
+  "glCompressedTextureSubImage2DEXT",
+  "glCompressedTextureSubImage3DEXT",
+  "glCopyMultiTexImage1DEXT",
+  "glCopyMultiTexImage2DEXT",
+  "glCopyMultiTexSubImage1DEXT",
+  "glCopyMultiTexSubImage2DEXT",
+  "glCopyMultiTexSubImage3DEXT",
+  "glCopyTextureImage1DEXT",
+  "glCopyTextureImage2DEXT",
+  "glCopyTextureSubImage1DEXT",
+  "glCopyTextureSubImage2DEXT",
+  "glCopyTextureSubImage3DEXT",
+  "glDisableClientStateIndexedEXT",
+  "glDisableClientStateiEXT",
+  "glDisableVertexArrayAttribEXT",
+  "glDisableVertexArrayEXT",
+  "glEnableClientStateIndexedEXT",
+  "glEnableClientStateiEXT",
+  "glEnableVertexArrayAttribEXT",
+  "glEnableVertexArrayEXT",
+  "glFlushMappedNamedBufferRangeEXT",
+  "glFramebufferDrawBufferEXT",
+  "glFramebufferDrawBuffersEXT",
+  "glFramebufferReadBufferEXT",
+  "glGenerateMultiTexMipmapEXT",
+  "glGenerateTextureMipmapEXT",
+  "glGetCompressedMultiTexImageEXT",
+  "glGetCompressedTextureImageEXT",
+  "glGetDoubleIndexedvEXT",
+  "glGetDoublei_vEXT",
+  "glGetFloatIndexedvEXT",
+  "glGetFloati_vEXT",
+  "glGetFramebufferParameterivEXT",
+  "glGetMultiTexEnvfvEXT",
+  "glGetMultiTexEnvivEXT",
+  "glGetMultiTexGendvEXT",
+  "glGetMultiTexGenfvEXT",
+  "glGetMultiTexGenivEXT",
+  "glGetMultiTexImageEXT",
+  "glGetMultiTexLevelParameterfvEXT",
+  "glGetMultiTexLevelParameterivEXT",
+  "glGetMultiTexParameterIivEXT",
+  "glGetMultiTexParameterIuivEXT",
+  "glGetMultiTexParameterfvEXT",
+  "glGetMultiTexParameterivEXT",
+  "glGetNamedBufferParameterivEXT",
+  "glGetNamedBufferPointervEXT",
+  "glGetNamedBufferSubDataEXT",
+  "glGetNamedFramebufferAttachmentParameterivEXT",
+  "glGetNamedProgramLocalParameterIivEXT",
+  "glGetNamedProgramLocalParameterIuivEXT",
+  "glGetNamedProgramLocalParameterdvEXT",
+  "glGetNamedProgramLocalParameterfvEXT",
+  "glGetNamedProgramStringEXT",
+  "glGetNamedProgramivEXT",
+  "glGetNamedRenderbufferParameterivEXT",
+  "glGetPointerIndexedvEXT",
+  "glGetPointeri_vEXT",
+  "glGetTextureImageEXT",
+  "glGetTextureLevelParameterfvEXT",
+  "glGetTextureLevelParameterivEXT",
+  "glGetTextureParameterIivEXT",
+  "glGetTextureParameterIuivEXT",
+  "glGetTextureParameterfvEXT",
+  "glGetTextureParameterivEXT",
+  "glGetVertexArrayIntegeri_vEXT",
+  "glGetVertexArrayIntegervEXT",
+  "glGetVertexArrayPointeri_vEXT",
+  "glGetVertexArrayPointervEXT",
+  "glMapNamedBufferEXT",
+  "glMapNamedBufferRangeEXT",
+  "glMatrixFrustumEXT",
+  "glMatrixLoadIdentityEXT",
+  "glMatrixLoadTransposedEXT",
+  "glMatrixLoadTransposefEXT",
+  "glMatrixLoaddEXT",
+  "glMatrixLoadfEXT",
+  "glMatrixMultTransposedEXT",
+  "glMatrixMultTransposefEXT",
+  "glMatrixMultdEXT",
+  "glMatrixMultfEXT",
+  "glMatrixOrthoEXT",
+  "glMatrixPopEXT",
+  "glMatrixPushEXT",
+  "glMatrixRotatedEXT",
+  "glMatrixRotatefEXT",
+  "glMatrixScaledEXT",
+  "glMatrixScalefEXT",
+  "glMatrixTranslatedEXT",
+  "glMatrixTranslatefEXT",
+  "glMultiTexBufferEXT",
+  "glMultiTexCoordPointerEXT",
+  "glMultiTexEnvfEXT",
+  "glMultiTexEnvfvEXT",
+  "glMultiTexEnviEXT",
+  "glMultiTexEnvivEXT",
+  "glMultiTexGendEXT",
+  "glMultiTexGendvEXT",
+  "glMultiTexGenfEXT",
+  "glMultiTexGenfvEXT",
+  "glMultiTexGeniEXT",
+  "glMultiTexGenivEXT",
+  "glMultiTexImage1DEXT",
+  "glMultiTexImage2DEXT",
+  "glMultiTexImage3DEXT",
+  "glMultiTexParameterIivEXT",
+  "glMultiTexParameterIuivEXT",
+  "glMultiTexParameterfEXT",
+  "glMultiTexParameterfvEXT",
+  "glMultiTexParameteriEXT",
+  "glMultiTexParameterivEXT",
+  "glMultiTexRenderbufferEXT",
+  "glMultiTexSubImage1DEXT",
+  "glMultiTexSubImage2DEXT",
+  "glMultiTexSubImage3DEXT",
+  "glNamedBufferDataEXT",
+  "glNamedBufferSubDataEXT",
+  "glNamedCopyBufferSubDataEXT",
+  "glNamedFramebufferRenderbufferEXT",
+  "glNamedFramebufferTexture1DEXT",
+  "glNamedFramebufferTexture2DEXT",
+  "glNamedFramebufferTexture3DEXT",
+  "glNamedFramebufferTextureEXT",
+  "glNamedFramebufferTextureFaceEXT",
+  "glNamedFramebufferTextureLayerEXT",
+  "glNamedProgramLocalParameter4dEXT",
+  "glNamedProgramLocalParameter4dvEXT",
+  "glNamedProgramLocalParameter4fEXT",
+  "glNamedProgramLocalParameter4fvEXT",
+  "glNamedProgramLocalParameterI4iEXT",
+  "glNamedProgramLocalParameterI4ivEXT",
+  "glNamedProgramLocalParameterI4uiEXT",
+  "glNamedProgramLocalParameterI4uivEXT",
+  "glNamedProgramLocalParameters4fvEXT",
+  "glNamedProgramLocalParametersI4ivEXT",
+  "glNamedProgramLocalParametersI4uivEXT",
+  "glNamedProgramStringEXT",
+  "glNamedRenderbufferStorageEXT",
+  "glNamedRenderbufferStorageMultisampleCoverageEXT",
+  "glNamedRenderbufferStorageMultisampleEXT",
+  "glProgramUniform1fEXT",
+  "glProgramUniform1fvEXT",
+  "glProgramUniform1iEXT",
+  "glProgramUniform1ivEXT",
+  "glProgramUniform1uiEXT",
+  "glProgramUniform1uivEXT",
+  "glProgramUniform2fEXT",
+  "glProgramUniform2fvEXT",
+  "glProgramUniform2iEXT",
+  "glProgramUniform2ivEXT",
+  "glProgramUniform2uiEXT",
+  "glProgramUniform2uivEXT",
+  "glProgramUniform3fEXT",
+  "glProgramUniform3fvEXT",
+  "glProgramUniform3iEXT",
+  "glProgramUniform3ivEXT",
+  "glProgramUniform3uiEXT",
+  "glProgramUniform3uivEXT",
+  "glProgramUniform4fEXT",
+  "glProgramUniform4fvEXT",
+  "glProgramUniform4iEXT",
+  "glProgramUniform4ivEXT",
+  "glProgramUniform4uiEXT",
+  "glProgramUniform4uivEXT",
+  "glProgramUniformMatrix2fvEXT",
+  "glProgramUniformMatrix2x3fvEXT",
+  "glProgramUniformMatrix2x4fvEXT",
+  "glProgramUniformMatrix3fvEXT",
+  "glProgramUniformMatrix3x2fvEXT",
+  "glProgramUniformMatrix3x4fvEXT",
+  "glProgramUniformMatrix4fvEXT",
+  "glProgramUniformMatrix4x2fvEXT",
+  "glProgramUniformMatrix4x3fvEXT",
+  "glPushClientAttribDefaultEXT",
+  "glTextureBufferEXT",
+  "glTextureImage1DEXT",
+  "glTextureImage2DEXT",
+  "glTextureImage3DEXT",
+  "glTextureParameterIivEXT",
+  "glTextureParameterIuivEXT",
+  "glTextureParameterfEXT",
+  "glTextureParameterfvEXT",
+  "glTextureParameteriEXT",
+  "glTextureParameterivEXT",
+  "glTextureRenderbufferEXT",
+  "glTextureSubImage1DEXT",
+  "glTextureSubImage2DEXT",
+  "glTextureSubImage3DEXT",
+  "glUnmapNamedBufferEXT",
+  "glVertexArrayColorOffsetEXT",
+  "glVertexArrayEdgeFlagOffsetEXT",
+  "glVertexArrayFogCoordOffsetEXT",
+  "glVertexArrayIndexOffsetEXT",
+  "glVertexArrayMultiTexCoordOffsetEXT",
+  "glVertexArrayNormalOffsetEXT",
+  "glVertexArraySecondaryColorOffsetEXT",
+  "glVertexArrayTexCoordOffsetEXT",
+  "glVertexArrayVertexAttribDivisorEXT",
+  "glVertexArrayVertexAttribIOffsetEXT",
+  "glVertexArrayVertexAttribOffsetEXT",
+  "glVertexArrayVertexOffsetEXT",
+  "glDiscardFramebufferEXT",
+  "glBeginQueryEXT",
+  "glDeleteQueriesEXT",
+  "glEndQueryEXT",
+  "glGenQueriesEXT",
+  "glGetInteger64vEXT",
+  "glGetQueryObjectivEXT",
+  "glGetQueryObjectuivEXT",
+  "glGetQueryivEXT",
+  "glIsQueryEXT",
+  "glQueryCounterEXT",
+  "glDrawBuffersEXT",
+  "glColorMaskIndexedEXT",
+  "glDisableIndexedEXT",
+  "glEnableIndexedEXT",
+  "glGetBooleanIndexedvEXT",
+  "glGetIntegerIndexedvEXT",
+  "glIsEnabledIndexedEXT",
+  "glBlendEquationSeparateiEXT",
+  "glBlendEquationiEXT",
+  "glBlendFuncSeparateiEXT",
+  "glBlendFunciEXT",
+  "glColorMaskiEXT",
+  "glDisableiEXT",
+  "glEnableiEXT",
+  "glIsEnablediEXT",
+  "glDrawElementsBaseVertexEXT",
+  "glDrawElementsInstancedBaseVertexEXT",
+  "glDrawRangeElementsBaseVertexEXT",
+  "glMultiDrawElementsBaseVertexEXT",
+  "glDrawArraysInstancedEXT",
+  "glDrawElementsInstancedEXT",
+  "glDrawRangeElementsEXT",
+  "glDrawTransformFeedbackEXT",
+  "glDrawTransformFeedbackInstancedEXT",
+  "glBufferStorageExternalEXT",
+  "glNamedBufferStorageExternalEXT",
+  "glFogCoordPointerEXT",
+  "glFogCoorddEXT",
+  "glFogCoorddvEXT",
+  "glFogCoordfEXT",
+  "glFogCoordfvEXT",
+  "glFragmentColorMaterialEXT",
+  "glFragmentLightModelfEXT",
+  "glFragmentLightModelfvEXT",
+  "glFragmentLightModeliEXT",
+  "glFragmentLightModelivEXT",
+  "glFragmentLightfEXT",
+  "glFragmentLightfvEXT",
+  "glFragmentLightiEXT",
+  "glFragmentLightivEXT",
+  "glFragmentMaterialfEXT",
+  "glFragmentMaterialfvEXT",
+  "glFragmentMaterialiEXT",
+  "glFragmentMaterialivEXT",
+  "glGetFragmentLightfvEXT",
+  "glGetFragmentLightivEXT",
+  "glGetFragmentMaterialfvEXT",
+  "glGetFragmentMaterialivEXT",
+  "glLightEnviEXT",
+  "glBlitFramebufferEXT",
+  "glRenderbufferStorageMultisampleEXT",
+  "glBindFramebufferEXT",
+  "glBindRenderbufferEXT",
+  "glCheckFramebufferStatusEXT",
+  "glDeleteFramebuffersEXT",
+  "glDeleteRenderbuffersEXT",
+  "glFramebufferRenderbufferEXT",
+  "glFramebufferTexture1DEXT",
+  "glFramebufferTexture2DEXT",
+  "glFramebufferTexture3DEXT",
+  "glGenFramebuffersEXT",
+  "glGenRenderbuffersEXT",
+  "glGenerateMipmapEXT",
+  "glGetFramebufferAttachmentParameterivEXT",
+  "glGetRenderbufferParameterivEXT",
+  "glIsFramebufferEXT",
+  "glIsRenderbufferEXT",
+  "glRenderbufferStorageEXT",
+  "glFramebufferTextureEXT",
+  "glFramebufferTextureFaceEXT",
+  "glProgramParameteriEXT",
+  "glProgramEnvParameters4fvEXT",
+  "glProgramLocalParameters4fvEXT",
+  "glBindFragDataLocationEXT",
+  "glGetFragDataLocationEXT",
+  "glGetUniformuivEXT",
+  "glGetVertexAttribIivEXT",
+  "glGetVertexAttribIuivEXT",
+  "glUniform1uiEXT",
+  "glUniform1uivEXT",
+  "glUniform2uiEXT",
+  "glUniform2uivEXT",
+  "glUniform3uiEXT",
+  "glUniform3uivEXT",
+  "glUniform4uiEXT",
+  "glUniform4uivEXT",
+  "glVertexAttribI1iEXT",
+  "glVertexAttribI1ivEXT",
+  "glVertexAttribI1uiEXT",
+  "glVertexAttribI1uivEXT",
+  "glVertexAttribI2iEXT",
+  "glVertexAttribI2ivEXT",
+  "glVertexAttribI2uiEXT",
+  "glVertexAttribI2uivEXT",
+  "glVertexAttribI3iEXT",
+  "glVertexAttribI3ivEXT",
+  "glVertexAttribI3uiEXT",
+  "glVertexAttribI3uivEXT",
+  "glVertexAttribI4bvEXT",
+  "glVertexAttribI4iEXT",
+  "glVertexAttribI4ivEXT",
+  "glVertexAttribI4svEXT",
+  "glVertexAttribI4ubvEXT",
+  "glVertexAttribI4uiEXT",
+  "glVertexAttribI4uivEXT",
+  "glVertexAttribI4usvEXT",
+  "glVertexAttribIPointerEXT",
+  "glGetHistogramEXT",
+  "glGetHistogramParameterfvEXT",
+  "glGetHistogramParameterivEXT",
+  "glGetMinmaxEXT",
+  "glGetMinmaxParameterfvEXT",
+  "glGetMinmaxParameterivEXT",
+  "glHistogramEXT",
+  "glMinmaxEXT",
+  "glResetHistogramEXT",
+  "glResetMinmaxEXT",
+  "glIndexFuncEXT",
+  "glIndexMaterialEXT",
+  "glVertexAttribDivisorEXT",
+  "glApplyTextureEXT",
+  "glTextureLightEXT",
+  "glTextureMaterialEXT",
+  "glFlushMappedBufferRangeEXT",
+  "glMapBufferRangeEXT",
+  "glBufferStorageMemEXT",
+  "glCreateMemoryObjectsEXT",
+  "glDeleteMemoryObjectsEXT",
+  "glGetMemoryObjectParameterivEXT",
+  "glGetUnsignedBytei_vEXT",
+  "glGetUnsignedBytevEXT",
+  "glIsMemoryObjectEXT",
+  "glMemoryObjectParameterivEXT",
+  "glNamedBufferStorageMemEXT",
+  "glTexStorageMem1DEXT",
+  "glTexStorageMem2DEXT",
+  "glTexStorageMem2DMultisampleEXT",
+  "glTexStorageMem3DEXT",
+  "glTexStorageMem3DMultisampleEXT",
+  "glTextureStorageMem1DEXT",
+  "glTextureStorageMem2DEXT",
+  "glTextureStorageMem2DMultisampleEXT",
+  "glTextureStorageMem3DEXT",
+  "glTextureStorageMem3DMultisampleEXT",
+  "glImportMemoryFdEXT",
+  "glImportMemoryWin32HandleEXT",
+  "glImportMemoryWin32NameEXT",
+  "glMultiDrawArraysEXT",
+  "glMultiDrawElementsEXT",
+  "glMultiDrawArraysIndirectEXT",
+  "glMultiDrawElementsIndirectEXT",
+  "glSampleMaskEXT",
+  "glSamplePatternEXT",
+  "glFramebufferTexture2DMultisampleEXT",
+  "glDrawBuffersIndexedEXT",
+  "glGetIntegeri_vEXT",
+  "glReadBufferIndexedEXT",
+  "glColorTableEXT",
+  "glGetColorTableEXT",
+  "glGetColorTableParameterfvEXT",
+  "glGetColorTableParameterivEXT",
+  "glGetPixelTransformParameterfvEXT",
+  "glGetPixelTransformParameterivEXT",
+  "glPixelTransformParameterfEXT",
+  "glPixelTransformParameterfvEXT",
+  "glPixelTransformParameteriEXT",
+  "glPixelTransformParameterivEXT",
+  "glPointParameterfEXT",
+  "glPointParameterfvEXT",
+  "glPolygonOffsetEXT",
+  "glPolygonOffsetClampEXT",
+  "glPrimitiveBoundingBoxEXT",
+  "glProvokingVertexEXT",
+  "glCoverageModulationNV",
+  "glCoverageModulationTableNV",
+  "glGetCoverageModulationTableNV",
+  "glRasterSamplesEXT",
+  "glGetnUniformfvEXT",
+  "glGetnUniformivEXT",
+  "glReadnPixelsEXT",
+  "glBeginSceneEXT",
+  "glEndSceneEXT",
+  "glSecondaryColor3bEXT",
+  "glSecondaryColor3bvEXT",
+  "glSecondaryColor3dEXT",
+  "glSecondaryColor3dvEXT",
+  "glSecondaryColor3fEXT",
+  "glSecondaryColor3fvEXT",
+  "glSecondaryColor3iEXT",
+  "glSecondaryColor3ivEXT",
+  "glSecondaryColor3sEXT",
+  "glSecondaryColor3svEXT",
+  "glSecondaryColor3ubEXT",
+  "glSecondaryColor3ubvEXT",
+  "glSecondaryColor3uiEXT",
+  "glSecondaryColor3uivEXT",
+  "glSecondaryColor3usEXT",
+  "glSecondaryColor3usvEXT",
+  "glSecondaryColorPointerEXT",
+  "glDeleteSemaphoresEXT",
+  "glGenSemaphoresEXT",
+  "glGetSemaphoreParameterui64vEXT",
+  "glIsSemaphoreEXT",
+  "glSemaphoreParameterui64vEXT",
+  "glSignalSemaphoreEXT",
+  "glWaitSemaphoreEXT",
+  "glImportSemaphoreFdEXT",
+  "glImportSemaphoreWin32HandleEXT",
+  "glImportSemaphoreWin32NameEXT",
+  "glActiveProgramEXT",
+  "glCreateShaderProgramEXT",
+  "glUseShaderProgramEXT",
+  "glFramebufferFetchBarrierEXT",
+  "glBindImageTextureEXT",
+  "glMemoryBarrierEXT",
+  "glClearPixelLocalStorageuiEXT",
+  "glFramebufferPixelLocalStorageSizeEXT",
+  "glGetFramebufferPixelLocalStorageSizeEXT",
+  "glTexPageCommitmentEXT",
+  "glTexturePageCommitmentEXT",
+  "glActiveStencilFaceEXT",
+  "glTexSubImage1DEXT",
+  "glTexSubImage2DEXT",
+  "glTexSubImage3DEXT",
+  "glPatchParameteriEXT",
+  "glTexImage3DEXT",
+  "glFramebufferTextureLayerEXT",
+  "glGetSamplerParameterIivEXT",
+  "glGetSamplerParameterIuivEXT",
+  "glSamplerParameterIivEXT",
+  "glSamplerParameterIuivEXT",
+  "glTexBufferEXT",
+  "glClearColorIiEXT",
+  "glClearColorIuiEXT",
+  "glGetTexParameterIivEXT",
+  "glGetTexParameterIuivEXT",
+  "glTexParameterIivEXT",
+  "glTexParameterIuivEXT",
+  "glAreTexturesResidentEXT",
+  "glBindTextureEXT",
+  "glDeleteTexturesEXT",
+  "glGenTexturesEXT",
+  "glIsTextureEXT",
+  "glPrioritizeTexturesEXT",
+  "glTextureNormalEXT",
+  "glTexStorage1DEXT",
+  "glTexStorage2DEXT",
+  "glTexStorage3DEXT",
+  "glTextureStorage1DEXT",
+  "glTextureStorage2DEXT",
+  "glTextureStorage3DEXT",
+  "glTextureViewEXT",
+  "glGetQueryObjecti64vEXT",
+  "glGetQueryObjectui64vEXT",
+  "glBeginTransformFeedbackEXT",
+  "glBindBufferBaseEXT",
+  "glBindBufferOffsetEXT",
+  "glBindBufferRangeEXT",
+  "glEndTransformFeedbackEXT",
+  "glGetTransformFeedbackVaryingEXT",
+  "glTransformFeedbackVaryingsEXT",
+  "glArrayElementEXT",
+  "glColorPointerEXT",
+  "glDrawArraysEXT",
+  "glEdgeFlagPointerEXT",
+  "glIndexPointerEXT",
+  "glNormalPointerEXT",
+  "glTexCoordPointerEXT",
+  "glVertexPointerEXT",
+  "glBindArraySetEXT",
+  "glCreateArraySetExt",
+  "glDeleteArraySetsEXT",
+  "glGetVertexAttribLdvEXT",
+  "glVertexArrayVertexAttribLOffsetEXT",
+  "glVertexAttribL1dEXT",
+  "glVertexAttribL1dvEXT",
+  "glVertexAttribL2dEXT",
+  "glVertexAttribL2dvEXT",
+  "glVertexAttribL3dEXT",
+  "glVertexAttribL3dvEXT",
+  "glVertexAttribL4dEXT",
+  "glVertexAttribL4dvEXT",
+  "glVertexAttribLPointerEXT",
+  "glBeginVertexShaderEXT",
+  "glBindLightParameterEXT",
+  "glBindMaterialParameterEXT",
+  "glBindParameterEXT",
+  "glBindTexGenParameterEXT",
+  "glBindTextureUnitParameterEXT",
+  "glBindVertexShaderEXT",
+  "glDeleteVertexShaderEXT",
+  "glDisableVariantClientStateEXT",
+  "glEnableVariantClientStateEXT",
+  "glEndVertexShaderEXT",
+  "glExtractComponentEXT",
+  "glGenSymbolsEXT",
+  "glGenVertexShadersEXT",
+  "glGetInvariantBooleanvEXT",
+  "glGetInvariantFloatvEXT",
+  "glGetInvariantIntegervEXT",
+  "glGetLocalConstantBooleanvEXT",
+  "glGetLocalConstantFloatvEXT",
+  "glGetLocalConstantIntegervEXT",
+  "glGetVariantBooleanvEXT",
+  "glGetVariantFloatvEXT",
+  "glGetVariantIntegervEXT",
+  "glGetVariantPointervEXT",
+  "glInsertComponentEXT",
+  "glIsVariantEnabledEXT",
+  "glSetInvariantEXT",
+  "glSetLocalConstantEXT",
+  "glShaderOp1EXT",
+  "glShaderOp2EXT",
+  "glShaderOp3EXT",
+  "glSwizzleEXT",
+  "glVariantPointerEXT",
+  "glVariantbvEXT",
+  "glVariantdvEXT",
+  "glVariantfvEXT",
+  "glVariantivEXT",
+  "glVariantsvEXT",
+  "glVariantubvEXT",
+  "glVariantuivEXT",
+  "glVariantusvEXT",
+  "glWriteMaskEXT",
+  "glVertexWeightPointerEXT",
+  "glVertexWeightfEXT",
+  "glVertexWeightfvEXT",
+  "glAcquireKeyedMutexWin32EXT",
+  "glReleaseKeyedMutexWin32EXT",
+  "glWindowRectanglesEXT",
+  "glImportSyncEXT",
+  "glFrameTerminatorGREMEDY",
+  "glStringMarkerGREMEDY",
+  "glGetImageTransformParameterfvHP",
+  "glGetImageTransformParameterivHP",
+  "glImageTransformParameterfHP",
+  "glImageTransformParameterfvHP",
+  "glImageTransformParameteriHP",
+  "glImageTransformParameterivHP",
+  "glMultiModeDrawArraysIBM",
+  "glMultiModeDrawElementsIBM",
+  "glColorPointerListIBM",
+  "glEdgeFlagPointerListIBM",
+  "glFogCoordPointerListIBM",
+  "glIndexPointerListIBM",
+  "glNormalPointerListIBM",
+  "glSecondaryColorPointerListIBM",
+  "glTexCoordPointerListIBM",
+  "glVertexPointerListIBM",
+  "glGetTextureHandleIMG",
+  "glGetTextureSamplerHandleIMG",
+  "glProgramUniformHandleui64IMG",
+  "glProgramUniformHandleui64vIMG",
+  "glUniformHandleui64IMG",
+  "glUniformHandleui64vIMG",
+  "glFramebufferTexture2DDownsampleIMG",
+  "glFramebufferTextureLayerDownsampleIMG",
+  "glFramebufferTexture2DMultisampleIMG",
+  "glRenderbufferStorageMultisampleIMG",
+  "glMapTexture2DINTEL",
+  "glSyncTextureINTEL",
+  "glUnmapTexture2DINTEL",
+  "glColorPointervINTEL",
+  "glNormalPointervINTEL",
+  "glTexCoordPointervINTEL",
+  "glVertexPointervINTEL",
+  "glBeginPerfQueryINTEL",
+  "glCreatePerfQueryINTEL",
+  "glDeletePerfQueryINTEL",
+  "glEndPerfQueryINTEL",
+  "glGetFirstPerfQueryIdINTEL",
+  "glGetNextPerfQueryIdINTEL",
+  "glGetPerfCounterInfoINTEL",
+  "glGetPerfQueryDataINTEL",
+  "glGetPerfQueryIdByNameINTEL",
+  "glGetPerfQueryInfoINTEL",
+  "glTexScissorFuncINTEL",
+  "glTexScissorINTEL",
+  "glBlendBarrierKHR",
+  "glDebugMessageCallback",
+  "glDebugMessageControl",
+  "glDebugMessageInsert",
+  "glGetDebugMessageLog",
+  "glGetObjectLabel",
+  "glGetObjectPtrLabel",
+  "glObjectLabel",
+  "glObjectPtrLabel",
+  "glPopDebugGroup",
+  "glPushDebugGroup",
+  "glMaxShaderCompilerThreadsKHR",
+  "glGetnUniformfv",
+  "glGetnUniformiv",
+  "glGetnUniformuiv",
+  "glReadnPixels",
+  "glBufferRegionEnabled",
+  "glDeleteBufferRegion",
+  "glDrawBufferRegion",
+  "glNewBufferRegion",
+  "glReadBufferRegion",
+  "glFramebufferParameteriMESA",
+  "glGetFramebufferParameterivMESA",
+  "glResizeBuffersMESA",
+  "glWindowPos2dMESA",
+  "glWindowPos2dvMESA",
+  "glWindowPos2fMESA",
+  "glWindowPos2fvMESA",
+  "glWindowPos2iMESA",
+  "glWindowPos2ivMESA",
+  "glWindowPos2sMESA",
+  "glWindowPos2svMESA",
+  "glWindowPos3dMESA",
+  "glWindowPos3dvMESA",
+  "glWindowPos3fMESA",
+  "glWindowPos3fvMESA",
+  "glWindowPos3iMESA",
+  "glWindowPos3ivMESA",
+  "glWindowPos3sMESA",
+  "glWindowPos3svMESA",
+  "glWindowPos4dMESA",
+  "glWindowPos4dvMESA",
+  "glWindowPos4fMESA",
+  "glWindowPos4fvMESA",
+  "glWindowPos4iMESA",
+  "glWindowPos4ivMESA",
+  "glWindowPos4sMESA",
+  "glWindowPos4svMESA",
+  "glBeginConditionalRenderNVX",
+  "glEndConditionalRenderNVX",
+  "glAsyncCopyBufferSubDataNVX",
+  "glAsyncCopyImageSubDataNVX",
+  "glMulticastScissorArrayvNVX",
+  "glMulticastViewportArrayvNVX",
+  "glMulticastViewportPositionWScaleNVX",
+  "glUploadGpuMaskNVX",
+  "glLGPUCopyImageSubDataNVX",
+  "glLGPUInterlockNVX",
+  "glLGPUNamedBufferSubDataNVX",
+  "glClientWaitSemaphoreui64NVX",
+  "glSignalSemaphoreui64NVX",
+  "glWaitSemaphoreui64NVX",
+  "glStereoParameterfNV",
+  "glStereoParameteriNV",
+  "glAlphaToCoverageDitherControlNV",
+  "glMultiDrawArraysIndirectBindlessNV",
+  "glMultiDrawElementsIndirectBindlessNV",
+  "glMultiDrawArraysIndirectBindlessCountNV",
+  "glMultiDrawElementsIndirectBindlessCountNV",
+  "glGetImageHandleNV",
+  "glGetTextureHandleNV",
+  "glGetTextureSamplerHandleNV",
+  "glIsImageHandleResidentNV",
+  "glIsTextureHandleResidentNV",
+  "glMakeImageHandleNonResidentNV",
+  "glMakeImageHandleResidentNV",
+  "glMakeTextureHandleNonResidentNV",
+  "glMakeTextureHandleResidentNV",
+  "glProgramUniformHandleui64NV",
+  "glProgramUniformHandleui64vNV",
+  "glUniformHandleui64NV",
+  "glUniformHandleui64vNV",
+  "glBlendBarrierNV",
+  "glBlendParameteriNV",
+  "glViewportPositionWScaleNV",
+  "glCallCommandListNV",
+  "glCommandListSegmentsNV",
+  "glCompileCommandListNV",
+  "glCreateCommandListsNV",
+  "glCreateStatesNV",
+  "glDeleteCommandListsNV",
+  "glDeleteStatesNV",
+  "glDrawCommandsAddressNV",
+  "glDrawCommandsNV",
+  "glDrawCommandsStatesAddressNV",
+  "glDrawCommandsStatesNV",
+  "glGetCommandHeaderNV",
+  "glGetStageIndexNV",
+  "glIsCommandListNV",
+  "glIsStateNV",
+  "glListDrawCommandsStatesClientNV",
+  "glStateCaptureNV",
+  "glBeginConditionalRenderNV",
+  "glEndConditionalRenderNV",
+  "glSubpixelPrecisionBiasNV",
+  "glConservativeRasterParameterfNV",
+  "glConservativeRasterParameteriNV",
+  "glCopyBufferSubDataNV",
+  "glCopyImageSubDataNV",
+  "glClearDepthdNV",
+  "glDepthBoundsdNV",
+  "glDepthRangedNV",
+  "glDrawBuffersNV",
+  "glDrawArraysInstancedNV",
+  "glDrawElementsInstancedNV",
+  "glDrawTextureNV",
+  "glDrawVkImageNV",
+  "glGetVkProcAddrNV",
+  "glSignalVkFenceNV",
+  "glSignalVkSemaphoreNV",
+  "glWaitVkSemaphoreNV",
+  "glEvalMapsNV",
+  "glGetMapAttribParameterfvNV",
+  "glGetMapAttribParameterivNV",
+  "glGetMapControlPointsNV",
+  "glGetMapParameterfvNV",
+  "glGetMapParameterivNV",
+  "glMapControlPointsNV",
+  "glMapParameterfvNV",
+  "glMapParameterivNV",
+  "glGetMultisamplefvNV",
+  "glSampleMaskIndexedNV",
+  "glTexRenderbufferNV",
+  "glDeleteFencesNV",
+  "glFinishFenceNV",
+  "glGenFencesNV",
+  "glGetFenceivNV",
+  "glIsFenceNV",
+  "glSetFenceNV",
+  "glTestFenceNV",
+  "glFragmentCoverageColorNV",
+  "glGetProgramNamedParameterdvNV",
+  "glGetProgramNamedParameterfvNV",
+  "glProgramNamedParameter4dNV",
+  "glProgramNamedParameter4dvNV",
+  "glProgramNamedParameter4fNV",
+  "glProgramNamedParameter4fvNV",
+  "glBlitFramebufferNV",
+  "glRenderbufferStorageMultisampleNV",
+  "glRenderbufferStorageMultisampleCoverageNV",
+  "glProgramVertexLimitNV",
+  "glMulticastBarrierNV",
+  "glMulticastBlitFramebufferNV",
+  "glMulticastBufferSubDataNV",
+  "glMulticastCopyBufferSubDataNV",
+  "glMulticastCopyImageSubDataNV",
+  "glMulticastFramebufferSampleLocationsfvNV",
+  "glMulticastGetQueryObjecti64vNV",
+  "glMulticastGetQueryObjectivNV",
+  "glMulticastGetQueryObjectui64vNV",
+  "glMulticastGetQueryObjectuivNV",
+  "glMulticastWaitSyncNV",
+  "glRenderGpuMaskNV",
+  "glProgramEnvParameterI4iNV",
+  "glProgramEnvParameterI4ivNV",
+  "glProgramEnvParameterI4uiNV",
+  "glProgramEnvParameterI4uivNV",
+  "glProgramEnvParametersI4ivNV",
+  "glProgramEnvParametersI4uivNV",
+  "glProgramLocalParameterI4iNV",
+  "glProgramLocalParameterI4ivNV",
+  "glProgramLocalParameterI4uiNV",
+  "glProgramLocalParameterI4uivNV",
+  "glProgramLocalParametersI4ivNV",
+  "glProgramLocalParametersI4uivNV",
+  "glGetUniformi64vNV",
+  "glGetUniformui64vNV",
+  "glProgramUniform1i64NV",
+  "glProgramUniform1i64vNV",
+  "glProgramUniform1ui64NV",
+  "glProgramUniform1ui64vNV",
+  "glProgramUniform2i64NV",
+  "glProgramUniform2i64vNV",
+  "glProgramUniform2ui64NV",
+  "glProgramUniform2ui64vNV",
+  "glProgramUniform3i64NV",
+  "glProgramUniform3i64vNV",
+  "glProgramUniform3ui64NV",
+  "glProgramUniform3ui64vNV",
+  "glProgramUniform4i64NV",
+  "glProgramUniform4i64vNV",
+  "glProgramUniform4ui64NV",
+  "glProgramUniform4ui64vNV",
+  "glUniform1i64NV",
+  "glUniform1i64vNV",
+  "glUniform1ui64NV",
+  "glUniform1ui64vNV",
+  "glUniform2i64NV",
+  "glUniform2i64vNV",
+  "glUniform2ui64NV",
+  "glUniform2ui64vNV",
+  "glUniform3i64NV",
+  "glUniform3i64vNV",
+  "glUniform3ui64NV",
+  "glUniform3ui64vNV",
+  "glUniform4i64NV",
+  "glUniform4i64vNV",
+  "glUniform4ui64NV",
+  "glUniform4ui64vNV",
+  "glColor3hNV",
+  "glColor3hvNV",
+  "glColor4hNV",
+  "glColor4hvNV",
+  "glFogCoordhNV",
+  "glFogCoordhvNV",
+  "glMultiTexCoord1hNV",
+  "glMultiTexCoord1hvNV",
+  "glMultiTexCoord2hNV",
+  "glMultiTexCoord2hvNV",
+  "glMultiTexCoord3hNV",
+  "glMultiTexCoord3hvNV",
+  "glMultiTexCoord4hNV",
+  "glMultiTexCoord4hvNV",
+  "glNormal3hNV",
+  "glNormal3hvNV",
+  "glSecondaryColor3hNV",
+  "glSecondaryColor3hvNV",
+  "glTexCoord1hNV",
+  "glTexCoord1hvNV",
+  "glTexCoord2hNV",
+  "glTexCoord2hvNV",
+  "glTexCoord3hNV",
+  "glTexCoord3hvNV",
+  "glTexCoord4hNV",
+  "glTexCoord4hvNV",
+  "glVertex2hNV",
+  "glVertex2hvNV",
+  "glVertex3hNV",
+  "glVertex3hvNV",
+  "glVertex4hNV",
+  "glVertex4hvNV",
+  "glVertexAttrib1hNV",
+  "glVertexAttrib1hvNV",
+  "glVertexAttrib2hNV",
+  "glVertexAttrib2hvNV",
+  "glVertexAttrib3hNV",
+  "glVertexAttrib3hvNV",
+  "glVertexAttrib4hNV",
+  "glVertexAttrib4hvNV",
+  "glVertexAttribs1hvNV",
+  "glVertexAttribs2hvNV",
+  "glVertexAttribs3hvNV",
+  "glVertexAttribs4hvNV",
+  "glVertexWeighthNV",
+  "glVertexWeighthvNV",
+  "glVertexAttribDivisorNV",
+  "glGetInternalformatSampleivNV",
+  "glBufferAttachMemoryNV",
+  "glGetMemoryObjectDetachedResourcesuivNV",
+  "glNamedBufferAttachMemoryNV",
+  "glResetMemoryObjectParameterNV",
+  "glTexAttachMemoryNV",
+  "glTextureAttachMemoryNV",
+  "glDrawMeshTasksIndirectNV",
+  "glDrawMeshTasksNV",
+  "glMultiDrawMeshTasksIndirectCountNV",
+  "glMultiDrawMeshTasksIndirectNV",
+  "glUniformMatrix2x3fvNV",
+  "glUniformMatrix2x4fvNV",
+  "glUniformMatrix3x2fvNV",
+  "glUniformMatrix3x4fvNV",
+  "glUniformMatrix4x2fvNV",
+  "glUniformMatrix4x3fvNV",
+  "glBeginOcclusionQueryNV",
+  "glDeleteOcclusionQueriesNV",
+  "glEndOcclusionQueryNV",
+  "glGenOcclusionQueriesNV",
+  "glGetOcclusionQueryivNV",
+  "glGetOcclusionQueryuivNV",
+  "glIsOcclusionQueryNV",
+  "glProgramBufferParametersIivNV",
+  "glProgramBufferParametersIuivNV",
+  "glProgramBufferParametersfvNV",
+  "glCopyPathNV",
+  "glCoverFillPathInstancedNV",
+  "glCoverFillPathNV",
+  "glCoverStrokePathInstancedNV",
+  "glCoverStrokePathNV",
+  "glDeletePathsNV",
+  "glGenPathsNV",
+  "glGetPathColorGenfvNV",
+  "glGetPathColorGenivNV",
+  "glGetPathCommandsNV",
+  "glGetPathCoordsNV",
+  "glGetPathDashArrayNV",
+  "glGetPathLengthNV",
+  "glGetPathMetricRangeNV",
+  "glGetPathMetricsNV",
+  "glGetPathParameterfvNV",
+  "glGetPathParameterivNV",
+  "glGetPathSpacingNV",
+  "glGetPathTexGenfvNV",
+  "glGetPathTexGenivNV",
+  "glGetProgramResourcefvNV",
+  "glInterpolatePathsNV",
+  "glIsPathNV",
+  "glIsPointInFillPathNV",
+  "glIsPointInStrokePathNV",
+  "glMatrixLoad3x2fNV",
+  "glMatrixLoad3x3fNV",
+  "glMatrixLoadTranspose3x3fNV",
+  "glMatrixMult3x2fNV",
+  "glMatrixMult3x3fNV",
+  "glMatrixMultTranspose3x3fNV",
+  "glPathColorGenNV",
+  "glPathCommandsNV",
+  "glPathCoordsNV",
+  "glPathCoverDepthFuncNV",
+  "glPathDashArrayNV",
+  "glPathFogGenNV",
+  "glPathGlyphIndexArrayNV",
+  "glPathGlyphIndexRangeNV",
+  "glPathGlyphRangeNV",
+  "glPathGlyphsNV",
+  "glPathMemoryGlyphIndexArrayNV",
+  "glPathParameterfNV",
+  "glPathParameterfvNV",
+  "glPathParameteriNV",
+  "glPathParameterivNV",
+  "glPathStencilDepthOffsetNV",
+  "glPathStencilFuncNV",
+  "glPathStringNV",
+  "glPathSubCommandsNV",
+  "glPathSubCoordsNV",
+  "glPathTexGenNV",
+  "glPointAlongPathNV",
+  "glProgramPathFragmentInputGenNV",
+  "glStencilFillPathInstancedNV",
+  "glStencilFillPathNV",
+  "glStencilStrokePathInstancedNV",
+  "glStencilStrokePathNV",
+  "glStencilThenCoverFillPathInstancedNV",
+  "glStencilThenCoverFillPathNV",
+  "glStencilThenCoverStrokePathInstancedNV",
+  "glStencilThenCoverStrokePathNV",
+  "glTransformPathNV",
+  "glWeightPathsNV",
+  "glFlushPixelDataRangeNV",
+  "glPixelDataRangeNV",
+  "glPointParameteriNV",
+  "glPointParameterivNV",
+  "glPolygonModeNV",
+  "glGetVideoi64vNV",
+  "glGetVideoivNV",
+  "glGetVideoui64vNV",
+  "glGetVideouivNV",
+  "glPresentFrameDualFillNV",
+  "glPresentFrameKeyedNV",
+  "glPrimitiveRestartIndexNV",
+  "glPrimitiveRestartNV",
+  "glReadBufferNV",
+  "glCombinerInputNV",
+  "glCombinerOutputNV",
+  "glCombinerParameterfNV",
+  "glCombinerParameterfvNV",
+  "glCombinerParameteriNV",
+  "glCombinerParameterivNV",
+  "glFinalCombinerInputNV",
+  "glGetCombinerInputParameterfvNV",
+  "glGetCombinerInputParameterivNV",
+  "glGetCombinerOutputParameterfvNV",
+  "glGetCombinerOutputParameterivNV",
+  "glGetFinalCombinerInputParameterfvNV",
+  "glGetFinalCombinerInputParameterivNV",
+  "glCombinerStageParameterfvNV",
+  "glGetCombinerStageParameterfvNV",
+  "glFramebufferSampleLocationsfvNV",
+  "glNamedFramebufferSampleLocationsfvNV",
+  "glResolveDepthValuesNV",
+  "glScissorExclusiveArrayvNV",
+  "glScissorExclusiveNV",
+  "glGetBufferParameterui64vNV",
+  "glGetIntegerui64vNV",
+  "glGetNamedBufferParameterui64vNV",
+  "glIsBufferResidentNV",
+  "glIsNamedBufferResidentNV",
+  "glMakeBufferNonResidentNV",
+  "glMakeBufferResidentNV",
+  "glMakeNamedBufferNonResidentNV",
+  "glMakeNamedBufferResidentNV",
+  "glProgramUniformui64NV",
+  "glProgramUniformui64vNV",
+  "glUniformui64NV",
+  "glUniformui64vNV",
+  "glBindShadingRateImageNV",
+  "glGetShadingRateImagePaletteNV",
+  "glGetShadingRateSampleLocationivNV",
+  "glShadingRateImageBarrierNV",
+  "glShadingRateImagePaletteNV",
+  "glShadingRateSampleOrderCustomNV",
+  "glCompressedTexImage3DNV",
+  "glCompressedTexSubImage3DNV",
+  "glCopyTexSubImage3DNV",
+  "glFramebufferTextureLayerNV",
+  "glTexImage3DNV",
+  "glTexSubImage3DNV",
+  "glTextureBarrierNV",
+  "glTexImage2DMultisampleCoverageNV",
+  "glTexImage3DMultisampleCoverageNV",
+  "glTextureImage2DMultisampleCoverageNV",
+  "glTextureImage2DMultisampleNV",
+  "glTextureImage3DMultisampleCoverageNV",
+  "glTextureImage3DMultisampleNV",
+  "glActiveVaryingNV",
+  "glBeginTransformFeedbackNV",
+  "glBindBufferBaseNV",
+  "glBindBufferOffsetNV",
+  "glBindBufferRangeNV",
+  "glEndTransformFeedbackNV",
+  "glGetActiveVaryingNV",
+  "glGetTransformFeedbackVaryingNV",
+  "glGetVaryingLocationNV",
+  "glTransformFeedbackAttribsNV",
+  "glTransformFeedbackVaryingsNV",
+  "glBindTransformFeedbackNV",
+  "glDeleteTransformFeedbacksNV",
+  "glDrawTransformFeedbackNV",
+  "glGenTransformFeedbacksNV",
+  "glIsTransformFeedbackNV",
+  "glPauseTransformFeedbackNV",
+  "glResumeTransformFeedbackNV",
+  "glVDPAUFiniNV",
+  "glVDPAUGetSurfaceivNV",
+  "glVDPAUInitNV",
+  "glVDPAUIsSurfaceNV",
+  "glVDPAUMapSurfacesNV",
+  "glVDPAURegisterOutputSurfaceNV",
+  "glVDPAURegisterVideoSurfaceNV",
+  "glVDPAUSurfaceAccessNV",
+  "glVDPAUUnmapSurfacesNV",
+  "glVDPAUUnregisterSurfaceNV",
+  "glVDPAURegisterVideoSurfaceWithPictureStructureNV",
+  "glFlushVertexArrayRangeNV",
+  "glVertexArrayRangeNV",
+  "glGetVertexAttribLi64vNV",
+  "glGetVertexAttribLui64vNV",
+  "glVertexAttribL1i64NV",
+  "glVertexAttribL1i64vNV",
+  "glVertexAttribL1ui64NV",
+  "glVertexAttribL1ui64vNV",
+  "glVertexAttribL2i64NV",
+  "glVertexAttribL2i64vNV",
+  "glVertexAttribL2ui64NV",
+  "glVertexAttribL2ui64vNV",
+  "glVertexAttribL3i64NV",
+  "glVertexAttribL3i64vNV",
+  "glVertexAttribL3ui64NV",
+  "glVertexAttribL3ui64vNV",
+  "glVertexAttribL4i64NV",
+  "glVertexAttribL4i64vNV",
+  "glVertexAttribL4ui64NV",
+  "glVertexAttribL4ui64vNV",
+  "glVertexAttribLFormatNV",
+  "glBufferAddressRangeNV",
+  "glColorFormatNV",
+  "glEdgeFlagFormatNV",
+  "glFogCoordFormatNV",
+  "glGetIntegerui64i_vNV",
+  "glIndexFormatNV",
+  "glNormalFormatNV",
+  "glSecondaryColorFormatNV",
+  "glTexCoordFormatNV",
+  "glVertexAttribFormatNV",
+  "glVertexAttribIFormatNV",
+  "glVertexFormatNV",
+  "glAreProgramsResidentNV",
+  "glBindProgramNV",
+  "glDeleteProgramsNV",
+  "glExecuteProgramNV",
+  "glGenProgramsNV",
+  "glGetProgramParameterdvNV",
+  "glGetProgramParameterfvNV",
+  "glGetProgramStringNV",
+  "glGetProgramivNV",
+  "glGetTrackMatrixivNV",
+  "glGetVertexAttribPointervNV",
+  "glGetVertexAttribdvNV",
+  "glGetVertexAttribfvNV",
+  "glGetVertexAttribivNV",
+  "glIsProgramNV",
+  "glLoadProgramNV",
+  "glProgramParameter4dNV",
+  "glProgramParameter4dvNV",
+  "glProgramParameter4fNV",
+  "glProgramParameter4fvNV",
+  "glProgramParameters4dvNV",
+  "glProgramParameters4fvNV",
+  "glRequestResidentProgramsNV",
+  "glTrackMatrixNV",
+  "glVertexAttrib1dNV",
+  "glVertexAttrib1dvNV",
+  "glVertexAttrib1fNV",
+  "glVertexAttrib1fvNV",
+  "glVertexAttrib1sNV",
+  "glVertexAttrib1svNV",
+  "glVertexAttrib2dNV",
+  "glVertexAttrib2dvNV",
+  "glVertexAttrib2fNV",
+  "glVertexAttrib2fvNV",
+  "glVertexAttrib2sNV",
+  "glVertexAttrib2svNV",
+  "glVertexAttrib3dNV",
+  "glVertexAttrib3dvNV",
+  "glVertexAttrib3fNV",
+  "glVertexAttrib3fvNV",
+  "glVertexAttrib3sNV",
+  "glVertexAttrib3svNV",
+  "glVertexAttrib4dNV",
+  "glVertexAttrib4dvNV",
+  "glVertexAttrib4fNV",
+  "glVertexAttrib4fvNV",
+  "glVertexAttrib4sNV",
+  "glVertexAttrib4svNV",
+  "glVertexAttrib4ubNV",
+  "glVertexAttrib4ubvNV",
+  "glVertexAttribPointerNV",
+  "glVertexAttribs1dvNV",
+  "glVertexAttribs1fvNV",
+  "glVertexAttribs1svNV",
+  "glVertexAttribs2dvNV",
+  "glVertexAttribs2fvNV",
+  "glVertexAttribs2svNV",
+  "glVertexAttribs3dvNV",
+  "glVertexAttribs3fvNV",
+  "glVertexAttribs3svNV",
+  "glVertexAttribs4dvNV",
+  "glVertexAttribs4fvNV",
+  "glVertexAttribs4svNV",
+  "glVertexAttribs4ubvNV",
+  "glBeginVideoCaptureNV",
+  "glBindVideoCaptureStreamBufferNV",
+  "glBindVideoCaptureStreamTextureNV",
+  "glEndVideoCaptureNV",
+  "glGetVideoCaptureStreamdvNV",
+  "glGetVideoCaptureStreamfvNV",
+  "glGetVideoCaptureStreamivNV",
+  "glGetVideoCaptureivNV",
+  "glVideoCaptureNV",
+  "glVideoCaptureStreamParameterdvNV",
+  "glVideoCaptureStreamParameterfvNV",
+  "glVideoCaptureStreamParameterivNV",
+  "glDepthRangeArrayfvNV",
+  "glDepthRangeIndexedfNV",
+  "glDisableiNV",
+  "glEnableiNV",
+  "glGetFloati_vNV",
+  "glIsEnablediNV",
+  "glScissorArrayvNV",
+  "glScissorIndexedNV",
+  "glScissorIndexedvNV",
+  "glViewportArrayvNV",
+  "glViewportIndexedfNV",
+  "glViewportIndexedfvNV",
+  "glViewportSwizzleNV",
+  "glEGLImageTargetRenderbufferStorageOES",
+  "glEGLImageTargetTexture2DOES",
+  "glBlendEquationSeparateOES",
+  "glBlendFuncSeparateOES",
+  "glBlendEquationOES",
+  "glCopyImageSubDataOES",
+  "glBlendEquationSeparateiOES",
+  "glBlendEquationiOES",
+  "glBlendFuncSeparateiOES",
+  "glBlendFunciOES",
+  "glColorMaskiOES",
+  "glDisableiOES",
+  "glEnableiOES",
+  "glIsEnablediOES",
+  "glBindFramebufferOES",
+  "glBindRenderbufferOES",
+  "glCheckFramebufferStatusOES",
+  "glDeleteFramebuffersOES",
+  "glDeleteRenderbuffersOES",
+  "glFramebufferRenderbufferOES",
+  "glFramebufferTexture2DOES",
+  "glGenFramebuffersOES",
+  "glGenRenderbuffersOES",
+  "glGenerateMipmapOES",
+  "glGetFramebufferAttachmentParameterivOES",
+  "glGetRenderbufferParameterivOES",
+  "glIsFramebufferOES",
+  "glIsRenderbufferOES",
+  "glRenderbufferStorageOES",
+  "glGetProgramBinaryOES",
+  "glProgramBinaryOES",
+  "glGetBufferPointervOES",
+  "glMapBufferOES",
+  "glUnmapBufferOES",
+  "glCurrentPaletteMatrixOES",
+  "glMatrixIndexPointerOES",
+  "glWeightPointerOES",
+  "glMinSampleShadingOES",
+  "glClearDepthfOES",
+  "glClipPlanefOES",
+  "glDepthRangefOES",
+  "glFrustumfOES",
+  "glGetClipPlanefOES",
+  "glOrthofOES",
+  "glCompressedTexImage3DOES",
+  "glCompressedTexSubImage3DOES",
+  "glCopyTexSubImage3DOES",
+  "glFramebufferTexture3DOES",
+  "glTexImage3DOES",
+  "glTexSubImage3DOES",
+  "glGetSamplerParameterIivOES",
+  "glGetSamplerParameterIuivOES",
+  "glGetTexParameterIivOES",
+  "glGetTexParameterIuivOES",
+  "glSamplerParameterIivOES",
+  "glSamplerParameterIuivOES",
+  "glTexParameterIivOES",
+  "glTexParameterIuivOES",
+  "glTexBufferOES",
+  "glTexBufferRangeOES",
+  "glGetTexGenfvOES",
+  "glGetTexGenivOES",
+  "glGetTexGenxvOES",
+  "glTexGenfOES",
+  "glTexGenfvOES",
+  "glTexGeniOES",
+  "glTexGenivOES",
+  "glTexGenxOES",
+  "glTexGenxvOES",
+  "glTexStorage3DMultisampleOES",
+  "glTextureViewOES",
+  "glBindVertexArrayOES",
+  "glDeleteVertexArraysOES",
+  "glGenVertexArraysOES",
+  "glIsVertexArrayOES",
+  "glFramebufferTextureMultiviewOVR",
+  "glNamedFramebufferTextureMultiviewOVR",
+  "glFramebufferTextureMultisampleMultiviewOVR",
+  "glAlphaFuncQCOM",
+  "glDisableDriverControlQCOM",
+  "glEnableDriverControlQCOM",
+  "glGetDriverControlStringQCOM",
+  "glGetDriverControlsQCOM",
+  "glExtGetBufferPointervQCOM",
+  "glExtGetBuffersQCOM",
+  "glExtGetFramebuffersQCOM",
+  "glExtGetRenderbuffersQCOM",
+  "glExtGetTexLevelParameterivQCOM",
+  "glExtGetTexSubImageQCOM",
+  "glExtGetTexturesQCOM",
+  "glExtTexObjectStateOverrideiQCOM",
+  "glExtGetProgramBinarySourceQCOM",
+  "glExtGetProgramsQCOM",
+  "glExtGetShadersQCOM",
+  "glExtIsProgramBinaryQCOM",
+  "glFramebufferFoveationConfigQCOM",
+  "glFramebufferFoveationParametersQCOM",
+  "glFramebufferFetchBarrierQCOM",
+  "glTextureFoveationParametersQCOM",
+  "glEndTilingQCOM",
+  "glStartTilingQCOM",
+  "glAlphaFuncx",
+  "glClearColorx",
+  "glClearDepthx",
+  "glColor4x",
+  "glDepthRangex",
+  "glFogx",
+  "glFogxv",
+  "glFrustumf",
+  "glFrustumx",
+  "glLightModelx",
+  "glLightModelxv",
+  "glLightx",
+  "glLightxv",
+  "glLineWidthx",
+  "glLoadMatrixx",
+  "glMaterialx",
+  "glMaterialxv",
+  "glMultMatrixx",
+  "glMultiTexCoord4x",
+  "glNormal3x",
+  "glOrthof",
+  "glOrthox",
+  "glPointSizex",
+  "glPolygonOffsetx",
+  "glRotatex",
+  "glSampleCoveragex",
+  "glScalex",
+  "glTexEnvx",
+  "glTexEnvxv",
+  "glTexParameterx",
+  "glTranslatex",
+  "glClipPlanef",
+  "glClipPlanex",
+  "glGetClipPlanef",
+  "glGetClipPlanex",
+  "glGetFixedv",
+  "glGetLightxv",
+  "glGetMaterialxv",
+  "glGetTexEnvxv",
+  "glGetTexParameterxv",
+  "glPointParameterx",
+  "glPointParameterxv",
+  "glPointSizePointerOES",
+  "glTexParameterxv",
+  "glErrorStringREGAL",
+  "glGetExtensionREGAL",
+  "glIsSupportedREGAL",
+  "glLogMessageCallbackREGAL",
+  "glGetProcAddressREGAL",
+  "glDetailTexFuncSGIS",
+  "glGetDetailTexFuncSGIS",
+  "glFogFuncSGIS",
+  "glGetFogFuncSGIS",
+  "glSampleMaskSGIS",
+  "glSamplePatternSGIS",
+  "glInterleavedTextureCoordSetsSGIS",
+  "glSelectTextureCoordSetSGIS",
+  "glSelectTextureSGIS",
+  "glSelectTextureTransformSGIS",
+  "glMultisampleSubRectPosSGIS",
+  "glGetSharpenTexFuncSGIS",
+  "glSharpenTexFuncSGIS",
+  "glTexImage4DSGIS",
+  "glTexSubImage4DSGIS",
+  "glGetTexFilterFuncSGIS",
+  "glTexFilterFuncSGIS",
+  "glAsyncMarkerSGIX",
+  "glDeleteAsyncMarkersSGIX",
+  "glFinishAsyncSGIX",
+  "glGenAsyncMarkersSGIX",
+  "glIsAsyncMarkerSGIX",
+  "glPollAsyncSGIX",
+  "glAddressSpace",
+  "glDataPipe",
+  "glFlushRasterSGIX",
+  "glFogLayersSGIX",
+  "glGetFogLayersSGIX",
+  "glTextureFogSGIX",
+  "glFragmentColorMaterialSGIX",
+  "glFragmentLightModelfSGIX",
+  "glFragmentLightModelfvSGIX",
+  "glFragmentLightModeliSGIX",
+  "glFragmentLightModelivSGIX",
+  "glFragmentLightfSGIX",
+  "glFragmentLightfvSGIX",
+  "glFragmentLightiSGIX",
+  "glFragmentLightivSGIX",
+  "glFragmentMaterialfSGIX",
+  "glFragmentMaterialfvSGIX",
+  "glFragmentMaterialiSGIX",
+  "glFragmentMaterialivSGIX",
+  "glGetFragmentLightfvSGIX",
+  "glGetFragmentLightivSGIX",
+  "glGetFragmentMaterialfvSGIX",
+  "glGetFragmentMaterialivSGIX",
+  "glFrameZoomSGIX",
+  "glIglooInterfaceSGIX",
+  "glAllocMPEGPredictorsSGIX",
+  "glDeleteMPEGPredictorsSGIX",
+  "glGenMPEGPredictorsSGIX",
+  "glGetMPEGParameterfvSGIX",
+  "glGetMPEGParameterivSGIX",
+  "glGetMPEGPredictorSGIX",
+  "glGetMPEGQuantTableubv",
+  "glIsMPEGPredictorSGIX",
+  "glMPEGPredictorSGIX",
+  "glMPEGQuantTableubv",
+  "glSwapMPEGPredictorsSGIX",
+  "glGetNonlinLightfvSGIX",
+  "glGetNonlinMaterialfvSGIX",
+  "glNonlinLightfvSGIX",
+  "glNonlinMaterialfvSGIX",
+  "glPixelTexGenSGIX",
+  "glDeformSGIX",
+  "glLoadIdentityDeformationMapSGIX",
+  "glMeshBreadthSGIX",
+  "glMeshStrideSGIX",
+  "glReferencePlaneSGIX",
+  "glSpriteParameterfSGIX",
+  "glSpriteParameterfvSGIX",
+  "glSpriteParameteriSGIX",
+  "glSpriteParameterivSGIX",
+  "glTagSampleBufferSGIX",
+  "glGetVectorOperationSGIX",
+  "glVectorOperationSGIX",
+  "glAreVertexArraysResidentSGIX",
+  "glBindVertexArraySGIX",
+  "glDeleteVertexArraysSGIX",
+  "glGenVertexArraysSGIX",
+  "glIsVertexArraySGIX",
+  "glPrioritizeVertexArraysSGIX",
+  "glColorTableParameterfvSGI",
+  "glColorTableParameterivSGI",
+  "glColorTableSGI",
+  "glCopyColorTableSGI",
+  "glGetColorTableParameterfvSGI",
+  "glGetColorTableParameterivSGI",
+  "glGetColorTableSGI",
+  "glGetPixelTransformParameterfvSGI",
+  "glGetPixelTransformParameterivSGI",
+  "glPixelTransformParameterfSGI",
+  "glPixelTransformParameterfvSGI",
+  "glPixelTransformParameteriSGI",
+  "glPixelTransformParameterivSGI",
+  "glPixelTransformSGI",
+  "glFinishTextureSUNX",
+  "glGlobalAlphaFactorbSUN",
+  "glGlobalAlphaFactordSUN",
+  "glGlobalAlphaFactorfSUN",
+  "glGlobalAlphaFactoriSUN",
+  "glGlobalAlphaFactorsSUN",
+  "glGlobalAlphaFactorubSUN",
+  "glGlobalAlphaFactoruiSUN",
+  "glGlobalAlphaFactorusSUN",
+  "glReadVideoPixelsSUN",
+  "glReplacementCodePointerSUN",
+  "glReplacementCodeubSUN",
+  "glReplacementCodeubvSUN",
+  "glReplacementCodeuiSUN",
+  "glReplacementCodeuivSUN",
+  "glReplacementCodeusSUN",
+  "glReplacementCodeusvSUN",
+  "glColor3fVertex3fSUN",
+  "glColor3fVertex3fvSUN",
+  "glColor4fNormal3fVertex3fSUN",
+  "glColor4fNormal3fVertex3fvSUN",
+  "glColor4ubVertex2fSUN",
+  "glColor4ubVertex2fvSUN",
+  "glColor4ubVertex3fSUN",
+  "glColor4ubVertex3fvSUN",
+  "glNormal3fVertex3fSUN",
+  "glNormal3fVertex3fvSUN",
+  "glReplacementCodeuiColor3fVertex3fSUN",
+  "glReplacementCodeuiColor3fVertex3fvSUN",
+  "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+  "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+  "glReplacementCodeuiColor4ubVertex3fSUN",
+  "glReplacementCodeuiColor4ubVertex3fvSUN",
+  "glReplacementCodeuiNormal3fVertex3fSUN",
+  "glReplacementCodeuiNormal3fVertex3fvSUN",
+  "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+  "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+  "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+  "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+  "glReplacementCodeuiTexCoord2fVertex3fSUN",
+  "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+  "glReplacementCodeuiVertex3fSUN",
+  "glReplacementCodeuiVertex3fvSUN",
+  "glTexCoord2fColor3fVertex3fSUN",
+  "glTexCoord2fColor3fVertex3fvSUN",
+  "glTexCoord2fColor4fNormal3fVertex3fSUN",
+  "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+  "glTexCoord2fColor4ubVertex3fSUN",
+  "glTexCoord2fColor4ubVertex3fvSUN",
+  "glTexCoord2fNormal3fVertex3fSUN",
+  "glTexCoord2fNormal3fVertex3fvSUN",
+  "glTexCoord2fVertex3fSUN",
+  "glTexCoord2fVertex3fvSUN",
+  "glTexCoord4fColor4fNormal3fVertex4fSUN",
+  "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+  "glTexCoord4fVertex4fSUN",
+  "glTexCoord4fVertex4fvSUN",
+  "glAddSwapHintRectWIN",
+};
+
+static void GLAPIENTRY _glewProfile_glCopyTexSubImage3D (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXSUBIMAGE3DPROC)_glewProfileTargets[0])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(0, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawRangeElements (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWRANGEELEMENTSPROC)_glewProfileTargets[1])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage3D (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE3DPROC)_glewProfileTargets[2])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage3D (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE3DPROC)_glewProfileTargets[3])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(3, t);
+}
+
+static void GLAPIENTRY _glewProfile_glActiveTexture (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLACTIVETEXTUREPROC)_glewProfileTargets[4])(a0);
+  _glewProfileEnd(4, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClientActiveTexture (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIENTACTIVETEXTUREPROC)_glewProfileTargets[5])(a0);
+  _glewProfileEnd(5, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage1D (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE1DPROC)_glewProfileTargets[6])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(6, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage2D (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE2DPROC)_glewProfileTargets[7])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(7, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage3D (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE3DPROC)_glewProfileTargets[8])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(8, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage1D (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)_glewProfileTargets[9])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(9, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage2D (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)_glewProfileTargets[10])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(10, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage3D (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)_glewProfileTargets[11])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(11, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCompressedTexImage (GLenum a0, GLint a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMPRESSEDTEXIMAGEPROC)_glewProfileTargets[12])(a0, a1, a2);
+  _glewProfileEnd(12, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLoadTransposeMatrixd (const GLdouble a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADTRANSPOSEMATRIXDPROC)_glewProfileTargets[13])(a0);
+  _glewProfileEnd(13, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLoadTransposeMatrixf (const GLfloat a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADTRANSPOSEMATRIXFPROC)_glewProfileTargets[14])(a0);
+  _glewProfileEnd(14, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultTransposeMatrixd (const GLdouble a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTTRANSPOSEMATRIXDPROC)_glewProfileTargets[15])(a0);
+  _glewProfileEnd(15, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultTransposeMatrixf (const GLfloat a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTTRANSPOSEMATRIXFPROC)_glewProfileTargets[16])(a0);
+  _glewProfileEnd(16, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1d (GLenum a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1DPROC)_glewProfileTargets[17])(a0, a1);
+  _glewProfileEnd(17, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1dv (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1DVPROC)_glewProfileTargets[18])(a0, a1);
+  _glewProfileEnd(18, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1f (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1FPROC)_glewProfileTargets[19])(a0, a1);
+  _glewProfileEnd(19, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1fv (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1FVPROC)_glewProfileTargets[20])(a0, a1);
+  _glewProfileEnd(20, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1i (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1IPROC)_glewProfileTargets[21])(a0, a1);
+  _glewProfileEnd(21, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1iv (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1IVPROC)_glewProfileTargets[22])(a0, a1);
+  _glewProfileEnd(22, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1s (GLenum a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1SPROC)_glewProfileTargets[23])(a0, a1);
+  _glewProfileEnd(23, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1sv (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1SVPROC)_glewProfileTargets[24])(a0, a1);
+  _glewProfileEnd(24, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2d (GLenum a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2DPROC)_glewProfileTargets[25])(a0, a1, a2);
+  _glewProfileEnd(25, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2dv (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2DVPROC)_glewProfileTargets[26])(a0, a1);
+  _glewProfileEnd(26, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2f (GLenum a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2FPROC)_glewProfileTargets[27])(a0, a1, a2);
+  _glewProfileEnd(27, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2fv (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2FVPROC)_glewProfileTargets[28])(a0, a1);
+  _glewProfileEnd(28, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2i (GLenum a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2IPROC)_glewProfileTargets[29])(a0, a1, a2);
+  _glewProfileEnd(29, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2iv (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2IVPROC)_glewProfileTargets[30])(a0, a1);
+  _glewProfileEnd(30, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2s (GLenum a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2SPROC)_glewProfileTargets[31])(a0, a1, a2);
+  _glewProfileEnd(31, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2sv (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2SVPROC)_glewProfileTargets[32])(a0, a1);
+  _glewProfileEnd(32, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3d (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3DPROC)_glewProfileTargets[33])(a0, a1, a2, a3);
+  _glewProfileEnd(33, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3dv (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3DVPROC)_glewProfileTargets[34])(a0, a1);
+  _glewProfileEnd(34, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3f (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3FPROC)_glewProfileTargets[35])(a0, a1, a2, a3);
+  _glewProfileEnd(35, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3fv (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3FVPROC)_glewProfileTargets[36])(a0, a1);
+  _glewProfileEnd(36, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3i (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3IPROC)_glewProfileTargets[37])(a0, a1, a2, a3);
+  _glewProfileEnd(37, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3iv (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3IVPROC)_glewProfileTargets[38])(a0, a1);
+  _glewProfileEnd(38, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3s (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3SPROC)_glewProfileTargets[39])(a0, a1, a2, a3);
+  _glewProfileEnd(39, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3sv (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3SVPROC)_glewProfileTargets[40])(a0, a1);
+  _glewProfileEnd(40, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4d (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4DPROC)_glewProfileTargets[41])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(41, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4dv (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4DVPROC)_glewProfileTargets[42])(a0, a1);
+  _glewProfileEnd(42, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4f (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4FPROC)_glewProfileTargets[43])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(43, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4fv (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4FVPROC)_glewProfileTargets[44])(a0, a1);
+  _glewProfileEnd(44, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4i (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4IPROC)_glewProfileTargets[45])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(45, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4iv (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4IVPROC)_glewProfileTargets[46])(a0, a1);
+  _glewProfileEnd(46, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4s (GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4SPROC)_glewProfileTargets[47])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(47, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4sv (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4SVPROC)_glewProfileTargets[48])(a0, a1);
+  _glewProfileEnd(48, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleCoverage (GLclampf a0, GLboolean a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLECOVERAGEPROC)_glewProfileTargets[49])(a0, a1);
+  _glewProfileEnd(49, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendColor (GLclampf a0, GLclampf a1, GLclampf a2, GLclampf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDCOLORPROC)_glewProfileTargets[50])(a0, a1, a2, a3);
+  _glewProfileEnd(50, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquation (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONPROC)_glewProfileTargets[51])(a0);
+  _glewProfileEnd(51, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparate (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEPROC)_glewProfileTargets[52])(a0, a1, a2, a3);
+  _glewProfileEnd(52, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordPointer (GLenum a0, GLsizei a1, const void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDPOINTERPROC)_glewProfileTargets[53])(a0, a1, a2);
+  _glewProfileEnd(53, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordd (GLdouble a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDDPROC)_glewProfileTargets[54])(a0);
+  _glewProfileEnd(54, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoorddv (const GLdouble * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDDVPROC)_glewProfileTargets[55])(a0);
+  _glewProfileEnd(55, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordf (GLfloat a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDFPROC)_glewProfileTargets[56])(a0);
+  _glewProfileEnd(56, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordfv (const GLfloat * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDFVPROC)_glewProfileTargets[57])(a0);
+  _glewProfileEnd(57, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArrays (GLenum a0, const GLint * a1, const GLsizei * a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSPROC)_glewProfileTargets[58])(a0, a1, a2, a3);
+  _glewProfileEnd(58, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElements (GLenum a0, const GLsizei * a1, GLenum a2, const void *const* a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSPROC)_glewProfileTargets[59])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(59, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterf (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERFPROC)_glewProfileTargets[60])(a0, a1);
+  _glewProfileEnd(60, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterfv (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERFVPROC)_glewProfileTargets[61])(a0, a1);
+  _glewProfileEnd(61, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameteri (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERIPROC)_glewProfileTargets[62])(a0, a1);
+  _glewProfileEnd(62, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameteriv (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERIVPROC)_glewProfileTargets[63])(a0, a1);
+  _glewProfileEnd(63, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3b (GLbyte a0, GLbyte a1, GLbyte a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3BPROC)_glewProfileTargets[64])(a0, a1, a2);
+  _glewProfileEnd(64, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3bv (const GLbyte * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3BVPROC)_glewProfileTargets[65])(a0);
+  _glewProfileEnd(65, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3d (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3DPROC)_glewProfileTargets[66])(a0, a1, a2);
+  _glewProfileEnd(66, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3dv (const GLdouble * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3DVPROC)_glewProfileTargets[67])(a0);
+  _glewProfileEnd(67, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3f (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3FPROC)_glewProfileTargets[68])(a0, a1, a2);
+  _glewProfileEnd(68, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3fv (const GLfloat * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3FVPROC)_glewProfileTargets[69])(a0);
+  _glewProfileEnd(69, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3i (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3IPROC)_glewProfileTargets[70])(a0, a1, a2);
+  _glewProfileEnd(70, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3iv (const GLint * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3IVPROC)_glewProfileTargets[71])(a0);
+  _glewProfileEnd(71, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3s (GLshort a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3SPROC)_glewProfileTargets[72])(a0, a1, a2);
+  _glewProfileEnd(72, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3sv (const GLshort * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3SVPROC)_glewProfileTargets[73])(a0);
+  _glewProfileEnd(73, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3ub (GLubyte a0, GLubyte a1, GLubyte a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UBPROC)_glewProfileTargets[74])(a0, a1, a2);
+  _glewProfileEnd(74, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3ubv (const GLubyte * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UBVPROC)_glewProfileTargets[75])(a0);
+  _glewProfileEnd(75, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3ui (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UIPROC)_glewProfileTargets[76])(a0, a1, a2);
+  _glewProfileEnd(76, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3uiv (const GLuint * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UIVPROC)_glewProfileTargets[77])(a0);
+  _glewProfileEnd(77, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3us (GLushort a0, GLushort a1, GLushort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3USPROC)_glewProfileTargets[78])(a0, a1, a2);
+  _glewProfileEnd(78, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3usv (const GLushort * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3USVPROC)_glewProfileTargets[79])(a0);
+  _glewProfileEnd(79, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColorPointer (GLint a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLORPOINTERPROC)_glewProfileTargets[80])(a0, a1, a2, a3);
+  _glewProfileEnd(80, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2d (GLdouble a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2DPROC)_glewProfileTargets[81])(a0, a1);
+  _glewProfileEnd(81, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2dv (const GLdouble * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2DVPROC)_glewProfileTargets[82])(a0);
+  _glewProfileEnd(82, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2f (GLfloat a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2FPROC)_glewProfileTargets[83])(a0, a1);
+  _glewProfileEnd(83, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2fv (const GLfloat * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2FVPROC)_glewProfileTargets[84])(a0);
+  _glewProfileEnd(84, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2i (GLint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2IPROC)_glewProfileTargets[85])(a0, a1);
+  _glewProfileEnd(85, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2iv (const GLint * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2IVPROC)_glewProfileTargets[86])(a0);
+  _glewProfileEnd(86, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2s (GLshort a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2SPROC)_glewProfileTargets[87])(a0, a1);
+  _glewProfileEnd(87, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2sv (const GLshort * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2SVPROC)_glewProfileTargets[88])(a0);
+  _glewProfileEnd(88, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3d (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3DPROC)_glewProfileTargets[89])(a0, a1, a2);
+  _glewProfileEnd(89, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3dv (const GLdouble * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3DVPROC)_glewProfileTargets[90])(a0);
+  _glewProfileEnd(90, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3f (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3FPROC)_glewProfileTargets[91])(a0, a1, a2);
+  _glewProfileEnd(91, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3fv (const GLfloat * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3FVPROC)_glewProfileTargets[92])(a0);
+  _glewProfileEnd(92, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3i (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3IPROC)_glewProfileTargets[93])(a0, a1, a2);
+  _glewProfileEnd(93, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3iv (const GLint * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3IVPROC)_glewProfileTargets[94])(a0);
+  _glewProfileEnd(94, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3s (GLshort a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3SPROC)_glewProfileTargets[95])(a0, a1, a2);
+  _glewProfileEnd(95, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3sv (const GLshort * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3SVPROC)_glewProfileTargets[96])(a0);
+  _glewProfileEnd(96, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginQuery (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINQUERYPROC)_glewProfileTargets[97])(a0, a1);
+  _glewProfileEnd(97, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBuffer (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERPROC)_glewProfileTargets[98])(a0, a1);
+  _glewProfileEnd(98, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferData (GLenum a0, GLsizeiptr a1, const void* a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERDATAPROC)_glewProfileTargets[99])(a0, a1, a2, a3);
+  _glewProfileEnd(99, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferSubData (GLenum a0, GLintptr a1, GLsizeiptr a2, const void* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERSUBDATAPROC)_glewProfileTargets[100])(a0, a1, a2, a3);
+  _glewProfileEnd(100, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteBuffers (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEBUFFERSPROC)_glewProfileTargets[101])(a0, a1);
+  _glewProfileEnd(101, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteQueries (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEQUERIESPROC)_glewProfileTargets[102])(a0, a1);
+  _glewProfileEnd(102, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndQuery (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDQUERYPROC)_glewProfileTargets[103])(a0);
+  _glewProfileEnd(103, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenBuffers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENBUFFERSPROC)_glewProfileTargets[104])(a0, a1);
+  _glewProfileEnd(104, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenQueries (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENQUERIESPROC)_glewProfileTargets[105])(a0, a1);
+  _glewProfileEnd(105, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferParameteriv (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPARAMETERIVPROC)_glewProfileTargets[106])(a0, a1, a2);
+  _glewProfileEnd(106, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferPointerv (GLenum a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPOINTERVPROC)_glewProfileTargets[107])(a0, a1, a2);
+  _glewProfileEnd(107, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferSubData (GLenum a0, GLintptr a1, GLsizeiptr a2, void* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERSUBDATAPROC)_glewProfileTargets[108])(a0, a1, a2, a3);
+  _glewProfileEnd(108, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTIVPROC)_glewProfileTargets[109])(a0, a1, a2);
+  _glewProfileEnd(109, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUIVPROC)_glewProfileTargets[110])(a0, a1, a2);
+  _glewProfileEnd(110, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryiv (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYIVPROC)_glewProfileTargets[111])(a0, a1, a2);
+  _glewProfileEnd(111, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsBuffer (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISBUFFERPROC)_glewProfileTargets[112])(a0);
+  _glewProfileEnd(112, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsQuery (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISQUERYPROC)_glewProfileTargets[113])(a0);
+  _glewProfileEnd(113, t);
+  return r;
+}
+
+static void* GLAPIENTRY _glewProfile_glMapBuffer (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  void* r = ((PFNGLMAPBUFFERPROC)_glewProfileTargets[114])(a0, a1);
+  _glewProfileEnd(114, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glUnmapBuffer (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLUNMAPBUFFERPROC)_glewProfileTargets[115])(a0);
+  _glewProfileEnd(115, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glAttachShader (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLATTACHSHADERPROC)_glewProfileTargets[116])(a0, a1);
+  _glewProfileEnd(116, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindAttribLocation (GLuint a0, GLuint a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDATTRIBLOCATIONPROC)_glewProfileTargets[117])(a0, a1, a2);
+  _glewProfileEnd(117, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparate (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEPROC)_glewProfileTargets[118])(a0, a1);
+  _glewProfileEnd(118, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompileShader (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPILESHADERPROC)_glewProfileTargets[119])(a0);
+  _glewProfileEnd(119, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glCreateProgram (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLCREATEPROGRAMPROC)_glewProfileTargets[120])();
+  _glewProfileEnd(120, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glCreateShader (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLCREATESHADERPROC)_glewProfileTargets[121])(a0);
+  _glewProfileEnd(121, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteProgram (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPROGRAMPROC)_glewProfileTargets[122])(a0);
+  _glewProfileEnd(122, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteShader (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETESHADERPROC)_glewProfileTargets[123])(a0);
+  _glewProfileEnd(123, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDetachShader (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDETACHSHADERPROC)_glewProfileTargets[124])(a0, a1);
+  _glewProfileEnd(124, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVertexAttribArray (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVERTEXATTRIBARRAYPROC)_glewProfileTargets[125])(a0);
+  _glewProfileEnd(125, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBuffers (GLsizei a0, const GLenum* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERSPROC)_glewProfileTargets[126])(a0, a1);
+  _glewProfileEnd(126, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVertexAttribArray (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVERTEXATTRIBARRAYPROC)_glewProfileTargets[127])(a0);
+  _glewProfileEnd(127, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveAttrib (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEATTRIBPROC)_glewProfileTargets[128])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(128, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveUniform (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEUNIFORMPROC)_glewProfileTargets[129])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(129, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetAttachedShaders (GLuint a0, GLsizei a1, GLsizei* a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETATTACHEDSHADERSPROC)_glewProfileTargets[130])(a0, a1, a2, a3);
+  _glewProfileEnd(130, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetAttribLocation (GLuint a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETATTRIBLOCATIONPROC)_glewProfileTargets[131])(a0, a1);
+  _glewProfileEnd(131, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramInfoLog (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMINFOLOGPROC)_glewProfileTargets[132])(a0, a1, a2, a3);
+  _glewProfileEnd(132, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMIVPROC)_glewProfileTargets[133])(a0, a1, a2);
+  _glewProfileEnd(133, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShaderInfoLog (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADERINFOLOGPROC)_glewProfileTargets[134])(a0, a1, a2, a3);
+  _glewProfileEnd(134, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShaderSource (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADERSOURCEPROC)_glewProfileTargets[135])(a0, a1, a2, a3);
+  _glewProfileEnd(135, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShaderiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADERIVPROC)_glewProfileTargets[136])(a0, a1, a2);
+  _glewProfileEnd(136, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetUniformLocation (GLuint a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETUNIFORMLOCATIONPROC)_glewProfileTargets[137])(a0, a1);
+  _glewProfileEnd(137, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformfv (GLuint a0, GLint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMFVPROC)_glewProfileTargets[138])(a0, a1, a2);
+  _glewProfileEnd(138, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformiv (GLuint a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMIVPROC)_glewProfileTargets[139])(a0, a1, a2);
+  _glewProfileEnd(139, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribPointerv (GLuint a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBPOINTERVPROC)_glewProfileTargets[140])(a0, a1, a2);
+  _glewProfileEnd(140, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribdv (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBDVPROC)_glewProfileTargets[141])(a0, a1, a2);
+  _glewProfileEnd(141, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribfv (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBFVPROC)_glewProfileTargets[142])(a0, a1, a2);
+  _glewProfileEnd(142, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIVPROC)_glewProfileTargets[143])(a0, a1, a2);
+  _glewProfileEnd(143, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsProgram (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPROGRAMPROC)_glewProfileTargets[144])(a0);
+  _glewProfileEnd(144, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsShader (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSHADERPROC)_glewProfileTargets[145])(a0);
+  _glewProfileEnd(145, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glLinkProgram (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLINKPROGRAMPROC)_glewProfileTargets[146])(a0);
+  _glewProfileEnd(146, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderSource (GLuint a0, GLsizei a1, const GLchar *const* a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADERSOURCEPROC)_glewProfileTargets[147])(a0, a1, a2, a3);
+  _glewProfileEnd(147, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilFuncSeparate (GLenum a0, GLenum a1, GLint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILFUNCSEPARATEPROC)_glewProfileTargets[148])(a0, a1, a2, a3);
+  _glewProfileEnd(148, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilMaskSeparate (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILMASKSEPARATEPROC)_glewProfileTargets[149])(a0, a1);
+  _glewProfileEnd(149, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilOpSeparate (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILOPSEPARATEPROC)_glewProfileTargets[150])(a0, a1, a2, a3);
+  _glewProfileEnd(150, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1f (GLint a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1FPROC)_glewProfileTargets[151])(a0, a1);
+  _glewProfileEnd(151, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1FVPROC)_glewProfileTargets[152])(a0, a1, a2);
+  _glewProfileEnd(152, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1i (GLint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1IPROC)_glewProfileTargets[153])(a0, a1);
+  _glewProfileEnd(153, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1IVPROC)_glewProfileTargets[154])(a0, a1, a2);
+  _glewProfileEnd(154, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2f (GLint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2FPROC)_glewProfileTargets[155])(a0, a1, a2);
+  _glewProfileEnd(155, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2FVPROC)_glewProfileTargets[156])(a0, a1, a2);
+  _glewProfileEnd(156, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2i (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2IPROC)_glewProfileTargets[157])(a0, a1, a2);
+  _glewProfileEnd(157, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2IVPROC)_glewProfileTargets[158])(a0, a1, a2);
+  _glewProfileEnd(158, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3f (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3FPROC)_glewProfileTargets[159])(a0, a1, a2, a3);
+  _glewProfileEnd(159, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3FVPROC)_glewProfileTargets[160])(a0, a1, a2);
+  _glewProfileEnd(160, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3i (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3IPROC)_glewProfileTargets[161])(a0, a1, a2, a3);
+  _glewProfileEnd(161, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3IVPROC)_glewProfileTargets[162])(a0, a1, a2);
+  _glewProfileEnd(162, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4f (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4FPROC)_glewProfileTargets[163])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(163, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4fv (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4FVPROC)_glewProfileTargets[164])(a0, a1, a2);
+  _glewProfileEnd(164, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4i (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4IPROC)_glewProfileTargets[165])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(165, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4iv (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4IVPROC)_glewProfileTargets[166])(a0, a1, a2);
+  _glewProfileEnd(166, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2FVPROC)_glewProfileTargets[167])(a0, a1, a2, a3);
+  _glewProfileEnd(167, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3FVPROC)_glewProfileTargets[168])(a0, a1, a2, a3);
+  _glewProfileEnd(168, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4FVPROC)_glewProfileTargets[169])(a0, a1, a2, a3);
+  _glewProfileEnd(169, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUseProgram (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUSEPROGRAMPROC)_glewProfileTargets[170])(a0);
+  _glewProfileEnd(170, t);
+}
+
+static void GLAPIENTRY _glewProfile_glValidateProgram (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVALIDATEPROGRAMPROC)_glewProfileTargets[171])(a0);
+  _glewProfileEnd(171, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1d (GLuint a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1DPROC)_glewProfileTargets[172])(a0, a1);
+  _glewProfileEnd(172, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1DVPROC)_glewProfileTargets[173])(a0, a1);
+  _glewProfileEnd(173, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1f (GLuint a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1FPROC)_glewProfileTargets[174])(a0, a1);
+  _glewProfileEnd(174, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1fv (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1FVPROC)_glewProfileTargets[175])(a0, a1);
+  _glewProfileEnd(175, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1s (GLuint a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1SPROC)_glewProfileTargets[176])(a0, a1);
+  _glewProfileEnd(176, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1sv (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1SVPROC)_glewProfileTargets[177])(a0, a1);
+  _glewProfileEnd(177, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2d (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2DPROC)_glewProfileTargets[178])(a0, a1, a2);
+  _glewProfileEnd(178, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2DVPROC)_glewProfileTargets[179])(a0, a1);
+  _glewProfileEnd(179, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2f (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2FPROC)_glewProfileTargets[180])(a0, a1, a2);
+  _glewProfileEnd(180, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2fv (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2FVPROC)_glewProfileTargets[181])(a0, a1);
+  _glewProfileEnd(181, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2s (GLuint a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2SPROC)_glewProfileTargets[182])(a0, a1, a2);
+  _glewProfileEnd(182, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2sv (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2SVPROC)_glewProfileTargets[183])(a0, a1);
+  _glewProfileEnd(183, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3DPROC)_glewProfileTargets[184])(a0, a1, a2, a3);
+  _glewProfileEnd(184, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3DVPROC)_glewProfileTargets[185])(a0, a1);
+  _glewProfileEnd(185, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3f (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3FPROC)_glewProfileTargets[186])(a0, a1, a2, a3);
+  _glewProfileEnd(186, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3fv (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3FVPROC)_glewProfileTargets[187])(a0, a1);
+  _glewProfileEnd(187, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3s (GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3SPROC)_glewProfileTargets[188])(a0, a1, a2, a3);
+  _glewProfileEnd(188, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3sv (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3SVPROC)_glewProfileTargets[189])(a0, a1);
+  _glewProfileEnd(189, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Nbv (GLuint a0, const GLbyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NBVPROC)_glewProfileTargets[190])(a0, a1);
+  _glewProfileEnd(190, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Niv (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NIVPROC)_glewProfileTargets[191])(a0, a1);
+  _glewProfileEnd(191, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Nsv (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NSVPROC)_glewProfileTargets[192])(a0, a1);
+  _glewProfileEnd(192, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Nub (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUBPROC)_glewProfileTargets[193])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(193, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Nubv (GLuint a0, const GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUBVPROC)_glewProfileTargets[194])(a0, a1);
+  _glewProfileEnd(194, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Nuiv (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUIVPROC)_glewProfileTargets[195])(a0, a1);
+  _glewProfileEnd(195, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4Nusv (GLuint a0, const GLushort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUSVPROC)_glewProfileTargets[196])(a0, a1);
+  _glewProfileEnd(196, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4bv (GLuint a0, const GLbyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4BVPROC)_glewProfileTargets[197])(a0, a1);
+  _glewProfileEnd(197, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4DPROC)_glewProfileTargets[198])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(198, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4DVPROC)_glewProfileTargets[199])(a0, a1);
+  _glewProfileEnd(199, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4f (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4FPROC)_glewProfileTargets[200])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(200, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4fv (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4FVPROC)_glewProfileTargets[201])(a0, a1);
+  _glewProfileEnd(201, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4iv (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4IVPROC)_glewProfileTargets[202])(a0, a1);
+  _glewProfileEnd(202, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4s (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4SPROC)_glewProfileTargets[203])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(203, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4sv (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4SVPROC)_glewProfileTargets[204])(a0, a1);
+  _glewProfileEnd(204, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4ubv (GLuint a0, const GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4UBVPROC)_glewProfileTargets[205])(a0, a1);
+  _glewProfileEnd(205, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4uiv (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4UIVPROC)_glewProfileTargets[206])(a0, a1);
+  _glewProfileEnd(206, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4usv (GLuint a0, const GLushort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4USVPROC)_glewProfileTargets[207])(a0, a1);
+  _glewProfileEnd(207, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribPointer (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBPOINTERPROC)_glewProfileTargets[208])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(208, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2x3fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2X3FVPROC)_glewProfileTargets[209])(a0, a1, a2, a3);
+  _glewProfileEnd(209, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2x4fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2X4FVPROC)_glewProfileTargets[210])(a0, a1, a2, a3);
+  _glewProfileEnd(210, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3x2fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3X2FVPROC)_glewProfileTargets[211])(a0, a1, a2, a3);
+  _glewProfileEnd(211, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3x4fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3X4FVPROC)_glewProfileTargets[212])(a0, a1, a2, a3);
+  _glewProfileEnd(212, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4x2fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4X2FVPROC)_glewProfileTargets[213])(a0, a1, a2, a3);
+  _glewProfileEnd(213, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4x3fv (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4X3FVPROC)_glewProfileTargets[214])(a0, a1, a2, a3);
+  _glewProfileEnd(214, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginConditionalRender (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINCONDITIONALRENDERPROC)_glewProfileTargets[215])(a0, a1);
+  _glewProfileEnd(215, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginTransformFeedback (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINTRANSFORMFEEDBACKPROC)_glewProfileTargets[216])(a0);
+  _glewProfileEnd(216, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFragDataLocation (GLuint a0, GLuint a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAGDATALOCATIONPROC)_glewProfileTargets[217])(a0, a1, a2);
+  _glewProfileEnd(217, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClampColor (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLAMPCOLORPROC)_glewProfileTargets[218])(a0, a1);
+  _glewProfileEnd(218, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearBufferfi (GLenum a0, GLint a1, GLfloat a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARBUFFERFIPROC)_glewProfileTargets[219])(a0, a1, a2, a3);
+  _glewProfileEnd(219, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearBufferfv (GLenum a0, GLint a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARBUFFERFVPROC)_glewProfileTargets[220])(a0, a1, a2);
+  _glewProfileEnd(220, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearBufferiv (GLenum a0, GLint a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARBUFFERIVPROC)_glewProfileTargets[221])(a0, a1, a2);
+  _glewProfileEnd(221, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearBufferuiv (GLenum a0, GLint a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARBUFFERUIVPROC)_glewProfileTargets[222])(a0, a1, a2);
+  _glewProfileEnd(222, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorMaski (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORMASKIPROC)_glewProfileTargets[223])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(223, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisablei (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEIPROC)_glewProfileTargets[224])(a0, a1);
+  _glewProfileEnd(224, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnablei (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEIPROC)_glewProfileTargets[225])(a0, a1);
+  _glewProfileEnd(225, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndConditionalRender (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDCONDITIONALRENDERPROC)_glewProfileTargets[226])();
+  _glewProfileEnd(226, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndTransformFeedback (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDTRANSFORMFEEDBACKPROC)_glewProfileTargets[227])();
+  _glewProfileEnd(227, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBooleani_v (GLenum a0, GLuint a1, GLboolean* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBOOLEANI_VPROC)_glewProfileTargets[228])(a0, a1, a2);
+  _glewProfileEnd(228, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetFragDataLocation (GLuint a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETFRAGDATALOCATIONPROC)_glewProfileTargets[229])(a0, a1);
+  _glewProfileEnd(229, t);
+  return r;
+}
+
+static const GLubyte* GLAPIENTRY _glewProfile_glGetStringi (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  const GLubyte* r = ((PFNGLGETSTRINGIPROC)_glewProfileTargets[230])(a0, a1);
+  _glewProfileEnd(230, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterIiv (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERIIVPROC)_glewProfileTargets[231])(a0, a1, a2);
+  _glewProfileEnd(231, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterIuiv (GLenum a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERIUIVPROC)_glewProfileTargets[232])(a0, a1, a2);
+  _glewProfileEnd(232, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTransformFeedbackVarying (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLsizei * a4, GLenum * a5, GLchar * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)_glewProfileTargets[233])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(233, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformuiv (GLuint a0, GLint a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMUIVPROC)_glewProfileTargets[234])(a0, a1, a2);
+  _glewProfileEnd(234, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribIiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIIVPROC)_glewProfileTargets[235])(a0, a1, a2);
+  _glewProfileEnd(235, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribIuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIUIVPROC)_glewProfileTargets[236])(a0, a1, a2);
+  _glewProfileEnd(236, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsEnabledi (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISENABLEDIPROC)_glewProfileTargets[237])(a0, a1);
+  _glewProfileEnd(237, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterIiv (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERIIVPROC)_glewProfileTargets[238])(a0, a1, a2);
+  _glewProfileEnd(238, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterIuiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERIUIVPROC)_glewProfileTargets[239])(a0, a1, a2);
+  _glewProfileEnd(239, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTransformFeedbackVaryings (GLuint a0, GLsizei a1, const GLchar *const* a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMFEEDBACKVARYINGSPROC)_glewProfileTargets[240])(a0, a1, a2, a3);
+  _glewProfileEnd(240, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1ui (GLint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UIPROC)_glewProfileTargets[241])(a0, a1);
+  _glewProfileEnd(241, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UIVPROC)_glewProfileTargets[242])(a0, a1, a2);
+  _glewProfileEnd(242, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2ui (GLint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UIPROC)_glewProfileTargets[243])(a0, a1, a2);
+  _glewProfileEnd(243, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UIVPROC)_glewProfileTargets[244])(a0, a1, a2);
+  _glewProfileEnd(244, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3ui (GLint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UIPROC)_glewProfileTargets[245])(a0, a1, a2, a3);
+  _glewProfileEnd(245, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UIVPROC)_glewProfileTargets[246])(a0, a1, a2);
+  _glewProfileEnd(246, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4ui (GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UIPROC)_glewProfileTargets[247])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(247, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4uiv (GLint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UIVPROC)_glewProfileTargets[248])(a0, a1, a2);
+  _glewProfileEnd(248, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1i (GLuint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1IPROC)_glewProfileTargets[249])(a0, a1);
+  _glewProfileEnd(249, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1iv (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1IVPROC)_glewProfileTargets[250])(a0, a1);
+  _glewProfileEnd(250, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1ui (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1UIPROC)_glewProfileTargets[251])(a0, a1);
+  _glewProfileEnd(251, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1uiv (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1UIVPROC)_glewProfileTargets[252])(a0, a1);
+  _glewProfileEnd(252, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2i (GLuint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2IPROC)_glewProfileTargets[253])(a0, a1, a2);
+  _glewProfileEnd(253, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2iv (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2IVPROC)_glewProfileTargets[254])(a0, a1);
+  _glewProfileEnd(254, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2ui (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2UIPROC)_glewProfileTargets[255])(a0, a1, a2);
+  _glewProfileEnd(255, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2uiv (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2UIVPROC)_glewProfileTargets[256])(a0, a1);
+  _glewProfileEnd(256, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3i (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3IPROC)_glewProfileTargets[257])(a0, a1, a2, a3);
+  _glewProfileEnd(257, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3iv (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3IVPROC)_glewProfileTargets[258])(a0, a1);
+  _glewProfileEnd(258, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3ui (GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3UIPROC)_glewProfileTargets[259])(a0, a1, a2, a3);
+  _glewProfileEnd(259, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3uiv (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3UIVPROC)_glewProfileTargets[260])(a0, a1);
+  _glewProfileEnd(260, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4bv (GLuint a0, const GLbyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4BVPROC)_glewProfileTargets[261])(a0, a1);
+  _glewProfileEnd(261, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4i (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4IPROC)_glewProfileTargets[262])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(262, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4iv (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4IVPROC)_glewProfileTargets[263])(a0, a1);
+  _glewProfileEnd(263, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4sv (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4SVPROC)_glewProfileTargets[264])(a0, a1);
+  _glewProfileEnd(264, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4ubv (GLuint a0, const GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4UBVPROC)_glewProfileTargets[265])(a0, a1);
+  _glewProfileEnd(265, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4ui (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4UIPROC)_glewProfileTargets[266])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(266, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4uiv (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4UIVPROC)_glewProfileTargets[267])(a0, a1);
+  _glewProfileEnd(267, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4usv (GLuint a0, const GLushort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4USVPROC)_glewProfileTargets[268])(a0, a1);
+  _glewProfileEnd(268, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribIPointer (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBIPOINTERPROC)_glewProfileTargets[269])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(269, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstanced (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDPROC)_glewProfileTargets[270])(a0, a1, a2, a3);
+  _glewProfileEnd(270, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstanced (GLenum a0, GLsizei a1, GLenum a2, const void* a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDPROC)_glewProfileTargets[271])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(271, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPrimitiveRestartIndex (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIMITIVERESTARTINDEXPROC)_glewProfileTargets[272])(a0);
+  _glewProfileEnd(272, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBuffer (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUFFERPROC)_glewProfileTargets[273])(a0, a1, a2);
+  _glewProfileEnd(273, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture (GLenum a0, GLenum a1, GLuint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREPROC)_glewProfileTargets[274])(a0, a1, a2, a3);
+  _glewProfileEnd(274, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferParameteri64v (GLenum a0, GLenum a1, GLint64 * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPARAMETERI64VPROC)_glewProfileTargets[275])(a0, a1, a2);
+  _glewProfileEnd(275, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInteger64i_v (GLenum a0, GLuint a1, GLint64 * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGER64I_VPROC)_glewProfileTargets[276])(a0, a1, a2);
+  _glewProfileEnd(276, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribDivisor (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBDIVISORPROC)_glewProfileTargets[277])(a0, a1);
+  _glewProfileEnd(277, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparatei (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEIPROC)_glewProfileTargets[278])(a0, a1, a2);
+  _glewProfileEnd(278, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationi (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONIPROC)_glewProfileTargets[279])(a0, a1);
+  _glewProfileEnd(279, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparatei (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEIPROC)_glewProfileTargets[280])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(280, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFunci (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCIPROC)_glewProfileTargets[281])(a0, a1, a2);
+  _glewProfileEnd(281, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMinSampleShading (GLclampf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMINSAMPLESHADINGPROC)_glewProfileTargets[282])(a0);
+  _glewProfileEnd(282, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glGetGraphicsResetStatus (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLGETGRAPHICSRESETSTATUSPROC)_glewProfileTargets[283])();
+  _glewProfileEnd(283, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetnCompressedTexImage (GLenum a0, GLint a1, GLsizei a2, GLvoid * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNCOMPRESSEDTEXIMAGEPROC)_glewProfileTargets[284])(a0, a1, a2, a3);
+  _glewProfileEnd(284, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnTexImage (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, GLvoid * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNTEXIMAGEPROC)_glewProfileTargets[285])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(285, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformdv (GLuint a0, GLint a1, GLsizei a2, GLdouble * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMDVPROC)_glewProfileTargets[286])(a0, a1, a2, a3);
+  _glewProfileEnd(286, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirectCount (GLenum a0, const GLvoid * a1, GLintptr a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)_glewProfileTargets[287])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(287, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirectCount (GLenum a0, GLenum a1, const GLvoid * a2, GLintptr a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)_glewProfileTargets[288])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(288, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSpecializeShader (GLuint a0, const GLchar * a1, GLuint a2, const GLuint * a3, const GLuint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSPECIALIZESHADERPROC)_glewProfileTargets[289])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(289, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTbufferMask3DFX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTBUFFERMASK3DFXPROC)_glewProfileTargets[290])(a0);
+  _glewProfileEnd(290, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageCallbackAMD (GLDEBUGPROCAMD a0, void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGECALLBACKAMDPROC)_glewProfileTargets[291])(a0, a1);
+  _glewProfileEnd(291, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageEnableAMD (GLenum a0, GLenum a1, GLsizei a2, const GLuint* a3, GLboolean a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGEENABLEAMDPROC)_glewProfileTargets[292])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(292, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageInsertAMD (GLenum a0, GLenum a1, GLuint a2, GLsizei a3, const GLchar* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGEINSERTAMDPROC)_glewProfileTargets[293])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(293, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetDebugMessageLogAMD (GLuint a0, GLsizei a1, GLenum* a2, GLuint* a3, GLuint* a4, GLsizei* a5, GLchar* a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETDEBUGMESSAGELOGAMDPROC)_glewProfileTargets[294])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(294, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationIndexedAMD (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONINDEXEDAMDPROC)_glewProfileTargets[295])(a0, a1);
+  _glewProfileEnd(295, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparateIndexedAMD (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)_glewProfileTargets[296])(a0, a1, a2);
+  _glewProfileEnd(296, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncIndexedAMD (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCINDEXEDAMDPROC)_glewProfileTargets[297])(a0, a1, a2);
+  _glewProfileEnd(297, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparateIndexedAMD (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)_glewProfileTargets[298])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(298, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedRenderbufferStorageMultisampleAdvancedAMD (GLuint a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC)_glewProfileTargets[299])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(299, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleAdvancedAMD (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC)_glewProfileTargets[300])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(300, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferSamplePositionsfvAMD (GLenum a0, GLuint a1, GLuint a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)_glewProfileTargets[301])(a0, a1, a2, a3);
+  _glewProfileEnd(301, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferParameterfvAMD (GLenum a0, GLenum a1, GLuint a2, GLuint a3, GLsizei a4, GLfloat* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)_glewProfileTargets[302])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(302, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedFramebufferParameterfvAMD (GLuint a0, GLenum a1, GLuint a2, GLuint a3, GLsizei a4, GLfloat* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)_glewProfileTargets[303])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(303, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferSamplePositionsfvAMD (GLuint a0, GLuint a1, GLuint a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)_glewProfileTargets[304])(a0, a1, a2, a3);
+  _glewProfileEnd(304, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribParameteriAMD (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBPARAMETERIAMDPROC)_glewProfileTargets[305])(a0, a1, a2);
+  _glewProfileEnd(305, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirectAMD (GLenum a0, const void * a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)_glewProfileTargets[306])(a0, a1, a2, a3);
+  _glewProfileEnd(306, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirectAMD (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)_glewProfileTargets[307])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(307, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteNamesAMD (GLenum a0, GLuint a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETENAMESAMDPROC)_glewProfileTargets[308])(a0, a1, a2);
+  _glewProfileEnd(308, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenNamesAMD (GLenum a0, GLuint a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENNAMESAMDPROC)_glewProfileTargets[309])(a0, a1, a2);
+  _glewProfileEnd(309, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsNameAMD (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISNAMEAMDPROC)_glewProfileTargets[310])(a0, a1);
+  _glewProfileEnd(310, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glQueryObjectParameteruiAMD (GLenum a0, GLuint a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLQUERYOBJECTPARAMETERUIAMDPROC)_glewProfileTargets[311])(a0, a1, a2, a3);
+  _glewProfileEnd(311, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginPerfMonitorAMD (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINPERFMONITORAMDPROC)_glewProfileTargets[312])(a0);
+  _glewProfileEnd(312, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeletePerfMonitorsAMD (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPERFMONITORSAMDPROC)_glewProfileTargets[313])(a0, a1);
+  _glewProfileEnd(313, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndPerfMonitorAMD (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDPERFMONITORAMDPROC)_glewProfileTargets[314])(a0);
+  _glewProfileEnd(314, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenPerfMonitorsAMD (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENPERFMONITORSAMDPROC)_glewProfileTargets[315])(a0, a1);
+  _glewProfileEnd(315, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfMonitorCounterDataAMD (GLuint a0, GLenum a1, GLsizei a2, GLuint* a3, GLint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFMONITORCOUNTERDATAAMDPROC)_glewProfileTargets[316])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(316, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfMonitorCounterInfoAMD (GLuint a0, GLuint a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFMONITORCOUNTERINFOAMDPROC)_glewProfileTargets[317])(a0, a1, a2, a3);
+  _glewProfileEnd(317, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfMonitorCounterStringAMD (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)_glewProfileTargets[318])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(318, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfMonitorCountersAMD (GLuint a0, GLint* a1, GLint * a2, GLsizei a3, GLuint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFMONITORCOUNTERSAMDPROC)_glewProfileTargets[319])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(319, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfMonitorGroupStringAMD (GLuint a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFMONITORGROUPSTRINGAMDPROC)_glewProfileTargets[320])(a0, a1, a2, a3);
+  _glewProfileEnd(320, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfMonitorGroupsAMD (GLint* a0, GLsizei a1, GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFMONITORGROUPSAMDPROC)_glewProfileTargets[321])(a0, a1, a2);
+  _glewProfileEnd(321, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSelectPerfMonitorCountersAMD (GLuint a0, GLboolean a1, GLuint a2, GLint a3, GLuint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSELECTPERFMONITORCOUNTERSAMDPROC)_glewProfileTargets[322])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(322, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSetMultisamplefvAMD (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSETMULTISAMPLEFVAMDPROC)_glewProfileTargets[323])(a0, a1, a2);
+  _glewProfileEnd(323, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorageSparseAMD (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLsizei a4, GLsizei a5, GLbitfield a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGESPARSEAMDPROC)_glewProfileTargets[324])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(324, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorageSparseAMD (GLuint a0, GLenum a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLsizei a6, GLbitfield a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGESPARSEAMDPROC)_glewProfileTargets[325])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(325, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilOpValueAMD (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILOPVALUEAMDPROC)_glewProfileTargets[326])(a0, a1);
+  _glewProfileEnd(326, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTessellationFactorAMD (GLfloat a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTESSELLATIONFACTORAMDPROC)_glewProfileTargets[327])(a0);
+  _glewProfileEnd(327, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTessellationModeAMD (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTESSELLATIONMODEAMDPROC)_glewProfileTargets[328])(a0);
+  _glewProfileEnd(328, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlitFramebufferANGLE (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLITFRAMEBUFFERANGLEPROC)_glewProfileTargets[329])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(329, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleANGLE (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC)_glewProfileTargets[330])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(330, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstancedANGLE (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDANGLEPROC)_glewProfileTargets[331])(a0, a1, a2, a3);
+  _glewProfileEnd(331, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedANGLE (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDANGLEPROC)_glewProfileTargets[332])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(332, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribDivisorANGLE (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBDIVISORANGLEPROC)_glewProfileTargets[333])(a0, a1);
+  _glewProfileEnd(333, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginQueryANGLE (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINQUERYANGLEPROC)_glewProfileTargets[334])(a0, a1);
+  _glewProfileEnd(334, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteQueriesANGLE (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEQUERIESANGLEPROC)_glewProfileTargets[335])(a0, a1);
+  _glewProfileEnd(335, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndQueryANGLE (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDQUERYANGLEPROC)_glewProfileTargets[336])(a0);
+  _glewProfileEnd(336, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenQueriesANGLE (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENQUERIESANGLEPROC)_glewProfileTargets[337])(a0, a1);
+  _glewProfileEnd(337, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjecti64vANGLE (GLuint a0, GLenum a1, GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTI64VANGLEPROC)_glewProfileTargets[338])(a0, a1, a2);
+  _glewProfileEnd(338, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectivANGLE (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTIVANGLEPROC)_glewProfileTargets[339])(a0, a1, a2);
+  _glewProfileEnd(339, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectui64vANGLE (GLuint a0, GLenum a1, GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUI64VANGLEPROC)_glewProfileTargets[340])(a0, a1, a2);
+  _glewProfileEnd(340, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectuivANGLE (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUIVANGLEPROC)_glewProfileTargets[341])(a0, a1, a2);
+  _glewProfileEnd(341, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryivANGLE (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYIVANGLEPROC)_glewProfileTargets[342])(a0, a1, a2);
+  _glewProfileEnd(342, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsQueryANGLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISQUERYANGLEPROC)_glewProfileTargets[343])(a0);
+  _glewProfileEnd(343, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glQueryCounterANGLE (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLQUERYCOUNTERANGLEPROC)_glewProfileTargets[344])(a0, a1);
+  _glewProfileEnd(344, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTranslatedShaderSourceANGLE (GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC)_glewProfileTargets[345])(a0, a1, a2, a3);
+  _glewProfileEnd(345, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureLevelsAPPLE (GLuint a0, GLuint a1, GLint a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURELEVELSAPPLEPROC)_glewProfileTargets[346])(a0, a1, a2, a3);
+  _glewProfileEnd(346, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementArrayAPPLE (GLenum a0, GLint a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTARRAYAPPLEPROC)_glewProfileTargets[347])(a0, a1, a2);
+  _glewProfileEnd(347, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawRangeElementArrayAPPLE (GLenum a0, GLuint a1, GLuint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)_glewProfileTargets[348])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(348, t);
+}
+
+static void GLAPIENTRY _glewProfile_glElementPointerAPPLE (GLenum a0, const void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLELEMENTPOINTERAPPLEPROC)_glewProfileTargets[349])(a0, a1);
+  _glewProfileEnd(349, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementArrayAPPLE (GLenum a0, const GLint* a1, const GLsizei * a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)_glewProfileTargets[350])(a0, a1, a2, a3);
+  _glewProfileEnd(350, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawRangeElementArrayAPPLE (GLenum a0, GLuint a1, GLuint a2, const GLint* a3, const GLsizei * a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)_glewProfileTargets[351])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(351, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteFencesAPPLE (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEFENCESAPPLEPROC)_glewProfileTargets[352])(a0, a1);
+  _glewProfileEnd(352, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFinishFenceAPPLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFINISHFENCEAPPLEPROC)_glewProfileTargets[353])(a0);
+  _glewProfileEnd(353, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFinishObjectAPPLE (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFINISHOBJECTAPPLEPROC)_glewProfileTargets[354])(a0, a1);
+  _glewProfileEnd(354, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenFencesAPPLE (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENFENCESAPPLEPROC)_glewProfileTargets[355])(a0, a1);
+  _glewProfileEnd(355, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsFenceAPPLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISFENCEAPPLEPROC)_glewProfileTargets[356])(a0);
+  _glewProfileEnd(356, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSetFenceAPPLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSETFENCEAPPLEPROC)_glewProfileTargets[357])(a0);
+  _glewProfileEnd(357, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glTestFenceAPPLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLTESTFENCEAPPLEPROC)_glewProfileTargets[358])(a0);
+  _glewProfileEnd(358, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glTestObjectAPPLE (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLTESTOBJECTAPPLEPROC)_glewProfileTargets[359])(a0, a1);
+  _glewProfileEnd(359, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBufferParameteriAPPLE (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERPARAMETERIAPPLEPROC)_glewProfileTargets[360])(a0, a1, a2);
+  _glewProfileEnd(360, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFlushMappedBufferRangeAPPLE (GLenum a0, GLintptr a1, GLsizeiptr a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)_glewProfileTargets[361])(a0, a1, a2);
+  _glewProfileEnd(361, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleAPPLE (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEAPPLEPROC)_glewProfileTargets[362])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(362, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResolveMultisampleFramebufferAPPLE (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESOLVEMULTISAMPLEFRAMEBUFFERAPPLEPROC)_glewProfileTargets[363])();
+  _glewProfileEnd(363, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectParameterivAPPLE (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTPARAMETERIVAPPLEPROC)_glewProfileTargets[364])(a0, a1, a2, a3);
+  _glewProfileEnd(364, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glObjectPurgeableAPPLE (GLenum a0, GLuint a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLOBJECTPURGEABLEAPPLEPROC)_glewProfileTargets[365])(a0, a1, a2);
+  _glewProfileEnd(365, t);
+  return r;
+}
+
+static GLenum GLAPIENTRY _glewProfile_glObjectUnpurgeableAPPLE (GLenum a0, GLuint a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLOBJECTUNPURGEABLEAPPLEPROC)_glewProfileTargets[366])(a0, a1, a2);
+  _glewProfileEnd(366, t);
+  return r;
+}
+
+static GLenum GLAPIENTRY _glewProfile_glClientWaitSyncAPPLE (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCLIENTWAITSYNCAPPLEPROC)_glewProfileTargets[367])(a0, a1, a2);
+  _glewProfileEnd(367, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteSyncAPPLE (GLsync a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETESYNCAPPLEPROC)_glewProfileTargets[368])(a0);
+  _glewProfileEnd(368, t);
+}
+
+static GLsync GLAPIENTRY _glewProfile_glFenceSyncAPPLE (GLenum a0, GLbitfield a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLsync r = ((PFNGLFENCESYNCAPPLEPROC)_glewProfileTargets[369])(a0, a1);
+  _glewProfileEnd(369, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetInteger64vAPPLE (GLenum a0, GLint64* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGER64VAPPLEPROC)_glewProfileTargets[370])(a0, a1);
+  _glewProfileEnd(370, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSyncivAPPLE (GLsync a0, GLenum a1, GLsizei a2, GLsizei* a3, GLint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSYNCIVAPPLEPROC)_glewProfileTargets[371])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(371, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsSyncAPPLE (GLsync a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSYNCAPPLEPROC)_glewProfileTargets[372])(a0);
+  _glewProfileEnd(372, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glWaitSyncAPPLE (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWAITSYNCAPPLEPROC)_glewProfileTargets[373])(a0, a1, a2);
+  _glewProfileEnd(373, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterPointervAPPLE (GLenum a0, GLenum a1, void ** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)_glewProfileTargets[374])(a0, a1, a2);
+  _glewProfileEnd(374, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureRangeAPPLE (GLenum a0, GLsizei a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURERANGEAPPLEPROC)_glewProfileTargets[375])(a0, a1, a2);
+  _glewProfileEnd(375, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexArrayAPPLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXARRAYAPPLEPROC)_glewProfileTargets[376])(a0);
+  _glewProfileEnd(376, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteVertexArraysAPPLE (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEVERTEXARRAYSAPPLEPROC)_glewProfileTargets[377])(a0, a1);
+  _glewProfileEnd(377, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenVertexArraysAPPLE (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENVERTEXARRAYSAPPLEPROC)_glewProfileTargets[378])(a0, a1);
+  _glewProfileEnd(378, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsVertexArrayAPPLE (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISVERTEXARRAYAPPLEPROC)_glewProfileTargets[379])(a0);
+  _glewProfileEnd(379, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFlushVertexArrayRangeAPPLE (GLsizei a0, void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)_glewProfileTargets[380])(a0, a1);
+  _glewProfileEnd(380, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayParameteriAPPLE (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYPARAMETERIAPPLEPROC)_glewProfileTargets[381])(a0, a1);
+  _glewProfileEnd(381, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayRangeAPPLE (GLsizei a0, void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYRANGEAPPLEPROC)_glewProfileTargets[382])(a0, a1);
+  _glewProfileEnd(382, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVertexAttribAPPLE (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVERTEXATTRIBAPPLEPROC)_glewProfileTargets[383])(a0, a1);
+  _glewProfileEnd(383, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVertexAttribAPPLE (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVERTEXATTRIBAPPLEPROC)_glewProfileTargets[384])(a0, a1);
+  _glewProfileEnd(384, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsVertexAttribEnabledAPPLE (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISVERTEXATTRIBENABLEDAPPLEPROC)_glewProfileTargets[385])(a0, a1);
+  _glewProfileEnd(385, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMapVertexAttrib1dAPPLE (GLuint a0, GLuint a1, GLdouble a2, GLdouble a3, GLint a4, GLint a5, const GLdouble* a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPVERTEXATTRIB1DAPPLEPROC)_glewProfileTargets[386])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(386, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMapVertexAttrib1fAPPLE (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3, GLint a4, GLint a5, const GLfloat* a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPVERTEXATTRIB1FAPPLEPROC)_glewProfileTargets[387])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(387, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMapVertexAttrib2dAPPLE (GLuint a0, GLuint a1, GLdouble a2, GLdouble a3, GLint a4, GLint a5, GLdouble a6, GLdouble a7, GLint a8, GLint a9, const GLdouble* a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPVERTEXATTRIB2DAPPLEPROC)_glewProfileTargets[388])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(388, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMapVertexAttrib2fAPPLE (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3, GLint a4, GLint a5, GLfloat a6, GLfloat a7, GLint a8, GLint a9, const GLfloat* a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPVERTEXATTRIB2FAPPLEPROC)_glewProfileTargets[389])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(389, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearDepthf (GLclampf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARDEPTHFPROC)_glewProfileTargets[390])(a0);
+  _glewProfileEnd(390, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangef (GLclampf a0, GLclampf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEFPROC)_glewProfileTargets[391])(a0, a1);
+  _glewProfileEnd(391, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShaderPrecisionFormat (GLenum a0, GLenum a1, GLint* a2, GLint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADERPRECISIONFORMATPROC)_glewProfileTargets[392])(a0, a1, a2, a3);
+  _glewProfileEnd(392, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReleaseShaderCompiler (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRELEASESHADERCOMPILERPROC)_glewProfileTargets[393])();
+  _glewProfileEnd(393, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderBinary (GLsizei a0, const GLuint* a1, GLenum a2, const void* a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADERBINARYPROC)_glewProfileTargets[394])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(394, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMemoryBarrierByRegion (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMEMORYBARRIERBYREGIONPROC)_glewProfileTargets[395])(a0);
+  _glewProfileEnd(395, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPrimitiveBoundingBoxARB (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIMITIVEBOUNDINGBOXARBPROC)_glewProfileTargets[396])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(396, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstancedBaseInstance (GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)_glewProfileTargets[397])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(397, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedBaseInstance (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)_glewProfileTargets[398])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(398, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedBaseVertexBaseInstance (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5, GLuint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)_glewProfileTargets[399])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(399, t);
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetImageHandleARB (GLuint a0, GLint a1, GLboolean a2, GLint a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETIMAGEHANDLEARBPROC)_glewProfileTargets[400])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(400, t);
+  return r;
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetTextureHandleARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETTEXTUREHANDLEARBPROC)_glewProfileTargets[401])(a0);
+  _glewProfileEnd(401, t);
+  return r;
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetTextureSamplerHandleARB (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETTEXTURESAMPLERHANDLEARBPROC)_glewProfileTargets[402])(a0, a1);
+  _glewProfileEnd(402, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribLui64vARB (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBLUI64VARBPROC)_glewProfileTargets[403])(a0, a1, a2);
+  _glewProfileEnd(403, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsImageHandleResidentARB (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISIMAGEHANDLERESIDENTARBPROC)_glewProfileTargets[404])(a0);
+  _glewProfileEnd(404, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsTextureHandleResidentARB (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISTEXTUREHANDLERESIDENTARBPROC)_glewProfileTargets[405])(a0);
+  _glewProfileEnd(405, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMakeImageHandleNonResidentARB (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)_glewProfileTargets[406])(a0);
+  _glewProfileEnd(406, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeImageHandleResidentARB (GLuint64 a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKEIMAGEHANDLERESIDENTARBPROC)_glewProfileTargets[407])(a0, a1);
+  _glewProfileEnd(407, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeTextureHandleNonResidentARB (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)_glewProfileTargets[408])(a0);
+  _glewProfileEnd(408, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeTextureHandleResidentARB (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)_glewProfileTargets[409])(a0);
+  _glewProfileEnd(409, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformHandleui64ARB (GLuint a0, GLint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)_glewProfileTargets[410])(a0, a1, a2);
+  _glewProfileEnd(410, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformHandleui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)_glewProfileTargets[411])(a0, a1, a2, a3);
+  _glewProfileEnd(411, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformHandleui64ARB (GLint a0, GLuint64 a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMHANDLEUI64ARBPROC)_glewProfileTargets[412])(a0, a1);
+  _glewProfileEnd(412, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformHandleui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMHANDLEUI64VARBPROC)_glewProfileTargets[413])(a0, a1, a2);
+  _glewProfileEnd(413, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1ui64ARB (GLuint a0, GLuint64EXT a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1UI64ARBPROC)_glewProfileTargets[414])(a0, a1);
+  _glewProfileEnd(414, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1ui64vARB (GLuint a0, const GLuint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1UI64VARBPROC)_glewProfileTargets[415])(a0, a1);
+  _glewProfileEnd(415, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFragDataLocationIndexed (GLuint a0, GLuint a1, GLuint a2, const GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)_glewProfileTargets[416])(a0, a1, a2, a3);
+  _glewProfileEnd(416, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetFragDataIndex (GLuint a0, const GLchar * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETFRAGDATAINDEXPROC)_glewProfileTargets[417])(a0, a1);
+  _glewProfileEnd(417, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBufferStorage (GLenum a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERSTORAGEPROC)_glewProfileTargets[418])(a0, a1, a2, a3);
+  _glewProfileEnd(418, t);
+}
+
+static GLsync GLAPIENTRY _glewProfile_glCreateSyncFromCLeventARB (cl_context a0, cl_event a1, GLbitfield a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLsync r = ((PFNGLCREATESYNCFROMCLEVENTARBPROC)_glewProfileTargets[419])(a0, a1, a2);
+  _glewProfileEnd(419, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glClearBufferData (GLenum a0, GLenum a1, GLenum a2, GLenum a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARBUFFERDATAPROC)_glewProfileTargets[420])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(420, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearBufferSubData (GLenum a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARBUFFERSUBDATAPROC)_glewProfileTargets[421])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(421, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedBufferDataEXT (GLuint a0, GLenum a1, GLenum a2, GLenum a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDBUFFERDATAEXTPROC)_glewProfileTargets[422])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(422, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedBufferSubDataEXT (GLuint a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)_glewProfileTargets[423])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(423, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearTexImage (GLuint a0, GLint a1, GLenum a2, GLenum a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARTEXIMAGEPROC)_glewProfileTargets[424])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(424, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearTexSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARTEXSUBIMAGEPROC)_glewProfileTargets[425])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(425, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClipControl (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIPCONTROLPROC)_glewProfileTargets[426])(a0, a1);
+  _glewProfileEnd(426, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClampColorARB (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLAMPCOLORARBPROC)_glewProfileTargets[427])(a0, a1);
+  _glewProfileEnd(427, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDispatchCompute (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISPATCHCOMPUTEPROC)_glewProfileTargets[428])(a0, a1, a2);
+  _glewProfileEnd(428, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDispatchComputeIndirect (GLintptr a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISPATCHCOMPUTEINDIRECTPROC)_glewProfileTargets[429])(a0);
+  _glewProfileEnd(429, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDispatchComputeGroupSizeARB (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)_glewProfileTargets[430])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(430, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyBufferSubData (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYBUFFERSUBDATAPROC)_glewProfileTargets[431])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(431, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyImageSubData (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYIMAGESUBDATAPROC)_glewProfileTargets[432])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+  _glewProfileEnd(432, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageCallbackARB (GLDEBUGPROCARB a0, const void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGECALLBACKARBPROC)_glewProfileTargets[433])(a0, a1);
+  _glewProfileEnd(433, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageControlARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint* a4, GLboolean a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGECONTROLARBPROC)_glewProfileTargets[434])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(434, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageInsertARB (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGEINSERTARBPROC)_glewProfileTargets[435])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(435, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetDebugMessageLogARB (GLuint a0, GLsizei a1, GLenum* a2, GLenum* a3, GLuint* a4, GLenum* a5, GLsizei* a6, GLchar* a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETDEBUGMESSAGELOGARBPROC)_glewProfileTargets[436])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(436, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindTextureUnit (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDTEXTUREUNITPROC)_glewProfileTargets[437])(a0, a1);
+  _glewProfileEnd(437, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlitNamedFramebuffer (GLuint a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLint a8, GLint a9, GLbitfield a10, GLenum a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLITNAMEDFRAMEBUFFERPROC)_glewProfileTargets[438])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(438, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glCheckNamedFramebufferStatus (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)_glewProfileTargets[439])(a0, a1);
+  _glewProfileEnd(439, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedBufferData (GLuint a0, GLenum a1, GLenum a2, GLenum a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDBUFFERDATAPROC)_glewProfileTargets[440])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(440, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedBufferSubData (GLuint a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDBUFFERSUBDATAPROC)_glewProfileTargets[441])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(441, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedFramebufferfi (GLuint a0, GLenum a1, GLint a2, GLfloat a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)_glewProfileTargets[442])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(442, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedFramebufferfv (GLuint a0, GLenum a1, GLint a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)_glewProfileTargets[443])(a0, a1, a2, a3);
+  _glewProfileEnd(443, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedFramebufferiv (GLuint a0, GLenum a1, GLint a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)_glewProfileTargets[444])(a0, a1, a2, a3);
+  _glewProfileEnd(444, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearNamedFramebufferuiv (GLuint a0, GLenum a1, GLint a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)_glewProfileTargets[445])(a0, a1, a2, a3);
+  _glewProfileEnd(445, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureSubImage1D (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)_glewProfileTargets[446])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(446, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureSubImage2D (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)_glewProfileTargets[447])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(447, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureSubImage3D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)_glewProfileTargets[448])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(448, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyNamedBufferSubData (GLuint a0, GLuint a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYNAMEDBUFFERSUBDATAPROC)_glewProfileTargets[449])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(449, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureSubImage1D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURESUBIMAGE1DPROC)_glewProfileTargets[450])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(450, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureSubImage2D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURESUBIMAGE2DPROC)_glewProfileTargets[451])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(451, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureSubImage3D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURESUBIMAGE3DPROC)_glewProfileTargets[452])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(452, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateBuffers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEBUFFERSPROC)_glewProfileTargets[453])(a0, a1);
+  _glewProfileEnd(453, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateFramebuffers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEFRAMEBUFFERSPROC)_glewProfileTargets[454])(a0, a1);
+  _glewProfileEnd(454, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateProgramPipelines (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEPROGRAMPIPELINESPROC)_glewProfileTargets[455])(a0, a1);
+  _glewProfileEnd(455, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateQueries (GLenum a0, GLsizei a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEQUERIESPROC)_glewProfileTargets[456])(a0, a1, a2);
+  _glewProfileEnd(456, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateRenderbuffers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATERENDERBUFFERSPROC)_glewProfileTargets[457])(a0, a1);
+  _glewProfileEnd(457, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateSamplers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATESAMPLERSPROC)_glewProfileTargets[458])(a0, a1);
+  _glewProfileEnd(458, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateTextures (GLenum a0, GLsizei a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATETEXTURESPROC)_glewProfileTargets[459])(a0, a1, a2);
+  _glewProfileEnd(459, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateTransformFeedbacks (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATETRANSFORMFEEDBACKSPROC)_glewProfileTargets[460])(a0, a1);
+  _glewProfileEnd(460, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateVertexArrays (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEVERTEXARRAYSPROC)_glewProfileTargets[461])(a0, a1);
+  _glewProfileEnd(461, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVertexArrayAttrib (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVERTEXARRAYATTRIBPROC)_glewProfileTargets[462])(a0, a1);
+  _glewProfileEnd(462, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVertexArrayAttrib (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVERTEXARRAYATTRIBPROC)_glewProfileTargets[463])(a0, a1);
+  _glewProfileEnd(463, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFlushMappedNamedBufferRange (GLuint a0, GLintptr a1, GLsizeiptr a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)_glewProfileTargets[464])(a0, a1, a2);
+  _glewProfileEnd(464, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenerateTextureMipmap (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENERATETEXTUREMIPMAPPROC)_glewProfileTargets[465])(a0);
+  _glewProfileEnd(465, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCompressedTextureImage (GLuint a0, GLint a1, GLsizei a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)_glewProfileTargets[466])(a0, a1, a2, a3);
+  _glewProfileEnd(466, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferParameteri64v (GLuint a0, GLenum a1, GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)_glewProfileTargets[467])(a0, a1, a2);
+  _glewProfileEnd(467, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERPARAMETERIVPROC)_glewProfileTargets[468])(a0, a1, a2);
+  _glewProfileEnd(468, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferPointerv (GLuint a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERPOINTERVPROC)_glewProfileTargets[469])(a0, a1, a2);
+  _glewProfileEnd(469, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferSubData (GLuint a0, GLintptr a1, GLsizeiptr a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERSUBDATAPROC)_glewProfileTargets[470])(a0, a1, a2, a3);
+  _glewProfileEnd(470, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedFramebufferAttachmentParameteriv (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)_glewProfileTargets[471])(a0, a1, a2, a3);
+  _glewProfileEnd(471, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedFramebufferParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)_glewProfileTargets[472])(a0, a1, a2);
+  _glewProfileEnd(472, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedRenderbufferParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)_glewProfileTargets[473])(a0, a1, a2);
+  _glewProfileEnd(473, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryBufferObjecti64v (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYBUFFEROBJECTI64VPROC)_glewProfileTargets[474])(a0, a1, a2, a3);
+  _glewProfileEnd(474, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryBufferObjectiv (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYBUFFEROBJECTIVPROC)_glewProfileTargets[475])(a0, a1, a2, a3);
+  _glewProfileEnd(475, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryBufferObjectui64v (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYBUFFEROBJECTUI64VPROC)_glewProfileTargets[476])(a0, a1, a2, a3);
+  _glewProfileEnd(476, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryBufferObjectuiv (GLuint a0, GLuint a1, GLenum a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYBUFFEROBJECTUIVPROC)_glewProfileTargets[477])(a0, a1, a2, a3);
+  _glewProfileEnd(477, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureImage (GLuint a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREIMAGEPROC)_glewProfileTargets[478])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(478, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureLevelParameterfv (GLuint a0, GLint a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTURELEVELPARAMETERFVPROC)_glewProfileTargets[479])(a0, a1, a2, a3);
+  _glewProfileEnd(479, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureLevelParameteriv (GLuint a0, GLint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTURELEVELPARAMETERIVPROC)_glewProfileTargets[480])(a0, a1, a2, a3);
+  _glewProfileEnd(480, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterIiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERIIVPROC)_glewProfileTargets[481])(a0, a1, a2);
+  _glewProfileEnd(481, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterIuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERIUIVPROC)_glewProfileTargets[482])(a0, a1, a2);
+  _glewProfileEnd(482, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterfv (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERFVPROC)_glewProfileTargets[483])(a0, a1, a2);
+  _glewProfileEnd(483, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERIVPROC)_glewProfileTargets[484])(a0, a1, a2);
+  _glewProfileEnd(484, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTransformFeedbacki64_v (GLuint a0, GLenum a1, GLuint a2, GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSFORMFEEDBACKI64_VPROC)_glewProfileTargets[485])(a0, a1, a2, a3);
+  _glewProfileEnd(485, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTransformFeedbacki_v (GLuint a0, GLenum a1, GLuint a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSFORMFEEDBACKI_VPROC)_glewProfileTargets[486])(a0, a1, a2, a3);
+  _glewProfileEnd(486, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTransformFeedbackiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSFORMFEEDBACKIVPROC)_glewProfileTargets[487])(a0, a1, a2);
+  _glewProfileEnd(487, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayIndexed64iv (GLuint a0, GLuint a1, GLenum a2, GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYINDEXED64IVPROC)_glewProfileTargets[488])(a0, a1, a2, a3);
+  _glewProfileEnd(488, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayIndexediv (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYINDEXEDIVPROC)_glewProfileTargets[489])(a0, a1, a2, a3);
+  _glewProfileEnd(489, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYIVPROC)_glewProfileTargets[490])(a0, a1, a2);
+  _glewProfileEnd(490, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateNamedFramebufferData (GLuint a0, GLsizei a1, const GLenum* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)_glewProfileTargets[491])(a0, a1, a2);
+  _glewProfileEnd(491, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateNamedFramebufferSubData (GLuint a0, GLsizei a1, const GLenum* a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)_glewProfileTargets[492])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(492, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapNamedBuffer (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPNAMEDBUFFERPROC)_glewProfileTargets[493])(a0, a1);
+  _glewProfileEnd(493, t);
+  return r;
+}
+
+static void * GLAPIENTRY _glewProfile_glMapNamedBufferRange (GLuint a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPNAMEDBUFFERRANGEPROC)_glewProfileTargets[494])(a0, a1, a2, a3);
+  _glewProfileEnd(494, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferData (GLuint a0, GLsizeiptr a1, const void * a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERDATAPROC)_glewProfileTargets[495])(a0, a1, a2, a3);
+  _glewProfileEnd(495, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferStorage (GLuint a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERSTORAGEPROC)_glewProfileTargets[496])(a0, a1, a2, a3);
+  _glewProfileEnd(496, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferSubData (GLuint a0, GLintptr a1, GLsizeiptr a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERSUBDATAPROC)_glewProfileTargets[497])(a0, a1, a2, a3);
+  _glewProfileEnd(497, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferDrawBuffer (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)_glewProfileTargets[498])(a0, a1);
+  _glewProfileEnd(498, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferDrawBuffers (GLuint a0, GLsizei a1, const GLenum* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)_glewProfileTargets[499])(a0, a1, a2);
+  _glewProfileEnd(499, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)_glewProfileTargets[500])(a0, a1, a2);
+  _glewProfileEnd(500, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferReadBuffer (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)_glewProfileTargets[501])(a0, a1);
+  _glewProfileEnd(501, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferRenderbuffer (GLuint a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)_glewProfileTargets[502])(a0, a1, a2, a3);
+  _glewProfileEnd(502, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTexture (GLuint a0, GLenum a1, GLuint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)_glewProfileTargets[503])(a0, a1, a2, a3);
+  _glewProfileEnd(503, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTextureLayer (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)_glewProfileTargets[504])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(504, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedRenderbufferStorage (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDRENDERBUFFERSTORAGEPROC)_glewProfileTargets[505])(a0, a1, a2, a3);
+  _glewProfileEnd(505, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedRenderbufferStorageMultisample (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)_glewProfileTargets[506])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(506, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureBuffer (GLuint a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREBUFFERPROC)_glewProfileTargets[507])(a0, a1, a2);
+  _glewProfileEnd(507, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureBufferRange (GLuint a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREBUFFERRANGEPROC)_glewProfileTargets[508])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(508, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterIiv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIIVPROC)_glewProfileTargets[509])(a0, a1, a2);
+  _glewProfileEnd(509, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterIuiv (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIUIVPROC)_glewProfileTargets[510])(a0, a1, a2);
+  _glewProfileEnd(510, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterf (GLuint a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERFPROC)_glewProfileTargets[511])(a0, a1, a2);
+  _glewProfileEnd(511, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterfv (GLuint a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERFVPROC)_glewProfileTargets[512])(a0, a1, a2);
+  _glewProfileEnd(512, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIPROC)_glewProfileTargets[513])(a0, a1, a2);
+  _glewProfileEnd(513, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameteriv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIVPROC)_glewProfileTargets[514])(a0, a1, a2);
+  _glewProfileEnd(514, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage1D (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE1DPROC)_glewProfileTargets[515])(a0, a1, a2, a3);
+  _glewProfileEnd(515, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage2D (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE2DPROC)_glewProfileTargets[516])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(516, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage2DMultisample (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)_glewProfileTargets[517])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(517, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage3D (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE3DPROC)_glewProfileTargets[518])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(518, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage3DMultisample (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)_glewProfileTargets[519])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(519, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureSubImage1D (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESUBIMAGE1DPROC)_glewProfileTargets[520])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(520, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureSubImage2D (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESUBIMAGE2DPROC)_glewProfileTargets[521])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(521, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureSubImage3D (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESUBIMAGE3DPROC)_glewProfileTargets[522])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(522, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTransformFeedbackBufferBase (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)_glewProfileTargets[523])(a0, a1, a2);
+  _glewProfileEnd(523, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTransformFeedbackBufferRange (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)_glewProfileTargets[524])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(524, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glUnmapNamedBuffer (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLUNMAPNAMEDBUFFERPROC)_glewProfileTargets[525])(a0);
+  _glewProfileEnd(525, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayAttribBinding (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYATTRIBBINDINGPROC)_glewProfileTargets[526])(a0, a1, a2);
+  _glewProfileEnd(526, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayAttribFormat (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLboolean a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYATTRIBFORMATPROC)_glewProfileTargets[527])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(527, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayAttribIFormat (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYATTRIBIFORMATPROC)_glewProfileTargets[528])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(528, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayAttribLFormat (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYATTRIBLFORMATPROC)_glewProfileTargets[529])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(529, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayBindingDivisor (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYBINDINGDIVISORPROC)_glewProfileTargets[530])(a0, a1, a2);
+  _glewProfileEnd(530, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayElementBuffer (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYELEMENTBUFFERPROC)_glewProfileTargets[531])(a0, a1);
+  _glewProfileEnd(531, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexBuffer (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXBUFFERPROC)_glewProfileTargets[532])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(532, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexBuffers (GLuint a0, GLuint a1, GLsizei a2, const GLuint* a3, const GLintptr * a4, const GLsizei * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXBUFFERSPROC)_glewProfileTargets[533])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(533, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBuffersARB (GLsizei a0, const GLenum* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERSARBPROC)_glewProfileTargets[534])(a0, a1);
+  _glewProfileEnd(534, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparateiARB (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEIARBPROC)_glewProfileTargets[535])(a0, a1, a2);
+  _glewProfileEnd(535, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationiARB (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONIARBPROC)_glewProfileTargets[536])(a0, a1);
+  _glewProfileEnd(536, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparateiARB (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEIARBPROC)_glewProfileTargets[537])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(537, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFunciARB (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCIARBPROC)_glewProfileTargets[538])(a0, a1, a2);
+  _glewProfileEnd(538, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsBaseVertex (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSBASEVERTEXPROC)_glewProfileTargets[539])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(539, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedBaseVertex (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)_glewProfileTargets[540])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(540, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawRangeElementsBaseVertex (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)_glewProfileTargets[541])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(541, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsBaseVertex (GLenum a0, const GLsizei* a1, GLenum a2, const void*const * a3, GLsizei a4, const GLint * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)_glewProfileTargets[542])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(542, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysIndirect (GLenum a0, const void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINDIRECTPROC)_glewProfileTargets[543])(a0, a1);
+  _glewProfileEnd(543, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsIndirect (GLenum a0, GLenum a1, const void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINDIRECTPROC)_glewProfileTargets[544])(a0, a1, a2);
+  _glewProfileEnd(544, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferParameteri (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERPARAMETERIPROC)_glewProfileTargets[545])(a0, a1, a2);
+  _glewProfileEnd(545, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferParameteriv (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERPARAMETERIVPROC)_glewProfileTargets[546])(a0, a1, a2);
+  _glewProfileEnd(546, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedFramebufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)_glewProfileTargets[547])(a0, a1, a2);
+  _glewProfileEnd(547, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferParameteriEXT (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)_glewProfileTargets[548])(a0, a1, a2);
+  _glewProfileEnd(548, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFramebuffer (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAMEBUFFERPROC)_glewProfileTargets[549])(a0, a1);
+  _glewProfileEnd(549, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindRenderbuffer (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDRENDERBUFFERPROC)_glewProfileTargets[550])(a0, a1);
+  _glewProfileEnd(550, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlitFramebuffer (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLITFRAMEBUFFERPROC)_glewProfileTargets[551])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(551, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glCheckFramebufferStatus (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCHECKFRAMEBUFFERSTATUSPROC)_glewProfileTargets[552])(a0);
+  _glewProfileEnd(552, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteFramebuffers (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEFRAMEBUFFERSPROC)_glewProfileTargets[553])(a0, a1);
+  _glewProfileEnd(553, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteRenderbuffers (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETERENDERBUFFERSPROC)_glewProfileTargets[554])(a0, a1);
+  _glewProfileEnd(554, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferRenderbuffer (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERRENDERBUFFERPROC)_glewProfileTargets[555])(a0, a1, a2, a3);
+  _glewProfileEnd(555, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture1D (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE1DPROC)_glewProfileTargets[556])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(556, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture2D (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE2DPROC)_glewProfileTargets[557])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(557, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture3D (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE3DPROC)_glewProfileTargets[558])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(558, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureLayer (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURELAYERPROC)_glewProfileTargets[559])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(559, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenFramebuffers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENFRAMEBUFFERSPROC)_glewProfileTargets[560])(a0, a1);
+  _glewProfileEnd(560, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenRenderbuffers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENRENDERBUFFERSPROC)_glewProfileTargets[561])(a0, a1);
+  _glewProfileEnd(561, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenerateMipmap (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENERATEMIPMAPPROC)_glewProfileTargets[562])(a0);
+  _glewProfileEnd(562, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferAttachmentParameteriv (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)_glewProfileTargets[563])(a0, a1, a2, a3);
+  _glewProfileEnd(563, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetRenderbufferParameteriv (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETRENDERBUFFERPARAMETERIVPROC)_glewProfileTargets[564])(a0, a1, a2);
+  _glewProfileEnd(564, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsFramebuffer (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISFRAMEBUFFERPROC)_glewProfileTargets[565])(a0);
+  _glewProfileEnd(565, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsRenderbuffer (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISRENDERBUFFERPROC)_glewProfileTargets[566])(a0);
+  _glewProfileEnd(566, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorage (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEPROC)_glewProfileTargets[567])(a0, a1, a2, a3);
+  _glewProfileEnd(567, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)_glewProfileTargets[568])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(568, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureARB (GLenum a0, GLenum a1, GLuint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREARBPROC)_glewProfileTargets[569])(a0, a1, a2, a3);
+  _glewProfileEnd(569, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureFaceARB (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREFACEARBPROC)_glewProfileTargets[570])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(570, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureLayerARB (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURELAYERARBPROC)_glewProfileTargets[571])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(571, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameteriARB (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETERIARBPROC)_glewProfileTargets[572])(a0, a1, a2);
+  _glewProfileEnd(572, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramBinary (GLuint a0, GLsizei a1, GLsizei* a2, GLenum * a3, void* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMBINARYPROC)_glewProfileTargets[573])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(573, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramBinary (GLuint a0, GLenum a1, const void * a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMBINARYPROC)_glewProfileTargets[574])(a0, a1, a2, a3);
+  _glewProfileEnd(574, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETERIPROC)_glewProfileTargets[575])(a0, a1, a2);
+  _glewProfileEnd(575, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCompressedTextureSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLsizei a8, void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)_glewProfileTargets[576])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(576, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, GLsizei a10, void * a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTURESUBIMAGEPROC)_glewProfileTargets[577])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(577, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSpecializeShaderARB (GLuint a0, const GLchar* a1, GLuint a2, const GLuint* a3, const GLuint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSPECIALIZESHADERARBPROC)_glewProfileTargets[578])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(578, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformdv (GLuint a0, GLint a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMDVPROC)_glewProfileTargets[579])(a0, a1, a2);
+  _glewProfileEnd(579, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1d (GLint a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1DPROC)_glewProfileTargets[580])(a0, a1);
+  _glewProfileEnd(580, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1DVPROC)_glewProfileTargets[581])(a0, a1, a2);
+  _glewProfileEnd(581, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2d (GLint a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2DPROC)_glewProfileTargets[582])(a0, a1, a2);
+  _glewProfileEnd(582, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2DVPROC)_glewProfileTargets[583])(a0, a1, a2);
+  _glewProfileEnd(583, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3d (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3DPROC)_glewProfileTargets[584])(a0, a1, a2, a3);
+  _glewProfileEnd(584, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3DVPROC)_glewProfileTargets[585])(a0, a1, a2);
+  _glewProfileEnd(585, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4d (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4DPROC)_glewProfileTargets[586])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(586, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4dv (GLint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4DVPROC)_glewProfileTargets[587])(a0, a1, a2);
+  _glewProfileEnd(587, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2DVPROC)_glewProfileTargets[588])(a0, a1, a2, a3);
+  _glewProfileEnd(588, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2x3dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2X3DVPROC)_glewProfileTargets[589])(a0, a1, a2, a3);
+  _glewProfileEnd(589, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2x4dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2X4DVPROC)_glewProfileTargets[590])(a0, a1, a2, a3);
+  _glewProfileEnd(590, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3DVPROC)_glewProfileTargets[591])(a0, a1, a2, a3);
+  _glewProfileEnd(591, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3x2dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3X2DVPROC)_glewProfileTargets[592])(a0, a1, a2, a3);
+  _glewProfileEnd(592, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3x4dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3X4DVPROC)_glewProfileTargets[593])(a0, a1, a2, a3);
+  _glewProfileEnd(593, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4DVPROC)_glewProfileTargets[594])(a0, a1, a2, a3);
+  _glewProfileEnd(594, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4x2dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4X2DVPROC)_glewProfileTargets[595])(a0, a1, a2, a3);
+  _glewProfileEnd(595, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4x3dv (GLint a0, GLsizei a1, GLboolean a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4X3DVPROC)_glewProfileTargets[596])(a0, a1, a2, a3);
+  _glewProfileEnd(596, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformi64vARB (GLuint a0, GLint a1, GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMI64VARBPROC)_glewProfileTargets[597])(a0, a1, a2);
+  _glewProfileEnd(597, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformui64vARB (GLuint a0, GLint a1, GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMUI64VARBPROC)_glewProfileTargets[598])(a0, a1, a2);
+  _glewProfileEnd(598, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformi64vARB (GLuint a0, GLint a1, GLsizei a2, GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMI64VARBPROC)_glewProfileTargets[599])(a0, a1, a2, a3);
+  _glewProfileEnd(599, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformui64vARB (GLuint a0, GLint a1, GLsizei a2, GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMUI64VARBPROC)_glewProfileTargets[600])(a0, a1, a2, a3);
+  _glewProfileEnd(600, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1i64ARB (GLuint a0, GLint a1, GLint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1I64ARBPROC)_glewProfileTargets[601])(a0, a1, a2);
+  _glewProfileEnd(601, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1I64VARBPROC)_glewProfileTargets[602])(a0, a1, a2, a3);
+  _glewProfileEnd(602, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1ui64ARB (GLuint a0, GLint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UI64ARBPROC)_glewProfileTargets[603])(a0, a1, a2);
+  _glewProfileEnd(603, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UI64VARBPROC)_glewProfileTargets[604])(a0, a1, a2, a3);
+  _glewProfileEnd(604, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2i64ARB (GLuint a0, GLint a1, GLint64 a2, GLint64 a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2I64ARBPROC)_glewProfileTargets[605])(a0, a1, a2, a3);
+  _glewProfileEnd(605, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2I64VARBPROC)_glewProfileTargets[606])(a0, a1, a2, a3);
+  _glewProfileEnd(606, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2ui64ARB (GLuint a0, GLint a1, GLuint64 a2, GLuint64 a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UI64ARBPROC)_glewProfileTargets[607])(a0, a1, a2, a3);
+  _glewProfileEnd(607, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UI64VARBPROC)_glewProfileTargets[608])(a0, a1, a2, a3);
+  _glewProfileEnd(608, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3i64ARB (GLuint a0, GLint a1, GLint64 a2, GLint64 a3, GLint64 a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3I64ARBPROC)_glewProfileTargets[609])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(609, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3I64VARBPROC)_glewProfileTargets[610])(a0, a1, a2, a3);
+  _glewProfileEnd(610, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3ui64ARB (GLuint a0, GLint a1, GLuint64 a2, GLuint64 a3, GLuint64 a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UI64ARBPROC)_glewProfileTargets[611])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(611, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UI64VARBPROC)_glewProfileTargets[612])(a0, a1, a2, a3);
+  _glewProfileEnd(612, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4i64ARB (GLuint a0, GLint a1, GLint64 a2, GLint64 a3, GLint64 a4, GLint64 a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4I64ARBPROC)_glewProfileTargets[613])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(613, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4i64vARB (GLuint a0, GLint a1, GLsizei a2, const GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4I64VARBPROC)_glewProfileTargets[614])(a0, a1, a2, a3);
+  _glewProfileEnd(614, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4ui64ARB (GLuint a0, GLint a1, GLuint64 a2, GLuint64 a3, GLuint64 a4, GLuint64 a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UI64ARBPROC)_glewProfileTargets[615])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(615, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4ui64vARB (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UI64VARBPROC)_glewProfileTargets[616])(a0, a1, a2, a3);
+  _glewProfileEnd(616, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1i64ARB (GLint a0, GLint64 a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1I64ARBPROC)_glewProfileTargets[617])(a0, a1);
+  _glewProfileEnd(617, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1I64VARBPROC)_glewProfileTargets[618])(a0, a1, a2);
+  _glewProfileEnd(618, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1ui64ARB (GLint a0, GLuint64 a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UI64ARBPROC)_glewProfileTargets[619])(a0, a1);
+  _glewProfileEnd(619, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UI64VARBPROC)_glewProfileTargets[620])(a0, a1, a2);
+  _glewProfileEnd(620, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2i64ARB (GLint a0, GLint64 a1, GLint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2I64ARBPROC)_glewProfileTargets[621])(a0, a1, a2);
+  _glewProfileEnd(621, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2I64VARBPROC)_glewProfileTargets[622])(a0, a1, a2);
+  _glewProfileEnd(622, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2ui64ARB (GLint a0, GLuint64 a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UI64ARBPROC)_glewProfileTargets[623])(a0, a1, a2);
+  _glewProfileEnd(623, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UI64VARBPROC)_glewProfileTargets[624])(a0, a1, a2);
+  _glewProfileEnd(624, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3i64ARB (GLint a0, GLint64 a1, GLint64 a2, GLint64 a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3I64ARBPROC)_glewProfileTargets[625])(a0, a1, a2, a3);
+  _glewProfileEnd(625, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3I64VARBPROC)_glewProfileTargets[626])(a0, a1, a2);
+  _glewProfileEnd(626, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3ui64ARB (GLint a0, GLuint64 a1, GLuint64 a2, GLuint64 a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UI64ARBPROC)_glewProfileTargets[627])(a0, a1, a2, a3);
+  _glewProfileEnd(627, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UI64VARBPROC)_glewProfileTargets[628])(a0, a1, a2);
+  _glewProfileEnd(628, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4i64ARB (GLint a0, GLint64 a1, GLint64 a2, GLint64 a3, GLint64 a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4I64ARBPROC)_glewProfileTargets[629])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(629, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4i64vARB (GLint a0, GLsizei a1, const GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4I64VARBPROC)_glewProfileTargets[630])(a0, a1, a2);
+  _glewProfileEnd(630, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4ui64ARB (GLint a0, GLuint64 a1, GLuint64 a2, GLuint64 a3, GLuint64 a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UI64ARBPROC)_glewProfileTargets[631])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(631, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4ui64vARB (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UI64VARBPROC)_glewProfileTargets[632])(a0, a1, a2);
+  _glewProfileEnd(632, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorSubTable (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORSUBTABLEPROC)_glewProfileTargets[633])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(633, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTable (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLEPROC)_glewProfileTargets[634])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(634, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTableParameterfv (GLenum a0, GLenum a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLEPARAMETERFVPROC)_glewProfileTargets[635])(a0, a1, a2);
+  _glewProfileEnd(635, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTableParameteriv (GLenum a0, GLenum a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLEPARAMETERIVPROC)_glewProfileTargets[636])(a0, a1, a2);
+  _glewProfileEnd(636, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionFilter1D (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONFILTER1DPROC)_glewProfileTargets[637])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(637, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionFilter2D (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONFILTER2DPROC)_glewProfileTargets[638])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(638, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameterf (GLenum a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERFPROC)_glewProfileTargets[639])(a0, a1, a2);
+  _glewProfileEnd(639, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameterfv (GLenum a0, GLenum a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERFVPROC)_glewProfileTargets[640])(a0, a1, a2);
+  _glewProfileEnd(640, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameteri (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERIPROC)_glewProfileTargets[641])(a0, a1, a2);
+  _glewProfileEnd(641, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameteriv (GLenum a0, GLenum a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERIVPROC)_glewProfileTargets[642])(a0, a1, a2);
+  _glewProfileEnd(642, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyColorSubTable (GLenum a0, GLsizei a1, GLint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCOLORSUBTABLEPROC)_glewProfileTargets[643])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(643, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyColorTable (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCOLORTABLEPROC)_glewProfileTargets[644])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(644, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyConvolutionFilter1D (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCONVOLUTIONFILTER1DPROC)_glewProfileTargets[645])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(645, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyConvolutionFilter2D (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCONVOLUTIONFILTER2DPROC)_glewProfileTargets[646])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(646, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTable (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPROC)_glewProfileTargets[647])(a0, a1, a2, a3);
+  _glewProfileEnd(647, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPARAMETERFVPROC)_glewProfileTargets[648])(a0, a1, a2);
+  _glewProfileEnd(648, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPARAMETERIVPROC)_glewProfileTargets[649])(a0, a1, a2);
+  _glewProfileEnd(649, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetConvolutionFilter (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCONVOLUTIONFILTERPROC)_glewProfileTargets[650])(a0, a1, a2, a3);
+  _glewProfileEnd(650, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetConvolutionParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCONVOLUTIONPARAMETERFVPROC)_glewProfileTargets[651])(a0, a1, a2);
+  _glewProfileEnd(651, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetConvolutionParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCONVOLUTIONPARAMETERIVPROC)_glewProfileTargets[652])(a0, a1, a2);
+  _glewProfileEnd(652, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetHistogram (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETHISTOGRAMPROC)_glewProfileTargets[653])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(653, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetHistogramParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETHISTOGRAMPARAMETERFVPROC)_glewProfileTargets[654])(a0, a1, a2);
+  _glewProfileEnd(654, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetHistogramParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETHISTOGRAMPARAMETERIVPROC)_glewProfileTargets[655])(a0, a1, a2);
+  _glewProfileEnd(655, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMinmax (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMINMAXPROC)_glewProfileTargets[656])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(656, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMinmaxParameterfv (GLenum a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMINMAXPARAMETERFVPROC)_glewProfileTargets[657])(a0, a1, a2);
+  _glewProfileEnd(657, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMinmaxParameteriv (GLenum a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMINMAXPARAMETERIVPROC)_glewProfileTargets[658])(a0, a1, a2);
+  _glewProfileEnd(658, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSeparableFilter (GLenum a0, GLenum a1, GLenum a2, void * a3, void * a4, void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSEPARABLEFILTERPROC)_glewProfileTargets[659])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(659, t);
+}
+
+static void GLAPIENTRY _glewProfile_glHistogram (GLenum a0, GLsizei a1, GLenum a2, GLboolean a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLHISTOGRAMPROC)_glewProfileTargets[660])(a0, a1, a2, a3);
+  _glewProfileEnd(660, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMinmax (GLenum a0, GLenum a1, GLboolean a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMINMAXPROC)_glewProfileTargets[661])(a0, a1, a2);
+  _glewProfileEnd(661, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResetHistogram (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESETHISTOGRAMPROC)_glewProfileTargets[662])(a0);
+  _glewProfileEnd(662, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResetMinmax (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESETMINMAXPROC)_glewProfileTargets[663])(a0);
+  _glewProfileEnd(663, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSeparableFilter2D (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSEPARABLEFILTER2DPROC)_glewProfileTargets[664])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(664, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirectCountARB (GLenum a0, const void * a1, GLintptr a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)_glewProfileTargets[665])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(665, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirectCountARB (GLenum a0, GLenum a1, const void * a2, GLintptr a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)_glewProfileTargets[666])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(666, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstancedARB (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDARBPROC)_glewProfileTargets[667])(a0, a1, a2, a3);
+  _glewProfileEnd(667, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedARB (GLenum a0, GLsizei a1, GLenum a2, const void* a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDARBPROC)_glewProfileTargets[668])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(668, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribDivisorARB (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBDIVISORARBPROC)_glewProfileTargets[669])(a0, a1);
+  _glewProfileEnd(669, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInternalformativ (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTERNALFORMATIVPROC)_glewProfileTargets[670])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(670, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInternalformati64v (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint64* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTERNALFORMATI64VPROC)_glewProfileTargets[671])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(671, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateBufferData (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATEBUFFERDATAPROC)_glewProfileTargets[672])(a0);
+  _glewProfileEnd(672, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateBufferSubData (GLuint a0, GLintptr a1, GLsizeiptr a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATEBUFFERSUBDATAPROC)_glewProfileTargets[673])(a0, a1, a2);
+  _glewProfileEnd(673, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateFramebuffer (GLenum a0, GLsizei a1, const GLenum* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATEFRAMEBUFFERPROC)_glewProfileTargets[674])(a0, a1, a2);
+  _glewProfileEnd(674, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateSubFramebuffer (GLenum a0, GLsizei a1, const GLenum* a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATESUBFRAMEBUFFERPROC)_glewProfileTargets[675])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(675, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateTexImage (GLuint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATETEXIMAGEPROC)_glewProfileTargets[676])(a0, a1);
+  _glewProfileEnd(676, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInvalidateTexSubImage (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINVALIDATETEXSUBIMAGEPROC)_glewProfileTargets[677])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(677, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFlushMappedBufferRange (GLenum a0, GLintptr a1, GLsizeiptr a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHMAPPEDBUFFERRANGEPROC)_glewProfileTargets[678])(a0, a1, a2);
+  _glewProfileEnd(678, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapBufferRange (GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPBUFFERRANGEPROC)_glewProfileTargets[679])(a0, a1, a2, a3);
+  _glewProfileEnd(679, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glCurrentPaletteMatrixARB (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCURRENTPALETTEMATRIXARBPROC)_glewProfileTargets[680])(a0);
+  _glewProfileEnd(680, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixIndexPointerARB (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXINDEXPOINTERARBPROC)_glewProfileTargets[681])(a0, a1, a2, a3);
+  _glewProfileEnd(681, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixIndexubvARB (GLint a0, GLubyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXINDEXUBVARBPROC)_glewProfileTargets[682])(a0, a1);
+  _glewProfileEnd(682, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixIndexuivARB (GLint a0, GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXINDEXUIVARBPROC)_glewProfileTargets[683])(a0, a1);
+  _glewProfileEnd(683, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixIndexusvARB (GLint a0, GLushort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXINDEXUSVARBPROC)_glewProfileTargets[684])(a0, a1);
+  _glewProfileEnd(684, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBuffersBase (GLenum a0, GLuint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERSBASEPROC)_glewProfileTargets[685])(a0, a1, a2, a3);
+  _glewProfileEnd(685, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBuffersRange (GLenum a0, GLuint a1, GLsizei a2, const GLuint* a3, const GLintptr * a4, const GLsizeiptr * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERSRANGEPROC)_glewProfileTargets[686])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(686, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindImageTextures (GLuint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDIMAGETEXTURESPROC)_glewProfileTargets[687])(a0, a1, a2);
+  _glewProfileEnd(687, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindSamplers (GLuint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDSAMPLERSPROC)_glewProfileTargets[688])(a0, a1, a2);
+  _glewProfileEnd(688, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindTextures (GLuint a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDTEXTURESPROC)_glewProfileTargets[689])(a0, a1, a2);
+  _glewProfileEnd(689, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexBuffers (GLuint a0, GLsizei a1, const GLuint* a2, const GLintptr * a3, const GLsizei * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXBUFFERSPROC)_glewProfileTargets[690])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(690, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirect (GLenum a0, const void * a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTPROC)_glewProfileTargets[691])(a0, a1, a2, a3);
+  _glewProfileEnd(691, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirect (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTPROC)_glewProfileTargets[692])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(692, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleCoverageARB (GLclampf a0, GLboolean a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLECOVERAGEARBPROC)_glewProfileTargets[693])(a0, a1);
+  _glewProfileEnd(693, t);
+}
+
+static void GLAPIENTRY _glewProfile_glActiveTextureARB (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLACTIVETEXTUREARBPROC)_glewProfileTargets[694])(a0);
+  _glewProfileEnd(694, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClientActiveTextureARB (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIENTACTIVETEXTUREARBPROC)_glewProfileTargets[695])(a0);
+  _glewProfileEnd(695, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1dARB (GLenum a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1DARBPROC)_glewProfileTargets[696])(a0, a1);
+  _glewProfileEnd(696, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1dvARB (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1DVARBPROC)_glewProfileTargets[697])(a0, a1);
+  _glewProfileEnd(697, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1fARB (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1FARBPROC)_glewProfileTargets[698])(a0, a1);
+  _glewProfileEnd(698, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1fvARB (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1FVARBPROC)_glewProfileTargets[699])(a0, a1);
+  _glewProfileEnd(699, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1iARB (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1IARBPROC)_glewProfileTargets[700])(a0, a1);
+  _glewProfileEnd(700, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1ivARB (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1IVARBPROC)_glewProfileTargets[701])(a0, a1);
+  _glewProfileEnd(701, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1sARB (GLenum a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1SARBPROC)_glewProfileTargets[702])(a0, a1);
+  _glewProfileEnd(702, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1svARB (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1SVARBPROC)_glewProfileTargets[703])(a0, a1);
+  _glewProfileEnd(703, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2dARB (GLenum a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2DARBPROC)_glewProfileTargets[704])(a0, a1, a2);
+  _glewProfileEnd(704, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2dvARB (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2DVARBPROC)_glewProfileTargets[705])(a0, a1);
+  _glewProfileEnd(705, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2fARB (GLenum a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2FARBPROC)_glewProfileTargets[706])(a0, a1, a2);
+  _glewProfileEnd(706, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2fvARB (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2FVARBPROC)_glewProfileTargets[707])(a0, a1);
+  _glewProfileEnd(707, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2iARB (GLenum a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2IARBPROC)_glewProfileTargets[708])(a0, a1, a2);
+  _glewProfileEnd(708, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2ivARB (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2IVARBPROC)_glewProfileTargets[709])(a0, a1);
+  _glewProfileEnd(709, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2sARB (GLenum a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2SARBPROC)_glewProfileTargets[710])(a0, a1, a2);
+  _glewProfileEnd(710, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2svARB (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2SVARBPROC)_glewProfileTargets[711])(a0, a1);
+  _glewProfileEnd(711, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3dARB (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3DARBPROC)_glewProfileTargets[712])(a0, a1, a2, a3);
+  _glewProfileEnd(712, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3dvARB (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3DVARBPROC)_glewProfileTargets[713])(a0, a1);
+  _glewProfileEnd(713, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3fARB (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3FARBPROC)_glewProfileTargets[714])(a0, a1, a2, a3);
+  _glewProfileEnd(714, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3fvARB (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3FVARBPROC)_glewProfileTargets[715])(a0, a1);
+  _glewProfileEnd(715, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3iARB (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3IARBPROC)_glewProfileTargets[716])(a0, a1, a2, a3);
+  _glewProfileEnd(716, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3ivARB (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3IVARBPROC)_glewProfileTargets[717])(a0, a1);
+  _glewProfileEnd(717, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3sARB (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3SARBPROC)_glewProfileTargets[718])(a0, a1, a2, a3);
+  _glewProfileEnd(718, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3svARB (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3SVARBPROC)_glewProfileTargets[719])(a0, a1);
+  _glewProfileEnd(719, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4dARB (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4DARBPROC)_glewProfileTargets[720])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(720, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4dvARB (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4DVARBPROC)_glewProfileTargets[721])(a0, a1);
+  _glewProfileEnd(721, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4fARB (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4FARBPROC)_glewProfileTargets[722])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(722, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4fvARB (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4FVARBPROC)_glewProfileTargets[723])(a0, a1);
+  _glewProfileEnd(723, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4iARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4IARBPROC)_glewProfileTargets[724])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(724, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4ivARB (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4IVARBPROC)_glewProfileTargets[725])(a0, a1);
+  _glewProfileEnd(725, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4sARB (GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4SARBPROC)_glewProfileTargets[726])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(726, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4svARB (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4SVARBPROC)_glewProfileTargets[727])(a0, a1);
+  _glewProfileEnd(727, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginQueryARB (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINQUERYARBPROC)_glewProfileTargets[728])(a0, a1);
+  _glewProfileEnd(728, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteQueriesARB (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEQUERIESARBPROC)_glewProfileTargets[729])(a0, a1);
+  _glewProfileEnd(729, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndQueryARB (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDQUERYARBPROC)_glewProfileTargets[730])(a0);
+  _glewProfileEnd(730, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenQueriesARB (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENQUERIESARBPROC)_glewProfileTargets[731])(a0, a1);
+  _glewProfileEnd(731, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectivARB (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTIVARBPROC)_glewProfileTargets[732])(a0, a1, a2);
+  _glewProfileEnd(732, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectuivARB (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUIVARBPROC)_glewProfileTargets[733])(a0, a1, a2);
+  _glewProfileEnd(733, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryivARB (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYIVARBPROC)_glewProfileTargets[734])(a0, a1, a2);
+  _glewProfileEnd(734, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsQueryARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISQUERYARBPROC)_glewProfileTargets[735])(a0);
+  _glewProfileEnd(735, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMaxShaderCompilerThreadsARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAXSHADERCOMPILERTHREADSARBPROC)_glewProfileTargets[736])(a0);
+  _glewProfileEnd(736, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterfARB (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERFARBPROC)_glewProfileTargets[737])(a0, a1);
+  _glewProfileEnd(737, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterfvARB (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERFVARBPROC)_glewProfileTargets[738])(a0, a1);
+  _glewProfileEnd(738, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPolygonOffsetClamp (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOLYGONOFFSETCLAMPPROC)_glewProfileTargets[739])(a0, a1, a2);
+  _glewProfileEnd(739, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramInterfaceiv (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMINTERFACEIVPROC)_glewProfileTargets[740])(a0, a1, a2, a3);
+  _glewProfileEnd(740, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetProgramResourceIndex (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETPROGRAMRESOURCEINDEXPROC)_glewProfileTargets[741])(a0, a1, a2);
+  _glewProfileEnd(741, t);
+  return r;
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetProgramResourceLocation (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETPROGRAMRESOURCELOCATIONPROC)_glewProfileTargets[742])(a0, a1, a2);
+  _glewProfileEnd(742, t);
+  return r;
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetProgramResourceLocationIndex (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)_glewProfileTargets[743])(a0, a1, a2);
+  _glewProfileEnd(743, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramResourceName (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei* a4, GLchar * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMRESOURCENAMEPROC)_glewProfileTargets[744])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(744, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramResourceiv (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum* a4, GLsizei a5, GLsizei * a6, GLint * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMRESOURCEIVPROC)_glewProfileTargets[745])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(745, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProvokingVertex (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROVOKINGVERTEXPROC)_glewProfileTargets[746])(a0);
+  _glewProfileEnd(746, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glGetGraphicsResetStatusARB (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLGETGRAPHICSRESETSTATUSARBPROC)_glewProfileTargets[747])();
+  _glewProfileEnd(747, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetnColorTableARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, void* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNCOLORTABLEARBPROC)_glewProfileTargets[748])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(748, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnCompressedTexImageARB (GLenum a0, GLint a1, GLsizei a2, void* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)_glewProfileTargets[749])(a0, a1, a2, a3);
+  _glewProfileEnd(749, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnConvolutionFilterARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, void* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNCONVOLUTIONFILTERARBPROC)_glewProfileTargets[750])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(750, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnHistogramARB (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, GLsizei a4, void* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNHISTOGRAMARBPROC)_glewProfileTargets[751])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(751, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnMapdvARB (GLenum a0, GLenum a1, GLsizei a2, GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNMAPDVARBPROC)_glewProfileTargets[752])(a0, a1, a2, a3);
+  _glewProfileEnd(752, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnMapfvARB (GLenum a0, GLenum a1, GLsizei a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNMAPFVARBPROC)_glewProfileTargets[753])(a0, a1, a2, a3);
+  _glewProfileEnd(753, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnMapivARB (GLenum a0, GLenum a1, GLsizei a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNMAPIVARBPROC)_glewProfileTargets[754])(a0, a1, a2, a3);
+  _glewProfileEnd(754, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnMinmaxARB (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, GLsizei a4, void* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNMINMAXARBPROC)_glewProfileTargets[755])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(755, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnPixelMapfvARB (GLenum a0, GLsizei a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNPIXELMAPFVARBPROC)_glewProfileTargets[756])(a0, a1, a2);
+  _glewProfileEnd(756, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnPixelMapuivARB (GLenum a0, GLsizei a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNPIXELMAPUIVARBPROC)_glewProfileTargets[757])(a0, a1, a2);
+  _glewProfileEnd(757, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnPixelMapusvARB (GLenum a0, GLsizei a1, GLushort* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNPIXELMAPUSVARBPROC)_glewProfileTargets[758])(a0, a1, a2);
+  _glewProfileEnd(758, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnPolygonStippleARB (GLsizei a0, GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNPOLYGONSTIPPLEARBPROC)_glewProfileTargets[759])(a0, a1);
+  _glewProfileEnd(759, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnSeparableFilterARB (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, void* a4, GLsizei a5, void* a6, void* a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNSEPARABLEFILTERARBPROC)_glewProfileTargets[760])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(760, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnTexImageARB (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNTEXIMAGEARBPROC)_glewProfileTargets[761])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(761, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformdvARB (GLuint a0, GLint a1, GLsizei a2, GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMDVARBPROC)_glewProfileTargets[762])(a0, a1, a2, a3);
+  _glewProfileEnd(762, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformfvARB (GLuint a0, GLint a1, GLsizei a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMFVARBPROC)_glewProfileTargets[763])(a0, a1, a2, a3);
+  _glewProfileEnd(763, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformivARB (GLuint a0, GLint a1, GLsizei a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMIVARBPROC)_glewProfileTargets[764])(a0, a1, a2, a3);
+  _glewProfileEnd(764, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformuivARB (GLuint a0, GLint a1, GLsizei a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMUIVARBPROC)_glewProfileTargets[765])(a0, a1, a2, a3);
+  _glewProfileEnd(765, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReadnPixelsARB (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void* a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADNPIXELSARBPROC)_glewProfileTargets[766])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(766, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferSampleLocationsfvARB (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)_glewProfileTargets[767])(a0, a1, a2, a3);
+  _glewProfileEnd(767, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferSampleLocationsfvARB (GLuint a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)_glewProfileTargets[768])(a0, a1, a2, a3);
+  _glewProfileEnd(768, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMinSampleShadingARB (GLclampf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMINSAMPLESHADINGARBPROC)_glewProfileTargets[769])(a0);
+  _glewProfileEnd(769, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindSampler (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDSAMPLERPROC)_glewProfileTargets[770])(a0, a1);
+  _glewProfileEnd(770, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteSamplers (GLsizei a0, const GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETESAMPLERSPROC)_glewProfileTargets[771])(a0, a1);
+  _glewProfileEnd(771, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenSamplers (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENSAMPLERSPROC)_glewProfileTargets[772])(a0, a1);
+  _glewProfileEnd(772, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterIiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIIVPROC)_glewProfileTargets[773])(a0, a1, a2);
+  _glewProfileEnd(773, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterIuiv (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIUIVPROC)_glewProfileTargets[774])(a0, a1, a2);
+  _glewProfileEnd(774, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterfv (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERFVPROC)_glewProfileTargets[775])(a0, a1, a2);
+  _glewProfileEnd(775, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameteriv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIVPROC)_glewProfileTargets[776])(a0, a1, a2);
+  _glewProfileEnd(776, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsSampler (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSAMPLERPROC)_glewProfileTargets[777])(a0);
+  _glewProfileEnd(777, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterIiv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIIVPROC)_glewProfileTargets[778])(a0, a1, a2);
+  _glewProfileEnd(778, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterIuiv (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIUIVPROC)_glewProfileTargets[779])(a0, a1, a2);
+  _glewProfileEnd(779, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterf (GLuint a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERFPROC)_glewProfileTargets[780])(a0, a1, a2);
+  _glewProfileEnd(780, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterfv (GLuint a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERFVPROC)_glewProfileTargets[781])(a0, a1, a2);
+  _glewProfileEnd(781, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameteri (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIPROC)_glewProfileTargets[782])(a0, a1, a2);
+  _glewProfileEnd(782, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameteriv (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIVPROC)_glewProfileTargets[783])(a0, a1, a2);
+  _glewProfileEnd(783, t);
+}
+
+static void GLAPIENTRY _glewProfile_glActiveShaderProgram (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLACTIVESHADERPROGRAMPROC)_glewProfileTargets[784])(a0, a1);
+  _glewProfileEnd(784, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindProgramPipeline (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDPROGRAMPIPELINEPROC)_glewProfileTargets[785])(a0);
+  _glewProfileEnd(785, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glCreateShaderProgramv (GLenum a0, GLsizei a1, const GLchar * const * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLCREATESHADERPROGRAMVPROC)_glewProfileTargets[786])(a0, a1, a2);
+  _glewProfileEnd(786, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteProgramPipelines (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPROGRAMPIPELINESPROC)_glewProfileTargets[787])(a0, a1);
+  _glewProfileEnd(787, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenProgramPipelines (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENPROGRAMPIPELINESPROC)_glewProfileTargets[788])(a0, a1);
+  _glewProfileEnd(788, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramPipelineInfoLog (GLuint a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMPIPELINEINFOLOGPROC)_glewProfileTargets[789])(a0, a1, a2, a3);
+  _glewProfileEnd(789, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramPipelineiv (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMPIPELINEIVPROC)_glewProfileTargets[790])(a0, a1, a2);
+  _glewProfileEnd(790, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsProgramPipeline (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPROGRAMPIPELINEPROC)_glewProfileTargets[791])(a0);
+  _glewProfileEnd(791, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1d (GLuint a0, GLint a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1DPROC)_glewProfileTargets[792])(a0, a1, a2);
+  _glewProfileEnd(792, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1DVPROC)_glewProfileTargets[793])(a0, a1, a2, a3);
+  _glewProfileEnd(793, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1f (GLuint a0, GLint a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1FPROC)_glewProfileTargets[794])(a0, a1, a2);
+  _glewProfileEnd(794, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1FVPROC)_glewProfileTargets[795])(a0, a1, a2, a3);
+  _glewProfileEnd(795, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1i (GLuint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1IPROC)_glewProfileTargets[796])(a0, a1, a2);
+  _glewProfileEnd(796, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1IVPROC)_glewProfileTargets[797])(a0, a1, a2, a3);
+  _glewProfileEnd(797, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1ui (GLuint a0, GLint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UIPROC)_glewProfileTargets[798])(a0, a1, a2);
+  _glewProfileEnd(798, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UIVPROC)_glewProfileTargets[799])(a0, a1, a2, a3);
+  _glewProfileEnd(799, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2d (GLuint a0, GLint a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2DPROC)_glewProfileTargets[800])(a0, a1, a2, a3);
+  _glewProfileEnd(800, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2DVPROC)_glewProfileTargets[801])(a0, a1, a2, a3);
+  _glewProfileEnd(801, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2f (GLuint a0, GLint a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2FPROC)_glewProfileTargets[802])(a0, a1, a2, a3);
+  _glewProfileEnd(802, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2FVPROC)_glewProfileTargets[803])(a0, a1, a2, a3);
+  _glewProfileEnd(803, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2i (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2IPROC)_glewProfileTargets[804])(a0, a1, a2, a3);
+  _glewProfileEnd(804, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2IVPROC)_glewProfileTargets[805])(a0, a1, a2, a3);
+  _glewProfileEnd(805, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2ui (GLuint a0, GLint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UIPROC)_glewProfileTargets[806])(a0, a1, a2, a3);
+  _glewProfileEnd(806, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UIVPROC)_glewProfileTargets[807])(a0, a1, a2, a3);
+  _glewProfileEnd(807, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3d (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3DPROC)_glewProfileTargets[808])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(808, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3DVPROC)_glewProfileTargets[809])(a0, a1, a2, a3);
+  _glewProfileEnd(809, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3f (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3FPROC)_glewProfileTargets[810])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(810, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3FVPROC)_glewProfileTargets[811])(a0, a1, a2, a3);
+  _glewProfileEnd(811, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3i (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3IPROC)_glewProfileTargets[812])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(812, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3IVPROC)_glewProfileTargets[813])(a0, a1, a2, a3);
+  _glewProfileEnd(813, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3ui (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UIPROC)_glewProfileTargets[814])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(814, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UIVPROC)_glewProfileTargets[815])(a0, a1, a2, a3);
+  _glewProfileEnd(815, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4d (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4DPROC)_glewProfileTargets[816])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(816, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4dv (GLuint a0, GLint a1, GLsizei a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4DVPROC)_glewProfileTargets[817])(a0, a1, a2, a3);
+  _glewProfileEnd(817, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4f (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4FPROC)_glewProfileTargets[818])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(818, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4fv (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4FVPROC)_glewProfileTargets[819])(a0, a1, a2, a3);
+  _glewProfileEnd(819, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4i (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4IPROC)_glewProfileTargets[820])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(820, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4iv (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4IVPROC)_glewProfileTargets[821])(a0, a1, a2, a3);
+  _glewProfileEnd(821, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4ui (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UIPROC)_glewProfileTargets[822])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(822, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4uiv (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UIVPROC)_glewProfileTargets[823])(a0, a1, a2, a3);
+  _glewProfileEnd(823, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2DVPROC)_glewProfileTargets[824])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(824, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2FVPROC)_glewProfileTargets[825])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(825, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2x3dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)_glewProfileTargets[826])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(826, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2x3fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)_glewProfileTargets[827])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(827, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2x4dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)_glewProfileTargets[828])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(828, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2x4fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)_glewProfileTargets[829])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(829, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3DVPROC)_glewProfileTargets[830])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(830, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3FVPROC)_glewProfileTargets[831])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(831, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3x2dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)_glewProfileTargets[832])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(832, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3x2fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)_glewProfileTargets[833])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(833, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3x4dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)_glewProfileTargets[834])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(834, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3x4fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)_glewProfileTargets[835])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(835, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4DVPROC)_glewProfileTargets[836])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(836, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4FVPROC)_glewProfileTargets[837])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(837, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4x2dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)_glewProfileTargets[838])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(838, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4x2fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)_glewProfileTargets[839])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(839, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4x3dv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)_glewProfileTargets[840])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(840, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4x3fv (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)_glewProfileTargets[841])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(841, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUseProgramStages (GLuint a0, GLbitfield a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUSEPROGRAMSTAGESPROC)_glewProfileTargets[842])(a0, a1, a2);
+  _glewProfileEnd(842, t);
+}
+
+static void GLAPIENTRY _glewProfile_glValidateProgramPipeline (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVALIDATEPROGRAMPIPELINEPROC)_glewProfileTargets[843])(a0);
+  _glewProfileEnd(843, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveAtomicCounterBufferiv (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)_glewProfileTargets[844])(a0, a1, a2, a3);
+  _glewProfileEnd(844, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindImageTexture (GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLenum a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDIMAGETEXTUREPROC)_glewProfileTargets[845])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(845, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMemoryBarrier (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMEMORYBARRIERPROC)_glewProfileTargets[846])(a0);
+  _glewProfileEnd(846, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAttachObjectARB (GLhandleARB a0, GLhandleARB a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLATTACHOBJECTARBPROC)_glewProfileTargets[847])(a0, a1);
+  _glewProfileEnd(847, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompileShaderARB (GLhandleARB a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPILESHADERARBPROC)_glewProfileTargets[848])(a0);
+  _glewProfileEnd(848, t);
+}
+
+static GLhandleARB GLAPIENTRY _glewProfile_glCreateProgramObjectARB (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLhandleARB r = ((PFNGLCREATEPROGRAMOBJECTARBPROC)_glewProfileTargets[849])();
+  _glewProfileEnd(849, t);
+  return r;
+}
+
+static GLhandleARB GLAPIENTRY _glewProfile_glCreateShaderObjectARB (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLhandleARB r = ((PFNGLCREATESHADEROBJECTARBPROC)_glewProfileTargets[850])(a0);
+  _glewProfileEnd(850, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteObjectARB (GLhandleARB a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEOBJECTARBPROC)_glewProfileTargets[851])(a0);
+  _glewProfileEnd(851, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDetachObjectARB (GLhandleARB a0, GLhandleARB a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDETACHOBJECTARBPROC)_glewProfileTargets[852])(a0, a1);
+  _glewProfileEnd(852, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveUniformARB (GLhandleARB a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint * a4, GLenum * a5, GLcharARB * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEUNIFORMARBPROC)_glewProfileTargets[853])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(853, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetAttachedObjectsARB (GLhandleARB a0, GLsizei a1, GLsizei* a2, GLhandleARB * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETATTACHEDOBJECTSARBPROC)_glewProfileTargets[854])(a0, a1, a2, a3);
+  _glewProfileEnd(854, t);
+}
+
+static GLhandleARB GLAPIENTRY _glewProfile_glGetHandleARB (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLhandleARB r = ((PFNGLGETHANDLEARBPROC)_glewProfileTargets[855])(a0);
+  _glewProfileEnd(855, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetInfoLogARB (GLhandleARB a0, GLsizei a1, GLsizei* a2, GLcharARB * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINFOLOGARBPROC)_glewProfileTargets[856])(a0, a1, a2, a3);
+  _glewProfileEnd(856, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectParameterfvARB (GLhandleARB a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTPARAMETERFVARBPROC)_glewProfileTargets[857])(a0, a1, a2);
+  _glewProfileEnd(857, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectParameterivARB (GLhandleARB a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTPARAMETERIVARBPROC)_glewProfileTargets[858])(a0, a1, a2);
+  _glewProfileEnd(858, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShaderSourceARB (GLhandleARB a0, GLsizei a1, GLsizei* a2, GLcharARB * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADERSOURCEARBPROC)_glewProfileTargets[859])(a0, a1, a2, a3);
+  _glewProfileEnd(859, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetUniformLocationARB (GLhandleARB a0, const GLcharARB* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETUNIFORMLOCATIONARBPROC)_glewProfileTargets[860])(a0, a1);
+  _glewProfileEnd(860, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformfvARB (GLhandleARB a0, GLint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMFVARBPROC)_glewProfileTargets[861])(a0, a1, a2);
+  _glewProfileEnd(861, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformivARB (GLhandleARB a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMIVARBPROC)_glewProfileTargets[862])(a0, a1, a2);
+  _glewProfileEnd(862, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLinkProgramARB (GLhandleARB a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLINKPROGRAMARBPROC)_glewProfileTargets[863])(a0);
+  _glewProfileEnd(863, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderSourceARB (GLhandleARB a0, GLsizei a1, const GLcharARB ** a2, const GLint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADERSOURCEARBPROC)_glewProfileTargets[864])(a0, a1, a2, a3);
+  _glewProfileEnd(864, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1fARB (GLint a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1FARBPROC)_glewProfileTargets[865])(a0, a1);
+  _glewProfileEnd(865, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1FVARBPROC)_glewProfileTargets[866])(a0, a1, a2);
+  _glewProfileEnd(866, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1iARB (GLint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1IARBPROC)_glewProfileTargets[867])(a0, a1);
+  _glewProfileEnd(867, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1IVARBPROC)_glewProfileTargets[868])(a0, a1, a2);
+  _glewProfileEnd(868, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2fARB (GLint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2FARBPROC)_glewProfileTargets[869])(a0, a1, a2);
+  _glewProfileEnd(869, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2FVARBPROC)_glewProfileTargets[870])(a0, a1, a2);
+  _glewProfileEnd(870, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2iARB (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2IARBPROC)_glewProfileTargets[871])(a0, a1, a2);
+  _glewProfileEnd(871, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2IVARBPROC)_glewProfileTargets[872])(a0, a1, a2);
+  _glewProfileEnd(872, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3fARB (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3FARBPROC)_glewProfileTargets[873])(a0, a1, a2, a3);
+  _glewProfileEnd(873, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3FVARBPROC)_glewProfileTargets[874])(a0, a1, a2);
+  _glewProfileEnd(874, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3iARB (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3IARBPROC)_glewProfileTargets[875])(a0, a1, a2, a3);
+  _glewProfileEnd(875, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3IVARBPROC)_glewProfileTargets[876])(a0, a1, a2);
+  _glewProfileEnd(876, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4fARB (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4FARBPROC)_glewProfileTargets[877])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(877, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4fvARB (GLint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4FVARBPROC)_glewProfileTargets[878])(a0, a1, a2);
+  _glewProfileEnd(878, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4iARB (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4IARBPROC)_glewProfileTargets[879])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(879, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4ivARB (GLint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4IVARBPROC)_glewProfileTargets[880])(a0, a1, a2);
+  _glewProfileEnd(880, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2fvARB (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2FVARBPROC)_glewProfileTargets[881])(a0, a1, a2, a3);
+  _glewProfileEnd(881, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3fvARB (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3FVARBPROC)_glewProfileTargets[882])(a0, a1, a2, a3);
+  _glewProfileEnd(882, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4fvARB (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4FVARBPROC)_glewProfileTargets[883])(a0, a1, a2, a3);
+  _glewProfileEnd(883, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUseProgramObjectARB (GLhandleARB a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUSEPROGRAMOBJECTARBPROC)_glewProfileTargets[884])(a0);
+  _glewProfileEnd(884, t);
+}
+
+static void GLAPIENTRY _glewProfile_glValidateProgramARB (GLhandleARB a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVALIDATEPROGRAMARBPROC)_glewProfileTargets[885])(a0);
+  _glewProfileEnd(885, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderStorageBlockBinding (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADERSTORAGEBLOCKBINDINGPROC)_glewProfileTargets[886])(a0, a1, a2);
+  _glewProfileEnd(886, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveSubroutineName (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei* a4, GLchar * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVESUBROUTINENAMEPROC)_glewProfileTargets[887])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(887, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveSubroutineUniformName (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei* a4, GLchar * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)_glewProfileTargets[888])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(888, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveSubroutineUniformiv (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)_glewProfileTargets[889])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(889, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramStageiv (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMSTAGEIVPROC)_glewProfileTargets[890])(a0, a1, a2, a3);
+  _glewProfileEnd(890, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetSubroutineIndex (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETSUBROUTINEINDEXPROC)_glewProfileTargets[891])(a0, a1, a2);
+  _glewProfileEnd(891, t);
+  return r;
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetSubroutineUniformLocation (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)_glewProfileTargets[892])(a0, a1, a2);
+  _glewProfileEnd(892, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformSubroutineuiv (GLenum a0, GLint a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMSUBROUTINEUIVPROC)_glewProfileTargets[893])(a0, a1, a2);
+  _glewProfileEnd(893, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformSubroutinesuiv (GLenum a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMSUBROUTINESUIVPROC)_glewProfileTargets[894])(a0, a1, a2);
+  _glewProfileEnd(894, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompileShaderIncludeARB (GLuint a0, GLsizei a1, const GLchar* const * a2, const GLint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPILESHADERINCLUDEARBPROC)_glewProfileTargets[895])(a0, a1, a2, a3);
+  _glewProfileEnd(895, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteNamedStringARB (GLint a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETENAMEDSTRINGARBPROC)_glewProfileTargets[896])(a0, a1);
+  _glewProfileEnd(896, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedStringARB (GLint a0, const GLchar* a1, GLsizei a2, GLint * a3, GLchar * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDSTRINGARBPROC)_glewProfileTargets[897])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(897, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedStringivARB (GLint a0, const GLchar* a1, GLenum a2, GLint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDSTRINGIVARBPROC)_glewProfileTargets[898])(a0, a1, a2, a3);
+  _glewProfileEnd(898, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsNamedStringARB (GLint a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISNAMEDSTRINGARBPROC)_glewProfileTargets[899])(a0, a1);
+  _glewProfileEnd(899, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glNamedStringARB (GLenum a0, GLint a1, const GLchar* a2, GLint a3, const GLchar * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDSTRINGARBPROC)_glewProfileTargets[900])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(900, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferPageCommitmentARB (GLenum a0, GLintptr a1, GLsizeiptr a2, GLboolean a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERPAGECOMMITMENTARBPROC)_glewProfileTargets[901])(a0, a1, a2, a3);
+  _glewProfileEnd(901, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexPageCommitmentARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPAGECOMMITMENTARBPROC)_glewProfileTargets[902])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(902, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glClientWaitSync (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCLIENTWAITSYNCPROC)_glewProfileTargets[903])(a0, a1, a2);
+  _glewProfileEnd(903, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteSync (GLsync a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETESYNCPROC)_glewProfileTargets[904])(a0);
+  _glewProfileEnd(904, t);
+}
+
+static GLsync GLAPIENTRY _glewProfile_glFenceSync (GLenum a0, GLbitfield a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLsync r = ((PFNGLFENCESYNCPROC)_glewProfileTargets[905])(a0, a1);
+  _glewProfileEnd(905, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetInteger64v (GLenum a0, GLint64* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGER64VPROC)_glewProfileTargets[906])(a0, a1);
+  _glewProfileEnd(906, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSynciv (GLsync a0, GLenum a1, GLsizei a2, GLsizei* a3, GLint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSYNCIVPROC)_glewProfileTargets[907])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(907, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsSync (GLsync a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSYNCPROC)_glewProfileTargets[908])(a0);
+  _glewProfileEnd(908, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glWaitSync (GLsync a0, GLbitfield a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWAITSYNCPROC)_glewProfileTargets[909])(a0, a1, a2);
+  _glewProfileEnd(909, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPatchParameterfv (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATCHPARAMETERFVPROC)_glewProfileTargets[910])(a0, a1);
+  _glewProfileEnd(910, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPatchParameteri (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATCHPARAMETERIPROC)_glewProfileTargets[911])(a0, a1);
+  _glewProfileEnd(911, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureBarrier (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREBARRIERPROC)_glewProfileTargets[912])();
+  _glewProfileEnd(912, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBufferARB (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUFFERARBPROC)_glewProfileTargets[913])(a0, a1, a2);
+  _glewProfileEnd(913, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBufferRange (GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUFFERRANGEPROC)_glewProfileTargets[914])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(914, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureBufferRangeEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLintptr a4, GLsizeiptr a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREBUFFERRANGEEXTPROC)_glewProfileTargets[915])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(915, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage1DARB (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE1DARBPROC)_glewProfileTargets[916])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(916, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage2DARB (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)_glewProfileTargets[917])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(917, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage3DARB (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE3DARBPROC)_glewProfileTargets[918])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(918, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage1DARB (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)_glewProfileTargets[919])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(919, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage2DARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)_glewProfileTargets[920])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(920, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage3DARB (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)_glewProfileTargets[921])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(921, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCompressedTexImageARB (GLenum a0, GLint a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)_glewProfileTargets[922])(a0, a1, a2);
+  _glewProfileEnd(922, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultisamplefv (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTISAMPLEFVPROC)_glewProfileTargets[923])(a0, a1, a2);
+  _glewProfileEnd(923, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleMaski (GLuint a0, GLbitfield a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEMASKIPROC)_glewProfileTargets[924])(a0, a1);
+  _glewProfileEnd(924, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage2DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE2DMULTISAMPLEPROC)_glewProfileTargets[925])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(925, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage3DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE3DMULTISAMPLEPROC)_glewProfileTargets[926])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(926, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage1D (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE1DPROC)_glewProfileTargets[927])(a0, a1, a2, a3);
+  _glewProfileEnd(927, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage2D (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE2DPROC)_glewProfileTargets[928])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(928, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage3D (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE3DPROC)_glewProfileTargets[929])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(929, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage2DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE2DMULTISAMPLEPROC)_glewProfileTargets[930])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(930, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage3DMultisample (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE3DMULTISAMPLEPROC)_glewProfileTargets[931])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(931, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage2DMultisampleEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)_glewProfileTargets[932])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(932, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage3DMultisampleEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)_glewProfileTargets[933])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(933, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureView (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREVIEWPROC)_glewProfileTargets[934])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(934, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjecti64v (GLuint a0, GLenum a1, GLint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTI64VPROC)_glewProfileTargets[935])(a0, a1, a2);
+  _glewProfileEnd(935, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectui64v (GLuint a0, GLenum a1, GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUI64VPROC)_glewProfileTargets[936])(a0, a1, a2);
+  _glewProfileEnd(936, t);
+}
+
+static void GLAPIENTRY _glewProfile_glQueryCounter (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLQUERYCOUNTERPROC)_glewProfileTargets[937])(a0, a1);
+  _glewProfileEnd(937, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindTransformFeedback (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDTRANSFORMFEEDBACKPROC)_glewProfileTargets[938])(a0, a1);
+  _glewProfileEnd(938, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteTransformFeedbacks (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETETRANSFORMFEEDBACKSPROC)_glewProfileTargets[939])(a0, a1);
+  _glewProfileEnd(939, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedback (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKPROC)_glewProfileTargets[940])(a0, a1);
+  _glewProfileEnd(940, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenTransformFeedbacks (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENTRANSFORMFEEDBACKSPROC)_glewProfileTargets[941])(a0, a1);
+  _glewProfileEnd(941, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsTransformFeedback (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISTRANSFORMFEEDBACKPROC)_glewProfileTargets[942])(a0);
+  _glewProfileEnd(942, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPauseTransformFeedback (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPAUSETRANSFORMFEEDBACKPROC)_glewProfileTargets[943])();
+  _glewProfileEnd(943, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResumeTransformFeedback (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESUMETRANSFORMFEEDBACKPROC)_glewProfileTargets[944])();
+  _glewProfileEnd(944, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginQueryIndexed (GLenum a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINQUERYINDEXEDPROC)_glewProfileTargets[945])(a0, a1, a2);
+  _glewProfileEnd(945, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedbackStream (GLenum a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)_glewProfileTargets[946])(a0, a1, a2);
+  _glewProfileEnd(946, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndQueryIndexed (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDQUERYINDEXEDPROC)_glewProfileTargets[947])(a0, a1);
+  _glewProfileEnd(947, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryIndexediv (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYINDEXEDIVPROC)_glewProfileTargets[948])(a0, a1, a2, a3);
+  _glewProfileEnd(948, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedbackInstanced (GLenum a0, GLuint a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)_glewProfileTargets[949])(a0, a1, a2);
+  _glewProfileEnd(949, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedbackStreamInstanced (GLenum a0, GLuint a1, GLuint a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)_glewProfileTargets[950])(a0, a1, a2, a3);
+  _glewProfileEnd(950, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLoadTransposeMatrixdARB (GLdouble a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADTRANSPOSEMATRIXDARBPROC)_glewProfileTargets[951])(a0);
+  _glewProfileEnd(951, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLoadTransposeMatrixfARB (GLfloat a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADTRANSPOSEMATRIXFARBPROC)_glewProfileTargets[952])(a0);
+  _glewProfileEnd(952, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultTransposeMatrixdARB (GLdouble a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTTRANSPOSEMATRIXDARBPROC)_glewProfileTargets[953])(a0);
+  _glewProfileEnd(953, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultTransposeMatrixfARB (GLfloat a0[16])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTTRANSPOSEMATRIXFARBPROC)_glewProfileTargets[954])(a0);
+  _glewProfileEnd(954, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferBase (GLenum a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERBASEPROC)_glewProfileTargets[955])(a0, a1, a2);
+  _glewProfileEnd(955, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferRange (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERRANGEPROC)_glewProfileTargets[956])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(956, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveUniformBlockName (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)_glewProfileTargets[957])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(957, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveUniformBlockiv (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEUNIFORMBLOCKIVPROC)_glewProfileTargets[958])(a0, a1, a2, a3);
+  _glewProfileEnd(958, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveUniformName (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEUNIFORMNAMEPROC)_glewProfileTargets[959])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(959, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveUniformsiv (GLuint a0, GLsizei a1, const GLuint* a2, GLenum a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEUNIFORMSIVPROC)_glewProfileTargets[960])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(960, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetIntegeri_v (GLenum a0, GLuint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGERI_VPROC)_glewProfileTargets[961])(a0, a1, a2);
+  _glewProfileEnd(961, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetUniformBlockIndex (GLuint a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETUNIFORMBLOCKINDEXPROC)_glewProfileTargets[962])(a0, a1);
+  _glewProfileEnd(962, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformIndices (GLuint a0, GLsizei a1, const GLchar* const * a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMINDICESPROC)_glewProfileTargets[963])(a0, a1, a2, a3);
+  _glewProfileEnd(963, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformBlockBinding (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMBLOCKBINDINGPROC)_glewProfileTargets[964])(a0, a1, a2);
+  _glewProfileEnd(964, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexArray (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXARRAYPROC)_glewProfileTargets[965])(a0);
+  _glewProfileEnd(965, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteVertexArrays (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEVERTEXARRAYSPROC)_glewProfileTargets[966])(a0, a1);
+  _glewProfileEnd(966, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenVertexArrays (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENVERTEXARRAYSPROC)_glewProfileTargets[967])(a0, a1);
+  _glewProfileEnd(967, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsVertexArray (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISVERTEXARRAYPROC)_glewProfileTargets[968])(a0);
+  _glewProfileEnd(968, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribLdv (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBLDVPROC)_glewProfileTargets[969])(a0, a1, a2);
+  _glewProfileEnd(969, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1d (GLuint a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1DPROC)_glewProfileTargets[970])(a0, a1);
+  _glewProfileEnd(970, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1DVPROC)_glewProfileTargets[971])(a0, a1);
+  _glewProfileEnd(971, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2d (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2DPROC)_glewProfileTargets[972])(a0, a1, a2);
+  _glewProfileEnd(972, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2DVPROC)_glewProfileTargets[973])(a0, a1);
+  _glewProfileEnd(973, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3DPROC)_glewProfileTargets[974])(a0, a1, a2, a3);
+  _glewProfileEnd(974, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3DVPROC)_glewProfileTargets[975])(a0, a1);
+  _glewProfileEnd(975, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4d (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4DPROC)_glewProfileTargets[976])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(976, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4dv (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4DVPROC)_glewProfileTargets[977])(a0, a1);
+  _glewProfileEnd(977, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribLPointer (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBLPOINTERPROC)_glewProfileTargets[978])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(978, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexBuffer (GLuint a0, GLuint a1, GLintptr a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXBUFFERPROC)_glewProfileTargets[979])(a0, a1, a2, a3);
+  _glewProfileEnd(979, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayBindVertexBufferEXT (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)_glewProfileTargets[980])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(980, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribBindingEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)_glewProfileTargets[981])(a0, a1, a2);
+  _glewProfileEnd(981, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribFormatEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLboolean a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)_glewProfileTargets[982])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(982, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribIFormatEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)_glewProfileTargets[983])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(983, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribLFormatEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)_glewProfileTargets[984])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(984, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexBindingDivisorEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)_glewProfileTargets[985])(a0, a1, a2);
+  _glewProfileEnd(985, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribBinding (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBBINDINGPROC)_glewProfileTargets[986])(a0, a1);
+  _glewProfileEnd(986, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribFormat (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBFORMATPROC)_glewProfileTargets[987])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(987, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribIFormat (GLuint a0, GLint a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBIFORMATPROC)_glewProfileTargets[988])(a0, a1, a2, a3);
+  _glewProfileEnd(988, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribLFormat (GLuint a0, GLint a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBLFORMATPROC)_glewProfileTargets[989])(a0, a1, a2, a3);
+  _glewProfileEnd(989, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexBindingDivisor (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXBINDINGDIVISORPROC)_glewProfileTargets[990])(a0, a1);
+  _glewProfileEnd(990, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexBlendARB (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXBLENDARBPROC)_glewProfileTargets[991])(a0);
+  _glewProfileEnd(991, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightPointerARB (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTPOINTERARBPROC)_glewProfileTargets[992])(a0, a1, a2, a3);
+  _glewProfileEnd(992, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightbvARB (GLint a0, GLbyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTBVARBPROC)_glewProfileTargets[993])(a0, a1);
+  _glewProfileEnd(993, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightdvARB (GLint a0, GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTDVARBPROC)_glewProfileTargets[994])(a0, a1);
+  _glewProfileEnd(994, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightfvARB (GLint a0, GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTFVARBPROC)_glewProfileTargets[995])(a0, a1);
+  _glewProfileEnd(995, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightivARB (GLint a0, GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTIVARBPROC)_glewProfileTargets[996])(a0, a1);
+  _glewProfileEnd(996, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightsvARB (GLint a0, GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTSVARBPROC)_glewProfileTargets[997])(a0, a1);
+  _glewProfileEnd(997, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightubvARB (GLint a0, GLubyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTUBVARBPROC)_glewProfileTargets[998])(a0, a1);
+  _glewProfileEnd(998, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightuivARB (GLint a0, GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTUIVARBPROC)_glewProfileTargets[999])(a0, a1);
+  _glewProfileEnd(999, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightusvARB (GLint a0, GLushort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTUSVARBPROC)_glewProfileTargets[1000])(a0, a1);
+  _glewProfileEnd(1000, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferARB (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERARBPROC)_glewProfileTargets[1001])(a0, a1);
+  _glewProfileEnd(1001, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferDataARB (GLenum a0, GLsizeiptrARB a1, const void * a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERDATAARBPROC)_glewProfileTargets[1002])(a0, a1, a2, a3);
+  _glewProfileEnd(1002, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferSubDataARB (GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERSUBDATAARBPROC)_glewProfileTargets[1003])(a0, a1, a2, a3);
+  _glewProfileEnd(1003, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteBuffersARB (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEBUFFERSARBPROC)_glewProfileTargets[1004])(a0, a1);
+  _glewProfileEnd(1004, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenBuffersARB (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENBUFFERSARBPROC)_glewProfileTargets[1005])(a0, a1);
+  _glewProfileEnd(1005, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferParameterivARB (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPARAMETERIVARBPROC)_glewProfileTargets[1006])(a0, a1, a2);
+  _glewProfileEnd(1006, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferPointervARB (GLenum a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPOINTERVARBPROC)_glewProfileTargets[1007])(a0, a1, a2);
+  _glewProfileEnd(1007, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferSubDataARB (GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERSUBDATAARBPROC)_glewProfileTargets[1008])(a0, a1, a2, a3);
+  _glewProfileEnd(1008, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsBufferARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISBUFFERARBPROC)_glewProfileTargets[1009])(a0);
+  _glewProfileEnd(1009, t);
+  return r;
+}
+
+static void * GLAPIENTRY _glewProfile_glMapBufferARB (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPBUFFERARBPROC)_glewProfileTargets[1010])(a0, a1);
+  _glewProfileEnd(1010, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glUnmapBufferARB (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLUNMAPBUFFERARBPROC)_glewProfileTargets[1011])(a0);
+  _glewProfileEnd(1011, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindProgramARB (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDPROGRAMARBPROC)_glewProfileTargets[1012])(a0, a1);
+  _glewProfileEnd(1012, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteProgramsARB (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPROGRAMSARBPROC)_glewProfileTargets[1013])(a0, a1);
+  _glewProfileEnd(1013, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVertexAttribArrayARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)_glewProfileTargets[1014])(a0);
+  _glewProfileEnd(1014, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVertexAttribArrayARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVERTEXATTRIBARRAYARBPROC)_glewProfileTargets[1015])(a0);
+  _glewProfileEnd(1015, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenProgramsARB (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENPROGRAMSARBPROC)_glewProfileTargets[1016])(a0, a1);
+  _glewProfileEnd(1016, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramEnvParameterdvARB (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMENVPARAMETERDVARBPROC)_glewProfileTargets[1017])(a0, a1, a2);
+  _glewProfileEnd(1017, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramEnvParameterfvARB (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMENVPARAMETERFVARBPROC)_glewProfileTargets[1018])(a0, a1, a2);
+  _glewProfileEnd(1018, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramLocalParameterdvARB (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)_glewProfileTargets[1019])(a0, a1, a2);
+  _glewProfileEnd(1019, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramLocalParameterfvARB (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)_glewProfileTargets[1020])(a0, a1, a2);
+  _glewProfileEnd(1020, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramStringARB (GLenum a0, GLenum a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMSTRINGARBPROC)_glewProfileTargets[1021])(a0, a1, a2);
+  _glewProfileEnd(1021, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramivARB (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMIVARBPROC)_glewProfileTargets[1022])(a0, a1, a2);
+  _glewProfileEnd(1022, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribPointervARB (GLuint a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBPOINTERVARBPROC)_glewProfileTargets[1023])(a0, a1, a2);
+  _glewProfileEnd(1023, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribdvARB (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBDVARBPROC)_glewProfileTargets[1024])(a0, a1, a2);
+  _glewProfileEnd(1024, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribfvARB (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBFVARBPROC)_glewProfileTargets[1025])(a0, a1, a2);
+  _glewProfileEnd(1025, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribivARB (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIVARBPROC)_glewProfileTargets[1026])(a0, a1, a2);
+  _glewProfileEnd(1026, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsProgramARB (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPROGRAMARBPROC)_glewProfileTargets[1027])(a0);
+  _glewProfileEnd(1027, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameter4dARB (GLenum a0, GLuint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETER4DARBPROC)_glewProfileTargets[1028])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1028, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameter4dvARB (GLenum a0, GLuint a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETER4DVARBPROC)_glewProfileTargets[1029])(a0, a1, a2);
+  _glewProfileEnd(1029, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameter4fARB (GLenum a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETER4FARBPROC)_glewProfileTargets[1030])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1030, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameter4fvARB (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETER4FVARBPROC)_glewProfileTargets[1031])(a0, a1, a2);
+  _glewProfileEnd(1031, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameter4dARB (GLenum a0, GLuint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETER4DARBPROC)_glewProfileTargets[1032])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1032, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameter4dvARB (GLenum a0, GLuint a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETER4DVARBPROC)_glewProfileTargets[1033])(a0, a1, a2);
+  _glewProfileEnd(1033, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameter4fARB (GLenum a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETER4FARBPROC)_glewProfileTargets[1034])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1034, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameter4fvARB (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)_glewProfileTargets[1035])(a0, a1, a2);
+  _glewProfileEnd(1035, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramStringARB (GLenum a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMSTRINGARBPROC)_glewProfileTargets[1036])(a0, a1, a2, a3);
+  _glewProfileEnd(1036, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1dARB (GLuint a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1DARBPROC)_glewProfileTargets[1037])(a0, a1);
+  _glewProfileEnd(1037, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1dvARB (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1DVARBPROC)_glewProfileTargets[1038])(a0, a1);
+  _glewProfileEnd(1038, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1fARB (GLuint a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1FARBPROC)_glewProfileTargets[1039])(a0, a1);
+  _glewProfileEnd(1039, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1fvARB (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1FVARBPROC)_glewProfileTargets[1040])(a0, a1);
+  _glewProfileEnd(1040, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1sARB (GLuint a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1SARBPROC)_glewProfileTargets[1041])(a0, a1);
+  _glewProfileEnd(1041, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1svARB (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1SVARBPROC)_glewProfileTargets[1042])(a0, a1);
+  _glewProfileEnd(1042, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2dARB (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2DARBPROC)_glewProfileTargets[1043])(a0, a1, a2);
+  _glewProfileEnd(1043, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2dvARB (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2DVARBPROC)_glewProfileTargets[1044])(a0, a1);
+  _glewProfileEnd(1044, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2fARB (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2FARBPROC)_glewProfileTargets[1045])(a0, a1, a2);
+  _glewProfileEnd(1045, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2fvARB (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2FVARBPROC)_glewProfileTargets[1046])(a0, a1);
+  _glewProfileEnd(1046, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2sARB (GLuint a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2SARBPROC)_glewProfileTargets[1047])(a0, a1, a2);
+  _glewProfileEnd(1047, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2svARB (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2SVARBPROC)_glewProfileTargets[1048])(a0, a1);
+  _glewProfileEnd(1048, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3dARB (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3DARBPROC)_glewProfileTargets[1049])(a0, a1, a2, a3);
+  _glewProfileEnd(1049, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3dvARB (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3DVARBPROC)_glewProfileTargets[1050])(a0, a1);
+  _glewProfileEnd(1050, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3fARB (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3FARBPROC)_glewProfileTargets[1051])(a0, a1, a2, a3);
+  _glewProfileEnd(1051, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3fvARB (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3FVARBPROC)_glewProfileTargets[1052])(a0, a1);
+  _glewProfileEnd(1052, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3sARB (GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3SARBPROC)_glewProfileTargets[1053])(a0, a1, a2, a3);
+  _glewProfileEnd(1053, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3svARB (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3SVARBPROC)_glewProfileTargets[1054])(a0, a1);
+  _glewProfileEnd(1054, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NbvARB (GLuint a0, const GLbyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NBVARBPROC)_glewProfileTargets[1055])(a0, a1);
+  _glewProfileEnd(1055, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NivARB (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NIVARBPROC)_glewProfileTargets[1056])(a0, a1);
+  _glewProfileEnd(1056, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NsvARB (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NSVARBPROC)_glewProfileTargets[1057])(a0, a1);
+  _glewProfileEnd(1057, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NubARB (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUBARBPROC)_glewProfileTargets[1058])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1058, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NubvARB (GLuint a0, const GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUBVARBPROC)_glewProfileTargets[1059])(a0, a1);
+  _glewProfileEnd(1059, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NuivARB (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUIVARBPROC)_glewProfileTargets[1060])(a0, a1);
+  _glewProfileEnd(1060, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4NusvARB (GLuint a0, const GLushort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4NUSVARBPROC)_glewProfileTargets[1061])(a0, a1);
+  _glewProfileEnd(1061, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4bvARB (GLuint a0, const GLbyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4BVARBPROC)_glewProfileTargets[1062])(a0, a1);
+  _glewProfileEnd(1062, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4dARB (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4DARBPROC)_glewProfileTargets[1063])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1063, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4dvARB (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4DVARBPROC)_glewProfileTargets[1064])(a0, a1);
+  _glewProfileEnd(1064, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4fARB (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4FARBPROC)_glewProfileTargets[1065])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1065, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4fvARB (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4FVARBPROC)_glewProfileTargets[1066])(a0, a1);
+  _glewProfileEnd(1066, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4ivARB (GLuint a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4IVARBPROC)_glewProfileTargets[1067])(a0, a1);
+  _glewProfileEnd(1067, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4sARB (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4SARBPROC)_glewProfileTargets[1068])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1068, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4svARB (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4SVARBPROC)_glewProfileTargets[1069])(a0, a1);
+  _glewProfileEnd(1069, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4ubvARB (GLuint a0, const GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4UBVARBPROC)_glewProfileTargets[1070])(a0, a1);
+  _glewProfileEnd(1070, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4uivARB (GLuint a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4UIVARBPROC)_glewProfileTargets[1071])(a0, a1);
+  _glewProfileEnd(1071, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4usvARB (GLuint a0, const GLushort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4USVARBPROC)_glewProfileTargets[1072])(a0, a1);
+  _glewProfileEnd(1072, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribPointerARB (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBPOINTERARBPROC)_glewProfileTargets[1073])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1073, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindAttribLocationARB (GLhandleARB a0, GLuint a1, const GLcharARB* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDATTRIBLOCATIONARBPROC)_glewProfileTargets[1074])(a0, a1, a2);
+  _glewProfileEnd(1074, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveAttribARB (GLhandleARB a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint * a4, GLenum * a5, GLcharARB * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEATTRIBARBPROC)_glewProfileTargets[1075])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1075, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetAttribLocationARB (GLhandleARB a0, const GLcharARB* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETATTRIBLOCATIONARBPROC)_glewProfileTargets[1076])(a0, a1);
+  _glewProfileEnd(1076, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glColorP3ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORP3UIPROC)_glewProfileTargets[1077])(a0, a1);
+  _glewProfileEnd(1077, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorP3uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORP3UIVPROC)_glewProfileTargets[1078])(a0, a1);
+  _glewProfileEnd(1078, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorP4ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORP4UIPROC)_glewProfileTargets[1079])(a0, a1);
+  _glewProfileEnd(1079, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorP4uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORP4UIVPROC)_glewProfileTargets[1080])(a0, a1);
+  _glewProfileEnd(1080, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP1ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP1UIPROC)_glewProfileTargets[1081])(a0, a1, a2);
+  _glewProfileEnd(1081, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP1uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP1UIVPROC)_glewProfileTargets[1082])(a0, a1, a2);
+  _glewProfileEnd(1082, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP2ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP2UIPROC)_glewProfileTargets[1083])(a0, a1, a2);
+  _glewProfileEnd(1083, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP2uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP2UIVPROC)_glewProfileTargets[1084])(a0, a1, a2);
+  _glewProfileEnd(1084, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP3ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP3UIPROC)_glewProfileTargets[1085])(a0, a1, a2);
+  _glewProfileEnd(1085, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP3uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP3UIVPROC)_glewProfileTargets[1086])(a0, a1, a2);
+  _glewProfileEnd(1086, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP4ui (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP4UIPROC)_glewProfileTargets[1087])(a0, a1, a2);
+  _glewProfileEnd(1087, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordP4uiv (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDP4UIVPROC)_glewProfileTargets[1088])(a0, a1, a2);
+  _glewProfileEnd(1088, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalP3ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALP3UIPROC)_glewProfileTargets[1089])(a0, a1);
+  _glewProfileEnd(1089, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalP3uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALP3UIVPROC)_glewProfileTargets[1090])(a0, a1);
+  _glewProfileEnd(1090, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColorP3ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLORP3UIPROC)_glewProfileTargets[1091])(a0, a1);
+  _glewProfileEnd(1091, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColorP3uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLORP3UIVPROC)_glewProfileTargets[1092])(a0, a1);
+  _glewProfileEnd(1092, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP1ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP1UIPROC)_glewProfileTargets[1093])(a0, a1);
+  _glewProfileEnd(1093, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP1uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP1UIVPROC)_glewProfileTargets[1094])(a0, a1);
+  _glewProfileEnd(1094, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP2ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP2UIPROC)_glewProfileTargets[1095])(a0, a1);
+  _glewProfileEnd(1095, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP2uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP2UIVPROC)_glewProfileTargets[1096])(a0, a1);
+  _glewProfileEnd(1096, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP3ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP3UIPROC)_glewProfileTargets[1097])(a0, a1);
+  _glewProfileEnd(1097, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP3uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP3UIVPROC)_glewProfileTargets[1098])(a0, a1);
+  _glewProfileEnd(1098, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP4ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP4UIPROC)_glewProfileTargets[1099])(a0, a1);
+  _glewProfileEnd(1099, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordP4uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDP4UIVPROC)_glewProfileTargets[1100])(a0, a1);
+  _glewProfileEnd(1100, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP1ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP1UIPROC)_glewProfileTargets[1101])(a0, a1, a2, a3);
+  _glewProfileEnd(1101, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP1uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP1UIVPROC)_glewProfileTargets[1102])(a0, a1, a2, a3);
+  _glewProfileEnd(1102, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP2ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP2UIPROC)_glewProfileTargets[1103])(a0, a1, a2, a3);
+  _glewProfileEnd(1103, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP2uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP2UIVPROC)_glewProfileTargets[1104])(a0, a1, a2, a3);
+  _glewProfileEnd(1104, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP3ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP3UIPROC)_glewProfileTargets[1105])(a0, a1, a2, a3);
+  _glewProfileEnd(1105, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP3uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP3UIVPROC)_glewProfileTargets[1106])(a0, a1, a2, a3);
+  _glewProfileEnd(1106, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP4ui (GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP4UIPROC)_glewProfileTargets[1107])(a0, a1, a2, a3);
+  _glewProfileEnd(1107, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribP4uiv (GLuint a0, GLenum a1, GLboolean a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBP4UIVPROC)_glewProfileTargets[1108])(a0, a1, a2, a3);
+  _glewProfileEnd(1108, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexP2ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXP2UIPROC)_glewProfileTargets[1109])(a0, a1);
+  _glewProfileEnd(1109, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexP2uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXP2UIVPROC)_glewProfileTargets[1110])(a0, a1);
+  _glewProfileEnd(1110, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexP3ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXP3UIPROC)_glewProfileTargets[1111])(a0, a1);
+  _glewProfileEnd(1111, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexP3uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXP3UIVPROC)_glewProfileTargets[1112])(a0, a1);
+  _glewProfileEnd(1112, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexP4ui (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXP4UIPROC)_glewProfileTargets[1113])(a0, a1);
+  _glewProfileEnd(1113, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexP4uiv (GLenum a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXP4UIVPROC)_glewProfileTargets[1114])(a0, a1);
+  _glewProfileEnd(1114, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangeArrayv (GLuint a0, GLsizei a1, const GLclampd * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEARRAYVPROC)_glewProfileTargets[1115])(a0, a1, a2);
+  _glewProfileEnd(1115, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangeIndexed (GLuint a0, GLclampd a1, GLclampd a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEINDEXEDPROC)_glewProfileTargets[1116])(a0, a1, a2);
+  _glewProfileEnd(1116, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetDoublei_v (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETDOUBLEI_VPROC)_glewProfileTargets[1117])(a0, a1, a2);
+  _glewProfileEnd(1117, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFloati_v (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFLOATI_VPROC)_glewProfileTargets[1118])(a0, a1, a2);
+  _glewProfileEnd(1118, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorArrayv (GLuint a0, GLsizei a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSORARRAYVPROC)_glewProfileTargets[1119])(a0, a1, a2);
+  _glewProfileEnd(1119, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorIndexed (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSORINDEXEDPROC)_glewProfileTargets[1120])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1120, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorIndexedv (GLuint a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSORINDEXEDVPROC)_glewProfileTargets[1121])(a0, a1);
+  _glewProfileEnd(1121, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportArrayv (GLuint a0, GLsizei a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTARRAYVPROC)_glewProfileTargets[1122])(a0, a1, a2);
+  _glewProfileEnd(1122, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportIndexedf (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTINDEXEDFPROC)_glewProfileTargets[1123])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1123, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportIndexedfv (GLuint a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTINDEXEDFVPROC)_glewProfileTargets[1124])(a0, a1);
+  _glewProfileEnd(1124, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2dARB (GLdouble a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2DARBPROC)_glewProfileTargets[1125])(a0, a1);
+  _glewProfileEnd(1125, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2dvARB (const GLdouble* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2DVARBPROC)_glewProfileTargets[1126])(a0);
+  _glewProfileEnd(1126, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2fARB (GLfloat a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2FARBPROC)_glewProfileTargets[1127])(a0, a1);
+  _glewProfileEnd(1127, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2fvARB (const GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2FVARBPROC)_glewProfileTargets[1128])(a0);
+  _glewProfileEnd(1128, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2iARB (GLint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2IARBPROC)_glewProfileTargets[1129])(a0, a1);
+  _glewProfileEnd(1129, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2ivARB (const GLint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2IVARBPROC)_glewProfileTargets[1130])(a0);
+  _glewProfileEnd(1130, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2sARB (GLshort a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2SARBPROC)_glewProfileTargets[1131])(a0, a1);
+  _glewProfileEnd(1131, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2svARB (const GLshort* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2SVARBPROC)_glewProfileTargets[1132])(a0);
+  _glewProfileEnd(1132, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3dARB (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3DARBPROC)_glewProfileTargets[1133])(a0, a1, a2);
+  _glewProfileEnd(1133, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3dvARB (const GLdouble* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3DVARBPROC)_glewProfileTargets[1134])(a0);
+  _glewProfileEnd(1134, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3fARB (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3FARBPROC)_glewProfileTargets[1135])(a0, a1, a2);
+  _glewProfileEnd(1135, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3fvARB (const GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3FVARBPROC)_glewProfileTargets[1136])(a0);
+  _glewProfileEnd(1136, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3iARB (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3IARBPROC)_glewProfileTargets[1137])(a0, a1, a2);
+  _glewProfileEnd(1137, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3ivARB (const GLint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3IVARBPROC)_glewProfileTargets[1138])(a0);
+  _glewProfileEnd(1138, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3sARB (GLshort a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3SARBPROC)_glewProfileTargets[1139])(a0, a1, a2);
+  _glewProfileEnd(1139, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3svARB (const GLshort* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3SVARBPROC)_glewProfileTargets[1140])(a0);
+  _glewProfileEnd(1140, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBuffersATI (GLsizei a0, const GLenum* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERSATIPROC)_glewProfileTargets[1141])(a0, a1);
+  _glewProfileEnd(1141, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementArrayATI (GLenum a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTARRAYATIPROC)_glewProfileTargets[1142])(a0, a1);
+  _glewProfileEnd(1142, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawRangeElementArrayATI (GLenum a0, GLuint a1, GLuint a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWRANGEELEMENTARRAYATIPROC)_glewProfileTargets[1143])(a0, a1, a2, a3);
+  _glewProfileEnd(1143, t);
+}
+
+static void GLAPIENTRY _glewProfile_glElementPointerATI (GLenum a0, const void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLELEMENTPOINTERATIPROC)_glewProfileTargets[1144])(a0, a1);
+  _glewProfileEnd(1144, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexBumpParameterfvATI (GLenum a0, GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXBUMPPARAMETERFVATIPROC)_glewProfileTargets[1145])(a0, a1);
+  _glewProfileEnd(1145, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexBumpParameterivATI (GLenum a0, GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXBUMPPARAMETERIVATIPROC)_glewProfileTargets[1146])(a0, a1);
+  _glewProfileEnd(1146, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBumpParameterfvATI (GLenum a0, GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUMPPARAMETERFVATIPROC)_glewProfileTargets[1147])(a0, a1);
+  _glewProfileEnd(1147, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBumpParameterivATI (GLenum a0, GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUMPPARAMETERIVATIPROC)_glewProfileTargets[1148])(a0, a1);
+  _glewProfileEnd(1148, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAlphaFragmentOp1ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALPHAFRAGMENTOP1ATIPROC)_glewProfileTargets[1149])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1149, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAlphaFragmentOp2ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALPHAFRAGMENTOP2ATIPROC)_glewProfileTargets[1150])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1150, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAlphaFragmentOp3ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8, GLuint a9, GLuint a10, GLuint a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALPHAFRAGMENTOP3ATIPROC)_glewProfileTargets[1151])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(1151, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginFragmentShaderATI (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINFRAGMENTSHADERATIPROC)_glewProfileTargets[1152])();
+  _glewProfileEnd(1152, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFragmentShaderATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAGMENTSHADERATIPROC)_glewProfileTargets[1153])(a0);
+  _glewProfileEnd(1153, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorFragmentOp1ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORFRAGMENTOP1ATIPROC)_glewProfileTargets[1154])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1154, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorFragmentOp2ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8, GLuint a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORFRAGMENTOP2ATIPROC)_glewProfileTargets[1155])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1155, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorFragmentOp3ATI (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7, GLuint a8, GLuint a9, GLuint a10, GLuint a11, GLuint a12)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORFRAGMENTOP3ATIPROC)_glewProfileTargets[1156])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+  _glewProfileEnd(1156, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteFragmentShaderATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEFRAGMENTSHADERATIPROC)_glewProfileTargets[1157])(a0);
+  _glewProfileEnd(1157, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndFragmentShaderATI (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDFRAGMENTSHADERATIPROC)_glewProfileTargets[1158])();
+  _glewProfileEnd(1158, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGenFragmentShadersATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGENFRAGMENTSHADERSATIPROC)_glewProfileTargets[1159])(a0);
+  _glewProfileEnd(1159, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPassTexCoordATI (GLuint a0, GLuint a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPASSTEXCOORDATIPROC)_glewProfileTargets[1160])(a0, a1, a2);
+  _glewProfileEnd(1160, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleMapATI (GLuint a0, GLuint a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEMAPATIPROC)_glewProfileTargets[1161])(a0, a1, a2);
+  _glewProfileEnd(1161, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSetFragmentShaderConstantATI (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSETFRAGMENTSHADERCONSTANTATIPROC)_glewProfileTargets[1162])(a0, a1);
+  _glewProfileEnd(1162, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapObjectBufferATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPOBJECTBUFFERATIPROC)_glewProfileTargets[1163])(a0);
+  _glewProfileEnd(1163, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glUnmapObjectBufferATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNMAPOBJECTBUFFERATIPROC)_glewProfileTargets[1164])(a0);
+  _glewProfileEnd(1164, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPNTrianglesfATI (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPNTRIANGLESFATIPROC)_glewProfileTargets[1165])(a0, a1);
+  _glewProfileEnd(1165, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPNTrianglesiATI (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPNTRIANGLESIATIPROC)_glewProfileTargets[1166])(a0, a1);
+  _glewProfileEnd(1166, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilFuncSeparateATI (GLenum a0, GLenum a1, GLint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILFUNCSEPARATEATIPROC)_glewProfileTargets[1167])(a0, a1, a2, a3);
+  _glewProfileEnd(1167, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilOpSeparateATI (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILOPSEPARATEATIPROC)_glewProfileTargets[1168])(a0, a1, a2, a3);
+  _glewProfileEnd(1168, t);
+}
+
+static void GLAPIENTRY _glewProfile_glArrayObjectATI (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLARRAYOBJECTATIPROC)_glewProfileTargets[1169])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1169, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFreeObjectBufferATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFREEOBJECTBUFFERATIPROC)_glewProfileTargets[1170])(a0);
+  _glewProfileEnd(1170, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetArrayObjectfvATI (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETARRAYOBJECTFVATIPROC)_glewProfileTargets[1171])(a0, a1, a2);
+  _glewProfileEnd(1171, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetArrayObjectivATI (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETARRAYOBJECTIVATIPROC)_glewProfileTargets[1172])(a0, a1, a2);
+  _glewProfileEnd(1172, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectBufferfvATI (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTBUFFERFVATIPROC)_glewProfileTargets[1173])(a0, a1, a2);
+  _glewProfileEnd(1173, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectBufferivATI (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTBUFFERIVATIPROC)_glewProfileTargets[1174])(a0, a1, a2);
+  _glewProfileEnd(1174, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVariantArrayObjectfvATI (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVARIANTARRAYOBJECTFVATIPROC)_glewProfileTargets[1175])(a0, a1, a2);
+  _glewProfileEnd(1175, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVariantArrayObjectivATI (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVARIANTARRAYOBJECTIVATIPROC)_glewProfileTargets[1176])(a0, a1, a2);
+  _glewProfileEnd(1176, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsObjectBufferATI (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISOBJECTBUFFERATIPROC)_glewProfileTargets[1177])(a0);
+  _glewProfileEnd(1177, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glNewObjectBufferATI (GLsizei a0, const void * a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLNEWOBJECTBUFFERATIPROC)_glewProfileTargets[1178])(a0, a1, a2);
+  _glewProfileEnd(1178, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glUpdateObjectBufferATI (GLuint a0, GLuint a1, GLsizei a2, const void * a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUPDATEOBJECTBUFFERATIPROC)_glewProfileTargets[1179])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1179, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantArrayObjectATI (GLuint a0, GLenum a1, GLsizei a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTARRAYOBJECTATIPROC)_glewProfileTargets[1180])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1180, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribArrayObjectfvATI (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)_glewProfileTargets[1181])(a0, a1, a2);
+  _glewProfileEnd(1181, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribArrayObjectivATI (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)_glewProfileTargets[1182])(a0, a1, a2);
+  _glewProfileEnd(1182, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribArrayObjectATI (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, GLuint a5, GLuint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBARRAYOBJECTATIPROC)_glewProfileTargets[1183])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1183, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClientActiveVertexStreamATI (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)_glewProfileTargets[1184])(a0);
+  _glewProfileEnd(1184, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3bATI (GLenum a0, GLbyte a1, GLbyte a2, GLbyte a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3BATIPROC)_glewProfileTargets[1185])(a0, a1, a2, a3);
+  _glewProfileEnd(1185, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3bvATI (GLenum a0, const GLbyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3BVATIPROC)_glewProfileTargets[1186])(a0, a1);
+  _glewProfileEnd(1186, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3dATI (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3DATIPROC)_glewProfileTargets[1187])(a0, a1, a2, a3);
+  _glewProfileEnd(1187, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3dvATI (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3DVATIPROC)_glewProfileTargets[1188])(a0, a1);
+  _glewProfileEnd(1188, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3fATI (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3FATIPROC)_glewProfileTargets[1189])(a0, a1, a2, a3);
+  _glewProfileEnd(1189, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3fvATI (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3FVATIPROC)_glewProfileTargets[1190])(a0, a1);
+  _glewProfileEnd(1190, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3iATI (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3IATIPROC)_glewProfileTargets[1191])(a0, a1, a2, a3);
+  _glewProfileEnd(1191, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3ivATI (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3IVATIPROC)_glewProfileTargets[1192])(a0, a1);
+  _glewProfileEnd(1192, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3sATI (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3SATIPROC)_glewProfileTargets[1193])(a0, a1, a2, a3);
+  _glewProfileEnd(1193, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalStream3svATI (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALSTREAM3SVATIPROC)_glewProfileTargets[1194])(a0, a1);
+  _glewProfileEnd(1194, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexBlendEnvfATI (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXBLENDENVFATIPROC)_glewProfileTargets[1195])(a0, a1);
+  _glewProfileEnd(1195, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexBlendEnviATI (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXBLENDENVIATIPROC)_glewProfileTargets[1196])(a0, a1);
+  _glewProfileEnd(1196, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1dATI (GLenum a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1DATIPROC)_glewProfileTargets[1197])(a0, a1);
+  _glewProfileEnd(1197, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1dvATI (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1DVATIPROC)_glewProfileTargets[1198])(a0, a1);
+  _glewProfileEnd(1198, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1fATI (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1FATIPROC)_glewProfileTargets[1199])(a0, a1);
+  _glewProfileEnd(1199, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1fvATI (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1FVATIPROC)_glewProfileTargets[1200])(a0, a1);
+  _glewProfileEnd(1200, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1iATI (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1IATIPROC)_glewProfileTargets[1201])(a0, a1);
+  _glewProfileEnd(1201, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1ivATI (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1IVATIPROC)_glewProfileTargets[1202])(a0, a1);
+  _glewProfileEnd(1202, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1sATI (GLenum a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1SATIPROC)_glewProfileTargets[1203])(a0, a1);
+  _glewProfileEnd(1203, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream1svATI (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM1SVATIPROC)_glewProfileTargets[1204])(a0, a1);
+  _glewProfileEnd(1204, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2dATI (GLenum a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2DATIPROC)_glewProfileTargets[1205])(a0, a1, a2);
+  _glewProfileEnd(1205, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2dvATI (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2DVATIPROC)_glewProfileTargets[1206])(a0, a1);
+  _glewProfileEnd(1206, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2fATI (GLenum a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2FATIPROC)_glewProfileTargets[1207])(a0, a1, a2);
+  _glewProfileEnd(1207, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2fvATI (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2FVATIPROC)_glewProfileTargets[1208])(a0, a1);
+  _glewProfileEnd(1208, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2iATI (GLenum a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2IATIPROC)_glewProfileTargets[1209])(a0, a1, a2);
+  _glewProfileEnd(1209, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2ivATI (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2IVATIPROC)_glewProfileTargets[1210])(a0, a1);
+  _glewProfileEnd(1210, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2sATI (GLenum a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2SATIPROC)_glewProfileTargets[1211])(a0, a1, a2);
+  _glewProfileEnd(1211, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream2svATI (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM2SVATIPROC)_glewProfileTargets[1212])(a0, a1);
+  _glewProfileEnd(1212, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3dATI (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3DATIPROC)_glewProfileTargets[1213])(a0, a1, a2, a3);
+  _glewProfileEnd(1213, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3dvATI (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3DVATIPROC)_glewProfileTargets[1214])(a0, a1);
+  _glewProfileEnd(1214, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3fATI (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3FATIPROC)_glewProfileTargets[1215])(a0, a1, a2, a3);
+  _glewProfileEnd(1215, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3fvATI (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3FVATIPROC)_glewProfileTargets[1216])(a0, a1);
+  _glewProfileEnd(1216, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3iATI (GLenum a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3IATIPROC)_glewProfileTargets[1217])(a0, a1, a2, a3);
+  _glewProfileEnd(1217, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3ivATI (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3IVATIPROC)_glewProfileTargets[1218])(a0, a1);
+  _glewProfileEnd(1218, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3sATI (GLenum a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3SATIPROC)_glewProfileTargets[1219])(a0, a1, a2, a3);
+  _glewProfileEnd(1219, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream3svATI (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM3SVATIPROC)_glewProfileTargets[1220])(a0, a1);
+  _glewProfileEnd(1220, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4dATI (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4DATIPROC)_glewProfileTargets[1221])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1221, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4dvATI (GLenum a0, const GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4DVATIPROC)_glewProfileTargets[1222])(a0, a1);
+  _glewProfileEnd(1222, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4fATI (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4FATIPROC)_glewProfileTargets[1223])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1223, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4fvATI (GLenum a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4FVATIPROC)_glewProfileTargets[1224])(a0, a1);
+  _glewProfileEnd(1224, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4iATI (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4IATIPROC)_glewProfileTargets[1225])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1225, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4ivATI (GLenum a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4IVATIPROC)_glewProfileTargets[1226])(a0, a1);
+  _glewProfileEnd(1226, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4sATI (GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4SATIPROC)_glewProfileTargets[1227])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1227, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexStream4svATI (GLenum a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXSTREAM4SVATIPROC)_glewProfileTargets[1228])(a0, a1);
+  _glewProfileEnd(1228, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEGLImageTargetTexStorageEXT (GLenum a0, GLeglImageOES a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC)_glewProfileTargets[1229])(a0, a1, a2);
+  _glewProfileEnd(1229, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEGLImageTargetTextureStorageEXT (GLuint a0, GLeglImageOES a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC)_glewProfileTargets[1230])(a0, a1, a2);
+  _glewProfileEnd(1230, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstancedBaseInstanceEXT (GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEEXTPROC)_glewProfileTargets[1231])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1231, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedBaseInstanceEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC)_glewProfileTargets[1232])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1232, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedBaseVertexBaseInstanceEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5, GLuint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC)_glewProfileTargets[1233])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1233, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetUniformBufferSizeEXT (GLuint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETUNIFORMBUFFERSIZEEXTPROC)_glewProfileTargets[1234])(a0, a1);
+  _glewProfileEnd(1234, t);
+  return r;
+}
+
+static GLintptr GLAPIENTRY _glewProfile_glGetUniformOffsetEXT (GLuint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLintptr r = ((PFNGLGETUNIFORMOFFSETEXTPROC)_glewProfileTargets[1235])(a0, a1);
+  _glewProfileEnd(1235, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glUniformBufferEXT (GLuint a0, GLint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMBUFFEREXTPROC)_glewProfileTargets[1236])(a0, a1, a2);
+  _glewProfileEnd(1236, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendColorEXT (GLclampf a0, GLclampf a1, GLclampf a2, GLclampf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDCOLOREXTPROC)_glewProfileTargets[1237])(a0, a1, a2, a3);
+  _glewProfileEnd(1237, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparateEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEEXTPROC)_glewProfileTargets[1238])(a0, a1);
+  _glewProfileEnd(1238, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFragDataLocationIndexedEXT (GLuint a0, GLuint a1, GLuint a2, const GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAGDATALOCATIONINDEXEDEXTPROC)_glewProfileTargets[1239])(a0, a1, a2, a3);
+  _glewProfileEnd(1239, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetFragDataIndexEXT (GLuint a0, const GLchar * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETFRAGDATAINDEXEXTPROC)_glewProfileTargets[1240])(a0, a1);
+  _glewProfileEnd(1240, t);
+  return r;
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetProgramResourceLocationIndexEXT (GLuint a0, GLenum a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETPROGRAMRESOURCELOCATIONINDEXEXTPROC)_glewProfileTargets[1241])(a0, a1, a2);
+  _glewProfileEnd(1241, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparateEXT (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEEXTPROC)_glewProfileTargets[1242])(a0, a1, a2, a3);
+  _glewProfileEnd(1242, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONEXTPROC)_glewProfileTargets[1243])(a0);
+  _glewProfileEnd(1243, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferStorageEXT (GLenum a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERSTORAGEEXTPROC)_glewProfileTargets[1244])(a0, a1, a2, a3);
+  _glewProfileEnd(1244, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferStorageEXT (GLuint a0, GLsizeiptr a1, const void * a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERSTORAGEEXTPROC)_glewProfileTargets[1245])(a0, a1, a2, a3);
+  _glewProfileEnd(1245, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearTexImageEXT (GLuint a0, GLint a1, GLenum a2, GLenum a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARTEXIMAGEEXTPROC)_glewProfileTargets[1246])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1246, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearTexSubImageEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARTEXSUBIMAGEEXTPROC)_glewProfileTargets[1247])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(1247, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClipControlEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIPCONTROLEXTPROC)_glewProfileTargets[1248])(a0, a1);
+  _glewProfileEnd(1248, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorSubTableEXT (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORSUBTABLEEXTPROC)_glewProfileTargets[1249])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1249, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyColorSubTableEXT (GLenum a0, GLsizei a1, GLint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCOLORSUBTABLEEXTPROC)_glewProfileTargets[1250])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1250, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLockArraysEXT (GLint a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOCKARRAYSEXTPROC)_glewProfileTargets[1251])(a0, a1);
+  _glewProfileEnd(1251, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUnlockArraysEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNLOCKARRAYSEXTPROC)_glewProfileTargets[1252])();
+  _glewProfileEnd(1252, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionFilter1DEXT (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONFILTER1DEXTPROC)_glewProfileTargets[1253])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1253, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionFilter2DEXT (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONFILTER2DEXTPROC)_glewProfileTargets[1254])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1254, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameterfEXT (GLenum a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERFEXTPROC)_glewProfileTargets[1255])(a0, a1, a2);
+  _glewProfileEnd(1255, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameterfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERFVEXTPROC)_glewProfileTargets[1256])(a0, a1, a2);
+  _glewProfileEnd(1256, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameteriEXT (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERIEXTPROC)_glewProfileTargets[1257])(a0, a1, a2);
+  _glewProfileEnd(1257, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConvolutionParameterivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONVOLUTIONPARAMETERIVEXTPROC)_glewProfileTargets[1258])(a0, a1, a2);
+  _glewProfileEnd(1258, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyConvolutionFilter1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)_glewProfileTargets[1259])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1259, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyConvolutionFilter2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)_glewProfileTargets[1260])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1260, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetConvolutionFilterEXT (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCONVOLUTIONFILTEREXTPROC)_glewProfileTargets[1261])(a0, a1, a2, a3);
+  _glewProfileEnd(1261, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetConvolutionParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)_glewProfileTargets[1262])(a0, a1, a2);
+  _glewProfileEnd(1262, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetConvolutionParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)_glewProfileTargets[1263])(a0, a1, a2);
+  _glewProfileEnd(1263, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSeparableFilterEXT (GLenum a0, GLenum a1, GLenum a2, void * a3, void * a4, void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSEPARABLEFILTEREXTPROC)_glewProfileTargets[1264])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1264, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSeparableFilter2DEXT (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSEPARABLEFILTER2DEXTPROC)_glewProfileTargets[1265])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1265, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBinormalPointerEXT (GLenum a0, GLsizei a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINORMALPOINTEREXTPROC)_glewProfileTargets[1266])(a0, a1, a2);
+  _glewProfileEnd(1266, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTangentPointerEXT (GLenum a0, GLsizei a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTANGENTPOINTEREXTPROC)_glewProfileTargets[1267])(a0, a1, a2);
+  _glewProfileEnd(1267, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyImageSubDataEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYIMAGESUBDATAEXTPROC)_glewProfileTargets[1268])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+  _glewProfileEnd(1268, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexImage1DEXT (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXIMAGE1DEXTPROC)_glewProfileTargets[1269])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1269, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexImage2DEXT (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXIMAGE2DEXTPROC)_glewProfileTargets[1270])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1270, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexSubImage1DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXSUBIMAGE1DEXTPROC)_glewProfileTargets[1271])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1271, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexSubImage2DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXSUBIMAGE2DEXTPROC)_glewProfileTargets[1272])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1272, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexSubImage3DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXSUBIMAGE3DEXTPROC)_glewProfileTargets[1273])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1273, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCullParameterdvEXT (GLenum a0, GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCULLPARAMETERDVEXTPROC)_glewProfileTargets[1274])(a0, a1);
+  _glewProfileEnd(1274, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCullParameterfvEXT (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCULLPARAMETERFVEXTPROC)_glewProfileTargets[1275])(a0, a1);
+  _glewProfileEnd(1275, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectLabelEXT (GLenum a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTLABELEXTPROC)_glewProfileTargets[1276])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1276, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLabelObjectEXT (GLenum a0, GLuint a1, GLsizei a2, const GLchar* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLABELOBJECTEXTPROC)_glewProfileTargets[1277])(a0, a1, a2, a3);
+  _glewProfileEnd(1277, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInsertEventMarkerEXT (GLsizei a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINSERTEVENTMARKEREXTPROC)_glewProfileTargets[1278])(a0, a1);
+  _glewProfileEnd(1278, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPopGroupMarkerEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOPGROUPMARKEREXTPROC)_glewProfileTargets[1279])();
+  _glewProfileEnd(1279, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPushGroupMarkerEXT (GLsizei a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPUSHGROUPMARKEREXTPROC)_glewProfileTargets[1280])(a0, a1);
+  _glewProfileEnd(1280, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthBoundsEXT (GLclampd a0, GLclampd a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHBOUNDSEXTPROC)_glewProfileTargets[1281])(a0, a1);
+  _glewProfileEnd(1281, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindMultiTextureEXT (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDMULTITEXTUREEXTPROC)_glewProfileTargets[1282])(a0, a1, a2);
+  _glewProfileEnd(1282, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glCheckNamedFramebufferStatusEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)_glewProfileTargets[1283])(a0, a1);
+  _glewProfileEnd(1283, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glClientAttribDefaultEXT (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIENTATTRIBDEFAULTEXTPROC)_glewProfileTargets[1284])(a0);
+  _glewProfileEnd(1284, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedMultiTexImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)_glewProfileTargets[1285])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1285, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedMultiTexImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)_glewProfileTargets[1286])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1286, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedMultiTexImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLsizei a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)_glewProfileTargets[1287])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1287, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedMultiTexSubImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLsizei a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)_glewProfileTargets[1288])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1288, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedMultiTexSubImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLsizei a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)_glewProfileTargets[1289])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1289, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedMultiTexSubImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLsizei a10, const void * a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)_glewProfileTargets[1290])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(1290, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)_glewProfileTargets[1291])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1291, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)_glewProfileTargets[1292])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1292, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLsizei a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)_glewProfileTargets[1293])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1293, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureSubImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLsizei a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)_glewProfileTargets[1294])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1294, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureSubImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLsizei a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)_glewProfileTargets[1295])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1295, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTextureSubImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLsizei a10, const void * a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)_glewProfileTargets[1296])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(1296, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyMultiTexImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLint a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYMULTITEXIMAGE1DEXTPROC)_glewProfileTargets[1297])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1297, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyMultiTexImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLint a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYMULTITEXIMAGE2DEXTPROC)_glewProfileTargets[1298])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1298, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyMultiTexSubImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)_glewProfileTargets[1299])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1299, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyMultiTexSubImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)_glewProfileTargets[1300])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1300, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyMultiTexSubImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLsizei a8, GLsizei a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)_glewProfileTargets[1301])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1301, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLint a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTUREIMAGE1DEXTPROC)_glewProfileTargets[1302])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1302, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLint a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTUREIMAGE2DEXTPROC)_glewProfileTargets[1303])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1303, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureSubImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)_glewProfileTargets[1304])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1304, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureSubImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)_glewProfileTargets[1305])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1305, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTextureSubImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLsizei a8, GLsizei a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)_glewProfileTargets[1306])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1306, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableClientStateIndexedEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)_glewProfileTargets[1307])(a0, a1);
+  _glewProfileEnd(1307, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableClientStateiEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLECLIENTSTATEIEXTPROC)_glewProfileTargets[1308])(a0, a1);
+  _glewProfileEnd(1308, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVertexArrayAttribEXT (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)_glewProfileTargets[1309])(a0, a1);
+  _glewProfileEnd(1309, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVertexArrayEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVERTEXARRAYEXTPROC)_glewProfileTargets[1310])(a0, a1);
+  _glewProfileEnd(1310, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableClientStateIndexedEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLECLIENTSTATEINDEXEDEXTPROC)_glewProfileTargets[1311])(a0, a1);
+  _glewProfileEnd(1311, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableClientStateiEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLECLIENTSTATEIEXTPROC)_glewProfileTargets[1312])(a0, a1);
+  _glewProfileEnd(1312, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVertexArrayAttribEXT (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVERTEXARRAYATTRIBEXTPROC)_glewProfileTargets[1313])(a0, a1);
+  _glewProfileEnd(1313, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVertexArrayEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVERTEXARRAYEXTPROC)_glewProfileTargets[1314])(a0, a1);
+  _glewProfileEnd(1314, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFlushMappedNamedBufferRangeEXT (GLuint a0, GLintptr a1, GLsizeiptr a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)_glewProfileTargets[1315])(a0, a1, a2);
+  _glewProfileEnd(1315, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferDrawBufferEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)_glewProfileTargets[1316])(a0, a1);
+  _glewProfileEnd(1316, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferDrawBuffersEXT (GLuint a0, GLsizei a1, const GLenum* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)_glewProfileTargets[1317])(a0, a1, a2);
+  _glewProfileEnd(1317, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferReadBufferEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERREADBUFFEREXTPROC)_glewProfileTargets[1318])(a0, a1);
+  _glewProfileEnd(1318, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenerateMultiTexMipmapEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENERATEMULTITEXMIPMAPEXTPROC)_glewProfileTargets[1319])(a0, a1);
+  _glewProfileEnd(1319, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenerateTextureMipmapEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENERATETEXTUREMIPMAPEXTPROC)_glewProfileTargets[1320])(a0, a1);
+  _glewProfileEnd(1320, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCompressedMultiTexImageEXT (GLenum a0, GLenum a1, GLint a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)_glewProfileTargets[1321])(a0, a1, a2, a3);
+  _glewProfileEnd(1321, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCompressedTextureImageEXT (GLuint a0, GLenum a1, GLint a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)_glewProfileTargets[1322])(a0, a1, a2, a3);
+  _glewProfileEnd(1322, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetDoubleIndexedvEXT (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETDOUBLEINDEXEDVEXTPROC)_glewProfileTargets[1323])(a0, a1, a2);
+  _glewProfileEnd(1323, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetDoublei_vEXT (GLenum a0, GLuint a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETDOUBLEI_VEXTPROC)_glewProfileTargets[1324])(a0, a1, a2);
+  _glewProfileEnd(1324, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFloatIndexedvEXT (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFLOATINDEXEDVEXTPROC)_glewProfileTargets[1325])(a0, a1, a2);
+  _glewProfileEnd(1325, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFloati_vEXT (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFLOATI_VEXTPROC)_glewProfileTargets[1326])(a0, a1, a2);
+  _glewProfileEnd(1326, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)_glewProfileTargets[1327])(a0, a1, a2);
+  _glewProfileEnd(1327, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexEnvfvEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXENVFVEXTPROC)_glewProfileTargets[1328])(a0, a1, a2, a3);
+  _glewProfileEnd(1328, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexEnvivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXENVIVEXTPROC)_glewProfileTargets[1329])(a0, a1, a2, a3);
+  _glewProfileEnd(1329, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexGendvEXT (GLenum a0, GLenum a1, GLenum a2, GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXGENDVEXTPROC)_glewProfileTargets[1330])(a0, a1, a2, a3);
+  _glewProfileEnd(1330, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexGenfvEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXGENFVEXTPROC)_glewProfileTargets[1331])(a0, a1, a2, a3);
+  _glewProfileEnd(1331, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexGenivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXGENIVEXTPROC)_glewProfileTargets[1332])(a0, a1, a2, a3);
+  _glewProfileEnd(1332, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexImageEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLenum a4, void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXIMAGEEXTPROC)_glewProfileTargets[1333])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1333, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexLevelParameterfvEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)_glewProfileTargets[1334])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1334, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexLevelParameterivEXT (GLenum a0, GLenum a1, GLint a2, GLenum a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)_glewProfileTargets[1335])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1335, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexParameterIivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXPARAMETERIIVEXTPROC)_glewProfileTargets[1336])(a0, a1, a2, a3);
+  _glewProfileEnd(1336, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexParameterIuivEXT (GLenum a0, GLenum a1, GLenum a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXPARAMETERIUIVEXTPROC)_glewProfileTargets[1337])(a0, a1, a2, a3);
+  _glewProfileEnd(1337, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexParameterfvEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXPARAMETERFVEXTPROC)_glewProfileTargets[1338])(a0, a1, a2, a3);
+  _glewProfileEnd(1338, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultiTexParameterivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTITEXPARAMETERIVEXTPROC)_glewProfileTargets[1339])(a0, a1, a2, a3);
+  _glewProfileEnd(1339, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)_glewProfileTargets[1340])(a0, a1, a2);
+  _glewProfileEnd(1340, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferPointervEXT (GLuint a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERPOINTERVEXTPROC)_glewProfileTargets[1341])(a0, a1, a2);
+  _glewProfileEnd(1341, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferSubDataEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERSUBDATAEXTPROC)_glewProfileTargets[1342])(a0, a1, a2, a3);
+  _glewProfileEnd(1342, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedFramebufferAttachmentParameterivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)_glewProfileTargets[1343])(a0, a1, a2, a3);
+  _glewProfileEnd(1343, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedProgramLocalParameterIivEXT (GLuint a0, GLenum a1, GLuint a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)_glewProfileTargets[1344])(a0, a1, a2, a3);
+  _glewProfileEnd(1344, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedProgramLocalParameterIuivEXT (GLuint a0, GLenum a1, GLuint a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)_glewProfileTargets[1345])(a0, a1, a2, a3);
+  _glewProfileEnd(1345, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedProgramLocalParameterdvEXT (GLuint a0, GLenum a1, GLuint a2, GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)_glewProfileTargets[1346])(a0, a1, a2, a3);
+  _glewProfileEnd(1346, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedProgramLocalParameterfvEXT (GLuint a0, GLenum a1, GLuint a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)_glewProfileTargets[1347])(a0, a1, a2, a3);
+  _glewProfileEnd(1347, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedProgramStringEXT (GLuint a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDPROGRAMSTRINGEXTPROC)_glewProfileTargets[1348])(a0, a1, a2, a3);
+  _glewProfileEnd(1348, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedProgramivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDPROGRAMIVEXTPROC)_glewProfileTargets[1349])(a0, a1, a2, a3);
+  _glewProfileEnd(1349, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedRenderbufferParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)_glewProfileTargets[1350])(a0, a1, a2);
+  _glewProfileEnd(1350, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPointerIndexedvEXT (GLenum a0, GLuint a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPOINTERINDEXEDVEXTPROC)_glewProfileTargets[1351])(a0, a1, a2);
+  _glewProfileEnd(1351, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPointeri_vEXT (GLenum a0, GLuint a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPOINTERI_VEXTPROC)_glewProfileTargets[1352])(a0, a1, a2);
+  _glewProfileEnd(1352, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureImageEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLenum a4, void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREIMAGEEXTPROC)_glewProfileTargets[1353])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1353, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureLevelParameterfvEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)_glewProfileTargets[1354])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1354, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureLevelParameterivEXT (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)_glewProfileTargets[1355])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1355, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterIivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERIIVEXTPROC)_glewProfileTargets[1356])(a0, a1, a2, a3);
+  _glewProfileEnd(1356, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterIuivEXT (GLuint a0, GLenum a1, GLenum a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERIUIVEXTPROC)_glewProfileTargets[1357])(a0, a1, a2, a3);
+  _glewProfileEnd(1357, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterfvEXT (GLuint a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERFVEXTPROC)_glewProfileTargets[1358])(a0, a1, a2, a3);
+  _glewProfileEnd(1358, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTextureParameterivEXT (GLuint a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXTUREPARAMETERIVEXTPROC)_glewProfileTargets[1359])(a0, a1, a2, a3);
+  _glewProfileEnd(1359, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayIntegeri_vEXT (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)_glewProfileTargets[1360])(a0, a1, a2, a3);
+  _glewProfileEnd(1360, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayIntegervEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYINTEGERVEXTPROC)_glewProfileTargets[1361])(a0, a1, a2);
+  _glewProfileEnd(1361, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayPointeri_vEXT (GLuint a0, GLuint a1, GLenum a2, void** a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)_glewProfileTargets[1362])(a0, a1, a2, a3);
+  _glewProfileEnd(1362, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexArrayPointervEXT (GLuint a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXARRAYPOINTERVEXTPROC)_glewProfileTargets[1363])(a0, a1, a2);
+  _glewProfileEnd(1363, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapNamedBufferEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPNAMEDBUFFEREXTPROC)_glewProfileTargets[1364])(a0, a1);
+  _glewProfileEnd(1364, t);
+  return r;
+}
+
+static void * GLAPIENTRY _glewProfile_glMapNamedBufferRangeEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPNAMEDBUFFERRANGEEXTPROC)_glewProfileTargets[1365])(a0, a1, a2, a3);
+  _glewProfileEnd(1365, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixFrustumEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXFRUSTUMEXTPROC)_glewProfileTargets[1366])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1366, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoadIdentityEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOADIDENTITYEXTPROC)_glewProfileTargets[1367])(a0);
+  _glewProfileEnd(1367, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoadTransposedEXT (GLenum a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOADTRANSPOSEDEXTPROC)_glewProfileTargets[1368])(a0, a1);
+  _glewProfileEnd(1368, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoadTransposefEXT (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOADTRANSPOSEFEXTPROC)_glewProfileTargets[1369])(a0, a1);
+  _glewProfileEnd(1369, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoaddEXT (GLenum a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOADDEXTPROC)_glewProfileTargets[1370])(a0, a1);
+  _glewProfileEnd(1370, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoadfEXT (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOADFEXTPROC)_glewProfileTargets[1371])(a0, a1);
+  _glewProfileEnd(1371, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMultTransposedEXT (GLenum a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULTTRANSPOSEDEXTPROC)_glewProfileTargets[1372])(a0, a1);
+  _glewProfileEnd(1372, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMultTransposefEXT (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULTTRANSPOSEFEXTPROC)_glewProfileTargets[1373])(a0, a1);
+  _glewProfileEnd(1373, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMultdEXT (GLenum a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULTDEXTPROC)_glewProfileTargets[1374])(a0, a1);
+  _glewProfileEnd(1374, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMultfEXT (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULTFEXTPROC)_glewProfileTargets[1375])(a0, a1);
+  _glewProfileEnd(1375, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixOrthoEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXORTHOEXTPROC)_glewProfileTargets[1376])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1376, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixPopEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXPOPEXTPROC)_glewProfileTargets[1377])(a0);
+  _glewProfileEnd(1377, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixPushEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXPUSHEXTPROC)_glewProfileTargets[1378])(a0);
+  _glewProfileEnd(1378, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixRotatedEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXROTATEDEXTPROC)_glewProfileTargets[1379])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1379, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixRotatefEXT (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXROTATEFEXTPROC)_glewProfileTargets[1380])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1380, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixScaledEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXSCALEDEXTPROC)_glewProfileTargets[1381])(a0, a1, a2, a3);
+  _glewProfileEnd(1381, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixScalefEXT (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXSCALEFEXTPROC)_glewProfileTargets[1382])(a0, a1, a2, a3);
+  _glewProfileEnd(1382, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixTranslatedEXT (GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXTRANSLATEDEXTPROC)_glewProfileTargets[1383])(a0, a1, a2, a3);
+  _glewProfileEnd(1383, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixTranslatefEXT (GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXTRANSLATEFEXTPROC)_glewProfileTargets[1384])(a0, a1, a2, a3);
+  _glewProfileEnd(1384, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexBufferEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXBUFFEREXTPROC)_glewProfileTargets[1385])(a0, a1, a2, a3);
+  _glewProfileEnd(1385, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoordPointerEXT (GLenum a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORDPOINTEREXTPROC)_glewProfileTargets[1386])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1386, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexEnvfEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXENVFEXTPROC)_glewProfileTargets[1387])(a0, a1, a2, a3);
+  _glewProfileEnd(1387, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexEnvfvEXT (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXENVFVEXTPROC)_glewProfileTargets[1388])(a0, a1, a2, a3);
+  _glewProfileEnd(1388, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexEnviEXT (GLenum a0, GLenum a1, GLenum a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXENVIEXTPROC)_glewProfileTargets[1389])(a0, a1, a2, a3);
+  _glewProfileEnd(1389, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexEnvivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXENVIVEXTPROC)_glewProfileTargets[1390])(a0, a1, a2, a3);
+  _glewProfileEnd(1390, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexGendEXT (GLenum a0, GLenum a1, GLenum a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXGENDEXTPROC)_glewProfileTargets[1391])(a0, a1, a2, a3);
+  _glewProfileEnd(1391, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexGendvEXT (GLenum a0, GLenum a1, GLenum a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXGENDVEXTPROC)_glewProfileTargets[1392])(a0, a1, a2, a3);
+  _glewProfileEnd(1392, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexGenfEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXGENFEXTPROC)_glewProfileTargets[1393])(a0, a1, a2, a3);
+  _glewProfileEnd(1393, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexGenfvEXT (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXGENFVEXTPROC)_glewProfileTargets[1394])(a0, a1, a2, a3);
+  _glewProfileEnd(1394, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexGeniEXT (GLenum a0, GLenum a1, GLenum a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXGENIEXTPROC)_glewProfileTargets[1395])(a0, a1, a2, a3);
+  _glewProfileEnd(1395, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexGenivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXGENIVEXTPROC)_glewProfileTargets[1396])(a0, a1, a2, a3);
+  _glewProfileEnd(1396, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXIMAGE1DEXTPROC)_glewProfileTargets[1397])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1397, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXIMAGE2DEXTPROC)_glewProfileTargets[1398])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1398, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXIMAGE3DEXTPROC)_glewProfileTargets[1399])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(1399, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexParameterIivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXPARAMETERIIVEXTPROC)_glewProfileTargets[1400])(a0, a1, a2, a3);
+  _glewProfileEnd(1400, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexParameterIuivEXT (GLenum a0, GLenum a1, GLenum a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXPARAMETERIUIVEXTPROC)_glewProfileTargets[1401])(a0, a1, a2, a3);
+  _glewProfileEnd(1401, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexParameterfEXT (GLenum a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXPARAMETERFEXTPROC)_glewProfileTargets[1402])(a0, a1, a2, a3);
+  _glewProfileEnd(1402, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexParameterfvEXT (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXPARAMETERFVEXTPROC)_glewProfileTargets[1403])(a0, a1, a2, a3);
+  _glewProfileEnd(1403, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexParameteriEXT (GLenum a0, GLenum a1, GLenum a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXPARAMETERIEXTPROC)_glewProfileTargets[1404])(a0, a1, a2, a3);
+  _glewProfileEnd(1404, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexParameterivEXT (GLenum a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXPARAMETERIVEXTPROC)_glewProfileTargets[1405])(a0, a1, a2, a3);
+  _glewProfileEnd(1405, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexRenderbufferEXT (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXRENDERBUFFEREXTPROC)_glewProfileTargets[1406])(a0, a1, a2);
+  _glewProfileEnd(1406, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexSubImage1DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLenum a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXSUBIMAGE1DEXTPROC)_glewProfileTargets[1407])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1407, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexSubImage2DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXSUBIMAGE2DEXTPROC)_glewProfileTargets[1408])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1408, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexSubImage3DEXT (GLenum a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLenum a10, const void * a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXSUBIMAGE3DEXTPROC)_glewProfileTargets[1409])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(1409, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferDataEXT (GLuint a0, GLsizeiptr a1, const void * a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERDATAEXTPROC)_glewProfileTargets[1410])(a0, a1, a2, a3);
+  _glewProfileEnd(1410, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferSubDataEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERSUBDATAEXTPROC)_glewProfileTargets[1411])(a0, a1, a2, a3);
+  _glewProfileEnd(1411, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedCopyBufferSubDataEXT (GLuint a0, GLuint a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)_glewProfileTargets[1412])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1412, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferRenderbufferEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)_glewProfileTargets[1413])(a0, a1, a2, a3);
+  _glewProfileEnd(1413, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTexture1DEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)_glewProfileTargets[1414])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1414, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTexture2DEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)_glewProfileTargets[1415])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1415, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTexture3DEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)_glewProfileTargets[1416])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1416, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTextureEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)_glewProfileTargets[1417])(a0, a1, a2, a3);
+  _glewProfileEnd(1417, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTextureFaceEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)_glewProfileTargets[1418])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1418, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTextureLayerEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)_glewProfileTargets[1419])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1419, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameter4dEXT (GLuint a0, GLenum a1, GLuint a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)_glewProfileTargets[1420])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1420, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameter4dvEXT (GLuint a0, GLenum a1, GLuint a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)_glewProfileTargets[1421])(a0, a1, a2, a3);
+  _glewProfileEnd(1421, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameter4fEXT (GLuint a0, GLenum a1, GLuint a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)_glewProfileTargets[1422])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1422, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameter4fvEXT (GLuint a0, GLenum a1, GLuint a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)_glewProfileTargets[1423])(a0, a1, a2, a3);
+  _glewProfileEnd(1423, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameterI4iEXT (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLint a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)_glewProfileTargets[1424])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1424, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameterI4ivEXT (GLuint a0, GLenum a1, GLuint a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)_glewProfileTargets[1425])(a0, a1, a2, a3);
+  _glewProfileEnd(1425, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameterI4uiEXT (GLuint a0, GLenum a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5, GLuint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)_glewProfileTargets[1426])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1426, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameterI4uivEXT (GLuint a0, GLenum a1, GLuint a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)_glewProfileTargets[1427])(a0, a1, a2, a3);
+  _glewProfileEnd(1427, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParameters4fvEXT (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)_glewProfileTargets[1428])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1428, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParametersI4ivEXT (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)_glewProfileTargets[1429])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1429, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramLocalParametersI4uivEXT (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLuint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)_glewProfileTargets[1430])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1430, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedProgramStringEXT (GLuint a0, GLenum a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDPROGRAMSTRINGEXTPROC)_glewProfileTargets[1431])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1431, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedRenderbufferStorageEXT (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)_glewProfileTargets[1432])(a0, a1, a2, a3);
+  _glewProfileEnd(1432, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedRenderbufferStorageMultisampleCoverageEXT (GLuint a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)_glewProfileTargets[1433])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1433, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedRenderbufferStorageMultisampleEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)_glewProfileTargets[1434])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1434, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1fEXT (GLuint a0, GLint a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1FEXTPROC)_glewProfileTargets[1435])(a0, a1, a2);
+  _glewProfileEnd(1435, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1FVEXTPROC)_glewProfileTargets[1436])(a0, a1, a2, a3);
+  _glewProfileEnd(1436, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1iEXT (GLuint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1IEXTPROC)_glewProfileTargets[1437])(a0, a1, a2);
+  _glewProfileEnd(1437, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1IVEXTPROC)_glewProfileTargets[1438])(a0, a1, a2, a3);
+  _glewProfileEnd(1438, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1uiEXT (GLuint a0, GLint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UIEXTPROC)_glewProfileTargets[1439])(a0, a1, a2);
+  _glewProfileEnd(1439, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UIVEXTPROC)_glewProfileTargets[1440])(a0, a1, a2, a3);
+  _glewProfileEnd(1440, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2fEXT (GLuint a0, GLint a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2FEXTPROC)_glewProfileTargets[1441])(a0, a1, a2, a3);
+  _glewProfileEnd(1441, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2FVEXTPROC)_glewProfileTargets[1442])(a0, a1, a2, a3);
+  _glewProfileEnd(1442, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2iEXT (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2IEXTPROC)_glewProfileTargets[1443])(a0, a1, a2, a3);
+  _glewProfileEnd(1443, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2IVEXTPROC)_glewProfileTargets[1444])(a0, a1, a2, a3);
+  _glewProfileEnd(1444, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2uiEXT (GLuint a0, GLint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UIEXTPROC)_glewProfileTargets[1445])(a0, a1, a2, a3);
+  _glewProfileEnd(1445, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UIVEXTPROC)_glewProfileTargets[1446])(a0, a1, a2, a3);
+  _glewProfileEnd(1446, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3fEXT (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3FEXTPROC)_glewProfileTargets[1447])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1447, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3FVEXTPROC)_glewProfileTargets[1448])(a0, a1, a2, a3);
+  _glewProfileEnd(1448, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3iEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3IEXTPROC)_glewProfileTargets[1449])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1449, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3IVEXTPROC)_glewProfileTargets[1450])(a0, a1, a2, a3);
+  _glewProfileEnd(1450, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3uiEXT (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UIEXTPROC)_glewProfileTargets[1451])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1451, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UIVEXTPROC)_glewProfileTargets[1452])(a0, a1, a2, a3);
+  _glewProfileEnd(1452, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4fEXT (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4FEXTPROC)_glewProfileTargets[1453])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1453, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4fvEXT (GLuint a0, GLint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4FVEXTPROC)_glewProfileTargets[1454])(a0, a1, a2, a3);
+  _glewProfileEnd(1454, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4iEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4IEXTPROC)_glewProfileTargets[1455])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1455, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4ivEXT (GLuint a0, GLint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4IVEXTPROC)_glewProfileTargets[1456])(a0, a1, a2, a3);
+  _glewProfileEnd(1456, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4uiEXT (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UIEXTPROC)_glewProfileTargets[1457])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1457, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4uivEXT (GLuint a0, GLint a1, GLsizei a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UIVEXTPROC)_glewProfileTargets[1458])(a0, a1, a2, a3);
+  _glewProfileEnd(1458, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)_glewProfileTargets[1459])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1459, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2x3fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)_glewProfileTargets[1460])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1460, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix2x4fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)_glewProfileTargets[1461])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1461, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)_glewProfileTargets[1462])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1462, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3x2fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)_glewProfileTargets[1463])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1463, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix3x4fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)_glewProfileTargets[1464])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1464, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)_glewProfileTargets[1465])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1465, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4x2fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)_glewProfileTargets[1466])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1466, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformMatrix4x3fvEXT (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)_glewProfileTargets[1467])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1467, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPushClientAttribDefaultEXT (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)_glewProfileTargets[1468])(a0);
+  _glewProfileEnd(1468, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureBufferEXT (GLuint a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREBUFFEREXTPROC)_glewProfileTargets[1469])(a0, a1, a2, a3);
+  _glewProfileEnd(1469, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE1DEXTPROC)_glewProfileTargets[1470])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1470, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE2DEXTPROC)_glewProfileTargets[1471])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1471, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE3DEXTPROC)_glewProfileTargets[1472])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(1472, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterIivEXT (GLuint a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIIVEXTPROC)_glewProfileTargets[1473])(a0, a1, a2, a3);
+  _glewProfileEnd(1473, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterIuivEXT (GLuint a0, GLenum a1, GLenum a2, const GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIUIVEXTPROC)_glewProfileTargets[1474])(a0, a1, a2, a3);
+  _glewProfileEnd(1474, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterfEXT (GLuint a0, GLenum a1, GLenum a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERFEXTPROC)_glewProfileTargets[1475])(a0, a1, a2, a3);
+  _glewProfileEnd(1475, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterfvEXT (GLuint a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERFVEXTPROC)_glewProfileTargets[1476])(a0, a1, a2, a3);
+  _glewProfileEnd(1476, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameteriEXT (GLuint a0, GLenum a1, GLenum a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIEXTPROC)_glewProfileTargets[1477])(a0, a1, a2, a3);
+  _glewProfileEnd(1477, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureParameterivEXT (GLuint a0, GLenum a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPARAMETERIVEXTPROC)_glewProfileTargets[1478])(a0, a1, a2, a3);
+  _glewProfileEnd(1478, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureRenderbufferEXT (GLuint a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURERENDERBUFFEREXTPROC)_glewProfileTargets[1479])(a0, a1, a2);
+  _glewProfileEnd(1479, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureSubImage1DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLsizei a4, GLenum a5, GLenum a6, const void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESUBIMAGE1DEXTPROC)_glewProfileTargets[1480])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1480, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureSubImage2DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESUBIMAGE2DEXTPROC)_glewProfileTargets[1481])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1481, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureSubImage3DEXT (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLenum a9, GLenum a10, const void * a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESUBIMAGE3DEXTPROC)_glewProfileTargets[1482])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(1482, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glUnmapNamedBufferEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLUNMAPNAMEDBUFFEREXTPROC)_glewProfileTargets[1483])(a0);
+  _glewProfileEnd(1483, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayColorOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYCOLOROFFSETEXTPROC)_glewProfileTargets[1484])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1484, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayEdgeFlagOffsetEXT (GLuint a0, GLuint a1, GLsizei a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)_glewProfileTargets[1485])(a0, a1, a2, a3);
+  _glewProfileEnd(1485, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayFogCoordOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLsizei a3, GLintptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)_glewProfileTargets[1486])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1486, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayIndexOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLsizei a3, GLintptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYINDEXOFFSETEXTPROC)_glewProfileTargets[1487])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1487, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayMultiTexCoordOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLint a3, GLenum a4, GLsizei a5, GLintptr a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)_glewProfileTargets[1488])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1488, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayNormalOffsetEXT (GLuint a0, GLuint a1, GLenum a2, GLsizei a3, GLintptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYNORMALOFFSETEXTPROC)_glewProfileTargets[1489])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1489, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArraySecondaryColorOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)_glewProfileTargets[1490])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1490, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayTexCoordOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)_glewProfileTargets[1491])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1491, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribDivisorEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)_glewProfileTargets[1492])(a0, a1, a2);
+  _glewProfileEnd(1492, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribIOffsetEXT (GLuint a0, GLuint a1, GLuint a2, GLint a3, GLenum a4, GLsizei a5, GLintptr a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)_glewProfileTargets[1493])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1493, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribOffsetEXT (GLuint a0, GLuint a1, GLuint a2, GLint a3, GLenum a4, GLboolean a5, GLsizei a6, GLintptr a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)_glewProfileTargets[1494])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1494, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexOffsetEXT (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLsizei a4, GLintptr a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)_glewProfileTargets[1495])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1495, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDiscardFramebufferEXT (GLenum a0, GLsizei a1, const GLenum* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISCARDFRAMEBUFFEREXTPROC)_glewProfileTargets[1496])(a0, a1, a2);
+  _glewProfileEnd(1496, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginQueryEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINQUERYEXTPROC)_glewProfileTargets[1497])(a0, a1);
+  _glewProfileEnd(1497, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteQueriesEXT (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEQUERIESEXTPROC)_glewProfileTargets[1498])(a0, a1);
+  _glewProfileEnd(1498, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndQueryEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDQUERYEXTPROC)_glewProfileTargets[1499])(a0);
+  _glewProfileEnd(1499, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenQueriesEXT (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENQUERIESEXTPROC)_glewProfileTargets[1500])(a0, a1);
+  _glewProfileEnd(1500, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInteger64vEXT (GLenum a0, GLint64* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGER64VEXTPROC)_glewProfileTargets[1501])(a0, a1);
+  _glewProfileEnd(1501, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTIVEXTPROC)_glewProfileTargets[1502])(a0, a1, a2);
+  _glewProfileEnd(1502, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectuivEXT (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUIVEXTPROC)_glewProfileTargets[1503])(a0, a1, a2);
+  _glewProfileEnd(1503, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYIVEXTPROC)_glewProfileTargets[1504])(a0, a1, a2);
+  _glewProfileEnd(1504, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsQueryEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISQUERYEXTPROC)_glewProfileTargets[1505])(a0);
+  _glewProfileEnd(1505, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glQueryCounterEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLQUERYCOUNTEREXTPROC)_glewProfileTargets[1506])(a0, a1);
+  _glewProfileEnd(1506, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBuffersEXT (GLsizei a0, const GLenum* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERSEXTPROC)_glewProfileTargets[1507])(a0, a1);
+  _glewProfileEnd(1507, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorMaskIndexedEXT (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORMASKINDEXEDEXTPROC)_glewProfileTargets[1508])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1508, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableIndexedEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEINDEXEDEXTPROC)_glewProfileTargets[1509])(a0, a1);
+  _glewProfileEnd(1509, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableIndexedEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEINDEXEDEXTPROC)_glewProfileTargets[1510])(a0, a1);
+  _glewProfileEnd(1510, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBooleanIndexedvEXT (GLenum a0, GLuint a1, GLboolean* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBOOLEANINDEXEDVEXTPROC)_glewProfileTargets[1511])(a0, a1, a2);
+  _glewProfileEnd(1511, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetIntegerIndexedvEXT (GLenum a0, GLuint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGERINDEXEDVEXTPROC)_glewProfileTargets[1512])(a0, a1, a2);
+  _glewProfileEnd(1512, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsEnabledIndexedEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISENABLEDINDEXEDEXTPROC)_glewProfileTargets[1513])(a0, a1);
+  _glewProfileEnd(1513, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparateiEXT (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEIEXTPROC)_glewProfileTargets[1514])(a0, a1, a2);
+  _glewProfileEnd(1514, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationiEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONIEXTPROC)_glewProfileTargets[1515])(a0, a1);
+  _glewProfileEnd(1515, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparateiEXT (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEIEXTPROC)_glewProfileTargets[1516])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1516, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFunciEXT (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCIEXTPROC)_glewProfileTargets[1517])(a0, a1, a2);
+  _glewProfileEnd(1517, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorMaskiEXT (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORMASKIEXTPROC)_glewProfileTargets[1518])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1518, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableiEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEIEXTPROC)_glewProfileTargets[1519])(a0, a1);
+  _glewProfileEnd(1519, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableiEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEIEXTPROC)_glewProfileTargets[1520])(a0, a1);
+  _glewProfileEnd(1520, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsEnablediEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISENABLEDIEXTPROC)_glewProfileTargets[1521])(a0, a1);
+  _glewProfileEnd(1521, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsBaseVertexEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSBASEVERTEXEXTPROC)_glewProfileTargets[1522])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1522, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedBaseVertexEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXEXTPROC)_glewProfileTargets[1523])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1523, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawRangeElementsBaseVertexEXT (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWRANGEELEMENTSBASEVERTEXEXTPROC)_glewProfileTargets[1524])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1524, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsBaseVertexEXT (GLenum a0, const GLsizei* a1, GLenum a2, const void *const * a3, GLsizei a4, const GLint * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSBASEVERTEXEXTPROC)_glewProfileTargets[1525])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1525, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstancedEXT (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDEXTPROC)_glewProfileTargets[1526])(a0, a1, a2, a3);
+  _glewProfileEnd(1526, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedEXT (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDEXTPROC)_glewProfileTargets[1527])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1527, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawRangeElementsEXT (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWRANGEELEMENTSEXTPROC)_glewProfileTargets[1528])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1528, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedbackEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKEXTPROC)_glewProfileTargets[1529])(a0, a1);
+  _glewProfileEnd(1529, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedbackInstancedEXT (GLenum a0, GLuint a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDEXTPROC)_glewProfileTargets[1530])(a0, a1, a2);
+  _glewProfileEnd(1530, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferStorageExternalEXT (GLenum a0, GLintptr a1, GLsizeiptr a2, GLeglClientBufferEXT a3, GLbitfield a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERSTORAGEEXTERNALEXTPROC)_glewProfileTargets[1531])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1531, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferStorageExternalEXT (GLuint a0, GLintptr a1, GLsizeiptr a2, GLeglClientBufferEXT a3, GLbitfield a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)_glewProfileTargets[1532])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1532, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordPointerEXT (GLenum a0, GLsizei a1, const void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDPOINTEREXTPROC)_glewProfileTargets[1533])(a0, a1, a2);
+  _glewProfileEnd(1533, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoorddEXT (GLdouble a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDDEXTPROC)_glewProfileTargets[1534])(a0);
+  _glewProfileEnd(1534, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoorddvEXT (const GLdouble * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDDVEXTPROC)_glewProfileTargets[1535])(a0);
+  _glewProfileEnd(1535, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordfEXT (GLfloat a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDFEXTPROC)_glewProfileTargets[1536])(a0);
+  _glewProfileEnd(1536, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordfvEXT (const GLfloat * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDFVEXTPROC)_glewProfileTargets[1537])(a0);
+  _glewProfileEnd(1537, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentColorMaterialEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTCOLORMATERIALEXTPROC)_glewProfileTargets[1538])(a0, a1);
+  _glewProfileEnd(1538, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModelfEXT (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELFEXTPROC)_glewProfileTargets[1539])(a0, a1);
+  _glewProfileEnd(1539, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModelfvEXT (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELFVEXTPROC)_glewProfileTargets[1540])(a0, a1);
+  _glewProfileEnd(1540, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModeliEXT (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELIEXTPROC)_glewProfileTargets[1541])(a0, a1);
+  _glewProfileEnd(1541, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModelivEXT (GLenum a0, GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELIVEXTPROC)_glewProfileTargets[1542])(a0, a1);
+  _glewProfileEnd(1542, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightfEXT (GLenum a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTFEXTPROC)_glewProfileTargets[1543])(a0, a1, a2);
+  _glewProfileEnd(1543, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTFVEXTPROC)_glewProfileTargets[1544])(a0, a1, a2);
+  _glewProfileEnd(1544, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightiEXT (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTIEXTPROC)_glewProfileTargets[1545])(a0, a1, a2);
+  _glewProfileEnd(1545, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTIVEXTPROC)_glewProfileTargets[1546])(a0, a1, a2);
+  _glewProfileEnd(1546, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialfEXT (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALFEXTPROC)_glewProfileTargets[1547])(a0, a1, a2);
+  _glewProfileEnd(1547, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALFVEXTPROC)_glewProfileTargets[1548])(a0, a1, a2);
+  _glewProfileEnd(1548, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialiEXT (GLenum a0, GLenum a1, const GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALIEXTPROC)_glewProfileTargets[1549])(a0, a1, a2);
+  _glewProfileEnd(1549, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALIVEXTPROC)_glewProfileTargets[1550])(a0, a1, a2);
+  _glewProfileEnd(1550, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentLightfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTLIGHTFVEXTPROC)_glewProfileTargets[1551])(a0, a1, a2);
+  _glewProfileEnd(1551, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentLightivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTLIGHTIVEXTPROC)_glewProfileTargets[1552])(a0, a1, a2);
+  _glewProfileEnd(1552, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentMaterialfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTMATERIALFVEXTPROC)_glewProfileTargets[1553])(a0, a1, a2);
+  _glewProfileEnd(1553, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentMaterialivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTMATERIALIVEXTPROC)_glewProfileTargets[1554])(a0, a1, a2);
+  _glewProfileEnd(1554, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLightEnviEXT (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLIGHTENVIEXTPROC)_glewProfileTargets[1555])(a0, a1);
+  _glewProfileEnd(1555, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlitFramebufferEXT (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLITFRAMEBUFFEREXTPROC)_glewProfileTargets[1556])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1556, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)_glewProfileTargets[1557])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1557, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFramebufferEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAMEBUFFEREXTPROC)_glewProfileTargets[1558])(a0, a1);
+  _glewProfileEnd(1558, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindRenderbufferEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDRENDERBUFFEREXTPROC)_glewProfileTargets[1559])(a0, a1);
+  _glewProfileEnd(1559, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glCheckFramebufferStatusEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)_glewProfileTargets[1560])(a0);
+  _glewProfileEnd(1560, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteFramebuffersEXT (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEFRAMEBUFFERSEXTPROC)_glewProfileTargets[1561])(a0, a1);
+  _glewProfileEnd(1561, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteRenderbuffersEXT (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETERENDERBUFFERSEXTPROC)_glewProfileTargets[1562])(a0, a1);
+  _glewProfileEnd(1562, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferRenderbufferEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)_glewProfileTargets[1563])(a0, a1, a2, a3);
+  _glewProfileEnd(1563, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture1DEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE1DEXTPROC)_glewProfileTargets[1564])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1564, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture2DEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)_glewProfileTargets[1565])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1565, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture3DEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE3DEXTPROC)_glewProfileTargets[1566])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1566, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenFramebuffersEXT (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENFRAMEBUFFERSEXTPROC)_glewProfileTargets[1567])(a0, a1);
+  _glewProfileEnd(1567, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenRenderbuffersEXT (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENRENDERBUFFERSEXTPROC)_glewProfileTargets[1568])(a0, a1);
+  _glewProfileEnd(1568, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenerateMipmapEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENERATEMIPMAPEXTPROC)_glewProfileTargets[1569])(a0);
+  _glewProfileEnd(1569, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferAttachmentParameterivEXT (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)_glewProfileTargets[1570])(a0, a1, a2, a3);
+  _glewProfileEnd(1570, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetRenderbufferParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)_glewProfileTargets[1571])(a0, a1, a2);
+  _glewProfileEnd(1571, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsFramebufferEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISFRAMEBUFFEREXTPROC)_glewProfileTargets[1572])(a0);
+  _glewProfileEnd(1572, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsRenderbufferEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISRENDERBUFFEREXTPROC)_glewProfileTargets[1573])(a0);
+  _glewProfileEnd(1573, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageEXT (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEEXTPROC)_glewProfileTargets[1574])(a0, a1, a2, a3);
+  _glewProfileEnd(1574, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureEXT (GLenum a0, GLenum a1, GLuint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREEXTPROC)_glewProfileTargets[1575])(a0, a1, a2, a3);
+  _glewProfileEnd(1575, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureFaceEXT (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)_glewProfileTargets[1576])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1576, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameteriEXT (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETERIEXTPROC)_glewProfileTargets[1577])(a0, a1, a2);
+  _glewProfileEnd(1577, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameters4fvEXT (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERS4FVEXTPROC)_glewProfileTargets[1578])(a0, a1, a2, a3);
+  _glewProfileEnd(1578, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameters4fvEXT (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)_glewProfileTargets[1579])(a0, a1, a2, a3);
+  _glewProfileEnd(1579, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindFragDataLocationEXT (GLuint a0, GLuint a1, const GLchar * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAGDATALOCATIONEXTPROC)_glewProfileTargets[1580])(a0, a1, a2);
+  _glewProfileEnd(1580, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetFragDataLocationEXT (GLuint a0, const GLchar * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETFRAGDATALOCATIONEXTPROC)_glewProfileTargets[1581])(a0, a1);
+  _glewProfileEnd(1581, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformuivEXT (GLuint a0, GLint a1, GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMUIVEXTPROC)_glewProfileTargets[1582])(a0, a1, a2);
+  _glewProfileEnd(1582, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribIivEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIIVEXTPROC)_glewProfileTargets[1583])(a0, a1, a2);
+  _glewProfileEnd(1583, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribIuivEXT (GLuint a0, GLenum a1, GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIUIVEXTPROC)_glewProfileTargets[1584])(a0, a1, a2);
+  _glewProfileEnd(1584, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1uiEXT (GLint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UIEXTPROC)_glewProfileTargets[1585])(a0, a1);
+  _glewProfileEnd(1585, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UIVEXTPROC)_glewProfileTargets[1586])(a0, a1, a2);
+  _glewProfileEnd(1586, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2uiEXT (GLint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UIEXTPROC)_glewProfileTargets[1587])(a0, a1, a2);
+  _glewProfileEnd(1587, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UIVEXTPROC)_glewProfileTargets[1588])(a0, a1, a2);
+  _glewProfileEnd(1588, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3uiEXT (GLint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UIEXTPROC)_glewProfileTargets[1589])(a0, a1, a2, a3);
+  _glewProfileEnd(1589, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UIVEXTPROC)_glewProfileTargets[1590])(a0, a1, a2);
+  _glewProfileEnd(1590, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4uiEXT (GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UIEXTPROC)_glewProfileTargets[1591])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1591, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4uivEXT (GLint a0, GLsizei a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UIVEXTPROC)_glewProfileTargets[1592])(a0, a1, a2);
+  _glewProfileEnd(1592, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1iEXT (GLuint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1IEXTPROC)_glewProfileTargets[1593])(a0, a1);
+  _glewProfileEnd(1593, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1ivEXT (GLuint a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1IVEXTPROC)_glewProfileTargets[1594])(a0, a1);
+  _glewProfileEnd(1594, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1uiEXT (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1UIEXTPROC)_glewProfileTargets[1595])(a0, a1);
+  _glewProfileEnd(1595, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI1uivEXT (GLuint a0, const GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI1UIVEXTPROC)_glewProfileTargets[1596])(a0, a1);
+  _glewProfileEnd(1596, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2iEXT (GLuint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2IEXTPROC)_glewProfileTargets[1597])(a0, a1, a2);
+  _glewProfileEnd(1597, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2ivEXT (GLuint a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2IVEXTPROC)_glewProfileTargets[1598])(a0, a1);
+  _glewProfileEnd(1598, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2uiEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2UIEXTPROC)_glewProfileTargets[1599])(a0, a1, a2);
+  _glewProfileEnd(1599, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI2uivEXT (GLuint a0, const GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI2UIVEXTPROC)_glewProfileTargets[1600])(a0, a1);
+  _glewProfileEnd(1600, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3iEXT (GLuint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3IEXTPROC)_glewProfileTargets[1601])(a0, a1, a2, a3);
+  _glewProfileEnd(1601, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3ivEXT (GLuint a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3IVEXTPROC)_glewProfileTargets[1602])(a0, a1);
+  _glewProfileEnd(1602, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3uiEXT (GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3UIEXTPROC)_glewProfileTargets[1603])(a0, a1, a2, a3);
+  _glewProfileEnd(1603, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI3uivEXT (GLuint a0, const GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI3UIVEXTPROC)_glewProfileTargets[1604])(a0, a1);
+  _glewProfileEnd(1604, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4bvEXT (GLuint a0, const GLbyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4BVEXTPROC)_glewProfileTargets[1605])(a0, a1);
+  _glewProfileEnd(1605, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4iEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4IEXTPROC)_glewProfileTargets[1606])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1606, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4ivEXT (GLuint a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4IVEXTPROC)_glewProfileTargets[1607])(a0, a1);
+  _glewProfileEnd(1607, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4svEXT (GLuint a0, const GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4SVEXTPROC)_glewProfileTargets[1608])(a0, a1);
+  _glewProfileEnd(1608, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4ubvEXT (GLuint a0, const GLubyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4UBVEXTPROC)_glewProfileTargets[1609])(a0, a1);
+  _glewProfileEnd(1609, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4uiEXT (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4UIEXTPROC)_glewProfileTargets[1610])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1610, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4uivEXT (GLuint a0, const GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4UIVEXTPROC)_glewProfileTargets[1611])(a0, a1);
+  _glewProfileEnd(1611, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribI4usvEXT (GLuint a0, const GLushort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBI4USVEXTPROC)_glewProfileTargets[1612])(a0, a1);
+  _glewProfileEnd(1612, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribIPointerEXT (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBIPOINTEREXTPROC)_glewProfileTargets[1613])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1613, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetHistogramEXT (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETHISTOGRAMEXTPROC)_glewProfileTargets[1614])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1614, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetHistogramParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETHISTOGRAMPARAMETERFVEXTPROC)_glewProfileTargets[1615])(a0, a1, a2);
+  _glewProfileEnd(1615, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetHistogramParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETHISTOGRAMPARAMETERIVEXTPROC)_glewProfileTargets[1616])(a0, a1, a2);
+  _glewProfileEnd(1616, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMinmaxEXT (GLenum a0, GLboolean a1, GLenum a2, GLenum a3, void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMINMAXEXTPROC)_glewProfileTargets[1617])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1617, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMinmaxParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMINMAXPARAMETERFVEXTPROC)_glewProfileTargets[1618])(a0, a1, a2);
+  _glewProfileEnd(1618, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMinmaxParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMINMAXPARAMETERIVEXTPROC)_glewProfileTargets[1619])(a0, a1, a2);
+  _glewProfileEnd(1619, t);
+}
+
+static void GLAPIENTRY _glewProfile_glHistogramEXT (GLenum a0, GLsizei a1, GLenum a2, GLboolean a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLHISTOGRAMEXTPROC)_glewProfileTargets[1620])(a0, a1, a2, a3);
+  _glewProfileEnd(1620, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMinmaxEXT (GLenum a0, GLenum a1, GLboolean a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMINMAXEXTPROC)_glewProfileTargets[1621])(a0, a1, a2);
+  _glewProfileEnd(1621, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResetHistogramEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESETHISTOGRAMEXTPROC)_glewProfileTargets[1622])(a0);
+  _glewProfileEnd(1622, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResetMinmaxEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESETMINMAXEXTPROC)_glewProfileTargets[1623])(a0);
+  _glewProfileEnd(1623, t);
+}
+
+static void GLAPIENTRY _glewProfile_glIndexFuncEXT (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINDEXFUNCEXTPROC)_glewProfileTargets[1624])(a0, a1);
+  _glewProfileEnd(1624, t);
+}
+
+static void GLAPIENTRY _glewProfile_glIndexMaterialEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINDEXMATERIALEXTPROC)_glewProfileTargets[1625])(a0, a1);
+  _glewProfileEnd(1625, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribDivisorEXT (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBDIVISOREXTPROC)_glewProfileTargets[1626])(a0, a1);
+  _glewProfileEnd(1626, t);
+}
+
+static void GLAPIENTRY _glewProfile_glApplyTextureEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLAPPLYTEXTUREEXTPROC)_glewProfileTargets[1627])(a0);
+  _glewProfileEnd(1627, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureLightEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURELIGHTEXTPROC)_glewProfileTargets[1628])(a0);
+  _glewProfileEnd(1628, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureMaterialEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREMATERIALEXTPROC)_glewProfileTargets[1629])(a0, a1);
+  _glewProfileEnd(1629, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFlushMappedBufferRangeEXT (GLenum a0, GLintptr a1, GLsizeiptr a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC)_glewProfileTargets[1630])(a0, a1, a2);
+  _glewProfileEnd(1630, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapBufferRangeEXT (GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPBUFFERRANGEEXTPROC)_glewProfileTargets[1631])(a0, a1, a2, a3);
+  _glewProfileEnd(1631, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBufferStorageMemEXT (GLenum a0, GLsizeiptr a1, GLuint a2, GLuint64 a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERSTORAGEMEMEXTPROC)_glewProfileTargets[1632])(a0, a1, a2, a3);
+  _glewProfileEnd(1632, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateMemoryObjectsEXT (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEMEMORYOBJECTSEXTPROC)_glewProfileTargets[1633])(a0, a1);
+  _glewProfileEnd(1633, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteMemoryObjectsEXT (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEMEMORYOBJECTSEXTPROC)_glewProfileTargets[1634])(a0, a1);
+  _glewProfileEnd(1634, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMemoryObjectParameterivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)_glewProfileTargets[1635])(a0, a1, a2);
+  _glewProfileEnd(1635, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUnsignedBytei_vEXT (GLenum a0, GLuint a1, GLubyte* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNSIGNEDBYTEI_VEXTPROC)_glewProfileTargets[1636])(a0, a1, a2);
+  _glewProfileEnd(1636, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUnsignedBytevEXT (GLenum a0, GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNSIGNEDBYTEVEXTPROC)_glewProfileTargets[1637])(a0, a1);
+  _glewProfileEnd(1637, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsMemoryObjectEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISMEMORYOBJECTEXTPROC)_glewProfileTargets[1638])(a0);
+  _glewProfileEnd(1638, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMemoryObjectParameterivEXT (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMEMORYOBJECTPARAMETERIVEXTPROC)_glewProfileTargets[1639])(a0, a1, a2);
+  _glewProfileEnd(1639, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferStorageMemEXT (GLuint a0, GLsizeiptr a1, GLuint a2, GLuint64 a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)_glewProfileTargets[1640])(a0, a1, a2, a3);
+  _glewProfileEnd(1640, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorageMem1DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLuint a4, GLuint64 a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGEMEM1DEXTPROC)_glewProfileTargets[1641])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1641, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorageMem2DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLuint a5, GLuint64 a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGEMEM2DEXTPROC)_glewProfileTargets[1642])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1642, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorageMem2DMultisampleEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5, GLuint a6, GLuint64 a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)_glewProfileTargets[1643])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1643, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorageMem3DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLuint a6, GLuint64 a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGEMEM3DEXTPROC)_glewProfileTargets[1644])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1644, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorageMem3DMultisampleEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6, GLuint a7, GLuint64 a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)_glewProfileTargets[1645])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1645, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorageMem1DEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLuint a4, GLuint64 a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGEMEM1DEXTPROC)_glewProfileTargets[1646])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1646, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorageMem2DEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLuint a5, GLuint64 a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGEMEM2DEXTPROC)_glewProfileTargets[1647])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1647, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorageMem2DMultisampleEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5, GLuint a6, GLuint64 a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)_glewProfileTargets[1648])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1648, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorageMem3DEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLuint a6, GLuint64 a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGEMEM3DEXTPROC)_glewProfileTargets[1649])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1649, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorageMem3DMultisampleEXT (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6, GLuint a7, GLuint64 a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)_glewProfileTargets[1650])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1650, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImportMemoryFdEXT (GLuint a0, GLuint64 a1, GLenum a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMPORTMEMORYFDEXTPROC)_glewProfileTargets[1651])(a0, a1, a2, a3);
+  _glewProfileEnd(1651, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImportMemoryWin32HandleEXT (GLuint a0, GLuint64 a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)_glewProfileTargets[1652])(a0, a1, a2, a3);
+  _glewProfileEnd(1652, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImportMemoryWin32NameEXT (GLuint a0, GLuint64 a1, GLenum a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMPORTMEMORYWIN32NAMEEXTPROC)_glewProfileTargets[1653])(a0, a1, a2, a3);
+  _glewProfileEnd(1653, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysEXT (GLenum a0, const GLint* a1, const GLsizei * a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSEXTPROC)_glewProfileTargets[1654])(a0, a1, a2, a3);
+  _glewProfileEnd(1654, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsEXT (GLenum a0, GLsizei* a1, GLenum a2, const void *const * a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSEXTPROC)_glewProfileTargets[1655])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1655, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirectEXT (GLenum a0, const void * a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC)_glewProfileTargets[1656])(a0, a1, a2, a3);
+  _glewProfileEnd(1656, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirectEXT (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC)_glewProfileTargets[1657])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1657, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleMaskEXT (GLclampf a0, GLboolean a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEMASKEXTPROC)_glewProfileTargets[1658])(a0, a1);
+  _glewProfileEnd(1658, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplePatternEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEPATTERNEXTPROC)_glewProfileTargets[1659])(a0);
+  _glewProfileEnd(1659, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture2DMultisampleEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC)_glewProfileTargets[1660])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1660, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBuffersIndexedEXT (GLint a0, const GLenum* a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERSINDEXEDEXTPROC)_glewProfileTargets[1661])(a0, a1, a2);
+  _glewProfileEnd(1661, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetIntegeri_vEXT (GLenum a0, GLuint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGERI_VEXTPROC)_glewProfileTargets[1662])(a0, a1, a2);
+  _glewProfileEnd(1662, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReadBufferIndexedEXT (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADBUFFERINDEXEDEXTPROC)_glewProfileTargets[1663])(a0, a1);
+  _glewProfileEnd(1663, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTableEXT (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLEEXTPROC)_glewProfileTargets[1664])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1664, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableEXT (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEEXTPROC)_glewProfileTargets[1665])(a0, a1, a2, a3);
+  _glewProfileEnd(1665, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableParameterfvEXT (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPARAMETERFVEXTPROC)_glewProfileTargets[1666])(a0, a1, a2);
+  _glewProfileEnd(1666, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableParameterivEXT (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPARAMETERIVEXTPROC)_glewProfileTargets[1667])(a0, a1, a2);
+  _glewProfileEnd(1667, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPixelTransformParameterfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)_glewProfileTargets[1668])(a0, a1, a2);
+  _glewProfileEnd(1668, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPixelTransformParameterivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)_glewProfileTargets[1669])(a0, a1, a2);
+  _glewProfileEnd(1669, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameterfEXT (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERFEXTPROC)_glewProfileTargets[1670])(a0, a1, a2);
+  _glewProfileEnd(1670, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameterfvEXT (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)_glewProfileTargets[1671])(a0, a1, a2);
+  _glewProfileEnd(1671, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameteriEXT (GLenum a0, GLenum a1, const GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERIEXTPROC)_glewProfileTargets[1672])(a0, a1, a2);
+  _glewProfileEnd(1672, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameterivEXT (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)_glewProfileTargets[1673])(a0, a1, a2);
+  _glewProfileEnd(1673, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterfEXT (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERFEXTPROC)_glewProfileTargets[1674])(a0, a1);
+  _glewProfileEnd(1674, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterfvEXT (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERFVEXTPROC)_glewProfileTargets[1675])(a0, a1);
+  _glewProfileEnd(1675, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPolygonOffsetEXT (GLfloat a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOLYGONOFFSETEXTPROC)_glewProfileTargets[1676])(a0, a1);
+  _glewProfileEnd(1676, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPolygonOffsetClampEXT (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOLYGONOFFSETCLAMPEXTPROC)_glewProfileTargets[1677])(a0, a1, a2);
+  _glewProfileEnd(1677, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPrimitiveBoundingBoxEXT (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIMITIVEBOUNDINGBOXEXTPROC)_glewProfileTargets[1678])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1678, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProvokingVertexEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROVOKINGVERTEXEXTPROC)_glewProfileTargets[1679])(a0);
+  _glewProfileEnd(1679, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCoverageModulationNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOVERAGEMODULATIONNVPROC)_glewProfileTargets[1680])(a0);
+  _glewProfileEnd(1680, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCoverageModulationTableNV (GLsizei a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOVERAGEMODULATIONTABLENVPROC)_glewProfileTargets[1681])(a0, a1);
+  _glewProfileEnd(1681, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCoverageModulationTableNV (GLsizei a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOVERAGEMODULATIONTABLENVPROC)_glewProfileTargets[1682])(a0, a1);
+  _glewProfileEnd(1682, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRasterSamplesEXT (GLuint a0, GLboolean a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRASTERSAMPLESEXTPROC)_glewProfileTargets[1683])(a0, a1);
+  _glewProfileEnd(1683, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformfvEXT (GLuint a0, GLint a1, GLsizei a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMFVEXTPROC)_glewProfileTargets[1684])(a0, a1, a2, a3);
+  _glewProfileEnd(1684, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformivEXT (GLuint a0, GLint a1, GLsizei a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMIVEXTPROC)_glewProfileTargets[1685])(a0, a1, a2, a3);
+  _glewProfileEnd(1685, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReadnPixelsEXT (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADNPIXELSEXTPROC)_glewProfileTargets[1686])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1686, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginSceneEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINSCENEEXTPROC)_glewProfileTargets[1687])();
+  _glewProfileEnd(1687, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndSceneEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDSCENEEXTPROC)_glewProfileTargets[1688])();
+  _glewProfileEnd(1688, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3bEXT (GLbyte a0, GLbyte a1, GLbyte a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3BEXTPROC)_glewProfileTargets[1689])(a0, a1, a2);
+  _glewProfileEnd(1689, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3bvEXT (const GLbyte * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3BVEXTPROC)_glewProfileTargets[1690])(a0);
+  _glewProfileEnd(1690, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3dEXT (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3DEXTPROC)_glewProfileTargets[1691])(a0, a1, a2);
+  _glewProfileEnd(1691, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3dvEXT (const GLdouble * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3DVEXTPROC)_glewProfileTargets[1692])(a0);
+  _glewProfileEnd(1692, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3fEXT (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3FEXTPROC)_glewProfileTargets[1693])(a0, a1, a2);
+  _glewProfileEnd(1693, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3fvEXT (const GLfloat * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3FVEXTPROC)_glewProfileTargets[1694])(a0);
+  _glewProfileEnd(1694, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3iEXT (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3IEXTPROC)_glewProfileTargets[1695])(a0, a1, a2);
+  _glewProfileEnd(1695, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3ivEXT (const GLint * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3IVEXTPROC)_glewProfileTargets[1696])(a0);
+  _glewProfileEnd(1696, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3sEXT (GLshort a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3SEXTPROC)_glewProfileTargets[1697])(a0, a1, a2);
+  _glewProfileEnd(1697, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3svEXT (const GLshort * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3SVEXTPROC)_glewProfileTargets[1698])(a0);
+  _glewProfileEnd(1698, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3ubEXT (GLubyte a0, GLubyte a1, GLubyte a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UBEXTPROC)_glewProfileTargets[1699])(a0, a1, a2);
+  _glewProfileEnd(1699, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3ubvEXT (const GLubyte * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UBVEXTPROC)_glewProfileTargets[1700])(a0);
+  _glewProfileEnd(1700, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3uiEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UIEXTPROC)_glewProfileTargets[1701])(a0, a1, a2);
+  _glewProfileEnd(1701, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3uivEXT (const GLuint * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3UIVEXTPROC)_glewProfileTargets[1702])(a0);
+  _glewProfileEnd(1702, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3usEXT (GLushort a0, GLushort a1, GLushort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3USEXTPROC)_glewProfileTargets[1703])(a0, a1, a2);
+  _glewProfileEnd(1703, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3usvEXT (const GLushort * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3USVEXTPROC)_glewProfileTargets[1704])(a0);
+  _glewProfileEnd(1704, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColorPointerEXT (GLint a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLORPOINTEREXTPROC)_glewProfileTargets[1705])(a0, a1, a2, a3);
+  _glewProfileEnd(1705, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteSemaphoresEXT (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETESEMAPHORESEXTPROC)_glewProfileTargets[1706])(a0, a1);
+  _glewProfileEnd(1706, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenSemaphoresEXT (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENSEMAPHORESEXTPROC)_glewProfileTargets[1707])(a0, a1);
+  _glewProfileEnd(1707, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSemaphoreParameterui64vEXT (GLuint a0, GLenum a1, GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)_glewProfileTargets[1708])(a0, a1, a2);
+  _glewProfileEnd(1708, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsSemaphoreEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSEMAPHOREEXTPROC)_glewProfileTargets[1709])(a0);
+  _glewProfileEnd(1709, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSemaphoreParameterui64vEXT (GLuint a0, GLenum a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSEMAPHOREPARAMETERUI64VEXTPROC)_glewProfileTargets[1710])(a0, a1, a2);
+  _glewProfileEnd(1710, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSignalSemaphoreEXT (GLuint a0, GLuint a1, const GLuint* a2, GLuint a3, const GLuint * a4, const GLenum * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSIGNALSEMAPHOREEXTPROC)_glewProfileTargets[1711])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1711, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWaitSemaphoreEXT (GLuint a0, GLuint a1, const GLuint* a2, GLuint a3, const GLuint * a4, const GLenum * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWAITSEMAPHOREEXTPROC)_glewProfileTargets[1712])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1712, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImportSemaphoreFdEXT (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMPORTSEMAPHOREFDEXTPROC)_glewProfileTargets[1713])(a0, a1, a2);
+  _glewProfileEnd(1713, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImportSemaphoreWin32HandleEXT (GLuint a0, GLenum a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)_glewProfileTargets[1714])(a0, a1, a2);
+  _glewProfileEnd(1714, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImportSemaphoreWin32NameEXT (GLuint a0, GLenum a1, const void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)_glewProfileTargets[1715])(a0, a1, a2);
+  _glewProfileEnd(1715, t);
+}
+
+static void GLAPIENTRY _glewProfile_glActiveProgramEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLACTIVEPROGRAMEXTPROC)_glewProfileTargets[1716])(a0);
+  _glewProfileEnd(1716, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glCreateShaderProgramEXT (GLenum a0, const GLchar* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLCREATESHADERPROGRAMEXTPROC)_glewProfileTargets[1717])(a0, a1);
+  _glewProfileEnd(1717, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glUseShaderProgramEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUSESHADERPROGRAMEXTPROC)_glewProfileTargets[1718])(a0, a1);
+  _glewProfileEnd(1718, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferFetchBarrierEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC)_glewProfileTargets[1719])();
+  _glewProfileEnd(1719, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindImageTextureEXT (GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDIMAGETEXTUREEXTPROC)_glewProfileTargets[1720])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1720, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMemoryBarrierEXT (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMEMORYBARRIEREXTPROC)_glewProfileTargets[1721])(a0);
+  _glewProfileEnd(1721, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearPixelLocalStorageuiEXT (GLsizei a0, GLsizei a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARPIXELLOCALSTORAGEUIEXTPROC)_glewProfileTargets[1722])(a0, a1, a2);
+  _glewProfileEnd(1722, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferPixelLocalStorageSizeEXT (GLuint a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC)_glewProfileTargets[1723])(a0, a1);
+  _glewProfileEnd(1723, t);
+}
+
+static GLsizei GLAPIENTRY _glewProfile_glGetFramebufferPixelLocalStorageSizeEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLsizei r = ((PFNGLGETFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC)_glewProfileTargets[1724])(a0);
+  _glewProfileEnd(1724, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glTexPageCommitmentEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPAGECOMMITMENTEXTPROC)_glewProfileTargets[1725])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1725, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexturePageCommitmentEXT (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREPAGECOMMITMENTEXTPROC)_glewProfileTargets[1726])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1726, t);
+}
+
+static void GLAPIENTRY _glewProfile_glActiveStencilFaceEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLACTIVESTENCILFACEEXTPROC)_glewProfileTargets[1727])(a0);
+  _glewProfileEnd(1727, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage1DEXT (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE1DEXTPROC)_glewProfileTargets[1728])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1728, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage2DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE2DEXTPROC)_glewProfileTargets[1729])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(1729, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage3DEXT (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE3DEXTPROC)_glewProfileTargets[1730])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(1730, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPatchParameteriEXT (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATCHPARAMETERIEXTPROC)_glewProfileTargets[1731])(a0, a1);
+  _glewProfileEnd(1731, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage3DEXT (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE3DEXTPROC)_glewProfileTargets[1732])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(1732, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureLayerEXT (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)_glewProfileTargets[1733])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1733, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterIivEXT (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIIVEXTPROC)_glewProfileTargets[1734])(a0, a1, a2);
+  _glewProfileEnd(1734, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterIuivEXT (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIUIVEXTPROC)_glewProfileTargets[1735])(a0, a1, a2);
+  _glewProfileEnd(1735, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterIivEXT (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIIVEXTPROC)_glewProfileTargets[1736])(a0, a1, a2);
+  _glewProfileEnd(1736, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterIuivEXT (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIUIVEXTPROC)_glewProfileTargets[1737])(a0, a1, a2);
+  _glewProfileEnd(1737, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBufferEXT (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUFFEREXTPROC)_glewProfileTargets[1738])(a0, a1, a2);
+  _glewProfileEnd(1738, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearColorIiEXT (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARCOLORIIEXTPROC)_glewProfileTargets[1739])(a0, a1, a2, a3);
+  _glewProfileEnd(1739, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearColorIuiEXT (GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARCOLORIUIEXTPROC)_glewProfileTargets[1740])(a0, a1, a2, a3);
+  _glewProfileEnd(1740, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterIivEXT (GLenum a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERIIVEXTPROC)_glewProfileTargets[1741])(a0, a1, a2);
+  _glewProfileEnd(1741, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterIuivEXT (GLenum a0, GLenum a1, GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERIUIVEXTPROC)_glewProfileTargets[1742])(a0, a1, a2);
+  _glewProfileEnd(1742, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterIivEXT (GLenum a0, GLenum a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERIIVEXTPROC)_glewProfileTargets[1743])(a0, a1, a2);
+  _glewProfileEnd(1743, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterIuivEXT (GLenum a0, GLenum a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERIUIVEXTPROC)_glewProfileTargets[1744])(a0, a1, a2);
+  _glewProfileEnd(1744, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glAreTexturesResidentEXT (GLsizei a0, const GLuint* a1, GLboolean* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLARETEXTURESRESIDENTEXTPROC)_glewProfileTargets[1745])(a0, a1, a2);
+  _glewProfileEnd(1745, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindTextureEXT (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDTEXTUREEXTPROC)_glewProfileTargets[1746])(a0, a1);
+  _glewProfileEnd(1746, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteTexturesEXT (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETETEXTURESEXTPROC)_glewProfileTargets[1747])(a0, a1);
+  _glewProfileEnd(1747, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenTexturesEXT (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENTEXTURESEXTPROC)_glewProfileTargets[1748])(a0, a1);
+  _glewProfileEnd(1748, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsTextureEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISTEXTUREEXTPROC)_glewProfileTargets[1749])(a0);
+  _glewProfileEnd(1749, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPrioritizeTexturesEXT (GLsizei a0, const GLuint* a1, const GLclampf* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIORITIZETEXTURESEXTPROC)_glewProfileTargets[1750])(a0, a1, a2);
+  _glewProfileEnd(1750, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureNormalEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURENORMALEXTPROC)_glewProfileTargets[1751])(a0);
+  _glewProfileEnd(1751, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage1DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE1DEXTPROC)_glewProfileTargets[1752])(a0, a1, a2, a3);
+  _glewProfileEnd(1752, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage2DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE2DEXTPROC)_glewProfileTargets[1753])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1753, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage3DEXT (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE3DEXTPROC)_glewProfileTargets[1754])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1754, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage1DEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE1DEXTPROC)_glewProfileTargets[1755])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1755, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage2DEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE2DEXTPROC)_glewProfileTargets[1756])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1756, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureStorage3DEXT (GLuint a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5, GLsizei a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTURESTORAGE3DEXTPROC)_glewProfileTargets[1757])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1757, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureViewEXT (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREVIEWEXTPROC)_glewProfileTargets[1758])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1758, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjecti64vEXT (GLuint a0, GLenum a1, GLint64EXT * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTI64VEXTPROC)_glewProfileTargets[1759])(a0, a1, a2);
+  _glewProfileEnd(1759, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetQueryObjectui64vEXT (GLuint a0, GLenum a1, GLuint64EXT * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETQUERYOBJECTUI64VEXTPROC)_glewProfileTargets[1760])(a0, a1, a2);
+  _glewProfileEnd(1760, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginTransformFeedbackEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINTRANSFORMFEEDBACKEXTPROC)_glewProfileTargets[1761])(a0);
+  _glewProfileEnd(1761, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferBaseEXT (GLenum a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERBASEEXTPROC)_glewProfileTargets[1762])(a0, a1, a2);
+  _glewProfileEnd(1762, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferOffsetEXT (GLenum a0, GLuint a1, GLuint a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFEROFFSETEXTPROC)_glewProfileTargets[1763])(a0, a1, a2, a3);
+  _glewProfileEnd(1763, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferRangeEXT (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERRANGEEXTPROC)_glewProfileTargets[1764])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1764, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndTransformFeedbackEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDTRANSFORMFEEDBACKEXTPROC)_glewProfileTargets[1765])();
+  _glewProfileEnd(1765, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTransformFeedbackVaryingEXT (GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLsizei * a4, GLenum * a5, GLchar * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)_glewProfileTargets[1766])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1766, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTransformFeedbackVaryingsEXT (GLuint a0, GLsizei a1, const GLchar * const* a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)_glewProfileTargets[1767])(a0, a1, a2, a3);
+  _glewProfileEnd(1767, t);
+}
+
+static void GLAPIENTRY _glewProfile_glArrayElementEXT (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLARRAYELEMENTEXTPROC)_glewProfileTargets[1768])(a0);
+  _glewProfileEnd(1768, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorPointerEXT (GLint a0, GLenum a1, GLsizei a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORPOINTEREXTPROC)_glewProfileTargets[1769])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1769, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysEXT (GLenum a0, GLint a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSEXTPROC)_glewProfileTargets[1770])(a0, a1, a2);
+  _glewProfileEnd(1770, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEdgeFlagPointerEXT (GLsizei a0, GLsizei a1, const GLboolean* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEDGEFLAGPOINTEREXTPROC)_glewProfileTargets[1771])(a0, a1, a2);
+  _glewProfileEnd(1771, t);
+}
+
+static void GLAPIENTRY _glewProfile_glIndexPointerEXT (GLenum a0, GLsizei a1, GLsizei a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINDEXPOINTEREXTPROC)_glewProfileTargets[1772])(a0, a1, a2, a3);
+  _glewProfileEnd(1772, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalPointerEXT (GLenum a0, GLsizei a1, GLsizei a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALPOINTEREXTPROC)_glewProfileTargets[1773])(a0, a1, a2, a3);
+  _glewProfileEnd(1773, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordPointerEXT (GLint a0, GLenum a1, GLsizei a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDPOINTEREXTPROC)_glewProfileTargets[1774])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1774, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexPointerEXT (GLint a0, GLenum a1, GLsizei a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXPOINTEREXTPROC)_glewProfileTargets[1775])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1775, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindArraySetEXT (const void * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDARRAYSETEXTPROC)_glewProfileTargets[1776])(a0);
+  _glewProfileEnd(1776, t);
+}
+
+static const void * GLAPIENTRY _glewProfile_glCreateArraySetExt (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  const void * r = ((PFNGLCREATEARRAYSETEXTPROC)_glewProfileTargets[1777])();
+  _glewProfileEnd(1777, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteArraySetsEXT (GLsizei a0, const void * a1[])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEARRAYSETSEXTPROC)_glewProfileTargets[1778])(a0, a1);
+  _glewProfileEnd(1778, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribLdvEXT (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBLDVEXTPROC)_glewProfileTargets[1779])(a0, a1, a2);
+  _glewProfileEnd(1779, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayVertexAttribLOffsetEXT (GLuint a0, GLuint a1, GLuint a2, GLint a3, GLenum a4, GLsizei a5, GLintptr a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)_glewProfileTargets[1780])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1780, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1dEXT (GLuint a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1DEXTPROC)_glewProfileTargets[1781])(a0, a1);
+  _glewProfileEnd(1781, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1dvEXT (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1DVEXTPROC)_glewProfileTargets[1782])(a0, a1);
+  _glewProfileEnd(1782, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2dEXT (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2DEXTPROC)_glewProfileTargets[1783])(a0, a1, a2);
+  _glewProfileEnd(1783, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2dvEXT (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2DVEXTPROC)_glewProfileTargets[1784])(a0, a1);
+  _glewProfileEnd(1784, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3dEXT (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3DEXTPROC)_glewProfileTargets[1785])(a0, a1, a2, a3);
+  _glewProfileEnd(1785, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3dvEXT (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3DVEXTPROC)_glewProfileTargets[1786])(a0, a1);
+  _glewProfileEnd(1786, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4dEXT (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4DEXTPROC)_glewProfileTargets[1787])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1787, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4dvEXT (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4DVEXTPROC)_glewProfileTargets[1788])(a0, a1);
+  _glewProfileEnd(1788, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribLPointerEXT (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBLPOINTEREXTPROC)_glewProfileTargets[1789])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1789, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginVertexShaderEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINVERTEXSHADEREXTPROC)_glewProfileTargets[1790])();
+  _glewProfileEnd(1790, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glBindLightParameterEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLBINDLIGHTPARAMETEREXTPROC)_glewProfileTargets[1791])(a0, a1);
+  _glewProfileEnd(1791, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glBindMaterialParameterEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLBINDMATERIALPARAMETEREXTPROC)_glewProfileTargets[1792])(a0, a1);
+  _glewProfileEnd(1792, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glBindParameterEXT (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLBINDPARAMETEREXTPROC)_glewProfileTargets[1793])(a0);
+  _glewProfileEnd(1793, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glBindTexGenParameterEXT (GLenum a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLBINDTEXGENPARAMETEREXTPROC)_glewProfileTargets[1794])(a0, a1, a2);
+  _glewProfileEnd(1794, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glBindTextureUnitParameterEXT (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLBINDTEXTUREUNITPARAMETEREXTPROC)_glewProfileTargets[1795])(a0, a1);
+  _glewProfileEnd(1795, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexShaderEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXSHADEREXTPROC)_glewProfileTargets[1796])(a0);
+  _glewProfileEnd(1796, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteVertexShaderEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEVERTEXSHADEREXTPROC)_glewProfileTargets[1797])(a0);
+  _glewProfileEnd(1797, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableVariantClientStateEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)_glewProfileTargets[1798])(a0);
+  _glewProfileEnd(1798, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableVariantClientStateEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEVARIANTCLIENTSTATEEXTPROC)_glewProfileTargets[1799])(a0);
+  _glewProfileEnd(1799, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndVertexShaderEXT (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDVERTEXSHADEREXTPROC)_glewProfileTargets[1800])();
+  _glewProfileEnd(1800, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtractComponentEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTRACTCOMPONENTEXTPROC)_glewProfileTargets[1801])(a0, a1, a2);
+  _glewProfileEnd(1801, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGenSymbolsEXT (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGENSYMBOLSEXTPROC)_glewProfileTargets[1802])(a0, a1, a2, a3);
+  _glewProfileEnd(1802, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGenVertexShadersEXT (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGENVERTEXSHADERSEXTPROC)_glewProfileTargets[1803])(a0);
+  _glewProfileEnd(1803, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetInvariantBooleanvEXT (GLuint a0, GLenum a1, GLboolean * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINVARIANTBOOLEANVEXTPROC)_glewProfileTargets[1804])(a0, a1, a2);
+  _glewProfileEnd(1804, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInvariantFloatvEXT (GLuint a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINVARIANTFLOATVEXTPROC)_glewProfileTargets[1805])(a0, a1, a2);
+  _glewProfileEnd(1805, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInvariantIntegervEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINVARIANTINTEGERVEXTPROC)_glewProfileTargets[1806])(a0, a1, a2);
+  _glewProfileEnd(1806, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetLocalConstantBooleanvEXT (GLuint a0, GLenum a1, GLboolean * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)_glewProfileTargets[1807])(a0, a1, a2);
+  _glewProfileEnd(1807, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetLocalConstantFloatvEXT (GLuint a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETLOCALCONSTANTFLOATVEXTPROC)_glewProfileTargets[1808])(a0, a1, a2);
+  _glewProfileEnd(1808, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetLocalConstantIntegervEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETLOCALCONSTANTINTEGERVEXTPROC)_glewProfileTargets[1809])(a0, a1, a2);
+  _glewProfileEnd(1809, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVariantBooleanvEXT (GLuint a0, GLenum a1, GLboolean * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVARIANTBOOLEANVEXTPROC)_glewProfileTargets[1810])(a0, a1, a2);
+  _glewProfileEnd(1810, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVariantFloatvEXT (GLuint a0, GLenum a1, GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVARIANTFLOATVEXTPROC)_glewProfileTargets[1811])(a0, a1, a2);
+  _glewProfileEnd(1811, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVariantIntegervEXT (GLuint a0, GLenum a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVARIANTINTEGERVEXTPROC)_glewProfileTargets[1812])(a0, a1, a2);
+  _glewProfileEnd(1812, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVariantPointervEXT (GLuint a0, GLenum a1, void ** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVARIANTPOINTERVEXTPROC)_glewProfileTargets[1813])(a0, a1, a2);
+  _glewProfileEnd(1813, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInsertComponentEXT (GLuint a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINSERTCOMPONENTEXTPROC)_glewProfileTargets[1814])(a0, a1, a2);
+  _glewProfileEnd(1814, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsVariantEnabledEXT (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISVARIANTENABLEDEXTPROC)_glewProfileTargets[1815])(a0, a1);
+  _glewProfileEnd(1815, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSetInvariantEXT (GLuint a0, GLenum a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSETINVARIANTEXTPROC)_glewProfileTargets[1816])(a0, a1, a2);
+  _glewProfileEnd(1816, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSetLocalConstantEXT (GLuint a0, GLenum a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSETLOCALCONSTANTEXTPROC)_glewProfileTargets[1817])(a0, a1, a2);
+  _glewProfileEnd(1817, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderOp1EXT (GLenum a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADEROP1EXTPROC)_glewProfileTargets[1818])(a0, a1, a2);
+  _glewProfileEnd(1818, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderOp2EXT (GLenum a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADEROP2EXTPROC)_glewProfileTargets[1819])(a0, a1, a2, a3);
+  _glewProfileEnd(1819, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShaderOp3EXT (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADEROP3EXTPROC)_glewProfileTargets[1820])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1820, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSwizzleEXT (GLuint a0, GLuint a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSWIZZLEEXTPROC)_glewProfileTargets[1821])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1821, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantPointerEXT (GLuint a0, GLenum a1, GLuint a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTPOINTEREXTPROC)_glewProfileTargets[1822])(a0, a1, a2, a3);
+  _glewProfileEnd(1822, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantbvEXT (GLuint a0, GLbyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTBVEXTPROC)_glewProfileTargets[1823])(a0, a1);
+  _glewProfileEnd(1823, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantdvEXT (GLuint a0, GLdouble * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTDVEXTPROC)_glewProfileTargets[1824])(a0, a1);
+  _glewProfileEnd(1824, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantfvEXT (GLuint a0, GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTFVEXTPROC)_glewProfileTargets[1825])(a0, a1);
+  _glewProfileEnd(1825, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantivEXT (GLuint a0, GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTIVEXTPROC)_glewProfileTargets[1826])(a0, a1);
+  _glewProfileEnd(1826, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantsvEXT (GLuint a0, GLshort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTSVEXTPROC)_glewProfileTargets[1827])(a0, a1);
+  _glewProfileEnd(1827, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantubvEXT (GLuint a0, GLubyte * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTUBVEXTPROC)_glewProfileTargets[1828])(a0, a1);
+  _glewProfileEnd(1828, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantuivEXT (GLuint a0, GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTUIVEXTPROC)_glewProfileTargets[1829])(a0, a1);
+  _glewProfileEnd(1829, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVariantusvEXT (GLuint a0, GLushort * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVARIANTUSVEXTPROC)_glewProfileTargets[1830])(a0, a1);
+  _glewProfileEnd(1830, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWriteMaskEXT (GLuint a0, GLuint a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWRITEMASKEXTPROC)_glewProfileTargets[1831])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1831, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexWeightPointerEXT (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXWEIGHTPOINTEREXTPROC)_glewProfileTargets[1832])(a0, a1, a2, a3);
+  _glewProfileEnd(1832, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexWeightfEXT (GLfloat a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXWEIGHTFEXTPROC)_glewProfileTargets[1833])(a0);
+  _glewProfileEnd(1833, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexWeightfvEXT (GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXWEIGHTFVEXTPROC)_glewProfileTargets[1834])(a0);
+  _glewProfileEnd(1834, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glAcquireKeyedMutexWin32EXT (GLuint a0, GLuint64 a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)_glewProfileTargets[1835])(a0, a1, a2);
+  _glewProfileEnd(1835, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glReleaseKeyedMutexWin32EXT (GLuint a0, GLuint64 a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)_glewProfileTargets[1836])(a0, a1);
+  _glewProfileEnd(1836, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glWindowRectanglesEXT (GLenum a0, GLsizei a1, const GLint a2[])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWRECTANGLESEXTPROC)_glewProfileTargets[1837])(a0, a1, a2);
+  _glewProfileEnd(1837, t);
+}
+
+static GLsync GLAPIENTRY _glewProfile_glImportSyncEXT (GLenum a0, GLintptr a1, GLbitfield a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLsync r = ((PFNGLIMPORTSYNCEXTPROC)_glewProfileTargets[1838])(a0, a1, a2);
+  _glewProfileEnd(1838, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFrameTerminatorGREMEDY (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMETERMINATORGREMEDYPROC)_glewProfileTargets[1839])();
+  _glewProfileEnd(1839, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStringMarkerGREMEDY (GLsizei a0, const void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTRINGMARKERGREMEDYPROC)_glewProfileTargets[1840])(a0, a1);
+  _glewProfileEnd(1840, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetImageTransformParameterfvHP (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)_glewProfileTargets[1841])(a0, a1, a2);
+  _glewProfileEnd(1841, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetImageTransformParameterivHP (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)_glewProfileTargets[1842])(a0, a1, a2);
+  _glewProfileEnd(1842, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImageTransformParameterfHP (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMAGETRANSFORMPARAMETERFHPPROC)_glewProfileTargets[1843])(a0, a1, a2);
+  _glewProfileEnd(1843, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImageTransformParameterfvHP (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMAGETRANSFORMPARAMETERFVHPPROC)_glewProfileTargets[1844])(a0, a1, a2);
+  _glewProfileEnd(1844, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImageTransformParameteriHP (GLenum a0, GLenum a1, const GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMAGETRANSFORMPARAMETERIHPPROC)_glewProfileTargets[1845])(a0, a1, a2);
+  _glewProfileEnd(1845, t);
+}
+
+static void GLAPIENTRY _glewProfile_glImageTransformParameterivHP (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIMAGETRANSFORMPARAMETERIVHPPROC)_glewProfileTargets[1846])(a0, a1, a2);
+  _glewProfileEnd(1846, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiModeDrawArraysIBM (const GLenum* a0, const GLint * a1, const GLsizei * a2, GLsizei a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIMODEDRAWARRAYSIBMPROC)_glewProfileTargets[1847])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1847, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiModeDrawElementsIBM (const GLenum* a0, const GLsizei * a1, GLenum a2, const void *const * a3, GLsizei a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIMODEDRAWELEMENTSIBMPROC)_glewProfileTargets[1848])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1848, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORPOINTERLISTIBMPROC)_glewProfileTargets[1849])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1849, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEdgeFlagPointerListIBM (GLint a0, const GLboolean ** a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEDGEFLAGPOINTERLISTIBMPROC)_glewProfileTargets[1850])(a0, a1, a2);
+  _glewProfileEnd(1850, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordPointerListIBM (GLenum a0, GLint a1, const void** a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDPOINTERLISTIBMPROC)_glewProfileTargets[1851])(a0, a1, a2, a3);
+  _glewProfileEnd(1851, t);
+}
+
+static void GLAPIENTRY _glewProfile_glIndexPointerListIBM (GLenum a0, GLint a1, const void** a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINDEXPOINTERLISTIBMPROC)_glewProfileTargets[1852])(a0, a1, a2, a3);
+  _glewProfileEnd(1852, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalPointerListIBM (GLenum a0, GLint a1, const void** a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALPOINTERLISTIBMPROC)_glewProfileTargets[1853])(a0, a1, a2, a3);
+  _glewProfileEnd(1853, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColorPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLORPOINTERLISTIBMPROC)_glewProfileTargets[1854])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1854, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDPOINTERLISTIBMPROC)_glewProfileTargets[1855])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1855, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexPointerListIBM (GLint a0, GLenum a1, GLint a2, const void** a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXPOINTERLISTIBMPROC)_glewProfileTargets[1856])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1856, t);
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetTextureHandleIMG (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETTEXTUREHANDLEIMGPROC)_glewProfileTargets[1857])(a0);
+  _glewProfileEnd(1857, t);
+  return r;
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetTextureSamplerHandleIMG (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETTEXTURESAMPLERHANDLEIMGPROC)_glewProfileTargets[1858])(a0, a1);
+  _glewProfileEnd(1858, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformHandleui64IMG (GLuint a0, GLint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMHANDLEUI64IMGPROC)_glewProfileTargets[1859])(a0, a1, a2);
+  _glewProfileEnd(1859, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformHandleui64vIMG (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMHANDLEUI64VIMGPROC)_glewProfileTargets[1860])(a0, a1, a2, a3);
+  _glewProfileEnd(1860, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformHandleui64IMG (GLint a0, GLuint64 a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMHANDLEUI64IMGPROC)_glewProfileTargets[1861])(a0, a1);
+  _glewProfileEnd(1861, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformHandleui64vIMG (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMHANDLEUI64VIMGPROC)_glewProfileTargets[1862])(a0, a1, a2);
+  _glewProfileEnd(1862, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture2DDownsampleIMG (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE2DDOWNSAMPLEIMGPROC)_glewProfileTargets[1863])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1863, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureLayerDownsampleIMG (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLint a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURELAYERDOWNSAMPLEIMGPROC)_glewProfileTargets[1864])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1864, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture2DMultisampleIMG (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEIMGPROC)_glewProfileTargets[1865])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1865, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleIMG (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEIMGPROC)_glewProfileTargets[1866])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1866, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapTexture2DINTEL (GLuint a0, GLint a1, GLbitfield a2, GLint* a3, GLenum * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPTEXTURE2DINTELPROC)_glewProfileTargets[1867])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1867, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSyncTextureINTEL (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSYNCTEXTUREINTELPROC)_glewProfileTargets[1868])(a0);
+  _glewProfileEnd(1868, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUnmapTexture2DINTEL (GLuint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNMAPTEXTURE2DINTELPROC)_glewProfileTargets[1869])(a0, a1);
+  _glewProfileEnd(1869, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorPointervINTEL (GLint a0, GLenum a1, const void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORPOINTERVINTELPROC)_glewProfileTargets[1870])(a0, a1, a2);
+  _glewProfileEnd(1870, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalPointervINTEL (GLenum a0, const void** a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALPOINTERVINTELPROC)_glewProfileTargets[1871])(a0, a1);
+  _glewProfileEnd(1871, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordPointervINTEL (GLint a0, GLenum a1, const void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDPOINTERVINTELPROC)_glewProfileTargets[1872])(a0, a1, a2);
+  _glewProfileEnd(1872, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexPointervINTEL (GLint a0, GLenum a1, const void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXPOINTERVINTELPROC)_glewProfileTargets[1873])(a0, a1, a2);
+  _glewProfileEnd(1873, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginPerfQueryINTEL (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINPERFQUERYINTELPROC)_glewProfileTargets[1874])(a0);
+  _glewProfileEnd(1874, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreatePerfQueryINTEL (GLuint a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATEPERFQUERYINTELPROC)_glewProfileTargets[1875])(a0, a1);
+  _glewProfileEnd(1875, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeletePerfQueryINTEL (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPERFQUERYINTELPROC)_glewProfileTargets[1876])(a0);
+  _glewProfileEnd(1876, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndPerfQueryINTEL (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDPERFQUERYINTELPROC)_glewProfileTargets[1877])(a0);
+  _glewProfileEnd(1877, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFirstPerfQueryIdINTEL (GLuint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFIRSTPERFQUERYIDINTELPROC)_glewProfileTargets[1878])(a0);
+  _glewProfileEnd(1878, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNextPerfQueryIdINTEL (GLuint a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNEXTPERFQUERYIDINTELPROC)_glewProfileTargets[1879])(a0, a1);
+  _glewProfileEnd(1879, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfCounterInfoINTEL (GLuint a0, GLuint a1, GLuint a2, GLchar* a3, GLuint a4, GLchar * a5, GLuint * a6, GLuint * a7, GLuint * a8, GLuint * a9, GLuint64 * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFCOUNTERINFOINTELPROC)_glewProfileTargets[1880])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(1880, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfQueryDataINTEL (GLuint a0, GLuint a1, GLsizei a2, void * a3, GLuint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFQUERYDATAINTELPROC)_glewProfileTargets[1881])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1881, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfQueryIdByNameINTEL (GLchar* a0, GLuint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFQUERYIDBYNAMEINTELPROC)_glewProfileTargets[1882])(a0, a1);
+  _glewProfileEnd(1882, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPerfQueryInfoINTEL (GLuint a0, GLuint a1, GLchar* a2, GLuint * a3, GLuint * a4, GLuint * a5, GLuint * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPERFQUERYINFOINTELPROC)_glewProfileTargets[1883])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1883, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexScissorFuncINTEL (GLenum a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSCISSORFUNCINTELPROC)_glewProfileTargets[1884])(a0, a1, a2);
+  _glewProfileEnd(1884, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexScissorINTEL (GLenum a0, GLclampf a1, GLclampf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSCISSORINTELPROC)_glewProfileTargets[1885])(a0, a1, a2);
+  _glewProfileEnd(1885, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendBarrierKHR (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDBARRIERKHRPROC)_glewProfileTargets[1886])();
+  _glewProfileEnd(1886, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageCallback (GLDEBUGPROC a0, const void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGECALLBACKPROC)_glewProfileTargets[1887])(a0, a1);
+  _glewProfileEnd(1887, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageControl (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint* a4, GLboolean a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGECONTROLPROC)_glewProfileTargets[1888])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1888, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDebugMessageInsert (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEBUGMESSAGEINSERTPROC)_glewProfileTargets[1889])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1889, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetDebugMessageLog (GLuint a0, GLsizei a1, GLenum* a2, GLenum* a3, GLuint* a4, GLenum* a5, GLsizei* a6, GLchar* a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETDEBUGMESSAGELOGPROC)_glewProfileTargets[1890])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1890, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectLabel (GLenum a0, GLuint a1, GLsizei a2, GLsizei* a3, GLchar * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTLABELPROC)_glewProfileTargets[1891])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1891, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetObjectPtrLabel (void* a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOBJECTPTRLABELPROC)_glewProfileTargets[1892])(a0, a1, a2, a3);
+  _glewProfileEnd(1892, t);
+}
+
+static void GLAPIENTRY _glewProfile_glObjectLabel (GLenum a0, GLuint a1, GLsizei a2, const GLchar* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLOBJECTLABELPROC)_glewProfileTargets[1893])(a0, a1, a2, a3);
+  _glewProfileEnd(1893, t);
+}
+
+static void GLAPIENTRY _glewProfile_glObjectPtrLabel (void* a0, GLsizei a1, const GLchar* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLOBJECTPTRLABELPROC)_glewProfileTargets[1894])(a0, a1, a2);
+  _glewProfileEnd(1894, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPopDebugGroup (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOPDEBUGGROUPPROC)_glewProfileTargets[1895])();
+  _glewProfileEnd(1895, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPushDebugGroup (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPUSHDEBUGGROUPPROC)_glewProfileTargets[1896])(a0, a1, a2, a3);
+  _glewProfileEnd(1896, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMaxShaderCompilerThreadsKHR (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)_glewProfileTargets[1897])(a0);
+  _glewProfileEnd(1897, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformfv (GLuint a0, GLint a1, GLsizei a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMFVPROC)_glewProfileTargets[1898])(a0, a1, a2, a3);
+  _glewProfileEnd(1898, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformiv (GLuint a0, GLint a1, GLsizei a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMIVPROC)_glewProfileTargets[1899])(a0, a1, a2, a3);
+  _glewProfileEnd(1899, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetnUniformuiv (GLuint a0, GLint a1, GLsizei a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNUNIFORMUIVPROC)_glewProfileTargets[1900])(a0, a1, a2, a3);
+  _glewProfileEnd(1900, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReadnPixels (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADNPIXELSPROC)_glewProfileTargets[1901])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(1901, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glBufferRegionEnabled (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLBUFFERREGIONENABLEDPROC)_glewProfileTargets[1902])();
+  _glewProfileEnd(1902, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteBufferRegion (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEBUFFERREGIONPROC)_glewProfileTargets[1903])(a0);
+  _glewProfileEnd(1903, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBufferRegion (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERREGIONPROC)_glewProfileTargets[1904])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1904, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glNewBufferRegion (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLNEWBUFFERREGIONPROC)_glewProfileTargets[1905])(a0);
+  _glewProfileEnd(1905, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glReadBufferRegion (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADBUFFERREGIONPROC)_glewProfileTargets[1906])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1906, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferParameteriMESA (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERPARAMETERIMESAPROC)_glewProfileTargets[1907])(a0, a1, a2);
+  _glewProfileEnd(1907, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferParameterivMESA (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC)_glewProfileTargets[1908])(a0, a1, a2);
+  _glewProfileEnd(1908, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResizeBuffersMESA (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESIZEBUFFERSMESAPROC)_glewProfileTargets[1909])();
+  _glewProfileEnd(1909, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2dMESA (GLdouble a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2DMESAPROC)_glewProfileTargets[1910])(a0, a1);
+  _glewProfileEnd(1910, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2dvMESA (const GLdouble* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2DVMESAPROC)_glewProfileTargets[1911])(a0);
+  _glewProfileEnd(1911, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2fMESA (GLfloat a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2FMESAPROC)_glewProfileTargets[1912])(a0, a1);
+  _glewProfileEnd(1912, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2fvMESA (const GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2FVMESAPROC)_glewProfileTargets[1913])(a0);
+  _glewProfileEnd(1913, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2iMESA (GLint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2IMESAPROC)_glewProfileTargets[1914])(a0, a1);
+  _glewProfileEnd(1914, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2ivMESA (const GLint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2IVMESAPROC)_glewProfileTargets[1915])(a0);
+  _glewProfileEnd(1915, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2sMESA (GLshort a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2SMESAPROC)_glewProfileTargets[1916])(a0, a1);
+  _glewProfileEnd(1916, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos2svMESA (const GLshort* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS2SVMESAPROC)_glewProfileTargets[1917])(a0);
+  _glewProfileEnd(1917, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3dMESA (GLdouble a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3DMESAPROC)_glewProfileTargets[1918])(a0, a1, a2);
+  _glewProfileEnd(1918, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3dvMESA (const GLdouble* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3DVMESAPROC)_glewProfileTargets[1919])(a0);
+  _glewProfileEnd(1919, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3fMESA (GLfloat a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3FMESAPROC)_glewProfileTargets[1920])(a0, a1, a2);
+  _glewProfileEnd(1920, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3fvMESA (const GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3FVMESAPROC)_glewProfileTargets[1921])(a0);
+  _glewProfileEnd(1921, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3iMESA (GLint a0, GLint a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3IMESAPROC)_glewProfileTargets[1922])(a0, a1, a2);
+  _glewProfileEnd(1922, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3ivMESA (const GLint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3IVMESAPROC)_glewProfileTargets[1923])(a0);
+  _glewProfileEnd(1923, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3sMESA (GLshort a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3SMESAPROC)_glewProfileTargets[1924])(a0, a1, a2);
+  _glewProfileEnd(1924, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos3svMESA (const GLshort* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS3SVMESAPROC)_glewProfileTargets[1925])(a0);
+  _glewProfileEnd(1925, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4dMESA (GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4DMESAPROC)_glewProfileTargets[1926])(a0, a1, a2, a3);
+  _glewProfileEnd(1926, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4dvMESA (const GLdouble* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4DVMESAPROC)_glewProfileTargets[1927])(a0);
+  _glewProfileEnd(1927, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4fMESA (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4FMESAPROC)_glewProfileTargets[1928])(a0, a1, a2, a3);
+  _glewProfileEnd(1928, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4fvMESA (const GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4FVMESAPROC)_glewProfileTargets[1929])(a0);
+  _glewProfileEnd(1929, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4iMESA (GLint a0, GLint a1, GLint a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4IMESAPROC)_glewProfileTargets[1930])(a0, a1, a2, a3);
+  _glewProfileEnd(1930, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4ivMESA (const GLint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4IVMESAPROC)_glewProfileTargets[1931])(a0);
+  _glewProfileEnd(1931, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4sMESA (GLshort a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4SMESAPROC)_glewProfileTargets[1932])(a0, a1, a2, a3);
+  _glewProfileEnd(1932, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWindowPos4svMESA (const GLshort* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWINDOWPOS4SVMESAPROC)_glewProfileTargets[1933])(a0);
+  _glewProfileEnd(1933, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginConditionalRenderNVX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINCONDITIONALRENDERNVXPROC)_glewProfileTargets[1934])(a0);
+  _glewProfileEnd(1934, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndConditionalRenderNVX (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDCONDITIONALRENDERNVXPROC)_glewProfileTargets[1935])();
+  _glewProfileEnd(1935, t);
+}
+
+static GLsync GLAPIENTRY _glewProfile_glAsyncCopyBufferSubDataNVX (GLsizei a0, const GLuint* a1, const GLuint64 * a2, GLuint a3, GLbitfield a4, GLuint a5, GLuint a6, GLintptr a7, GLintptr a8, GLsizeiptr a9, GLsizei a10, const GLuint * a11, const GLuint64 * a12)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLsync r = ((PFNGLASYNCCOPYBUFFERSUBDATANVXPROC)_glewProfileTargets[1936])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+  _glewProfileEnd(1936, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glAsyncCopyImageSubDataNVX (GLsizei a0, const GLuint* a1, const GLuint64 * a2, GLuint a3, GLbitfield a4, GLuint a5, GLenum a6, GLint a7, GLint a8, GLint a9, GLint a10, GLuint a11, GLenum a12, GLint a13, GLint a14, GLint a15, GLint a16, GLsizei a17, GLsizei a18, GLsizei a19, GLsizei a20, const GLuint * a21, const GLuint64 * a22)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLASYNCCOPYIMAGESUBDATANVXPROC)_glewProfileTargets[1937])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22);
+  _glewProfileEnd(1937, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastScissorArrayvNVX (GLuint a0, GLuint a1, GLsizei a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTSCISSORARRAYVNVXPROC)_glewProfileTargets[1938])(a0, a1, a2, a3);
+  _glewProfileEnd(1938, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastViewportArrayvNVX (GLuint a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTVIEWPORTARRAYVNVXPROC)_glewProfileTargets[1939])(a0, a1, a2, a3);
+  _glewProfileEnd(1939, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastViewportPositionWScaleNVX (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTVIEWPORTPOSITIONWSCALENVXPROC)_glewProfileTargets[1940])(a0, a1, a2, a3);
+  _glewProfileEnd(1940, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUploadGpuMaskNVX (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUPLOADGPUMASKNVXPROC)_glewProfileTargets[1941])(a0);
+  _glewProfileEnd(1941, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLGPUCopyImageSubDataNVX (GLuint a0, GLbitfield a1, GLuint a2, GLenum a3, GLint a4, GLint a5, GLint a6, GLint a7, GLuint a8, GLenum a9, GLint a10, GLint a11, GLint a12, GLint a13, GLsizei a14, GLsizei a15, GLsizei a16)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLGPUCOPYIMAGESUBDATANVXPROC)_glewProfileTargets[1942])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16);
+  _glewProfileEnd(1942, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLGPUInterlockNVX (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLGPUINTERLOCKNVXPROC)_glewProfileTargets[1943])();
+  _glewProfileEnd(1943, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLGPUNamedBufferSubDataNVX (GLbitfield a0, GLuint a1, GLintptr a2, GLsizeiptr a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)_glewProfileTargets[1944])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1944, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClientWaitSemaphoreui64NVX (GLsizei a0, const GLuint* a1, const GLuint64 * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIENTWAITSEMAPHOREUI64NVXPROC)_glewProfileTargets[1945])(a0, a1, a2);
+  _glewProfileEnd(1945, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSignalSemaphoreui64NVX (GLuint a0, GLsizei a1, const GLuint* a2, const GLuint64 * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSIGNALSEMAPHOREUI64NVXPROC)_glewProfileTargets[1946])(a0, a1, a2, a3);
+  _glewProfileEnd(1946, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWaitSemaphoreui64NVX (GLuint a0, GLsizei a1, const GLuint* a2, const GLuint64 * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWAITSEMAPHOREUI64NVXPROC)_glewProfileTargets[1947])(a0, a1, a2, a3);
+  _glewProfileEnd(1947, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStereoParameterfNV (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTEREOPARAMETERFNVPROC)_glewProfileTargets[1948])(a0, a1);
+  _glewProfileEnd(1948, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStereoParameteriNV (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTEREOPARAMETERINVPROC)_glewProfileTargets[1949])(a0, a1);
+  _glewProfileEnd(1949, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAlphaToCoverageDitherControlNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)_glewProfileTargets[1950])(a0);
+  _glewProfileEnd(1950, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirectBindlessNV (GLenum a0, const void * a1, GLsizei a2, GLsizei a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)_glewProfileTargets[1951])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1951, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirectBindlessNV (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)_glewProfileTargets[1952])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1952, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawArraysIndirectBindlessCountNV (GLenum a0, const void * a1, GLintptr a2, GLsizei a3, GLsizei a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)_glewProfileTargets[1953])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1953, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawElementsIndirectBindlessCountNV (GLenum a0, GLenum a1, const void * a2, GLintptr a3, GLsizei a4, GLsizei a5, GLint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)_glewProfileTargets[1954])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1954, t);
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetImageHandleNV (GLuint a0, GLint a1, GLboolean a2, GLint a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETIMAGEHANDLENVPROC)_glewProfileTargets[1955])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1955, t);
+  return r;
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetTextureHandleNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETTEXTUREHANDLENVPROC)_glewProfileTargets[1956])(a0);
+  _glewProfileEnd(1956, t);
+  return r;
+}
+
+static GLuint64 GLAPIENTRY _glewProfile_glGetTextureSamplerHandleNV (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint64 r = ((PFNGLGETTEXTURESAMPLERHANDLENVPROC)_glewProfileTargets[1957])(a0, a1);
+  _glewProfileEnd(1957, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsImageHandleResidentNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISIMAGEHANDLERESIDENTNVPROC)_glewProfileTargets[1958])(a0);
+  _glewProfileEnd(1958, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsTextureHandleResidentNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISTEXTUREHANDLERESIDENTNVPROC)_glewProfileTargets[1959])(a0);
+  _glewProfileEnd(1959, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMakeImageHandleNonResidentNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)_glewProfileTargets[1960])(a0);
+  _glewProfileEnd(1960, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeImageHandleResidentNV (GLuint64 a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKEIMAGEHANDLERESIDENTNVPROC)_glewProfileTargets[1961])(a0, a1);
+  _glewProfileEnd(1961, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeTextureHandleNonResidentNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)_glewProfileTargets[1962])(a0);
+  _glewProfileEnd(1962, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeTextureHandleResidentNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKETEXTUREHANDLERESIDENTNVPROC)_glewProfileTargets[1963])(a0);
+  _glewProfileEnd(1963, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformHandleui64NV (GLuint a0, GLint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)_glewProfileTargets[1964])(a0, a1, a2);
+  _glewProfileEnd(1964, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformHandleui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)_glewProfileTargets[1965])(a0, a1, a2, a3);
+  _glewProfileEnd(1965, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformHandleui64NV (GLint a0, GLuint64 a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMHANDLEUI64NVPROC)_glewProfileTargets[1966])(a0, a1);
+  _glewProfileEnd(1966, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformHandleui64vNV (GLint a0, GLsizei a1, const GLuint64* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMHANDLEUI64VNVPROC)_glewProfileTargets[1967])(a0, a1, a2);
+  _glewProfileEnd(1967, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendBarrierNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDBARRIERNVPROC)_glewProfileTargets[1968])();
+  _glewProfileEnd(1968, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendParameteriNV (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDPARAMETERINVPROC)_glewProfileTargets[1969])(a0, a1);
+  _glewProfileEnd(1969, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportPositionWScaleNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTPOSITIONWSCALENVPROC)_glewProfileTargets[1970])(a0, a1, a2);
+  _glewProfileEnd(1970, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCallCommandListNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCALLCOMMANDLISTNVPROC)_glewProfileTargets[1971])(a0);
+  _glewProfileEnd(1971, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCommandListSegmentsNV (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMMANDLISTSEGMENTSNVPROC)_glewProfileTargets[1972])(a0, a1);
+  _glewProfileEnd(1972, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompileCommandListNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPILECOMMANDLISTNVPROC)_glewProfileTargets[1973])(a0);
+  _glewProfileEnd(1973, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateCommandListsNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATECOMMANDLISTSNVPROC)_glewProfileTargets[1974])(a0, a1);
+  _glewProfileEnd(1974, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCreateStatesNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCREATESTATESNVPROC)_glewProfileTargets[1975])(a0, a1);
+  _glewProfileEnd(1975, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteCommandListsNV (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETECOMMANDLISTSNVPROC)_glewProfileTargets[1976])(a0, a1);
+  _glewProfileEnd(1976, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteStatesNV (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETESTATESNVPROC)_glewProfileTargets[1977])(a0, a1);
+  _glewProfileEnd(1977, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawCommandsAddressNV (GLenum a0, const GLuint64* a1, const GLsizei* a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWCOMMANDSADDRESSNVPROC)_glewProfileTargets[1978])(a0, a1, a2, a3);
+  _glewProfileEnd(1978, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawCommandsNV (GLenum a0, GLuint a1, const GLintptr* a2, const GLsizei* a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWCOMMANDSNVPROC)_glewProfileTargets[1979])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1979, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawCommandsStatesAddressNV (const GLuint64* a0, const GLsizei* a1, const GLuint* a2, const GLuint* a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)_glewProfileTargets[1980])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1980, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawCommandsStatesNV (GLuint a0, const GLintptr* a1, const GLsizei* a2, const GLuint* a3, const GLuint* a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWCOMMANDSSTATESNVPROC)_glewProfileTargets[1981])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(1981, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGetCommandHeaderNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGETCOMMANDHEADERNVPROC)_glewProfileTargets[1982])(a0, a1);
+  _glewProfileEnd(1982, t);
+  return r;
+}
+
+static GLushort GLAPIENTRY _glewProfile_glGetStageIndexNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLushort r = ((PFNGLGETSTAGEINDEXNVPROC)_glewProfileTargets[1983])(a0);
+  _glewProfileEnd(1983, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsCommandListNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISCOMMANDLISTNVPROC)_glewProfileTargets[1984])(a0);
+  _glewProfileEnd(1984, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsStateNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSTATENVPROC)_glewProfileTargets[1985])(a0);
+  _glewProfileEnd(1985, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glListDrawCommandsStatesClientNV (GLuint a0, GLuint a1, const void** a2, const GLsizei* a3, const GLuint* a4, const GLuint* a5, GLuint a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)_glewProfileTargets[1986])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(1986, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStateCaptureNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTATECAPTURENVPROC)_glewProfileTargets[1987])(a0, a1);
+  _glewProfileEnd(1987, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginConditionalRenderNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINCONDITIONALRENDERNVPROC)_glewProfileTargets[1988])(a0, a1);
+  _glewProfileEnd(1988, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndConditionalRenderNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDCONDITIONALRENDERNVPROC)_glewProfileTargets[1989])();
+  _glewProfileEnd(1989, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSubpixelPrecisionBiasNV (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSUBPIXELPRECISIONBIASNVPROC)_glewProfileTargets[1990])(a0, a1);
+  _glewProfileEnd(1990, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConservativeRasterParameterfNV (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONSERVATIVERASTERPARAMETERFNVPROC)_glewProfileTargets[1991])(a0, a1);
+  _glewProfileEnd(1991, t);
+}
+
+static void GLAPIENTRY _glewProfile_glConservativeRasterParameteriNV (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCONSERVATIVERASTERPARAMETERINVPROC)_glewProfileTargets[1992])(a0, a1);
+  _glewProfileEnd(1992, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyBufferSubDataNV (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYBUFFERSUBDATANVPROC)_glewProfileTargets[1993])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(1993, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyImageSubDataNV (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYIMAGESUBDATANVPROC)_glewProfileTargets[1994])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+  _glewProfileEnd(1994, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearDepthdNV (GLdouble a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARDEPTHDNVPROC)_glewProfileTargets[1995])(a0);
+  _glewProfileEnd(1995, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthBoundsdNV (GLdouble a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHBOUNDSDNVPROC)_glewProfileTargets[1996])(a0, a1);
+  _glewProfileEnd(1996, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangedNV (GLdouble a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEDNVPROC)_glewProfileTargets[1997])(a0, a1);
+  _glewProfileEnd(1997, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawBuffersNV (GLsizei a0, const GLenum* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWBUFFERSNVPROC)_glewProfileTargets[1998])(a0, a1);
+  _glewProfileEnd(1998, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawArraysInstancedNV (GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWARRAYSINSTANCEDNVPROC)_glewProfileTargets[1999])(a0, a1, a2, a3);
+  _glewProfileEnd(1999, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawElementsInstancedNV (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWELEMENTSINSTANCEDNVPROC)_glewProfileTargets[2000])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2000, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTextureNV (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTEXTURENVPROC)_glewProfileTargets[2001])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2001, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawVkImageNV (GLuint64 a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWVKIMAGENVPROC)_glewProfileTargets[2002])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2002, t);
+}
+
+static GLVULKANPROCNV GLAPIENTRY _glewProfile_glGetVkProcAddrNV (const GLchar* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLVULKANPROCNV r = ((PFNGLGETVKPROCADDRNVPROC)_glewProfileTargets[2003])(a0);
+  _glewProfileEnd(2003, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSignalVkFenceNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSIGNALVKFENCENVPROC)_glewProfileTargets[2004])(a0);
+  _glewProfileEnd(2004, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSignalVkSemaphoreNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSIGNALVKSEMAPHORENVPROC)_glewProfileTargets[2005])(a0);
+  _glewProfileEnd(2005, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWaitVkSemaphoreNV (GLuint64 a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWAITVKSEMAPHORENVPROC)_glewProfileTargets[2006])(a0);
+  _glewProfileEnd(2006, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEvalMapsNV (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEVALMAPSNVPROC)_glewProfileTargets[2007])(a0, a1);
+  _glewProfileEnd(2007, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMapAttribParameterfvNV (GLenum a0, GLuint a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMAPATTRIBPARAMETERFVNVPROC)_glewProfileTargets[2008])(a0, a1, a2, a3);
+  _glewProfileEnd(2008, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMapAttribParameterivNV (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMAPATTRIBPARAMETERIVNVPROC)_glewProfileTargets[2009])(a0, a1, a2, a3);
+  _glewProfileEnd(2009, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMapControlPointsNV (GLenum a0, GLuint a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5, void * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMAPCONTROLPOINTSNVPROC)_glewProfileTargets[2010])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2010, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMapParameterfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMAPPARAMETERFVNVPROC)_glewProfileTargets[2011])(a0, a1, a2);
+  _glewProfileEnd(2011, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMapParameterivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMAPPARAMETERIVNVPROC)_glewProfileTargets[2012])(a0, a1, a2);
+  _glewProfileEnd(2012, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMapControlPointsNV (GLenum a0, GLuint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLint a6, GLboolean a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPCONTROLPOINTSNVPROC)_glewProfileTargets[2013])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2013, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMapParameterfvNV (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPPARAMETERFVNVPROC)_glewProfileTargets[2014])(a0, a1, a2);
+  _glewProfileEnd(2014, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMapParameterivNV (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAPPARAMETERIVNVPROC)_glewProfileTargets[2015])(a0, a1, a2);
+  _glewProfileEnd(2015, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMultisamplefvNV (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMULTISAMPLEFVNVPROC)_glewProfileTargets[2016])(a0, a1, a2);
+  _glewProfileEnd(2016, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleMaskIndexedNV (GLuint a0, GLbitfield a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEMASKINDEXEDNVPROC)_glewProfileTargets[2017])(a0, a1);
+  _glewProfileEnd(2017, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexRenderbufferNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXRENDERBUFFERNVPROC)_glewProfileTargets[2018])(a0, a1);
+  _glewProfileEnd(2018, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteFencesNV (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEFENCESNVPROC)_glewProfileTargets[2019])(a0, a1);
+  _glewProfileEnd(2019, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFinishFenceNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFINISHFENCENVPROC)_glewProfileTargets[2020])(a0);
+  _glewProfileEnd(2020, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenFencesNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENFENCESNVPROC)_glewProfileTargets[2021])(a0, a1);
+  _glewProfileEnd(2021, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFenceivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFENCEIVNVPROC)_glewProfileTargets[2022])(a0, a1, a2);
+  _glewProfileEnd(2022, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsFenceNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISFENCENVPROC)_glewProfileTargets[2023])(a0);
+  _glewProfileEnd(2023, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glSetFenceNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSETFENCENVPROC)_glewProfileTargets[2024])(a0, a1);
+  _glewProfileEnd(2024, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glTestFenceNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLTESTFENCENVPROC)_glewProfileTargets[2025])(a0);
+  _glewProfileEnd(2025, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentCoverageColorNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTCOVERAGECOLORNVPROC)_glewProfileTargets[2026])(a0);
+  _glewProfileEnd(2026, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramNamedParameterdvNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLdouble * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)_glewProfileTargets[2027])(a0, a1, a2, a3);
+  _glewProfileEnd(2027, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramNamedParameterfvNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)_glewProfileTargets[2028])(a0, a1, a2, a3);
+  _glewProfileEnd(2028, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramNamedParameter4dNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLdouble a3, GLdouble a4, GLdouble a5, GLdouble a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMNAMEDPARAMETER4DNVPROC)_glewProfileTargets[2029])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2029, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramNamedParameter4dvNV (GLuint a0, GLsizei a1, const GLubyte* a2, const GLdouble a3[])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)_glewProfileTargets[2030])(a0, a1, a2, a3);
+  _glewProfileEnd(2030, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramNamedParameter4fNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMNAMEDPARAMETER4FNVPROC)_glewProfileTargets[2031])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2031, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramNamedParameter4fvNV (GLuint a0, GLsizei a1, const GLubyte* a2, const GLfloat a3[])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)_glewProfileTargets[2032])(a0, a1, a2, a3);
+  _glewProfileEnd(2032, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlitFramebufferNV (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLITFRAMEBUFFERNVPROC)_glewProfileTargets[2033])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2033, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleNV (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLENVPROC)_glewProfileTargets[2034])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2034, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageMultisampleCoverageNV (GLenum a0, GLsizei a1, GLsizei a2, GLenum a3, GLsizei a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)_glewProfileTargets[2035])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2035, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramVertexLimitNV (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMVERTEXLIMITNVPROC)_glewProfileTargets[2036])(a0, a1);
+  _glewProfileEnd(2036, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastBarrierNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTBARRIERNVPROC)_glewProfileTargets[2037])();
+  _glewProfileEnd(2037, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastBlitFramebufferNV (GLuint a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLint a8, GLint a9, GLbitfield a10, GLenum a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTBLITFRAMEBUFFERNVPROC)_glewProfileTargets[2038])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(2038, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastBufferSubDataNV (GLbitfield a0, GLuint a1, GLintptr a2, GLsizeiptr a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTBUFFERSUBDATANVPROC)_glewProfileTargets[2039])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2039, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastCopyBufferSubDataNV (GLuint a0, GLbitfield a1, GLuint a2, GLuint a3, GLintptr a4, GLintptr a5, GLsizeiptr a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)_glewProfileTargets[2040])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2040, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastCopyImageSubDataNV (GLuint a0, GLbitfield a1, GLuint a2, GLenum a3, GLint a4, GLint a5, GLint a6, GLint a7, GLuint a8, GLenum a9, GLint a10, GLint a11, GLint a12, GLint a13, GLsizei a14, GLsizei a15, GLsizei a16)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTCOPYIMAGESUBDATANVPROC)_glewProfileTargets[2041])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16);
+  _glewProfileEnd(2041, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastFramebufferSampleLocationsfvNV (GLuint a0, GLuint a1, GLuint a2, GLsizei a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)_glewProfileTargets[2042])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2042, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastGetQueryObjecti64vNV (GLuint a0, GLuint a1, GLenum a2, GLint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)_glewProfileTargets[2043])(a0, a1, a2, a3);
+  _glewProfileEnd(2043, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastGetQueryObjectivNV (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTGETQUERYOBJECTIVNVPROC)_glewProfileTargets[2044])(a0, a1, a2, a3);
+  _glewProfileEnd(2044, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastGetQueryObjectui64vNV (GLuint a0, GLuint a1, GLenum a2, GLuint64* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)_glewProfileTargets[2045])(a0, a1, a2, a3);
+  _glewProfileEnd(2045, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastGetQueryObjectuivNV (GLuint a0, GLuint a1, GLenum a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)_glewProfileTargets[2046])(a0, a1, a2, a3);
+  _glewProfileEnd(2046, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMulticastWaitSyncNV (GLuint a0, GLbitfield a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTICASTWAITSYNCNVPROC)_glewProfileTargets[2047])(a0, a1);
+  _glewProfileEnd(2047, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRenderGpuMaskNV (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERGPUMASKNVPROC)_glewProfileTargets[2048])(a0);
+  _glewProfileEnd(2048, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameterI4iNV (GLenum a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERI4INVPROC)_glewProfileTargets[2049])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2049, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameterI4ivNV (GLenum a0, GLuint a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERI4IVNVPROC)_glewProfileTargets[2050])(a0, a1, a2);
+  _glewProfileEnd(2050, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameterI4uiNV (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERI4UINVPROC)_glewProfileTargets[2051])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2051, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParameterI4uivNV (GLenum a0, GLuint a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERI4UIVNVPROC)_glewProfileTargets[2052])(a0, a1, a2);
+  _glewProfileEnd(2052, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParametersI4ivNV (GLenum a0, GLuint a1, GLsizei a2, const GLint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERSI4IVNVPROC)_glewProfileTargets[2053])(a0, a1, a2, a3);
+  _glewProfileEnd(2053, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramEnvParametersI4uivNV (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)_glewProfileTargets[2054])(a0, a1, a2, a3);
+  _glewProfileEnd(2054, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameterI4iNV (GLenum a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERI4INVPROC)_glewProfileTargets[2055])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2055, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameterI4ivNV (GLenum a0, GLuint a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)_glewProfileTargets[2056])(a0, a1, a2);
+  _glewProfileEnd(2056, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameterI4uiNV (GLenum a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERI4UINVPROC)_glewProfileTargets[2057])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2057, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParameterI4uivNV (GLenum a0, GLuint a1, const GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)_glewProfileTargets[2058])(a0, a1, a2);
+  _glewProfileEnd(2058, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParametersI4ivNV (GLenum a0, GLuint a1, GLsizei a2, const GLint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)_glewProfileTargets[2059])(a0, a1, a2, a3);
+  _glewProfileEnd(2059, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramLocalParametersI4uivNV (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)_glewProfileTargets[2060])(a0, a1, a2, a3);
+  _glewProfileEnd(2060, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformi64vNV (GLuint a0, GLint a1, GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMI64VNVPROC)_glewProfileTargets[2061])(a0, a1, a2);
+  _glewProfileEnd(2061, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetUniformui64vNV (GLuint a0, GLint a1, GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETUNIFORMUI64VNVPROC)_glewProfileTargets[2062])(a0, a1, a2);
+  _glewProfileEnd(2062, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1i64NV (GLuint a0, GLint a1, GLint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1I64NVPROC)_glewProfileTargets[2063])(a0, a1, a2);
+  _glewProfileEnd(2063, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1I64VNVPROC)_glewProfileTargets[2064])(a0, a1, a2, a3);
+  _glewProfileEnd(2064, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1ui64NV (GLuint a0, GLint a1, GLuint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UI64NVPROC)_glewProfileTargets[2065])(a0, a1, a2);
+  _glewProfileEnd(2065, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform1ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM1UI64VNVPROC)_glewProfileTargets[2066])(a0, a1, a2, a3);
+  _glewProfileEnd(2066, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2i64NV (GLuint a0, GLint a1, GLint64EXT a2, GLint64EXT a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2I64NVPROC)_glewProfileTargets[2067])(a0, a1, a2, a3);
+  _glewProfileEnd(2067, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2I64VNVPROC)_glewProfileTargets[2068])(a0, a1, a2, a3);
+  _glewProfileEnd(2068, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2ui64NV (GLuint a0, GLint a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UI64NVPROC)_glewProfileTargets[2069])(a0, a1, a2, a3);
+  _glewProfileEnd(2069, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform2ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM2UI64VNVPROC)_glewProfileTargets[2070])(a0, a1, a2, a3);
+  _glewProfileEnd(2070, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3i64NV (GLuint a0, GLint a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3I64NVPROC)_glewProfileTargets[2071])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2071, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3I64VNVPROC)_glewProfileTargets[2072])(a0, a1, a2, a3);
+  _glewProfileEnd(2072, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3ui64NV (GLuint a0, GLint a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UI64NVPROC)_glewProfileTargets[2073])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2073, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform3ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM3UI64VNVPROC)_glewProfileTargets[2074])(a0, a1, a2, a3);
+  _glewProfileEnd(2074, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4i64NV (GLuint a0, GLint a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4, GLint64EXT a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4I64NVPROC)_glewProfileTargets[2075])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2075, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4i64vNV (GLuint a0, GLint a1, GLsizei a2, const GLint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4I64VNVPROC)_glewProfileTargets[2076])(a0, a1, a2, a3);
+  _glewProfileEnd(2076, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4ui64NV (GLuint a0, GLint a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4, GLuint64EXT a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UI64NVPROC)_glewProfileTargets[2077])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2077, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniform4ui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORM4UI64VNVPROC)_glewProfileTargets[2078])(a0, a1, a2, a3);
+  _glewProfileEnd(2078, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1i64NV (GLint a0, GLint64EXT a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1I64NVPROC)_glewProfileTargets[2079])(a0, a1);
+  _glewProfileEnd(2079, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1I64VNVPROC)_glewProfileTargets[2080])(a0, a1, a2);
+  _glewProfileEnd(2080, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1ui64NV (GLint a0, GLuint64EXT a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UI64NVPROC)_glewProfileTargets[2081])(a0, a1);
+  _glewProfileEnd(2081, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform1ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM1UI64VNVPROC)_glewProfileTargets[2082])(a0, a1, a2);
+  _glewProfileEnd(2082, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2i64NV (GLint a0, GLint64EXT a1, GLint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2I64NVPROC)_glewProfileTargets[2083])(a0, a1, a2);
+  _glewProfileEnd(2083, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2I64VNVPROC)_glewProfileTargets[2084])(a0, a1, a2);
+  _glewProfileEnd(2084, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2ui64NV (GLint a0, GLuint64EXT a1, GLuint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UI64NVPROC)_glewProfileTargets[2085])(a0, a1, a2);
+  _glewProfileEnd(2085, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform2ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM2UI64VNVPROC)_glewProfileTargets[2086])(a0, a1, a2);
+  _glewProfileEnd(2086, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3i64NV (GLint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3I64NVPROC)_glewProfileTargets[2087])(a0, a1, a2, a3);
+  _glewProfileEnd(2087, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3I64VNVPROC)_glewProfileTargets[2088])(a0, a1, a2);
+  _glewProfileEnd(2088, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3ui64NV (GLint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UI64NVPROC)_glewProfileTargets[2089])(a0, a1, a2, a3);
+  _glewProfileEnd(2089, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform3ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM3UI64VNVPROC)_glewProfileTargets[2090])(a0, a1, a2);
+  _glewProfileEnd(2090, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4i64NV (GLint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4I64NVPROC)_glewProfileTargets[2091])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2091, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4i64vNV (GLint a0, GLsizei a1, const GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4I64VNVPROC)_glewProfileTargets[2092])(a0, a1, a2);
+  _glewProfileEnd(2092, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4ui64NV (GLint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UI64NVPROC)_glewProfileTargets[2093])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2093, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniform4ui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORM4UI64VNVPROC)_glewProfileTargets[2094])(a0, a1, a2);
+  _glewProfileEnd(2094, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR3HNVPROC)_glewProfileTargets[2095])(a0, a1, a2);
+  _glewProfileEnd(2095, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor3hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR3HVNVPROC)_glewProfileTargets[2096])(a0);
+  _glewProfileEnd(2096, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4hNV (GLhalf a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4HNVPROC)_glewProfileTargets[2097])(a0, a1, a2, a3);
+  _glewProfileEnd(2097, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4HVNVPROC)_glewProfileTargets[2098])(a0);
+  _glewProfileEnd(2098, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordhNV (GLhalf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDHNVPROC)_glewProfileTargets[2099])(a0);
+  _glewProfileEnd(2099, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordhvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDHVNVPROC)_glewProfileTargets[2100])(a0);
+  _glewProfileEnd(2100, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1hNV (GLenum a0, GLhalf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1HNVPROC)_glewProfileTargets[2101])(a0, a1);
+  _glewProfileEnd(2101, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord1hvNV (GLenum a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD1HVNVPROC)_glewProfileTargets[2102])(a0, a1);
+  _glewProfileEnd(2102, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2hNV (GLenum a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2HNVPROC)_glewProfileTargets[2103])(a0, a1, a2);
+  _glewProfileEnd(2103, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord2hvNV (GLenum a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD2HVNVPROC)_glewProfileTargets[2104])(a0, a1);
+  _glewProfileEnd(2104, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3hNV (GLenum a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3HNVPROC)_glewProfileTargets[2105])(a0, a1, a2, a3);
+  _glewProfileEnd(2105, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord3hvNV (GLenum a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD3HVNVPROC)_glewProfileTargets[2106])(a0, a1);
+  _glewProfileEnd(2106, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4hNV (GLenum a0, GLhalf a1, GLhalf a2, GLhalf a3, GLhalf a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4HNVPROC)_glewProfileTargets[2107])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2107, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4hvNV (GLenum a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4HVNVPROC)_glewProfileTargets[2108])(a0, a1);
+  _glewProfileEnd(2108, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormal3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMAL3HNVPROC)_glewProfileTargets[2109])(a0, a1, a2);
+  _glewProfileEnd(2109, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormal3hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMAL3HVNVPROC)_glewProfileTargets[2110])(a0);
+  _glewProfileEnd(2110, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3HNVPROC)_glewProfileTargets[2111])(a0, a1, a2);
+  _glewProfileEnd(2111, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColor3hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLOR3HVNVPROC)_glewProfileTargets[2112])(a0);
+  _glewProfileEnd(2112, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord1hNV (GLhalf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD1HNVPROC)_glewProfileTargets[2113])(a0);
+  _glewProfileEnd(2113, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord1hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD1HVNVPROC)_glewProfileTargets[2114])(a0);
+  _glewProfileEnd(2114, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2hNV (GLhalf a0, GLhalf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2HNVPROC)_glewProfileTargets[2115])(a0, a1);
+  _glewProfileEnd(2115, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2HVNVPROC)_glewProfileTargets[2116])(a0);
+  _glewProfileEnd(2116, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD3HNVPROC)_glewProfileTargets[2117])(a0, a1, a2);
+  _glewProfileEnd(2117, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord3hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD3HVNVPROC)_glewProfileTargets[2118])(a0);
+  _glewProfileEnd(2118, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord4hNV (GLhalf a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD4HNVPROC)_glewProfileTargets[2119])(a0, a1, a2, a3);
+  _glewProfileEnd(2119, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord4hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD4HVNVPROC)_glewProfileTargets[2120])(a0);
+  _glewProfileEnd(2120, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertex2hNV (GLhalf a0, GLhalf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEX2HNVPROC)_glewProfileTargets[2121])(a0, a1);
+  _glewProfileEnd(2121, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertex2hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEX2HVNVPROC)_glewProfileTargets[2122])(a0);
+  _glewProfileEnd(2122, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertex3hNV (GLhalf a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEX3HNVPROC)_glewProfileTargets[2123])(a0, a1, a2);
+  _glewProfileEnd(2123, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertex3hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEX3HVNVPROC)_glewProfileTargets[2124])(a0);
+  _glewProfileEnd(2124, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertex4hNV (GLhalf a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEX4HNVPROC)_glewProfileTargets[2125])(a0, a1, a2, a3);
+  _glewProfileEnd(2125, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertex4hvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEX4HVNVPROC)_glewProfileTargets[2126])(a0);
+  _glewProfileEnd(2126, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1hNV (GLuint a0, GLhalf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1HNVPROC)_glewProfileTargets[2127])(a0, a1);
+  _glewProfileEnd(2127, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1hvNV (GLuint a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1HVNVPROC)_glewProfileTargets[2128])(a0, a1);
+  _glewProfileEnd(2128, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2hNV (GLuint a0, GLhalf a1, GLhalf a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2HNVPROC)_glewProfileTargets[2129])(a0, a1, a2);
+  _glewProfileEnd(2129, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2hvNV (GLuint a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2HVNVPROC)_glewProfileTargets[2130])(a0, a1);
+  _glewProfileEnd(2130, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3hNV (GLuint a0, GLhalf a1, GLhalf a2, GLhalf a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3HNVPROC)_glewProfileTargets[2131])(a0, a1, a2, a3);
+  _glewProfileEnd(2131, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3hvNV (GLuint a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3HVNVPROC)_glewProfileTargets[2132])(a0, a1);
+  _glewProfileEnd(2132, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4hNV (GLuint a0, GLhalf a1, GLhalf a2, GLhalf a3, GLhalf a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4HNVPROC)_glewProfileTargets[2133])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2133, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4hvNV (GLuint a0, const GLhalf* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4HVNVPROC)_glewProfileTargets[2134])(a0, a1);
+  _glewProfileEnd(2134, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs1hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS1HVNVPROC)_glewProfileTargets[2135])(a0, a1, a2);
+  _glewProfileEnd(2135, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs2hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS2HVNVPROC)_glewProfileTargets[2136])(a0, a1, a2);
+  _glewProfileEnd(2136, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs3hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS3HVNVPROC)_glewProfileTargets[2137])(a0, a1, a2);
+  _glewProfileEnd(2137, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs4hvNV (GLuint a0, GLsizei a1, const GLhalf* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS4HVNVPROC)_glewProfileTargets[2138])(a0, a1, a2);
+  _glewProfileEnd(2138, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexWeighthNV (GLhalf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXWEIGHTHNVPROC)_glewProfileTargets[2139])(a0);
+  _glewProfileEnd(2139, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexWeighthvNV (const GLhalf* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXWEIGHTHVNVPROC)_glewProfileTargets[2140])(a0);
+  _glewProfileEnd(2140, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribDivisorNV (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBDIVISORNVPROC)_glewProfileTargets[2141])(a0, a1);
+  _glewProfileEnd(2141, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetInternalformatSampleivNV (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLsizei a4, GLint* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTERNALFORMATSAMPLEIVNVPROC)_glewProfileTargets[2142])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2142, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferAttachMemoryNV (GLenum a0, GLuint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERATTACHMEMORYNVPROC)_glewProfileTargets[2143])(a0, a1, a2);
+  _glewProfileEnd(2143, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMemoryObjectDetachedResourcesuivNV (GLuint a0, GLenum a1, GLint a2, GLsizei a3, GLuint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC)_glewProfileTargets[2144])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2144, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedBufferAttachMemoryNV (GLuint a0, GLuint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDBUFFERATTACHMEMORYNVPROC)_glewProfileTargets[2145])(a0, a1, a2);
+  _glewProfileEnd(2145, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResetMemoryObjectParameterNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESETMEMORYOBJECTPARAMETERNVPROC)_glewProfileTargets[2146])(a0, a1);
+  _glewProfileEnd(2146, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexAttachMemoryNV (GLenum a0, GLuint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXATTACHMEMORYNVPROC)_glewProfileTargets[2147])(a0, a1, a2);
+  _glewProfileEnd(2147, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureAttachMemoryNV (GLuint a0, GLuint a1, GLuint64 a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREATTACHMEMORYNVPROC)_glewProfileTargets[2148])(a0, a1, a2);
+  _glewProfileEnd(2148, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawMeshTasksIndirectNV (GLintptr a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWMESHTASKSINDIRECTNVPROC)_glewProfileTargets[2149])(a0);
+  _glewProfileEnd(2149, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawMeshTasksNV (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWMESHTASKSNVPROC)_glewProfileTargets[2150])(a0, a1);
+  _glewProfileEnd(2150, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawMeshTasksIndirectCountNV (GLintptr a0, GLintptr a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC)_glewProfileTargets[2151])(a0, a1, a2, a3);
+  _glewProfileEnd(2151, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiDrawMeshTasksIndirectNV (GLintptr a0, GLsizei a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC)_glewProfileTargets[2152])(a0, a1, a2);
+  _glewProfileEnd(2152, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2x3fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2X3FVNVPROC)_glewProfileTargets[2153])(a0, a1, a2, a3);
+  _glewProfileEnd(2153, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix2x4fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX2X4FVNVPROC)_glewProfileTargets[2154])(a0, a1, a2, a3);
+  _glewProfileEnd(2154, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3x2fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3X2FVNVPROC)_glewProfileTargets[2155])(a0, a1, a2, a3);
+  _glewProfileEnd(2155, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix3x4fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX3X4FVNVPROC)_glewProfileTargets[2156])(a0, a1, a2, a3);
+  _glewProfileEnd(2156, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4x2fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4X2FVNVPROC)_glewProfileTargets[2157])(a0, a1, a2, a3);
+  _glewProfileEnd(2157, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformMatrix4x3fvNV (GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMMATRIX4X3FVNVPROC)_glewProfileTargets[2158])(a0, a1, a2, a3);
+  _glewProfileEnd(2158, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginOcclusionQueryNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINOCCLUSIONQUERYNVPROC)_glewProfileTargets[2159])(a0);
+  _glewProfileEnd(2159, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteOcclusionQueriesNV (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEOCCLUSIONQUERIESNVPROC)_glewProfileTargets[2160])(a0, a1);
+  _glewProfileEnd(2160, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndOcclusionQueryNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDOCCLUSIONQUERYNVPROC)_glewProfileTargets[2161])();
+  _glewProfileEnd(2161, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenOcclusionQueriesNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENOCCLUSIONQUERIESNVPROC)_glewProfileTargets[2162])(a0, a1);
+  _glewProfileEnd(2162, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetOcclusionQueryivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOCCLUSIONQUERYIVNVPROC)_glewProfileTargets[2163])(a0, a1, a2);
+  _glewProfileEnd(2163, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetOcclusionQueryuivNV (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETOCCLUSIONQUERYUIVNVPROC)_glewProfileTargets[2164])(a0, a1, a2);
+  _glewProfileEnd(2164, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsOcclusionQueryNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISOCCLUSIONQUERYNVPROC)_glewProfileTargets[2165])(a0);
+  _glewProfileEnd(2165, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glProgramBufferParametersIivNV (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, const GLint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)_glewProfileTargets[2166])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2166, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramBufferParametersIuivNV (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, const GLuint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)_glewProfileTargets[2167])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2167, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramBufferParametersfvNV (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, const GLfloat * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)_glewProfileTargets[2168])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2168, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyPathNV (GLuint a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYPATHNVPROC)_glewProfileTargets[2169])(a0, a1);
+  _glewProfileEnd(2169, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCoverFillPathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLenum a5, const GLfloat * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOVERFILLPATHINSTANCEDNVPROC)_glewProfileTargets[2170])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2170, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCoverFillPathNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOVERFILLPATHNVPROC)_glewProfileTargets[2171])(a0, a1);
+  _glewProfileEnd(2171, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCoverStrokePathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLenum a5, const GLfloat * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOVERSTROKEPATHINSTANCEDNVPROC)_glewProfileTargets[2172])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2172, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCoverStrokePathNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOVERSTROKEPATHNVPROC)_glewProfileTargets[2173])(a0, a1);
+  _glewProfileEnd(2173, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeletePathsNV (GLuint a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPATHSNVPROC)_glewProfileTargets[2174])(a0, a1);
+  _glewProfileEnd(2174, t);
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGenPathsNV (GLsizei a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGENPATHSNVPROC)_glewProfileTargets[2175])(a0);
+  _glewProfileEnd(2175, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathColorGenfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHCOLORGENFVNVPROC)_glewProfileTargets[2176])(a0, a1, a2);
+  _glewProfileEnd(2176, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathColorGenivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHCOLORGENIVNVPROC)_glewProfileTargets[2177])(a0, a1, a2);
+  _glewProfileEnd(2177, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathCommandsNV (GLuint a0, GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHCOMMANDSNVPROC)_glewProfileTargets[2178])(a0, a1);
+  _glewProfileEnd(2178, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathCoordsNV (GLuint a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHCOORDSNVPROC)_glewProfileTargets[2179])(a0, a1);
+  _glewProfileEnd(2179, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathDashArrayNV (GLuint a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHDASHARRAYNVPROC)_glewProfileTargets[2180])(a0, a1);
+  _glewProfileEnd(2180, t);
+}
+
+static GLfloat GLAPIENTRY _glewProfile_glGetPathLengthNV (GLuint a0, GLsizei a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLfloat r = ((PFNGLGETPATHLENGTHNVPROC)_glewProfileTargets[2181])(a0, a1, a2);
+  _glewProfileEnd(2181, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathMetricRangeNV (GLbitfield a0, GLuint a1, GLsizei a2, GLsizei a3, GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHMETRICRANGENVPROC)_glewProfileTargets[2182])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2182, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathMetricsNV (GLbitfield a0, GLsizei a1, GLenum a2, const void * a3, GLuint a4, GLsizei a5, GLfloat * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHMETRICSNVPROC)_glewProfileTargets[2183])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2183, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathParameterfvNV (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHPARAMETERFVNVPROC)_glewProfileTargets[2184])(a0, a1, a2);
+  _glewProfileEnd(2184, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathParameterivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHPARAMETERIVNVPROC)_glewProfileTargets[2185])(a0, a1, a2);
+  _glewProfileEnd(2185, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathSpacingNV (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLuint a4, GLfloat a5, GLfloat a6, GLenum a7, GLfloat * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHSPACINGNVPROC)_glewProfileTargets[2186])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2186, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathTexGenfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHTEXGENFVNVPROC)_glewProfileTargets[2187])(a0, a1, a2);
+  _glewProfileEnd(2187, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPathTexGenivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPATHTEXGENIVNVPROC)_glewProfileTargets[2188])(a0, a1, a2);
+  _glewProfileEnd(2188, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramResourcefvNV (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum* a4, GLsizei a5, GLsizei * a6, GLfloat * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMRESOURCEFVNVPROC)_glewProfileTargets[2189])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2189, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInterpolatePathsNV (GLuint a0, GLuint a1, GLuint a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINTERPOLATEPATHSNVPROC)_glewProfileTargets[2190])(a0, a1, a2, a3);
+  _glewProfileEnd(2190, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsPathNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPATHNVPROC)_glewProfileTargets[2191])(a0);
+  _glewProfileEnd(2191, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsPointInFillPathNV (GLuint a0, GLuint a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPOINTINFILLPATHNVPROC)_glewProfileTargets[2192])(a0, a1, a2, a3);
+  _glewProfileEnd(2192, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsPointInStrokePathNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPOINTINSTROKEPATHNVPROC)_glewProfileTargets[2193])(a0, a1, a2);
+  _glewProfileEnd(2193, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoad3x2fNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOAD3X2FNVPROC)_glewProfileTargets[2194])(a0, a1);
+  _glewProfileEnd(2194, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoad3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOAD3X3FNVPROC)_glewProfileTargets[2195])(a0, a1);
+  _glewProfileEnd(2195, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixLoadTranspose3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)_glewProfileTargets[2196])(a0, a1);
+  _glewProfileEnd(2196, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMult3x2fNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULT3X2FNVPROC)_glewProfileTargets[2197])(a0, a1);
+  _glewProfileEnd(2197, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMult3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULT3X3FNVPROC)_glewProfileTargets[2198])(a0, a1);
+  _glewProfileEnd(2198, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixMultTranspose3x3fNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)_glewProfileTargets[2199])(a0, a1);
+  _glewProfileEnd(2199, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathColorGenNV (GLenum a0, GLenum a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHCOLORGENNVPROC)_glewProfileTargets[2200])(a0, a1, a2, a3);
+  _glewProfileEnd(2200, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathCommandsNV (GLuint a0, GLsizei a1, const GLubyte* a2, GLsizei a3, GLenum a4, const void* a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHCOMMANDSNVPROC)_glewProfileTargets[2201])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2201, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathCoordsNV (GLuint a0, GLsizei a1, GLenum a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHCOORDSNVPROC)_glewProfileTargets[2202])(a0, a1, a2, a3);
+  _glewProfileEnd(2202, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathCoverDepthFuncNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHCOVERDEPTHFUNCNVPROC)_glewProfileTargets[2203])(a0);
+  _glewProfileEnd(2203, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathDashArrayNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHDASHARRAYNVPROC)_glewProfileTargets[2204])(a0, a1, a2);
+  _glewProfileEnd(2204, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathFogGenNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHFOGGENNVPROC)_glewProfileTargets[2205])(a0);
+  _glewProfileEnd(2205, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glPathGlyphIndexArrayNV (GLuint a0, GLenum a1, const void * a2, GLbitfield a3, GLuint a4, GLsizei a5, GLuint a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLPATHGLYPHINDEXARRAYNVPROC)_glewProfileTargets[2206])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2206, t);
+  return r;
+}
+
+static GLenum GLAPIENTRY _glewProfile_glPathGlyphIndexRangeNV (GLenum a0, const void * a1, GLbitfield a2, GLuint a3, GLfloat a4, GLuint a5[2])
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLPATHGLYPHINDEXRANGENVPROC)_glewProfileTargets[2207])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2207, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPathGlyphRangeNV (GLuint a0, GLenum a1, const void * a2, GLbitfield a3, GLuint a4, GLsizei a5, GLenum a6, GLuint a7, GLfloat a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHGLYPHRANGENVPROC)_glewProfileTargets[2208])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2208, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathGlyphsNV (GLuint a0, GLenum a1, const void * a2, GLbitfield a3, GLsizei a4, GLenum a5, const void* a6, GLenum a7, GLuint a8, GLfloat a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHGLYPHSNVPROC)_glewProfileTargets[2209])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2209, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glPathMemoryGlyphIndexArrayNV (GLuint a0, GLenum a1, GLsizeiptr a2, const void * a3, GLsizei a4, GLuint a5, GLsizei a6, GLuint a7, GLfloat a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)_glewProfileTargets[2210])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2210, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPathParameterfNV (GLuint a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHPARAMETERFNVPROC)_glewProfileTargets[2211])(a0, a1, a2);
+  _glewProfileEnd(2211, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathParameterfvNV (GLuint a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHPARAMETERFVNVPROC)_glewProfileTargets[2212])(a0, a1, a2);
+  _glewProfileEnd(2212, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathParameteriNV (GLuint a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHPARAMETERINVPROC)_glewProfileTargets[2213])(a0, a1, a2);
+  _glewProfileEnd(2213, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathParameterivNV (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHPARAMETERIVNVPROC)_glewProfileTargets[2214])(a0, a1, a2);
+  _glewProfileEnd(2214, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathStencilDepthOffsetNV (GLfloat a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHSTENCILDEPTHOFFSETNVPROC)_glewProfileTargets[2215])(a0, a1);
+  _glewProfileEnd(2215, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathStencilFuncNV (GLenum a0, GLint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHSTENCILFUNCNVPROC)_glewProfileTargets[2216])(a0, a1, a2);
+  _glewProfileEnd(2216, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathStringNV (GLuint a0, GLenum a1, GLsizei a2, const void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHSTRINGNVPROC)_glewProfileTargets[2217])(a0, a1, a2, a3);
+  _glewProfileEnd(2217, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathSubCommandsNV (GLuint a0, GLsizei a1, GLsizei a2, GLsizei a3, const GLubyte* a4, GLsizei a5, GLenum a6, const void* a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHSUBCOMMANDSNVPROC)_glewProfileTargets[2218])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2218, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathSubCoordsNV (GLuint a0, GLsizei a1, GLsizei a2, GLenum a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHSUBCOORDSNVPROC)_glewProfileTargets[2219])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2219, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPathTexGenNV (GLenum a0, GLenum a1, GLint a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPATHTEXGENNVPROC)_glewProfileTargets[2220])(a0, a1, a2, a3);
+  _glewProfileEnd(2220, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glPointAlongPathNV (GLuint a0, GLsizei a1, GLsizei a2, GLfloat a3, GLfloat* a4, GLfloat * a5, GLfloat * a6, GLfloat * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLPOINTALONGPATHNVPROC)_glewProfileTargets[2221])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2221, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glProgramPathFragmentInputGenNV (GLuint a0, GLint a1, GLenum a2, GLint a3, const GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)_glewProfileTargets[2222])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2222, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilFillPathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLuint a5, GLenum a6, const GLfloat * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILFILLPATHINSTANCEDNVPROC)_glewProfileTargets[2223])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2223, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilFillPathNV (GLuint a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILFILLPATHNVPROC)_glewProfileTargets[2224])(a0, a1, a2);
+  _glewProfileEnd(2224, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilStrokePathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLint a4, GLuint a5, GLenum a6, const GLfloat * a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)_glewProfileTargets[2225])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2225, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilStrokePathNV (GLuint a0, GLint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILSTROKEPATHNVPROC)_glewProfileTargets[2226])(a0, a1, a2);
+  _glewProfileEnd(2226, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilThenCoverFillPathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLenum a4, GLuint a5, GLenum a6, GLenum a7, const GLfloat * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)_glewProfileTargets[2227])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2227, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilThenCoverFillPathNV (GLuint a0, GLenum a1, GLuint a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILTHENCOVERFILLPATHNVPROC)_glewProfileTargets[2228])(a0, a1, a2, a3);
+  _glewProfileEnd(2228, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilThenCoverStrokePathInstancedNV (GLsizei a0, GLenum a1, const void * a2, GLuint a3, GLint a4, GLuint a5, GLenum a6, GLenum a7, const GLfloat * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)_glewProfileTargets[2229])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2229, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStencilThenCoverStrokePathNV (GLuint a0, GLint a1, GLuint a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)_glewProfileTargets[2230])(a0, a1, a2, a3);
+  _glewProfileEnd(2230, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTransformPathNV (GLuint a0, GLuint a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMPATHNVPROC)_glewProfileTargets[2231])(a0, a1, a2, a3);
+  _glewProfileEnd(2231, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightPathsNV (GLuint a0, GLsizei a1, const GLuint a2[], const GLfloat a3[])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTPATHSNVPROC)_glewProfileTargets[2232])(a0, a1, a2, a3);
+  _glewProfileEnd(2232, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFlushPixelDataRangeNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHPIXELDATARANGENVPROC)_glewProfileTargets[2233])(a0);
+  _glewProfileEnd(2233, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelDataRangeNV (GLenum a0, GLsizei a1, void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELDATARANGENVPROC)_glewProfileTargets[2234])(a0, a1, a2);
+  _glewProfileEnd(2234, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameteriNV (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERINVPROC)_glewProfileTargets[2235])(a0, a1);
+  _glewProfileEnd(2235, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterivNV (GLenum a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERIVNVPROC)_glewProfileTargets[2236])(a0, a1);
+  _glewProfileEnd(2236, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPolygonModeNV (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOLYGONMODENVPROC)_glewProfileTargets[2237])(a0, a1);
+  _glewProfileEnd(2237, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoi64vNV (GLuint a0, GLenum a1, GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOI64VNVPROC)_glewProfileTargets[2238])(a0, a1, a2);
+  _glewProfileEnd(2238, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOIVNVPROC)_glewProfileTargets[2239])(a0, a1, a2);
+  _glewProfileEnd(2239, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoui64vNV (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOUI64VNVPROC)_glewProfileTargets[2240])(a0, a1, a2);
+  _glewProfileEnd(2240, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideouivNV (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOUIVNVPROC)_glewProfileTargets[2241])(a0, a1, a2);
+  _glewProfileEnd(2241, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPresentFrameDualFillNV (GLuint a0, GLuint64EXT a1, GLuint a2, GLuint a3, GLenum a4, GLenum a5, GLuint a6, GLenum a7, GLuint a8, GLenum a9, GLuint a10, GLenum a11, GLuint a12)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRESENTFRAMEDUALFILLNVPROC)_glewProfileTargets[2242])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+  _glewProfileEnd(2242, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPresentFrameKeyedNV (GLuint a0, GLuint64EXT a1, GLuint a2, GLuint a3, GLenum a4, GLenum a5, GLuint a6, GLuint a7, GLenum a8, GLuint a9, GLuint a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRESENTFRAMEKEYEDNVPROC)_glewProfileTargets[2243])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2243, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPrimitiveRestartIndexNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIMITIVERESTARTINDEXNVPROC)_glewProfileTargets[2244])(a0);
+  _glewProfileEnd(2244, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPrimitiveRestartNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIMITIVERESTARTNVPROC)_glewProfileTargets[2245])();
+  _glewProfileEnd(2245, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReadBufferNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADBUFFERNVPROC)_glewProfileTargets[2246])(a0);
+  _glewProfileEnd(2246, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerInputNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINERINPUTNVPROC)_glewProfileTargets[2247])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2247, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerOutputNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4, GLenum a5, GLenum a6, GLboolean a7, GLboolean a8, GLboolean a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINEROUTPUTNVPROC)_glewProfileTargets[2248])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2248, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerParameterfNV (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINERPARAMETERFNVPROC)_glewProfileTargets[2249])(a0, a1);
+  _glewProfileEnd(2249, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerParameterfvNV (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINERPARAMETERFVNVPROC)_glewProfileTargets[2250])(a0, a1);
+  _glewProfileEnd(2250, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerParameteriNV (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINERPARAMETERINVPROC)_glewProfileTargets[2251])(a0, a1);
+  _glewProfileEnd(2251, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerParameterivNV (GLenum a0, const GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINERPARAMETERIVNVPROC)_glewProfileTargets[2252])(a0, a1);
+  _glewProfileEnd(2252, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFinalCombinerInputNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFINALCOMBINERINPUTNVPROC)_glewProfileTargets[2253])(a0, a1, a2, a3);
+  _glewProfileEnd(2253, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCombinerInputParameterfvNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLfloat* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)_glewProfileTargets[2254])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2254, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCombinerInputParameterivNV (GLenum a0, GLenum a1, GLenum a2, GLenum a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)_glewProfileTargets[2255])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2255, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCombinerOutputParameterfvNV (GLenum a0, GLenum a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)_glewProfileTargets[2256])(a0, a1, a2, a3);
+  _glewProfileEnd(2256, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCombinerOutputParameterivNV (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)_glewProfileTargets[2257])(a0, a1, a2, a3);
+  _glewProfileEnd(2257, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFinalCombinerInputParameterfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)_glewProfileTargets[2258])(a0, a1, a2);
+  _glewProfileEnd(2258, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFinalCombinerInputParameterivNV (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)_glewProfileTargets[2259])(a0, a1, a2);
+  _glewProfileEnd(2259, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCombinerStageParameterfvNV (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMBINERSTAGEPARAMETERFVNVPROC)_glewProfileTargets[2260])(a0, a1, a2);
+  _glewProfileEnd(2260, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetCombinerStageParameterfvNV (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)_glewProfileTargets[2261])(a0, a1, a2);
+  _glewProfileEnd(2261, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferSampleLocationsfvNV (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)_glewProfileTargets[2262])(a0, a1, a2, a3);
+  _glewProfileEnd(2262, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferSampleLocationsfvNV (GLuint a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)_glewProfileTargets[2263])(a0, a1, a2, a3);
+  _glewProfileEnd(2263, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResolveDepthValuesNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESOLVEDEPTHVALUESNVPROC)_glewProfileTargets[2264])();
+  _glewProfileEnd(2264, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorExclusiveArrayvNV (GLuint a0, GLsizei a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSOREXCLUSIVEARRAYVNVPROC)_glewProfileTargets[2265])(a0, a1, a2);
+  _glewProfileEnd(2265, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorExclusiveNV (GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSOREXCLUSIVENVPROC)_glewProfileTargets[2266])(a0, a1, a2, a3);
+  _glewProfileEnd(2266, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferParameterui64vNV (GLenum a0, GLenum a1, GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPARAMETERUI64VNVPROC)_glewProfileTargets[2267])(a0, a1, a2);
+  _glewProfileEnd(2267, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetIntegerui64vNV (GLenum a0, GLuint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGERUI64VNVPROC)_glewProfileTargets[2268])(a0, a1);
+  _glewProfileEnd(2268, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNamedBufferParameterui64vNV (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)_glewProfileTargets[2269])(a0, a1, a2);
+  _glewProfileEnd(2269, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsBufferResidentNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISBUFFERRESIDENTNVPROC)_glewProfileTargets[2270])(a0);
+  _glewProfileEnd(2270, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsNamedBufferResidentNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISNAMEDBUFFERRESIDENTNVPROC)_glewProfileTargets[2271])(a0);
+  _glewProfileEnd(2271, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMakeBufferNonResidentNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKEBUFFERNONRESIDENTNVPROC)_glewProfileTargets[2272])(a0);
+  _glewProfileEnd(2272, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeBufferResidentNV (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKEBUFFERRESIDENTNVPROC)_glewProfileTargets[2273])(a0, a1);
+  _glewProfileEnd(2273, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeNamedBufferNonResidentNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)_glewProfileTargets[2274])(a0);
+  _glewProfileEnd(2274, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMakeNamedBufferResidentNV (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMAKENAMEDBUFFERRESIDENTNVPROC)_glewProfileTargets[2275])(a0, a1);
+  _glewProfileEnd(2275, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformui64NV (GLuint a0, GLint a1, GLuint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMUI64NVPROC)_glewProfileTargets[2276])(a0, a1, a2);
+  _glewProfileEnd(2276, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramUniformui64vNV (GLuint a0, GLint a1, GLsizei a2, const GLuint64EXT* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMUNIFORMUI64VNVPROC)_glewProfileTargets[2277])(a0, a1, a2, a3);
+  _glewProfileEnd(2277, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformui64NV (GLint a0, GLuint64EXT a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMUI64NVPROC)_glewProfileTargets[2278])(a0, a1);
+  _glewProfileEnd(2278, t);
+}
+
+static void GLAPIENTRY _glewProfile_glUniformui64vNV (GLint a0, GLsizei a1, const GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLUNIFORMUI64VNVPROC)_glewProfileTargets[2279])(a0, a1, a2);
+  _glewProfileEnd(2279, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindShadingRateImageNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDSHADINGRATEIMAGENVPROC)_glewProfileTargets[2280])(a0);
+  _glewProfileEnd(2280, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShadingRateImagePaletteNV (GLuint a0, GLuint a1, GLenum* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADINGRATEIMAGEPALETTENVPROC)_glewProfileTargets[2281])(a0, a1, a2);
+  _glewProfileEnd(2281, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetShadingRateSampleLocationivNV (GLenum a0, GLuint a1, GLuint a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC)_glewProfileTargets[2282])(a0, a1, a2, a3);
+  _glewProfileEnd(2282, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShadingRateImageBarrierNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADINGRATEIMAGEBARRIERNVPROC)_glewProfileTargets[2283])(a0);
+  _glewProfileEnd(2283, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShadingRateImagePaletteNV (GLuint a0, GLuint a1, GLsizei a2, const GLenum* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADINGRATEIMAGEPALETTENVPROC)_glewProfileTargets[2284])(a0, a1, a2, a3);
+  _glewProfileEnd(2284, t);
+}
+
+static void GLAPIENTRY _glewProfile_glShadingRateSampleOrderCustomNV (GLenum a0, GLuint a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC)_glewProfileTargets[2285])(a0, a1, a2);
+  _glewProfileEnd(2285, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage3DNV (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE3DNVPROC)_glewProfileTargets[2286])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2286, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage3DNV (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE3DNVPROC)_glewProfileTargets[2287])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2287, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexSubImage3DNV (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXSUBIMAGE3DNVPROC)_glewProfileTargets[2288])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2288, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureLayerNV (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURELAYERNVPROC)_glewProfileTargets[2289])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2289, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage3DNV (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE3DNVPROC)_glewProfileTargets[2290])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2290, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage3DNV (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE3DNVPROC)_glewProfileTargets[2291])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2291, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureBarrierNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREBARRIERNVPROC)_glewProfileTargets[2292])();
+  _glewProfileEnd(2292, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage2DMultisampleCoverageNV (GLenum a0, GLsizei a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)_glewProfileTargets[2293])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2293, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage3DMultisampleCoverageNV (GLenum a0, GLsizei a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)_glewProfileTargets[2294])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2294, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage2DMultisampleCoverageNV (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3, GLint a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)_glewProfileTargets[2295])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2295, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage2DMultisampleNV (GLuint a0, GLenum a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)_glewProfileTargets[2296])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2296, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage3DMultisampleCoverageNV (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)_glewProfileTargets[2297])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2297, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureImage3DMultisampleNV (GLuint a0, GLenum a1, GLsizei a2, GLint a3, GLsizei a4, GLsizei a5, GLsizei a6, GLboolean a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)_glewProfileTargets[2298])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2298, t);
+}
+
+static void GLAPIENTRY _glewProfile_glActiveVaryingNV (GLuint a0, const GLchar * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLACTIVEVARYINGNVPROC)_glewProfileTargets[2299])(a0, a1);
+  _glewProfileEnd(2299, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginTransformFeedbackNV (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINTRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2300])(a0);
+  _glewProfileEnd(2300, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferBaseNV (GLenum a0, GLuint a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERBASENVPROC)_glewProfileTargets[2301])(a0, a1, a2);
+  _glewProfileEnd(2301, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferOffsetNV (GLenum a0, GLuint a1, GLuint a2, GLintptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFEROFFSETNVPROC)_glewProfileTargets[2302])(a0, a1, a2, a3);
+  _glewProfileEnd(2302, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindBufferRangeNV (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDBUFFERRANGENVPROC)_glewProfileTargets[2303])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2303, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndTransformFeedbackNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDTRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2304])();
+  _glewProfileEnd(2304, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetActiveVaryingNV (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLsizei * a4, GLenum * a5, GLchar * a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETACTIVEVARYINGNVPROC)_glewProfileTargets[2305])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2305, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTransformFeedbackVaryingNV (GLuint a0, GLuint a1, GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)_glewProfileTargets[2306])(a0, a1, a2);
+  _glewProfileEnd(2306, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glGetVaryingLocationNV (GLuint a0, const GLchar * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLGETVARYINGLOCATIONNVPROC)_glewProfileTargets[2307])(a0, a1);
+  _glewProfileEnd(2307, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glTransformFeedbackAttribsNV (GLuint a0, const GLint * a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)_glewProfileTargets[2308])(a0, a1, a2);
+  _glewProfileEnd(2308, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTransformFeedbackVaryingsNV (GLuint a0, GLsizei a1, const GLint * a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)_glewProfileTargets[2309])(a0, a1, a2, a3);
+  _glewProfileEnd(2309, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindTransformFeedbackNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDTRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2310])(a0, a1);
+  _glewProfileEnd(2310, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteTransformFeedbacksNV (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETETRANSFORMFEEDBACKSNVPROC)_glewProfileTargets[2311])(a0, a1);
+  _glewProfileEnd(2311, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDrawTransformFeedbackNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDRAWTRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2312])(a0, a1);
+  _glewProfileEnd(2312, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenTransformFeedbacksNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENTRANSFORMFEEDBACKSNVPROC)_glewProfileTargets[2313])(a0, a1);
+  _glewProfileEnd(2313, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsTransformFeedbackNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISTRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2314])(a0);
+  _glewProfileEnd(2314, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPauseTransformFeedbackNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPAUSETRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2315])();
+  _glewProfileEnd(2315, t);
+}
+
+static void GLAPIENTRY _glewProfile_glResumeTransformFeedbackNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRESUMETRANSFORMFEEDBACKNVPROC)_glewProfileTargets[2316])();
+  _glewProfileEnd(2316, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUFiniNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUFININVPROC)_glewProfileTargets[2317])();
+  _glewProfileEnd(2317, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUGetSurfaceivNV (GLvdpauSurfaceNV a0, GLenum a1, GLsizei a2, GLsizei* a3, GLint * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUGETSURFACEIVNVPROC)_glewProfileTargets[2318])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2318, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUInitNV (const void* a0, const void* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUINITNVPROC)_glewProfileTargets[2319])(a0, a1);
+  _glewProfileEnd(2319, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUIsSurfaceNV (GLvdpauSurfaceNV a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUISSURFACENVPROC)_glewProfileTargets[2320])(a0);
+  _glewProfileEnd(2320, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUMapSurfacesNV (GLsizei a0, const GLvdpauSurfaceNV* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUMAPSURFACESNVPROC)_glewProfileTargets[2321])(a0, a1);
+  _glewProfileEnd(2321, t);
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewProfile_glVDPAURegisterOutputSurfaceNV (const void* a0, GLenum a1, GLsizei a2, const GLuint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLvdpauSurfaceNV r = ((PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)_glewProfileTargets[2322])(a0, a1, a2, a3);
+  _glewProfileEnd(2322, t);
+  return r;
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewProfile_glVDPAURegisterVideoSurfaceNV (const void* a0, GLenum a1, GLsizei a2, const GLuint * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLvdpauSurfaceNV r = ((PFNGLVDPAUREGISTERVIDEOSURFACENVPROC)_glewProfileTargets[2323])(a0, a1, a2, a3);
+  _glewProfileEnd(2323, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUSurfaceAccessNV (GLvdpauSurfaceNV a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUSURFACEACCESSNVPROC)_glewProfileTargets[2324])(a0, a1);
+  _glewProfileEnd(2324, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUUnmapSurfacesNV (GLsizei a0, const GLvdpauSurfaceNV* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUUNMAPSURFACESNVPROC)_glewProfileTargets[2325])(a0, a1);
+  _glewProfileEnd(2325, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVDPAUUnregisterSurfaceNV (GLvdpauSurfaceNV a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVDPAUUNREGISTERSURFACENVPROC)_glewProfileTargets[2326])(a0);
+  _glewProfileEnd(2326, t);
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewProfile_glVDPAURegisterVideoSurfaceWithPictureStructureNV (const void * a0, GLenum a1, GLsizei a2, const GLuint * a3, GLboolean a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLvdpauSurfaceNV r = ((PFNGLVDPAUREGISTERVIDEOSURFACEWITHPICTURESTRUCTURENVPROC)_glewProfileTargets[2327])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2327, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFlushVertexArrayRangeNV (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHVERTEXARRAYRANGENVPROC)_glewProfileTargets[2328])();
+  _glewProfileEnd(2328, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexArrayRangeNV (GLsizei a0, void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXARRAYRANGENVPROC)_glewProfileTargets[2329])(a0, a1);
+  _glewProfileEnd(2329, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribLi64vNV (GLuint a0, GLenum a1, GLint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBLI64VNVPROC)_glewProfileTargets[2330])(a0, a1, a2);
+  _glewProfileEnd(2330, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribLui64vNV (GLuint a0, GLenum a1, GLuint64EXT* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBLUI64VNVPROC)_glewProfileTargets[2331])(a0, a1, a2);
+  _glewProfileEnd(2331, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1i64NV (GLuint a0, GLint64EXT a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1I64NVPROC)_glewProfileTargets[2332])(a0, a1);
+  _glewProfileEnd(2332, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1I64VNVPROC)_glewProfileTargets[2333])(a0, a1);
+  _glewProfileEnd(2333, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1ui64NV (GLuint a0, GLuint64EXT a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1UI64NVPROC)_glewProfileTargets[2334])(a0, a1);
+  _glewProfileEnd(2334, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL1ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL1UI64VNVPROC)_glewProfileTargets[2335])(a0, a1);
+  _glewProfileEnd(2335, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2i64NV (GLuint a0, GLint64EXT a1, GLint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2I64NVPROC)_glewProfileTargets[2336])(a0, a1, a2);
+  _glewProfileEnd(2336, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2I64VNVPROC)_glewProfileTargets[2337])(a0, a1);
+  _glewProfileEnd(2337, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2ui64NV (GLuint a0, GLuint64EXT a1, GLuint64EXT a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2UI64NVPROC)_glewProfileTargets[2338])(a0, a1, a2);
+  _glewProfileEnd(2338, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL2ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL2UI64VNVPROC)_glewProfileTargets[2339])(a0, a1);
+  _glewProfileEnd(2339, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3i64NV (GLuint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3I64NVPROC)_glewProfileTargets[2340])(a0, a1, a2, a3);
+  _glewProfileEnd(2340, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3I64VNVPROC)_glewProfileTargets[2341])(a0, a1);
+  _glewProfileEnd(2341, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3ui64NV (GLuint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3UI64NVPROC)_glewProfileTargets[2342])(a0, a1, a2, a3);
+  _glewProfileEnd(2342, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL3ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL3UI64VNVPROC)_glewProfileTargets[2343])(a0, a1);
+  _glewProfileEnd(2343, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4i64NV (GLuint a0, GLint64EXT a1, GLint64EXT a2, GLint64EXT a3, GLint64EXT a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4I64NVPROC)_glewProfileTargets[2344])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2344, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4i64vNV (GLuint a0, const GLint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4I64VNVPROC)_glewProfileTargets[2345])(a0, a1);
+  _glewProfileEnd(2345, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4ui64NV (GLuint a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3, GLuint64EXT a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4UI64NVPROC)_glewProfileTargets[2346])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2346, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribL4ui64vNV (GLuint a0, const GLuint64EXT* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBL4UI64VNVPROC)_glewProfileTargets[2347])(a0, a1);
+  _glewProfileEnd(2347, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribLFormatNV (GLuint a0, GLint a1, GLenum a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBLFORMATNVPROC)_glewProfileTargets[2348])(a0, a1, a2, a3);
+  _glewProfileEnd(2348, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBufferAddressRangeNV (GLenum a0, GLuint a1, GLuint64EXT a2, GLsizeiptr a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBUFFERADDRESSRANGENVPROC)_glewProfileTargets[2349])(a0, a1, a2, a3);
+  _glewProfileEnd(2349, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORFORMATNVPROC)_glewProfileTargets[2350])(a0, a1, a2);
+  _glewProfileEnd(2350, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEdgeFlagFormatNV (GLsizei a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEDGEFLAGFORMATNVPROC)_glewProfileTargets[2351])(a0);
+  _glewProfileEnd(2351, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogCoordFormatNV (GLenum a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGCOORDFORMATNVPROC)_glewProfileTargets[2352])(a0, a1);
+  _glewProfileEnd(2352, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetIntegerui64i_vNV (GLenum a0, GLuint a1, GLuint64EXT a2[])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETINTEGERUI64I_VNVPROC)_glewProfileTargets[2353])(a0, a1, a2);
+  _glewProfileEnd(2353, t);
+}
+
+static void GLAPIENTRY _glewProfile_glIndexFormatNV (GLenum a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINDEXFORMATNVPROC)_glewProfileTargets[2354])(a0, a1);
+  _glewProfileEnd(2354, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormalFormatNV (GLenum a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMALFORMATNVPROC)_glewProfileTargets[2355])(a0, a1);
+  _glewProfileEnd(2355, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSecondaryColorFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSECONDARYCOLORFORMATNVPROC)_glewProfileTargets[2356])(a0, a1, a2);
+  _glewProfileEnd(2356, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoordFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORDFORMATNVPROC)_glewProfileTargets[2357])(a0, a1, a2);
+  _glewProfileEnd(2357, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribFormatNV (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBFORMATNVPROC)_glewProfileTargets[2358])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2358, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribIFormatNV (GLuint a0, GLint a1, GLenum a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBIFORMATNVPROC)_glewProfileTargets[2359])(a0, a1, a2, a3);
+  _glewProfileEnd(2359, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexFormatNV (GLint a0, GLenum a1, GLsizei a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXFORMATNVPROC)_glewProfileTargets[2360])(a0, a1, a2);
+  _glewProfileEnd(2360, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glAreProgramsResidentNV (GLsizei a0, const GLuint* a1, GLboolean * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLAREPROGRAMSRESIDENTNVPROC)_glewProfileTargets[2361])(a0, a1, a2);
+  _glewProfileEnd(2361, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindProgramNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDPROGRAMNVPROC)_glewProfileTargets[2362])(a0, a1);
+  _glewProfileEnd(2362, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteProgramsNV (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEPROGRAMSNVPROC)_glewProfileTargets[2363])(a0, a1);
+  _glewProfileEnd(2363, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExecuteProgramNV (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXECUTEPROGRAMNVPROC)_glewProfileTargets[2364])(a0, a1, a2);
+  _glewProfileEnd(2364, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenProgramsNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENPROGRAMSNVPROC)_glewProfileTargets[2365])(a0, a1);
+  _glewProfileEnd(2365, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramParameterdvNV (GLenum a0, GLuint a1, GLenum a2, GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMPARAMETERDVNVPROC)_glewProfileTargets[2366])(a0, a1, a2, a3);
+  _glewProfileEnd(2366, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramParameterfvNV (GLenum a0, GLuint a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMPARAMETERFVNVPROC)_glewProfileTargets[2367])(a0, a1, a2, a3);
+  _glewProfileEnd(2367, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramStringNV (GLuint a0, GLenum a1, GLubyte* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMSTRINGNVPROC)_glewProfileTargets[2368])(a0, a1, a2);
+  _glewProfileEnd(2368, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMIVNVPROC)_glewProfileTargets[2369])(a0, a1, a2);
+  _glewProfileEnd(2369, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTrackMatrixivNV (GLenum a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTRACKMATRIXIVNVPROC)_glewProfileTargets[2370])(a0, a1, a2, a3);
+  _glewProfileEnd(2370, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribPointervNV (GLuint a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBPOINTERVNVPROC)_glewProfileTargets[2371])(a0, a1, a2);
+  _glewProfileEnd(2371, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribdvNV (GLuint a0, GLenum a1, GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBDVNVPROC)_glewProfileTargets[2372])(a0, a1, a2);
+  _glewProfileEnd(2372, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribfvNV (GLuint a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBFVNVPROC)_glewProfileTargets[2373])(a0, a1, a2);
+  _glewProfileEnd(2373, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVertexAttribivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVERTEXATTRIBIVNVPROC)_glewProfileTargets[2374])(a0, a1, a2);
+  _glewProfileEnd(2374, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsProgramNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISPROGRAMNVPROC)_glewProfileTargets[2375])(a0);
+  _glewProfileEnd(2375, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glLoadProgramNV (GLenum a0, GLuint a1, GLsizei a2, const GLubyte* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADPROGRAMNVPROC)_glewProfileTargets[2376])(a0, a1, a2, a3);
+  _glewProfileEnd(2376, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameter4dNV (GLenum a0, GLuint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETER4DNVPROC)_glewProfileTargets[2377])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2377, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameter4dvNV (GLenum a0, GLuint a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETER4DVNVPROC)_glewProfileTargets[2378])(a0, a1, a2);
+  _glewProfileEnd(2378, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameter4fNV (GLenum a0, GLuint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETER4FNVPROC)_glewProfileTargets[2379])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2379, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameter4fvNV (GLenum a0, GLuint a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETER4FVNVPROC)_glewProfileTargets[2380])(a0, a1, a2);
+  _glewProfileEnd(2380, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameters4dvNV (GLenum a0, GLuint a1, GLsizei a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETERS4DVNVPROC)_glewProfileTargets[2381])(a0, a1, a2, a3);
+  _glewProfileEnd(2381, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramParameters4fvNV (GLenum a0, GLuint a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMPARAMETERS4FVNVPROC)_glewProfileTargets[2382])(a0, a1, a2, a3);
+  _glewProfileEnd(2382, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRequestResidentProgramsNV (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREQUESTRESIDENTPROGRAMSNVPROC)_glewProfileTargets[2383])(a0, a1);
+  _glewProfileEnd(2383, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTrackMatrixNV (GLenum a0, GLuint a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRACKMATRIXNVPROC)_glewProfileTargets[2384])(a0, a1, a2, a3);
+  _glewProfileEnd(2384, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1dNV (GLuint a0, GLdouble a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1DNVPROC)_glewProfileTargets[2385])(a0, a1);
+  _glewProfileEnd(2385, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1dvNV (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1DVNVPROC)_glewProfileTargets[2386])(a0, a1);
+  _glewProfileEnd(2386, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1fNV (GLuint a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1FNVPROC)_glewProfileTargets[2387])(a0, a1);
+  _glewProfileEnd(2387, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1fvNV (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1FVNVPROC)_glewProfileTargets[2388])(a0, a1);
+  _glewProfileEnd(2388, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1sNV (GLuint a0, GLshort a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1SNVPROC)_glewProfileTargets[2389])(a0, a1);
+  _glewProfileEnd(2389, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib1svNV (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB1SVNVPROC)_glewProfileTargets[2390])(a0, a1);
+  _glewProfileEnd(2390, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2dNV (GLuint a0, GLdouble a1, GLdouble a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2DNVPROC)_glewProfileTargets[2391])(a0, a1, a2);
+  _glewProfileEnd(2391, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2dvNV (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2DVNVPROC)_glewProfileTargets[2392])(a0, a1);
+  _glewProfileEnd(2392, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2fNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2FNVPROC)_glewProfileTargets[2393])(a0, a1, a2);
+  _glewProfileEnd(2393, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2fvNV (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2FVNVPROC)_glewProfileTargets[2394])(a0, a1);
+  _glewProfileEnd(2394, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2sNV (GLuint a0, GLshort a1, GLshort a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2SNVPROC)_glewProfileTargets[2395])(a0, a1, a2);
+  _glewProfileEnd(2395, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib2svNV (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB2SVNVPROC)_glewProfileTargets[2396])(a0, a1);
+  _glewProfileEnd(2396, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3dNV (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3DNVPROC)_glewProfileTargets[2397])(a0, a1, a2, a3);
+  _glewProfileEnd(2397, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3dvNV (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3DVNVPROC)_glewProfileTargets[2398])(a0, a1);
+  _glewProfileEnd(2398, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3fNV (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3FNVPROC)_glewProfileTargets[2399])(a0, a1, a2, a3);
+  _glewProfileEnd(2399, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3fvNV (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3FVNVPROC)_glewProfileTargets[2400])(a0, a1);
+  _glewProfileEnd(2400, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3sNV (GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3SNVPROC)_glewProfileTargets[2401])(a0, a1, a2, a3);
+  _glewProfileEnd(2401, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib3svNV (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB3SVNVPROC)_glewProfileTargets[2402])(a0, a1);
+  _glewProfileEnd(2402, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4dNV (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4DNVPROC)_glewProfileTargets[2403])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2403, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4dvNV (GLuint a0, const GLdouble* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4DVNVPROC)_glewProfileTargets[2404])(a0, a1);
+  _glewProfileEnd(2404, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4fNV (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4FNVPROC)_glewProfileTargets[2405])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2405, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4fvNV (GLuint a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4FVNVPROC)_glewProfileTargets[2406])(a0, a1);
+  _glewProfileEnd(2406, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4sNV (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4SNVPROC)_glewProfileTargets[2407])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2407, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4svNV (GLuint a0, const GLshort* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4SVNVPROC)_glewProfileTargets[2408])(a0, a1);
+  _glewProfileEnd(2408, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4ubNV (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4UBNVPROC)_glewProfileTargets[2409])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2409, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttrib4ubvNV (GLuint a0, const GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIB4UBVNVPROC)_glewProfileTargets[2410])(a0, a1);
+  _glewProfileEnd(2410, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribPointerNV (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBPOINTERNVPROC)_glewProfileTargets[2411])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2411, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs1dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS1DVNVPROC)_glewProfileTargets[2412])(a0, a1, a2);
+  _glewProfileEnd(2412, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs1fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS1FVNVPROC)_glewProfileTargets[2413])(a0, a1, a2);
+  _glewProfileEnd(2413, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs1svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS1SVNVPROC)_glewProfileTargets[2414])(a0, a1, a2);
+  _glewProfileEnd(2414, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs2dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS2DVNVPROC)_glewProfileTargets[2415])(a0, a1, a2);
+  _glewProfileEnd(2415, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs2fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS2FVNVPROC)_glewProfileTargets[2416])(a0, a1, a2);
+  _glewProfileEnd(2416, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs2svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS2SVNVPROC)_glewProfileTargets[2417])(a0, a1, a2);
+  _glewProfileEnd(2417, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs3dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS3DVNVPROC)_glewProfileTargets[2418])(a0, a1, a2);
+  _glewProfileEnd(2418, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs3fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS3FVNVPROC)_glewProfileTargets[2419])(a0, a1, a2);
+  _glewProfileEnd(2419, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs3svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS3SVNVPROC)_glewProfileTargets[2420])(a0, a1, a2);
+  _glewProfileEnd(2420, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs4dvNV (GLuint a0, GLsizei a1, const GLdouble* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS4DVNVPROC)_glewProfileTargets[2421])(a0, a1, a2);
+  _glewProfileEnd(2421, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs4fvNV (GLuint a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS4FVNVPROC)_glewProfileTargets[2422])(a0, a1, a2);
+  _glewProfileEnd(2422, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs4svNV (GLuint a0, GLsizei a1, const GLshort* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS4SVNVPROC)_glewProfileTargets[2423])(a0, a1, a2);
+  _glewProfileEnd(2423, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVertexAttribs4ubvNV (GLuint a0, GLsizei a1, const GLubyte* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVERTEXATTRIBS4UBVNVPROC)_glewProfileTargets[2424])(a0, a1, a2);
+  _glewProfileEnd(2424, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBeginVideoCaptureNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBEGINVIDEOCAPTURENVPROC)_glewProfileTargets[2425])(a0);
+  _glewProfileEnd(2425, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVideoCaptureStreamBufferNV (GLuint a0, GLuint a1, GLenum a2, GLintptrARB a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)_glewProfileTargets[2426])(a0, a1, a2, a3);
+  _glewProfileEnd(2426, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVideoCaptureStreamTextureNV (GLuint a0, GLuint a1, GLenum a2, GLenum a3, GLuint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)_glewProfileTargets[2427])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2427, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndVideoCaptureNV (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDVIDEOCAPTURENVPROC)_glewProfileTargets[2428])(a0);
+  _glewProfileEnd(2428, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoCaptureStreamdvNV (GLuint a0, GLuint a1, GLenum a2, GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOCAPTURESTREAMDVNVPROC)_glewProfileTargets[2429])(a0, a1, a2, a3);
+  _glewProfileEnd(2429, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoCaptureStreamfvNV (GLuint a0, GLuint a1, GLenum a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOCAPTURESTREAMFVNVPROC)_glewProfileTargets[2430])(a0, a1, a2, a3);
+  _glewProfileEnd(2430, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoCaptureStreamivNV (GLuint a0, GLuint a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOCAPTURESTREAMIVNVPROC)_glewProfileTargets[2431])(a0, a1, a2, a3);
+  _glewProfileEnd(2431, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVideoCaptureivNV (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVIDEOCAPTUREIVNVPROC)_glewProfileTargets[2432])(a0, a1, a2);
+  _glewProfileEnd(2432, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glVideoCaptureNV (GLuint a0, GLuint* a1, GLuint64EXT * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLVIDEOCAPTURENVPROC)_glewProfileTargets[2433])(a0, a1, a2);
+  _glewProfileEnd(2433, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glVideoCaptureStreamParameterdvNV (GLuint a0, GLuint a1, GLenum a2, const GLdouble* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)_glewProfileTargets[2434])(a0, a1, a2, a3);
+  _glewProfileEnd(2434, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVideoCaptureStreamParameterfvNV (GLuint a0, GLuint a1, GLenum a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)_glewProfileTargets[2435])(a0, a1, a2, a3);
+  _glewProfileEnd(2435, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVideoCaptureStreamParameterivNV (GLuint a0, GLuint a1, GLenum a2, const GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)_glewProfileTargets[2436])(a0, a1, a2, a3);
+  _glewProfileEnd(2436, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangeArrayfvNV (GLuint a0, GLsizei a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEARRAYFVNVPROC)_glewProfileTargets[2437])(a0, a1, a2);
+  _glewProfileEnd(2437, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangeIndexedfNV (GLuint a0, GLfloat a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEINDEXEDFNVPROC)_glewProfileTargets[2438])(a0, a1, a2);
+  _glewProfileEnd(2438, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableiNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEINVPROC)_glewProfileTargets[2439])(a0, a1);
+  _glewProfileEnd(2439, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableiNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEINVPROC)_glewProfileTargets[2440])(a0, a1);
+  _glewProfileEnd(2440, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFloati_vNV (GLenum a0, GLuint a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFLOATI_VNVPROC)_glewProfileTargets[2441])(a0, a1, a2);
+  _glewProfileEnd(2441, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsEnablediNV (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISENABLEDINVPROC)_glewProfileTargets[2442])(a0, a1);
+  _glewProfileEnd(2442, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glScissorArrayvNV (GLuint a0, GLsizei a1, const GLint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSORARRAYVNVPROC)_glewProfileTargets[2443])(a0, a1, a2);
+  _glewProfileEnd(2443, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorIndexedNV (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSORINDEXEDNVPROC)_glewProfileTargets[2444])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2444, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScissorIndexedvNV (GLuint a0, const GLint * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCISSORINDEXEDVNVPROC)_glewProfileTargets[2445])(a0, a1);
+  _glewProfileEnd(2445, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportArrayvNV (GLuint a0, GLsizei a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTARRAYVNVPROC)_glewProfileTargets[2446])(a0, a1, a2);
+  _glewProfileEnd(2446, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportIndexedfNV (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTINDEXEDFNVPROC)_glewProfileTargets[2447])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2447, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportIndexedfvNV (GLuint a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTINDEXEDFVNVPROC)_glewProfileTargets[2448])(a0, a1);
+  _glewProfileEnd(2448, t);
+}
+
+static void GLAPIENTRY _glewProfile_glViewportSwizzleNV (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVIEWPORTSWIZZLENVPROC)_glewProfileTargets[2449])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2449, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEGLImageTargetRenderbufferStorageOES (GLenum a0, GLeglImageOES a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)_glewProfileTargets[2450])(a0, a1);
+  _glewProfileEnd(2450, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEGLImageTargetTexture2DOES (GLenum a0, GLeglImageOES a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEGLIMAGETARGETTEXTURE2DOESPROC)_glewProfileTargets[2451])(a0, a1);
+  _glewProfileEnd(2451, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparateOES (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEOESPROC)_glewProfileTargets[2452])(a0, a1);
+  _glewProfileEnd(2452, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparateOES (GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEOESPROC)_glewProfileTargets[2453])(a0, a1, a2, a3);
+  _glewProfileEnd(2453, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationOES (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONOESPROC)_glewProfileTargets[2454])(a0);
+  _glewProfileEnd(2454, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyImageSubDataOES (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYIMAGESUBDATAOESPROC)_glewProfileTargets[2455])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+  _glewProfileEnd(2455, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationSeparateiOES (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONSEPARATEIOESPROC)_glewProfileTargets[2456])(a0, a1, a2);
+  _glewProfileEnd(2456, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendEquationiOES (GLuint a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDEQUATIONIOESPROC)_glewProfileTargets[2457])(a0, a1);
+  _glewProfileEnd(2457, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFuncSeparateiOES (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCSEPARATEIOESPROC)_glewProfileTargets[2458])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2458, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBlendFunciOES (GLuint a0, GLenum a1, GLenum a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBLENDFUNCIOESPROC)_glewProfileTargets[2459])(a0, a1, a2);
+  _glewProfileEnd(2459, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorMaskiOES (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORMASKIOESPROC)_glewProfileTargets[2460])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2460, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableiOES (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEIOESPROC)_glewProfileTargets[2461])(a0, a1);
+  _glewProfileEnd(2461, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableiOES (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEIOESPROC)_glewProfileTargets[2462])(a0, a1);
+  _glewProfileEnd(2462, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsEnablediOES (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISENABLEDIOESPROC)_glewProfileTargets[2463])(a0, a1);
+  _glewProfileEnd(2463, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindFramebufferOES (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDFRAMEBUFFEROESPROC)_glewProfileTargets[2464])(a0, a1);
+  _glewProfileEnd(2464, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindRenderbufferOES (GLenum a0, GLuint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDRENDERBUFFEROESPROC)_glewProfileTargets[2465])(a0, a1);
+  _glewProfileEnd(2465, t);
+}
+
+static GLenum GLAPIENTRY _glewProfile_glCheckFramebufferStatusOES (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLenum r = ((PFNGLCHECKFRAMEBUFFERSTATUSOESPROC)_glewProfileTargets[2466])(a0);
+  _glewProfileEnd(2466, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteFramebuffersOES (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEFRAMEBUFFERSOESPROC)_glewProfileTargets[2467])(a0, a1);
+  _glewProfileEnd(2467, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteRenderbuffersOES (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETERENDERBUFFERSOESPROC)_glewProfileTargets[2468])(a0, a1);
+  _glewProfileEnd(2468, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferRenderbufferOES (GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERRENDERBUFFEROESPROC)_glewProfileTargets[2469])(a0, a1, a2, a3);
+  _glewProfileEnd(2469, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture2DOES (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE2DOESPROC)_glewProfileTargets[2470])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2470, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenFramebuffersOES (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENFRAMEBUFFERSOESPROC)_glewProfileTargets[2471])(a0, a1);
+  _glewProfileEnd(2471, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenRenderbuffersOES (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENRENDERBUFFERSOESPROC)_glewProfileTargets[2472])(a0, a1);
+  _glewProfileEnd(2472, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenerateMipmapOES (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENERATEMIPMAPOESPROC)_glewProfileTargets[2473])(a0);
+  _glewProfileEnd(2473, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFramebufferAttachmentParameterivOES (GLenum a0, GLenum a1, GLenum a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVOESPROC)_glewProfileTargets[2474])(a0, a1, a2, a3);
+  _glewProfileEnd(2474, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetRenderbufferParameterivOES (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETRENDERBUFFERPARAMETERIVOESPROC)_glewProfileTargets[2475])(a0, a1, a2);
+  _glewProfileEnd(2475, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsFramebufferOES (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISFRAMEBUFFEROESPROC)_glewProfileTargets[2476])(a0);
+  _glewProfileEnd(2476, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsRenderbufferOES (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISRENDERBUFFEROESPROC)_glewProfileTargets[2477])(a0);
+  _glewProfileEnd(2477, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glRenderbufferStorageOES (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLRENDERBUFFERSTORAGEOESPROC)_glewProfileTargets[2478])(a0, a1, a2, a3);
+  _glewProfileEnd(2478, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetProgramBinaryOES (GLuint a0, GLsizei a1, GLsizei* a2, GLenum * a3, void* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPROGRAMBINARYOESPROC)_glewProfileTargets[2479])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2479, t);
+}
+
+static void GLAPIENTRY _glewProfile_glProgramBinaryOES (GLuint a0, GLenum a1, const void * a2, GLint a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPROGRAMBINARYOESPROC)_glewProfileTargets[2480])(a0, a1, a2, a3);
+  _glewProfileEnd(2480, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetBufferPointervOES (GLenum a0, GLenum a1, void** a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETBUFFERPOINTERVOESPROC)_glewProfileTargets[2481])(a0, a1, a2);
+  _glewProfileEnd(2481, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glMapBufferOES (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLMAPBUFFEROESPROC)_glewProfileTargets[2482])(a0, a1);
+  _glewProfileEnd(2482, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glUnmapBufferOES (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLUNMAPBUFFEROESPROC)_glewProfileTargets[2483])(a0);
+  _glewProfileEnd(2483, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glCurrentPaletteMatrixOES (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCURRENTPALETTEMATRIXOESPROC)_glewProfileTargets[2484])(a0);
+  _glewProfileEnd(2484, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMatrixIndexPointerOES (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATRIXINDEXPOINTEROESPROC)_glewProfileTargets[2485])(a0, a1, a2, a3);
+  _glewProfileEnd(2485, t);
+}
+
+static void GLAPIENTRY _glewProfile_glWeightPointerOES (GLint a0, GLenum a1, GLsizei a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLWEIGHTPOINTEROESPROC)_glewProfileTargets[2486])(a0, a1, a2, a3);
+  _glewProfileEnd(2486, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMinSampleShadingOES (GLfloat a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMINSAMPLESHADINGOESPROC)_glewProfileTargets[2487])(a0);
+  _glewProfileEnd(2487, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearDepthfOES (GLclampf a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARDEPTHFOESPROC)_glewProfileTargets[2488])(a0);
+  _glewProfileEnd(2488, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClipPlanefOES (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIPPLANEFOESPROC)_glewProfileTargets[2489])(a0, a1);
+  _glewProfileEnd(2489, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangefOES (GLclampf a0, GLclampf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEFOESPROC)_glewProfileTargets[2490])(a0, a1);
+  _glewProfileEnd(2490, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFrustumfOES (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRUSTUMFOESPROC)_glewProfileTargets[2491])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2491, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetClipPlanefOES (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCLIPPLANEFOESPROC)_glewProfileTargets[2492])(a0, a1);
+  _glewProfileEnd(2492, t);
+}
+
+static void GLAPIENTRY _glewProfile_glOrthofOES (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLORTHOFOESPROC)_glewProfileTargets[2493])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2493, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexImage3DOES (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXIMAGE3DOESPROC)_glewProfileTargets[2494])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2494, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCompressedTexSubImage3DOES (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOMPRESSEDTEXSUBIMAGE3DOESPROC)_glewProfileTargets[2495])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2495, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyTexSubImage3DOES (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYTEXSUBIMAGE3DOESPROC)_glewProfileTargets[2496])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2496, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTexture3DOES (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTURE3DOESPROC)_glewProfileTargets[2497])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2497, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage3DOES (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE3DOESPROC)_glewProfileTargets[2498])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2498, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage3DOES (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE3DOESPROC)_glewProfileTargets[2499])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2499, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterIivOES (GLuint a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIIVOESPROC)_glewProfileTargets[2500])(a0, a1, a2);
+  _glewProfileEnd(2500, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSamplerParameterIuivOES (GLuint a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSAMPLERPARAMETERIUIVOESPROC)_glewProfileTargets[2501])(a0, a1, a2);
+  _glewProfileEnd(2501, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterIivOES (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERIIVOESPROC)_glewProfileTargets[2502])(a0, a1, a2);
+  _glewProfileEnd(2502, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterIuivOES (GLenum a0, GLenum a1, GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERIUIVOESPROC)_glewProfileTargets[2503])(a0, a1, a2);
+  _glewProfileEnd(2503, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterIivOES (GLuint a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIIVOESPROC)_glewProfileTargets[2504])(a0, a1, a2);
+  _glewProfileEnd(2504, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplerParameterIuivOES (GLuint a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLERPARAMETERIUIVOESPROC)_glewProfileTargets[2505])(a0, a1, a2);
+  _glewProfileEnd(2505, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterIivOES (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERIIVOESPROC)_glewProfileTargets[2506])(a0, a1, a2);
+  _glewProfileEnd(2506, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterIuivOES (GLenum a0, GLenum a1, const GLuint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERIUIVOESPROC)_glewProfileTargets[2507])(a0, a1, a2);
+  _glewProfileEnd(2507, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBufferOES (GLenum a0, GLenum a1, GLuint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUFFEROESPROC)_glewProfileTargets[2508])(a0, a1, a2);
+  _glewProfileEnd(2508, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexBufferRangeOES (GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXBUFFERRANGEOESPROC)_glewProfileTargets[2509])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2509, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexGenfvOES (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXGENFVOESPROC)_glewProfileTargets[2510])(a0, a1, a2);
+  _glewProfileEnd(2510, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexGenivOES (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXGENIVOESPROC)_glewProfileTargets[2511])(a0, a1, a2);
+  _glewProfileEnd(2511, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexGenxvOES (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXGENXVOESPROC)_glewProfileTargets[2512])(a0, a1, a2);
+  _glewProfileEnd(2512, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexGenfOES (GLenum a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXGENFOESPROC)_glewProfileTargets[2513])(a0, a1, a2);
+  _glewProfileEnd(2513, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexGenfvOES (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXGENFVOESPROC)_glewProfileTargets[2514])(a0, a1, a2);
+  _glewProfileEnd(2514, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexGeniOES (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXGENIOESPROC)_glewProfileTargets[2515])(a0, a1, a2);
+  _glewProfileEnd(2515, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexGenivOES (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXGENIVOESPROC)_glewProfileTargets[2516])(a0, a1, a2);
+  _glewProfileEnd(2516, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexGenxOES (GLenum a0, GLenum a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXGENXOESPROC)_glewProfileTargets[2517])(a0, a1, a2);
+  _glewProfileEnd(2517, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexGenxvOES (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXGENXVOESPROC)_glewProfileTargets[2518])(a0, a1, a2);
+  _glewProfileEnd(2518, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexStorage3DMultisampleOES (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSTORAGE3DMULTISAMPLEOESPROC)_glewProfileTargets[2519])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2519, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureViewOES (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREVIEWOESPROC)_glewProfileTargets[2520])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2520, t);
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexArrayOES (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXARRAYOESPROC)_glewProfileTargets[2521])(a0);
+  _glewProfileEnd(2521, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteVertexArraysOES (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEVERTEXARRAYSOESPROC)_glewProfileTargets[2522])(a0, a1);
+  _glewProfileEnd(2522, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenVertexArraysOES (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENVERTEXARRAYSOESPROC)_glewProfileTargets[2523])(a0, a1);
+  _glewProfileEnd(2523, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsVertexArrayOES (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISVERTEXARRAYOESPROC)_glewProfileTargets[2524])(a0);
+  _glewProfileEnd(2524, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureMultiviewOVR (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)_glewProfileTargets[2525])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2525, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNamedFramebufferTextureMultiviewOVR (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4, GLsizei a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNAMEDFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)_glewProfileTargets[2526])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2526, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferTextureMultisampleMultiviewOVR (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLsizei a4, GLint a5, GLsizei a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC)_glewProfileTargets[2527])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2527, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAlphaFuncQCOM (GLenum a0, GLclampf a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALPHAFUNCQCOMPROC)_glewProfileTargets[2528])(a0, a1);
+  _glewProfileEnd(2528, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDisableDriverControlQCOM (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDISABLEDRIVERCONTROLQCOMPROC)_glewProfileTargets[2529])(a0);
+  _glewProfileEnd(2529, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEnableDriverControlQCOM (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENABLEDRIVERCONTROLQCOMPROC)_glewProfileTargets[2530])(a0);
+  _glewProfileEnd(2530, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetDriverControlStringQCOM (GLuint a0, GLsizei a1, GLsizei* a2, GLchar * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETDRIVERCONTROLSTRINGQCOMPROC)_glewProfileTargets[2531])(a0, a1, a2, a3);
+  _glewProfileEnd(2531, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetDriverControlsQCOM (GLint* a0, GLsizei a1, GLuint * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETDRIVERCONTROLSQCOMPROC)_glewProfileTargets[2532])(a0, a1, a2);
+  _glewProfileEnd(2532, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetBufferPointervQCOM (GLenum a0, void** a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETBUFFERPOINTERVQCOMPROC)_glewProfileTargets[2533])(a0, a1);
+  _glewProfileEnd(2533, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetBuffersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETBUFFERSQCOMPROC)_glewProfileTargets[2534])(a0, a1, a2);
+  _glewProfileEnd(2534, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetFramebuffersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETFRAMEBUFFERSQCOMPROC)_glewProfileTargets[2535])(a0, a1, a2);
+  _glewProfileEnd(2535, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetRenderbuffersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETRENDERBUFFERSQCOMPROC)_glewProfileTargets[2536])(a0, a1, a2);
+  _glewProfileEnd(2536, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetTexLevelParameterivQCOM (GLuint a0, GLenum a1, GLint a2, GLenum a3, GLint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETTEXLEVELPARAMETERIVQCOMPROC)_glewProfileTargets[2537])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2537, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetTexSubImageQCOM (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETTEXSUBIMAGEQCOMPROC)_glewProfileTargets[2538])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2538, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetTexturesQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETTEXTURESQCOMPROC)_glewProfileTargets[2539])(a0, a1, a2);
+  _glewProfileEnd(2539, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtTexObjectStateOverrideiQCOM (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTTEXOBJECTSTATEOVERRIDEIQCOMPROC)_glewProfileTargets[2540])(a0, a1, a2);
+  _glewProfileEnd(2540, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetProgramBinarySourceQCOM (GLuint a0, GLenum a1, GLchar* a2, GLint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETPROGRAMBINARYSOURCEQCOMPROC)_glewProfileTargets[2541])(a0, a1, a2, a3);
+  _glewProfileEnd(2541, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetProgramsQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETPROGRAMSQCOMPROC)_glewProfileTargets[2542])(a0, a1, a2);
+  _glewProfileEnd(2542, t);
+}
+
+static void GLAPIENTRY _glewProfile_glExtGetShadersQCOM (GLuint* a0, GLint a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLEXTGETSHADERSQCOMPROC)_glewProfileTargets[2543])(a0, a1, a2);
+  _glewProfileEnd(2543, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glExtIsProgramBinaryQCOM (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLEXTISPROGRAMBINARYQCOMPROC)_glewProfileTargets[2544])(a0);
+  _glewProfileEnd(2544, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferFoveationConfigQCOM (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint* a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERFOVEATIONCONFIGQCOMPROC)_glewProfileTargets[2545])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2545, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferFoveationParametersQCOM (GLuint a0, GLuint a1, GLuint a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERFOVEATIONPARAMETERSQCOMPROC)_glewProfileTargets[2546])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2546, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFramebufferFetchBarrierQCOM (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC)_glewProfileTargets[2547])();
+  _glewProfileEnd(2547, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureFoveationParametersQCOM (GLuint a0, GLuint a1, GLuint a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREFOVEATIONPARAMETERSQCOMPROC)_glewProfileTargets[2548])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2548, t);
+}
+
+static void GLAPIENTRY _glewProfile_glEndTilingQCOM (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLENDTILINGQCOMPROC)_glewProfileTargets[2549])(a0);
+  _glewProfileEnd(2549, t);
+}
+
+static void GLAPIENTRY _glewProfile_glStartTilingQCOM (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLbitfield a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSTARTTILINGQCOMPROC)_glewProfileTargets[2550])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2550, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAlphaFuncx (GLenum a0, GLclampx a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALPHAFUNCXPROC)_glewProfileTargets[2551])(a0, a1);
+  _glewProfileEnd(2551, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearColorx (GLclampx a0, GLclampx a1, GLclampx a2, GLclampx a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARCOLORXPROC)_glewProfileTargets[2552])(a0, a1, a2, a3);
+  _glewProfileEnd(2552, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClearDepthx (GLclampx a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLEARDEPTHXPROC)_glewProfileTargets[2553])(a0);
+  _glewProfileEnd(2553, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4x (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4XPROC)_glewProfileTargets[2554])(a0, a1, a2, a3);
+  _glewProfileEnd(2554, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDepthRangex (GLclampx a0, GLclampx a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEPTHRANGEXPROC)_glewProfileTargets[2555])(a0, a1);
+  _glewProfileEnd(2555, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogx (GLenum a0, GLfixed a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGXPROC)_glewProfileTargets[2556])(a0, a1);
+  _glewProfileEnd(2556, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogxv (GLenum a0, const GLfixed* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGXVPROC)_glewProfileTargets[2557])(a0, a1);
+  _glewProfileEnd(2557, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFrustumf (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRUSTUMFPROC)_glewProfileTargets[2558])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2558, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFrustumx (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3, GLfixed a4, GLfixed a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRUSTUMXPROC)_glewProfileTargets[2559])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2559, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLightModelx (GLenum a0, GLfixed a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLIGHTMODELXPROC)_glewProfileTargets[2560])(a0, a1);
+  _glewProfileEnd(2560, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLightModelxv (GLenum a0, const GLfixed* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLIGHTMODELXVPROC)_glewProfileTargets[2561])(a0, a1);
+  _glewProfileEnd(2561, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLightx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLIGHTXPROC)_glewProfileTargets[2562])(a0, a1, a2);
+  _glewProfileEnd(2562, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLightxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLIGHTXVPROC)_glewProfileTargets[2563])(a0, a1, a2);
+  _glewProfileEnd(2563, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLineWidthx (GLfixed a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLINEWIDTHXPROC)_glewProfileTargets[2564])(a0);
+  _glewProfileEnd(2564, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLoadMatrixx (const GLfixed* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADMATRIXXPROC)_glewProfileTargets[2565])(a0);
+  _glewProfileEnd(2565, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMaterialx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATERIALXPROC)_glewProfileTargets[2566])(a0, a1, a2);
+  _glewProfileEnd(2566, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMaterialxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMATERIALXVPROC)_glewProfileTargets[2567])(a0, a1, a2);
+  _glewProfileEnd(2567, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultMatrixx (const GLfixed* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTMATRIXXPROC)_glewProfileTargets[2568])(a0);
+  _glewProfileEnd(2568, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultiTexCoord4x (GLenum a0, GLfixed a1, GLfixed a2, GLfixed a3, GLfixed a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTITEXCOORD4XPROC)_glewProfileTargets[2569])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2569, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormal3x (GLfixed a0, GLfixed a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMAL3XPROC)_glewProfileTargets[2570])(a0, a1, a2);
+  _glewProfileEnd(2570, t);
+}
+
+static void GLAPIENTRY _glewProfile_glOrthof (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLORTHOFPROC)_glewProfileTargets[2571])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2571, t);
+}
+
+static void GLAPIENTRY _glewProfile_glOrthox (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3, GLfixed a4, GLfixed a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLORTHOXPROC)_glewProfileTargets[2572])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2572, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointSizex (GLfixed a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTSIZEXPROC)_glewProfileTargets[2573])(a0);
+  _glewProfileEnd(2573, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPolygonOffsetx (GLfixed a0, GLfixed a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOLYGONOFFSETXPROC)_glewProfileTargets[2574])(a0, a1);
+  _glewProfileEnd(2574, t);
+}
+
+static void GLAPIENTRY _glewProfile_glRotatex (GLfixed a0, GLfixed a1, GLfixed a2, GLfixed a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLROTATEXPROC)_glewProfileTargets[2575])(a0, a1, a2, a3);
+  _glewProfileEnd(2575, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleCoveragex (GLclampx a0, GLboolean a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLECOVERAGEXPROC)_glewProfileTargets[2576])(a0, a1);
+  _glewProfileEnd(2576, t);
+}
+
+static void GLAPIENTRY _glewProfile_glScalex (GLfixed a0, GLfixed a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSCALEXPROC)_glewProfileTargets[2577])(a0, a1, a2);
+  _glewProfileEnd(2577, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexEnvx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXENVXPROC)_glewProfileTargets[2578])(a0, a1, a2);
+  _glewProfileEnd(2578, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexEnvxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXENVXVPROC)_glewProfileTargets[2579])(a0, a1, a2);
+  _glewProfileEnd(2579, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterx (GLenum a0, GLenum a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERXPROC)_glewProfileTargets[2580])(a0, a1, a2);
+  _glewProfileEnd(2580, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTranslatex (GLfixed a0, GLfixed a1, GLfixed a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTRANSLATEXPROC)_glewProfileTargets[2581])(a0, a1, a2);
+  _glewProfileEnd(2581, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClipPlanef (GLenum a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIPPLANEFPROC)_glewProfileTargets[2582])(a0, a1);
+  _glewProfileEnd(2582, t);
+}
+
+static void GLAPIENTRY _glewProfile_glClipPlanex (GLenum a0, const GLfixed* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCLIPPLANEXPROC)_glewProfileTargets[2583])(a0, a1);
+  _glewProfileEnd(2583, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetClipPlanef (GLenum a0, GLfloat a1[4])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCLIPPLANEFPROC)_glewProfileTargets[2584])(a0, a1);
+  _glewProfileEnd(2584, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetClipPlanex (GLenum a0, GLfixed a1[4])
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCLIPPLANEXPROC)_glewProfileTargets[2585])(a0, a1);
+  _glewProfileEnd(2585, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFixedv (GLenum a0, GLfixed* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFIXEDVPROC)_glewProfileTargets[2586])(a0, a1);
+  _glewProfileEnd(2586, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetLightxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETLIGHTXVPROC)_glewProfileTargets[2587])(a0, a1, a2);
+  _glewProfileEnd(2587, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMaterialxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMATERIALXVPROC)_glewProfileTargets[2588])(a0, a1, a2);
+  _glewProfileEnd(2588, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexEnvxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXENVXVPROC)_glewProfileTargets[2589])(a0, a1, a2);
+  _glewProfileEnd(2589, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexParameterxv (GLenum a0, GLenum a1, GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXPARAMETERXVPROC)_glewProfileTargets[2590])(a0, a1, a2);
+  _glewProfileEnd(2590, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterx (GLenum a0, GLfixed a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERXPROC)_glewProfileTargets[2591])(a0, a1);
+  _glewProfileEnd(2591, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointParameterxv (GLenum a0, const GLfixed* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTPARAMETERXVPROC)_glewProfileTargets[2592])(a0, a1);
+  _glewProfileEnd(2592, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPointSizePointerOES (GLenum a0, GLsizei a1, const void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPOINTSIZEPOINTEROESPROC)_glewProfileTargets[2593])(a0, a1, a2);
+  _glewProfileEnd(2593, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexParameterxv (GLenum a0, GLenum a1, const GLfixed* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXPARAMETERXVPROC)_glewProfileTargets[2594])(a0, a1, a2);
+  _glewProfileEnd(2594, t);
+}
+
+static const GLchar* GLAPIENTRY _glewProfile_glErrorStringREGAL (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  const GLchar* r = ((PFNGLERRORSTRINGREGALPROC)_glewProfileTargets[2595])(a0);
+  _glewProfileEnd(2595, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glGetExtensionREGAL (const GLchar* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLGETEXTENSIONREGALPROC)_glewProfileTargets[2596])(a0);
+  _glewProfileEnd(2596, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsSupportedREGAL (const GLchar* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISSUPPORTEDREGALPROC)_glewProfileTargets[2597])(a0);
+  _glewProfileEnd(2597, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glLogMessageCallbackREGAL (GLLOGPROCREGAL a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOGMESSAGECALLBACKREGALPROC)_glewProfileTargets[2598])(a0);
+  _glewProfileEnd(2598, t);
+}
+
+static void * GLAPIENTRY _glewProfile_glGetProcAddressREGAL (const GLchar * a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  void * r = ((PFNGLGETPROCADDRESSREGALPROC)_glewProfileTargets[2599])(a0);
+  _glewProfileEnd(2599, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glDetailTexFuncSGIS (GLenum a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDETAILTEXFUNCSGISPROC)_glewProfileTargets[2600])(a0, a1, a2);
+  _glewProfileEnd(2600, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetDetailTexFuncSGIS (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETDETAILTEXFUNCSGISPROC)_glewProfileTargets[2601])(a0, a1);
+  _glewProfileEnd(2601, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogFuncSGIS (GLsizei a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGFUNCSGISPROC)_glewProfileTargets[2602])(a0, a1);
+  _glewProfileEnd(2602, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFogFuncSGIS (GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFOGFUNCSGISPROC)_glewProfileTargets[2603])(a0);
+  _glewProfileEnd(2603, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSampleMaskSGIS (GLclampf a0, GLboolean a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEMASKSGISPROC)_glewProfileTargets[2604])(a0, a1);
+  _glewProfileEnd(2604, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSamplePatternSGIS (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSAMPLEPATTERNSGISPROC)_glewProfileTargets[2605])(a0);
+  _glewProfileEnd(2605, t);
+}
+
+static void GLAPIENTRY _glewProfile_glInterleavedTextureCoordSetsSGIS (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLINTERLEAVEDTEXTURECOORDSETSSGISPROC)_glewProfileTargets[2606])(a0);
+  _glewProfileEnd(2606, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSelectTextureCoordSetSGIS (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSELECTTEXTURECOORDSETSGISPROC)_glewProfileTargets[2607])(a0);
+  _glewProfileEnd(2607, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSelectTextureSGIS (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSELECTTEXTURESGISPROC)_glewProfileTargets[2608])(a0);
+  _glewProfileEnd(2608, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSelectTextureTransformSGIS (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSELECTTEXTURETRANSFORMSGISPROC)_glewProfileTargets[2609])(a0);
+  _glewProfileEnd(2609, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMultisampleSubRectPosSGIS (GLint a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMULTISAMPLESUBRECTPOSSGISPROC)_glewProfileTargets[2610])(a0, a1);
+  _glewProfileEnd(2610, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetSharpenTexFuncSGIS (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETSHARPENTEXFUNCSGISPROC)_glewProfileTargets[2611])(a0, a1);
+  _glewProfileEnd(2611, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSharpenTexFuncSGIS (GLenum a0, GLsizei a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSHARPENTEXFUNCSGISPROC)_glewProfileTargets[2612])(a0, a1, a2);
+  _glewProfileEnd(2612, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexImage4DSGIS (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLsizei a6, GLint a7, GLenum a8, GLenum a9, const void * a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXIMAGE4DSGISPROC)_glewProfileTargets[2613])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2613, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexSubImage4DSGIS (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7, GLsizei a8, GLsizei a9, GLenum a10, GLenum a11, const void * a12)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXSUBIMAGE4DSGISPROC)_glewProfileTargets[2614])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+  _glewProfileEnd(2614, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetTexFilterFuncSGIS (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETTEXFILTERFUNCSGISPROC)_glewProfileTargets[2615])(a0, a1, a2);
+  _glewProfileEnd(2615, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexFilterFuncSGIS (GLenum a0, GLenum a1, GLsizei a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXFILTERFUNCSGISPROC)_glewProfileTargets[2616])(a0, a1, a2, a3);
+  _glewProfileEnd(2616, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAsyncMarkerSGIX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLASYNCMARKERSGIXPROC)_glewProfileTargets[2617])(a0);
+  _glewProfileEnd(2617, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteAsyncMarkersSGIX (GLuint a0, GLsizei a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEASYNCMARKERSSGIXPROC)_glewProfileTargets[2618])(a0, a1);
+  _glewProfileEnd(2618, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glFinishAsyncSGIX (GLuint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLFINISHASYNCSGIXPROC)_glewProfileTargets[2619])(a0);
+  _glewProfileEnd(2619, t);
+  return r;
+}
+
+static GLuint GLAPIENTRY _glewProfile_glGenAsyncMarkersSGIX (GLsizei a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLuint r = ((PFNGLGENASYNCMARKERSSGIXPROC)_glewProfileTargets[2620])(a0);
+  _glewProfileEnd(2620, t);
+  return r;
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsAsyncMarkerSGIX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISASYNCMARKERSGIXPROC)_glewProfileTargets[2621])(a0);
+  _glewProfileEnd(2621, t);
+  return r;
+}
+
+static GLint GLAPIENTRY _glewProfile_glPollAsyncSGIX (GLuint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLPOLLASYNCSGIXPROC)_glewProfileTargets[2622])(a0);
+  _glewProfileEnd(2622, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glAddressSpace (GLenum a0, GLbitfield a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLADDRESSSPACEPROC)_glewProfileTargets[2623])(a0, a1);
+  _glewProfileEnd(2623, t);
+}
+
+static GLint GLAPIENTRY _glewProfile_glDataPipe (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLint r = ((PFNGLDATAPIPEPROC)_glewProfileTargets[2624])(a0);
+  _glewProfileEnd(2624, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glFlushRasterSGIX (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFLUSHRASTERSGIXPROC)_glewProfileTargets[2625])();
+  _glewProfileEnd(2625, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFogLayersSGIX (GLsizei a0, const GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFOGLAYERSSGIXPROC)_glewProfileTargets[2626])(a0, a1);
+  _glewProfileEnd(2626, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFogLayersSGIX (GLfloat* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFOGLAYERSSGIXPROC)_glewProfileTargets[2627])(a0);
+  _glewProfileEnd(2627, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTextureFogSGIX (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXTUREFOGSGIXPROC)_glewProfileTargets[2628])(a0);
+  _glewProfileEnd(2628, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentColorMaterialSGIX (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTCOLORMATERIALSGIXPROC)_glewProfileTargets[2629])(a0, a1);
+  _glewProfileEnd(2629, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModelfSGIX (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELFSGIXPROC)_glewProfileTargets[2630])(a0, a1);
+  _glewProfileEnd(2630, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModelfvSGIX (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELFVSGIXPROC)_glewProfileTargets[2631])(a0, a1);
+  _glewProfileEnd(2631, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModeliSGIX (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELISGIXPROC)_glewProfileTargets[2632])(a0, a1);
+  _glewProfileEnd(2632, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightModelivSGIX (GLenum a0, GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTMODELIVSGIXPROC)_glewProfileTargets[2633])(a0, a1);
+  _glewProfileEnd(2633, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightfSGIX (GLenum a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTFSGIXPROC)_glewProfileTargets[2634])(a0, a1, a2);
+  _glewProfileEnd(2634, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTFVSGIXPROC)_glewProfileTargets[2635])(a0, a1, a2);
+  _glewProfileEnd(2635, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightiSGIX (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTISGIXPROC)_glewProfileTargets[2636])(a0, a1, a2);
+  _glewProfileEnd(2636, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentLightivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTLIGHTIVSGIXPROC)_glewProfileTargets[2637])(a0, a1, a2);
+  _glewProfileEnd(2637, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialfSGIX (GLenum a0, GLenum a1, const GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALFSGIXPROC)_glewProfileTargets[2638])(a0, a1, a2);
+  _glewProfileEnd(2638, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialfvSGIX (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALFVSGIXPROC)_glewProfileTargets[2639])(a0, a1, a2);
+  _glewProfileEnd(2639, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialiSGIX (GLenum a0, GLenum a1, const GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALISGIXPROC)_glewProfileTargets[2640])(a0, a1, a2);
+  _glewProfileEnd(2640, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFragmentMaterialivSGIX (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAGMENTMATERIALIVSGIXPROC)_glewProfileTargets[2641])(a0, a1, a2);
+  _glewProfileEnd(2641, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentLightfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTLIGHTFVSGIXPROC)_glewProfileTargets[2642])(a0, a1, a2);
+  _glewProfileEnd(2642, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentLightivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTLIGHTIVSGIXPROC)_glewProfileTargets[2643])(a0, a1, a2);
+  _glewProfileEnd(2643, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentMaterialfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTMATERIALFVSGIXPROC)_glewProfileTargets[2644])(a0, a1, a2);
+  _glewProfileEnd(2644, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetFragmentMaterialivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETFRAGMENTMATERIALIVSGIXPROC)_glewProfileTargets[2645])(a0, a1, a2);
+  _glewProfileEnd(2645, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFrameZoomSGIX (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFRAMEZOOMSGIXPROC)_glewProfileTargets[2646])(a0);
+  _glewProfileEnd(2646, t);
+}
+
+static void GLAPIENTRY _glewProfile_glIglooInterfaceSGIX (GLenum a0, void * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLIGLOOINTERFACESGIXPROC)_glewProfileTargets[2647])(a0, a1);
+  _glewProfileEnd(2647, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAllocMPEGPredictorsSGIX (GLsizei a0, GLsizei a1, GLsizei a2, GLuint* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLALLOCMPEGPREDICTORSSGIXPROC)_glewProfileTargets[2648])(a0, a1, a2, a3);
+  _glewProfileEnd(2648, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteMPEGPredictorsSGIX (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEMPEGPREDICTORSSGIXPROC)_glewProfileTargets[2649])(a0, a1);
+  _glewProfileEnd(2649, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenMPEGPredictorsSGIX (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENMPEGPREDICTORSSGIXPROC)_glewProfileTargets[2650])(a0, a1);
+  _glewProfileEnd(2650, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMPEGParameterfvSGIX (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMPEGPARAMETERFVSGIXPROC)_glewProfileTargets[2651])(a0, a1, a2);
+  _glewProfileEnd(2651, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMPEGParameterivSGIX (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMPEGPARAMETERIVSGIXPROC)_glewProfileTargets[2652])(a0, a1, a2);
+  _glewProfileEnd(2652, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMPEGPredictorSGIX (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMPEGPREDICTORSGIXPROC)_glewProfileTargets[2653])(a0, a1, a2, a3);
+  _glewProfileEnd(2653, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetMPEGQuantTableubv (GLenum a0, GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETMPEGQUANTTABLEUBVPROC)_glewProfileTargets[2654])(a0, a1);
+  _glewProfileEnd(2654, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsMPEGPredictorSGIX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISMPEGPREDICTORSGIXPROC)_glewProfileTargets[2655])(a0);
+  _glewProfileEnd(2655, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glMPEGPredictorSGIX (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMPEGPREDICTORSGIXPROC)_glewProfileTargets[2656])(a0, a1, a2, a3);
+  _glewProfileEnd(2656, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMPEGQuantTableubv (GLenum a0, GLubyte* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMPEGQUANTTABLEUBVPROC)_glewProfileTargets[2657])(a0, a1);
+  _glewProfileEnd(2657, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSwapMPEGPredictorsSGIX (GLenum a0, GLenum a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSWAPMPEGPREDICTORSSGIXPROC)_glewProfileTargets[2658])(a0, a1);
+  _glewProfileEnd(2658, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNonlinLightfvSGIX (GLenum a0, GLenum a1, GLint* a2, GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNONLINLIGHTFVSGIXPROC)_glewProfileTargets[2659])(a0, a1, a2, a3);
+  _glewProfileEnd(2659, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetNonlinMaterialfvSGIX (GLenum a0, GLenum a1, GLint* a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETNONLINMATERIALFVSGIXPROC)_glewProfileTargets[2660])(a0, a1, a2, a3);
+  _glewProfileEnd(2660, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNonlinLightfvSGIX (GLenum a0, GLenum a1, GLint a2, GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNONLINLIGHTFVSGIXPROC)_glewProfileTargets[2661])(a0, a1, a2, a3);
+  _glewProfileEnd(2661, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNonlinMaterialfvSGIX (GLenum a0, GLenum a1, GLint a2, const GLfloat* a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNONLINMATERIALFVSGIXPROC)_glewProfileTargets[2662])(a0, a1, a2, a3);
+  _glewProfileEnd(2662, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTexGenSGIX (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTEXGENSGIXPROC)_glewProfileTargets[2663])(a0);
+  _glewProfileEnd(2663, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeformSGIX (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDEFORMSGIXPROC)_glewProfileTargets[2664])(a0);
+  _glewProfileEnd(2664, t);
+}
+
+static void GLAPIENTRY _glewProfile_glLoadIdentityDeformationMapSGIX (GLbitfield a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)_glewProfileTargets[2665])(a0);
+  _glewProfileEnd(2665, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMeshBreadthSGIX (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMESHBREADTHSGIXPROC)_glewProfileTargets[2666])(a0);
+  _glewProfileEnd(2666, t);
+}
+
+static void GLAPIENTRY _glewProfile_glMeshStrideSGIX (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLMESHSTRIDESGIXPROC)_glewProfileTargets[2667])(a0);
+  _glewProfileEnd(2667, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReferencePlaneSGIX (const GLdouble* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREFERENCEPLANESGIXPROC)_glewProfileTargets[2668])(a0);
+  _glewProfileEnd(2668, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSpriteParameterfSGIX (GLenum a0, GLfloat a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSPRITEPARAMETERFSGIXPROC)_glewProfileTargets[2669])(a0, a1);
+  _glewProfileEnd(2669, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSpriteParameterfvSGIX (GLenum a0, GLfloat* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSPRITEPARAMETERFVSGIXPROC)_glewProfileTargets[2670])(a0, a1);
+  _glewProfileEnd(2670, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSpriteParameteriSGIX (GLenum a0, GLint a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSPRITEPARAMETERISGIXPROC)_glewProfileTargets[2671])(a0, a1);
+  _glewProfileEnd(2671, t);
+}
+
+static void GLAPIENTRY _glewProfile_glSpriteParameterivSGIX (GLenum a0, GLint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLSPRITEPARAMETERIVSGIXPROC)_glewProfileTargets[2672])(a0, a1);
+  _glewProfileEnd(2672, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTagSampleBufferSGIX (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTAGSAMPLEBUFFERSGIXPROC)_glewProfileTargets[2673])();
+  _glewProfileEnd(2673, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetVectorOperationSGIX (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETVECTOROPERATIONSGIXPROC)_glewProfileTargets[2674])(a0);
+  _glewProfileEnd(2674, t);
+}
+
+static void GLAPIENTRY _glewProfile_glVectorOperationSGIX (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLVECTOROPERATIONSGIXPROC)_glewProfileTargets[2675])(a0);
+  _glewProfileEnd(2675, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glAreVertexArraysResidentSGIX (GLsizei a0, const GLuint* a1, GLboolean* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLAREVERTEXARRAYSRESIDENTSGIXPROC)_glewProfileTargets[2676])(a0, a1, a2);
+  _glewProfileEnd(2676, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glBindVertexArraySGIX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLBINDVERTEXARRAYSGIXPROC)_glewProfileTargets[2677])(a0);
+  _glewProfileEnd(2677, t);
+}
+
+static void GLAPIENTRY _glewProfile_glDeleteVertexArraysSGIX (GLsizei a0, const GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLDELETEVERTEXARRAYSSGIXPROC)_glewProfileTargets[2678])(a0, a1);
+  _glewProfileEnd(2678, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGenVertexArraysSGIX (GLsizei a0, GLuint* a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGENVERTEXARRAYSSGIXPROC)_glewProfileTargets[2679])(a0, a1);
+  _glewProfileEnd(2679, t);
+}
+
+static GLboolean GLAPIENTRY _glewProfile_glIsVertexArraySGIX (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  GLboolean r = ((PFNGLISVERTEXARRAYSGIXPROC)_glewProfileTargets[2680])(a0);
+  _glewProfileEnd(2680, t);
+  return r;
+}
+
+static void GLAPIENTRY _glewProfile_glPrioritizeVertexArraysSGIX (GLsizei a0, const GLuint* a1, const GLclampf* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPRIORITIZEVERTEXARRAYSSGIXPROC)_glewProfileTargets[2681])(a0, a1, a2);
+  _glewProfileEnd(2681, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTableParameterfvSGI (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLEPARAMETERFVSGIPROC)_glewProfileTargets[2682])(a0, a1, a2);
+  _glewProfileEnd(2682, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTableParameterivSGI (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLEPARAMETERIVSGIPROC)_glewProfileTargets[2683])(a0, a1, a2);
+  _glewProfileEnd(2683, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColorTableSGI (GLenum a0, GLenum a1, GLsizei a2, GLenum a3, GLenum a4, const void * a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLORTABLESGIPROC)_glewProfileTargets[2684])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2684, t);
+}
+
+static void GLAPIENTRY _glewProfile_glCopyColorTableSGI (GLenum a0, GLenum a1, GLint a2, GLint a3, GLsizei a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOPYCOLORTABLESGIPROC)_glewProfileTargets[2685])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2685, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableParameterfvSGI (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPARAMETERFVSGIPROC)_glewProfileTargets[2686])(a0, a1, a2);
+  _glewProfileEnd(2686, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableParameterivSGI (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLEPARAMETERIVSGIPROC)_glewProfileTargets[2687])(a0, a1, a2);
+  _glewProfileEnd(2687, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetColorTableSGI (GLenum a0, GLenum a1, GLenum a2, void * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETCOLORTABLESGIPROC)_glewProfileTargets[2688])(a0, a1, a2, a3);
+  _glewProfileEnd(2688, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPixelTransformParameterfvSGI (GLenum a0, GLenum a1, GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPIXELTRANSFORMPARAMETERFVSGIPROC)_glewProfileTargets[2689])(a0, a1, a2);
+  _glewProfileEnd(2689, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGetPixelTransformParameterivSGI (GLenum a0, GLenum a1, GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGETPIXELTRANSFORMPARAMETERIVSGIPROC)_glewProfileTargets[2690])(a0, a1, a2);
+  _glewProfileEnd(2690, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameterfSGI (GLenum a0, GLenum a1, GLfloat a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERFSGIPROC)_glewProfileTargets[2691])(a0, a1, a2);
+  _glewProfileEnd(2691, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameterfvSGI (GLenum a0, GLenum a1, const GLfloat* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERFVSGIPROC)_glewProfileTargets[2692])(a0, a1, a2);
+  _glewProfileEnd(2692, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameteriSGI (GLenum a0, GLenum a1, GLint a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERISGIPROC)_glewProfileTargets[2693])(a0, a1, a2);
+  _glewProfileEnd(2693, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformParameterivSGI (GLenum a0, GLenum a1, const GLint* a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMPARAMETERIVSGIPROC)_glewProfileTargets[2694])(a0, a1, a2);
+  _glewProfileEnd(2694, t);
+}
+
+static void GLAPIENTRY _glewProfile_glPixelTransformSGI (GLenum a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLPIXELTRANSFORMSGIPROC)_glewProfileTargets[2695])(a0);
+  _glewProfileEnd(2695, t);
+}
+
+static void GLAPIENTRY _glewProfile_glFinishTextureSUNX (void)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLFINISHTEXTURESUNXPROC)_glewProfileTargets[2696])();
+  _glewProfileEnd(2696, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactorbSUN (GLbyte a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORBSUNPROC)_glewProfileTargets[2697])(a0);
+  _glewProfileEnd(2697, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactordSUN (GLdouble a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORDSUNPROC)_glewProfileTargets[2698])(a0);
+  _glewProfileEnd(2698, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactorfSUN (GLfloat a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORFSUNPROC)_glewProfileTargets[2699])(a0);
+  _glewProfileEnd(2699, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactoriSUN (GLint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORISUNPROC)_glewProfileTargets[2700])(a0);
+  _glewProfileEnd(2700, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactorsSUN (GLshort a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORSSUNPROC)_glewProfileTargets[2701])(a0);
+  _glewProfileEnd(2701, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactorubSUN (GLubyte a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORUBSUNPROC)_glewProfileTargets[2702])(a0);
+  _glewProfileEnd(2702, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactoruiSUN (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORUISUNPROC)_glewProfileTargets[2703])(a0);
+  _glewProfileEnd(2703, t);
+}
+
+static void GLAPIENTRY _glewProfile_glGlobalAlphaFactorusSUN (GLushort a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLGLOBALALPHAFACTORUSSUNPROC)_glewProfileTargets[2704])(a0);
+  _glewProfileEnd(2704, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReadVideoPixelsSUN (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void* a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREADVIDEOPIXELSSUNPROC)_glewProfileTargets[2705])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2705, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodePointerSUN (GLenum a0, GLsizei a1, const void * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEPOINTERSUNPROC)_glewProfileTargets[2706])(a0, a1, a2);
+  _glewProfileEnd(2706, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeubSUN (GLubyte a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUBSUNPROC)_glewProfileTargets[2707])(a0);
+  _glewProfileEnd(2707, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeubvSUN (const GLubyte* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUBVSUNPROC)_glewProfileTargets[2708])(a0);
+  _glewProfileEnd(2708, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiSUN (GLuint a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUISUNPROC)_glewProfileTargets[2709])(a0);
+  _glewProfileEnd(2709, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuivSUN (const GLuint* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUIVSUNPROC)_glewProfileTargets[2710])(a0);
+  _glewProfileEnd(2710, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeusSUN (GLushort a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUSSUNPROC)_glewProfileTargets[2711])(a0);
+  _glewProfileEnd(2711, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeusvSUN (const GLushort* a0)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUSVSUNPROC)_glewProfileTargets[2712])(a0);
+  _glewProfileEnd(2712, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR3FVERTEX3FSUNPROC)_glewProfileTargets[2713])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2713, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR3FVERTEX3FVSUNPROC)_glewProfileTargets[2714])(a0, a1);
+  _glewProfileEnd(2714, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4fNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2715])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+  _glewProfileEnd(2715, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4fNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2716])(a0, a1, a2);
+  _glewProfileEnd(2716, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4ubVertex2fSUN (GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4UBVERTEX2FSUNPROC)_glewProfileTargets[2717])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2717, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4ubVertex2fvSUN (const GLubyte* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4UBVERTEX2FVSUNPROC)_glewProfileTargets[2718])(a0, a1);
+  _glewProfileEnd(2718, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4ubVertex3fSUN (GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4UBVERTEX3FSUNPROC)_glewProfileTargets[2719])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2719, t);
+}
+
+static void GLAPIENTRY _glewProfile_glColor4ubVertex3fvSUN (const GLubyte* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLCOLOR4UBVERTEX3FVSUNPROC)_glewProfileTargets[2720])(a0, a1);
+  _glewProfileEnd(2720, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2721])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2721, t);
+}
+
+static void GLAPIENTRY _glewProfile_glNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2722])(a0, a1);
+  _glewProfileEnd(2722, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiColor3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)_glewProfileTargets[2723])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2723, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiColor3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)_glewProfileTargets[2724])(a0, a1, a2);
+  _glewProfileEnd(2724, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiColor4fNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2725])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+  _glewProfileEnd(2725, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiColor4fNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2726])(a0, a1, a2, a3);
+  _glewProfileEnd(2726, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiColor4ubVertex3fSUN (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)_glewProfileTargets[2727])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2727, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiColor4ubVertex3fvSUN (const GLuint* a0, const GLubyte * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)_glewProfileTargets[2728])(a0, a1, a2);
+  _glewProfileEnd(2728, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2729])(a0, a1, a2, a3, a4, a5, a6);
+  _glewProfileEnd(2729, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2730])(a0, a1, a2);
+  _glewProfileEnd(2730, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11, GLfloat a12)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2731])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+  _glewProfileEnd(2731, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3, const GLfloat * a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2732])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2732, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2733])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2733, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2734])(a0, a1, a2, a3);
+  _glewProfileEnd(2734, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiTexCoord2fVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)_glewProfileTargets[2735])(a0, a1, a2, a3, a4, a5);
+  _glewProfileEnd(2735, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiTexCoord2fVertex3fvSUN (const GLuint* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)_glewProfileTargets[2736])(a0, a1, a2);
+  _glewProfileEnd(2736, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiVertex3fSUN (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)_glewProfileTargets[2737])(a0, a1, a2, a3);
+  _glewProfileEnd(2737, t);
+}
+
+static void GLAPIENTRY _glewProfile_glReplacementCodeuiVertex3fvSUN (const GLuint* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)_glewProfileTargets[2738])(a0, a1);
+  _glewProfileEnd(2738, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fColor3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)_glewProfileTargets[2739])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2739, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fColor3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)_glewProfileTargets[2740])(a0, a1, a2);
+  _glewProfileEnd(2740, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fColor4fNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2741])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+  _glewProfileEnd(2741, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fColor4fNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2742])(a0, a1, a2, a3);
+  _glewProfileEnd(2742, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fColor4ubVertex3fSUN (GLfloat a0, GLfloat a1, GLubyte a2, GLubyte a3, GLubyte a4, GLubyte a5, GLfloat a6, GLfloat a7, GLfloat a8)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)_glewProfileTargets[2743])(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+  _glewProfileEnd(2743, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fColor4ubVertex3fvSUN (const GLfloat* a0, const GLubyte * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)_glewProfileTargets[2744])(a0, a1, a2);
+  _glewProfileEnd(2744, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fNormal3fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)_glewProfileTargets[2745])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2745, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fNormal3fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)_glewProfileTargets[2746])(a0, a1, a2);
+  _glewProfileEnd(2746, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fVertex3fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FVERTEX3FSUNPROC)_glewProfileTargets[2747])(a0, a1, a2, a3, a4);
+  _glewProfileEnd(2747, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord2fVertex3fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD2FVERTEX3FVSUNPROC)_glewProfileTargets[2748])(a0, a1);
+  _glewProfileEnd(2748, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord4fColor4fNormal3fVertex4fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7, GLfloat a8, GLfloat a9, GLfloat a10, GLfloat a11, GLfloat a12, GLfloat a13, GLfloat a14)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)_glewProfileTargets[2749])(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+  _glewProfileEnd(2749, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord4fColor4fNormal3fVertex4fvSUN (const GLfloat* a0, const GLfloat * a1, const GLfloat * a2, const GLfloat * a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)_glewProfileTargets[2750])(a0, a1, a2, a3);
+  _glewProfileEnd(2750, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord4fVertex4fSUN (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, GLfloat a6, GLfloat a7)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD4FVERTEX4FSUNPROC)_glewProfileTargets[2751])(a0, a1, a2, a3, a4, a5, a6, a7);
+  _glewProfileEnd(2751, t);
+}
+
+static void GLAPIENTRY _glewProfile_glTexCoord4fVertex4fvSUN (const GLfloat* a0, const GLfloat * a1)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLTEXCOORD4FVERTEX4FVSUNPROC)_glewProfileTargets[2752])(a0, a1);
+  _glewProfileEnd(2752, t);
+}
+
+static void GLAPIENTRY _glewProfile_glAddSwapHintRectWIN (GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+{
+  const GLuint64 t = _glewProfileTime();
+  ((PFNGLADDSWAPHINTRECTWINPROC)_glewProfileTargets[2753])(a0, a1, a2, a3);
+  _glewProfileEnd(2753, t);
+}
+
+static const _GLEWProc _glewProfileFunctions[] = {
+  (_GLEWProc)_glewProfile_glCopyTexSubImage3D,
+  (_GLEWProc)_glewProfile_glDrawRangeElements,
+  (_GLEWProc)_glewProfile_glTexImage3D,
+  (_GLEWProc)_glewProfile_glTexSubImage3D,
+  (_GLEWProc)_glewProfile_glActiveTexture,
+  (_GLEWProc)_glewProfile_glClientActiveTexture,
+  (_GLEWProc)_glewProfile_glCompressedTexImage1D,
+  (_GLEWProc)_glewProfile_glCompressedTexImage2D,
+  (_GLEWProc)_glewProfile_glCompressedTexImage3D,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage1D,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage2D,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage3D,
+  (_GLEWProc)_glewProfile_glGetCompressedTexImage,
+  (_GLEWProc)_glewProfile_glLoadTransposeMatrixd,
+  (_GLEWProc)_glewProfile_glLoadTransposeMatrixf,
+  (_GLEWProc)_glewProfile_glMultTransposeMatrixd,
+  (_GLEWProc)_glewProfile_glMultTransposeMatrixf,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1d,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1dv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1f,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1fv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1i,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1iv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1s,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1sv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2d,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2dv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2f,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2fv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2i,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2iv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2s,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2sv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3d,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3dv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3f,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3fv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3i,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3iv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3s,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3sv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4d,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4dv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4f,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4fv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4i,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4iv,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4s,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4sv,
+  (_GLEWProc)_glewProfile_glSampleCoverage,
+  (_GLEWProc)_glewProfile_glBlendColor,
+  (_GLEWProc)_glewProfile_glBlendEquation,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparate,
+  (_GLEWProc)_glewProfile_glFogCoordPointer,
+  (_GLEWProc)_glewProfile_glFogCoordd,
+  (_GLEWProc)_glewProfile_glFogCoorddv,
+  (_GLEWProc)_glewProfile_glFogCoordf,
+  (_GLEWProc)_glewProfile_glFogCoordfv,
+  (_GLEWProc)_glewProfile_glMultiDrawArrays,
+  (_GLEWProc)_glewProfile_glMultiDrawElements,
+  (_GLEWProc)_glewProfile_glPointParameterf,
+  (_GLEWProc)_glewProfile_glPointParameterfv,
+  (_GLEWProc)_glewProfile_glPointParameteri,
+  (_GLEWProc)_glewProfile_glPointParameteriv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3b,
+  (_GLEWProc)_glewProfile_glSecondaryColor3bv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3d,
+  (_GLEWProc)_glewProfile_glSecondaryColor3dv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3f,
+  (_GLEWProc)_glewProfile_glSecondaryColor3fv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3i,
+  (_GLEWProc)_glewProfile_glSecondaryColor3iv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3s,
+  (_GLEWProc)_glewProfile_glSecondaryColor3sv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3ub,
+  (_GLEWProc)_glewProfile_glSecondaryColor3ubv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3ui,
+  (_GLEWProc)_glewProfile_glSecondaryColor3uiv,
+  (_GLEWProc)_glewProfile_glSecondaryColor3us,
+  (_GLEWProc)_glewProfile_glSecondaryColor3usv,
+  (_GLEWProc)_glewProfile_glSecondaryColorPointer,
+  (_GLEWProc)_glewProfile_glWindowPos2d,
+  (_GLEWProc)_glewProfile_glWindowPos2dv,
+  (_GLEWProc)_glewProfile_glWindowPos2f,
+  (_GLEWProc)_glewProfile_glWindowPos2fv,
+  (_GLEWProc)_glewProfile_glWindowPos2i,
+  (_GLEWProc)_glewProfile_glWindowPos2iv,
+  (_GLEWProc)_glewProfile_glWindowPos2s,
+  (_GLEWProc)_glewProfile_glWindowPos2sv,
+  (_GLEWProc)_glewProfile_glWindowPos3d,
+  (_GLEWProc)_glewProfile_glWindowPos3dv,
+  (_GLEWProc)_glewProfile_glWindowPos3f,
+  (_GLEWProc)_glewProfile_glWindowPos3fv,
+  (_GLEWProc)_glewProfile_glWindowPos3i,
+  (_GLEWProc)_glewProfile_glWindowPos3iv,
+  (_GLEWProc)_glewProfile_glWindowPos3s,
+  (_GLEWProc)_glewProfile_glWindowPos3sv,
+  (_GLEWProc)_glewProfile_glBeginQuery,
+  (_GLEWProc)_glewProfile_glBindBuffer,
+  (_GLEWProc)_glewProfile_glBufferData,
+  (_GLEWProc)_glewProfile_glBufferSubData,
+  (_GLEWProc)_glewProfile_glDeleteBuffers,
+  (_GLEWProc)_glewProfile_glDeleteQueries,
+  (_GLEWProc)_glewProfile_glEndQuery,
+  (_GLEWProc)_glewProfile_glGenBuffers,
+  (_GLEWProc)_glewProfile_glGenQueries,
+  (_GLEWProc)_glewProfile_glGetBufferParameteriv,
+  (_GLEWProc)_glewProfile_glGetBufferPointerv,
+  (_GLEWProc)_glewProfile_glGetBufferSubData,
+  (_GLEWProc)_glewProfile_glGetQueryObjectiv,
+  (_GLEWProc)_glewProfile_glGetQueryObjectuiv,
+  (_GLEWProc)_glewProfile_glGetQueryiv,
+  (_GLEWProc)_glewProfile_glIsBuffer,
+  (_GLEWProc)_glewProfile_glIsQuery,
+  (_GLEWProc)_glewProfile_glMapBuffer,
+  (_GLEWProc)_glewProfile_glUnmapBuffer,
+  (_GLEWProc)_glewProfile_glAttachShader,
+  (_GLEWProc)_glewProfile_glBindAttribLocation,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparate,
+  (_GLEWProc)_glewProfile_glCompileShader,
+  (_GLEWProc)_glewProfile_glCreateProgram,
+  (_GLEWProc)_glewProfile_glCreateShader,
+  (_GLEWProc)_glewProfile_glDeleteProgram,
+  (_GLEWProc)_glewProfile_glDeleteShader,
+  (_GLEWProc)_glewProfile_glDetachShader,
+  (_GLEWProc)_glewProfile_glDisableVertexAttribArray,
+  (_GLEWProc)_glewProfile_glDrawBuffers,
+  (_GLEWProc)_glewProfile_glEnableVertexAttribArray,
+  (_GLEWProc)_glewProfile_glGetActiveAttrib,
+  (_GLEWProc)_glewProfile_glGetActiveUniform,
+  (_GLEWProc)_glewProfile_glGetAttachedShaders,
+  (_GLEWProc)_glewProfile_glGetAttribLocation,
+  (_GLEWProc)_glewProfile_glGetProgramInfoLog,
+  (_GLEWProc)_glewProfile_glGetProgramiv,
+  (_GLEWProc)_glewProfile_glGetShaderInfoLog,
+  (_GLEWProc)_glewProfile_glGetShaderSource,
+  (_GLEWProc)_glewProfile_glGetShaderiv,
+  (_GLEWProc)_glewProfile_glGetUniformLocation,
+  (_GLEWProc)_glewProfile_glGetUniformfv,
+  (_GLEWProc)_glewProfile_glGetUniformiv,
+  (_GLEWProc)_glewProfile_glGetVertexAttribPointerv,
+  (_GLEWProc)_glewProfile_glGetVertexAttribdv,
+  (_GLEWProc)_glewProfile_glGetVertexAttribfv,
+  (_GLEWProc)_glewProfile_glGetVertexAttribiv,
+  (_GLEWProc)_glewProfile_glIsProgram,
+  (_GLEWProc)_glewProfile_glIsShader,
+  (_GLEWProc)_glewProfile_glLinkProgram,
+  (_GLEWProc)_glewProfile_glShaderSource,
+  (_GLEWProc)_glewProfile_glStencilFuncSeparate,
+  (_GLEWProc)_glewProfile_glStencilMaskSeparate,
+  (_GLEWProc)_glewProfile_glStencilOpSeparate,
+  (_GLEWProc)_glewProfile_glUniform1f,
+  (_GLEWProc)_glewProfile_glUniform1fv,
+  (_GLEWProc)_glewProfile_glUniform1i,
+  (_GLEWProc)_glewProfile_glUniform1iv,
+  (_GLEWProc)_glewProfile_glUniform2f,
+  (_GLEWProc)_glewProfile_glUniform2fv,
+  (_GLEWProc)_glewProfile_glUniform2i,
+  (_GLEWProc)_glewProfile_glUniform2iv,
+  (_GLEWProc)_glewProfile_glUniform3f,
+  (_GLEWProc)_glewProfile_glUniform3fv,
+  (_GLEWProc)_glewProfile_glUniform3i,
+  (_GLEWProc)_glewProfile_glUniform3iv,
+  (_GLEWProc)_glewProfile_glUniform4f,
+  (_GLEWProc)_glewProfile_glUniform4fv,
+  (_GLEWProc)_glewProfile_glUniform4i,
+  (_GLEWProc)_glewProfile_glUniform4iv,
+  (_GLEWProc)_glewProfile_glUniformMatrix2fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix3fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix4fv,
+  (_GLEWProc)_glewProfile_glUseProgram,
+  (_GLEWProc)_glewProfile_glValidateProgram,
+  (_GLEWProc)_glewProfile_glVertexAttrib1d,
+  (_GLEWProc)_glewProfile_glVertexAttrib1dv,
+  (_GLEWProc)_glewProfile_glVertexAttrib1f,
+  (_GLEWProc)_glewProfile_glVertexAttrib1fv,
+  (_GLEWProc)_glewProfile_glVertexAttrib1s,
+  (_GLEWProc)_glewProfile_glVertexAttrib1sv,
+  (_GLEWProc)_glewProfile_glVertexAttrib2d,
+  (_GLEWProc)_glewProfile_glVertexAttrib2dv,
+  (_GLEWProc)_glewProfile_glVertexAttrib2f,
+  (_GLEWProc)_glewProfile_glVertexAttrib2fv,
+  (_GLEWProc)_glewProfile_glVertexAttrib2s,
+  (_GLEWProc)_glewProfile_glVertexAttrib2sv,
+  (_GLEWProc)_glewProfile_glVertexAttrib3d,
+  (_GLEWProc)_glewProfile_glVertexAttrib3dv,
+  (_GLEWProc)_glewProfile_glVertexAttrib3f,
+  (_GLEWProc)_glewProfile_glVertexAttrib3fv,
+  (_GLEWProc)_glewProfile_glVertexAttrib3s,
+  (_GLEWProc)_glewProfile_glVertexAttrib3sv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Nbv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Niv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Nsv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Nub,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Nubv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Nuiv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4Nusv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4bv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4d,
+  (_GLEWProc)_glewProfile_glVertexAttrib4dv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4f,
+  (_GLEWProc)_glewProfile_glVertexAttrib4fv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4iv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4s,
+  (_GLEWProc)_glewProfile_glVertexAttrib4sv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4ubv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4uiv,
+  (_GLEWProc)_glewProfile_glVertexAttrib4usv,
+  (_GLEWProc)_glewProfile_glVertexAttribPointer,
+  (_GLEWProc)_glewProfile_glUniformMatrix2x3fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix2x4fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix3x2fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix3x4fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix4x2fv,
+  (_GLEWProc)_glewProfile_glUniformMatrix4x3fv,
+  (_GLEWProc)_glewProfile_glBeginConditionalRender,
+  (_GLEWProc)_glewProfile_glBeginTransformFeedback,
+  (_GLEWProc)_glewProfile_glBindFragDataLocation,
+  (_GLEWProc)_glewProfile_glClampColor,
+  (_GLEWProc)_glewProfile_glClearBufferfi,
+  (_GLEWProc)_glewProfile_glClearBufferfv,
+  (_GLEWProc)_glewProfile_glClearBufferiv,
+  (_GLEWProc)_glewProfile_glClearBufferuiv,
+  (_GLEWProc)_glewProfile_glColorMaski,
+  (_GLEWProc)_glewProfile_glDisablei,
+  (_GLEWProc)_glewProfile_glEnablei,
+  (_GLEWProc)_glewProfile_glEndConditionalRender,
+  (_GLEWProc)_glewProfile_glEndTransformFeedback,
+  (_GLEWProc)_glewProfile_glGetBooleani_v,
+  (_GLEWProc)_glewProfile_glGetFragDataLocation,
+  (_GLEWProc)_glewProfile_glGetStringi,
+  (_GLEWProc)_glewProfile_glGetTexParameterIiv,
+  (_GLEWProc)_glewProfile_glGetTexParameterIuiv,
+  (_GLEWProc)_glewProfile_glGetTransformFeedbackVarying,
+  (_GLEWProc)_glewProfile_glGetUniformuiv,
+  (_GLEWProc)_glewProfile_glGetVertexAttribIiv,
+  (_GLEWProc)_glewProfile_glGetVertexAttribIuiv,
+  (_GLEWProc)_glewProfile_glIsEnabledi,
+  (_GLEWProc)_glewProfile_glTexParameterIiv,
+  (_GLEWProc)_glewProfile_glTexParameterIuiv,
+  (_GLEWProc)_glewProfile_glTransformFeedbackVaryings,
+  (_GLEWProc)_glewProfile_glUniform1ui,
+  (_GLEWProc)_glewProfile_glUniform1uiv,
+  (_GLEWProc)_glewProfile_glUniform2ui,
+  (_GLEWProc)_glewProfile_glUniform2uiv,
+  (_GLEWProc)_glewProfile_glUniform3ui,
+  (_GLEWProc)_glewProfile_glUniform3uiv,
+  (_GLEWProc)_glewProfile_glUniform4ui,
+  (_GLEWProc)_glewProfile_glUniform4uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribI1i,
+  (_GLEWProc)_glewProfile_glVertexAttribI1iv,
+  (_GLEWProc)_glewProfile_glVertexAttribI1ui,
+  (_GLEWProc)_glewProfile_glVertexAttribI1uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribI2i,
+  (_GLEWProc)_glewProfile_glVertexAttribI2iv,
+  (_GLEWProc)_glewProfile_glVertexAttribI2ui,
+  (_GLEWProc)_glewProfile_glVertexAttribI2uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribI3i,
+  (_GLEWProc)_glewProfile_glVertexAttribI3iv,
+  (_GLEWProc)_glewProfile_glVertexAttribI3ui,
+  (_GLEWProc)_glewProfile_glVertexAttribI3uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribI4bv,
+  (_GLEWProc)_glewProfile_glVertexAttribI4i,
+  (_GLEWProc)_glewProfile_glVertexAttribI4iv,
+  (_GLEWProc)_glewProfile_glVertexAttribI4sv,
+  (_GLEWProc)_glewProfile_glVertexAttribI4ubv,
+  (_GLEWProc)_glewProfile_glVertexAttribI4ui,
+  (_GLEWProc)_glewProfile_glVertexAttribI4uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribI4usv,
+  (_GLEWProc)_glewProfile_glVertexAttribIPointer,
+  (_GLEWProc)_glewProfile_glDrawArraysInstanced,
+  (_GLEWProc)_glewProfile_glDrawElementsInstanced,
+  (_GLEWProc)_glewProfile_glPrimitiveRestartIndex,
+  (_GLEWProc)_glewProfile_glTexBuffer,
+  (_GLEWProc)_glewProfile_glFramebufferTexture,
+  (_GLEWProc)_glewProfile_glGetBufferParameteri64v,
+  (_GLEWProc)_glewProfile_glGetInteger64i_v,
+  (_GLEWProc)_glewProfile_glVertexAttribDivisor,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparatei,
+  (_GLEWProc)_glewProfile_glBlendEquationi,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparatei,
+  (_GLEWProc)_glewProfile_glBlendFunci,
+  (_GLEWProc)_glewProfile_glMinSampleShading,
+  (_GLEWProc)_glewProfile_glGetGraphicsResetStatus,
+  (_GLEWProc)_glewProfile_glGetnCompressedTexImage,
+  (_GLEWProc)_glewProfile_glGetnTexImage,
+  (_GLEWProc)_glewProfile_glGetnUniformdv,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirectCount,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirectCount,
+  (_GLEWProc)_glewProfile_glSpecializeShader,
+  (_GLEWProc)_glewProfile_glTbufferMask3DFX,
+  (_GLEWProc)_glewProfile_glDebugMessageCallbackAMD,
+  (_GLEWProc)_glewProfile_glDebugMessageEnableAMD,
+  (_GLEWProc)_glewProfile_glDebugMessageInsertAMD,
+  (_GLEWProc)_glewProfile_glGetDebugMessageLogAMD,
+  (_GLEWProc)_glewProfile_glBlendEquationIndexedAMD,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparateIndexedAMD,
+  (_GLEWProc)_glewProfile_glBlendFuncIndexedAMD,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparateIndexedAMD,
+  (_GLEWProc)_glewProfile_glNamedRenderbufferStorageMultisampleAdvancedAMD,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleAdvancedAMD,
+  (_GLEWProc)_glewProfile_glFramebufferSamplePositionsfvAMD,
+  (_GLEWProc)_glewProfile_glGetFramebufferParameterfvAMD,
+  (_GLEWProc)_glewProfile_glGetNamedFramebufferParameterfvAMD,
+  (_GLEWProc)_glewProfile_glNamedFramebufferSamplePositionsfvAMD,
+  (_GLEWProc)_glewProfile_glVertexAttribParameteriAMD,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirectAMD,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirectAMD,
+  (_GLEWProc)_glewProfile_glDeleteNamesAMD,
+  (_GLEWProc)_glewProfile_glGenNamesAMD,
+  (_GLEWProc)_glewProfile_glIsNameAMD,
+  (_GLEWProc)_glewProfile_glQueryObjectParameteruiAMD,
+  (_GLEWProc)_glewProfile_glBeginPerfMonitorAMD,
+  (_GLEWProc)_glewProfile_glDeletePerfMonitorsAMD,
+  (_GLEWProc)_glewProfile_glEndPerfMonitorAMD,
+  (_GLEWProc)_glewProfile_glGenPerfMonitorsAMD,
+  (_GLEWProc)_glewProfile_glGetPerfMonitorCounterDataAMD,
+  (_GLEWProc)_glewProfile_glGetPerfMonitorCounterInfoAMD,
+  (_GLEWProc)_glewProfile_glGetPerfMonitorCounterStringAMD,
+  (_GLEWProc)_glewProfile_glGetPerfMonitorCountersAMD,
+  (_GLEWProc)_glewProfile_glGetPerfMonitorGroupStringAMD,
+  (_GLEWProc)_glewProfile_glGetPerfMonitorGroupsAMD,
+  (_GLEWProc)_glewProfile_glSelectPerfMonitorCountersAMD,
+  (_GLEWProc)_glewProfile_glSetMultisamplefvAMD,
+  (_GLEWProc)_glewProfile_glTexStorageSparseAMD,
+  (_GLEWProc)_glewProfile_glTextureStorageSparseAMD,
+  (_GLEWProc)_glewProfile_glStencilOpValueAMD,
+  (_GLEWProc)_glewProfile_glTessellationFactorAMD,
+  (_GLEWProc)_glewProfile_glTessellationModeAMD,
+  (_GLEWProc)_glewProfile_glBlitFramebufferANGLE,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleANGLE,
+  (_GLEWProc)_glewProfile_glDrawArraysInstancedANGLE,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedANGLE,
+  (_GLEWProc)_glewProfile_glVertexAttribDivisorANGLE,
+  (_GLEWProc)_glewProfile_glBeginQueryANGLE,
+  (_GLEWProc)_glewProfile_glDeleteQueriesANGLE,
+  (_GLEWProc)_glewProfile_glEndQueryANGLE,
+  (_GLEWProc)_glewProfile_glGenQueriesANGLE,
+  (_GLEWProc)_glewProfile_glGetQueryObjecti64vANGLE,
+  (_GLEWProc)_glewProfile_glGetQueryObjectivANGLE,
+  (_GLEWProc)_glewProfile_glGetQueryObjectui64vANGLE,
+  (_GLEWProc)_glewProfile_glGetQueryObjectuivANGLE,
+  (_GLEWProc)_glewProfile_glGetQueryivANGLE,
+  (_GLEWProc)_glewProfile_glIsQueryANGLE,
+  (_GLEWProc)_glewProfile_glQueryCounterANGLE,
+  (_GLEWProc)_glewProfile_glGetTranslatedShaderSourceANGLE,
+  (_GLEWProc)_glewProfile_glCopyTextureLevelsAPPLE,
+  (_GLEWProc)_glewProfile_glDrawElementArrayAPPLE,
+  (_GLEWProc)_glewProfile_glDrawRangeElementArrayAPPLE,
+  (_GLEWProc)_glewProfile_glElementPointerAPPLE,
+  (_GLEWProc)_glewProfile_glMultiDrawElementArrayAPPLE,
+  (_GLEWProc)_glewProfile_glMultiDrawRangeElementArrayAPPLE,
+  (_GLEWProc)_glewProfile_glDeleteFencesAPPLE,
+  (_GLEWProc)_glewProfile_glFinishFenceAPPLE,
+  (_GLEWProc)_glewProfile_glFinishObjectAPPLE,
+  (_GLEWProc)_glewProfile_glGenFencesAPPLE,
+  (_GLEWProc)_glewProfile_glIsFenceAPPLE,
+  (_GLEWProc)_glewProfile_glSetFenceAPPLE,
+  (_GLEWProc)_glewProfile_glTestFenceAPPLE,
+  (_GLEWProc)_glewProfile_glTestObjectAPPLE,
+  (_GLEWProc)_glewProfile_glBufferParameteriAPPLE,
+  (_GLEWProc)_glewProfile_glFlushMappedBufferRangeAPPLE,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleAPPLE,
+  (_GLEWProc)_glewProfile_glResolveMultisampleFramebufferAPPLE,
+  (_GLEWProc)_glewProfile_glGetObjectParameterivAPPLE,
+  (_GLEWProc)_glewProfile_glObjectPurgeableAPPLE,
+  (_GLEWProc)_glewProfile_glObjectUnpurgeableAPPLE,
+  (_GLEWProc)_glewProfile_glClientWaitSyncAPPLE,
+  (_GLEWProc)_glewProfile_glDeleteSyncAPPLE,
+  (_GLEWProc)_glewProfile_glFenceSyncAPPLE,
+  (_GLEWProc)_glewProfile_glGetInteger64vAPPLE,
+  (_GLEWProc)_glewProfile_glGetSyncivAPPLE,
+  (_GLEWProc)_glewProfile_glIsSyncAPPLE,
+  (_GLEWProc)_glewProfile_glWaitSyncAPPLE,
+  (_GLEWProc)_glewProfile_glGetTexParameterPointervAPPLE,
+  (_GLEWProc)_glewProfile_glTextureRangeAPPLE,
+  (_GLEWProc)_glewProfile_glBindVertexArrayAPPLE,
+  (_GLEWProc)_glewProfile_glDeleteVertexArraysAPPLE,
+  (_GLEWProc)_glewProfile_glGenVertexArraysAPPLE,
+  (_GLEWProc)_glewProfile_glIsVertexArrayAPPLE,
+  (_GLEWProc)_glewProfile_glFlushVertexArrayRangeAPPLE,
+  (_GLEWProc)_glewProfile_glVertexArrayParameteriAPPLE,
+  (_GLEWProc)_glewProfile_glVertexArrayRangeAPPLE,
+  (_GLEWProc)_glewProfile_glDisableVertexAttribAPPLE,
+  (_GLEWProc)_glewProfile_glEnableVertexAttribAPPLE,
+  (_GLEWProc)_glewProfile_glIsVertexAttribEnabledAPPLE,
+  (_GLEWProc)_glewProfile_glMapVertexAttrib1dAPPLE,
+  (_GLEWProc)_glewProfile_glMapVertexAttrib1fAPPLE,
+  (_GLEWProc)_glewProfile_glMapVertexAttrib2dAPPLE,
+  (_GLEWProc)_glewProfile_glMapVertexAttrib2fAPPLE,
+  (_GLEWProc)_glewProfile_glClearDepthf,
+  (_GLEWProc)_glewProfile_glDepthRangef,
+  (_GLEWProc)_glewProfile_glGetShaderPrecisionFormat,
+  (_GLEWProc)_glewProfile_glReleaseShaderCompiler,
+  (_GLEWProc)_glewProfile_glShaderBinary,
+  (_GLEWProc)_glewProfile_glMemoryBarrierByRegion,
+  (_GLEWProc)_glewProfile_glPrimitiveBoundingBoxARB,
+  (_GLEWProc)_glewProfile_glDrawArraysInstancedBaseInstance,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedBaseInstance,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedBaseVertexBaseInstance,
+  (_GLEWProc)_glewProfile_glGetImageHandleARB,
+  (_GLEWProc)_glewProfile_glGetTextureHandleARB,
+  (_GLEWProc)_glewProfile_glGetTextureSamplerHandleARB,
+  (_GLEWProc)_glewProfile_glGetVertexAttribLui64vARB,
+  (_GLEWProc)_glewProfile_glIsImageHandleResidentARB,
+  (_GLEWProc)_glewProfile_glIsTextureHandleResidentARB,
+  (_GLEWProc)_glewProfile_glMakeImageHandleNonResidentARB,
+  (_GLEWProc)_glewProfile_glMakeImageHandleResidentARB,
+  (_GLEWProc)_glewProfile_glMakeTextureHandleNonResidentARB,
+  (_GLEWProc)_glewProfile_glMakeTextureHandleResidentARB,
+  (_GLEWProc)_glewProfile_glProgramUniformHandleui64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniformHandleui64vARB,
+  (_GLEWProc)_glewProfile_glUniformHandleui64ARB,
+  (_GLEWProc)_glewProfile_glUniformHandleui64vARB,
+  (_GLEWProc)_glewProfile_glVertexAttribL1ui64ARB,
+  (_GLEWProc)_glewProfile_glVertexAttribL1ui64vARB,
+  (_GLEWProc)_glewProfile_glBindFragDataLocationIndexed,
+  (_GLEWProc)_glewProfile_glGetFragDataIndex,
+  (_GLEWProc)_glewProfile_glBufferStorage,
+  (_GLEWProc)_glewProfile_glCreateSyncFromCLeventARB,
+  (_GLEWProc)_glewProfile_glClearBufferData,
+  (_GLEWProc)_glewProfile_glClearBufferSubData,
+  (_GLEWProc)_glewProfile_glClearNamedBufferDataEXT,
+  (_GLEWProc)_glewProfile_glClearNamedBufferSubDataEXT,
+  (_GLEWProc)_glewProfile_glClearTexImage,
+  (_GLEWProc)_glewProfile_glClearTexSubImage,
+  (_GLEWProc)_glewProfile_glClipControl,
+  (_GLEWProc)_glewProfile_glClampColorARB,
+  (_GLEWProc)_glewProfile_glDispatchCompute,
+  (_GLEWProc)_glewProfile_glDispatchComputeIndirect,
+  (_GLEWProc)_glewProfile_glDispatchComputeGroupSizeARB,
+  (_GLEWProc)_glewProfile_glCopyBufferSubData,
+  (_GLEWProc)_glewProfile_glCopyImageSubData,
+  (_GLEWProc)_glewProfile_glDebugMessageCallbackARB,
+  (_GLEWProc)_glewProfile_glDebugMessageControlARB,
+  (_GLEWProc)_glewProfile_glDebugMessageInsertARB,
+  (_GLEWProc)_glewProfile_glGetDebugMessageLogARB,
+  (_GLEWProc)_glewProfile_glBindTextureUnit,
+  (_GLEWProc)_glewProfile_glBlitNamedFramebuffer,
+  (_GLEWProc)_glewProfile_glCheckNamedFramebufferStatus,
+  (_GLEWProc)_glewProfile_glClearNamedBufferData,
+  (_GLEWProc)_glewProfile_glClearNamedBufferSubData,
+  (_GLEWProc)_glewProfile_glClearNamedFramebufferfi,
+  (_GLEWProc)_glewProfile_glClearNamedFramebufferfv,
+  (_GLEWProc)_glewProfile_glClearNamedFramebufferiv,
+  (_GLEWProc)_glewProfile_glClearNamedFramebufferuiv,
+  (_GLEWProc)_glewProfile_glCompressedTextureSubImage1D,
+  (_GLEWProc)_glewProfile_glCompressedTextureSubImage2D,
+  (_GLEWProc)_glewProfile_glCompressedTextureSubImage3D,
+  (_GLEWProc)_glewProfile_glCopyNamedBufferSubData,
+  (_GLEWProc)_glewProfile_glCopyTextureSubImage1D,
+  (_GLEWProc)_glewProfile_glCopyTextureSubImage2D,
+  (_GLEWProc)_glewProfile_glCopyTextureSubImage3D,
+  (_GLEWProc)_glewProfile_glCreateBuffers,
+  (_GLEWProc)_glewProfile_glCreateFramebuffers,
+  (_GLEWProc)_glewProfile_glCreateProgramPipelines,
+  (_GLEWProc)_glewProfile_glCreateQueries,
+  (_GLEWProc)_glewProfile_glCreateRenderbuffers,
+  (_GLEWProc)_glewProfile_glCreateSamplers,
+  (_GLEWProc)_glewProfile_glCreateTextures,
+  (_GLEWProc)_glewProfile_glCreateTransformFeedbacks,
+  (_GLEWProc)_glewProfile_glCreateVertexArrays,
+  (_GLEWProc)_glewProfile_glDisableVertexArrayAttrib,
+  (_GLEWProc)_glewProfile_glEnableVertexArrayAttrib,
+  (_GLEWProc)_glewProfile_glFlushMappedNamedBufferRange,
+  (_GLEWProc)_glewProfile_glGenerateTextureMipmap,
+  (_GLEWProc)_glewProfile_glGetCompressedTextureImage,
+  (_GLEWProc)_glewProfile_glGetNamedBufferParameteri64v,
+  (_GLEWProc)_glewProfile_glGetNamedBufferParameteriv,
+  (_GLEWProc)_glewProfile_glGetNamedBufferPointerv,
+  (_GLEWProc)_glewProfile_glGetNamedBufferSubData,
+  (_GLEWProc)_glewProfile_glGetNamedFramebufferAttachmentParameteriv,
+  (_GLEWProc)_glewProfile_glGetNamedFramebufferParameteriv,
+  (_GLEWProc)_glewProfile_glGetNamedRenderbufferParameteriv,
+  (_GLEWProc)_glewProfile_glGetQueryBufferObjecti64v,
+  (_GLEWProc)_glewProfile_glGetQueryBufferObjectiv,
+  (_GLEWProc)_glewProfile_glGetQueryBufferObjectui64v,
+  (_GLEWProc)_glewProfile_glGetQueryBufferObjectuiv,
+  (_GLEWProc)_glewProfile_glGetTextureImage,
+  (_GLEWProc)_glewProfile_glGetTextureLevelParameterfv,
+  (_GLEWProc)_glewProfile_glGetTextureLevelParameteriv,
+  (_GLEWProc)_glewProfile_glGetTextureParameterIiv,
+  (_GLEWProc)_glewProfile_glGetTextureParameterIuiv,
+  (_GLEWProc)_glewProfile_glGetTextureParameterfv,
+  (_GLEWProc)_glewProfile_glGetTextureParameteriv,
+  (_GLEWProc)_glewProfile_glGetTransformFeedbacki64_v,
+  (_GLEWProc)_glewProfile_glGetTransformFeedbacki_v,
+  (_GLEWProc)_glewProfile_glGetTransformFeedbackiv,
+  (_GLEWProc)_glewProfile_glGetVertexArrayIndexed64iv,
+  (_GLEWProc)_glewProfile_glGetVertexArrayIndexediv,
+  (_GLEWProc)_glewProfile_glGetVertexArrayiv,
+  (_GLEWProc)_glewProfile_glInvalidateNamedFramebufferData,
+  (_GLEWProc)_glewProfile_glInvalidateNamedFramebufferSubData,
+  (_GLEWProc)_glewProfile_glMapNamedBuffer,
+  (_GLEWProc)_glewProfile_glMapNamedBufferRange,
+  (_GLEWProc)_glewProfile_glNamedBufferData,
+  (_GLEWProc)_glewProfile_glNamedBufferStorage,
+  (_GLEWProc)_glewProfile_glNamedBufferSubData,
+  (_GLEWProc)_glewProfile_glNamedFramebufferDrawBuffer,
+  (_GLEWProc)_glewProfile_glNamedFramebufferDrawBuffers,
+  (_GLEWProc)_glewProfile_glNamedFramebufferParameteri,
+  (_GLEWProc)_glewProfile_glNamedFramebufferReadBuffer,
+  (_GLEWProc)_glewProfile_glNamedFramebufferRenderbuffer,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTexture,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTextureLayer,
+  (_GLEWProc)_glewProfile_glNamedRenderbufferStorage,
+  (_GLEWProc)_glewProfile_glNamedRenderbufferStorageMultisample,
+  (_GLEWProc)_glewProfile_glTextureBuffer,
+  (_GLEWProc)_glewProfile_glTextureBufferRange,
+  (_GLEWProc)_glewProfile_glTextureParameterIiv,
+  (_GLEWProc)_glewProfile_glTextureParameterIuiv,
+  (_GLEWProc)_glewProfile_glTextureParameterf,
+  (_GLEWProc)_glewProfile_glTextureParameterfv,
+  (_GLEWProc)_glewProfile_glTextureParameteri,
+  (_GLEWProc)_glewProfile_glTextureParameteriv,
+  (_GLEWProc)_glewProfile_glTextureStorage1D,
+  (_GLEWProc)_glewProfile_glTextureStorage2D,
+  (_GLEWProc)_glewProfile_glTextureStorage2DMultisample,
+  (_GLEWProc)_glewProfile_glTextureStorage3D,
+  (_GLEWProc)_glewProfile_glTextureStorage3DMultisample,
+  (_GLEWProc)_glewProfile_glTextureSubImage1D,
+  (_GLEWProc)_glewProfile_glTextureSubImage2D,
+  (_GLEWProc)_glewProfile_glTextureSubImage3D,
+  (_GLEWProc)_glewProfile_glTransformFeedbackBufferBase,
+  (_GLEWProc)_glewProfile_glTransformFeedbackBufferRange,
+  (_GLEWProc)_glewProfile_glUnmapNamedBuffer,
+  (_GLEWProc)_glewProfile_glVertexArrayAttribBinding,
+  (_GLEWProc)_glewProfile_glVertexArrayAttribFormat,
+  (_GLEWProc)_glewProfile_glVertexArrayAttribIFormat,
+  (_GLEWProc)_glewProfile_glVertexArrayAttribLFormat,
+  (_GLEWProc)_glewProfile_glVertexArrayBindingDivisor,
+  (_GLEWProc)_glewProfile_glVertexArrayElementBuffer,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexBuffer,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexBuffers,
+  (_GLEWProc)_glewProfile_glDrawBuffersARB,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparateiARB,
+  (_GLEWProc)_glewProfile_glBlendEquationiARB,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparateiARB,
+  (_GLEWProc)_glewProfile_glBlendFunciARB,
+  (_GLEWProc)_glewProfile_glDrawElementsBaseVertex,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedBaseVertex,
+  (_GLEWProc)_glewProfile_glDrawRangeElementsBaseVertex,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsBaseVertex,
+  (_GLEWProc)_glewProfile_glDrawArraysIndirect,
+  (_GLEWProc)_glewProfile_glDrawElementsIndirect,
+  (_GLEWProc)_glewProfile_glFramebufferParameteri,
+  (_GLEWProc)_glewProfile_glGetFramebufferParameteriv,
+  (_GLEWProc)_glewProfile_glGetNamedFramebufferParameterivEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferParameteriEXT,
+  (_GLEWProc)_glewProfile_glBindFramebuffer,
+  (_GLEWProc)_glewProfile_glBindRenderbuffer,
+  (_GLEWProc)_glewProfile_glBlitFramebuffer,
+  (_GLEWProc)_glewProfile_glCheckFramebufferStatus,
+  (_GLEWProc)_glewProfile_glDeleteFramebuffers,
+  (_GLEWProc)_glewProfile_glDeleteRenderbuffers,
+  (_GLEWProc)_glewProfile_glFramebufferRenderbuffer,
+  (_GLEWProc)_glewProfile_glFramebufferTexture1D,
+  (_GLEWProc)_glewProfile_glFramebufferTexture2D,
+  (_GLEWProc)_glewProfile_glFramebufferTexture3D,
+  (_GLEWProc)_glewProfile_glFramebufferTextureLayer,
+  (_GLEWProc)_glewProfile_glGenFramebuffers,
+  (_GLEWProc)_glewProfile_glGenRenderbuffers,
+  (_GLEWProc)_glewProfile_glGenerateMipmap,
+  (_GLEWProc)_glewProfile_glGetFramebufferAttachmentParameteriv,
+  (_GLEWProc)_glewProfile_glGetRenderbufferParameteriv,
+  (_GLEWProc)_glewProfile_glIsFramebuffer,
+  (_GLEWProc)_glewProfile_glIsRenderbuffer,
+  (_GLEWProc)_glewProfile_glRenderbufferStorage,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisample,
+  (_GLEWProc)_glewProfile_glFramebufferTextureARB,
+  (_GLEWProc)_glewProfile_glFramebufferTextureFaceARB,
+  (_GLEWProc)_glewProfile_glFramebufferTextureLayerARB,
+  (_GLEWProc)_glewProfile_glProgramParameteriARB,
+  (_GLEWProc)_glewProfile_glGetProgramBinary,
+  (_GLEWProc)_glewProfile_glProgramBinary,
+  (_GLEWProc)_glewProfile_glProgramParameteri,
+  (_GLEWProc)_glewProfile_glGetCompressedTextureSubImage,
+  (_GLEWProc)_glewProfile_glGetTextureSubImage,
+  (_GLEWProc)_glewProfile_glSpecializeShaderARB,
+  (_GLEWProc)_glewProfile_glGetUniformdv,
+  (_GLEWProc)_glewProfile_glUniform1d,
+  (_GLEWProc)_glewProfile_glUniform1dv,
+  (_GLEWProc)_glewProfile_glUniform2d,
+  (_GLEWProc)_glewProfile_glUniform2dv,
+  (_GLEWProc)_glewProfile_glUniform3d,
+  (_GLEWProc)_glewProfile_glUniform3dv,
+  (_GLEWProc)_glewProfile_glUniform4d,
+  (_GLEWProc)_glewProfile_glUniform4dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix2dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix2x3dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix2x4dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix3dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix3x2dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix3x4dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix4dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix4x2dv,
+  (_GLEWProc)_glewProfile_glUniformMatrix4x3dv,
+  (_GLEWProc)_glewProfile_glGetUniformi64vARB,
+  (_GLEWProc)_glewProfile_glGetUniformui64vARB,
+  (_GLEWProc)_glewProfile_glGetnUniformi64vARB,
+  (_GLEWProc)_glewProfile_glGetnUniformui64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform1i64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform1i64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform1ui64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform1ui64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform2i64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform2i64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform2ui64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform2ui64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform3i64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform3i64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform3ui64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform3ui64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform4i64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform4i64vARB,
+  (_GLEWProc)_glewProfile_glProgramUniform4ui64ARB,
+  (_GLEWProc)_glewProfile_glProgramUniform4ui64vARB,
+  (_GLEWProc)_glewProfile_glUniform1i64ARB,
+  (_GLEWProc)_glewProfile_glUniform1i64vARB,
+  (_GLEWProc)_glewProfile_glUniform1ui64ARB,
+  (_GLEWProc)_glewProfile_glUniform1ui64vARB,
+  (_GLEWProc)_glewProfile_glUniform2i64ARB,
+  (_GLEWProc)_glewProfile_glUniform2i64vARB,
+  (_GLEWProc)_glewProfile_glUniform2ui64ARB,
+  (_GLEWProc)_glewProfile_glUniform2ui64vARB,
+  (_GLEWProc)_glewProfile_glUniform3i64ARB,
+  (_GLEWProc)_glewProfile_glUniform3i64vARB,
+  (_GLEWProc)_glewProfile_glUniform3ui64ARB,
+  (_GLEWProc)_glewProfile_glUniform3ui64vARB,
+  (_GLEWProc)_glewProfile_glUniform4i64ARB,
+  (_GLEWProc)_glewProfile_glUniform4i64vARB,
+  (_GLEWProc)_glewProfile_glUniform4ui64ARB,
+  (_GLEWProc)_glewProfile_glUniform4ui64vARB,
+  (_GLEWProc)_glewProfile_glColorSubTable,
+  (_GLEWProc)_glewProfile_glColorTable,
+  (_GLEWProc)_glewProfile_glColorTableParameterfv,
+  (_GLEWProc)_glewProfile_glColorTableParameteriv,
+  (_GLEWProc)_glewProfile_glConvolutionFilter1D,
+  (_GLEWProc)_glewProfile_glConvolutionFilter2D,
+  (_GLEWProc)_glewProfile_glConvolutionParameterf,
+  (_GLEWProc)_glewProfile_glConvolutionParameterfv,
+  (_GLEWProc)_glewProfile_glConvolutionParameteri,
+  (_GLEWProc)_glewProfile_glConvolutionParameteriv,
+  (_GLEWProc)_glewProfile_glCopyColorSubTable,
+  (_GLEWProc)_glewProfile_glCopyColorTable,
+  (_GLEWProc)_glewProfile_glCopyConvolutionFilter1D,
+  (_GLEWProc)_glewProfile_glCopyConvolutionFilter2D,
+  (_GLEWProc)_glewProfile_glGetColorTable,
+  (_GLEWProc)_glewProfile_glGetColorTableParameterfv,
+  (_GLEWProc)_glewProfile_glGetColorTableParameteriv,
+  (_GLEWProc)_glewProfile_glGetConvolutionFilter,
+  (_GLEWProc)_glewProfile_glGetConvolutionParameterfv,
+  (_GLEWProc)_glewProfile_glGetConvolutionParameteriv,
+  (_GLEWProc)_glewProfile_glGetHistogram,
+  (_GLEWProc)_glewProfile_glGetHistogramParameterfv,
+  (_GLEWProc)_glewProfile_glGetHistogramParameteriv,
+  (_GLEWProc)_glewProfile_glGetMinmax,
+  (_GLEWProc)_glewProfile_glGetMinmaxParameterfv,
+  (_GLEWProc)_glewProfile_glGetMinmaxParameteriv,
+  (_GLEWProc)_glewProfile_glGetSeparableFilter,
+  (_GLEWProc)_glewProfile_glHistogram,
+  (_GLEWProc)_glewProfile_glMinmax,
+  (_GLEWProc)_glewProfile_glResetHistogram,
+  (_GLEWProc)_glewProfile_glResetMinmax,
+  (_GLEWProc)_glewProfile_glSeparableFilter2D,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirectCountARB,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirectCountARB,
+  (_GLEWProc)_glewProfile_glDrawArraysInstancedARB,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedARB,
+  (_GLEWProc)_glewProfile_glVertexAttribDivisorARB,
+  (_GLEWProc)_glewProfile_glGetInternalformativ,
+  (_GLEWProc)_glewProfile_glGetInternalformati64v,
+  (_GLEWProc)_glewProfile_glInvalidateBufferData,
+  (_GLEWProc)_glewProfile_glInvalidateBufferSubData,
+  (_GLEWProc)_glewProfile_glInvalidateFramebuffer,
+  (_GLEWProc)_glewProfile_glInvalidateSubFramebuffer,
+  (_GLEWProc)_glewProfile_glInvalidateTexImage,
+  (_GLEWProc)_glewProfile_glInvalidateTexSubImage,
+  (_GLEWProc)_glewProfile_glFlushMappedBufferRange,
+  (_GLEWProc)_glewProfile_glMapBufferRange,
+  (_GLEWProc)_glewProfile_glCurrentPaletteMatrixARB,
+  (_GLEWProc)_glewProfile_glMatrixIndexPointerARB,
+  (_GLEWProc)_glewProfile_glMatrixIndexubvARB,
+  (_GLEWProc)_glewProfile_glMatrixIndexuivARB,
+  (_GLEWProc)_glewProfile_glMatrixIndexusvARB,
+  (_GLEWProc)_glewProfile_glBindBuffersBase,
+  (_GLEWProc)_glewProfile_glBindBuffersRange,
+  (_GLEWProc)_glewProfile_glBindImageTextures,
+  (_GLEWProc)_glewProfile_glBindSamplers,
+  (_GLEWProc)_glewProfile_glBindTextures,
+  (_GLEWProc)_glewProfile_glBindVertexBuffers,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirect,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirect,
+  (_GLEWProc)_glewProfile_glSampleCoverageARB,
+  (_GLEWProc)_glewProfile_glActiveTextureARB,
+  (_GLEWProc)_glewProfile_glClientActiveTextureARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1dARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1dvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1fARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1fvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1iARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1ivARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1sARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1svARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2dARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2dvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2fARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2fvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2iARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2ivARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2sARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2svARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3dARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3dvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3fARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3fvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3iARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3ivARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3sARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3svARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4dARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4dvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4fARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4fvARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4iARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4ivARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4sARB,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4svARB,
+  (_GLEWProc)_glewProfile_glBeginQueryARB,
+  (_GLEWProc)_glewProfile_glDeleteQueriesARB,
+  (_GLEWProc)_glewProfile_glEndQueryARB,
+  (_GLEWProc)_glewProfile_glGenQueriesARB,
+  (_GLEWProc)_glewProfile_glGetQueryObjectivARB,
+  (_GLEWProc)_glewProfile_glGetQueryObjectuivARB,
+  (_GLEWProc)_glewProfile_glGetQueryivARB,
+  (_GLEWProc)_glewProfile_glIsQueryARB,
+  (_GLEWProc)_glewProfile_glMaxShaderCompilerThreadsARB,
+  (_GLEWProc)_glewProfile_glPointParameterfARB,
+  (_GLEWProc)_glewProfile_glPointParameterfvARB,
+  (_GLEWProc)_glewProfile_glPolygonOffsetClamp,
+  (_GLEWProc)_glewProfile_glGetProgramInterfaceiv,
+  (_GLEWProc)_glewProfile_glGetProgramResourceIndex,
+  (_GLEWProc)_glewProfile_glGetProgramResourceLocation,
+  (_GLEWProc)_glewProfile_glGetProgramResourceLocationIndex,
+  (_GLEWProc)_glewProfile_glGetProgramResourceName,
+  (_GLEWProc)_glewProfile_glGetProgramResourceiv,
+  (_GLEWProc)_glewProfile_glProvokingVertex,
+  (_GLEWProc)_glewProfile_glGetGraphicsResetStatusARB,
+  (_GLEWProc)_glewProfile_glGetnColorTableARB,
+  (_GLEWProc)_glewProfile_glGetnCompressedTexImageARB,
+  (_GLEWProc)_glewProfile_glGetnConvolutionFilterARB,
+  (_GLEWProc)_glewProfile_glGetnHistogramARB,
+  (_GLEWProc)_glewProfile_glGetnMapdvARB,
+  (_GLEWProc)_glewProfile_glGetnMapfvARB,
+  (_GLEWProc)_glewProfile_glGetnMapivARB,
+  (_GLEWProc)_glewProfile_glGetnMinmaxARB,
+  (_GLEWProc)_glewProfile_glGetnPixelMapfvARB,
+  (_GLEWProc)_glewProfile_glGetnPixelMapuivARB,
+  (_GLEWProc)_glewProfile_glGetnPixelMapusvARB,
+  (_GLEWProc)_glewProfile_glGetnPolygonStippleARB,
+  (_GLEWProc)_glewProfile_glGetnSeparableFilterARB,
+  (_GLEWProc)_glewProfile_glGetnTexImageARB,
+  (_GLEWProc)_glewProfile_glGetnUniformdvARB,
+  (_GLEWProc)_glewProfile_glGetnUniformfvARB,
+  (_GLEWProc)_glewProfile_glGetnUniformivARB,
+  (_GLEWProc)_glewProfile_glGetnUniformuivARB,
+  (_GLEWProc)_glewProfile_glReadnPixelsARB,
+  (_GLEWProc)_glewProfile_glFramebufferSampleLocationsfvARB,
+  (_GLEWProc)_glewProfile_glNamedFramebufferSampleLocationsfvARB,
+  (_GLEWProc)_glewProfile_glMinSampleShadingARB,
+  (_GLEWProc)_glewProfile_glBindSampler,
+  (_GLEWProc)_glewProfile_glDeleteSamplers,
+  (_GLEWProc)_glewProfile_glGenSamplers,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterIiv,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterIuiv,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterfv,
+  (_GLEWProc)_glewProfile_glGetSamplerParameteriv,
+  (_GLEWProc)_glewProfile_glIsSampler,
+  (_GLEWProc)_glewProfile_glSamplerParameterIiv,
+  (_GLEWProc)_glewProfile_glSamplerParameterIuiv,
+  (_GLEWProc)_glewProfile_glSamplerParameterf,
+  (_GLEWProc)_glewProfile_glSamplerParameterfv,
+  (_GLEWProc)_glewProfile_glSamplerParameteri,
+  (_GLEWProc)_glewProfile_glSamplerParameteriv,
+  (_GLEWProc)_glewProfile_glActiveShaderProgram,
+  (_GLEWProc)_glewProfile_glBindProgramPipeline,
+  (_GLEWProc)_glewProfile_glCreateShaderProgramv,
+  (_GLEWProc)_glewProfile_glDeleteProgramPipelines,
+  (_GLEWProc)_glewProfile_glGenProgramPipelines,
+  (_GLEWProc)_glewProfile_glGetProgramPipelineInfoLog,
+  (_GLEWProc)_glewProfile_glGetProgramPipelineiv,
+  (_GLEWProc)_glewProfile_glIsProgramPipeline,
+  (_GLEWProc)_glewProfile_glProgramUniform1d,
+  (_GLEWProc)_glewProfile_glProgramUniform1dv,
+  (_GLEWProc)_glewProfile_glProgramUniform1f,
+  (_GLEWProc)_glewProfile_glProgramUniform1fv,
+  (_GLEWProc)_glewProfile_glProgramUniform1i,
+  (_GLEWProc)_glewProfile_glProgramUniform1iv,
+  (_GLEWProc)_glewProfile_glProgramUniform1ui,
+  (_GLEWProc)_glewProfile_glProgramUniform1uiv,
+  (_GLEWProc)_glewProfile_glProgramUniform2d,
+  (_GLEWProc)_glewProfile_glProgramUniform2dv,
+  (_GLEWProc)_glewProfile_glProgramUniform2f,
+  (_GLEWProc)_glewProfile_glProgramUniform2fv,
+  (_GLEWProc)_glewProfile_glProgramUniform2i,
+  (_GLEWProc)_glewProfile_glProgramUniform2iv,
+  (_GLEWProc)_glewProfile_glProgramUniform2ui,
+  (_GLEWProc)_glewProfile_glProgramUniform2uiv,
+  (_GLEWProc)_glewProfile_glProgramUniform3d,
+  (_GLEWProc)_glewProfile_glProgramUniform3dv,
+  (_GLEWProc)_glewProfile_glProgramUniform3f,
+  (_GLEWProc)_glewProfile_glProgramUniform3fv,
+  (_GLEWProc)_glewProfile_glProgramUniform3i,
+  (_GLEWProc)_glewProfile_glProgramUniform3iv,
+  (_GLEWProc)_glewProfile_glProgramUniform3ui,
+  (_GLEWProc)_glewProfile_glProgramUniform3uiv,
+  (_GLEWProc)_glewProfile_glProgramUniform4d,
+  (_GLEWProc)_glewProfile_glProgramUniform4dv,
+  (_GLEWProc)_glewProfile_glProgramUniform4f,
+  (_GLEWProc)_glewProfile_glProgramUniform4fv,
+  (_GLEWProc)_glewProfile_glProgramUniform4i,
+  (_GLEWProc)_glewProfile_glProgramUniform4iv,
+  (_GLEWProc)_glewProfile_glProgramUniform4ui,
+  (_GLEWProc)_glewProfile_glProgramUniform4uiv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2x3dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2x3fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2x4dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2x4fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3x2dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3x2fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3x4dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3x4fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4x2dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4x2fv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4x3dv,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4x3fv,
+  (_GLEWProc)_glewProfile_glUseProgramStages,
+  (_GLEWProc)_glewProfile_glValidateProgramPipeline,
+  (_GLEWProc)_glewProfile_glGetActiveAtomicCounterBufferiv,
+  (_GLEWProc)_glewProfile_glBindImageTexture,
+  (_GLEWProc)_glewProfile_glMemoryBarrier,
+  (_GLEWProc)_glewProfile_glAttachObjectARB,
+  (_GLEWProc)_glewProfile_glCompileShaderARB,
+  (_GLEWProc)_glewProfile_glCreateProgramObjectARB,
+  (_GLEWProc)_glewProfile_glCreateShaderObjectARB,
+  (_GLEWProc)_glewProfile_glDeleteObjectARB,
+  (_GLEWProc)_glewProfile_glDetachObjectARB,
+  (_GLEWProc)_glewProfile_glGetActiveUniformARB,
+  (_GLEWProc)_glewProfile_glGetAttachedObjectsARB,
+  (_GLEWProc)_glewProfile_glGetHandleARB,
+  (_GLEWProc)_glewProfile_glGetInfoLogARB,
+  (_GLEWProc)_glewProfile_glGetObjectParameterfvARB,
+  (_GLEWProc)_glewProfile_glGetObjectParameterivARB,
+  (_GLEWProc)_glewProfile_glGetShaderSourceARB,
+  (_GLEWProc)_glewProfile_glGetUniformLocationARB,
+  (_GLEWProc)_glewProfile_glGetUniformfvARB,
+  (_GLEWProc)_glewProfile_glGetUniformivARB,
+  (_GLEWProc)_glewProfile_glLinkProgramARB,
+  (_GLEWProc)_glewProfile_glShaderSourceARB,
+  (_GLEWProc)_glewProfile_glUniform1fARB,
+  (_GLEWProc)_glewProfile_glUniform1fvARB,
+  (_GLEWProc)_glewProfile_glUniform1iARB,
+  (_GLEWProc)_glewProfile_glUniform1ivARB,
+  (_GLEWProc)_glewProfile_glUniform2fARB,
+  (_GLEWProc)_glewProfile_glUniform2fvARB,
+  (_GLEWProc)_glewProfile_glUniform2iARB,
+  (_GLEWProc)_glewProfile_glUniform2ivARB,
+  (_GLEWProc)_glewProfile_glUniform3fARB,
+  (_GLEWProc)_glewProfile_glUniform3fvARB,
+  (_GLEWProc)_glewProfile_glUniform3iARB,
+  (_GLEWProc)_glewProfile_glUniform3ivARB,
+  (_GLEWProc)_glewProfile_glUniform4fARB,
+  (_GLEWProc)_glewProfile_glUniform4fvARB,
+  (_GLEWProc)_glewProfile_glUniform4iARB,
+  (_GLEWProc)_glewProfile_glUniform4ivARB,
+  (_GLEWProc)_glewProfile_glUniformMatrix2fvARB,
+  (_GLEWProc)_glewProfile_glUniformMatrix3fvARB,
+  (_GLEWProc)_glewProfile_glUniformMatrix4fvARB,
+  (_GLEWProc)_glewProfile_glUseProgramObjectARB,
+  (_GLEWProc)_glewProfile_glValidateProgramARB,
+  (_GLEWProc)_glewProfile_glShaderStorageBlockBinding,
+  (_GLEWProc)_glewProfile_glGetActiveSubroutineName,
+  (_GLEWProc)_glewProfile_glGetActiveSubroutineUniformName,
+  (_GLEWProc)_glewProfile_glGetActiveSubroutineUniformiv,
+  (_GLEWProc)_glewProfile_glGetProgramStageiv,
+  (_GLEWProc)_glewProfile_glGetSubroutineIndex,
+  (_GLEWProc)_glewProfile_glGetSubroutineUniformLocation,
+  (_GLEWProc)_glewProfile_glGetUniformSubroutineuiv,
+  (_GLEWProc)_glewProfile_glUniformSubroutinesuiv,
+  (_GLEWProc)_glewProfile_glCompileShaderIncludeARB,
+  (_GLEWProc)_glewProfile_glDeleteNamedStringARB,
+  (_GLEWProc)_glewProfile_glGetNamedStringARB,
+  (_GLEWProc)_glewProfile_glGetNamedStringivARB,
+  (_GLEWProc)_glewProfile_glIsNamedStringARB,
+  (_GLEWProc)_glewProfile_glNamedStringARB,
+  (_GLEWProc)_glewProfile_glBufferPageCommitmentARB,
+  (_GLEWProc)_glewProfile_glTexPageCommitmentARB,
+  (_GLEWProc)_glewProfile_glClientWaitSync,
+  (_GLEWProc)_glewProfile_glDeleteSync,
+  (_GLEWProc)_glewProfile_glFenceSync,
+  (_GLEWProc)_glewProfile_glGetInteger64v,
+  (_GLEWProc)_glewProfile_glGetSynciv,
+  (_GLEWProc)_glewProfile_glIsSync,
+  (_GLEWProc)_glewProfile_glWaitSync,
+  (_GLEWProc)_glewProfile_glPatchParameterfv,
+  (_GLEWProc)_glewProfile_glPatchParameteri,
+  (_GLEWProc)_glewProfile_glTextureBarrier,
+  (_GLEWProc)_glewProfile_glTexBufferARB,
+  (_GLEWProc)_glewProfile_glTexBufferRange,
+  (_GLEWProc)_glewProfile_glTextureBufferRangeEXT,
+  (_GLEWProc)_glewProfile_glCompressedTexImage1DARB,
+  (_GLEWProc)_glewProfile_glCompressedTexImage2DARB,
+  (_GLEWProc)_glewProfile_glCompressedTexImage3DARB,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage1DARB,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage2DARB,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage3DARB,
+  (_GLEWProc)_glewProfile_glGetCompressedTexImageARB,
+  (_GLEWProc)_glewProfile_glGetMultisamplefv,
+  (_GLEWProc)_glewProfile_glSampleMaski,
+  (_GLEWProc)_glewProfile_glTexImage2DMultisample,
+  (_GLEWProc)_glewProfile_glTexImage3DMultisample,
+  (_GLEWProc)_glewProfile_glTexStorage1D,
+  (_GLEWProc)_glewProfile_glTexStorage2D,
+  (_GLEWProc)_glewProfile_glTexStorage3D,
+  (_GLEWProc)_glewProfile_glTexStorage2DMultisample,
+  (_GLEWProc)_glewProfile_glTexStorage3DMultisample,
+  (_GLEWProc)_glewProfile_glTextureStorage2DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glTextureStorage3DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glTextureView,
+  (_GLEWProc)_glewProfile_glGetQueryObjecti64v,
+  (_GLEWProc)_glewProfile_glGetQueryObjectui64v,
+  (_GLEWProc)_glewProfile_glQueryCounter,
+  (_GLEWProc)_glewProfile_glBindTransformFeedback,
+  (_GLEWProc)_glewProfile_glDeleteTransformFeedbacks,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedback,
+  (_GLEWProc)_glewProfile_glGenTransformFeedbacks,
+  (_GLEWProc)_glewProfile_glIsTransformFeedback,
+  (_GLEWProc)_glewProfile_glPauseTransformFeedback,
+  (_GLEWProc)_glewProfile_glResumeTransformFeedback,
+  (_GLEWProc)_glewProfile_glBeginQueryIndexed,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedbackStream,
+  (_GLEWProc)_glewProfile_glEndQueryIndexed,
+  (_GLEWProc)_glewProfile_glGetQueryIndexediv,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedbackInstanced,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedbackStreamInstanced,
+  (_GLEWProc)_glewProfile_glLoadTransposeMatrixdARB,
+  (_GLEWProc)_glewProfile_glLoadTransposeMatrixfARB,
+  (_GLEWProc)_glewProfile_glMultTransposeMatrixdARB,
+  (_GLEWProc)_glewProfile_glMultTransposeMatrixfARB,
+  (_GLEWProc)_glewProfile_glBindBufferBase,
+  (_GLEWProc)_glewProfile_glBindBufferRange,
+  (_GLEWProc)_glewProfile_glGetActiveUniformBlockName,
+  (_GLEWProc)_glewProfile_glGetActiveUniformBlockiv,
+  (_GLEWProc)_glewProfile_glGetActiveUniformName,
+  (_GLEWProc)_glewProfile_glGetActiveUniformsiv,
+  (_GLEWProc)_glewProfile_glGetIntegeri_v,
+  (_GLEWProc)_glewProfile_glGetUniformBlockIndex,
+  (_GLEWProc)_glewProfile_glGetUniformIndices,
+  (_GLEWProc)_glewProfile_glUniformBlockBinding,
+  (_GLEWProc)_glewProfile_glBindVertexArray,
+  (_GLEWProc)_glewProfile_glDeleteVertexArrays,
+  (_GLEWProc)_glewProfile_glGenVertexArrays,
+  (_GLEWProc)_glewProfile_glIsVertexArray,
+  (_GLEWProc)_glewProfile_glGetVertexAttribLdv,
+  (_GLEWProc)_glewProfile_glVertexAttribL1d,
+  (_GLEWProc)_glewProfile_glVertexAttribL1dv,
+  (_GLEWProc)_glewProfile_glVertexAttribL2d,
+  (_GLEWProc)_glewProfile_glVertexAttribL2dv,
+  (_GLEWProc)_glewProfile_glVertexAttribL3d,
+  (_GLEWProc)_glewProfile_glVertexAttribL3dv,
+  (_GLEWProc)_glewProfile_glVertexAttribL4d,
+  (_GLEWProc)_glewProfile_glVertexAttribL4dv,
+  (_GLEWProc)_glewProfile_glVertexAttribLPointer,
+  (_GLEWProc)_glewProfile_glBindVertexBuffer,
+  (_GLEWProc)_glewProfile_glVertexArrayBindVertexBufferEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribBindingEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribFormatEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribIFormatEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribLFormatEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexBindingDivisorEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribBinding,
+  (_GLEWProc)_glewProfile_glVertexAttribFormat,
+  (_GLEWProc)_glewProfile_glVertexAttribIFormat,
+  (_GLEWProc)_glewProfile_glVertexAttribLFormat,
+  (_GLEWProc)_glewProfile_glVertexBindingDivisor,
+  (_GLEWProc)_glewProfile_glVertexBlendARB,
+  (_GLEWProc)_glewProfile_glWeightPointerARB,
+  (_GLEWProc)_glewProfile_glWeightbvARB,
+  (_GLEWProc)_glewProfile_glWeightdvARB,
+  (_GLEWProc)_glewProfile_glWeightfvARB,
+  (_GLEWProc)_glewProfile_glWeightivARB,
+  (_GLEWProc)_glewProfile_glWeightsvARB,
+  (_GLEWProc)_glewProfile_glWeightubvARB,
+  (_GLEWProc)_glewProfile_glWeightuivARB,
+  (_GLEWProc)_glewProfile_glWeightusvARB,
+  (_GLEWProc)_glewProfile_glBindBufferARB,
+  (_GLEWProc)_glewProfile_glBufferDataARB,
+  (_GLEWProc)_glewProfile_glBufferSubDataARB,
+  (_GLEWProc)_glewProfile_glDeleteBuffersARB,
+  (_GLEWProc)_glewProfile_glGenBuffersARB,
+  (_GLEWProc)_glewProfile_glGetBufferParameterivARB,
+  (_GLEWProc)_glewProfile_glGetBufferPointervARB,
+  (_GLEWProc)_glewProfile_glGetBufferSubDataARB,
+  (_GLEWProc)_glewProfile_glIsBufferARB,
+  (_GLEWProc)_glewProfile_glMapBufferARB,
+  (_GLEWProc)_glewProfile_glUnmapBufferARB,
+  (_GLEWProc)_glewProfile_glBindProgramARB,
+  (_GLEWProc)_glewProfile_glDeleteProgramsARB,
+  (_GLEWProc)_glewProfile_glDisableVertexAttribArrayARB,
+  (_GLEWProc)_glewProfile_glEnableVertexAttribArrayARB,
+  (_GLEWProc)_glewProfile_glGenProgramsARB,
+  (_GLEWProc)_glewProfile_glGetProgramEnvParameterdvARB,
+  (_GLEWProc)_glewProfile_glGetProgramEnvParameterfvARB,
+  (_GLEWProc)_glewProfile_glGetProgramLocalParameterdvARB,
+  (_GLEWProc)_glewProfile_glGetProgramLocalParameterfvARB,
+  (_GLEWProc)_glewProfile_glGetProgramStringARB,
+  (_GLEWProc)_glewProfile_glGetProgramivARB,
+  (_GLEWProc)_glewProfile_glGetVertexAttribPointervARB,
+  (_GLEWProc)_glewProfile_glGetVertexAttribdvARB,
+  (_GLEWProc)_glewProfile_glGetVertexAttribfvARB,
+  (_GLEWProc)_glewProfile_glGetVertexAttribivARB,
+  (_GLEWProc)_glewProfile_glIsProgramARB,
+  (_GLEWProc)_glewProfile_glProgramEnvParameter4dARB,
+  (_GLEWProc)_glewProfile_glProgramEnvParameter4dvARB,
+  (_GLEWProc)_glewProfile_glProgramEnvParameter4fARB,
+  (_GLEWProc)_glewProfile_glProgramEnvParameter4fvARB,
+  (_GLEWProc)_glewProfile_glProgramLocalParameter4dARB,
+  (_GLEWProc)_glewProfile_glProgramLocalParameter4dvARB,
+  (_GLEWProc)_glewProfile_glProgramLocalParameter4fARB,
+  (_GLEWProc)_glewProfile_glProgramLocalParameter4fvARB,
+  (_GLEWProc)_glewProfile_glProgramStringARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib1dARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib1dvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib1fARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib1fvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib1sARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib1svARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib2dARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib2dvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib2fARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib2fvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib2sARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib2svARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib3dARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib3dvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib3fARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib3fvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib3sARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib3svARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NbvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NivARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NsvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NubARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NubvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NuivARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4NusvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4bvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4dARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4dvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4fARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4fvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4ivARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4sARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4svARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4ubvARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4uivARB,
+  (_GLEWProc)_glewProfile_glVertexAttrib4usvARB,
+  (_GLEWProc)_glewProfile_glVertexAttribPointerARB,
+  (_GLEWProc)_glewProfile_glBindAttribLocationARB,
+  (_GLEWProc)_glewProfile_glGetActiveAttribARB,
+  (_GLEWProc)_glewProfile_glGetAttribLocationARB,
+  (_GLEWProc)_glewProfile_glColorP3ui,
+  (_GLEWProc)_glewProfile_glColorP3uiv,
+  (_GLEWProc)_glewProfile_glColorP4ui,
+  (_GLEWProc)_glewProfile_glColorP4uiv,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP1ui,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP1uiv,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP2ui,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP2uiv,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP3ui,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP3uiv,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP4ui,
+  (_GLEWProc)_glewProfile_glMultiTexCoordP4uiv,
+  (_GLEWProc)_glewProfile_glNormalP3ui,
+  (_GLEWProc)_glewProfile_glNormalP3uiv,
+  (_GLEWProc)_glewProfile_glSecondaryColorP3ui,
+  (_GLEWProc)_glewProfile_glSecondaryColorP3uiv,
+  (_GLEWProc)_glewProfile_glTexCoordP1ui,
+  (_GLEWProc)_glewProfile_glTexCoordP1uiv,
+  (_GLEWProc)_glewProfile_glTexCoordP2ui,
+  (_GLEWProc)_glewProfile_glTexCoordP2uiv,
+  (_GLEWProc)_glewProfile_glTexCoordP3ui,
+  (_GLEWProc)_glewProfile_glTexCoordP3uiv,
+  (_GLEWProc)_glewProfile_glTexCoordP4ui,
+  (_GLEWProc)_glewProfile_glTexCoordP4uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribP1ui,
+  (_GLEWProc)_glewProfile_glVertexAttribP1uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribP2ui,
+  (_GLEWProc)_glewProfile_glVertexAttribP2uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribP3ui,
+  (_GLEWProc)_glewProfile_glVertexAttribP3uiv,
+  (_GLEWProc)_glewProfile_glVertexAttribP4ui,
+  (_GLEWProc)_glewProfile_glVertexAttribP4uiv,
+  (_GLEWProc)_glewProfile_glVertexP2ui,
+  (_GLEWProc)_glewProfile_glVertexP2uiv,
+  (_GLEWProc)_glewProfile_glVertexP3ui,
+  (_GLEWProc)_glewProfile_glVertexP3uiv,
+  (_GLEWProc)_glewProfile_glVertexP4ui,
+  (_GLEWProc)_glewProfile_glVertexP4uiv,
+  (_GLEWProc)_glewProfile_glDepthRangeArrayv,
+  (_GLEWProc)_glewProfile_glDepthRangeIndexed,
+  (_GLEWProc)_glewProfile_glGetDoublei_v,
+  (_GLEWProc)_glewProfile_glGetFloati_v,
+  (_GLEWProc)_glewProfile_glScissorArrayv,
+  (_GLEWProc)_glewProfile_glScissorIndexed,
+  (_GLEWProc)_glewProfile_glScissorIndexedv,
+  (_GLEWProc)_glewProfile_glViewportArrayv,
+  (_GLEWProc)_glewProfile_glViewportIndexedf,
+  (_GLEWProc)_glewProfile_glViewportIndexedfv,
+  (_GLEWProc)_glewProfile_glWindowPos2dARB,
+  (_GLEWProc)_glewProfile_glWindowPos2dvARB,
+  (_GLEWProc)_glewProfile_glWindowPos2fARB,
+  (_GLEWProc)_glewProfile_glWindowPos2fvARB,
+  (_GLEWProc)_glewProfile_glWindowPos2iARB,
+  (_GLEWProc)_glewProfile_glWindowPos2ivARB,
+  (_GLEWProc)_glewProfile_glWindowPos2sARB,
+  (_GLEWProc)_glewProfile_glWindowPos2svARB,
+  (_GLEWProc)_glewProfile_glWindowPos3dARB,
+  (_GLEWProc)_glewProfile_glWindowPos3dvARB,
+  (_GLEWProc)_glewProfile_glWindowPos3fARB,
+  (_GLEWProc)_glewProfile_glWindowPos3fvARB,
+  (_GLEWProc)_glewProfile_glWindowPos3iARB,
+  (_GLEWProc)_glewProfile_glWindowPos3ivARB,
+  (_GLEWProc)_glewProfile_glWindowPos3sARB,
+  (_GLEWProc)_glewProfile_glWindowPos3svARB,
+  (_GLEWProc)_glewProfile_glDrawBuffersATI,
+  (_GLEWProc)_glewProfile_glDrawElementArrayATI,
+  (_GLEWProc)_glewProfile_glDrawRangeElementArrayATI,
+  (_GLEWProc)_glewProfile_glElementPointerATI,
+  (_GLEWProc)_glewProfile_glGetTexBumpParameterfvATI,
+  (_GLEWProc)_glewProfile_glGetTexBumpParameterivATI,
+  (_GLEWProc)_glewProfile_glTexBumpParameterfvATI,
+  (_GLEWProc)_glewProfile_glTexBumpParameterivATI,
+  (_GLEWProc)_glewProfile_glAlphaFragmentOp1ATI,
+  (_GLEWProc)_glewProfile_glAlphaFragmentOp2ATI,
+  (_GLEWProc)_glewProfile_glAlphaFragmentOp3ATI,
+  (_GLEWProc)_glewProfile_glBeginFragmentShaderATI,
+  (_GLEWProc)_glewProfile_glBindFragmentShaderATI,
+  (_GLEWProc)_glewProfile_glColorFragmentOp1ATI,
+  (_GLEWProc)_glewProfile_glColorFragmentOp2ATI,
+  (_GLEWProc)_glewProfile_glColorFragmentOp3ATI,
+  (_GLEWProc)_glewProfile_glDeleteFragmentShaderATI,
+  (_GLEWProc)_glewProfile_glEndFragmentShaderATI,
+  (_GLEWProc)_glewProfile_glGenFragmentShadersATI,
+  (_GLEWProc)_glewProfile_glPassTexCoordATI,
+  (_GLEWProc)_glewProfile_glSampleMapATI,
+  (_GLEWProc)_glewProfile_glSetFragmentShaderConstantATI,
+  (_GLEWProc)_glewProfile_glMapObjectBufferATI,
+  (_GLEWProc)_glewProfile_glUnmapObjectBufferATI,
+  (_GLEWProc)_glewProfile_glPNTrianglesfATI,
+  (_GLEWProc)_glewProfile_glPNTrianglesiATI,
+  (_GLEWProc)_glewProfile_glStencilFuncSeparateATI,
+  (_GLEWProc)_glewProfile_glStencilOpSeparateATI,
+  (_GLEWProc)_glewProfile_glArrayObjectATI,
+  (_GLEWProc)_glewProfile_glFreeObjectBufferATI,
+  (_GLEWProc)_glewProfile_glGetArrayObjectfvATI,
+  (_GLEWProc)_glewProfile_glGetArrayObjectivATI,
+  (_GLEWProc)_glewProfile_glGetObjectBufferfvATI,
+  (_GLEWProc)_glewProfile_glGetObjectBufferivATI,
+  (_GLEWProc)_glewProfile_glGetVariantArrayObjectfvATI,
+  (_GLEWProc)_glewProfile_glGetVariantArrayObjectivATI,
+  (_GLEWProc)_glewProfile_glIsObjectBufferATI,
+  (_GLEWProc)_glewProfile_glNewObjectBufferATI,
+  (_GLEWProc)_glewProfile_glUpdateObjectBufferATI,
+  (_GLEWProc)_glewProfile_glVariantArrayObjectATI,
+  (_GLEWProc)_glewProfile_glGetVertexAttribArrayObjectfvATI,
+  (_GLEWProc)_glewProfile_glGetVertexAttribArrayObjectivATI,
+  (_GLEWProc)_glewProfile_glVertexAttribArrayObjectATI,
+  (_GLEWProc)_glewProfile_glClientActiveVertexStreamATI,
+  (_GLEWProc)_glewProfile_glNormalStream3bATI,
+  (_GLEWProc)_glewProfile_glNormalStream3bvATI,
+  (_GLEWProc)_glewProfile_glNormalStream3dATI,
+  (_GLEWProc)_glewProfile_glNormalStream3dvATI,
+  (_GLEWProc)_glewProfile_glNormalStream3fATI,
+  (_GLEWProc)_glewProfile_glNormalStream3fvATI,
+  (_GLEWProc)_glewProfile_glNormalStream3iATI,
+  (_GLEWProc)_glewProfile_glNormalStream3ivATI,
+  (_GLEWProc)_glewProfile_glNormalStream3sATI,
+  (_GLEWProc)_glewProfile_glNormalStream3svATI,
+  (_GLEWProc)_glewProfile_glVertexBlendEnvfATI,
+  (_GLEWProc)_glewProfile_glVertexBlendEnviATI,
+  (_GLEWProc)_glewProfile_glVertexStream1dATI,
+  (_GLEWProc)_glewProfile_glVertexStream1dvATI,
+  (_GLEWProc)_glewProfile_glVertexStream1fATI,
+  (_GLEWProc)_glewProfile_glVertexStream1fvATI,
+  (_GLEWProc)_glewProfile_glVertexStream1iATI,
+  (_GLEWProc)_glewProfile_glVertexStream1ivATI,
+  (_GLEWProc)_glewProfile_glVertexStream1sATI,
+  (_GLEWProc)_glewProfile_glVertexStream1svATI,
+  (_GLEWProc)_glewProfile_glVertexStream2dATI,
+  (_GLEWProc)_glewProfile_glVertexStream2dvATI,
+  (_GLEWProc)_glewProfile_glVertexStream2fATI,
+  (_GLEWProc)_glewProfile_glVertexStream2fvATI,
+  (_GLEWProc)_glewProfile_glVertexStream2iATI,
+  (_GLEWProc)_glewProfile_glVertexStream2ivATI,
+  (_GLEWProc)_glewProfile_glVertexStream2sATI,
+  (_GLEWProc)_glewProfile_glVertexStream2svATI,
+  (_GLEWProc)_glewProfile_glVertexStream3dATI,
+  (_GLEWProc)_glewProfile_glVertexStream3dvATI,
+  (_GLEWProc)_glewProfile_glVertexStream3fATI,
+  (_GLEWProc)_glewProfile_glVertexStream3fvATI,
+  (_GLEWProc)_glewProfile_glVertexStream3iATI,
+  (_GLEWProc)_glewProfile_glVertexStream3ivATI,
+  (_GLEWProc)_glewProfile_glVertexStream3sATI,
+  (_GLEWProc)_glewProfile_glVertexStream3svATI,
+  (_GLEWProc)_glewProfile_glVertexStream4dATI,
+  (_GLEWProc)_glewProfile_glVertexStream4dvATI,
+  (_GLEWProc)_glewProfile_glVertexStream4fATI,
+  (_GLEWProc)_glewProfile_glVertexStream4fvATI,
+  (_GLEWProc)_glewProfile_glVertexStream4iATI,
+  (_GLEWProc)_glewProfile_glVertexStream4ivATI,
+  (_GLEWProc)_glewProfile_glVertexStream4sATI,
+  (_GLEWProc)_glewProfile_glVertexStream4svATI,
+  (_GLEWProc)_glewProfile_glEGLImageTargetTexStorageEXT,
+  (_GLEWProc)_glewProfile_glEGLImageTargetTextureStorageEXT,
+  (_GLEWProc)_glewProfile_glDrawArraysInstancedBaseInstanceEXT,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedBaseInstanceEXT,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedBaseVertexBaseInstanceEXT,
+  (_GLEWProc)_glewProfile_glGetUniformBufferSizeEXT,
+  (_GLEWProc)_glewProfile_glGetUniformOffsetEXT,
+  (_GLEWProc)_glewProfile_glUniformBufferEXT,
+  (_GLEWProc)_glewProfile_glBlendColorEXT,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparateEXT,
+  (_GLEWProc)_glewProfile_glBindFragDataLocationIndexedEXT,
+  (_GLEWProc)_glewProfile_glGetFragDataIndexEXT,
+  (_GLEWProc)_glewProfile_glGetProgramResourceLocationIndexEXT,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparateEXT,
+  (_GLEWProc)_glewProfile_glBlendEquationEXT,
+  (_GLEWProc)_glewProfile_glBufferStorageEXT,
+  (_GLEWProc)_glewProfile_glNamedBufferStorageEXT,
+  (_GLEWProc)_glewProfile_glClearTexImageEXT,
+  (_GLEWProc)_glewProfile_glClearTexSubImageEXT,
+  (_GLEWProc)_glewProfile_glClipControlEXT,
+  (_GLEWProc)_glewProfile_glColorSubTableEXT,
+  (_GLEWProc)_glewProfile_glCopyColorSubTableEXT,
+  (_GLEWProc)_glewProfile_glLockArraysEXT,
+  (_GLEWProc)_glewProfile_glUnlockArraysEXT,
+  (_GLEWProc)_glewProfile_glConvolutionFilter1DEXT,
+  (_GLEWProc)_glewProfile_glConvolutionFilter2DEXT,
+  (_GLEWProc)_glewProfile_glConvolutionParameterfEXT,
+  (_GLEWProc)_glewProfile_glConvolutionParameterfvEXT,
+  (_GLEWProc)_glewProfile_glConvolutionParameteriEXT,
+  (_GLEWProc)_glewProfile_glConvolutionParameterivEXT,
+  (_GLEWProc)_glewProfile_glCopyConvolutionFilter1DEXT,
+  (_GLEWProc)_glewProfile_glCopyConvolutionFilter2DEXT,
+  (_GLEWProc)_glewProfile_glGetConvolutionFilterEXT,
+  (_GLEWProc)_glewProfile_glGetConvolutionParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetConvolutionParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetSeparableFilterEXT,
+  (_GLEWProc)_glewProfile_glSeparableFilter2DEXT,
+  (_GLEWProc)_glewProfile_glBinormalPointerEXT,
+  (_GLEWProc)_glewProfile_glTangentPointerEXT,
+  (_GLEWProc)_glewProfile_glCopyImageSubDataEXT,
+  (_GLEWProc)_glewProfile_glCopyTexImage1DEXT,
+  (_GLEWProc)_glewProfile_glCopyTexImage2DEXT,
+  (_GLEWProc)_glewProfile_glCopyTexSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glCopyTexSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glCopyTexSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glCullParameterdvEXT,
+  (_GLEWProc)_glewProfile_glCullParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetObjectLabelEXT,
+  (_GLEWProc)_glewProfile_glLabelObjectEXT,
+  (_GLEWProc)_glewProfile_glInsertEventMarkerEXT,
+  (_GLEWProc)_glewProfile_glPopGroupMarkerEXT,
+  (_GLEWProc)_glewProfile_glPushGroupMarkerEXT,
+  (_GLEWProc)_glewProfile_glDepthBoundsEXT,
+  (_GLEWProc)_glewProfile_glBindMultiTextureEXT,
+  (_GLEWProc)_glewProfile_glCheckNamedFramebufferStatusEXT,
+  (_GLEWProc)_glewProfile_glClientAttribDefaultEXT,
+  (_GLEWProc)_glewProfile_glCompressedMultiTexImage1DEXT,
+  (_GLEWProc)_glewProfile_glCompressedMultiTexImage2DEXT,
+  (_GLEWProc)_glewProfile_glCompressedMultiTexImage3DEXT,
+  (_GLEWProc)_glewProfile_glCompressedMultiTexSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glCompressedMultiTexSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glCompressedMultiTexSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glCompressedTextureImage1DEXT,
+  (_GLEWProc)_glewProfile_glCompressedTextureImage2DEXT,
+  (_GLEWProc)_glewProfile_glCompressedTextureImage3DEXT,
+  (_GLEWProc)_glewProfile_glCompressedTextureSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glCompressedTextureSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glCompressedTextureSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glCopyMultiTexImage1DEXT,
+  (_GLEWProc)_glewProfile_glCopyMultiTexImage2DEXT,
+  (_GLEWProc)_glewProfile_glCopyMultiTexSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glCopyMultiTexSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glCopyMultiTexSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glCopyTextureImage1DEXT,
+  (_GLEWProc)_glewProfile_glCopyTextureImage2DEXT,
+  (_GLEWProc)_glewProfile_glCopyTextureSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glCopyTextureSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glCopyTextureSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glDisableClientStateIndexedEXT,
+  (_GLEWProc)_glewProfile_glDisableClientStateiEXT,
+  (_GLEWProc)_glewProfile_glDisableVertexArrayAttribEXT,
+  (_GLEWProc)_glewProfile_glDisableVertexArrayEXT,
+  (_GLEWProc)_glewProfile_glEnableClientStateIndexedEXT,
+  (_GLEWProc)_glewProfile_glEnableClientStateiEXT,
+  (_GLEWProc)_glewProfile_glEnableVertexArrayAttribEXT,
+  (_GLEWProc)_glewProfile_glEnableVertexArrayEXT,
+  (_GLEWProc)_glewProfile_glFlushMappedNamedBufferRangeEXT,
+  (_GLEWProc)_glewProfile_glFramebufferDrawBufferEXT,
+  (_GLEWProc)_glewProfile_glFramebufferDrawBuffersEXT,
+  (_GLEWProc)_glewProfile_glFramebufferReadBufferEXT,
+  (_GLEWProc)_glewProfile_glGenerateMultiTexMipmapEXT,
+  (_GLEWProc)_glewProfile_glGenerateTextureMipmapEXT,
+  (_GLEWProc)_glewProfile_glGetCompressedMultiTexImageEXT,
+  (_GLEWProc)_glewProfile_glGetCompressedTextureImageEXT,
+  (_GLEWProc)_glewProfile_glGetDoubleIndexedvEXT,
+  (_GLEWProc)_glewProfile_glGetDoublei_vEXT,
+  (_GLEWProc)_glewProfile_glGetFloatIndexedvEXT,
+  (_GLEWProc)_glewProfile_glGetFloati_vEXT,
+  (_GLEWProc)_glewProfile_glGetFramebufferParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexEnvfvEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexEnvivEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexGendvEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexGenfvEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexGenivEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexImageEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexLevelParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexLevelParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexParameterIivEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetMultiTexParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetNamedBufferParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetNamedBufferPointervEXT,
+  (_GLEWProc)_glewProfile_glGetNamedBufferSubDataEXT,
+  (_GLEWProc)_glewProfile_glGetNamedFramebufferAttachmentParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetNamedProgramLocalParameterIivEXT,
+  (_GLEWProc)_glewProfile_glGetNamedProgramLocalParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glGetNamedProgramLocalParameterdvEXT,
+  (_GLEWProc)_glewProfile_glGetNamedProgramLocalParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetNamedProgramStringEXT,
+  (_GLEWProc)_glewProfile_glGetNamedProgramivEXT,
+  (_GLEWProc)_glewProfile_glGetNamedRenderbufferParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetPointerIndexedvEXT,
+  (_GLEWProc)_glewProfile_glGetPointeri_vEXT,
+  (_GLEWProc)_glewProfile_glGetTextureImageEXT,
+  (_GLEWProc)_glewProfile_glGetTextureLevelParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetTextureLevelParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetTextureParameterIivEXT,
+  (_GLEWProc)_glewProfile_glGetTextureParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glGetTextureParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetTextureParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetVertexArrayIntegeri_vEXT,
+  (_GLEWProc)_glewProfile_glGetVertexArrayIntegervEXT,
+  (_GLEWProc)_glewProfile_glGetVertexArrayPointeri_vEXT,
+  (_GLEWProc)_glewProfile_glGetVertexArrayPointervEXT,
+  (_GLEWProc)_glewProfile_glMapNamedBufferEXT,
+  (_GLEWProc)_glewProfile_glMapNamedBufferRangeEXT,
+  (_GLEWProc)_glewProfile_glMatrixFrustumEXT,
+  (_GLEWProc)_glewProfile_glMatrixLoadIdentityEXT,
+  (_GLEWProc)_glewProfile_glMatrixLoadTransposedEXT,
+  (_GLEWProc)_glewProfile_glMatrixLoadTransposefEXT,
+  (_GLEWProc)_glewProfile_glMatrixLoaddEXT,
+  (_GLEWProc)_glewProfile_glMatrixLoadfEXT,
+  (_GLEWProc)_glewProfile_glMatrixMultTransposedEXT,
+  (_GLEWProc)_glewProfile_glMatrixMultTransposefEXT,
+  (_GLEWProc)_glewProfile_glMatrixMultdEXT,
+  (_GLEWProc)_glewProfile_glMatrixMultfEXT,
+  (_GLEWProc)_glewProfile_glMatrixOrthoEXT,
+  (_GLEWProc)_glewProfile_glMatrixPopEXT,
+  (_GLEWProc)_glewProfile_glMatrixPushEXT,
+  (_GLEWProc)_glewProfile_glMatrixRotatedEXT,
+  (_GLEWProc)_glewProfile_glMatrixRotatefEXT,
+  (_GLEWProc)_glewProfile_glMatrixScaledEXT,
+  (_GLEWProc)_glewProfile_glMatrixScalefEXT,
+  (_GLEWProc)_glewProfile_glMatrixTranslatedEXT,
+  (_GLEWProc)_glewProfile_glMatrixTranslatefEXT,
+  (_GLEWProc)_glewProfile_glMultiTexBufferEXT,
+  (_GLEWProc)_glewProfile_glMultiTexCoordPointerEXT,
+  (_GLEWProc)_glewProfile_glMultiTexEnvfEXT,
+  (_GLEWProc)_glewProfile_glMultiTexEnvfvEXT,
+  (_GLEWProc)_glewProfile_glMultiTexEnviEXT,
+  (_GLEWProc)_glewProfile_glMultiTexEnvivEXT,
+  (_GLEWProc)_glewProfile_glMultiTexGendEXT,
+  (_GLEWProc)_glewProfile_glMultiTexGendvEXT,
+  (_GLEWProc)_glewProfile_glMultiTexGenfEXT,
+  (_GLEWProc)_glewProfile_glMultiTexGenfvEXT,
+  (_GLEWProc)_glewProfile_glMultiTexGeniEXT,
+  (_GLEWProc)_glewProfile_glMultiTexGenivEXT,
+  (_GLEWProc)_glewProfile_glMultiTexImage1DEXT,
+  (_GLEWProc)_glewProfile_glMultiTexImage2DEXT,
+  (_GLEWProc)_glewProfile_glMultiTexImage3DEXT,
+  (_GLEWProc)_glewProfile_glMultiTexParameterIivEXT,
+  (_GLEWProc)_glewProfile_glMultiTexParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glMultiTexParameterfEXT,
+  (_GLEWProc)_glewProfile_glMultiTexParameterfvEXT,
+  (_GLEWProc)_glewProfile_glMultiTexParameteriEXT,
+  (_GLEWProc)_glewProfile_glMultiTexParameterivEXT,
+  (_GLEWProc)_glewProfile_glMultiTexRenderbufferEXT,
+  (_GLEWProc)_glewProfile_glMultiTexSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glMultiTexSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glMultiTexSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glNamedBufferDataEXT,
+  (_GLEWProc)_glewProfile_glNamedBufferSubDataEXT,
+  (_GLEWProc)_glewProfile_glNamedCopyBufferSubDataEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferRenderbufferEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTexture1DEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTexture2DEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTexture3DEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTextureEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTextureFaceEXT,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTextureLayerEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameter4dEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameter4dvEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameter4fEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameter4fvEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameterI4iEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameterI4ivEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameterI4uiEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameterI4uivEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParameters4fvEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParametersI4ivEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramLocalParametersI4uivEXT,
+  (_GLEWProc)_glewProfile_glNamedProgramStringEXT,
+  (_GLEWProc)_glewProfile_glNamedRenderbufferStorageEXT,
+  (_GLEWProc)_glewProfile_glNamedRenderbufferStorageMultisampleCoverageEXT,
+  (_GLEWProc)_glewProfile_glNamedRenderbufferStorageMultisampleEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform1fEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform1fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform1iEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform1ivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform1uiEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform1uivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform2fEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform2fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform2iEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform2ivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform2uiEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform2uivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform3fEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform3fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform3iEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform3ivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform3uiEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform3uivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform4fEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform4fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform4iEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform4ivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform4uiEXT,
+  (_GLEWProc)_glewProfile_glProgramUniform4uivEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2x3fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix2x4fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3x2fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix3x4fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4x2fvEXT,
+  (_GLEWProc)_glewProfile_glProgramUniformMatrix4x3fvEXT,
+  (_GLEWProc)_glewProfile_glPushClientAttribDefaultEXT,
+  (_GLEWProc)_glewProfile_glTextureBufferEXT,
+  (_GLEWProc)_glewProfile_glTextureImage1DEXT,
+  (_GLEWProc)_glewProfile_glTextureImage2DEXT,
+  (_GLEWProc)_glewProfile_glTextureImage3DEXT,
+  (_GLEWProc)_glewProfile_glTextureParameterIivEXT,
+  (_GLEWProc)_glewProfile_glTextureParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glTextureParameterfEXT,
+  (_GLEWProc)_glewProfile_glTextureParameterfvEXT,
+  (_GLEWProc)_glewProfile_glTextureParameteriEXT,
+  (_GLEWProc)_glewProfile_glTextureParameterivEXT,
+  (_GLEWProc)_glewProfile_glTextureRenderbufferEXT,
+  (_GLEWProc)_glewProfile_glTextureSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glTextureSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glTextureSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glUnmapNamedBufferEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayColorOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayEdgeFlagOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayFogCoordOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayIndexOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayMultiTexCoordOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayNormalOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArraySecondaryColorOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayTexCoordOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribDivisorEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribIOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexOffsetEXT,
+  (_GLEWProc)_glewProfile_glDiscardFramebufferEXT,
+  (_GLEWProc)_glewProfile_glBeginQueryEXT,
+  (_GLEWProc)_glewProfile_glDeleteQueriesEXT,
+  (_GLEWProc)_glewProfile_glEndQueryEXT,
+  (_GLEWProc)_glewProfile_glGenQueriesEXT,
+  (_GLEWProc)_glewProfile_glGetInteger64vEXT,
+  (_GLEWProc)_glewProfile_glGetQueryObjectivEXT,
+  (_GLEWProc)_glewProfile_glGetQueryObjectuivEXT,
+  (_GLEWProc)_glewProfile_glGetQueryivEXT,
+  (_GLEWProc)_glewProfile_glIsQueryEXT,
+  (_GLEWProc)_glewProfile_glQueryCounterEXT,
+  (_GLEWProc)_glewProfile_glDrawBuffersEXT,
+  (_GLEWProc)_glewProfile_glColorMaskIndexedEXT,
+  (_GLEWProc)_glewProfile_glDisableIndexedEXT,
+  (_GLEWProc)_glewProfile_glEnableIndexedEXT,
+  (_GLEWProc)_glewProfile_glGetBooleanIndexedvEXT,
+  (_GLEWProc)_glewProfile_glGetIntegerIndexedvEXT,
+  (_GLEWProc)_glewProfile_glIsEnabledIndexedEXT,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparateiEXT,
+  (_GLEWProc)_glewProfile_glBlendEquationiEXT,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparateiEXT,
+  (_GLEWProc)_glewProfile_glBlendFunciEXT,
+  (_GLEWProc)_glewProfile_glColorMaskiEXT,
+  (_GLEWProc)_glewProfile_glDisableiEXT,
+  (_GLEWProc)_glewProfile_glEnableiEXT,
+  (_GLEWProc)_glewProfile_glIsEnablediEXT,
+  (_GLEWProc)_glewProfile_glDrawElementsBaseVertexEXT,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedBaseVertexEXT,
+  (_GLEWProc)_glewProfile_glDrawRangeElementsBaseVertexEXT,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsBaseVertexEXT,
+  (_GLEWProc)_glewProfile_glDrawArraysInstancedEXT,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedEXT,
+  (_GLEWProc)_glewProfile_glDrawRangeElementsEXT,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedbackEXT,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedbackInstancedEXT,
+  (_GLEWProc)_glewProfile_glBufferStorageExternalEXT,
+  (_GLEWProc)_glewProfile_glNamedBufferStorageExternalEXT,
+  (_GLEWProc)_glewProfile_glFogCoordPointerEXT,
+  (_GLEWProc)_glewProfile_glFogCoorddEXT,
+  (_GLEWProc)_glewProfile_glFogCoorddvEXT,
+  (_GLEWProc)_glewProfile_glFogCoordfEXT,
+  (_GLEWProc)_glewProfile_glFogCoordfvEXT,
+  (_GLEWProc)_glewProfile_glFragmentColorMaterialEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightModelfEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightModelfvEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightModeliEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightModelivEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightfEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightfvEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightiEXT,
+  (_GLEWProc)_glewProfile_glFragmentLightivEXT,
+  (_GLEWProc)_glewProfile_glFragmentMaterialfEXT,
+  (_GLEWProc)_glewProfile_glFragmentMaterialfvEXT,
+  (_GLEWProc)_glewProfile_glFragmentMaterialiEXT,
+  (_GLEWProc)_glewProfile_glFragmentMaterialivEXT,
+  (_GLEWProc)_glewProfile_glGetFragmentLightfvEXT,
+  (_GLEWProc)_glewProfile_glGetFragmentLightivEXT,
+  (_GLEWProc)_glewProfile_glGetFragmentMaterialfvEXT,
+  (_GLEWProc)_glewProfile_glGetFragmentMaterialivEXT,
+  (_GLEWProc)_glewProfile_glLightEnviEXT,
+  (_GLEWProc)_glewProfile_glBlitFramebufferEXT,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleEXT,
+  (_GLEWProc)_glewProfile_glBindFramebufferEXT,
+  (_GLEWProc)_glewProfile_glBindRenderbufferEXT,
+  (_GLEWProc)_glewProfile_glCheckFramebufferStatusEXT,
+  (_GLEWProc)_glewProfile_glDeleteFramebuffersEXT,
+  (_GLEWProc)_glewProfile_glDeleteRenderbuffersEXT,
+  (_GLEWProc)_glewProfile_glFramebufferRenderbufferEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTexture1DEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTexture2DEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTexture3DEXT,
+  (_GLEWProc)_glewProfile_glGenFramebuffersEXT,
+  (_GLEWProc)_glewProfile_glGenRenderbuffersEXT,
+  (_GLEWProc)_glewProfile_glGenerateMipmapEXT,
+  (_GLEWProc)_glewProfile_glGetFramebufferAttachmentParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetRenderbufferParameterivEXT,
+  (_GLEWProc)_glewProfile_glIsFramebufferEXT,
+  (_GLEWProc)_glewProfile_glIsRenderbufferEXT,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTextureEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTextureFaceEXT,
+  (_GLEWProc)_glewProfile_glProgramParameteriEXT,
+  (_GLEWProc)_glewProfile_glProgramEnvParameters4fvEXT,
+  (_GLEWProc)_glewProfile_glProgramLocalParameters4fvEXT,
+  (_GLEWProc)_glewProfile_glBindFragDataLocationEXT,
+  (_GLEWProc)_glewProfile_glGetFragDataLocationEXT,
+  (_GLEWProc)_glewProfile_glGetUniformuivEXT,
+  (_GLEWProc)_glewProfile_glGetVertexAttribIivEXT,
+  (_GLEWProc)_glewProfile_glGetVertexAttribIuivEXT,
+  (_GLEWProc)_glewProfile_glUniform1uiEXT,
+  (_GLEWProc)_glewProfile_glUniform1uivEXT,
+  (_GLEWProc)_glewProfile_glUniform2uiEXT,
+  (_GLEWProc)_glewProfile_glUniform2uivEXT,
+  (_GLEWProc)_glewProfile_glUniform3uiEXT,
+  (_GLEWProc)_glewProfile_glUniform3uivEXT,
+  (_GLEWProc)_glewProfile_glUniform4uiEXT,
+  (_GLEWProc)_glewProfile_glUniform4uivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI1iEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI1ivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI1uiEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI1uivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI2iEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI2ivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI2uiEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI2uivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI3iEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI3ivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI3uiEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI3uivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4bvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4iEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4ivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4svEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4ubvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4uiEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4uivEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribI4usvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribIPointerEXT,
+  (_GLEWProc)_glewProfile_glGetHistogramEXT,
+  (_GLEWProc)_glewProfile_glGetHistogramParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetHistogramParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetMinmaxEXT,
+  (_GLEWProc)_glewProfile_glGetMinmaxParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetMinmaxParameterivEXT,
+  (_GLEWProc)_glewProfile_glHistogramEXT,
+  (_GLEWProc)_glewProfile_glMinmaxEXT,
+  (_GLEWProc)_glewProfile_glResetHistogramEXT,
+  (_GLEWProc)_glewProfile_glResetMinmaxEXT,
+  (_GLEWProc)_glewProfile_glIndexFuncEXT,
+  (_GLEWProc)_glewProfile_glIndexMaterialEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribDivisorEXT,
+  (_GLEWProc)_glewProfile_glApplyTextureEXT,
+  (_GLEWProc)_glewProfile_glTextureLightEXT,
+  (_GLEWProc)_glewProfile_glTextureMaterialEXT,
+  (_GLEWProc)_glewProfile_glFlushMappedBufferRangeEXT,
+  (_GLEWProc)_glewProfile_glMapBufferRangeEXT,
+  (_GLEWProc)_glewProfile_glBufferStorageMemEXT,
+  (_GLEWProc)_glewProfile_glCreateMemoryObjectsEXT,
+  (_GLEWProc)_glewProfile_glDeleteMemoryObjectsEXT,
+  (_GLEWProc)_glewProfile_glGetMemoryObjectParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetUnsignedBytei_vEXT,
+  (_GLEWProc)_glewProfile_glGetUnsignedBytevEXT,
+  (_GLEWProc)_glewProfile_glIsMemoryObjectEXT,
+  (_GLEWProc)_glewProfile_glMemoryObjectParameterivEXT,
+  (_GLEWProc)_glewProfile_glNamedBufferStorageMemEXT,
+  (_GLEWProc)_glewProfile_glTexStorageMem1DEXT,
+  (_GLEWProc)_glewProfile_glTexStorageMem2DEXT,
+  (_GLEWProc)_glewProfile_glTexStorageMem2DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glTexStorageMem3DEXT,
+  (_GLEWProc)_glewProfile_glTexStorageMem3DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glTextureStorageMem1DEXT,
+  (_GLEWProc)_glewProfile_glTextureStorageMem2DEXT,
+  (_GLEWProc)_glewProfile_glTextureStorageMem2DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glTextureStorageMem3DEXT,
+  (_GLEWProc)_glewProfile_glTextureStorageMem3DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glImportMemoryFdEXT,
+  (_GLEWProc)_glewProfile_glImportMemoryWin32HandleEXT,
+  (_GLEWProc)_glewProfile_glImportMemoryWin32NameEXT,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysEXT,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsEXT,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirectEXT,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirectEXT,
+  (_GLEWProc)_glewProfile_glSampleMaskEXT,
+  (_GLEWProc)_glewProfile_glSamplePatternEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTexture2DMultisampleEXT,
+  (_GLEWProc)_glewProfile_glDrawBuffersIndexedEXT,
+  (_GLEWProc)_glewProfile_glGetIntegeri_vEXT,
+  (_GLEWProc)_glewProfile_glReadBufferIndexedEXT,
+  (_GLEWProc)_glewProfile_glColorTableEXT,
+  (_GLEWProc)_glewProfile_glGetColorTableEXT,
+  (_GLEWProc)_glewProfile_glGetColorTableParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetColorTableParameterivEXT,
+  (_GLEWProc)_glewProfile_glGetPixelTransformParameterfvEXT,
+  (_GLEWProc)_glewProfile_glGetPixelTransformParameterivEXT,
+  (_GLEWProc)_glewProfile_glPixelTransformParameterfEXT,
+  (_GLEWProc)_glewProfile_glPixelTransformParameterfvEXT,
+  (_GLEWProc)_glewProfile_glPixelTransformParameteriEXT,
+  (_GLEWProc)_glewProfile_glPixelTransformParameterivEXT,
+  (_GLEWProc)_glewProfile_glPointParameterfEXT,
+  (_GLEWProc)_glewProfile_glPointParameterfvEXT,
+  (_GLEWProc)_glewProfile_glPolygonOffsetEXT,
+  (_GLEWProc)_glewProfile_glPolygonOffsetClampEXT,
+  (_GLEWProc)_glewProfile_glPrimitiveBoundingBoxEXT,
+  (_GLEWProc)_glewProfile_glProvokingVertexEXT,
+  (_GLEWProc)_glewProfile_glCoverageModulationNV,
+  (_GLEWProc)_glewProfile_glCoverageModulationTableNV,
+  (_GLEWProc)_glewProfile_glGetCoverageModulationTableNV,
+  (_GLEWProc)_glewProfile_glRasterSamplesEXT,
+  (_GLEWProc)_glewProfile_glGetnUniformfvEXT,
+  (_GLEWProc)_glewProfile_glGetnUniformivEXT,
+  (_GLEWProc)_glewProfile_glReadnPixelsEXT,
+  (_GLEWProc)_glewProfile_glBeginSceneEXT,
+  (_GLEWProc)_glewProfile_glEndSceneEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3bEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3bvEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3dEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3dvEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3fEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3fvEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3iEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3ivEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3sEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3svEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3ubEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3ubvEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3uiEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3uivEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3usEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColor3usvEXT,
+  (_GLEWProc)_glewProfile_glSecondaryColorPointerEXT,
+  (_GLEWProc)_glewProfile_glDeleteSemaphoresEXT,
+  (_GLEWProc)_glewProfile_glGenSemaphoresEXT,
+  (_GLEWProc)_glewProfile_glGetSemaphoreParameterui64vEXT,
+  (_GLEWProc)_glewProfile_glIsSemaphoreEXT,
+  (_GLEWProc)_glewProfile_glSemaphoreParameterui64vEXT,
+  (_GLEWProc)_glewProfile_glSignalSemaphoreEXT,
+  (_GLEWProc)_glewProfile_glWaitSemaphoreEXT,
+  (_GLEWProc)_glewProfile_glImportSemaphoreFdEXT,
+  (_GLEWProc)_glewProfile_glImportSemaphoreWin32HandleEXT,
+  (_GLEWProc)_glewProfile_glImportSemaphoreWin32NameEXT,
+  (_GLEWProc)_glewProfile_glActiveProgramEXT,
+  (_GLEWProc)_glewProfile_glCreateShaderProgramEXT,
+  (_GLEWProc)_glewProfile_glUseShaderProgramEXT,
+  (_GLEWProc)_glewProfile_glFramebufferFetchBarrierEXT,
+  (_GLEWProc)_glewProfile_glBindImageTextureEXT,
+  (_GLEWProc)_glewProfile_glMemoryBarrierEXT,
+  (_GLEWProc)_glewProfile_glClearPixelLocalStorageuiEXT,
+  (_GLEWProc)_glewProfile_glFramebufferPixelLocalStorageSizeEXT,
+  (_GLEWProc)_glewProfile_glGetFramebufferPixelLocalStorageSizeEXT,
+  (_GLEWProc)_glewProfile_glTexPageCommitmentEXT,
+  (_GLEWProc)_glewProfile_glTexturePageCommitmentEXT,
+  (_GLEWProc)_glewProfile_glActiveStencilFaceEXT,
+  (_GLEWProc)_glewProfile_glTexSubImage1DEXT,
+  (_GLEWProc)_glewProfile_glTexSubImage2DEXT,
+  (_GLEWProc)_glewProfile_glTexSubImage3DEXT,
+  (_GLEWProc)_glewProfile_glPatchParameteriEXT,
+  (_GLEWProc)_glewProfile_glTexImage3DEXT,
+  (_GLEWProc)_glewProfile_glFramebufferTextureLayerEXT,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterIivEXT,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glSamplerParameterIivEXT,
+  (_GLEWProc)_glewProfile_glSamplerParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glTexBufferEXT,
+  (_GLEWProc)_glewProfile_glClearColorIiEXT,
+  (_GLEWProc)_glewProfile_glClearColorIuiEXT,
+  (_GLEWProc)_glewProfile_glGetTexParameterIivEXT,
+  (_GLEWProc)_glewProfile_glGetTexParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glTexParameterIivEXT,
+  (_GLEWProc)_glewProfile_glTexParameterIuivEXT,
+  (_GLEWProc)_glewProfile_glAreTexturesResidentEXT,
+  (_GLEWProc)_glewProfile_glBindTextureEXT,
+  (_GLEWProc)_glewProfile_glDeleteTexturesEXT,
+  (_GLEWProc)_glewProfile_glGenTexturesEXT,
+  (_GLEWProc)_glewProfile_glIsTextureEXT,
+  (_GLEWProc)_glewProfile_glPrioritizeTexturesEXT,
+  (_GLEWProc)_glewProfile_glTextureNormalEXT,
+  (_GLEWProc)_glewProfile_glTexStorage1DEXT,
+  (_GLEWProc)_glewProfile_glTexStorage2DEXT,
+  (_GLEWProc)_glewProfile_glTexStorage3DEXT,
+  (_GLEWProc)_glewProfile_glTextureStorage1DEXT,
+  (_GLEWProc)_glewProfile_glTextureStorage2DEXT,
+  (_GLEWProc)_glewProfile_glTextureStorage3DEXT,
+  (_GLEWProc)_glewProfile_glTextureViewEXT,
+  (_GLEWProc)_glewProfile_glGetQueryObjecti64vEXT,
+  (_GLEWProc)_glewProfile_glGetQueryObjectui64vEXT,
+  (_GLEWProc)_glewProfile_glBeginTransformFeedbackEXT,
+  (_GLEWProc)_glewProfile_glBindBufferBaseEXT,
+  (_GLEWProc)_glewProfile_glBindBufferOffsetEXT,
+  (_GLEWProc)_glewProfile_glBindBufferRangeEXT,
+  (_GLEWProc)_glewProfile_glEndTransformFeedbackEXT,
+  (_GLEWProc)_glewProfile_glGetTransformFeedbackVaryingEXT,
+  (_GLEWProc)_glewProfile_glTransformFeedbackVaryingsEXT,
+  (_GLEWProc)_glewProfile_glArrayElementEXT,
+  (_GLEWProc)_glewProfile_glColorPointerEXT,
+  (_GLEWProc)_glewProfile_glDrawArraysEXT,
+  (_GLEWProc)_glewProfile_glEdgeFlagPointerEXT,
+  (_GLEWProc)_glewProfile_glIndexPointerEXT,
+  (_GLEWProc)_glewProfile_glNormalPointerEXT,
+  (_GLEWProc)_glewProfile_glTexCoordPointerEXT,
+  (_GLEWProc)_glewProfile_glVertexPointerEXT,
+  (_GLEWProc)_glewProfile_glBindArraySetEXT,
+  (_GLEWProc)_glewProfile_glCreateArraySetExt,
+  (_GLEWProc)_glewProfile_glDeleteArraySetsEXT,
+  (_GLEWProc)_glewProfile_glGetVertexAttribLdvEXT,
+  (_GLEWProc)_glewProfile_glVertexArrayVertexAttribLOffsetEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL1dEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL1dvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL2dEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL2dvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL3dEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL3dvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL4dEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribL4dvEXT,
+  (_GLEWProc)_glewProfile_glVertexAttribLPointerEXT,
+  (_GLEWProc)_glewProfile_glBeginVertexShaderEXT,
+  (_GLEWProc)_glewProfile_glBindLightParameterEXT,
+  (_GLEWProc)_glewProfile_glBindMaterialParameterEXT,
+  (_GLEWProc)_glewProfile_glBindParameterEXT,
+  (_GLEWProc)_glewProfile_glBindTexGenParameterEXT,
+  (_GLEWProc)_glewProfile_glBindTextureUnitParameterEXT,
+  (_GLEWProc)_glewProfile_glBindVertexShaderEXT,
+  (_GLEWProc)_glewProfile_glDeleteVertexShaderEXT,
+  (_GLEWProc)_glewProfile_glDisableVariantClientStateEXT,
+  (_GLEWProc)_glewProfile_glEnableVariantClientStateEXT,
+  (_GLEWProc)_glewProfile_glEndVertexShaderEXT,
+  (_GLEWProc)_glewProfile_glExtractComponentEXT,
+  (_GLEWProc)_glewProfile_glGenSymbolsEXT,
+  (_GLEWProc)_glewProfile_glGenVertexShadersEXT,
+  (_GLEWProc)_glewProfile_glGetInvariantBooleanvEXT,
+  (_GLEWProc)_glewProfile_glGetInvariantFloatvEXT,
+  (_GLEWProc)_glewProfile_glGetInvariantIntegervEXT,
+  (_GLEWProc)_glewProfile_glGetLocalConstantBooleanvEXT,
+  (_GLEWProc)_glewProfile_glGetLocalConstantFloatvEXT,
+  (_GLEWProc)_glewProfile_glGetLocalConstantIntegervEXT,
+  (_GLEWProc)_glewProfile_glGetVariantBooleanvEXT,
+  (_GLEWProc)_glewProfile_glGetVariantFloatvEXT,
+  (_GLEWProc)_glewProfile_glGetVariantIntegervEXT,
+  (_GLEWProc)_glewProfile_glGetVariantPointervEXT,
+  (_GLEWProc)_glewProfile_glInsertComponentEXT,
+  (_GLEWProc)_glewProfile_glIsVariantEnabledEXT,
+  (_GLEWProc)_glewProfile_glSetInvariantEXT,
+  (_GLEWProc)_glewProfile_glSetLocalConstantEXT,
+  (_GLEWProc)_glewProfile_glShaderOp1EXT,
+  (_GLEWProc)_glewProfile_glShaderOp2EXT,
+  (_GLEWProc)_glewProfile_glShaderOp3EXT,
+  (_GLEWProc)_glewProfile_glSwizzleEXT,
+  (_GLEWProc)_glewProfile_glVariantPointerEXT,
+  (_GLEWProc)_glewProfile_glVariantbvEXT,
+  (_GLEWProc)_glewProfile_glVariantdvEXT,
+  (_GLEWProc)_glewProfile_glVariantfvEXT,
+  (_GLEWProc)_glewProfile_glVariantivEXT,
+  (_GLEWProc)_glewProfile_glVariantsvEXT,
+  (_GLEWProc)_glewProfile_glVariantubvEXT,
+  (_GLEWProc)_glewProfile_glVariantuivEXT,
+  (_GLEWProc)_glewProfile_glVariantusvEXT,
+  (_GLEWProc)_glewProfile_glWriteMaskEXT,
+  (_GLEWProc)_glewProfile_glVertexWeightPointerEXT,
+  (_GLEWProc)_glewProfile_glVertexWeightfEXT,
+  (_GLEWProc)_glewProfile_glVertexWeightfvEXT,
+  (_GLEWProc)_glewProfile_glAcquireKeyedMutexWin32EXT,
+  (_GLEWProc)_glewProfile_glReleaseKeyedMutexWin32EXT,
+  (_GLEWProc)_glewProfile_glWindowRectanglesEXT,
+  (_GLEWProc)_glewProfile_glImportSyncEXT,
+  (_GLEWProc)_glewProfile_glFrameTerminatorGREMEDY,
+  (_GLEWProc)_glewProfile_glStringMarkerGREMEDY,
+  (_GLEWProc)_glewProfile_glGetImageTransformParameterfvHP,
+  (_GLEWProc)_glewProfile_glGetImageTransformParameterivHP,
+  (_GLEWProc)_glewProfile_glImageTransformParameterfHP,
+  (_GLEWProc)_glewProfile_glImageTransformParameterfvHP,
+  (_GLEWProc)_glewProfile_glImageTransformParameteriHP,
+  (_GLEWProc)_glewProfile_glImageTransformParameterivHP,
+  (_GLEWProc)_glewProfile_glMultiModeDrawArraysIBM,
+  (_GLEWProc)_glewProfile_glMultiModeDrawElementsIBM,
+  (_GLEWProc)_glewProfile_glColorPointerListIBM,
+  (_GLEWProc)_glewProfile_glEdgeFlagPointerListIBM,
+  (_GLEWProc)_glewProfile_glFogCoordPointerListIBM,
+  (_GLEWProc)_glewProfile_glIndexPointerListIBM,
+  (_GLEWProc)_glewProfile_glNormalPointerListIBM,
+  (_GLEWProc)_glewProfile_glSecondaryColorPointerListIBM,
+  (_GLEWProc)_glewProfile_glTexCoordPointerListIBM,
+  (_GLEWProc)_glewProfile_glVertexPointerListIBM,
+  (_GLEWProc)_glewProfile_glGetTextureHandleIMG,
+  (_GLEWProc)_glewProfile_glGetTextureSamplerHandleIMG,
+  (_GLEWProc)_glewProfile_glProgramUniformHandleui64IMG,
+  (_GLEWProc)_glewProfile_glProgramUniformHandleui64vIMG,
+  (_GLEWProc)_glewProfile_glUniformHandleui64IMG,
+  (_GLEWProc)_glewProfile_glUniformHandleui64vIMG,
+  (_GLEWProc)_glewProfile_glFramebufferTexture2DDownsampleIMG,
+  (_GLEWProc)_glewProfile_glFramebufferTextureLayerDownsampleIMG,
+  (_GLEWProc)_glewProfile_glFramebufferTexture2DMultisampleIMG,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleIMG,
+  (_GLEWProc)_glewProfile_glMapTexture2DINTEL,
+  (_GLEWProc)_glewProfile_glSyncTextureINTEL,
+  (_GLEWProc)_glewProfile_glUnmapTexture2DINTEL,
+  (_GLEWProc)_glewProfile_glColorPointervINTEL,
+  (_GLEWProc)_glewProfile_glNormalPointervINTEL,
+  (_GLEWProc)_glewProfile_glTexCoordPointervINTEL,
+  (_GLEWProc)_glewProfile_glVertexPointervINTEL,
+  (_GLEWProc)_glewProfile_glBeginPerfQueryINTEL,
+  (_GLEWProc)_glewProfile_glCreatePerfQueryINTEL,
+  (_GLEWProc)_glewProfile_glDeletePerfQueryINTEL,
+  (_GLEWProc)_glewProfile_glEndPerfQueryINTEL,
+  (_GLEWProc)_glewProfile_glGetFirstPerfQueryIdINTEL,
+  (_GLEWProc)_glewProfile_glGetNextPerfQueryIdINTEL,
+  (_GLEWProc)_glewProfile_glGetPerfCounterInfoINTEL,
+  (_GLEWProc)_glewProfile_glGetPerfQueryDataINTEL,
+  (_GLEWProc)_glewProfile_glGetPerfQueryIdByNameINTEL,
+  (_GLEWProc)_glewProfile_glGetPerfQueryInfoINTEL,
+  (_GLEWProc)_glewProfile_glTexScissorFuncINTEL,
+  (_GLEWProc)_glewProfile_glTexScissorINTEL,
+  (_GLEWProc)_glewProfile_glBlendBarrierKHR,
+  (_GLEWProc)_glewProfile_glDebugMessageCallback,
+  (_GLEWProc)_glewProfile_glDebugMessageControl,
+  (_GLEWProc)_glewProfile_glDebugMessageInsert,
+  (_GLEWProc)_glewProfile_glGetDebugMessageLog,
+  (_GLEWProc)_glewProfile_glGetObjectLabel,
+  (_GLEWProc)_glewProfile_glGetObjectPtrLabel,
+  (_GLEWProc)_glewProfile_glObjectLabel,
+  (_GLEWProc)_glewProfile_glObjectPtrLabel,
+  (_GLEWProc)_glewProfile_glPopDebugGroup,
+  (_GLEWProc)_glewProfile_glPushDebugGroup,
+  (_GLEWProc)_glewProfile_glMaxShaderCompilerThreadsKHR,
+  (_GLEWProc)_glewProfile_glGetnUniformfv,
+  (_GLEWProc)_glewProfile_glGetnUniformiv,
+  (_GLEWProc)_glewProfile_glGetnUniformuiv,
+  (_GLEWProc)_glewProfile_glReadnPixels,
+  (_GLEWProc)_glewProfile_glBufferRegionEnabled,
+  (_GLEWProc)_glewProfile_glDeleteBufferRegion,
+  (_GLEWProc)_glewProfile_glDrawBufferRegion,
+  (_GLEWProc)_glewProfile_glNewBufferRegion,
+  (_GLEWProc)_glewProfile_glReadBufferRegion,
+  (_GLEWProc)_glewProfile_glFramebufferParameteriMESA,
+  (_GLEWProc)_glewProfile_glGetFramebufferParameterivMESA,
+  (_GLEWProc)_glewProfile_glResizeBuffersMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2dMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2dvMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2fMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2fvMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2iMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2ivMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2sMESA,
+  (_GLEWProc)_glewProfile_glWindowPos2svMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3dMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3dvMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3fMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3fvMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3iMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3ivMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3sMESA,
+  (_GLEWProc)_glewProfile_glWindowPos3svMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4dMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4dvMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4fMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4fvMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4iMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4ivMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4sMESA,
+  (_GLEWProc)_glewProfile_glWindowPos4svMESA,
+  (_GLEWProc)_glewProfile_glBeginConditionalRenderNVX,
+  (_GLEWProc)_glewProfile_glEndConditionalRenderNVX,
+  (_GLEWProc)_glewProfile_glAsyncCopyBufferSubDataNVX,
+  (_GLEWProc)_glewProfile_glAsyncCopyImageSubDataNVX,
+  (_GLEWProc)_glewProfile_glMulticastScissorArrayvNVX,
+  (_GLEWProc)_glewProfile_glMulticastViewportArrayvNVX,
+  (_GLEWProc)_glewProfile_glMulticastViewportPositionWScaleNVX,
+  (_GLEWProc)_glewProfile_glUploadGpuMaskNVX,
+  (_GLEWProc)_glewProfile_glLGPUCopyImageSubDataNVX,
+  (_GLEWProc)_glewProfile_glLGPUInterlockNVX,
+  (_GLEWProc)_glewProfile_glLGPUNamedBufferSubDataNVX,
+  (_GLEWProc)_glewProfile_glClientWaitSemaphoreui64NVX,
+  (_GLEWProc)_glewProfile_glSignalSemaphoreui64NVX,
+  (_GLEWProc)_glewProfile_glWaitSemaphoreui64NVX,
+  (_GLEWProc)_glewProfile_glStereoParameterfNV,
+  (_GLEWProc)_glewProfile_glStereoParameteriNV,
+  (_GLEWProc)_glewProfile_glAlphaToCoverageDitherControlNV,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirectBindlessNV,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirectBindlessNV,
+  (_GLEWProc)_glewProfile_glMultiDrawArraysIndirectBindlessCountNV,
+  (_GLEWProc)_glewProfile_glMultiDrawElementsIndirectBindlessCountNV,
+  (_GLEWProc)_glewProfile_glGetImageHandleNV,
+  (_GLEWProc)_glewProfile_glGetTextureHandleNV,
+  (_GLEWProc)_glewProfile_glGetTextureSamplerHandleNV,
+  (_GLEWProc)_glewProfile_glIsImageHandleResidentNV,
+  (_GLEWProc)_glewProfile_glIsTextureHandleResidentNV,
+  (_GLEWProc)_glewProfile_glMakeImageHandleNonResidentNV,
+  (_GLEWProc)_glewProfile_glMakeImageHandleResidentNV,
+  (_GLEWProc)_glewProfile_glMakeTextureHandleNonResidentNV,
+  (_GLEWProc)_glewProfile_glMakeTextureHandleResidentNV,
+  (_GLEWProc)_glewProfile_glProgramUniformHandleui64NV,
+  (_GLEWProc)_glewProfile_glProgramUniformHandleui64vNV,
+  (_GLEWProc)_glewProfile_glUniformHandleui64NV,
+  (_GLEWProc)_glewProfile_glUniformHandleui64vNV,
+  (_GLEWProc)_glewProfile_glBlendBarrierNV,
+  (_GLEWProc)_glewProfile_glBlendParameteriNV,
+  (_GLEWProc)_glewProfile_glViewportPositionWScaleNV,
+  (_GLEWProc)_glewProfile_glCallCommandListNV,
+  (_GLEWProc)_glewProfile_glCommandListSegmentsNV,
+  (_GLEWProc)_glewProfile_glCompileCommandListNV,
+  (_GLEWProc)_glewProfile_glCreateCommandListsNV,
+  (_GLEWProc)_glewProfile_glCreateStatesNV,
+  (_GLEWProc)_glewProfile_glDeleteCommandListsNV,
+  (_GLEWProc)_glewProfile_glDeleteStatesNV,
+  (_GLEWProc)_glewProfile_glDrawCommandsAddressNV,
+  (_GLEWProc)_glewProfile_glDrawCommandsNV,
+  (_GLEWProc)_glewProfile_glDrawCommandsStatesAddressNV,
+  (_GLEWProc)_glewProfile_glDrawCommandsStatesNV,
+  (_GLEWProc)_glewProfile_glGetCommandHeaderNV,
+  (_GLEWProc)_glewProfile_glGetStageIndexNV,
+  (_GLEWProc)_glewProfile_glIsCommandListNV,
+  (_GLEWProc)_glewProfile_glIsStateNV,
+  (_GLEWProc)_glewProfile_glListDrawCommandsStatesClientNV,
+  (_GLEWProc)_glewProfile_glStateCaptureNV,
+  (_GLEWProc)_glewProfile_glBeginConditionalRenderNV,
+  (_GLEWProc)_glewProfile_glEndConditionalRenderNV,
+  (_GLEWProc)_glewProfile_glSubpixelPrecisionBiasNV,
+  (_GLEWProc)_glewProfile_glConservativeRasterParameterfNV,
+  (_GLEWProc)_glewProfile_glConservativeRasterParameteriNV,
+  (_GLEWProc)_glewProfile_glCopyBufferSubDataNV,
+  (_GLEWProc)_glewProfile_glCopyImageSubDataNV,
+  (_GLEWProc)_glewProfile_glClearDepthdNV,
+  (_GLEWProc)_glewProfile_glDepthBoundsdNV,
+  (_GLEWProc)_glewProfile_glDepthRangedNV,
+  (_GLEWProc)_glewProfile_glDrawBuffersNV,
+  (_GLEWProc)_glewProfile_glDrawArraysInstancedNV,
+  (_GLEWProc)_glewProfile_glDrawElementsInstancedNV,
+  (_GLEWProc)_glewProfile_glDrawTextureNV,
+  (_GLEWProc)_glewProfile_glDrawVkImageNV,
+  (_GLEWProc)_glewProfile_glGetVkProcAddrNV,
+  (_GLEWProc)_glewProfile_glSignalVkFenceNV,
+  (_GLEWProc)_glewProfile_glSignalVkSemaphoreNV,
+  (_GLEWProc)_glewProfile_glWaitVkSemaphoreNV,
+  (_GLEWProc)_glewProfile_glEvalMapsNV,
+  (_GLEWProc)_glewProfile_glGetMapAttribParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetMapAttribParameterivNV,
+  (_GLEWProc)_glewProfile_glGetMapControlPointsNV,
+  (_GLEWProc)_glewProfile_glGetMapParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetMapParameterivNV,
+  (_GLEWProc)_glewProfile_glMapControlPointsNV,
+  (_GLEWProc)_glewProfile_glMapParameterfvNV,
+  (_GLEWProc)_glewProfile_glMapParameterivNV,
+  (_GLEWProc)_glewProfile_glGetMultisamplefvNV,
+  (_GLEWProc)_glewProfile_glSampleMaskIndexedNV,
+  (_GLEWProc)_glewProfile_glTexRenderbufferNV,
+  (_GLEWProc)_glewProfile_glDeleteFencesNV,
+  (_GLEWProc)_glewProfile_glFinishFenceNV,
+  (_GLEWProc)_glewProfile_glGenFencesNV,
+  (_GLEWProc)_glewProfile_glGetFenceivNV,
+  (_GLEWProc)_glewProfile_glIsFenceNV,
+  (_GLEWProc)_glewProfile_glSetFenceNV,
+  (_GLEWProc)_glewProfile_glTestFenceNV,
+  (_GLEWProc)_glewProfile_glFragmentCoverageColorNV,
+  (_GLEWProc)_glewProfile_glGetProgramNamedParameterdvNV,
+  (_GLEWProc)_glewProfile_glGetProgramNamedParameterfvNV,
+  (_GLEWProc)_glewProfile_glProgramNamedParameter4dNV,
+  (_GLEWProc)_glewProfile_glProgramNamedParameter4dvNV,
+  (_GLEWProc)_glewProfile_glProgramNamedParameter4fNV,
+  (_GLEWProc)_glewProfile_glProgramNamedParameter4fvNV,
+  (_GLEWProc)_glewProfile_glBlitFramebufferNV,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleNV,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageMultisampleCoverageNV,
+  (_GLEWProc)_glewProfile_glProgramVertexLimitNV,
+  (_GLEWProc)_glewProfile_glMulticastBarrierNV,
+  (_GLEWProc)_glewProfile_glMulticastBlitFramebufferNV,
+  (_GLEWProc)_glewProfile_glMulticastBufferSubDataNV,
+  (_GLEWProc)_glewProfile_glMulticastCopyBufferSubDataNV,
+  (_GLEWProc)_glewProfile_glMulticastCopyImageSubDataNV,
+  (_GLEWProc)_glewProfile_glMulticastFramebufferSampleLocationsfvNV,
+  (_GLEWProc)_glewProfile_glMulticastGetQueryObjecti64vNV,
+  (_GLEWProc)_glewProfile_glMulticastGetQueryObjectivNV,
+  (_GLEWProc)_glewProfile_glMulticastGetQueryObjectui64vNV,
+  (_GLEWProc)_glewProfile_glMulticastGetQueryObjectuivNV,
+  (_GLEWProc)_glewProfile_glMulticastWaitSyncNV,
+  (_GLEWProc)_glewProfile_glRenderGpuMaskNV,
+  (_GLEWProc)_glewProfile_glProgramEnvParameterI4iNV,
+  (_GLEWProc)_glewProfile_glProgramEnvParameterI4ivNV,
+  (_GLEWProc)_glewProfile_glProgramEnvParameterI4uiNV,
+  (_GLEWProc)_glewProfile_glProgramEnvParameterI4uivNV,
+  (_GLEWProc)_glewProfile_glProgramEnvParametersI4ivNV,
+  (_GLEWProc)_glewProfile_glProgramEnvParametersI4uivNV,
+  (_GLEWProc)_glewProfile_glProgramLocalParameterI4iNV,
+  (_GLEWProc)_glewProfile_glProgramLocalParameterI4ivNV,
+  (_GLEWProc)_glewProfile_glProgramLocalParameterI4uiNV,
+  (_GLEWProc)_glewProfile_glProgramLocalParameterI4uivNV,
+  (_GLEWProc)_glewProfile_glProgramLocalParametersI4ivNV,
+  (_GLEWProc)_glewProfile_glProgramLocalParametersI4uivNV,
+  (_GLEWProc)_glewProfile_glGetUniformi64vNV,
+  (_GLEWProc)_glewProfile_glGetUniformui64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform1i64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform1i64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform1ui64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform1ui64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform2i64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform2i64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform2ui64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform2ui64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform3i64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform3i64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform3ui64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform3ui64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform4i64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform4i64vNV,
+  (_GLEWProc)_glewProfile_glProgramUniform4ui64NV,
+  (_GLEWProc)_glewProfile_glProgramUniform4ui64vNV,
+  (_GLEWProc)_glewProfile_glUniform1i64NV,
+  (_GLEWProc)_glewProfile_glUniform1i64vNV,
+  (_GLEWProc)_glewProfile_glUniform1ui64NV,
+  (_GLEWProc)_glewProfile_glUniform1ui64vNV,
+  (_GLEWProc)_glewProfile_glUniform2i64NV,
+  (_GLEWProc)_glewProfile_glUniform2i64vNV,
+  (_GLEWProc)_glewProfile_glUniform2ui64NV,
+  (_GLEWProc)_glewProfile_glUniform2ui64vNV,
+  (_GLEWProc)_glewProfile_glUniform3i64NV,
+  (_GLEWProc)_glewProfile_glUniform3i64vNV,
+  (_GLEWProc)_glewProfile_glUniform3ui64NV,
+  (_GLEWProc)_glewProfile_glUniform3ui64vNV,
+  (_GLEWProc)_glewProfile_glUniform4i64NV,
+  (_GLEWProc)_glewProfile_glUniform4i64vNV,
+  (_GLEWProc)_glewProfile_glUniform4ui64NV,
+  (_GLEWProc)_glewProfile_glUniform4ui64vNV,
+  (_GLEWProc)_glewProfile_glColor3hNV,
+  (_GLEWProc)_glewProfile_glColor3hvNV,
+  (_GLEWProc)_glewProfile_glColor4hNV,
+  (_GLEWProc)_glewProfile_glColor4hvNV,
+  (_GLEWProc)_glewProfile_glFogCoordhNV,
+  (_GLEWProc)_glewProfile_glFogCoordhvNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1hNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord1hvNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2hNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord2hvNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3hNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord3hvNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4hNV,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4hvNV,
+  (_GLEWProc)_glewProfile_glNormal3hNV,
+  (_GLEWProc)_glewProfile_glNormal3hvNV,
+  (_GLEWProc)_glewProfile_glSecondaryColor3hNV,
+  (_GLEWProc)_glewProfile_glSecondaryColor3hvNV,
+  (_GLEWProc)_glewProfile_glTexCoord1hNV,
+  (_GLEWProc)_glewProfile_glTexCoord1hvNV,
+  (_GLEWProc)_glewProfile_glTexCoord2hNV,
+  (_GLEWProc)_glewProfile_glTexCoord2hvNV,
+  (_GLEWProc)_glewProfile_glTexCoord3hNV,
+  (_GLEWProc)_glewProfile_glTexCoord3hvNV,
+  (_GLEWProc)_glewProfile_glTexCoord4hNV,
+  (_GLEWProc)_glewProfile_glTexCoord4hvNV,
+  (_GLEWProc)_glewProfile_glVertex2hNV,
+  (_GLEWProc)_glewProfile_glVertex2hvNV,
+  (_GLEWProc)_glewProfile_glVertex3hNV,
+  (_GLEWProc)_glewProfile_glVertex3hvNV,
+  (_GLEWProc)_glewProfile_glVertex4hNV,
+  (_GLEWProc)_glewProfile_glVertex4hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1hNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2hNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3hNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4hNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs1hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs2hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs3hvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs4hvNV,
+  (_GLEWProc)_glewProfile_glVertexWeighthNV,
+  (_GLEWProc)_glewProfile_glVertexWeighthvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribDivisorNV,
+  (_GLEWProc)_glewProfile_glGetInternalformatSampleivNV,
+  (_GLEWProc)_glewProfile_glBufferAttachMemoryNV,
+  (_GLEWProc)_glewProfile_glGetMemoryObjectDetachedResourcesuivNV,
+  (_GLEWProc)_glewProfile_glNamedBufferAttachMemoryNV,
+  (_GLEWProc)_glewProfile_glResetMemoryObjectParameterNV,
+  (_GLEWProc)_glewProfile_glTexAttachMemoryNV,
+  (_GLEWProc)_glewProfile_glTextureAttachMemoryNV,
+  (_GLEWProc)_glewProfile_glDrawMeshTasksIndirectNV,
+  (_GLEWProc)_glewProfile_glDrawMeshTasksNV,
+  (_GLEWProc)_glewProfile_glMultiDrawMeshTasksIndirectCountNV,
+  (_GLEWProc)_glewProfile_glMultiDrawMeshTasksIndirectNV,
+  (_GLEWProc)_glewProfile_glUniformMatrix2x3fvNV,
+  (_GLEWProc)_glewProfile_glUniformMatrix2x4fvNV,
+  (_GLEWProc)_glewProfile_glUniformMatrix3x2fvNV,
+  (_GLEWProc)_glewProfile_glUniformMatrix3x4fvNV,
+  (_GLEWProc)_glewProfile_glUniformMatrix4x2fvNV,
+  (_GLEWProc)_glewProfile_glUniformMatrix4x3fvNV,
+  (_GLEWProc)_glewProfile_glBeginOcclusionQueryNV,
+  (_GLEWProc)_glewProfile_glDeleteOcclusionQueriesNV,
+  (_GLEWProc)_glewProfile_glEndOcclusionQueryNV,
+  (_GLEWProc)_glewProfile_glGenOcclusionQueriesNV,
+  (_GLEWProc)_glewProfile_glGetOcclusionQueryivNV,
+  (_GLEWProc)_glewProfile_glGetOcclusionQueryuivNV,
+  (_GLEWProc)_glewProfile_glIsOcclusionQueryNV,
+  (_GLEWProc)_glewProfile_glProgramBufferParametersIivNV,
+  (_GLEWProc)_glewProfile_glProgramBufferParametersIuivNV,
+  (_GLEWProc)_glewProfile_glProgramBufferParametersfvNV,
+  (_GLEWProc)_glewProfile_glCopyPathNV,
+  (_GLEWProc)_glewProfile_glCoverFillPathInstancedNV,
+  (_GLEWProc)_glewProfile_glCoverFillPathNV,
+  (_GLEWProc)_glewProfile_glCoverStrokePathInstancedNV,
+  (_GLEWProc)_glewProfile_glCoverStrokePathNV,
+  (_GLEWProc)_glewProfile_glDeletePathsNV,
+  (_GLEWProc)_glewProfile_glGenPathsNV,
+  (_GLEWProc)_glewProfile_glGetPathColorGenfvNV,
+  (_GLEWProc)_glewProfile_glGetPathColorGenivNV,
+  (_GLEWProc)_glewProfile_glGetPathCommandsNV,
+  (_GLEWProc)_glewProfile_glGetPathCoordsNV,
+  (_GLEWProc)_glewProfile_glGetPathDashArrayNV,
+  (_GLEWProc)_glewProfile_glGetPathLengthNV,
+  (_GLEWProc)_glewProfile_glGetPathMetricRangeNV,
+  (_GLEWProc)_glewProfile_glGetPathMetricsNV,
+  (_GLEWProc)_glewProfile_glGetPathParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetPathParameterivNV,
+  (_GLEWProc)_glewProfile_glGetPathSpacingNV,
+  (_GLEWProc)_glewProfile_glGetPathTexGenfvNV,
+  (_GLEWProc)_glewProfile_glGetPathTexGenivNV,
+  (_GLEWProc)_glewProfile_glGetProgramResourcefvNV,
+  (_GLEWProc)_glewProfile_glInterpolatePathsNV,
+  (_GLEWProc)_glewProfile_glIsPathNV,
+  (_GLEWProc)_glewProfile_glIsPointInFillPathNV,
+  (_GLEWProc)_glewProfile_glIsPointInStrokePathNV,
+  (_GLEWProc)_glewProfile_glMatrixLoad3x2fNV,
+  (_GLEWProc)_glewProfile_glMatrixLoad3x3fNV,
+  (_GLEWProc)_glewProfile_glMatrixLoadTranspose3x3fNV,
+  (_GLEWProc)_glewProfile_glMatrixMult3x2fNV,
+  (_GLEWProc)_glewProfile_glMatrixMult3x3fNV,
+  (_GLEWProc)_glewProfile_glMatrixMultTranspose3x3fNV,
+  (_GLEWProc)_glewProfile_glPathColorGenNV,
+  (_GLEWProc)_glewProfile_glPathCommandsNV,
+  (_GLEWProc)_glewProfile_glPathCoordsNV,
+  (_GLEWProc)_glewProfile_glPathCoverDepthFuncNV,
+  (_GLEWProc)_glewProfile_glPathDashArrayNV,
+  (_GLEWProc)_glewProfile_glPathFogGenNV,
+  (_GLEWProc)_glewProfile_glPathGlyphIndexArrayNV,
+  (_GLEWProc)_glewProfile_glPathGlyphIndexRangeNV,
+  (_GLEWProc)_glewProfile_glPathGlyphRangeNV,
+  (_GLEWProc)_glewProfile_glPathGlyphsNV,
+  (_GLEWProc)_glewProfile_glPathMemoryGlyphIndexArrayNV,
+  (_GLEWProc)_glewProfile_glPathParameterfNV,
+  (_GLEWProc)_glewProfile_glPathParameterfvNV,
+  (_GLEWProc)_glewProfile_glPathParameteriNV,
+  (_GLEWProc)_glewProfile_glPathParameterivNV,
+  (_GLEWProc)_glewProfile_glPathStencilDepthOffsetNV,
+  (_GLEWProc)_glewProfile_glPathStencilFuncNV,
+  (_GLEWProc)_glewProfile_glPathStringNV,
+  (_GLEWProc)_glewProfile_glPathSubCommandsNV,
+  (_GLEWProc)_glewProfile_glPathSubCoordsNV,
+  (_GLEWProc)_glewProfile_glPathTexGenNV,
+  (_GLEWProc)_glewProfile_glPointAlongPathNV,
+  (_GLEWProc)_glewProfile_glProgramPathFragmentInputGenNV,
+  (_GLEWProc)_glewProfile_glStencilFillPathInstancedNV,
+  (_GLEWProc)_glewProfile_glStencilFillPathNV,
+  (_GLEWProc)_glewProfile_glStencilStrokePathInstancedNV,
+  (_GLEWProc)_glewProfile_glStencilStrokePathNV,
+  (_GLEWProc)_glewProfile_glStencilThenCoverFillPathInstancedNV,
+  (_GLEWProc)_glewProfile_glStencilThenCoverFillPathNV,
+  (_GLEWProc)_glewProfile_glStencilThenCoverStrokePathInstancedNV,
+  (_GLEWProc)_glewProfile_glStencilThenCoverStrokePathNV,
+  (_GLEWProc)_glewProfile_glTransformPathNV,
+  (_GLEWProc)_glewProfile_glWeightPathsNV,
+  (_GLEWProc)_glewProfile_glFlushPixelDataRangeNV,
+  (_GLEWProc)_glewProfile_glPixelDataRangeNV,
+  (_GLEWProc)_glewProfile_glPointParameteriNV,
+  (_GLEWProc)_glewProfile_glPointParameterivNV,
+  (_GLEWProc)_glewProfile_glPolygonModeNV,
+  (_GLEWProc)_glewProfile_glGetVideoi64vNV,
+  (_GLEWProc)_glewProfile_glGetVideoivNV,
+  (_GLEWProc)_glewProfile_glGetVideoui64vNV,
+  (_GLEWProc)_glewProfile_glGetVideouivNV,
+  (_GLEWProc)_glewProfile_glPresentFrameDualFillNV,
+  (_GLEWProc)_glewProfile_glPresentFrameKeyedNV,
+  (_GLEWProc)_glewProfile_glPrimitiveRestartIndexNV,
+  (_GLEWProc)_glewProfile_glPrimitiveRestartNV,
+  (_GLEWProc)_glewProfile_glReadBufferNV,
+  (_GLEWProc)_glewProfile_glCombinerInputNV,
+  (_GLEWProc)_glewProfile_glCombinerOutputNV,
+  (_GLEWProc)_glewProfile_glCombinerParameterfNV,
+  (_GLEWProc)_glewProfile_glCombinerParameterfvNV,
+  (_GLEWProc)_glewProfile_glCombinerParameteriNV,
+  (_GLEWProc)_glewProfile_glCombinerParameterivNV,
+  (_GLEWProc)_glewProfile_glFinalCombinerInputNV,
+  (_GLEWProc)_glewProfile_glGetCombinerInputParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetCombinerInputParameterivNV,
+  (_GLEWProc)_glewProfile_glGetCombinerOutputParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetCombinerOutputParameterivNV,
+  (_GLEWProc)_glewProfile_glGetFinalCombinerInputParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetFinalCombinerInputParameterivNV,
+  (_GLEWProc)_glewProfile_glCombinerStageParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetCombinerStageParameterfvNV,
+  (_GLEWProc)_glewProfile_glFramebufferSampleLocationsfvNV,
+  (_GLEWProc)_glewProfile_glNamedFramebufferSampleLocationsfvNV,
+  (_GLEWProc)_glewProfile_glResolveDepthValuesNV,
+  (_GLEWProc)_glewProfile_glScissorExclusiveArrayvNV,
+  (_GLEWProc)_glewProfile_glScissorExclusiveNV,
+  (_GLEWProc)_glewProfile_glGetBufferParameterui64vNV,
+  (_GLEWProc)_glewProfile_glGetIntegerui64vNV,
+  (_GLEWProc)_glewProfile_glGetNamedBufferParameterui64vNV,
+  (_GLEWProc)_glewProfile_glIsBufferResidentNV,
+  (_GLEWProc)_glewProfile_glIsNamedBufferResidentNV,
+  (_GLEWProc)_glewProfile_glMakeBufferNonResidentNV,
+  (_GLEWProc)_glewProfile_glMakeBufferResidentNV,
+  (_GLEWProc)_glewProfile_glMakeNamedBufferNonResidentNV,
+  (_GLEWProc)_glewProfile_glMakeNamedBufferResidentNV,
+  (_GLEWProc)_glewProfile_glProgramUniformui64NV,
+  (_GLEWProc)_glewProfile_glProgramUniformui64vNV,
+  (_GLEWProc)_glewProfile_glUniformui64NV,
+  (_GLEWProc)_glewProfile_glUniformui64vNV,
+  (_GLEWProc)_glewProfile_glBindShadingRateImageNV,
+  (_GLEWProc)_glewProfile_glGetShadingRateImagePaletteNV,
+  (_GLEWProc)_glewProfile_glGetShadingRateSampleLocationivNV,
+  (_GLEWProc)_glewProfile_glShadingRateImageBarrierNV,
+  (_GLEWProc)_glewProfile_glShadingRateImagePaletteNV,
+  (_GLEWProc)_glewProfile_glShadingRateSampleOrderCustomNV,
+  (_GLEWProc)_glewProfile_glCompressedTexImage3DNV,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage3DNV,
+  (_GLEWProc)_glewProfile_glCopyTexSubImage3DNV,
+  (_GLEWProc)_glewProfile_glFramebufferTextureLayerNV,
+  (_GLEWProc)_glewProfile_glTexImage3DNV,
+  (_GLEWProc)_glewProfile_glTexSubImage3DNV,
+  (_GLEWProc)_glewProfile_glTextureBarrierNV,
+  (_GLEWProc)_glewProfile_glTexImage2DMultisampleCoverageNV,
+  (_GLEWProc)_glewProfile_glTexImage3DMultisampleCoverageNV,
+  (_GLEWProc)_glewProfile_glTextureImage2DMultisampleCoverageNV,
+  (_GLEWProc)_glewProfile_glTextureImage2DMultisampleNV,
+  (_GLEWProc)_glewProfile_glTextureImage3DMultisampleCoverageNV,
+  (_GLEWProc)_glewProfile_glTextureImage3DMultisampleNV,
+  (_GLEWProc)_glewProfile_glActiveVaryingNV,
+  (_GLEWProc)_glewProfile_glBeginTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glBindBufferBaseNV,
+  (_GLEWProc)_glewProfile_glBindBufferOffsetNV,
+  (_GLEWProc)_glewProfile_glBindBufferRangeNV,
+  (_GLEWProc)_glewProfile_glEndTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glGetActiveVaryingNV,
+  (_GLEWProc)_glewProfile_glGetTransformFeedbackVaryingNV,
+  (_GLEWProc)_glewProfile_glGetVaryingLocationNV,
+  (_GLEWProc)_glewProfile_glTransformFeedbackAttribsNV,
+  (_GLEWProc)_glewProfile_glTransformFeedbackVaryingsNV,
+  (_GLEWProc)_glewProfile_glBindTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glDeleteTransformFeedbacksNV,
+  (_GLEWProc)_glewProfile_glDrawTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glGenTransformFeedbacksNV,
+  (_GLEWProc)_glewProfile_glIsTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glPauseTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glResumeTransformFeedbackNV,
+  (_GLEWProc)_glewProfile_glVDPAUFiniNV,
+  (_GLEWProc)_glewProfile_glVDPAUGetSurfaceivNV,
+  (_GLEWProc)_glewProfile_glVDPAUInitNV,
+  (_GLEWProc)_glewProfile_glVDPAUIsSurfaceNV,
+  (_GLEWProc)_glewProfile_glVDPAUMapSurfacesNV,
+  (_GLEWProc)_glewProfile_glVDPAURegisterOutputSurfaceNV,
+  (_GLEWProc)_glewProfile_glVDPAURegisterVideoSurfaceNV,
+  (_GLEWProc)_glewProfile_glVDPAUSurfaceAccessNV,
+  (_GLEWProc)_glewProfile_glVDPAUUnmapSurfacesNV,
+  (_GLEWProc)_glewProfile_glVDPAUUnregisterSurfaceNV,
+  (_GLEWProc)_glewProfile_glVDPAURegisterVideoSurfaceWithPictureStructureNV,
+  (_GLEWProc)_glewProfile_glFlushVertexArrayRangeNV,
+  (_GLEWProc)_glewProfile_glVertexArrayRangeNV,
+  (_GLEWProc)_glewProfile_glGetVertexAttribLi64vNV,
+  (_GLEWProc)_glewProfile_glGetVertexAttribLui64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL1i64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL1i64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL1ui64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL1ui64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL2i64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL2i64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL2ui64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL2ui64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL3i64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL3i64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL3ui64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL3ui64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL4i64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL4i64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribL4ui64NV,
+  (_GLEWProc)_glewProfile_glVertexAttribL4ui64vNV,
+  (_GLEWProc)_glewProfile_glVertexAttribLFormatNV,
+  (_GLEWProc)_glewProfile_glBufferAddressRangeNV,
+  (_GLEWProc)_glewProfile_glColorFormatNV,
+  (_GLEWProc)_glewProfile_glEdgeFlagFormatNV,
+  (_GLEWProc)_glewProfile_glFogCoordFormatNV,
+  (_GLEWProc)_glewProfile_glGetIntegerui64i_vNV,
+  (_GLEWProc)_glewProfile_glIndexFormatNV,
+  (_GLEWProc)_glewProfile_glNormalFormatNV,
+  (_GLEWProc)_glewProfile_glSecondaryColorFormatNV,
+  (_GLEWProc)_glewProfile_glTexCoordFormatNV,
+  (_GLEWProc)_glewProfile_glVertexAttribFormatNV,
+  (_GLEWProc)_glewProfile_glVertexAttribIFormatNV,
+  (_GLEWProc)_glewProfile_glVertexFormatNV,
+  (_GLEWProc)_glewProfile_glAreProgramsResidentNV,
+  (_GLEWProc)_glewProfile_glBindProgramNV,
+  (_GLEWProc)_glewProfile_glDeleteProgramsNV,
+  (_GLEWProc)_glewProfile_glExecuteProgramNV,
+  (_GLEWProc)_glewProfile_glGenProgramsNV,
+  (_GLEWProc)_glewProfile_glGetProgramParameterdvNV,
+  (_GLEWProc)_glewProfile_glGetProgramParameterfvNV,
+  (_GLEWProc)_glewProfile_glGetProgramStringNV,
+  (_GLEWProc)_glewProfile_glGetProgramivNV,
+  (_GLEWProc)_glewProfile_glGetTrackMatrixivNV,
+  (_GLEWProc)_glewProfile_glGetVertexAttribPointervNV,
+  (_GLEWProc)_glewProfile_glGetVertexAttribdvNV,
+  (_GLEWProc)_glewProfile_glGetVertexAttribfvNV,
+  (_GLEWProc)_glewProfile_glGetVertexAttribivNV,
+  (_GLEWProc)_glewProfile_glIsProgramNV,
+  (_GLEWProc)_glewProfile_glLoadProgramNV,
+  (_GLEWProc)_glewProfile_glProgramParameter4dNV,
+  (_GLEWProc)_glewProfile_glProgramParameter4dvNV,
+  (_GLEWProc)_glewProfile_glProgramParameter4fNV,
+  (_GLEWProc)_glewProfile_glProgramParameter4fvNV,
+  (_GLEWProc)_glewProfile_glProgramParameters4dvNV,
+  (_GLEWProc)_glewProfile_glProgramParameters4fvNV,
+  (_GLEWProc)_glewProfile_glRequestResidentProgramsNV,
+  (_GLEWProc)_glewProfile_glTrackMatrixNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1dNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1fNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1sNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib1svNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2dNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2fNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2sNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib2svNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3dNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3fNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3sNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib3svNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4dNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4fNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4sNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4svNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4ubNV,
+  (_GLEWProc)_glewProfile_glVertexAttrib4ubvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribPointerNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs1dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs1fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs1svNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs2dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs2fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs2svNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs3dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs3fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs3svNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs4dvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs4fvNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs4svNV,
+  (_GLEWProc)_glewProfile_glVertexAttribs4ubvNV,
+  (_GLEWProc)_glewProfile_glBeginVideoCaptureNV,
+  (_GLEWProc)_glewProfile_glBindVideoCaptureStreamBufferNV,
+  (_GLEWProc)_glewProfile_glBindVideoCaptureStreamTextureNV,
+  (_GLEWProc)_glewProfile_glEndVideoCaptureNV,
+  (_GLEWProc)_glewProfile_glGetVideoCaptureStreamdvNV,
+  (_GLEWProc)_glewProfile_glGetVideoCaptureStreamfvNV,
+  (_GLEWProc)_glewProfile_glGetVideoCaptureStreamivNV,
+  (_GLEWProc)_glewProfile_glGetVideoCaptureivNV,
+  (_GLEWProc)_glewProfile_glVideoCaptureNV,
+  (_GLEWProc)_glewProfile_glVideoCaptureStreamParameterdvNV,
+  (_GLEWProc)_glewProfile_glVideoCaptureStreamParameterfvNV,
+  (_GLEWProc)_glewProfile_glVideoCaptureStreamParameterivNV,
+  (_GLEWProc)_glewProfile_glDepthRangeArrayfvNV,
+  (_GLEWProc)_glewProfile_glDepthRangeIndexedfNV,
+  (_GLEWProc)_glewProfile_glDisableiNV,
+  (_GLEWProc)_glewProfile_glEnableiNV,
+  (_GLEWProc)_glewProfile_glGetFloati_vNV,
+  (_GLEWProc)_glewProfile_glIsEnablediNV,
+  (_GLEWProc)_glewProfile_glScissorArrayvNV,
+  (_GLEWProc)_glewProfile_glScissorIndexedNV,
+  (_GLEWProc)_glewProfile_glScissorIndexedvNV,
+  (_GLEWProc)_glewProfile_glViewportArrayvNV,
+  (_GLEWProc)_glewProfile_glViewportIndexedfNV,
+  (_GLEWProc)_glewProfile_glViewportIndexedfvNV,
+  (_GLEWProc)_glewProfile_glViewportSwizzleNV,
+  (_GLEWProc)_glewProfile_glEGLImageTargetRenderbufferStorageOES,
+  (_GLEWProc)_glewProfile_glEGLImageTargetTexture2DOES,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparateOES,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparateOES,
+  (_GLEWProc)_glewProfile_glBlendEquationOES,
+  (_GLEWProc)_glewProfile_glCopyImageSubDataOES,
+  (_GLEWProc)_glewProfile_glBlendEquationSeparateiOES,
+  (_GLEWProc)_glewProfile_glBlendEquationiOES,
+  (_GLEWProc)_glewProfile_glBlendFuncSeparateiOES,
+  (_GLEWProc)_glewProfile_glBlendFunciOES,
+  (_GLEWProc)_glewProfile_glColorMaskiOES,
+  (_GLEWProc)_glewProfile_glDisableiOES,
+  (_GLEWProc)_glewProfile_glEnableiOES,
+  (_GLEWProc)_glewProfile_glIsEnablediOES,
+  (_GLEWProc)_glewProfile_glBindFramebufferOES,
+  (_GLEWProc)_glewProfile_glBindRenderbufferOES,
+  (_GLEWProc)_glewProfile_glCheckFramebufferStatusOES,
+  (_GLEWProc)_glewProfile_glDeleteFramebuffersOES,
+  (_GLEWProc)_glewProfile_glDeleteRenderbuffersOES,
+  (_GLEWProc)_glewProfile_glFramebufferRenderbufferOES,
+  (_GLEWProc)_glewProfile_glFramebufferTexture2DOES,
+  (_GLEWProc)_glewProfile_glGenFramebuffersOES,
+  (_GLEWProc)_glewProfile_glGenRenderbuffersOES,
+  (_GLEWProc)_glewProfile_glGenerateMipmapOES,
+  (_GLEWProc)_glewProfile_glGetFramebufferAttachmentParameterivOES,
+  (_GLEWProc)_glewProfile_glGetRenderbufferParameterivOES,
+  (_GLEWProc)_glewProfile_glIsFramebufferOES,
+  (_GLEWProc)_glewProfile_glIsRenderbufferOES,
+  (_GLEWProc)_glewProfile_glRenderbufferStorageOES,
+  (_GLEWProc)_glewProfile_glGetProgramBinaryOES,
+  (_GLEWProc)_glewProfile_glProgramBinaryOES,
+  (_GLEWProc)_glewProfile_glGetBufferPointervOES,
+  (_GLEWProc)_glewProfile_glMapBufferOES,
+  (_GLEWProc)_glewProfile_glUnmapBufferOES,
+  (_GLEWProc)_glewProfile_glCurrentPaletteMatrixOES,
+  (_GLEWProc)_glewProfile_glMatrixIndexPointerOES,
+  (_GLEWProc)_glewProfile_glWeightPointerOES,
+  (_GLEWProc)_glewProfile_glMinSampleShadingOES,
+  (_GLEWProc)_glewProfile_glClearDepthfOES,
+  (_GLEWProc)_glewProfile_glClipPlanefOES,
+  (_GLEWProc)_glewProfile_glDepthRangefOES,
+  (_GLEWProc)_glewProfile_glFrustumfOES,
+  (_GLEWProc)_glewProfile_glGetClipPlanefOES,
+  (_GLEWProc)_glewProfile_glOrthofOES,
+  (_GLEWProc)_glewProfile_glCompressedTexImage3DOES,
+  (_GLEWProc)_glewProfile_glCompressedTexSubImage3DOES,
+  (_GLEWProc)_glewProfile_glCopyTexSubImage3DOES,
+  (_GLEWProc)_glewProfile_glFramebufferTexture3DOES,
+  (_GLEWProc)_glewProfile_glTexImage3DOES,
+  (_GLEWProc)_glewProfile_glTexSubImage3DOES,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterIivOES,
+  (_GLEWProc)_glewProfile_glGetSamplerParameterIuivOES,
+  (_GLEWProc)_glewProfile_glGetTexParameterIivOES,
+  (_GLEWProc)_glewProfile_glGetTexParameterIuivOES,
+  (_GLEWProc)_glewProfile_glSamplerParameterIivOES,
+  (_GLEWProc)_glewProfile_glSamplerParameterIuivOES,
+  (_GLEWProc)_glewProfile_glTexParameterIivOES,
+  (_GLEWProc)_glewProfile_glTexParameterIuivOES,
+  (_GLEWProc)_glewProfile_glTexBufferOES,
+  (_GLEWProc)_glewProfile_glTexBufferRangeOES,
+  (_GLEWProc)_glewProfile_glGetTexGenfvOES,
+  (_GLEWProc)_glewProfile_glGetTexGenivOES,
+  (_GLEWProc)_glewProfile_glGetTexGenxvOES,
+  (_GLEWProc)_glewProfile_glTexGenfOES,
+  (_GLEWProc)_glewProfile_glTexGenfvOES,
+  (_GLEWProc)_glewProfile_glTexGeniOES,
+  (_GLEWProc)_glewProfile_glTexGenivOES,
+  (_GLEWProc)_glewProfile_glTexGenxOES,
+  (_GLEWProc)_glewProfile_glTexGenxvOES,
+  (_GLEWProc)_glewProfile_glTexStorage3DMultisampleOES,
+  (_GLEWProc)_glewProfile_glTextureViewOES,
+  (_GLEWProc)_glewProfile_glBindVertexArrayOES,
+  (_GLEWProc)_glewProfile_glDeleteVertexArraysOES,
+  (_GLEWProc)_glewProfile_glGenVertexArraysOES,
+  (_GLEWProc)_glewProfile_glIsVertexArrayOES,
+  (_GLEWProc)_glewProfile_glFramebufferTextureMultiviewOVR,
+  (_GLEWProc)_glewProfile_glNamedFramebufferTextureMultiviewOVR,
+  (_GLEWProc)_glewProfile_glFramebufferTextureMultisampleMultiviewOVR,
+  (_GLEWProc)_glewProfile_glAlphaFuncQCOM,
+  (_GLEWProc)_glewProfile_glDisableDriverControlQCOM,
+  (_GLEWProc)_glewProfile_glEnableDriverControlQCOM,
+  (_GLEWProc)_glewProfile_glGetDriverControlStringQCOM,
+  (_GLEWProc)_glewProfile_glGetDriverControlsQCOM,
+  (_GLEWProc)_glewProfile_glExtGetBufferPointervQCOM,
+  (_GLEWProc)_glewProfile_glExtGetBuffersQCOM,
+  (_GLEWProc)_glewProfile_glExtGetFramebuffersQCOM,
+  (_GLEWProc)_glewProfile_glExtGetRenderbuffersQCOM,
+  (_GLEWProc)_glewProfile_glExtGetTexLevelParameterivQCOM,
+  (_GLEWProc)_glewProfile_glExtGetTexSubImageQCOM,
+  (_GLEWProc)_glewProfile_glExtGetTexturesQCOM,
+  (_GLEWProc)_glewProfile_glExtTexObjectStateOverrideiQCOM,
+  (_GLEWProc)_glewProfile_glExtGetProgramBinarySourceQCOM,
+  (_GLEWProc)_glewProfile_glExtGetProgramsQCOM,
+  (_GLEWProc)_glewProfile_glExtGetShadersQCOM,
+  (_GLEWProc)_glewProfile_glExtIsProgramBinaryQCOM,
+  (_GLEWProc)_glewProfile_glFramebufferFoveationConfigQCOM,
+  (_GLEWProc)_glewProfile_glFramebufferFoveationParametersQCOM,
+  (_GLEWProc)_glewProfile_glFramebufferFetchBarrierQCOM,
+  (_GLEWProc)_glewProfile_glTextureFoveationParametersQCOM,
+  (_GLEWProc)_glewProfile_glEndTilingQCOM,
+  (_GLEWProc)_glewProfile_glStartTilingQCOM,
+  (_GLEWProc)_glewProfile_glAlphaFuncx,
+  (_GLEWProc)_glewProfile_glClearColorx,
+  (_GLEWProc)_glewProfile_glClearDepthx,
+  (_GLEWProc)_glewProfile_glColor4x,
+  (_GLEWProc)_glewProfile_glDepthRangex,
+  (_GLEWProc)_glewProfile_glFogx,
+  (_GLEWProc)_glewProfile_glFogxv,
+  (_GLEWProc)_glewProfile_glFrustumf,
+  (_GLEWProc)_glewProfile_glFrustumx,
+  (_GLEWProc)_glewProfile_glLightModelx,
+  (_GLEWProc)_glewProfile_glLightModelxv,
+  (_GLEWProc)_glewProfile_glLightx,
+  (_GLEWProc)_glewProfile_glLightxv,
+  (_GLEWProc)_glewProfile_glLineWidthx,
+  (_GLEWProc)_glewProfile_glLoadMatrixx,
+  (_GLEWProc)_glewProfile_glMaterialx,
+  (_GLEWProc)_glewProfile_glMaterialxv,
+  (_GLEWProc)_glewProfile_glMultMatrixx,
+  (_GLEWProc)_glewProfile_glMultiTexCoord4x,
+  (_GLEWProc)_glewProfile_glNormal3x,
+  (_GLEWProc)_glewProfile_glOrthof,
+  (_GLEWProc)_glewProfile_glOrthox,
+  (_GLEWProc)_glewProfile_glPointSizex,
+  (_GLEWProc)_glewProfile_glPolygonOffsetx,
+  (_GLEWProc)_glewProfile_glRotatex,
+  (_GLEWProc)_glewProfile_glSampleCoveragex,
+  (_GLEWProc)_glewProfile_glScalex,
+  (_GLEWProc)_glewProfile_glTexEnvx,
+  (_GLEWProc)_glewProfile_glTexEnvxv,
+  (_GLEWProc)_glewProfile_glTexParameterx,
+  (_GLEWProc)_glewProfile_glTranslatex,
+  (_GLEWProc)_glewProfile_glClipPlanef,
+  (_GLEWProc)_glewProfile_glClipPlanex,
+  (_GLEWProc)_glewProfile_glGetClipPlanef,
+  (_GLEWProc)_glewProfile_glGetClipPlanex,
+  (_GLEWProc)_glewProfile_glGetFixedv,
+  (_GLEWProc)_glewProfile_glGetLightxv,
+  (_GLEWProc)_glewProfile_glGetMaterialxv,
+  (_GLEWProc)_glewProfile_glGetTexEnvxv,
+  (_GLEWProc)_glewProfile_glGetTexParameterxv,
+  (_GLEWProc)_glewProfile_glPointParameterx,
+  (_GLEWProc)_glewProfile_glPointParameterxv,
+  (_GLEWProc)_glewProfile_glPointSizePointerOES,
+  (_GLEWProc)_glewProfile_glTexParameterxv,
+  (_GLEWProc)_glewProfile_glErrorStringREGAL,
+  (_GLEWProc)_glewProfile_glGetExtensionREGAL,
+  (_GLEWProc)_glewProfile_glIsSupportedREGAL,
+  (_GLEWProc)_glewProfile_glLogMessageCallbackREGAL,
+  (_GLEWProc)_glewProfile_glGetProcAddressREGAL,
+  (_GLEWProc)_glewProfile_glDetailTexFuncSGIS,
+  (_GLEWProc)_glewProfile_glGetDetailTexFuncSGIS,
+  (_GLEWProc)_glewProfile_glFogFuncSGIS,
+  (_GLEWProc)_glewProfile_glGetFogFuncSGIS,
+  (_GLEWProc)_glewProfile_glSampleMaskSGIS,
+  (_GLEWProc)_glewProfile_glSamplePatternSGIS,
+  (_GLEWProc)_glewProfile_glInterleavedTextureCoordSetsSGIS,
+  (_GLEWProc)_glewProfile_glSelectTextureCoordSetSGIS,
+  (_GLEWProc)_glewProfile_glSelectTextureSGIS,
+  (_GLEWProc)_glewProfile_glSelectTextureTransformSGIS,
+  (_GLEWProc)_glewProfile_glMultisampleSubRectPosSGIS,
+  (_GLEWProc)_glewProfile_glGetSharpenTexFuncSGIS,
+  (_GLEWProc)_glewProfile_glSharpenTexFuncSGIS,
+  (_GLEWProc)_glewProfile_glTexImage4DSGIS,
+  (_GLEWProc)_glewProfile_glTexSubImage4DSGIS,
+  (_GLEWProc)_glewProfile_glGetTexFilterFuncSGIS,
+  (_GLEWProc)_glewProfile_glTexFilterFuncSGIS,
+  (_GLEWProc)_glewProfile_glAsyncMarkerSGIX,
+  (_GLEWProc)_glewProfile_glDeleteAsyncMarkersSGIX,
+  (_GLEWProc)_glewProfile_glFinishAsyncSGIX,
+  (_GLEWProc)_glewProfile_glGenAsyncMarkersSGIX,
+  (_GLEWProc)_glewProfile_glIsAsyncMarkerSGIX,
+  (_GLEWProc)_glewProfile_glPollAsyncSGIX,
+  (_GLEWProc)_glewProfile_glAddressSpace,
+  (_GLEWProc)_glewProfile_glDataPipe,
+  (_GLEWProc)_glewProfile_glFlushRasterSGIX,
+  (_GLEWProc)_glewProfile_glFogLayersSGIX,
+  (_GLEWProc)_glewProfile_glGetFogLayersSGIX,
+  (_GLEWProc)_glewProfile_glTextureFogSGIX,
+  (_GLEWProc)_glewProfile_glFragmentColorMaterialSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightModelfSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightModelfvSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightModeliSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightModelivSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightfSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightfvSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightiSGIX,
+  (_GLEWProc)_glewProfile_glFragmentLightivSGIX,
+  (_GLEWProc)_glewProfile_glFragmentMaterialfSGIX,
+  (_GLEWProc)_glewProfile_glFragmentMaterialfvSGIX,
+  (_GLEWProc)_glewProfile_glFragmentMaterialiSGIX,
+  (_GLEWProc)_glewProfile_glFragmentMaterialivSGIX,
+  (_GLEWProc)_glewProfile_glGetFragmentLightfvSGIX,
+  (_GLEWProc)_glewProfile_glGetFragmentLightivSGIX,
+  (_GLEWProc)_glewProfile_glGetFragmentMaterialfvSGIX,
+  (_GLEWProc)_glewProfile_glGetFragmentMaterialivSGIX,
+  (_GLEWProc)_glewProfile_glFrameZoomSGIX,
+  (_GLEWProc)_glewProfile_glIglooInterfaceSGIX,
+  (_GLEWProc)_glewProfile_glAllocMPEGPredictorsSGIX,
+  (_GLEWProc)_glewProfile_glDeleteMPEGPredictorsSGIX,
+  (_GLEWProc)_glewProfile_glGenMPEGPredictorsSGIX,
+  (_GLEWProc)_glewProfile_glGetMPEGParameterfvSGIX,
+  (_GLEWProc)_glewProfile_glGetMPEGParameterivSGIX,
+  (_GLEWProc)_glewProfile_glGetMPEGPredictorSGIX,
+  (_GLEWProc)_glewProfile_glGetMPEGQuantTableubv,
+  (_GLEWProc)_glewProfile_glIsMPEGPredictorSGIX,
+  (_GLEWProc)_glewProfile_glMPEGPredictorSGIX,
+  (_GLEWProc)_glewProfile_glMPEGQuantTableubv,
+  (_GLEWProc)_glewProfile_glSwapMPEGPredictorsSGIX,
+  (_GLEWProc)_glewProfile_glGetNonlinLightfvSGIX,
+  (_GLEWProc)_glewProfile_glGetNonlinMaterialfvSGIX,
+  (_GLEWProc)_glewProfile_glNonlinLightfvSGIX,
+  (_GLEWProc)_glewProfile_glNonlinMaterialfvSGIX,
+  (_GLEWProc)_glewProfile_glPixelTexGenSGIX,
+  (_GLEWProc)_glewProfile_glDeformSGIX,
+  (_GLEWProc)_glewProfile_glLoadIdentityDeformationMapSGIX,
+  (_GLEWProc)_glewProfile_glMeshBreadthSGIX,
+  (_GLEWProc)_glewProfile_glMeshStrideSGIX,
+  (_GLEWProc)_glewProfile_glReferencePlaneSGIX,
+  (_GLEWProc)_glewProfile_glSpriteParameterfSGIX,
+  (_GLEWProc)_glewProfile_glSpriteParameterfvSGIX,
+  (_GLEWProc)_glewProfile_glSpriteParameteriSGIX,
+  (_GLEWProc)_glewProfile_glSpriteParameterivSGIX,
+  (_GLEWProc)_glewProfile_glTagSampleBufferSGIX,
+  (_GLEWProc)_glewProfile_glGetVectorOperationSGIX,
+  (_GLEWProc)_glewProfile_glVectorOperationSGIX,
+  (_GLEWProc)_glewProfile_glAreVertexArraysResidentSGIX,
+  (_GLEWProc)_glewProfile_glBindVertexArraySGIX,
+  (_GLEWProc)_glewProfile_glDeleteVertexArraysSGIX,
+  (_GLEWProc)_glewProfile_glGenVertexArraysSGIX,
+  (_GLEWProc)_glewProfile_glIsVertexArraySGIX,
+  (_GLEWProc)_glewProfile_glPrioritizeVertexArraysSGIX,
+  (_GLEWProc)_glewProfile_glColorTableParameterfvSGI,
+  (_GLEWProc)_glewProfile_glColorTableParameterivSGI,
+  (_GLEWProc)_glewProfile_glColorTableSGI,
+  (_GLEWProc)_glewProfile_glCopyColorTableSGI,
+  (_GLEWProc)_glewProfile_glGetColorTableParameterfvSGI,
+  (_GLEWProc)_glewProfile_glGetColorTableParameterivSGI,
+  (_GLEWProc)_glewProfile_glGetColorTableSGI,
+  (_GLEWProc)_glewProfile_glGetPixelTransformParameterfvSGI,
+  (_GLEWProc)_glewProfile_glGetPixelTransformParameterivSGI,
+  (_GLEWProc)_glewProfile_glPixelTransformParameterfSGI,
+  (_GLEWProc)_glewProfile_glPixelTransformParameterfvSGI,
+  (_GLEWProc)_glewProfile_glPixelTransformParameteriSGI,
+  (_GLEWProc)_glewProfile_glPixelTransformParameterivSGI,
+  (_GLEWProc)_glewProfile_glPixelTransformSGI,
+  (_GLEWProc)_glewProfile_glFinishTextureSUNX,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactorbSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactordSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactorfSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactoriSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactorsSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactorubSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactoruiSUN,
+  (_GLEWProc)_glewProfile_glGlobalAlphaFactorusSUN,
+  (_GLEWProc)_glewProfile_glReadVideoPixelsSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodePointerSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeubSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeubvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuivSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeusSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeusvSUN,
+  (_GLEWProc)_glewProfile_glColor3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glColor3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glColor4ubVertex2fSUN,
+  (_GLEWProc)_glewProfile_glColor4ubVertex2fvSUN,
+  (_GLEWProc)_glewProfile_glColor4ubVertex3fSUN,
+  (_GLEWProc)_glewProfile_glColor4ubVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiColor3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiColor3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiColor4ubVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiColor4ubVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiTexCoord2fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiTexCoord2fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiVertex3fSUN,
+  (_GLEWProc)_glewProfile_glReplacementCodeuiVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fColor3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fColor3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fColor4fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fColor4fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fColor4ubVertex3fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fColor4ubVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fNormal3fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fNormal3fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fVertex3fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord2fVertex3fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord4fColor4fNormal3fVertex4fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord4fColor4fNormal3fVertex4fvSUN,
+  (_GLEWProc)_glewProfile_glTexCoord4fVertex4fSUN,
+  (_GLEWProc)_glewProfile_glTexCoord4fVertex4fvSUN,
+  (_GLEWProc)_glewProfile_glAddSwapHintRectWIN,
+};
+
+static void _glewProfileInit_GL ()
+{
+  size_t i;
+  _glewProfileStart();
+  for (i = 0; i < 2754; ++i)
+  {
+    /* an entry point not resolved again keeps its shim and saved target */
+    if (*_glewFunctions[i] == NULL || *_glewFunctions[i] == _glewProfileFunctions[i]) continue;
+    _glewProfileTargets[i] = *_glewFunctions[i];
+    *_glewFunctions[i] = _glewProfileFunctions[i];
+  }
+}
+
@@ -53,8 +53,20 @@
 #include <GL/Regal.h>
 #endif
 
+#include "glewreport.h"
+
 static FILE* f;
 
+/*
+ * With -json or -diff the report is a JSON object holding a key per line,
+ * so that reports can be compared line by line: "GL_ARB_imaging" holds
+ * [GLEW_ARB_imaging, glewIsSupported, glewGetExtension] and
+ * "GL_ARB_imaging.glBlendEquation" whether the entry point is available.
+ */
+static GLboolean json = GL_FALSE;
+static const char* jsonExt = "";
+static const char* jsonBaseline = NULL;  /* -diff */
+
 /* Command-line parameters for GL context creation */
 
 struct createParams
@@ -88,6 +100,13 @@ void glewDestroyContext ();
 static GLboolean glewPrintExt (const char* name, GLboolean def1, GLboolean def2, GLboolean def3)
 {
   unsigned int i;
+  if (json)
+  {
+    fprintf(f, ",\n  \"%s\": [%s, %s, %s]", name,
+      def1 ? "true" : "false", def2 ? "true" : "false", def3 ? "true" : "false");
+    jsonExt = name;
+    return def1 || def2 || def3 || glewExperimental;
+  }
   fprintf(f, "\n%s:", name);
   for (i=0; i<62-strlen(name); i++) fprintf(f, " ");
   fprintf(f, "%s ", def1 ? "OK" : "MISSING");
@@ -99,19 +118,21 @@ static GLboolean glewPrintExt (const char* name, GLboolean def1, GLboolean def2,
     fprintf(f, "\n");
   for (i=0; i<strlen(name)+1; i++) fprintf(f, "-");
   fprintf(f, "\n");
-  fflush(f);
   return def1 || def2 || def3 || glewExperimental; /* Enable per-function info too? */
 }
 
 static void glewInfoFunc (GLboolean fi, const char* name, GLint undefined)
 {
   unsigned int i;
-  if (fi)
+  if (fi && json)
+  {
+    fprintf(f, ",\n  \"%s.%s\": %s", jsonExt, name, undefined ? "false" : "true");
+  }
+  else if (fi)
   {
     fprintf(f, "  %s:", name);
     for (i=0; i<60-strlen(name); i++) fprintf(f, " ");
     fprintf(f, "%s\n", undefined ? "MISSING" : "OK");
-    fflush(f);
   }
 }
 
@@ -18429,6 +18450,8 @@ static void eglewInfo ()
 int main (int argc, char** argv)
 {
   GLuint err;
+  int ret = 0;
+  const GLubyte *vendor, *renderer, *version;
   struct createParams params =
   {
 #if defined(GLEW_OSMESA)
@@ -18465,7 +18488,9 @@ int main (int argc, char** argv)
       "[-version <OpenGL version>] "
       "[-profile core|compatibility] "
       "[-flag debug|forward] "
-      "[-experimental]"
+      "[-experimental] "
+      "[-json] "
+      "[-diff <baseline.json>]"
       "\n");
     return 1;
   }
@@ -18495,38 +18520,76 @@ int main (int argc, char** argv)
   }
 #endif
 
+#if defined(GLEW_EGL)
+  vendor = getString(GL_VENDOR);
+  renderer = getString(GL_RENDERER);
+  version = getString(GL_VERSION);
+#else
+  vendor = glGetString(GL_VENDOR);
+  renderer = glGetString(GL_RENDERER);
+  version = glGetString(GL_VERSION);
+#endif
+
+  /* -diff writes the report to a temporary file to compare with the baseline */
+  if (jsonBaseline != NULL)
+  {
+#if defined(_MSC_VER) && (_MSC_VER >= 1400)
+    if (tmpfile_s(&f) != 0)
+      f = NULL;
+#else
+    f = tmpfile();
+#endif
+    if (f == NULL)
+    {
+      fprintf(stderr, "Error: could not create a temporary file\n");
+      glewDestroyContext();
+      return 1;
+    }
+  }
+  else
+  {
 #if defined(_WIN32)
 #if defined(_MSC_VER) && (_MSC_VER >= 1400)
-  if (fopen_s(&f, "glewinfo.txt", "w") != 0)
-    f = stdout;
+    if (fopen_s(&f, "glewinfo.txt", "w") != 0)
+      f = stdout;
 #else
-  f = fopen("glewinfo.txt", "w");
+    f = fopen("glewinfo.txt", "w");
 #endif
-  if (f == NULL) f = stdout;
+    if (f == NULL) f = stdout;
 #else
-  f = stdout;
+    f = stdout;
 #endif
-  fprintf(f, "---------------------------\n");
-  fprintf(f, "    GLEW Extension Info\n");
-  fprintf(f, "---------------------------\n\n");
-  fprintf(f, "GLEW version %s\n", glewGetString(GLEW_VERSION));
+  }
+  setvbuf(f, NULL, _IOFBF, 1 << 16);
+
+  if (json)
+  {
+    fprintf(f, "{\n  \"glew.version\": ");
+    glewReportString(f, (const char*)glewGetString(GLEW_VERSION));
+    fprintf(f, ",\n  \"gl.vendor\": ");
+    glewReportString(f, (const char*)vendor);
+    fprintf(f, ",\n  \"gl.renderer\": ");
+    glewReportString(f, (const char*)renderer);
+    fprintf(f, ",\n  \"gl.version\": ");
+    glewReportString(f, (const char*)version);
+  }
+  else
+  {
+    fprintf(f, "---------------------------\n");
+    fprintf(f, "    GLEW Extension Info\n");
+    fprintf(f, "---------------------------\n\n");
+    fprintf(f, "GLEW version %s\n", glewGetString(GLEW_VERSION));
 #if defined(GLEW_OSMESA)
 #elif defined(GLEW_EGL)
 #elif defined(_WIN32)
-  fprintf(f, "Reporting capabilities of pixelformat %d\n", params.pixelformat);
+    fprintf(f, "Reporting capabilities of pixelformat %d\n", params.pixelformat);
 #elif !defined(__APPLE__) || defined(GLEW_APPLE_GLX)
-  fprintf(f, "Reporting capabilities of display %s, visual 0x%x\n",
-    params.display == NULL ? getenv("DISPLAY") : params.display, params.visual);
-#endif
-#if defined(GLEW_EGL)
-  fprintf(f, "Running on a %s from %s\n",
-    getString(GL_RENDERER), getString(GL_VENDOR));
-  fprintf(f, "OpenGL version %s is supported\n", getString(GL_VERSION));
-#else
-  fprintf(f, "Running on a %s from %s\n",
-    glGetString(GL_RENDERER), glGetString(GL_VENDOR));
-  fprintf(f, "OpenGL version %s is supported\n", glGetString(GL_VERSION));
+    fprintf(f, "Reporting capabilities of display %s, visual 0x%x\n",
+      params.display == NULL ? getenv("DISPLAY") : params.display, params.visual);
 #endif
+    fprintf(f, "Running on a %s from %s\n", renderer, vendor);
+    fprintf(f, "OpenGL version %s is supported\n", version);
+  }
   glewInfo();
 #if defined(GLEW_OSMESA)
 #elif defined(GLEW_EGL)
@@ -18536,9 +18599,13 @@ int main (int argc, char** argv)
 #else
   glxewInfo();
 #endif
+  if (json)
+    fprintf(f, "\n}\n");
+  if (jsonBaseline != NULL)
+    ret = glewDiffReport(f, jsonBaseline, "glewinfo");
   if (f != stdout) fclose(f);
   glewDestroyContext();
-  return 0;
+  return ret;
 }
 
 /* ------------------------------------------------------------------------ */
@@ -18598,6 +18665,17 @@ GLboolean glewParseArgs (int argc, char** argv, struct createParams *params)
       params->experimental = 1;
       ++p;
     }
+    else if (!strcmp(argv[p], "-json"))
+    {
+      json = GL_TRUE;
+      ++p;
+    }
+    else if (!strcmp(argv[p], "-diff"))
+    {
+      if (++p >= argc) return GL_TRUE;
+      json = GL_TRUE;
+      jsonBaseline = argv[p++];
+    }
     else
       return GL_TRUE;
   }
@@ -0,0 +1,158 @@
+/*
+** glewreport.h
+**
+** The -json reports of glewinfo and visualinfo hold one "key": value line
+** per extension, entry point or visual.  -diff <baseline> reads the report
+** just written and the baseline, sorts both by key and lists the keys
+** removed (-) from and added (+) to the baseline.  Included by both tools.
+*/
+
+#ifndef __glewreport_h__
+#define __glewreport_h__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Write s as a JSON string */
+static void glewReportString (FILE* out, const char* s)
+{
+  fputc('"', out);
+  for (; s != NULL && *s; ++s)
+  {
+    if (*s == '"' || *s == '\\')
+      fprintf(out, "\\%c", *s);
+    else if ((unsigned char)*s < 0x20)
+      fprintf(out, "\\u%04x", (unsigned char)*s);
+    else
+      fputc(*s, out);
+  }
+  fputc('"', out);
+}
+
+typedef struct
+{
+  char* key;
+  char* value;
+} glewReportEntry;
+
+static char* glewReportCopy (const char* s, size_t n)
+{
+  char* c = (char*)malloc(n + 1);
+  if (c == NULL) return NULL;
+  memcpy(c, s, n);
+  c[n] = '\0';
+  return c;
+}
+
+static int glewReportCompare (const void* a, const void* b)
+{
+  return strcmp(((const glewReportEntry*)a)->key, ((const glewReportEntry*)b)->key);
+}
+
+/* Read a line of any length into *line, growing it, 0 at the end of file */
+static int glewReportLine (FILE* in, char** line, size_t* size)
+{
+  size_t n = 0;
+  if (*line == NULL && (*line = (char*)malloc(*size = 256)) == NULL) return 0;
+  while (fgets(*line + n, (int)(*size - n), in))
+  {
+    char* t;
+    n += strlen(*line + n);
+    if (n > 0 && (*line)[n-1] == '\n') return 1;
+    if (n + 1 < *size) return 1;
+    if ((t = (char*)realloc(*line, *size * 2)) == NULL) return 0;
+    *line = t;
+    *size *= 2;
+  }
+  return n > 0;
+}
+
+/* The "key": value lines of a -json report, sorted by key */
+static glewReportEntry* glewReadReport (FILE* in, size_t* count)
+{
+  char* line = NULL;
+  size_t length = 0, n = 0, size = 1024;
+  glewReportEntry* e = (glewReportEntry*)malloc(size * sizeof(glewReportEntry));
+  while (e != NULL && glewReportLine(in, &line, &length))
+  {
+    const char* k = strchr(line, '"');
+    const char* q = k ? strchr(k + 1, '"') : NULL;
+    const char* v;
+    size_t len;
+    if (q == NULL || strncmp(q, "\": ", 3)) continue;
+    v = q + 3;
+    for (len = strlen(v); len > 0 && strchr("\r\n,", v[len-1]); --len);
+    if (n == size)
+    {
+      glewReportEntry* t = (glewReportEntry*)realloc(e, (size *= 2) * sizeof(glewReportEntry));
+      if (t == NULL) break;
+      e = t;
+    }
+    e[n].key = glewReportCopy(k + 1, (size_t)(q - k - 1));
+    e[n].value = glewReportCopy(v, len);
+    if (e[n].key == NULL || e[n].value == NULL) break;
+    ++n;
+  }
+  free(line);
+  if (e != NULL) qsort(e, n, sizeof(glewReportEntry), glewReportCompare);
+  *count = n;
+  return e;
+}
+
+static void glewFreeReport (glewReportEntry* e, size_t n)
+{
+  size_t i;
+  for (i = 0; e != NULL && i < n; ++i)
+  {
+    free(e[i].key);
+    free(e[i].value);
+  }
+  free(e);
+}
+
+/* Print the keys removed (-) from and added (+) to the report of tool at
+   baseline, and both values of the keys changed, returning 2 if there are
+   any, 1 on error */
+static int glewDiffReport (FILE* report, const char* baseline, const char* tool)
+{
+  FILE* b;
+  glewReportEntry *cur, *base;
+  size_t n, m, i = 0, j = 0;
+  int r = 0;
+#if defined(_MSC_VER) && (_MSC_VER >= 1400)
+  if (fopen_s(&b, baseline, "r") != 0)
+    b = NULL;
+#else
+  b = fopen(baseline, "r");
+#endif
+  if (b == NULL)
+  {
+    fprintf(stderr, "Error: could not open %s\n", baseline);
+    return 1;
+  }
+  rewind(report);
+  cur = glewReadReport(report, &n);
+  base = glewReadReport(b, &m);
+  fclose(b);
+  if (cur == NULL || base == NULL || m == 0)
+  {
+    fprintf(stderr, "Error: %s is not a %s -json report\n", baseline, tool);
+    r = 1;
+  }
+  else while (i < n || j < m)
+  {
+    const int c = i == n ? 1 : j == m ? -1 : strcmp(cur[i].key, base[j].key);
+    const int changed = c == 0 && strcmp(cur[i].value, base[j].value) != 0;
+    if (c > 0 || changed) printf("- %s: %s\n", base[j].key, base[j].value);
+    if (c < 0 || changed) printf("+ %s: %s\n", cur[i].key, cur[i].value);
+    if (c != 0 || changed) r = 2;
+    if (c >= 0) ++j;
+    if (c <= 0) ++i;
+  }
+  glewFreeReport(cur, n);
+  glewFreeReport(base, m);
+  return r;
+}
+
+#endif /* __glewreport_h__ */
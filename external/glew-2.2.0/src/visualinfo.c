@@ -28,11 +28,17 @@
 ** axbf     = # aux buffers
 ** dpth     = # bits of depth
 ** stcl     = # bits of stencil
+**
+** With -json the same information is written as one "key": value line per
+** extension and visual (per extension only on Windows, where the pixel
+** formats are listed in text alone), and -diff <baseline> compares it with
+** a report saved with -json, listing the lines removed (-) and added (+).
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <GL/glew.h>
 #if defined(GLEW_OSMESA)
 #define GLAPI extern
@@ -47,24 +53,24 @@
 #elif !defined(__HAIKU__)
 #include <GL/glxew.h>
 #endif
+#include "glewreport.h"
 
 #ifdef GLEW_MX
 GLEWContext _glewctx;
-#  define glewGetContext() (&_glewctx)
-#  ifdef _WIN32
-WGLEWContext _wglewctx;
-#    define wglewGetContext() (&_wglewctx)
-#  elif !defined(__APPLE__) && !defined(__HAIKU__) || defined(GLEW_APPLE_GLX)
-GLXEWContext _glxewctx;
-#    define glxewGetContext() (&_glxewctx)
-#  endif
 #endif /* GLEW_MX */
 
+/* GLX and EGL configs are probed into a table of attribute values */
+#if defined(GLEW_EGL) || !defined(GLEW_OSMESA) && !defined(_WIN32) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+#define PROBE_CONFIGS
+#endif
+
 typedef struct GLContextStruct
 {
 #if defined(GLEW_OSMESA)
   OSMesaContext ctx;
 #elif defined(GLEW_EGL)
+  EGLDisplay dpy;
+  EGLSurface surf;
   EGLContext ctx;
 #elif defined(_WIN32)
   HWND wnd;
@@ -92,6 +98,8 @@ int showall = 0;
 int displaystdout = 0;
 int verbose = 0;
 int drawableonly = 0;
+int json = 0;
+char* baseline = NULL;
 
 char* display = NULL;
 int visual = -1;
@@ -103,23 +111,26 @@ main (int argc, char** argv)
 {
   GLenum err;
   GLContext ctx;
+  int ret = 0;
 
   /* ---------------------------------------------------------------------- */
   /* parse arguments */
   if (GL_TRUE == ParseArgs(argc-1, argv+1))
   {
 #if defined(_WIN32)
-    fprintf(stderr, "Usage: visualinfo [-a] [-s] [-h] [-pf <id>]\n");
+    fprintf(stderr, "Usage: visualinfo [-a] [-s] [-h] [-pf <id>] [-json] [-diff <baseline>]\n");
     fprintf(stderr, "        -a: show all visuals\n");
     fprintf(stderr, "        -s: display to stdout instead of visualinfo.txt\n");
     fprintf(stderr, "        -pf <id>: use given pixelformat\n");
-    fprintf(stderr, "        -h: this screen\n");
+    fprintf(stderr, "        -json: one \"key\": value line per extension\n");
 #else
-    fprintf(stderr, "Usage: visualinfo [-h] [-display <display>] [-visual <id>]\n");
-    fprintf(stderr, "        -h: this screen\n");
+    fprintf(stderr, "Usage: visualinfo [-h] [-display <display>] [-visual <id>] [-json] [-diff <baseline>]\n");
     fprintf(stderr, "        -display <display>: use given display\n");
     fprintf(stderr, "        -visual <id>: use given visual\n");
+    fprintf(stderr, "        -json: one \"key\": value line per extension and visual\n");
 #endif
+    fprintf(stderr, "        -diff <baseline>: compare with a -json report\n");
+    fprintf(stderr, "        -h: this screen\n");
     return 1;
   }
 
@@ -137,11 +148,13 @@ main (int argc, char** argv)
   /* initialize GLEW */
   glewExperimental = GL_TRUE;
 #ifdef GLEW_MX
-  err = glewContextInit(glewGetContext());
-#  ifdef _WIN32
-  err = err || wglewContextInit(wglewGetContext());
+  err = glewContextInitFor(&_glewctx);
+  glewSetCurrentContext(&_glewctx);
+#  if defined(GLEW_OSMESA) || defined(GLEW_EGL)
+#  elif defined(_WIN32)
+  if (GLEW_OK == err) err = wglewInit();
 #  elif !defined(__APPLE__) && !defined(__HAIKU__) || defined(GLEW_APPLE_GLX)
-  err = err || glxewContextInit(glxewGetContext());
+  if (GLEW_OK == err) err = glxewInit();
 #  endif
 #else
   err = glewInit();
@@ -154,36 +167,75 @@ main (int argc, char** argv)
   }
 
   /* ---------------------------------------------------------------------- */
-  /* open file */
-#if defined(_WIN32)
-  if (!displaystdout)
+  /* open file, or a temporary one to compare with the baseline */
+  if (baseline != NULL)
   {
 #if defined(_MSC_VER) && (_MSC_VER >= 1400)
-    if (fopen_s(&file, "visualinfo.txt", "w") != 0)
-      file = stdout;
+    if (tmpfile_s(&file) != 0)
+      file = NULL;
 #else
-    file = fopen("visualinfo.txt", "w");
+    file = tmpfile();
 #endif
+    if (file == NULL)
+    {
+      fprintf(stderr, "Error: could not create a temporary file\n");
+      DestroyContext(&ctx);
+      return 1;
+    }
   }
-  if (file == NULL)
-    file = stdout;
+  else
+  {
+#if defined(_WIN32)
+    if (!displaystdout)
+    {
+#if defined(_MSC_VER) && (_MSC_VER >= 1400)
+      if (fopen_s(&file, "visualinfo.txt", "w") != 0)
+        file = stdout;
+#else
+      file = fopen("visualinfo.txt", "w");
+#endif
+    }
+    if (file == NULL)
+      file = stdout;
 #else
-  file = stdout;
+    file = stdout;
 #endif
+  }
+  setvbuf(file, NULL, _IOFBF, 1 << 16);
 
   /* ---------------------------------------------------------------------- */
   /* output header information */
   /* OpenGL extensions */
-  fprintf(file, "OpenGL vendor string: %s\n", glGetString(GL_VENDOR));
-  fprintf(file, "OpenGL renderer string: %s\n", glGetString(GL_RENDERER));
-  fprintf(file, "OpenGL version string: %s\n", glGetString(GL_VERSION));
-  fprintf(file, "OpenGL extensions (GL_): \n");
+  if (json)
+  {
+    fprintf(file, "{\n  \"gl.vendor\": ");
+    glewReportString(file, (const char*)glGetString(GL_VENDOR));
+    fprintf(file, ",\n  \"gl.renderer\": ");
+    glewReportString(file, (const char*)glGetString(GL_RENDERER));
+    fprintf(file, ",\n  \"gl.version\": ");
+    glewReportString(file, (const char*)glGetString(GL_VERSION));
+  }
+  else
+  {
+    fprintf(file, "OpenGL vendor string: %s\n", glGetString(GL_VENDOR));
+    fprintf(file, "OpenGL renderer string: %s\n", glGetString(GL_RENDERER));
+    fprintf(file, "OpenGL version string: %s\n", glGetString(GL_VERSION));
+    fprintf(file, "OpenGL extensions (GL_): \n");
+  }
   PrintExtensions((const char*)glGetString(GL_EXTENSIONS));
 
 #ifndef GLEW_NO_GLU
   /* GLU extensions */
-  fprintf(file, "GLU version string: %s\n", gluGetString(GLU_VERSION));
-  fprintf(file, "GLU extensions (GLU_): \n");
+  if (json)
+  {
+    fprintf(file, ",\n  \"glu.version\": ");
+    glewReportString(file, (const char*)gluGetString(GLU_VERSION));
+  }
+  else
+  {
+    fprintf(file, "GLU version string: %s\n", gluGetString(GLU_VERSION));
+    fprintf(file, "GLU extensions (GLU_): \n");
+  }
   PrintExtensions((const char*)gluGetString(GLU_EXTENSIONS));
 #endif
 
@@ -191,11 +243,14 @@ main (int argc, char** argv)
   /* extensions string */
 #if defined(GLEW_OSMESA)
 #elif defined(GLEW_EGL)
+  /* EGL extensions */
+  if (!json) fprintf(file, "EGL extensions (EGL_): \n");
+  PrintExtensions(eglQueryString(ctx.dpy, EGL_EXTENSIONS));
 #elif defined(_WIN32)
   /* WGL extensions */
   if (WGLEW_ARB_extensions_string || WGLEW_EXT_extensions_string)
   {
-    fprintf(file, "WGL extensions (WGL_): \n");
+    if (!json) fprintf(file, "WGL extensions (WGL_): \n");
     PrintExtensions(wglGetExtensionsStringARB ? 
                     (const char*)wglGetExtensionsStringARB(ctx.dc) :
 		    (const char*)wglGetExtensionsStringEXT());
@@ -208,7 +263,7 @@ main (int argc, char** argv)
 
 #else
   /* GLX extensions */
-  fprintf(file, "GLX extensions (GLX_): \n");
+  if (!json) fprintf(file, "GLX extensions (GLX_): \n");
   PrintExtensions(glXQueryExtensionsString(glXGetCurrentDisplay(), 
                                            DefaultScreen(glXGetCurrentDisplay())));
 #endif
@@ -216,13 +271,17 @@ main (int argc, char** argv)
   /* ---------------------------------------------------------------------- */
   /* enumerate all the formats */
   VisualInfo(&ctx);
+  if (json)
+    fprintf(file, "\n}\n");
+  if (baseline != NULL)
+    ret = glewDiffReport(file, baseline, "visualinfo");
 
   /* ---------------------------------------------------------------------- */
   /* release resources */
   DestroyContext(&ctx);
   if (file != stdout)
     fclose(file);
-  return 0;
+  return ret;
 }
 
 /* do the magic to separate all extensions with comma's, except
@@ -233,6 +292,18 @@ void PrintExtensions (const char* s)
   int i=0;
   char* p=0;
 
+  if (json)
+  {
+    while (*s)
+    {
+      const char* e = strchr(s, ' ');
+      if (e == NULL) e = s + strlen(s);
+      if (e != s) fprintf(file, ",\n  \"extension.%.*s\": true", (int)(e - s), s);
+      s = *e ? e + 1 : e;
+    }
+    return;
+  }
+
   t[79] = '\0';
   while (*s)
   {
@@ -269,11 +340,172 @@ void PrintExtensions (const char* s)
 
 /* ---------------------------------------------------------------------- */
 
-#if defined(GLEW_OSMESA) || defined(GLEW_EGL)
+#if defined(PROBE_CONFIGS)
+
+#define UNKNOWN INT_MIN  /* value of an attribute that failed to query */
+static void ProbeConfig (GLContext* ctx, const void* configs, int i, int* value);
+
+/* query the nattrib attributes of each of the n configs */
+static int* ProbeConfigs (GLContext* ctx, const void* configs, int n, int nattrib)
+{
+  int* values = (int*)malloc((size_t)(n > 0 ? n : 1) * nattrib * sizeof(int));
+  int i;
+  if (values == NULL) return NULL;
+  for (i = 0; i < n; i++)
+    ProbeConfig(ctx, configs, i, values + i * nattrib);
+  return values;
+}
+
+/* print a size column, . for zero and ? if the query failed */
+static void PrintSize (int value, int width, const char* end)
+{
+  if (UNKNOWN == value)
+    fprintf(file, "%*s%s", width, "?", end);
+  else if (0 == value)
+    fprintf(file, "%*s%s", width, ".", end);
+  else
+    fprintf(file, "%*d%s", width, value, end);
+}
+
+/* print the attributes of config i as a JSON object keyed by its id */
+static void PrintConfigJSON (int i, const char* const* name, const int* value, int nattrib)
+{
+  int j;
+  if (UNKNOWN == value[0])
+    fprintf(file, ",\n  \"config.?%d\": {", i);
+  else
+    fprintf(file, ",\n  \"config.%d\": {", value[0]);
+  for (j = 1; j < nattrib; j++)
+  {
+    if (UNKNOWN == value[j])
+      fprintf(file, "%s\"%s\": null", j > 1 ? ", " : "", name[j]);
+    else
+      fprintf(file, "%s\"%s\": %d", j > 1 ? ", " : "", name[j], value[j]);
+  }
+  fprintf(file, "}");
+}
+
+#endif /* PROBE_CONFIGS */
+
+/* ---------------------------------------------------------------------- */
+
+#if defined(GLEW_OSMESA)
+
+void
+VisualInfo (GLContext* ctx)
+{
+}
+
+#elif defined(GLEW_EGL)
+
+static const EGLint eglAttrib[] = {
+  EGL_CONFIG_ID, EGL_SURFACE_TYPE, EGL_NATIVE_RENDERABLE, EGL_COLOR_BUFFER_TYPE,
+  EGL_RENDERABLE_TYPE, EGL_CONFORMANT, EGL_NATIVE_VISUAL_ID,
+  EGL_BUFFER_SIZE, EGL_RED_SIZE, EGL_GREEN_SIZE, EGL_BLUE_SIZE, EGL_ALPHA_SIZE,
+  EGL_DEPTH_SIZE, EGL_STENCIL_SIZE, EGL_SAMPLES, EGL_SAMPLE_BUFFERS,
+  EGL_CONFIG_CAVEAT
+};
+
+static const char* const eglAttribName[] = {
+  "id", "surface_type", "native_renderable", "color_buffer_type",
+  "renderable_type", "conformant", "native_visual_id",
+  "buffer_size", "red_size", "green_size", "blue_size", "alpha_size",
+  "depth_size", "stencil_size", "samples", "sample_buffers",
+  "config_caveat"
+};
+
+#define N_ATTRIB ((int)(sizeof(eglAttrib) / sizeof(eglAttrib[0])))
+
+static void ProbeConfig (GLContext* ctx, const void* configs, int i, int* value)
+{
+  const EGLConfig config = ((const EGLConfig*)configs)[i];
+  EGLint v;
+  int j;
+  for (j = 0; j < N_ATTRIB; j++)
+    value[j] = eglGetConfigAttrib(ctx->dpy, config, eglAttrib[j], &v) ? (int)v : UNKNOWN;
+}
 
 void
 VisualInfo (GLContext* ctx)
 {
+  EGLConfig* configs;
+  EGLint n_config;
+  int* values;
+  int i;
+
+  if (!eglGetConfigs(ctx->dpy, NULL, 0, &n_config) || n_config <= 0) return;
+  configs = (EGLConfig*)malloc(n_config * sizeof(EGLConfig));
+  if (NULL == configs) return;
+  if (eglGetConfigs(ctx->dpy, configs, n_config, &n_config) &&
+      NULL != (values = ProbeConfigs(ctx, configs, n_config, N_ATTRIB)))
+  {
+    if (json)
+    {
+      for (i = 0; i < n_config; i++)
+        PrintConfigJSON(i, eglAttribName, values + i * N_ATTRIB, N_ATTRIB);
+    }
+    else if (!verbose)
+    {
+      /* print table header */
+      fprintf(file, " +-----+----------------+-----------------+-------+-------+------+\n");
+      fprintf(file, " |     |     config     |      color      | dp st |   ms  |  cav |\n");
+      fprintf(file, " |  id | tp nr bt gl es |  sz  r  g  b  a | th cl | ns  b |  eat |\n");
+      fprintf(file, " +-----+----------------+-----------------+-------+-------+------+\n");
+      for (i = 0; i < n_config; i++)
+      {
+        const int* value = values + i * N_ATTRIB;
+        /* config id */
+        if (UNKNOWN == value[0]) fprintf(file, " |  ?  | ");
+        else fprintf(file, " |% 4d | ", value[0]);
+        /* surface type */
+        if (UNKNOWN == value[1]) fprintf(file, " ? ");
+        else if (value[1] & EGL_WINDOW_BIT) fprintf(file, value[1] & EGL_PBUFFER_BIT ? "wp " : "wn ");
+        else if (value[1] & EGL_PBUFFER_BIT) fprintf(file, "pb ");
+        else if (value[1] & EGL_PIXMAP_BIT) fprintf(file, "pm ");
+        else fprintf(file, " . ");
+        /* native renderable */
+        fprintf(file, " %c ", UNKNOWN == value[2] ? '?' : (value[2] ? 'y' : '.'));
+        /* buffer type */
+        if (EGL_RGB_BUFFER == value[3]) fprintf(file, "rg ");
+        else if (EGL_LUMINANCE_BUFFER == value[3]) fprintf(file, "lu ");
+        else fprintf(file, " ? ");
+        /* OpenGL and highest OpenGL ES renderable */
+        if (UNKNOWN == value[4])
+          fprintf(file, " ?  ? | ");
+        else
+          fprintf(file, " %c  %c | ", value[4] & EGL_OPENGL_BIT ? 'y' : '.',
+                  value[4] & EGL_OPENGL_ES3_BIT ? '3' :
+                  value[4] & EGL_OPENGL_ES2_BIT ? '2' :
+                  value[4] & EGL_OPENGL_ES_BIT ? '1' : '.');
+        /* color */
+        PrintSize(value[7], 3, " ");
+        PrintSize(value[8], 2, " ");
+        PrintSize(value[9], 2, " ");
+        PrintSize(value[10], 2, " ");
+        PrintSize(value[11], 2, " | ");
+        /* depth and stencil */
+        PrintSize(value[12], 2, " ");
+        PrintSize(value[13], 2, " | ");
+        /* multisample */
+        if (UNKNOWN == value[14]) fprintf(file, " ? ");
+        else fprintf(file, "%2d ", value[14]);
+        if (UNKNOWN == value[15]) fprintf(file, " ? | ");
+        else fprintf(file, "%2d | ", value[15]);
+        /* caveat */
+        if (EGL_NONE == value[16]) fprintf(file, "none |\n");
+        else if (EGL_SLOW_CONFIG == value[16]) fprintf(file, "slow |\n");
+        else if (EGL_NON_CONFORMANT_CONFIG == value[16]) fprintf(file, "ncft |\n");
+        else fprintf(file, "???? |\n");
+      }
+      /* print table footer */
+      fprintf(file, " +-----+----------------+-----------------+-------+-------+------+\n");
+      fprintf(file, " |  id | tp nr bt gl es |  sz  r  g  b  a | th cl | ns  b |  eat |\n");
+      fprintf(file, " |     |     config     |      color      | dp st |   ms  |  cav |\n");
+      fprintf(file, " +-----+----------------+-----------------+-------+-------+------+\n");
+    }
+    free(values);
+  }
+  free(configs);
 }
 
 #elif defined(_WIN32)
@@ -606,6 +838,9 @@ VisualInfoGDI (GLContext* ctx)
 void
 VisualInfo (GLContext* ctx)
 {
+  /* the pixel format tables are text only */
+  if (json)
+    return;
   if (WGLEW_ARB_pixel_format)
     VisualInfoARB(ctx);
   else
@@ -645,18 +880,65 @@ VisualInfo (GLContext* ctx)
 
 #else /* GLX */
 
+static const int glxAttrib[] = {
+  GLX_FBCONFIG_ID, GLX_DRAWABLE_TYPE, GLX_X_RENDERABLE, GLX_X_VISUAL_TYPE,
+  GLX_RENDER_TYPE, GLX_FLOAT_COMPONENTS_NV, GLX_DOUBLEBUFFER, GLX_STEREO,
+  GLX_LEVEL, GLX_TRANSPARENT_TYPE,
+  GLX_BUFFER_SIZE, GLX_RED_SIZE, GLX_GREEN_SIZE, GLX_BLUE_SIZE, GLX_ALPHA_SIZE,
+  GLX_AUX_BUFFERS, GLX_DEPTH_SIZE, GLX_STENCIL_SIZE,
+  GLX_ACCUM_RED_SIZE, GLX_ACCUM_GREEN_SIZE, GLX_ACCUM_BLUE_SIZE, GLX_ACCUM_ALPHA_SIZE,
+  GLX_SAMPLES, GLX_SAMPLE_BUFFERS, GLX_CONFIG_CAVEAT
+};
+
+static const char* const glxAttribName[] = {
+  "id", "drawable_type", "x_renderable", "x_visual_type",
+  "render_type", "float_components", "double_buffer", "stereo",
+  "level", "transparent_type",
+  "buffer_size", "red_size", "green_size", "blue_size", "alpha_size",
+  "aux_buffers", "depth_size", "stencil_size",
+  "accum_red_size", "accum_green_size", "accum_blue_size", "accum_alpha_size",
+  "samples", "sample_buffers", "config_caveat"
+};
+
+#define N_ATTRIB ((int)(sizeof(glxAttrib) / sizeof(glxAttrib[0])))
+
+static void ProbeConfig (GLContext* ctx, const void* configs, int i, int* value)
+{
+  const GLXFBConfig config = ((const GLXFBConfig*)configs)[i];
+  int j;
+  for (j = 0; j < N_ATTRIB; j++)
+  {
+    /* float components only where GLX_NV_float_buffer is supported */
+    if ((GLX_FLOAT_COMPONENTS_NV == glxAttrib[j] && !GLXEW_NV_float_buffer) ||
+        Success != glXGetFBConfigAttrib(ctx->dpy, config, glxAttrib[j], &value[j]))
+      value[j] = UNKNOWN;
+  }
+}
+
 void
 VisualInfo (GLContext* ctx)
 {
   int n_fbc;
   GLXFBConfig* fbc;
-  int value, ret, i;
+  int* values;
+  int i;
 
   fbc = glXGetFBConfigs(ctx->dpy, DefaultScreen(ctx->dpy), &n_fbc);
 
   if (fbc)
   {
-    if (!verbose)
+    values = ProbeConfigs(ctx, fbc, n_fbc, N_ATTRIB);
+    if (NULL == values)
+    {
+      XFree(fbc);
+      return;
+    }
+    if (json)
+    {
+      for (i=0; i<n_fbc; i++)
+        PrintConfigJSON(i, glxAttribName, values + i * N_ATTRIB, N_ATTRIB);
+    }
+    else if (!verbose)
     {
       /* print table header */
       fprintf(file, " +-----+-------------------------+-----------------+----------+-------------+-------+------+\n");
@@ -666,347 +948,108 @@ VisualInfo (GLContext* ctx)
       /* loop through all the fbcs */
       for (i=0; i<n_fbc; i++)
       {
+        const int* value = values + i * N_ATTRIB;
         /* print out the information for this fbc */
         /* visual id */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_FBCONFIG_ID, &value);
-        if (ret != Success)
-        {
+        if (UNKNOWN == value[0])
           fprintf(file, "|  ?  |");
-        }
         else
-        {
-          fprintf(file, " |% 4d | ", value);
-        }
+          fprintf(file, " |% 4d | ", value[0]);
         /* visual type */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_DRAWABLE_TYPE, &value);
-        if (ret != Success)
-        {
+        if (UNKNOWN == value[1])
           fprintf(file, " ? ");
-        }
+        else if (value[1] & GLX_WINDOW_BIT)
+          fprintf(file, value[1] & GLX_PBUFFER_BIT ? "wp " : "wn ");
+        else if (value[1] & GLX_PBUFFER_BIT)
+          fprintf(file, "pb ");
+        else if (value[1] & GLX_PIXMAP_BIT)
+          fprintf(file, "pm ");
         else
-        {
-          if (value & GLX_WINDOW_BIT)
-          {
-            if (value & GLX_PBUFFER_BIT)
-            {
-              fprintf(file, "wp ");
-            }
-            else
-            {
-              fprintf(file, "wn ");
-            }
-          }
-          else
-          {
-            if (value & GLX_PBUFFER_BIT)
-            {
-              fprintf(file, "pb ");
-            }
-            else if (value & GLX_PIXMAP_BIT)
-            {
-              fprintf(file, "pm ");
-            }
-            else
-            {
-              fprintf(file, " ? ");
-            }
-          }
-        }
+          fprintf(file, " ? ");
         /* x renderable */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_X_RENDERABLE, &value);
-        if (ret != Success)
-        {
+        if (UNKNOWN == value[2])
           fprintf(file, " ? ");
-        }
         else
-        {
-          fprintf(file, value ? " y " : " n ");
-        }
+          fprintf(file, value[2] ? " y " : " n ");
         /* class */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_X_VISUAL_TYPE, &value);
-        if (ret != Success)
-        {
-          fprintf(file, " ? ");
-        }
+        if (GLX_TRUE_COLOR == value[3])
+          fprintf(file, "tc ");
+        else if (GLX_DIRECT_COLOR == value[3])
+          fprintf(file, "dc ");
+        else if (GLX_PSEUDO_COLOR == value[3])
+          fprintf(file, "pc ");
+        else if (GLX_STATIC_COLOR == value[3])
+          fprintf(file, "sc ");
+        else if (GLX_GRAY_SCALE == value[3])
+          fprintf(file, "gs ");
+        else if (GLX_STATIC_GRAY == value[3])
+          fprintf(file, "sg ");
+        else if (GLX_X_VISUAL_TYPE == value[3])
+          fprintf(file, " . ");
         else
-        {
-          if (GLX_TRUE_COLOR == value)
-            fprintf(file, "tc ");
-          else if (GLX_DIRECT_COLOR == value)
-            fprintf(file, "dc ");
-          else if (GLX_PSEUDO_COLOR == value)
-            fprintf(file, "pc ");
-          else if (GLX_STATIC_COLOR == value)
-            fprintf(file, "sc ");
-          else if (GLX_GRAY_SCALE == value)
-            fprintf(file, "gs ");
-          else if (GLX_STATIC_GRAY == value)
-            fprintf(file, "sg ");
-          else if (GLX_X_VISUAL_TYPE == value)
-            fprintf(file, " . ");
-          else
-            fprintf(file, " ? ");
-        }
+          fprintf(file, " ? ");
         /* format */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_RENDER_TYPE, &value);
-        if (ret != Success)
-        {
+        if (UNKNOWN == value[4])
           fprintf(file, " ? ");
-        }
+        else if (GLXEW_NV_float_buffer ? GL_TRUE == value[5] : 0 != (value[4] & GLX_RGBA_FLOAT_ATI_BIT))
+          fprintf(file, " f ");
+        else if (value[4] & GLX_RGBA_BIT)
+          fprintf(file, " i ");
+        else if (value[4] & GLX_COLOR_INDEX_BIT)
+          fprintf(file, " c ");
         else
-        {
-          if (GLXEW_NV_float_buffer)
-          {
-            int ret2, value2;
-            ret2 = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_FLOAT_COMPONENTS_NV, &value2);
-            if (Success == ret2 && GL_TRUE == value2)
-            {
-              fprintf(file, " f ");
-            }
-            else if (value & GLX_RGBA_BIT)
-              fprintf(file, " i ");
-            else if (value & GLX_COLOR_INDEX_BIT)
-              fprintf(file, " c ");
-            else
-              fprintf(file, " ? ");
-          }
-          else
-          {
-            if (value & GLX_RGBA_FLOAT_ATI_BIT)
-              fprintf(file, " f ");
-            else if (value & GLX_RGBA_BIT)
-              fprintf(file, " i ");
-            else if (value & GLX_COLOR_INDEX_BIT)
-              fprintf(file, " c ");
-            else
-              fprintf(file, " ? ");
-          }
-        }
+          fprintf(file, " ? ");
         /* double buffer */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_DOUBLEBUFFER, &value);
-        fprintf(file, " %c ", Success != ret ? '?' : (value ? 'y' : '.'));
+        fprintf(file, " %c ", UNKNOWN == value[6] ? '?' : (value[6] ? 'y' : '.'));
         /* stereo */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_STEREO, &value);
-        fprintf(file, " %c ", Success != ret ? '?' : (value ? 'y' : '.'));
+        fprintf(file, " %c ", UNKNOWN == value[7] ? '?' : (value[7] ? 'y' : '.'));
         /* level */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_LEVEL, &value);
-        if (Success != ret)
-        {
+        if (UNKNOWN == value[8])
           fprintf(file, " ? ");
-        }
         else
-        {
-          fprintf(file, "%2d ", value);
-        }
+          fprintf(file, "%2d ", value[8]);
         /* transparency */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_TRANSPARENT_TYPE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? | ");
-        }
-        else
-        {
-          if (GLX_TRANSPARENT_RGB == value)
-            fprintf(file, " r | ");
-          else if (GLX_TRANSPARENT_INDEX == value)
-            fprintf(file, " i | ");
-          else if (GLX_NONE == value)
-            fprintf(file, " . | ");
-          else
-            fprintf(file, " ? | ");
-        }
-        /* color size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_BUFFER_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, "  ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%3d ", value);
-          else
-            fprintf(file, "  . ");
-        }
-        /* red size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_RED_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* green size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_GREEN_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* blue size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_BLUE_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
+        if (GLX_TRANSPARENT_RGB == value[9])
+          fprintf(file, " r | ");
+        else if (GLX_TRANSPARENT_INDEX == value[9])
+          fprintf(file, " i | ");
+        else if (GLX_NONE == value[9])
+          fprintf(file, " . | ");
         else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* alpha size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_ALPHA_SIZE, &value);
-        if (Success != ret)
-        {
           fprintf(file, " ? | ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d | ", value);
-          else
-            fprintf(file, " . | ");
-        }
-        /* aux buffers */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_AUX_BUFFERS, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* depth size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_DEPTH_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* stencil size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_STENCIL_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? | ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d | ", value);
-          else
-            fprintf(file, " . | ");
-        }
-        /* accum red size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_ACCUM_RED_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* accum green size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_ACCUM_GREEN_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* accum blue size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_ACCUM_BLUE_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d ", value);
-          else
-            fprintf(file, " . ");
-        }
-        /* accum alpha size */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_ACCUM_ALPHA_SIZE, &value);
-        if (Success != ret)
-        {
-          fprintf(file, " ? | ");
-        }
-        else
-        {
-          if (value)
-            fprintf(file, "%2d | ", value);
-          else
-            fprintf(file, " . | ");
-        }
+        /* color size, red, green, blue and alpha size */
+        PrintSize(value[10], 3, " ");
+        PrintSize(value[11], 2, " ");
+        PrintSize(value[12], 2, " ");
+        PrintSize(value[13], 2, " ");
+        PrintSize(value[14], 2, " | ");
+        /* aux buffers, depth and stencil size */
+        PrintSize(value[15], 2, " ");
+        PrintSize(value[16], 2, " ");
+        PrintSize(value[17], 2, " | ");
+        /* accum red, green, blue and alpha size */
+        PrintSize(value[18], 2, " ");
+        PrintSize(value[19], 2, " ");
+        PrintSize(value[20], 2, " ");
+        PrintSize(value[21], 2, " | ");
         /* multisample */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_SAMPLES, &value);
-        if (Success != ret)
-        {
+        if (UNKNOWN == value[22])
           fprintf(file, " ? ");
-        }
         else
-        {
-          fprintf(file, "%2d ", value);
-        }
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_SAMPLE_BUFFERS, &value);
-        if (Success != ret)
-        {
+          fprintf(file, "%2d ", value[22]);
+        if (UNKNOWN == value[23])
           fprintf(file, " ? | ");
-        }
         else
-        {
-          fprintf(file, "%2d | ", value);
-        }
+          fprintf(file, "%2d | ", value[23]);
         /* caveat */
-        ret = glXGetFBConfigAttrib(ctx->dpy, fbc[i], GLX_CONFIG_CAVEAT, &value);
-        if (Success != ret)
-        {
-          fprintf(file, "???? |");
-        }
+        if (GLX_NONE == value[24])
+          fprintf(file, "none |\n");
+        else if (GLX_SLOW_CONFIG == value[24])
+          fprintf(file, "slow |\n");
+        else if (GLX_NON_CONFORMANT_CONFIG == value[24])
+          fprintf(file, "ncft |\n");
         else
-        {
-          if (GLX_NONE == value)
-            fprintf(file, "none |\n");
-          else if (GLX_SLOW_CONFIG == value)
-            fprintf(file, "slow |\n");
-          else if (GLX_NON_CONFORMANT_CONFIG == value)
-            fprintf(file, "ncft |\n");
-          else
-            fprintf(file, "???? |\n");
-        }
+          fprintf(file, "???? |\n");
       }
       /* print table footer */
       fprintf(file, " +-----+-------------------------+-----------------+----------+-------------+-------+------+\n");
@@ -1014,6 +1057,8 @@ VisualInfo (GLContext* ctx)
       fprintf(file, " |     |        visual           |      color      | ax dp st |    accum    |   ms  |  cav |\n");
       fprintf(file, " +-----+-------------------------+-----------------+----------+-------------+-------+------+\n");
     }
+    free(values);
+    XFree(fbc);
   }
 }
 
@@ -1058,18 +1103,72 @@ void DestroyContext (GLContext* ctx)
 #elif defined(GLEW_EGL)
 void InitContext (GLContext* ctx)
 {
-  ctx->ctx = NULL;
+  ctx->dpy = EGL_NO_DISPLAY;
+  ctx->surf = EGL_NO_SURFACE;
+  ctx->ctx = EGL_NO_CONTEXT;
 }
 
 GLboolean CreateContext (GLContext* ctx)
 {
+  EGLDeviceEXT devices[1];
+  EGLint numDevices;
+  EGLint configAttribs[] = {
+    EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+    EGL_RED_SIZE, 1,
+    EGL_GREEN_SIZE, 1,
+    EGL_BLUE_SIZE, 1,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_NONE
+  };
+  static const EGLint pBufferAttribs[] = {
+    EGL_WIDTH,  1,
+    EGL_HEIGHT, 1,
+    EGL_NONE
+  };
+  EGLConfig config;
+  EGLint numConfig;
+  EGLBoolean pBuffer = EGL_FALSE;
+  PFNEGLQUERYDEVICESEXTPROC queryDevices;
+  PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay;
+  PFNEGLGETDISPLAYPROC getDisplay;
+  /* check input */
+  if (NULL == ctx) return GL_TRUE;
+  /* use a device without a window system if there is one, see glewinfo */
+  queryDevices = (PFNEGLQUERYDEVICESEXTPROC) eglGetProcAddress("eglQueryDevicesEXT");
+  getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+  getDisplay = (PFNEGLGETDISPLAYPROC) eglGetProcAddress("eglGetDisplay");
+  if (queryDevices && getPlatformDisplay &&
+      queryDevices(1, devices, &numDevices) && 1 == numDevices)
+  {
+    ctx->dpy = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[0], 0);
+    configAttribs[1] = EGL_PBUFFER_BIT;
+    pBuffer = EGL_TRUE;
+  }
+  if (EGL_NO_DISPLAY == ctx->dpy && getDisplay)
+    ctx->dpy = getDisplay(EGL_DEFAULT_DISPLAY);
+  if (EGL_NO_DISPLAY == ctx->dpy) return GL_TRUE;
+  /* initialize the display and the EGL entry points */
+  if (GLEW_OK != eglewInit(ctx->dpy)) return GL_TRUE;
+  /* create context */
+  if (!eglBindAPI(EGL_OPENGL_API)) return GL_TRUE;
+  if (!eglChooseConfig(ctx->dpy, configAttribs, &config, 1, &numConfig) || 1 != numConfig) return GL_TRUE;
+  ctx->ctx = eglCreateContext(ctx->dpy, config, EGL_NO_CONTEXT, NULL);
+  if (EGL_NO_CONTEXT == ctx->ctx) return GL_TRUE;
+  /* a pbuffer, or no surface at all if the display has no windows */
+  if (pBuffer)
+    ctx->surf = eglCreatePbufferSurface(ctx->dpy, config, pBufferAttribs);
+  /* make context current */
+  if (!eglMakeCurrent(ctx->dpy, ctx->surf, ctx->surf, ctx->ctx)) return GL_TRUE;
   return GL_FALSE;
 }
 
 void DestroyContext (GLContext* ctx)
 {
-  if (NULL == ctx) return;
-  return;
+  if (NULL == ctx || EGL_NO_DISPLAY == ctx->dpy || NULL == eglTerminate) return;
+  eglMakeCurrent(ctx->dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+  if (EGL_NO_CONTEXT != ctx->ctx) eglDestroyContext(ctx->dpy, ctx->ctx);
+  if (EGL_NO_SURFACE != ctx->surf) eglDestroySurface(ctx->dpy, ctx->surf);
+  eglTerminate(ctx->dpy);
 }
 
 /* ------------------------------------------------------------------------ */
@@ -1252,8 +1351,18 @@ GLboolean ParseArgs (int argc, char** argv)
   int p = 0;
   while (p < argc)
   {
+    if (!strcmp(argv[p], "-json"))
+    {
+      json = 1;
+    }
+    else if (!strcmp(argv[p], "-diff"))
+    {
+      if (++p >= argc) return GL_TRUE;
+      json = 1;
+      baseline = argv[p];
+    }
 #if defined(_WIN32)
-    if (!strcmp(argv[p], "-pf") || !strcmp(argv[p], "-pixelformat"))
+    else if (!strcmp(argv[p], "-pf") || !strcmp(argv[p], "-pixelformat"))
     {
       if (++p >= argc) return GL_TRUE;
       display = NULL;
@@ -1274,7 +1383,7 @@ GLboolean ParseArgs (int argc, char** argv)
     else
       return GL_TRUE;
 #else
-    if (!strcmp(argv[p], "-display"))
+    else if (!strcmp(argv[p], "-display"))
     {
       if (++p >= argc) return GL_TRUE;
       display = argv[p];